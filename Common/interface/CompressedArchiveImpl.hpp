@@ -0,0 +1,126 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Implementation of the Diligent::CompressedArchiveImpl class
+
+// Compressed archive layout
+//
+// | Uncompressed prefix | Header | PageInfo[NumPages] | Compressed pages |
+//
+// The data that follows the prefix is split into pages of up to MaxPageSize bytes that are compressed
+// independently by LZCompress(), so that reading any range of the archive only requires decompressing
+// the pages that the range overlaps.
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "../../Primitives/interface/FileStream.h"
+#include "Archive.h"
+#include "ObjectBase.hpp"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Archive implementation that decompresses the data of the source archive on demand.
+class CompressedArchiveImpl final : public ObjectBase<IArchive>
+{
+public:
+    using TObjectBase = ObjectBase<IArchive>;
+
+    static constexpr Uint32 HeaderMagicNumber = 0x47505A4C; // 'LZPG'
+    static constexpr Uint32 MaxPageSize       = 64u << 10u;
+
+    struct Header
+    {
+        Uint32 MagicNumber = 0;
+        Uint32 NumPages    = 0;
+        Uint64 Size        = 0; // Uncompressed archive size, including the prefix
+    };
+    static_assert(sizeof(Header) == 16, "Header size must be 16 bytes");
+
+    struct PageInfo
+    {
+        Uint32 Offset     = 0; // Offset of the page in the uncompressed archive
+        Uint32 Size       = 0; // Uncompressed page size
+        Uint32 DataOffset = 0; // Offset of the compressed page data in the source archive
+        Uint32 DataSize   = 0; // Compressed page size. Pages that do not compress are stored as is (DataSize == Size).
+    };
+    static_assert(sizeof(PageInfo) == 16, "PageInfo size must be 16 bytes");
+
+    /// Contiguous range of the uncompressed archive data.
+    struct DataRange
+    {
+        const void* pData = nullptr;
+        size_t      Size  = 0;
+    };
+
+    /// Creates the archive that reads the compressed data from pSource.
+
+    /// \param [in] pSource    - Source archive that contains the compressed data.
+    /// \param [in] PrefixSize - Size of the uncompressed prefix of the source archive.
+    static RefCntAutoPtr<IArchive> Create(IArchive* pSource, Uint32 PrefixSize);
+
+    CompressedArchiveImpl(IReferenceCounters* pRefCounters, IArchive* pSource, Uint32 PrefixSize);
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_Archive, TObjectBase)
+
+    virtual Bool DILIGENT_CALL_TYPE Read(Uint64 Offset, Uint64 Size, void* pData) override final;
+
+    virtual Uint64 DILIGENT_CALL_TYPE GetSize() const override final { return m_Size; }
+
+    /// Compresses the data ranges and writes them to the stream.
+
+    /// \param [in] pStream    - Destination stream. The uncompressed prefix of PrefixSize bytes
+    ///                          must already be written to the stream.
+    /// \param [in] PrefixSize - Size of the uncompressed prefix.
+    /// \param [in] Ranges     - Data ranges that follow the prefix. Every range starts a new page,
+    ///                          so that reading one range never requires decompressing another.
+    ///
+    /// \return     true if the data has been written successfully, and false otherwise.
+    static bool Write(IFileStream* pStream, Uint32 PrefixSize, const std::vector<DataRange>& Ranges);
+
+private:
+    using PageDataPtr = std::shared_ptr<const std::vector<Uint8>>;
+
+    PageDataPtr DecompressPage(size_t PageIdx);
+
+    RefCntAutoPtr<IArchive> m_pSource;
+    const Uint32            m_PrefixSize;
+    Uint64                  m_Size = 0;
+    std::vector<PageInfo>   m_Pages;
+
+    // The most recently decompressed page
+    std::mutex  m_CacheMtx;
+    size_t      m_CachedPageIdx = ~size_t{0};
+    PageDataPtr m_pCachedPage;
+};
+
+} // namespace Diligent
@@ -0,0 +1,73 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines a fast self-contained LZ77-class block codec
+
+#include <cstddef>
+
+namespace Diligent
+{
+
+// The codec uses the byte-oriented sequence format similar to LZ4:
+//
+//  | Token | Literal length ext. | Literals | Offset (2 bytes) | Match length ext. | ... | Token | Literals |
+//
+// The upper 4 bits of the token encode the literal count, the lower 4 bits encode the match length minus 4.
+// A value of 15 is followed by extension bytes that are added to it; every 255 byte is followed by another one.
+// The last sequence contains literals only. The maximum match offset is 65535 bytes.
+
+/// Returns the maximum size of the compressed data for the source data of the given size.
+size_t LZCompressBound(size_t SrcSize);
+
+/// Compresses the data.
+
+/// \param [in]  pSrc    - Source data.
+/// \param [in]  SrcSize - Source data size, in bytes.
+/// \param [out] pDst    - Destination buffer.
+/// \param [in]  DstSize - Destination buffer size, in bytes.
+///
+/// \return     The size of the compressed data, or 0 if the destination buffer is too small.
+///
+/// \remarks    The destination buffer of LZCompressBound(SrcSize) bytes is always large enough.
+size_t LZCompress(const void* pSrc, size_t SrcSize, void* pDst, size_t DstSize);
+
+/// Decompresses the data produced by LZCompress().
+
+/// \param [in]  pSrc    - Compressed data.
+/// \param [in]  SrcSize - Compressed data size, in bytes.
+/// \param [out] pDst    - Destination buffer.
+/// \param [in]  DstSize - Size of the decompressed data, in bytes.
+///
+/// \return     true if exactly DstSize bytes have been decompressed, and false otherwise.
+///
+/// \remarks    The function never reads or writes out of the buffer bounds,
+///             so it is safe to use with untrusted data.
+bool LZDecompress(const void* pSrc, size_t SrcSize, void* pDst, size_t DstSize);
+
+} // namespace Diligent
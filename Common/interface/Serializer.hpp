@@ -160,6 +160,8 @@ public:
 
     using TPointer = typename std::conditional_t<Mode == SerializerMode::Write, Uint8*, const Uint8*>;
 
+    using InBytesPtr = typename std::conditional_t<Mode == SerializerMode::Read, const void*&, const void*>;
+
     template <typename T>
     using ConstQual = typename std::conditional_t<Mode == SerializerMode::Read, T, const T>;
 
@@ -199,11 +201,19 @@ public:
                         CountType&              Count,
                         ArrayElemSerializerType ElemSerializer);
 
+    // Serializes the array of trivially serializable elements as a single span.
+    // In Read mode, the elements are not copied when the pointer type is const and
+    // the serialized data is properly aligned: the array then points directly to the
+    // serialized data, the same way as the strings do.
     template <typename ElemPtrType, typename CountType>
     void SerializeArrayRaw(DynamicLinearAllocator* Allocator,
                            ElemPtrType&            Elements,
                            CountType&              Count);
 
+    // Serializes Size raw bytes (e.g. shader byte code) as a single span.
+    // In Read mode, the data is not copied and pBytes is set to point to the serialized data.
+    void SerializeBytes(InBytesPtr pBytes, size_t Size);
+
     template <typename T>
     TReadOnly<T> Cast()
     {
@@ -260,6 +270,16 @@ private:
     template <typename T>
     void Copy(T* pData, size_t Size);
 
+    template <typename T>
+    bool PointToData(const T*& pDst, size_t Size);
+
+    template <typename T>
+    bool PointToData(T*& pDst, size_t Size)
+    {
+        // Non-const arrays must always be copied
+        return false;
+    }
+
 private:
     TPointer const m_Start = nullptr;
     TPointer const m_End   = nullptr;
@@ -294,6 +314,19 @@ void Serializer<SerializerMode::Measure>::Copy(T* pData, size_t Size)
     m_Ptr += Size;
 }
 
+template <>
+template <typename T>
+bool Serializer<SerializerMode::Read>::PointToData(const T*& pDst, size_t Size)
+{
+    if (reinterpret_cast<size_t>(m_Ptr) % alignof(T) != 0)
+        return false;
+
+    VERIFY(m_Ptr + Size <= m_End, "Note enough data to read ", Size, " bytes");
+    pDst = reinterpret_cast<const T*>(m_Ptr);
+    m_Ptr += Size;
+    return true;
+}
+
 template <>
 template <typename T>
 typename Serializer<SerializerMode::Read>::TEnableStr<T> Serializer<SerializerMode::Read>::Serialize(InCharPtr Str)
@@ -365,14 +398,59 @@ void Serializer<SerializerMode::Read>::SerializeArray(DynamicLinearAllocator* Al
 template <SerializerMode Mode>
 template <typename ElemPtrType, typename CountType>
 void Serializer<Mode>::SerializeArrayRaw(DynamicLinearAllocator* Allocator,
-                                         ElemPtrType&            Elements,
+                                         ElemPtrType&            SrcArray,
                                          CountType&              Count)
 {
-    SerializeArray(Allocator, Elements, Count,
-                   [](Serializer<Mode>& Ser, auto& Elem) //
-                   {
-                       Ser(Elem);
-                   });
+    using ElemType = RawType<decltype(SrcArray[0])>;
+    static_assert(IsTriviallySerializable<ElemType>::value, "Array elements must be trivially serializable");
+    VERIFY_EXPR((SrcArray != nullptr) == (Count != 0));
+
+    (*this)(Count);
+    Copy(SrcArray, sizeof(ElemType) * static_cast<size_t>(Count));
+}
+
+template <>
+template <typename ElemPtrType, typename CountType>
+void Serializer<SerializerMode::Read>::SerializeArrayRaw(DynamicLinearAllocator* Allocator,
+                                                         ElemPtrType&            DstArray,
+                                                         CountType&              Count)
+{
+    using ElemType = RawType<decltype(DstArray[0])>;
+    static_assert(IsTriviallySerializable<ElemType>::value, "Array elements must be trivially serializable");
+    VERIFY_EXPR(Allocator != nullptr);
+    VERIFY_EXPR(DstArray == nullptr);
+
+    (*this)(Count);
+    if (Count == 0)
+        return;
+
+    const size_t DataSize = sizeof(ElemType) * static_cast<size_t>(Count);
+    if (!PointToData(DstArray, DataSize))
+    {
+        auto* pDstElements = Allocator->Allocate<ElemType>(static_cast<size_t>(Count));
+        Copy(pDstElements, DataSize);
+        DstArray = pDstElements;
+    }
+}
+
+template <>
+inline void Serializer<SerializerMode::Read>::SerializeBytes(InBytesPtr pBytes, size_t Size)
+{
+    VERIFY(m_Ptr + Size <= m_End, "Note enough data to read ", Size, " bytes");
+    pBytes = Size > 0 ? m_Ptr : nullptr;
+    m_Ptr += Size;
+}
+
+template <>
+inline void Serializer<SerializerMode::Write>::SerializeBytes(InBytesPtr pBytes, size_t Size)
+{
+    Copy(pBytes, Size);
+}
+
+template <>
+inline void Serializer<SerializerMode::Measure>::SerializeBytes(InBytesPtr pBytes, size_t Size)
+{
+    Copy(pBytes, Size);
 }
 
 } // namespace Diligent
@@ -0,0 +1,242 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "CompressedArchiveImpl.hpp"
+
+#include <cstring>
+#include <algorithm>
+
+#include "LZCodec.hpp"
+#include "Cast.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+CompressedArchiveImpl::CompressedArchiveImpl(IReferenceCounters* pRefCounters, IArchive* pSource, Uint32 PrefixSize) :
+    TObjectBase{pRefCounters},
+    m_pSource{pSource},
+    m_PrefixSize{PrefixSize}
+{
+    if (!m_pSource)
+        LOG_ERROR_AND_THROW("pSource must not be null");
+
+    const auto SourceSize = m_pSource->GetSize();
+
+    Header Hdr;
+    if (!m_pSource->Read(m_PrefixSize, sizeof(Hdr), &Hdr))
+        LOG_ERROR_AND_THROW("Failed to read compressed archive header");
+
+    if (Hdr.MagicNumber != HeaderMagicNumber)
+        LOG_ERROR_AND_THROW("Compressed archive header magic number is incorrect");
+
+    if (Uint64{Hdr.NumPages} * sizeof(PageInfo) > SourceSize)
+        LOG_ERROR_AND_THROW("Invalid number of pages in the compressed archive");
+
+    m_Pages.resize(Hdr.NumPages);
+    if (!m_pSource->Read(Uint64{m_PrefixSize} + sizeof(Hdr), sizeof(PageInfo) * m_Pages.size(), m_Pages.data()))
+        LOG_ERROR_AND_THROW("Failed to read compressed archive pages");
+
+    // Pages must cover the archive without gaps
+    Uint64 Offset = m_PrefixSize;
+    for (const auto& Page : m_Pages)
+    {
+        if (Page.Offset != Offset || Page.Size == 0 || Page.Size > MaxPageSize)
+            LOG_ERROR_AND_THROW("Invalid compressed archive page at offset ", Page.Offset);
+
+        if (Page.DataSize == 0 || Page.DataSize > Page.Size || Uint64{Page.DataOffset} + Page.DataSize > SourceSize)
+            LOG_ERROR_AND_THROW("Invalid compressed data range of the archive page at offset ", Page.Offset);
+
+        Offset += Page.Size;
+    }
+
+    if (Offset != Hdr.Size)
+        LOG_ERROR_AND_THROW("Compressed archive size (", Hdr.Size, ") does not match the total size of the pages (", Offset, ")");
+
+    m_Size = Offset;
+}
+
+RefCntAutoPtr<IArchive> CompressedArchiveImpl::Create(IArchive* pSource, Uint32 PrefixSize)
+{
+    return RefCntAutoPtr<IArchive>{MakeNewRCObj<CompressedArchiveImpl>()(pSource, PrefixSize)};
+}
+
+CompressedArchiveImpl::PageDataPtr CompressedArchiveImpl::DecompressPage(size_t PageIdx)
+{
+    {
+        std::lock_guard<std::mutex> Lock{m_CacheMtx};
+        if (m_CachedPageIdx == PageIdx)
+            return m_pCachedPage;
+    }
+
+    const auto& Page = m_Pages[PageIdx];
+
+    std::vector<Uint8> CompressedData(Page.DataSize);
+    if (!m_pSource->Read(Page.DataOffset, CompressedData.size(), CompressedData.data()))
+    {
+        LOG_ERROR_MESSAGE("Failed to read the data of the archive page at offset ", Page.Offset);
+        return {};
+    }
+
+    auto pPageData = std::make_shared<std::vector<Uint8>>(Page.Size);
+    if (!LZDecompress(CompressedData.data(), CompressedData.size(), pPageData->data(), pPageData->size()))
+    {
+        LOG_ERROR_MESSAGE("Failed to decompress the archive page at offset ", Page.Offset, ". The archive may be corrupted.");
+        return {};
+    }
+
+    std::lock_guard<std::mutex> Lock{m_CacheMtx};
+    m_CachedPageIdx = PageIdx;
+    m_pCachedPage   = pPageData;
+    return pPageData;
+}
+
+Bool CompressedArchiveImpl::Read(Uint64 Offset, Uint64 Size, void* pData)
+{
+    if (Size == 0)
+        return True;
+
+    if (Offset >= m_Size)
+        return False;
+
+    DEV_CHECK_ERR(pData != nullptr, "pData must not be null");
+
+    const auto RemainingSize = m_Size - Offset;
+    const auto EndOffset     = Offset + std::min(Size, RemainingSize);
+    auto*      pDst          = static_cast<Uint8*>(pData);
+
+    if (Offset < m_PrefixSize)
+    {
+        const auto PrefixReadSize = std::min(EndOffset, Uint64{m_PrefixSize}) - Offset;
+        if (!m_pSource->Read(Offset, PrefixReadSize, pDst))
+            return False;
+
+        pDst += PrefixReadSize;
+        Offset += PrefixReadSize;
+    }
+
+    if (Offset < EndOffset)
+    {
+        // Find the page that contains Offset
+        auto PageIt = std::upper_bound(m_Pages.begin(), m_Pages.end(), Offset,
+                                       [](Uint64 Pos, const PageInfo& Page) //
+                                       {
+                                           return Pos < Page.Offset;
+                                       });
+        VERIFY_EXPR(PageIt != m_Pages.begin());
+        auto PageIdx = static_cast<size_t>(PageIt - m_Pages.begin()) - 1;
+
+        for (; Offset < EndOffset; ++PageIdx)
+        {
+            VERIFY_EXPR(PageIdx < m_Pages.size());
+            const auto& Page = m_Pages[PageIdx];
+
+            const auto OffsetInPage = Offset - Page.Offset;
+            const auto CopySize     = std::min(EndOffset - Offset, Page.Size - OffsetInPage);
+            if (Page.DataSize == Page.Size)
+            {
+                // The page is stored uncompressed
+                if (!m_pSource->Read(Page.DataOffset + OffsetInPage, CopySize, pDst))
+                    return False;
+            }
+            else
+            {
+                const auto pPageData = DecompressPage(PageIdx);
+                if (!pPageData)
+                    return False;
+
+                memcpy(pDst, pPageData->data() + OffsetInPage, StaticCast<size_t>(CopySize));
+            }
+
+            pDst += CopySize;
+            Offset += CopySize;
+        }
+    }
+
+    return Size <= RemainingSize;
+}
+
+bool CompressedArchiveImpl::Write(IFileStream* pStream, Uint32 PrefixSize, const std::vector<DataRange>& Ranges)
+{
+    DEV_CHECK_ERR(pStream != nullptr, "pStream must not be null");
+
+    std::vector<PageInfo> Pages;
+    std::vector<Uint8>    Data;
+
+    Uint64 Offset = PrefixSize;
+    for (const auto& Range : Ranges)
+    {
+        for (size_t Pos = 0; Pos < Range.Size; Pos += MaxPageSize)
+        {
+            const auto* pSrc = static_cast<const Uint8*>(Range.pData) + Pos;
+
+            PageInfo Page;
+            Page.Offset     = static_cast<Uint32>(Offset + Pos);
+            Page.Size       = static_cast<Uint32>(std::min(size_t{MaxPageSize}, Range.Size - Pos));
+            Page.DataOffset = static_cast<Uint32>(Data.size());
+
+            Data.resize(Page.DataOffset + LZCompressBound(Page.Size));
+            auto CompressedSize = LZCompress(pSrc, Page.Size, &Data[Page.DataOffset], Data.size() - Page.DataOffset);
+            if (CompressedSize == 0 || CompressedSize >= Page.Size)
+            {
+                // Store the page as is
+                memcpy(&Data[Page.DataOffset], pSrc, Page.Size);
+                CompressedSize = Page.Size;
+            }
+            Page.DataSize = static_cast<Uint32>(CompressedSize);
+            Data.resize(Page.DataOffset + Page.DataSize);
+
+            Pages.push_back(Page);
+        }
+        Offset += Range.Size;
+    }
+
+    const Uint64 DataOffset = Uint64{PrefixSize} + sizeof(Header) + sizeof(PageInfo) * Pages.size();
+    if (Offset > ~Uint32{0} || DataOffset + Data.size() > ~Uint32{0})
+    {
+        LOG_ERROR_MESSAGE("Compressed archive size exceeds 4 GB");
+        return false;
+    }
+
+    for (auto& Page : Pages)
+        Page.DataOffset += static_cast<Uint32>(DataOffset);
+
+    Header Hdr;
+    Hdr.MagicNumber = HeaderMagicNumber;
+    Hdr.NumPages    = static_cast<Uint32>(Pages.size());
+    Hdr.Size        = Offset;
+
+    if (!pStream->Write(&Hdr, sizeof(Hdr)))
+        return false;
+    if (!Pages.empty() && !pStream->Write(Pages.data(), sizeof(PageInfo) * Pages.size()))
+        return false;
+    if (!Data.empty() && !pStream->Write(Data.data(), Data.size()))
+        return false;
+
+    return true;
+}
+
+} // namespace Diligent
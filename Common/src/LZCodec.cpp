@@ -0,0 +1,253 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "LZCodec.hpp"
+
+#include <cstring>
+#include <algorithm>
+
+#include "../../Primitives/interface/BasicTypes.h"
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr size_t MinMatchLength = 4;
+constexpr size_t MaxMatchOffset = 65535;
+constexpr size_t MaxTokenValue  = 15;
+constexpr Uint32 HashTableLog   = 12;
+
+inline Uint32 ReadUint32(const Uint8* pSrc)
+{
+    Uint32 Val;
+    memcpy(&Val, pSrc, sizeof(Val));
+    return Val;
+}
+
+inline Uint32 HashSequence(Uint32 Seq)
+{
+    return (Seq * 2654435761u) >> (32 - HashTableLog);
+}
+
+bool WriteLengthExtension(Uint8*& pDst, const Uint8* pDstEnd, size_t Length)
+{
+    Length -= MaxTokenValue;
+    for (; Length >= 255; Length -= 255)
+    {
+        if (pDst == pDstEnd)
+            return false;
+        *pDst++ = 255;
+    }
+    if (pDst == pDstEnd)
+        return false;
+    *pDst++ = static_cast<Uint8>(Length);
+    return true;
+}
+
+bool ReadLengthExtension(const Uint8*& pSrc, const Uint8* pSrcEnd, size_t& Length)
+{
+    while (pSrc != pSrcEnd)
+    {
+        const auto Byte = *pSrc++;
+        Length += Byte;
+        if (Byte != 255)
+            return true;
+    }
+    return false;
+}
+
+// Writes the sequence of literals optionally followed by the match.
+// The sequence without the match (MatchLength == 0) terminates the compressed stream.
+bool WriteSequence(Uint8*&      pDst,
+                   const Uint8* pDstEnd,
+                   const Uint8* pLiterals,
+                   size_t       NumLiterals,
+                   size_t       MatchOffset,
+                   size_t       MatchLength)
+{
+    if (pDst == pDstEnd)
+        return false;
+
+    auto& Token = *pDst++;
+    Token       = static_cast<Uint8>(std::min(NumLiterals, MaxTokenValue) << 4u);
+    if (MatchLength != 0)
+        Token |= static_cast<Uint8>(std::min(MatchLength - MinMatchLength, MaxTokenValue));
+
+    if (NumLiterals >= MaxTokenValue && !WriteLengthExtension(pDst, pDstEnd, NumLiterals))
+        return false;
+
+    if (static_cast<size_t>(pDstEnd - pDst) < NumLiterals)
+        return false;
+    if (NumLiterals > 0)
+        memcpy(pDst, pLiterals, NumLiterals);
+    pDst += NumLiterals;
+
+    if (MatchLength == 0)
+        return true;
+
+    if (pDstEnd - pDst < 2)
+        return false;
+    *pDst++ = static_cast<Uint8>(MatchOffset & 0xFFu);
+    *pDst++ = static_cast<Uint8>(MatchOffset >> 8u);
+
+    if (MatchLength - MinMatchLength >= MaxTokenValue && !WriteLengthExtension(pDst, pDstEnd, MatchLength - MinMatchLength))
+        return false;
+
+    return true;
+}
+
+} // namespace
+
+size_t LZCompressBound(size_t SrcSize)
+{
+    // Incompressible data is stored as a single literal run
+    return SrcSize + SrcSize / 255 + 16;
+}
+
+size_t LZCompress(const void* pSrc, size_t SrcSize, void* pDst, size_t DstSize)
+{
+    const auto* const pSrcData = static_cast<const Uint8*>(pSrc);
+    auto* const       pDstData = static_cast<Uint8*>(pDst);
+    const auto* const pDstEnd  = pDstData + DstSize;
+    auto*             pOut     = pDstData;
+
+    size_t Anchor = 0; // Start of the pending literals
+    if (SrcSize >= MinMatchLength)
+    {
+        // Positions of the last occurrences of 4-byte sequences
+        Uint32 HashTable[1u << HashTableLog] = {};
+
+        const size_t MatchLimit = SrcSize - MinMatchLength;
+
+        size_t Pos    = 0;
+        size_t Misses = 0;
+        while (Pos <= MatchLimit)
+        {
+            const auto Seq   = ReadUint32(pSrcData + Pos);
+            auto&      Entry = HashTable[HashSequence(Seq)];
+            size_t     Match = Entry;
+            Entry            = static_cast<Uint32>(Pos);
+
+            if (Match >= Pos || Pos - Match > MaxMatchOffset || ReadUint32(pSrcData + Match) != Seq)
+            {
+                // Skip faster through incompressible data
+                Pos += 1 + (Misses++ >> 5u);
+                continue;
+            }
+
+            // Extend the match backwards over the pending literals
+            while (Pos > Anchor && Match > 0 && pSrcData[Pos - 1] == pSrcData[Match - 1])
+            {
+                --Pos;
+                --Match;
+            }
+
+            size_t Length = MinMatchLength;
+            while (Pos + Length < SrcSize && pSrcData[Match + Length] == pSrcData[Pos + Length])
+                ++Length;
+
+            if (!WriteSequence(pOut, pDstEnd, pSrcData + Anchor, Pos - Anchor, Pos - Match, Length))
+                return 0;
+
+            Pos += Length;
+            Anchor = Pos;
+            Misses = 0;
+
+            // Register the position inside the match to improve the ratio for repeated patterns
+            if (Pos - 2 <= MatchLimit)
+                HashTable[HashSequence(ReadUint32(pSrcData + Pos - 2))] = static_cast<Uint32>(Pos - 2);
+        }
+    }
+
+    if (!WriteSequence(pOut, pDstEnd, pSrcData + Anchor, SrcSize - Anchor, 0, 0))
+        return 0;
+
+    return static_cast<size_t>(pOut - pDstData);
+}
+
+bool LZDecompress(const void* pSrc, size_t SrcSize, void* pDst, size_t DstSize)
+{
+    const auto*       pIn      = static_cast<const Uint8*>(pSrc);
+    const auto* const pSrcEnd  = pIn + SrcSize;
+    auto* const       pDstData = static_cast<Uint8*>(pDst);
+    const auto* const pDstEnd  = pDstData + DstSize;
+    auto*             pOut     = pDstData;
+
+    while (pIn != pSrcEnd)
+    {
+        const auto Token = *pIn++;
+
+        size_t NumLiterals = Token >> 4u;
+        if (NumLiterals == MaxTokenValue && !ReadLengthExtension(pIn, pSrcEnd, NumLiterals))
+            return false;
+        if (static_cast<size_t>(pSrcEnd - pIn) < NumLiterals || static_cast<size_t>(pDstEnd - pOut) < NumLiterals)
+            return false;
+        if (NumLiterals > 0)
+            memcpy(pOut, pIn, NumLiterals);
+        pIn += NumLiterals;
+        pOut += NumLiterals;
+
+        if (pIn == pSrcEnd)
+        {
+            // The last sequence contains literals only
+            return pOut == pDstEnd;
+        }
+
+        if (pSrcEnd - pIn < 2)
+            return false;
+        const size_t MatchOffset = size_t{pIn[0]} | (size_t{pIn[1]} << 8u);
+        pIn += 2;
+        if (MatchOffset == 0 || MatchOffset > static_cast<size_t>(pOut - pDstData))
+            return false;
+
+        size_t MatchLength = Token & 0x0Fu;
+        if (MatchLength == MaxTokenValue && !ReadLengthExtension(pIn, pSrcEnd, MatchLength))
+            return false;
+        MatchLength += MinMatchLength;
+        if (static_cast<size_t>(pDstEnd - pOut) < MatchLength)
+            return false;
+
+        const auto* pMatch = pOut - MatchOffset;
+        if (MatchOffset >= MatchLength)
+        {
+            memcpy(pOut, pMatch, MatchLength);
+        }
+        else
+        {
+            // Overlapping match repeats the last MatchOffset bytes
+            for (size_t i = 0; i < MatchLength; ++i)
+                pOut[i] = pMatch[i];
+        }
+        pOut += MatchLength;
+    }
+
+    // The stream must end with the literal-only sequence
+    return false;
+}
+
+} // namespace Diligent
@@ -0,0 +1,119 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <unordered_map>
+
+#include "DeviceObjectArchiveBase.hpp"
+#include "Serializer.hpp"
+
+namespace Diligent
+{
+
+/// Content-addressed table of the device object archive blobs.
+
+/// Every unique blob is stored in the table once and is referenced by its index.
+/// Blob data is grouped into sections: the common section and one section per device type,
+/// so that the data of one device can be stored in separate compressed pages.
+class ArchiveBlobTable
+{
+public:
+    static constexpr Uint32 InvalidIndex = DeviceObjectArchiveBase::InvalidBlobIndex;
+
+    static constexpr Uint32 CommonSection = 0;
+    static constexpr Uint32 SectionCount  = 1 + static_cast<Uint32>(DeviceObjectArchiveBase::DeviceType::Count);
+
+    static constexpr Uint32 GetDeviceSection(DeviceObjectArchiveBase::DeviceType Type)
+    {
+        return 1 + static_cast<Uint32>(Type);
+    }
+
+    ArchiveBlobTable() noexcept {}
+
+    // clang-format off
+    ArchiveBlobTable           (ArchiveBlobTable&&) = default;
+    ArchiveBlobTable& operator=(ArchiveBlobTable&&) = default;
+    ArchiveBlobTable           (const ArchiveBlobTable&) = delete;
+    ArchiveBlobTable& operator=(const ArchiveBlobTable&) = delete;
+    // clang-format on
+
+    /// Adds the blob that references external data. The data must be valid while the table is in use.
+
+    /// \param [in] Data    - Blob data.
+    /// \param [in] Section - Section the blob belongs to.
+    /// \return     The index of the blob, or InvalidIndex if the data is empty.
+    ///             If identical blob is already present in the table, its index is returned.
+    ///             A blob that is shared by different sections is moved to the common section.
+    Uint32 Add(const SerializedData& Data, Uint32 Section = CommonSection);
+
+    /// Adds the blob that takes ownership of the data.
+    Uint32 Add(SerializedData&& Data, Uint32 Section = CommonSection);
+
+    Uint32 GetCount() const { return static_cast<Uint32>(m_Blobs.size()); }
+
+    const SerializedData& Get(Uint32 Index) const
+    {
+        VERIFY_EXPR(Index < m_Blobs.size());
+        return m_Blobs[Index];
+    }
+
+    /// Returns the total size of all unique blobs.
+    size_t GetDataSize() const { return m_DataSize; }
+
+    /// Returns the size of the serialized table including the blob data.
+    size_t GetSerializedSize() const;
+
+    /// Appends BlobTableHeader, the blob offsets and sizes and the blob data to Dst.
+
+    /// \param [out] Dst          - Destination buffer.
+    /// \param [out] pSectionEnds - Optional pointer to the array that receives the end offsets of
+    ///                             every section relative to the start of the serialized table.
+    ///                             The common section also contains the table header and the blob entries.
+    void Serialize(std::vector<Uint8>& Dst, std::array<size_t, SectionCount>* pSectionEnds = nullptr) const;
+
+private:
+    Uint32 AddImpl(SerializedData&& Data, Uint32 Section);
+
+private:
+    using FileOffsetAndSize = DeviceObjectArchiveBase::FileOffsetAndSize;
+    using BlobTableHeader   = DeviceObjectArchiveBase::BlobTableHeader;
+
+    // Blobs that either own the data or reference external data
+    std::vector<SerializedData> m_Blobs;
+
+    // Section of every blob
+    std::vector<Uint32> m_Sections;
+
+    // Keys reference the data of m_Blobs
+    std::unordered_map<SerializedData, Uint32, SerializedData::Hasher> m_Indices;
+
+    size_t m_DataSize = 0;
+};
+
+} // namespace Diligent
@@ -26,7 +26,12 @@
 
 #pragma once
 
+#include <array>
+#include <vector>
+
+#include "ArchiverFactory.h"
 #include "DeviceObjectArchiveBase.hpp"
+#include "ArchiveBlobTable.hpp"
 
 namespace Diligent
 {
@@ -35,8 +40,9 @@ class ArchiveRepacker
 {
 public:
     using DeviceType = DeviceObjectArchiveBase::DeviceType;
+    using ChunkType  = DeviceObjectArchiveBase::ChunkType;
 
-    explicit ArchiveRepacker(IArchive* pArchive);
+    explicit ArchiveRepacker(IArchive* pSrcArchive);
 
     void RemoveDeviceData(DeviceType Dev) noexcept(false);
     void AppendDeviceData(const ArchiveRepacker& Src, DeviceType Dev) noexcept(false);
@@ -44,13 +50,53 @@ public:
     bool Validate() const;
     void Print() const;
 
+    struct BlobStatistics
+    {
+        ArchiveBlobStatistics Archive;
+
+        // The size of the data referenced by every device and the size of the data
+        // that is shared with other devices or with the common data.
+        std::array<Uint64, static_cast<size_t>(DeviceType::Count)> DeviceDataSize   = {};
+        std::array<Uint64, static_cast<size_t>(DeviceType::Count)> DeviceSharedSize = {};
+    };
+    BlobStatistics GetBlobStatistics() const;
+
+    struct PipelineData
+    {
+        // Pipeline description and the names of its signatures and render pass
+        const SerializedData* pCommonData = nullptr;
+
+        // Device-specific shaders referenced by the pipeline
+        std::array<std::vector<const SerializedData*>, static_cast<size_t>(DeviceType::Count)> Shaders;
+    };
+    // Finds the pipeline with the given name and content key and returns its common data and the shaders
+    // it references for every device in Devices. Returns false if there is no such pipeline or if the pipeline
+    // has no data for one of the devices.
+    bool GetPipelineData(ChunkType                      Type,
+                         const char*                    Name,
+                         Uint64                         ContentHash,
+                         const SerializedData&          ContentKey,
+                         const std::vector<DeviceType>& Devices,
+                         PipelineData&                  Data) const noexcept(false);
+
+    struct SignatureData
+    {
+        const SerializedData* pCommonData = nullptr;
+
+        // Null if the signature has no data for the device
+        std::array<const SerializedData*, static_cast<size_t>(DeviceType::Count)> DeviceData = {};
+    };
+    // Finds the resource signature with the given name. Returns false if there is no such signature.
+    bool GetSignatureData(const char* Name, SignatureData& Data) const noexcept(false);
+
 private:
     using ArchiveHeader     = DeviceObjectArchiveBase::ArchiveHeader;
-    using BlockOffsetType   = DeviceObjectArchiveBase::BlockOffsetType;
+    using HeaderFlags       = DeviceObjectArchiveBase::HeaderFlags;
     using ChunkHeader       = DeviceObjectArchiveBase::ChunkHeader;
-    using ChunkType         = DeviceObjectArchiveBase::ChunkType;
     using FileOffsetAndSize = DeviceObjectArchiveBase::FileOffsetAndSize;
     using BaseDataHeader    = DeviceObjectArchiveBase::BaseDataHeader;
+    using PRSDataHeader     = DeviceObjectArchiveBase::PRSDataHeader;
+    using PSODataHeader     = DeviceObjectArchiveBase::PSODataHeader;
     using RPDataHeader      = DeviceObjectArchiveBase::RPDataHeader;
     using ShadersDataHeader = DeviceObjectArchiveBase::ShadersDataHeader;
 
@@ -58,45 +104,58 @@ private:
 
     static constexpr auto HeaderMagicNumber = DeviceObjectArchiveBase::HeaderMagicNumber;
     static constexpr auto HeaderVersion     = DeviceObjectArchiveBase::HeaderVersion;
-    static constexpr auto InvalidOffset     = DeviceObjectArchiveBase::BaseDataHeader::InvalidOffset;
+    static constexpr auto InvalidOffset     = DeviceObjectArchiveBase::InvalidOffset;
+    static constexpr auto InvalidBlobIndex  = DeviceObjectArchiveBase::InvalidBlobIndex;
+    static constexpr auto DeviceDataCount   = static_cast<Uint32>(DeviceType::Count);
 
-    void ReadNamedResources(const ChunkHeader& Chunk, NameOffsetMap& NameAndOffset) noexcept(false);
+    static void ReadNamedResources(IArchive* pArchive, const ChunkHeader& Chunk, NameOffsetMap& NameAndOffset) noexcept(false);
 
-    struct ArchiveBlock
-    {
-        RefCntAutoPtr<IArchive> pArchive;
-        std::vector<Uint8>      Memory; // can be used for patching
-        Uint32                  Offset = InvalidOffset;
-        Uint32                  Size   = 0;
+    template <typename HeaderType>
+    bool ReadDataHeader(Uint32 Offset, HeaderType& Header) const;
+
+    template <typename HeaderType>
+    void WriteDataHeader(Uint32 Offset, const HeaderType& Header);
+
+    const SerializedData& GetBlob(Uint32 BlobIndex) const noexcept(false);
 
-        ArchiveBlock() noexcept {}
-        ArchiveBlock(const ArchiveBlock&) = default;
+    // Adds the copy of the source blob to this archive and returns its index
+    Uint32 CopyBlob(const ArchiveRepacker& Src, Uint32 SrcBlobIndex) noexcept(false);
 
-        ArchiveBlock(IArchive* _pArchive, Uint32 _Offset, Uint32 _Size) noexcept :
-            pArchive{_pArchive}, Offset{_Offset}, Size{_Size} {}
+    Uint32 GetShadersHeaderOffset() const;
 
-        ArchiveBlock& operator=(ArchiveBlock&& Rhs) = default;
-        ArchiveBlock& operator=(const ArchiveBlock& Rhs) = default;
+    bool HasDeviceData(DeviceType Dev) const;
 
-        bool IsValid() const { return pArchive != nullptr && Offset != InvalidOffset && Size != 0; }
+    static bool IsPipelineChunk(ChunkType Type);
 
-        bool LoadToMemory();
-        bool Read(Uint64 Offset, Uint64 Size, void* pData) const;
-        bool Write(Uint64 Offset, Uint64 Size, const void* pData);
+    const NameOffsetMap* GetPSOMap(ChunkType Type) const;
+
+    struct DataHeaderLocation
+    {
+        ChunkType Type   = ChunkType::Undefined;
+        Uint32    Offset = InvalidOffset;
     };
-    using DeviceSpecificBlocks = std::array<ArchiveBlock, static_cast<size_t>(BlockOffsetType::Count)>;
 
-    ArchiveBlock         m_CommonData;
-    DeviceSpecificBlocks m_DeviceSpecific;
+    // Archive header, chunks and data headers. All data headers are patched in place.
+    std::vector<Uint8> m_CommonData;
+
+    // All blobs of the archive. Blobs that are no longer referenced and duplicate blobs
+    // are removed when the archive is serialized.
+    std::vector<SerializedData> m_Blobs;
 
     std::vector<ChunkHeader> m_Chunks;
 
+    // Locations of all data headers sorted by offset
+    std::vector<DataHeaderLocation> m_DataHeaders;
+
     NameOffsetMap m_PRSMap;
     NameOffsetMap m_GraphicsPSOMap;
     NameOffsetMap m_ComputePSOMap;
     NameOffsetMap m_TilePSOMap;
     NameOffsetMap m_RayTracingPSOMap;
     NameOffsetMap m_RenderPassMap;
+
+    // Whether the source archive is compressed
+    bool m_Compressed = false;
 };
 
 } // namespace Diligent
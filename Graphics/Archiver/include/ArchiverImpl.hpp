@@ -28,9 +28,13 @@
 
 #include <unordered_map>
 #include <unordered_set>
+#include <map>
 #include <array>
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <atomic>
+#include <cstring>
 
 #include "Archiver.h"
 #include "ArchiverFactory.h"
@@ -40,6 +44,8 @@
 #include "FileStream.h"
 
 #include "DeviceObjectArchiveBase.hpp"
+#include "ArchiveBlobTable.hpp"
+#include "ArchiveRepacker.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "ObjectBase.hpp"
 
@@ -93,6 +99,12 @@ public:
     virtual Bool DILIGENT_CALL_TYPE AddPipelineResourceSignature(const PipelineResourceSignatureDesc& SignatureDesc,
                                                                  const ResourceSignatureArchiveInfo&  ArchiveInfo) override final;
 
+    /// Implementation of IArchiver::EnableCompression().
+    virtual void DILIGENT_CALL_TYPE EnableCompression(Bool Enable) override final { m_CompressionEnabled.store(Enable != False); }
+
+    /// Implementation of IArchiver::SetPreviousArchive().
+    virtual Bool DILIGENT_CALL_TYPE SetPreviousArchive(IArchive* pArchive) override final;
+
 public:
     using DeviceType   = DeviceObjectArchiveBase::DeviceType;
     using ChunkType    = DeviceObjectArchiveBase::ChunkType;
@@ -100,6 +112,7 @@ public:
 
 private:
     using ArchiveHeader            = DeviceObjectArchiveBase::ArchiveHeader;
+    using HeaderFlags              = DeviceObjectArchiveBase::HeaderFlags;
     using ChunkHeader              = DeviceObjectArchiveBase::ChunkHeader;
     using NamedResourceArrayHeader = DeviceObjectArchiveBase::NamedResourceArrayHeader;
     using FileOffsetAndSize        = DeviceObjectArchiveBase::FileOffsetAndSize;
@@ -111,14 +124,24 @@ private:
     using ShaderIndexArray         = DeviceObjectArchiveBase::ShaderIndexArray;
     using SerializedPSOAuxData     = DeviceObjectArchiveBase::SerializedPSOAuxData;
 
-    static constexpr auto InvalidOffset   = DeviceObjectArchiveBase::BaseDataHeader::InvalidOffset;
+    static constexpr auto InvalidOffset   = DeviceObjectArchiveBase::InvalidOffset;
     static constexpr auto DeviceDataCount = static_cast<size_t>(DeviceType::Count);
     static constexpr auto ChunkCount      = static_cast<size_t>(ChunkType::Count);
 
     using TPerDeviceData = std::array<SerializedData, DeviceDataCount>;
+    using TShaderIndices = std::vector<Uint32>; // shader indices in the device-specific shader list
 
+    struct NameLess
+    {
+        bool operator()(const HashMapStringKey& Lhs, const HashMapStringKey& Rhs) const
+        {
+            return strcmp(Lhs.GetStr(), Rhs.GetStr()) < 0;
+        }
+    };
+    // Objects are kept sorted by name, so that the archive contents do not depend
+    // on the order in which the objects were added.
     template <typename Type>
-    using TNamedObjectHashMap = std::unordered_map<HashMapStringKey, Type, HashMapStringKey::Hasher>;
+    using TNamedObjectMap = std::map<HashMapStringKey, Type, NameLess>;
 
     struct PRSData
     {
@@ -127,10 +150,14 @@ private:
         {}
         RefCntAutoPtr<SerializableResourceSignatureImpl> pPRS;
 
+        // Data of the default signature copied from the previous archive. Only used when pPRS is null.
+        SerializedData CommonData;
+        TPerDeviceData DeviceData;
+
         const SerializedData& GetCommonData() const;
         const SerializedData& GetDeviceData(DeviceType Type) const;
     };
-    TNamedObjectHashMap<PRSData> m_PRSMap;
+    TNamedObjectMap<PRSData> m_PRSMap;
 
     struct SerializablePRSHasher
     {
@@ -152,6 +179,11 @@ private:
     };
     // Cache to deduplicate resource signatures
     std::unordered_set<RefCntAutoPtr<SerializableResourceSignatureImpl>, SerializablePRSHasher, SerializablePRSEqual> m_PRSCache;
+    // Default signatures whose pipelines have not been added to the archive yet.
+    // Their names are reserved so that other signatures can't take them.
+    std::unordered_map<HashMapStringKey, RefCntAutoPtr<SerializableResourceSignatureImpl>, HashMapStringKey::Hasher> m_PendingDefaultPRSs;
+    // Protects m_PRSMap, m_PRSCache and m_PendingDefaultPRSs
+    std::mutex m_SignaturesMtx;
 
     struct RPData
     {
@@ -162,8 +194,8 @@ private:
 
         const SerializedData& GetCommonData() const;
     };
-    using RPMapType = std::unordered_map<HashMapStringKey, RPData, HashMapStringKey::Hasher>;
-    RPMapType m_RPMap;
+    TNamedObjectMap<RPData> m_RPMap;
+    std::mutex              m_RenderPassesMtx;
 
     struct ShaderKey
     {
@@ -179,10 +211,13 @@ private:
 
     struct PerDeviceShaders
     {
+        // Shaders in the order they were added. This order depends on the order in which
+        // pipelines were added and is not used in the archive, see ReorderShaders().
         std::vector<ShaderKey>                                                     List;
         std::unordered_map<ShaderKey, /*Index in List*/ size_t, ShaderKey::Hasher> Map;
     };
     std::array<PerDeviceShaders, static_cast<Uint32>(DeviceType::Count)> m_Shaders;
+    std::mutex                                                           m_ShadersMtx;
 
     template <typename CreateInfoType>
     struct TPSOData
@@ -190,7 +225,14 @@ private:
         CreateInfoType*      pCreateInfo = nullptr;
         SerializedPSOAuxData AuxData;
         SerializedData       CommonData;
-        TPerDeviceData       PerDeviceData;
+        TPerDeviceData       PerDeviceData; // Initialized from PerDeviceShaders by ReorderShaders()
+
+        // Indices of the pipeline shaders in m_Shaders[DeviceType].List
+        std::array<TShaderIndices, DeviceDataCount> PerDeviceShaders;
+
+        // Everything the pipeline data depends on and its hash, see PSODataHeader::ContentHash
+        SerializedData ContentKey;
+        Uint64         ContentHash = 0;
 
         RefCntAutoPtr<SerializableResourceSignatureImpl> pDefaultSignature;
 
@@ -201,24 +243,37 @@ private:
     using TilePSOData       = TPSOData<TilePipelineStateCreateInfo>;
     using RayTracingPSOData = TPSOData<RayTracingPipelineStateCreateInfo>;
 
-    TNamedObjectHashMap<GraphicsPSOData>   m_GraphicsPSOMap;
-    TNamedObjectHashMap<ComputePSOData>    m_ComputePSOMap;
-    TNamedObjectHashMap<TilePSOData>       m_TilePSOMap;
-    TNamedObjectHashMap<RayTracingPSOData> m_RayTracingPSOMap;
+    TNamedObjectMap<GraphicsPSOData>   m_GraphicsPSOMap;
+    TNamedObjectMap<ComputePSOData>    m_ComputePSOMap;
+    TNamedObjectMap<TilePSOData>       m_TilePSOMap;
+    TNamedObjectMap<RayTracingPSOData> m_RayTracingPSOMap;
+    // Protects all pipeline maps
+    std::mutex m_PipelinesMtx;
 
     RefCntAutoPtr<SerializationDeviceImpl> m_pSerializationDevice;
 
+    std::atomic<bool> m_CompressionEnabled{false};
+
+    // Archive produced by the previous build. Patched shaders of the pipelines
+    // whose content has not changed are copied from this archive.
+    // Protected by m_PipelinesMtx.
+    std::shared_ptr<const ArchiveRepacker> m_pPrevArchive;
+
     struct PendingData
     {
-        TDataElement                              HeaderData;                   // ArchiveHeader, ChunkHeader[]
-        std::array<TDataElement, ChunkCount>      ChunkData;                    // NamedResourceArrayHeader
-        std::array<Uint32*, ChunkCount>           DataOffsetArrayPerChunk = {}; // pointer to NamedResourceArrayHeader::DataOffset - offsets to ***DataHeader
-        std::array<Uint32, ChunkCount>            ResourceCountPerChunk   = {}; //
-        TDataElement                              CommonData;                   // ***DataHeader
-        std::array<TDataElement, DeviceDataCount> PerDeviceData;                // device specific data
-        size_t                                    OffsetInFile = 0;
+        TDataElement                         HeaderData;                   // ArchiveHeader, ChunkHeader[]
+        std::array<TDataElement, ChunkCount> ChunkData;                    // NamedResourceArrayHeader
+        std::array<Uint32*, ChunkCount>      DataOffsetArrayPerChunk = {}; // pointer to NamedResourceArrayHeader::DataOffset - offsets to ***DataHeader
+        std::array<Uint32, ChunkCount>       ResourceCountPerChunk   = {}; //
+        TDataElement                         CommonData;                   // ***DataHeader
+        ArchiveBlobTable                     Blobs;                        // common and device-specific data of all objects
+        size_t                               OffsetInFile = 0;
+        bool                                 Compress     = false;
+
+        std::array<std::vector<const SerializedData*>, DeviceDataCount> Shaders; // shaders in the archive order
     };
 
+    void ReorderShaders(PendingData& Pending);
     void ReserveSpace(PendingData& Pending) const;
     void WriteDebugInfo(PendingData& Pending) const;
     void WriteShaderData(PendingData& Pending) const;
@@ -226,14 +281,32 @@ private:
     void WriteDeviceObjectData(ChunkType Type, PendingData& Pending, MapType& Map, WritePerDeviceDataType WriteDeviceData) const;
 
     void UpdateOffsetsInArchive(PendingData& Pending) const;
-    void WritePendingDataToStream(const PendingData& Pending, IFileStream* pStream) const;
+    bool WritePendingDataToStream(const PendingData& Pending, IFileStream* pStream) const;
 
-    using TShaderIndices = std::vector<Uint32>; // shader data indices in device specific block
+    template <typename CreateInfoType>
+    bool SerializePSO(TNamedObjectMap<TPSOData<CreateInfoType>>& PSOMap,
+                      const CreateInfoType&                      PSOCreateInfo,
+                      const PipelineStateArchiveInfo&            ArchiveInfo) noexcept;
+
+    template <typename CreateInfoType>
+    bool PatchShaders(ARCHIVE_DEVICE_DATA_FLAGS Flag, const CreateInfoType& CreateInfo, TPSOData<CreateInfoType>& Data);
 
     template <typename CreateInfoType>
-    bool SerializePSO(TNamedObjectHashMap<TPSOData<CreateInfoType>>& PSOMap,
-                      const CreateInfoType&                          PSOCreateInfo,
-                      const PipelineStateArchiveInfo&                ArchiveInfo) noexcept;
+    static SerializedData ComputePipelineContentKey(const CreateInfoType&                         CreateInfo,
+                                                    const SerializedPSOAuxData&                   AuxData,
+                                                    const std::vector<ARCHIVE_DEVICE_DATA_FLAGS>& DeviceFlags);
+
+    // Copies the common data and the patched shaders of the pipeline with the same name and content key
+    // from the previous archive. The default signature of the pipeline is copied and added to the archive.
+    template <typename CreateInfoType>
+    bool ReusePipelineData(const ArchiveRepacker&                        PrevArchive,
+                           const CreateInfoType&                         CreateInfo,
+                           const std::vector<ARCHIVE_DEVICE_DATA_FLAGS>& DeviceFlags,
+                           TPSOData<CreateInfoType>&                     Data);
+
+    // Adds the default signature copied from the previous archive.
+    // Returns false if the name is already used by another signature.
+    bool AddArchivedSignature(const char* Name, const ArchiveRepacker::SignatureData& SrcData);
 
     void SerializeShaderBytecode(TShaderIndices&         ShaderIndices,
                                  DeviceType              DevType,
@@ -266,15 +339,18 @@ private:
 
     SerializedData SerializeShadersForPSO(const TShaderIndices& ShaderIndices) const;
 
+    void AddShaderKey(TShaderIndices& ShaderIndices, DeviceType DevType, ShaderKey Key);
+
     template <typename MapType>
     static Uint32* InitNamedResourceArrayHeader(ChunkType      Type,
                                                 const MapType& Map,
                                                 PendingData&   Pending);
 
     bool AddPipelineResourceSignature(IPipelineResourceSignature* pPRS);
-    bool CachePipelineResourceSignature(RefCntAutoPtr<SerializableResourceSignatureImpl>& pPRS);
     bool AddRenderPass(IRenderPass* pRP);
 
+    // The following methods require m_SignaturesMtx to be locked
+    bool   AddPipelineResourceSignatureUnsafe(SerializableResourceSignatureImpl* pPRS);
     String GetDefaultPRSName(const char* PSOName) const;
 
     template <typename PipelineStateImplType, typename SignatureImplType, typename ShaderStagesArrayType, typename... ExtraArgsType>
@@ -77,6 +77,9 @@ public:
 
     virtual Uint32 DILIGENT_CALL_TYPE GetStaticVariableCount(SHADER_TYPE ShaderType) const override final { return 0; }
 
+    virtual ShaderVariableHandle DILIGENT_CALL_TYPE GetVariableHandle(SHADER_TYPE ShaderType,
+                                                                      const Char* Name) const override final { return ShaderVariableHandle{}; }
+
     virtual void DILIGENT_CALL_TYPE InitializeStaticSRBResources(IShaderResourceBinding* pShaderResourceBinding) const override final {}
 
     virtual bool DILIGENT_CALL_TYPE IsCompatibleWith(const IPipelineResourceSignature* pPRS) const override final { return false; }
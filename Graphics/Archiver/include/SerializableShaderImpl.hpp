@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <mutex>
+
 #include "Shader.h"
 #include "ObjectBase.hpp"
 #include "RefCntAutoPtr.hpp"
@@ -63,6 +65,10 @@ public:
 
     virtual const ShaderDesc& DILIGENT_CALL_TYPE GetDesc() const override final { return m_CreateInfo.Desc; }
 
+    // Serializable shaders are never compiled asynchronously. A shader whose compilation is deferred
+    // is reported as ready; the status becomes failed if the deferred compilation fails.
+    virtual SHADER_STATUS DILIGENT_CALL_TYPE GetStatus(bool WaitForCompletion) override final;
+
     virtual Int32 DILIGENT_CALL_TYPE GetUniqueID() const override final { return 0; }
 
     virtual void DILIGENT_CALL_TYPE SetUserData(IObject* pUserData) override final {}
@@ -74,6 +80,11 @@ public:
         virtual ~CompiledShader() {}
     };
 
+    // Compiles the shader for all devices it was created for, unless it has already been compiled.
+    // Returns false if the compilation has failed. The method is thread-safe.
+    bool Compile();
+
+    // The shader must have been compiled, see Compile().
     template <typename CompiledShaderType>
     CompiledShaderType* GetShader(DeviceType Type) const
     {
@@ -94,15 +105,47 @@ public:
         return m_CreateInfo;
     }
 
+    // Returns the key that identifies the compilation input of the shader: the create info,
+    // the macros and the source code with all included files. The key is computed without compiling
+    // the shader. It is empty if an included file could not be resolved.
+    const SerializedData& GetContentKey() const { return m_ContentKey; }
+
 private:
     void CopyShaderCreateInfo(const ShaderCreateInfo& ShaderCI) noexcept(false);
 
+    void InitContentKey(IShaderSourceInputStreamFactory* pSourceFactory) noexcept(false);
+
+    // Compiles the shader for all devices and returns the compilation log, which is empty on success
+    String CompileShaders(const ShaderCreateInfo& ShaderCI);
+
     SerializationDeviceImpl*                      m_pDevice;
     ShaderCreateInfo                              m_CreateInfo;
     std::unique_ptr<void, STDDeleterRawMem<void>> m_pRawMemory;
 
+    const ARCHIVE_DEVICE_DATA_FLAGS m_DeviceFlags;
+
+    // Included files are loaded by the deferred compilation
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> m_pSourceFactory;
+
     std::array<std::unique_ptr<CompiledShader>, static_cast<size_t>(DeviceType::Count)> m_Shaders;
 
+    enum class CompileStatus : Uint8
+    {
+        NotCompiled,
+        Compiled,
+        Failed
+    };
+    // Protects m_CompileStatus and m_Shaders while the shader is compiled
+    std::mutex    m_CompileMtx;
+    CompileStatus m_CompileStatus = CompileStatus::NotCompiled;
+
+    SerializedData m_ContentKey;
+
+    void CompileShader(IReferenceCounters*       pRefCounters,
+                       const ShaderCreateInfo&   ShaderCI,
+                       ARCHIVE_DEVICE_DATA_FLAGS Flag,
+                       String&                   CompilationLog);
+
     template <typename ShaderType, typename... ArgTypes>
     void CreateShader(DeviceType Type, String& CompilationLog, const char* DeviceTypeName, IReferenceCounters* pRefCounters, ShaderCreateInfo& ShaderCI, const ArgTypes&... Args);
 
@@ -26,10 +26,16 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+
 #include "RenderDevice.h"
 #include "SerializationDevice.h"
 #include "ObjectBase.hpp"
 #include "DXCompiler.hpp"
+#include "ThreadPool.hpp"
 
 namespace Diligent
 {
@@ -227,6 +233,62 @@ public:
 
     SerializationDeviceImpl* GetDevice() { return this; }
 
+    IThreadPool* GetThreadPool() { return m_pThreadPool; }
+
+    /// Calls Handler(i) for every i in [0, NumTasks), distributing the calls between
+    /// the worker threads of the thread pool, if one is available.
+
+    /// The calling thread processes the tasks too and then blocks until the tasks
+    /// that are running on other threads are complete. Since the caller never waits for a task that has
+    /// not been started, the method may be called from the pool's worker thread.
+    template <typename HandlerType>
+    void ExecuteTasks(Uint32 NumTasks, HandlerType&& Handler)
+    {
+        if (NumTasks == 0)
+            return;
+
+        if (!m_pThreadPool || NumTasks == 1)
+        {
+            for (Uint32 i = 0; i < NumTasks; ++i)
+                Handler(i);
+            return;
+        }
+
+        struct TasksState
+        {
+            std::atomic<Uint32>     NextTask{0};
+            std::atomic<Uint32>     NumCompleted{0};
+            std::mutex              CompletedMtx;
+            std::condition_variable CompletedCV;
+        };
+        // The state must outlive the method as pool tasks may start after all work is done
+        auto pState = std::make_shared<TasksState>();
+
+        auto RunTasks = [pState, NumTasks, &Handler]() {
+            // Handler is only accessed while there are unfinished tasks, and the method does not return until then.
+            for (auto i = pState->NextTask.fetch_add(1); i < NumTasks; i = pState->NextTask.fetch_add(1))
+            {
+                Handler(i);
+                if (pState->NumCompleted.fetch_add(1) + 1 == NumTasks)
+                {
+                    // Notify under the lock so that the waiting thread can't miss the signal
+                    // between checking the counter and going to sleep.
+                    std::lock_guard<std::mutex> Lock{pState->CompletedMtx};
+                    pState->CompletedCV.notify_all();
+                }
+            }
+        };
+
+        for (Uint32 i = 1; i < NumTasks; ++i)
+            EnqueueAsyncWork(m_pThreadPool, [RunTasks](Uint32 ThreadId) { RunTasks(); });
+
+        RunTasks();
+
+        // All tasks have been started at this point. Wait for the ones that are still running on other threads.
+        std::unique_lock<std::mutex> Lock{pState->CompletedMtx};
+        pState->CompletedCV.wait(Lock, [&]() { return pState->NumCompleted.load() == NumTasks; });
+    }
+
 protected:
     static PipelineResourceBinding ResDescToPipelineResBinding(const PipelineResourceDesc& ResDesc, SHADER_TYPE Stages, Uint32 Register, Uint32 Space);
 
@@ -261,6 +323,8 @@ private:
     String m_MslPreprocessorCmd;
 
     std::vector<PipelineResourceBinding> m_ResourceBindings;
+
+    RefCntAutoPtr<IThreadPool> m_pThreadPool;
 };
 
 } // namespace Diligent
@@ -103,6 +103,11 @@ typedef struct ResourceSignatureArchiveInfo ResourceSignatureArchiveInfo;
 
 
 /// Defines the methods to manipulate an Archive object
+
+/// \remarks    All methods of the archiver are thread-safe. Pipeline states and resource signatures
+///             may be added from multiple threads simultaneously. Objects are written to the archive
+///             in the order of their names, so the archive contents do not depend on the order
+///             in which the objects were added.
 DILIGENT_BEGIN_INTERFACE(IArchiver, IObject)
 {
     /// Writes an archive to a memory blob
@@ -158,6 +163,37 @@ DILIGENT_BEGIN_INTERFACE(IArchiver, IObject)
     VIRTUAL Bool METHOD(AddPipelineResourceSignature)(THIS_
                                                       const PipelineResourceSignatureDesc REF SignatureDesc,
                                                       const ResourceSignatureArchiveInfo REF  ArchiveInfo) PURE;
+
+
+    /// Enables or disables the compression of the archive data.
+
+    /// \remarks   When compression is enabled, SerializeToBlob() and SerializeToStream() split all data
+    ///             except for the archive header into pages that are compressed independently.
+    ///             The data is decompressed on demand when the objects are unpacked from the archive,
+    ///             so only the pages that contain the requested objects are decompressed.
+    ///             Compression is disabled by default.
+    VIRTUAL void METHOD(EnableCompression)(THIS_
+                                           Bool Enable) PURE;
+
+
+    /// Sets the archive produced by the previous build of the same content.
+
+    /// \param [in] pArchive - Previous archive, or null to disable the reuse.
+    ///
+    /// \return     true if the archive was successfully loaded, and false otherwise.
+    ///
+    /// \remarks   When a pipeline state is added and the previous archive contains a pipeline with the same name
+    ///             that was built from the same create info, signatures, render pass and shader sources, macros
+    ///             and included files, the pipeline data and its patched shaders are copied verbatim from the previous
+    ///             archive. The shaders of such pipeline are not compiled. The default signature of a pipeline that
+    ///             uses implicit signatures is defined by its resource layout and is copied as well.
+    ///             The pipelines are matched by their full content keys that are stored in the archive, not only by hashes.
+    ///             Pipelines whose shaders include files with names defined by macros are always patched.
+    ///
+    ///             The previous archive must have been produced by the serialization device with the same settings.
+    ///             The archive data is copied, so the archive object may be released after the method returns.
+    VIRTUAL Bool METHOD(SetPreviousArchive)(THIS_
+                                            IArchive* pArchive) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -172,6 +208,8 @@ DILIGENT_END_INTERFACE
 #    define IArchiver_AddRayTracingPipelineState(This, ...)   CALL_IFACE_METHOD(Archiver, AddRayTracingPipelineState,   This, __VA_ARGS__)
 #    define IArchiver_AddTilePipelineState(This, ...)         CALL_IFACE_METHOD(Archiver, AddTilePipelineState,         This, __VA_ARGS__)
 #    define IArchiver_AddPipelineResourceSignature(This, ...) CALL_IFACE_METHOD(Archiver, AddPipelineResourceSignature, This, __VA_ARGS__)
+#    define IArchiver_EnableCompression(This, ...)            CALL_IFACE_METHOD(Archiver, EnableCompression,            This, __VA_ARGS__)
+#    define IArchiver_SetPreviousArchive(This, ...)           CALL_IFACE_METHOD(Archiver, SetPreviousArchive,           This, __VA_ARGS__)
 
 #endif
 
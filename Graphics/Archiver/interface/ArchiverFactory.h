@@ -39,6 +39,32 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static const INTERFACE_ID IID_ArchiverFactory =
     {0xf20b91eb, 0xbde3, 0x4615, {0x81, 0xcc, 0xf7, 0x20, 0xaa, 0x32, 0x41, 0xe}};
 
+/// Device object archive blob statistics, see IArchiverFactory::GetArchiveBlobStatistics.
+struct ArchiveBlobStatistics
+{
+    /// The number of blobs stored in the archive.
+    Uint32 NumBlobs DEFAULT_INITIALIZER(0);
+
+    /// The number of blobs referenced by the archive objects.
+    Uint32 NumReferencedBlobs DEFAULT_INITIALIZER(0);
+
+    /// The total number of references to the blobs.
+    /// Data that is identical for several objects or devices is stored once
+    /// and is referenced multiple times.
+    Uint32 NumReferences DEFAULT_INITIALIZER(0);
+
+    /// The total size of all blobs, in bytes.
+    Uint64 DataSize DEFAULT_INITIALIZER(0);
+
+    /// The size of the referenced blobs, in bytes.
+    Uint64 ReferencedDataSize DEFAULT_INITIALIZER(0);
+
+    /// The size the data would take if every reference had its own copy, in bytes.
+    /// The difference between ReferencesSize and ReferencedDataSize is the size saved by deduplication.
+    Uint64 ReferencesSize DEFAULT_INITIALIZER(0);
+};
+typedef struct ArchiveBlobStatistics ArchiveBlobStatistics;
+
 #define DILIGENT_INTERFACE_NAME IArchiverFactory
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -97,6 +123,15 @@ DILIGENT_BEGIN_INTERFACE(IArchiverFactory, IObject)
     VIRTUAL Bool METHOD(PrintArchiveContent)(THIS_
                                              IArchive* pArchive) CONST PURE;
 
+    /// Computes the blob statistics of the archive.
+
+    /// \param [in]  pArchive - Archive to inspect.
+    /// \param [out] Stats    - Blob statistics of the archive.
+    /// \return     true if the archive was parsed successfully, and false otherwise.
+    VIRTUAL Bool METHOD(GetArchiveBlobStatistics)(THIS_
+                                                  IArchive*                 pArchive,
+                                                  ArchiveBlobStatistics REF Stats) CONST PURE;
+
 };
 DILIGENT_END_INTERFACE
 
@@ -110,6 +145,7 @@ DILIGENT_END_INTERFACE
 #    define IArchiverFactory_RemoveDeviceData(This, ...)                        CALL_IFACE_METHOD(ArchiverFactory, RemoveDeviceData,                       This, __VA_ARGS__)
 #    define IArchiverFactory_AppendDeviceData(This, ...)                        CALL_IFACE_METHOD(ArchiverFactory, AppendDeviceData,                       This, __VA_ARGS__)
 #    define IArchiverFactory_PrintArchiveContent(This, ...)                     CALL_IFACE_METHOD(ArchiverFactory, PrintArchiveContent,                    This, __VA_ARGS__)
+#    define IArchiverFactory_GetArchiveBlobStatistics(This, ...)                CALL_IFACE_METHOD(ArchiverFactory, GetArchiveBlobStatistics,               This, __VA_ARGS__)
 
 #endif
 
@@ -166,6 +166,17 @@ struct SerializationDeviceCreateInfo
     SerializationDeviceVkInfo    Vulkan;
     SerializationDeviceMtlInfo   Metal;
 
+    /// An optional thread pool (an object that implements Diligent::IThreadPool interface)
+    /// that is used to compile shaders and patch pipeline shaders for different backends
+    /// in parallel.
+    ///
+    /// \remarks    The thread calling the serialization device or archiver methods
+    ///             also participates in processing its own tasks, so the pool may
+    ///             safely be shared with the application's own work, and the methods
+    ///             may be called from the pool's worker threads.
+    ///             The archive contents do not depend on whether the pool is used.
+    IObject* pThreadPool DEFAULT_INITIALIZER(nullptr);
+
 #if DILIGENT_CPP_INTERFACE
     SerializationDeviceCreateInfo() noexcept
     {
@@ -222,9 +233,18 @@ typedef struct PipelineResourceBinding PipelineResourceBinding;
 
 
 /// Defines the methods to manipulate a serialization device object
+
+/// \remarks    CreateShader(), CreateRenderPass() and CreatePipelineResourceSignature() methods
+///             are thread-safe and may be called from multiple threads simultaneously.
 DILIGENT_BEGIN_INTERFACE(ISerializationDevice, IRenderDevice)
 {
     /// Creates a serialized shader.
+
+    /// \remarks   The shader is compiled when it is first used by a pipeline state that is added to an archiver
+    ///             and can't be copied from the previous archive (see IArchiver::SetPreviousArchive()).
+    ///             Compilation errors are then reported when the pipeline state is added.
+    ///             The shader is compiled immediately if ShaderCI.ppCompilerOutput is not null, or if
+    ///             the files included by the shader can't be resolved.
     VIRTUAL void METHOD(CreateShader)(THIS_
                                       const ShaderCreateInfo REF ShaderCI,
                                       ARCHIVE_DEVICE_DATA_FLAGS  DeviceFlags,
@@ -238,6 +258,9 @@ DILIGENT_BEGIN_INTERFACE(ISerializationDevice, IRenderDevice)
                                                          IPipelineResourceSignature**            ppSignature) PURE;
 
     /// Populates an array of pipeline resource bindings.
+
+    /// \note   The returned array is owned by the device and is only valid until the next
+    ///         call of this method. The method is not thread-safe.
     VIRTUAL void METHOD(GetPipelineResourceBindings)(THIS_
                                                      const PipelineResourceBindingAttribs REF Attribs,
                                                      Uint32 REF                               NumBindings,
@@ -0,0 +1,117 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ArchiveBlobTable.hpp"
+
+#include <cstring>
+
+namespace Diligent
+{
+
+Uint32 ArchiveBlobTable::Add(const SerializedData& Data, Uint32 Section)
+{
+    if (!Data || Data.Size() == 0)
+        return InvalidIndex;
+
+    return AddImpl(SerializedData{Data.Ptr(), Data.Size()}, Section);
+}
+
+Uint32 ArchiveBlobTable::Add(SerializedData&& Data, Uint32 Section)
+{
+    if (!Data || Data.Size() == 0)
+        return InvalidIndex;
+
+    return AddImpl(std::move(Data), Section);
+}
+
+Uint32 ArchiveBlobTable::AddImpl(SerializedData&& Data, Uint32 Section)
+{
+    VERIFY_EXPR(Section < SectionCount);
+
+    SerializedData Key{Data.Ptr(), Data.Size()};
+
+    auto it = m_Indices.find(Key);
+    if (it != m_Indices.end())
+    {
+        // The blob is shared by different devices
+        if (m_Sections[it->second] != Section)
+            m_Sections[it->second] = CommonSection;
+        return it->second;
+    }
+
+    const auto Index = StaticCast<Uint32>(m_Blobs.size());
+    m_DataSize += Data.Size();
+    m_Blobs.emplace_back(std::move(Data));
+    m_Sections.emplace_back(Section);
+    m_Indices.emplace(std::move(Key), Index);
+
+    return Index;
+}
+
+size_t ArchiveBlobTable::GetSerializedSize() const
+{
+    return sizeof(BlobTableHeader) + sizeof(FileOffsetAndSize) * m_Blobs.size() + m_DataSize;
+}
+
+void ArchiveBlobTable::Serialize(std::vector<Uint8>& Dst, std::array<size_t, SectionCount>* pSectionEnds) const
+{
+    const size_t StartSize = Dst.size();
+    Dst.resize(StartSize + GetSerializedSize());
+
+    Uint8* const pTable   = Dst.data() + StartSize;
+    Uint8* const pEntries = pTable + sizeof(BlobTableHeader);
+    Uint8* const pData    = pEntries + sizeof(FileOffsetAndSize) * m_Blobs.size();
+
+    BlobTableHeader Header;
+    Header.Count = GetCount();
+    memcpy(pTable, &Header, sizeof(Header));
+
+    // Blob offsets are stored in the table, so the data may be written in any order.
+    // Write the blobs section by section, the common section first.
+    Uint32 Offset = 0;
+    for (Uint32 Section = 0; Section < SectionCount; ++Section)
+    {
+        for (size_t i = 0; i < m_Blobs.size(); ++i)
+        {
+            if (m_Sections[i] != Section)
+                continue;
+
+            const auto& Blob = m_Blobs[i];
+
+            const FileOffsetAndSize Entry{Offset, StaticCast<Uint32>(Blob.Size())};
+            memcpy(pEntries + sizeof(Entry) * i, &Entry, sizeof(Entry));
+            memcpy(pData + Offset, Blob.Ptr(), Blob.Size());
+
+            Offset += Entry.Size;
+        }
+
+        if (pSectionEnds != nullptr)
+            (*pSectionEnds)[Section] = static_cast<size_t>(pData - pTable) + Offset;
+    }
+    VERIFY_EXPR(Offset == m_DataSize);
+}
+
+} // namespace Diligent
@@ -26,20 +26,65 @@
 
 #include "ArchiveRepacker.hpp"
 
+#include <array>
 #include <bitset>
+#include <algorithm>
+#include <cstring>
+
+#include "CompressedArchiveImpl.hpp"
+#include "EngineMemory.h"
+#include "PSOSerializer.hpp"
+#include "DynamicLinearAllocator.hpp"
 
 namespace Diligent
 {
 
-ArchiveRepacker::ArchiveRepacker(IArchive* pArchive)
+namespace
+{
+
+const char* GetDeviceName(Uint32 dev)
+{
+    using DeviceType = ArchiveRepacker::DeviceType;
+    switch (static_cast<DeviceType>(dev))
+    {
+        // clang-format off
+        case DeviceType::OpenGL:      return "OpenGL";
+        case DeviceType::Direct3D11:  return "Direct3D11";
+        case DeviceType::Direct3D12:  return "Direct3D12";
+        case DeviceType::Vulkan:      return "Vulkan";
+        case DeviceType::Metal_iOS:   return "Metal for iOS";
+        case DeviceType::Metal_MacOS: return "Metal for MacOS";
+        // clang-format on
+        default: return "unknown";
+    }
+}
+
+// Shader list is the unaligned array of the shader blob indices
+Uint32 GetShaderIndex(const SerializedData& ShaderList, size_t Idx)
+{
+    VERIFY_EXPR(sizeof(Uint32) * (Idx + 1) <= ShaderList.Size());
+    Uint32 ShaderIndex = 0;
+    memcpy(&ShaderIndex, ShaderList.Ptr<const Uint8>() + sizeof(Uint32) * Idx, sizeof(ShaderIndex));
+    return ShaderIndex;
+}
+
+void SetShaderIndex(SerializedData& ShaderList, size_t Idx, Uint32 ShaderIndex)
+{
+    VERIFY_EXPR(sizeof(Uint32) * (Idx + 1) <= ShaderList.Size());
+    memcpy(ShaderList.Ptr<Uint8>() + sizeof(Uint32) * Idx, &ShaderIndex, sizeof(ShaderIndex));
+}
+
+} // namespace
+
+ArchiveRepacker::ArchiveRepacker(IArchive* pSrcArchive)
 {
-    if (pArchive == nullptr)
+    if (pSrcArchive == nullptr)
         LOG_ERROR_AND_THROW("pSource must not be null");
 
     // Read header
     ArchiveHeader Header{};
     {
-        if (!pArchive->Read(0, sizeof(Header), &Header))
+        if (!pSrcArchive->Read(0, sizeof(Header), &Header))
         {
             LOG_ERROR_AND_THROW("Failed to read archive header");
         }
@@ -53,47 +98,44 @@ ArchiveRepacker::ArchiveRepacker(IArchive* pArchive)
         }
     }
 
-    // Calculate device-specific block sizes
-    {
-        std::array<Uint32, static_cast<size_t>(BlockOffsetType::Count) + 1> SortedOffsets = {};
-
-        const Uint32 ArchiveSize = StaticCast<Uint32>(pArchive->GetSize());
+    // All data is loaded uncompressed. The archive is compressed again when it is serialized.
+    m_Compressed  = (Header.Flags & HeaderFlags::Compressed) != HeaderFlags::None;
+    auto pArchive = DeviceObjectArchiveBase::GetUncompressedArchive(pSrcArchive, Header);
 
-        for (size_t i = 0; i < Header.BlockBaseOffsets.size(); ++i)
+    // Read archive header, chunks and data headers
+    {
+        if (Header.BlobTableOffset == InvalidOffset || Header.BlobTableOffset < sizeof(Header) || Header.BlobTableOffset > pArchive->GetSize())
         {
-            const Uint32 Offset = Header.BlockBaseOffsets[i];
-            VERIFY_EXPR(Offset < ArchiveSize || Offset == InvalidOffset);
-            SortedOffsets[i] = Offset;
+            LOG_ERROR_AND_THROW("Blob table offset (", Header.BlobTableOffset, ") is invalid");
         }
 
-        SortedOffsets[Header.BlockBaseOffsets.size()] = ArchiveSize;
+        m_CommonData.resize(Header.BlobTableOffset);
+        if (!pArchive->Read(0, m_CommonData.size(), m_CommonData.data()))
+        {
+            LOG_ERROR_AND_THROW("Failed to read archive common data");
+        }
+    }
 
-        std::sort(SortedOffsets.begin(), SortedOffsets.end(), [](auto& lhs, auto& rhs) { return lhs < rhs; });
+    // Read blobs
+    {
+        const auto Blobs = DeviceObjectArchiveBase::ReadBlobTable(pArchive, Header.BlobTableOffset);
 
-        for (size_t j = 0; j < Header.BlockBaseOffsets.size(); ++j)
+        m_Blobs.reserve(Blobs.size());
+        for (const auto& Blob : Blobs)
         {
-            const auto BaseOffset = Header.BlockBaseOffsets[j];
-            Uint32     BlockSize  = 0;
-
-            for (size_t i = 0; i < SortedOffsets.size(); ++i)
+            if (Blob.Size == 0)
             {
-                if (SortedOffsets[i] == InvalidOffset)
-                    break;
-
-                if (SortedOffsets[i] == BaseOffset && i + 1 < SortedOffsets.size())
-                {
-                    VERIFY_EXPR(SortedOffsets[i + 1] != InvalidOffset && SortedOffsets[i + 1] <= ArchiveSize);
-                    BlockSize = SortedOffsets[i + 1] - BaseOffset;
-                    break;
-                }
+                m_Blobs.emplace_back();
+                continue;
             }
 
-            if (BlockSize != 0)
-                m_DeviceSpecific[j] = ArchiveBlock{pArchive, BaseOffset, BlockSize};
+            SerializedData Data{Blob.Size, GetRawAllocator()};
+            if (!pArchive->Read(Blob.Offset, Blob.Size, Data.Ptr()))
+            {
+                LOG_ERROR_AND_THROW("Failed to read blob data");
+            }
+            m_Blobs.emplace_back(std::move(Data));
         }
-
-        m_CommonData = ArchiveBlock{pArchive, 0, SortedOffsets.front()};
-        VERIFY_EXPR(m_CommonData.IsValid());
     }
 
     // Read chunks
@@ -117,12 +159,12 @@ ArchiveRepacker::ArchiveRepacker(IArchive* pArchive)
         {
             // clang-format off
             case ChunkType::ArchiveDebugInfo:         break;
-            case ChunkType::ResourceSignature:        ReadNamedResources(Chunk, m_PRSMap);           break;
-            case ChunkType::GraphicsPipelineStates:   ReadNamedResources(Chunk, m_GraphicsPSOMap);   break;
-            case ChunkType::ComputePipelineStates:    ReadNamedResources(Chunk, m_ComputePSOMap);    break;
-            case ChunkType::RayTracingPipelineStates: ReadNamedResources(Chunk, m_RayTracingPSOMap); break;
-            case ChunkType::TilePipelineStates:       ReadNamedResources(Chunk, m_TilePSOMap);       break;
-            case ChunkType::RenderPass:               ReadNamedResources(Chunk, m_RenderPassMap);    break;
+            case ChunkType::ResourceSignature:        ReadNamedResources(pArchive, Chunk, m_PRSMap);           break;
+            case ChunkType::GraphicsPipelineStates:   ReadNamedResources(pArchive, Chunk, m_GraphicsPSOMap);   break;
+            case ChunkType::ComputePipelineStates:    ReadNamedResources(pArchive, Chunk, m_ComputePSOMap);    break;
+            case ChunkType::RayTracingPipelineStates: ReadNamedResources(pArchive, Chunk, m_RayTracingPSOMap); break;
+            case ChunkType::TilePipelineStates:       ReadNamedResources(pArchive, Chunk, m_TilePSOMap);       break;
+            case ChunkType::RenderPass:               ReadNamedResources(pArchive, Chunk, m_RenderPassMap);    break;
             case ChunkType::Shaders:                  break;
             // clang-format on
             default:
@@ -130,354 +172,515 @@ ArchiveRepacker::ArchiveRepacker(IArchive* pArchive)
         }
     }
 
+    // Collect the locations of all data headers
+    {
+        const auto ShadersHeaderOffset = GetShadersHeaderOffset();
+        if (ShadersHeaderOffset != InvalidOffset)
+            m_DataHeaders.push_back({ChunkType::Shaders, ShadersHeaderOffset});
+
+        const auto AddDataHeaders = [this](const NameOffsetMap& ResMap, ChunkType Type) //
+        {
+            for (const auto& Res : ResMap)
+                m_DataHeaders.push_back({Type, Res.second.Offset});
+        };
+
+        static_assert(static_cast<Uint32>(ChunkType::Count) == 9, "Please handle the new chunk type below");
+        // clang-format off
+        AddDataHeaders(m_PRSMap,           ChunkType::ResourceSignature);
+        AddDataHeaders(m_GraphicsPSOMap,   ChunkType::GraphicsPipelineStates);
+        AddDataHeaders(m_ComputePSOMap,    ChunkType::ComputePipelineStates);
+        AddDataHeaders(m_RayTracingPSOMap, ChunkType::RayTracingPipelineStates);
+        AddDataHeaders(m_TilePSOMap,       ChunkType::TilePipelineStates);
+        AddDataHeaders(m_RenderPassMap,    ChunkType::RenderPass);
+        // clang-format on
+
+        std::sort(m_DataHeaders.begin(), m_DataHeaders.end(), [](const DataHeaderLocation& lhs, const DataHeaderLocation& rhs) { return lhs.Offset < rhs.Offset; });
+    }
+
     VERIFY_EXPR(Validate());
     //Print();
 }
 
-void ArchiveRepacker::RemoveDeviceData(DeviceType Dev) noexcept(false)
+template <typename HeaderType>
+bool ArchiveRepacker::ReadDataHeader(Uint32 Offset, HeaderType& Header) const
 {
-    m_DeviceSpecific[static_cast<size_t>(Dev)] = ArchiveBlock{};
-
-    ArchiveBlock NewCommonBlock = m_CommonData;
-    if (!NewCommonBlock.LoadToMemory())
-        LOG_ERROR_AND_THROW("Failed to load common block");
-
-    std::vector<Uint8> Temp;
-
-    const auto UpdateResources = [&](const NameOffsetMap& ResMap, ChunkType chunkType) //
-    {
-        for (auto& Res : ResMap)
-        {
-            Temp.resize(Res.second.Size);
-            if (!NewCommonBlock.Read(Res.second.Offset, Temp.size(), Temp.data()))
-                continue;
+    if (Offset > m_CommonData.size() || Offset + sizeof(Header) > m_CommonData.size())
+        return false;
 
-            BaseDataHeader Header{ChunkType::Undefined};
-            if (Temp.size() < sizeof(Header))
-                continue;
+    memcpy(&Header, &m_CommonData[Offset], sizeof(Header));
+    return true;
+}
 
-            memcpy(&Header, Temp.data(), sizeof(Header));
-            if (Header.Type != chunkType)
-                continue;
+template <typename HeaderType>
+void ArchiveRepacker::WriteDataHeader(Uint32 Offset, const HeaderType& Header)
+{
+    VERIFY_EXPR(Offset + sizeof(Header) <= m_CommonData.size());
+    memcpy(&m_CommonData[Offset], &Header, sizeof(Header));
+}
 
-            Header.DeviceSpecificDataSize[static_cast<size_t>(Dev)]   = 0;
-            Header.DeviceSpecificDataOffset[static_cast<size_t>(Dev)] = InvalidOffset;
+const SerializedData& ArchiveRepacker::GetBlob(Uint32 BlobIndex) const noexcept(false)
+{
+    if (BlobIndex >= m_Blobs.size())
+        LOG_ERROR_AND_THROW("Blob index (", BlobIndex, ") is out of range");
 
-            // Update header
-            NewCommonBlock.Write(Res.second.Offset, sizeof(Header), &Header);
-        }
-    };
+    return m_Blobs[BlobIndex];
+}
 
-    // Remove device specific data offset
-    static_assert(static_cast<Uint32>(ChunkType::Count) == 9, "Please handle the new chunk type below");
-    // clang-format off
-    UpdateResources(m_PRSMap,           ChunkType::ResourceSignature);
-    UpdateResources(m_GraphicsPSOMap,   ChunkType::GraphicsPipelineStates);
-    UpdateResources(m_ComputePSOMap,    ChunkType::ComputePipelineStates);
-    UpdateResources(m_TilePSOMap,       ChunkType::TilePipelineStates);
-    UpdateResources(m_RayTracingPSOMap, ChunkType::RayTracingPipelineStates);
-    // clang-format on
+Uint32 ArchiveRepacker::CopyBlob(const ArchiveRepacker& Src, Uint32 SrcBlobIndex) noexcept(false)
+{
+    if (SrcBlobIndex == InvalidBlobIndex)
+        return InvalidBlobIndex;
 
-    // Ignore render passes
+    const auto& SrcBlob = Src.GetBlob(SrcBlobIndex);
 
-    // Patch shader chunk
-    for (auto& Chunk : m_Chunks)
+    SerializedData Data;
+    if (SrcBlob.Size() != 0)
     {
-        if (Chunk.Type == ChunkType::Shaders)
-        {
-            ShadersDataHeader Header;
-            VERIFY_EXPR(sizeof(Header) == Chunk.Size);
-
-            if (NewCommonBlock.Read(Chunk.Offset, sizeof(Header), &Header))
-            {
-                VERIFY_EXPR(Header.Type == ChunkType::Shaders);
-
-                Header.DeviceSpecificDataSize[static_cast<size_t>(Dev)]   = 0;
-                Header.DeviceSpecificDataOffset[static_cast<size_t>(Dev)] = InvalidOffset;
-
-                // Update header
-                NewCommonBlock.Write(Chunk.Offset, sizeof(Header), &Header);
-            }
-            break;
-        }
+        Data = SerializedData{SrcBlob.Size(), GetRawAllocator()};
+        memcpy(Data.Ptr(), SrcBlob.Ptr(), SrcBlob.Size());
     }
+    m_Blobs.emplace_back(std::move(Data));
 
-    m_CommonData = std::move(NewCommonBlock);
-
-    VERIFY_EXPR(Validate());
+    // Duplicates are removed when the archive is serialized
+    return StaticCast<Uint32>(m_Blobs.size() - 1);
 }
 
-bool ArchiveRepacker::ArchiveBlock::LoadToMemory()
+Uint32 ArchiveRepacker::GetShadersHeaderOffset() const
 {
-    if (!IsValid())
-        return false;
-
-    if (Memory.size() == Size)
-        return true; // memory is already loaded and maybe patched
-
-    Memory.resize(Size);
-    if (!pArchive->Read(Offset, Memory.size(), Memory.data()))
+    for (const auto& Chunk : m_Chunks)
     {
-        Memory.clear();
-        return false;
+        if (Chunk.Type == ChunkType::Shaders)
+            return Chunk.Offset;
     }
-    return true;
+    return InvalidOffset;
 }
 
-bool ArchiveRepacker::ArchiveBlock::Read(Uint64 OffsetInBlock, Uint64 DataSize, void* pData) const
+bool ArchiveRepacker::HasDeviceData(DeviceType Dev) const
 {
-    if (!IsValid())
-        return false;
-
-    if (!Memory.empty())
+    for (const auto& Loc : m_DataHeaders)
     {
-        if (OffsetInBlock < Memory.size() && OffsetInBlock + DataSize <= Memory.size())
-        {
-            memcpy(pData, &Memory[StaticCast<size_t>(OffsetInBlock)], StaticCast<size_t>(DataSize));
+        if (Loc.Type == ChunkType::RenderPass)
+            continue;
+
+        BaseDataHeader Header{Loc.Type};
+        if (ReadDataHeader(Loc.Offset, Header) && Header.GetBlob(Dev) != InvalidBlobIndex)
             return true;
-        }
-        return false;
     }
-
-    auto* Archive = pArchive.RawPtr<IArchive>();
-    if (Archive && Archive->Read(Offset + OffsetInBlock, DataSize, pData))
-        return true;
-
     return false;
 }
 
-bool ArchiveRepacker::ArchiveBlock::Write(Uint64 OffsetInBlock, Uint64 DataSize, const void* pData)
+bool ArchiveRepacker::IsPipelineChunk(ChunkType Type)
 {
-    if (!IsValid())
-        return false;
+    static_assert(static_cast<Uint32>(ChunkType::Count) == 9, "Please handle the new chunk type below");
+    return (Type == ChunkType::GraphicsPipelineStates ||
+            Type == ChunkType::ComputePipelineStates ||
+            Type == ChunkType::RayTracingPipelineStates ||
+            Type == ChunkType::TilePipelineStates);
+}
 
-    if (!Memory.empty())
+const ArchiveRepacker::NameOffsetMap* ArchiveRepacker::GetPSOMap(ChunkType Type) const
+{
+    static_assert(static_cast<Uint32>(ChunkType::Count) == 9, "Please handle the new chunk type below");
+    switch (Type)
     {
-        if (OffsetInBlock < Memory.size() && OffsetInBlock + DataSize <= Memory.size())
-        {
-            memcpy(&Memory[static_cast<size_t>(OffsetInBlock)], pData, static_cast<size_t>(DataSize));
-            return true;
-        }
+        // clang-format off
+        case ChunkType::GraphicsPipelineStates:   return &m_GraphicsPSOMap;
+        case ChunkType::ComputePipelineStates:    return &m_ComputePSOMap;
+        case ChunkType::RayTracingPipelineStates: return &m_RayTracingPSOMap;
+        case ChunkType::TilePipelineStates:       return &m_TilePSOMap;
+        // clang-format on
+        default:
+            UNEXPECTED("Unexpected pipeline chunk type (", static_cast<Uint32>(Type), ")");
+            return nullptr;
     }
-
-    // can not write to archive
-    return false;
 }
 
-void ArchiveRepacker::AppendDeviceData(const ArchiveRepacker& Src, DeviceType Dev) noexcept(false)
+bool ArchiveRepacker::GetPipelineData(ChunkType                      Type,
+                                      const char*                    Name,
+                                      Uint64                         ContentHash,
+                                      const SerializedData&          ContentKey,
+                                      const std::vector<DeviceType>& Devices,
+                                      PipelineData&                  Data) const noexcept(false)
 {
-    if (!Src.m_CommonData.IsValid())
-        LOG_ERROR_AND_THROW("Common data block is not present");
+    Data = {};
+    if (ContentHash == 0 || !ContentKey || Name == nullptr)
+        return false;
 
-    if (!Src.m_DeviceSpecific[static_cast<size_t>(Dev)].IsValid())
-        LOG_ERROR_AND_THROW("Can not append device specific block - block is not present");
+    const auto* pPSOMap = GetPSOMap(Type);
+    if (pPSOMap == nullptr)
+        return false;
 
-    ArchiveBlock NewCommonBlock = m_CommonData;
-    if (!NewCommonBlock.LoadToMemory())
-        LOG_ERROR_AND_THROW("Failed to load common block in destination archive");
+    auto it = pPSOMap->find(Name);
+    if (it == pPSOMap->end())
+        return false;
 
-    const auto LoadResource = [](std::vector<Uint8>& Data, const NameOffsetMap::value_type& Res, const ArchiveBlock& Block) //
-    {
-        Data.clear();
+    PSODataHeader Header{Type};
+    if (it->second.Size != sizeof(Header) || !ReadDataHeader(it->second.Offset, Header))
+        LOG_ERROR_AND_THROW("Failed to read data header of pipeline '", Name, "'");
 
-        // ignore Block.Offset
-        if (Res.second.Offset > Block.Size || Res.second.Offset + Res.second.Size > Block.Size)
-            return false;
+    if (Header.Type != Type || Header.ContentHash != ContentHash)
+        return false;
 
-        Data.resize(Res.second.Size);
-        return Block.Read(Res.second.Offset, Data.size(), Data.data());
-    };
+    // Equal hashes do not guarantee that the keys are equal
+    if (Header.ContentKeyBlob == InvalidBlobIndex || GetBlob(Header.ContentKeyBlob) != ContentKey)
+        return false;
 
-    std::vector<Uint8> TempSrc, TempDst;
+    if (Header.CommonDataBlob == InvalidBlobIndex)
+        return false;
 
-    const auto CmpAndUpdateResources = [&](const NameOffsetMap& DstResMap, const NameOffsetMap& SrcResMap, ChunkType chunkType, const char* ResTypeName) //
-    {
-        if (DstResMap.size() != SrcResMap.size())
-            LOG_ERROR_AND_THROW("Number of ", ResTypeName, " resources in source and destination archive does not match");
+    const auto ShadersHeaderOffset = GetShadersHeaderOffset();
+    if (ShadersHeaderOffset == InvalidOffset)
+        return false;
 
-        for (auto& DstRes : DstResMap)
-        {
-            auto Iter = SrcResMap.find(DstRes.first);
-            if (Iter == SrcResMap.end())
-                LOG_ERROR_AND_THROW(ResTypeName, " '", DstRes.first.GetStr(), "' is not found");
+    ShadersDataHeader ShadersHeader;
+    if (!ReadDataHeader(ShadersHeaderOffset, ShadersHeader))
+        LOG_ERROR_AND_THROW("Failed to read ShadersDataHeader");
 
-            const auto& SrcRes = *Iter;
-            if (!LoadResource(TempDst, DstRes, NewCommonBlock) || !LoadResource(TempSrc, SrcRes, Src.m_CommonData))
-                LOG_ERROR_AND_THROW("Failed to load ", ResTypeName, " '", DstRes.first.GetStr(), "' common data");
+    for (auto Dev : Devices)
+    {
+        const auto ShaderDataIndex = Header.GetBlob(Dev);
+        const auto ListIndex       = ShadersHeader.GetBlob(Dev);
+        if (ShaderDataIndex == InvalidBlobIndex || ListIndex == InvalidBlobIndex)
+            return false;
 
-            if (TempSrc.size() != TempDst.size())
-                LOG_ERROR_AND_THROW(ResTypeName, " '", DstRes.first.GetStr(), "' common data size must match");
+        const auto& ShaderList = GetBlob(ListIndex);
+        const auto& ShaderData = GetBlob(ShaderDataIndex);
 
-            BaseDataHeader SrcHeader{ChunkType::Undefined};
-            BaseDataHeader DstHeader{ChunkType::Undefined};
-            if (TempSrc.size() < sizeof(SrcHeader) || TempDst.size() < sizeof(DstHeader))
-                LOG_ERROR_AND_THROW(ResTypeName, " '", DstRes.first.GetStr(), "' data size is too small to have header");
+        Serializer<SerializerMode::Read> Ser{ShaderData};
+        DynamicLinearAllocator           Allocator{GetRawAllocator()};
 
-            if (memcmp(&TempSrc[sizeof(SrcHeader)], &TempDst[sizeof(DstHeader)], TempDst.size() - sizeof(DstHeader)) != 0)
-                LOG_ERROR_AND_THROW(ResTypeName, " '", DstRes.first.GetStr(), "' common data must match");
+        DeviceObjectArchiveBase::ShaderIndexArray ShaderIndices;
+        PSOSerializer<SerializerMode::Read>::SerializeShaders(Ser, ShaderIndices, &Allocator);
+        if (!Ser.IsEnded())
+            LOG_ERROR_AND_THROW("Failed to read shader indices of pipeline '", Name, "'");
 
-            memcpy(&SrcHeader, TempSrc.data(), sizeof(SrcHeader));
-            memcpy(&DstHeader, TempDst.data(), sizeof(DstHeader));
+        auto& Shaders = Data.Shaders[static_cast<size_t>(Dev)];
+        Shaders.reserve(ShaderIndices.Count);
+        for (Uint32 i = 0; i < ShaderIndices.Count; ++i)
+        {
+            const auto Idx = ShaderIndices.pIndices[i];
+            if (sizeof(Uint32) * (size_t{Idx} + 1) > ShaderList.Size())
+                LOG_ERROR_AND_THROW("Shader index (", Idx, ") of pipeline '", Name, "' is out of range");
 
-            if (SrcHeader.Type != chunkType || DstHeader.Type != chunkType)
-                LOG_ERROR_AND_THROW(ResTypeName, " '", DstRes.first.GetStr(), "' header chunk type is invalid");
+            Shaders.push_back(&GetBlob(GetShaderIndex(ShaderList, Idx)));
+        }
+    }
 
-            const auto  SrcSize   = SrcHeader.DeviceSpecificDataSize[static_cast<Uint32>(Dev)];
-            const auto  SrcOffset = SrcHeader.DeviceSpecificDataOffset[static_cast<Uint32>(Dev)];
-            const auto& SrcBlock  = Src.m_DeviceSpecific[static_cast<Uint32>(Dev)];
+    Data.pCommonData = &GetBlob(Header.CommonDataBlob);
+    return true;
+}
 
-            // ignore Block.Offset
-            if (SrcOffset > SrcBlock.Size || SrcOffset + SrcSize > SrcBlock.Size)
-                LOG_ERROR_AND_THROW("Source device specific data for ", ResTypeName, " '", DstRes.first.GetStr(), "' is out of block range");
+bool ArchiveRepacker::GetSignatureData(const char* Name, SignatureData& Data) const noexcept(false)
+{
+    Data = {};
+    if (Name == nullptr)
+        return false;
 
-            DstHeader.DeviceSpecificDataSize[static_cast<Uint32>(Dev)]   = SrcSize;
-            DstHeader.DeviceSpecificDataOffset[static_cast<Uint32>(Dev)] = SrcOffset;
+    auto it = m_PRSMap.find(Name);
+    if (it == m_PRSMap.end())
+        return false;
 
-            // Update header
-            NewCommonBlock.Write(DstRes.second.Offset, sizeof(DstHeader), &DstHeader);
-        }
-    };
+    PRSDataHeader Header{ChunkType::ResourceSignature};
+    if (it->second.Size != sizeof(Header) || !ReadDataHeader(it->second.Offset, Header))
+        LOG_ERROR_AND_THROW("Failed to read data header of resource signature '", Name, "'");
 
-    static_assert(static_cast<Uint32>(ChunkType::Count) == 9, "Please handle the new chunk type below");
-    // clang-format off
-    CmpAndUpdateResources(m_PRSMap,           Src.m_PRSMap,           ChunkType::ResourceSignature,        "ResourceSignature");
-    CmpAndUpdateResources(m_GraphicsPSOMap,   Src.m_GraphicsPSOMap,   ChunkType::GraphicsPipelineStates,   "GraphicsPipelineState");
-    CmpAndUpdateResources(m_ComputePSOMap,    Src.m_ComputePSOMap,    ChunkType::ComputePipelineStates,    "ComputePipelineState");
-    CmpAndUpdateResources(m_TilePSOMap,       Src.m_TilePSOMap,       ChunkType::TilePipelineStates,       "TilePipelineState");
-    CmpAndUpdateResources(m_RayTracingPSOMap, Src.m_RayTracingPSOMap, ChunkType::RayTracingPipelineStates, "RayTracingPipelineState");
-    // clang-format on
+    if (Header.CommonDataBlob == InvalidBlobIndex)
+        return false;
 
-    // Compare render passes
+    Data.pCommonData = &GetBlob(Header.CommonDataBlob);
+    for (Uint32 Dev = 0; Dev < DeviceDataCount; ++Dev)
     {
-        if (m_RenderPassMap.size() != Src.m_RenderPassMap.size())
-            LOG_ERROR_AND_THROW("Number of RenderPass resources in source and destination archive does not match");
+        const auto BlobIndex = Header.GetBlob(static_cast<DeviceType>(Dev));
+        if (BlobIndex != InvalidBlobIndex)
+            Data.DeviceData[Dev] = &GetBlob(BlobIndex);
+    }
+    return true;
+}
 
-        for (auto& DstRes : m_RenderPassMap)
-        {
-            auto Iter = Src.m_RenderPassMap.find(DstRes.first);
-            if (Iter == Src.m_RenderPassMap.end())
-                LOG_ERROR_AND_THROW("RenderPass '", DstRes.first.GetStr(), "' is not found");
+void ArchiveRepacker::RemoveDeviceData(DeviceType Dev) noexcept(false)
+{
+    // Render passes have no device-specific data.
+    // Blobs that are no longer referenced are removed when the archive is serialized.
+    for (const auto& Loc : m_DataHeaders)
+    {
+        if (Loc.Type == ChunkType::RenderPass)
+            continue;
 
-            const auto& SrcRes = *Iter;
-            if (!LoadResource(TempDst, DstRes, NewCommonBlock) || !LoadResource(TempSrc, SrcRes, Src.m_CommonData))
-                LOG_ERROR_AND_THROW("Failed to load RenderPass '", DstRes.first.GetStr(), "' common data");
+        BaseDataHeader Header{Loc.Type};
+        if (!ReadDataHeader(Loc.Offset, Header))
+            LOG_ERROR_AND_THROW("Failed to read data header");
 
-            if (TempSrc != TempDst)
-                LOG_ERROR_AND_THROW("RenderPass '", DstRes.first.GetStr(), "' common data must match");
-        }
+        Header.SetBlob(Dev, InvalidBlobIndex);
+        WriteDataHeader(Loc.Offset, Header);
     }
 
-    // Update shader device specific offsets
+    VERIFY_EXPR(Validate());
+}
+
+void ArchiveRepacker::AppendDeviceData(const ArchiveRepacker& Src, DeviceType Dev) noexcept(false)
+{
+    if (!Src.HasDeviceData(Dev))
+        LOG_ERROR_AND_THROW("Can not append device specific data - source archive does not contain ", GetDeviceName(static_cast<Uint32>(Dev)), " data");
+
+    // Restore the original state if the archives are not compatible
+    auto       CommonData = m_CommonData;
+    const auto NumBlobs   = m_Blobs.size();
+    try
     {
-        const auto ReadShaderHeader = [](ShadersDataHeader& Header, Uint32& HeaderOffset, const std::vector<ChunkHeader>& Chunks, const ArchiveBlock& Block) //
+        const auto CmpAndUpdateResources = [&](const NameOffsetMap& DstResMap, const NameOffsetMap& SrcResMap, ChunkType chunkType, const char* ResTypeName) //
         {
-            HeaderOffset = 0;
-            for (auto& Chunk : Chunks)
+            if (DstResMap.size() != SrcResMap.size())
+                LOG_ERROR_AND_THROW("Number of ", ResTypeName, " resources in source and destination archive does not match");
+
+            for (auto& DstRes : DstResMap)
             {
-                if (Chunk.Type == ChunkType::Shaders)
-                {
-                    if (sizeof(Header) != Chunk.Size)
-                        LOG_ERROR_AND_THROW("Invalid chunk size for ShadersDataHeader");
+                auto Iter = SrcResMap.find(DstRes.first);
+                if (Iter == SrcResMap.end())
+                    LOG_ERROR_AND_THROW(ResTypeName, " '", DstRes.first.GetStr(), "' is not found");
 
-                    if (!Block.Read(Chunk.Offset, sizeof(Header), &Header))
-                        LOG_ERROR_AND_THROW("Failed to read ShadersDataHeader");
+                const auto& SrcRes = *Iter;
 
-                    if (Header.Type != ChunkType::Shaders)
-                        LOG_ERROR_AND_THROW("Invalid chunk type for ShadersDataHeader");
+                BaseDataHeader SrcHeader{ChunkType::Undefined};
+                BaseDataHeader DstHeader{ChunkType::Undefined};
+                if (!ReadDataHeader(DstRes.second.Offset, DstHeader) || !Src.ReadDataHeader(SrcRes.second.Offset, SrcHeader))
+                    LOG_ERROR_AND_THROW("Failed to load ", ResTypeName, " '", DstRes.first.GetStr(), "' header");
 
-                    HeaderOffset = Chunk.Offset;
-                    return true;
+                if (SrcHeader.Type != chunkType || DstHeader.Type != chunkType)
+                    LOG_ERROR_AND_THROW(ResTypeName, " '", DstRes.first.GetStr(), "' header chunk type is invalid");
+
+                if (GetBlob(DstHeader.CommonDataBlob) != Src.GetBlob(SrcHeader.CommonDataBlob))
+                    LOG_ERROR_AND_THROW(ResTypeName, " '", DstRes.first.GetStr(), "' common data must match");
+
+                DstHeader.SetBlob(Dev, CopyBlob(Src, SrcHeader.GetBlob(Dev)));
+
+                // Update header
+                WriteDataHeader(DstRes.second.Offset, DstHeader);
+
+                if (IsPipelineChunk(chunkType))
+                {
+                    // The content key does not describe the appended device data
+                    PSODataHeader PSOHeader{chunkType};
+                    if (!ReadDataHeader(DstRes.second.Offset, PSOHeader))
+                        LOG_ERROR_AND_THROW("Failed to load ", ResTypeName, " '", DstRes.first.GetStr(), "' header");
+                    PSOHeader.ContentHash    = 0;
+                    PSOHeader.ContentKeyBlob = InvalidBlobIndex;
+                    WriteDataHeader(DstRes.second.Offset, PSOHeader);
                 }
             }
-            return false;
         };
 
-        ShadersDataHeader DstHeader;
-        Uint32            DstHeaderOffset = 0;
-        if (ReadShaderHeader(DstHeader, DstHeaderOffset, m_Chunks, m_CommonData))
+        static_assert(static_cast<Uint32>(ChunkType::Count) == 9, "Please handle the new chunk type below");
+        // clang-format off
+        CmpAndUpdateResources(m_PRSMap,           Src.m_PRSMap,           ChunkType::ResourceSignature,        "ResourceSignature");
+        CmpAndUpdateResources(m_GraphicsPSOMap,   Src.m_GraphicsPSOMap,   ChunkType::GraphicsPipelineStates,   "GraphicsPipelineState");
+        CmpAndUpdateResources(m_ComputePSOMap,    Src.m_ComputePSOMap,    ChunkType::ComputePipelineStates,    "ComputePipelineState");
+        CmpAndUpdateResources(m_TilePSOMap,       Src.m_TilePSOMap,       ChunkType::TilePipelineStates,       "TilePipelineState");
+        CmpAndUpdateResources(m_RayTracingPSOMap, Src.m_RayTracingPSOMap, ChunkType::RayTracingPipelineStates, "RayTracingPipelineState");
+        // clang-format on
+
+        // Compare render passes
         {
-            ShadersDataHeader SrcHeader;
-            Uint32            SrcHeaderOffset = 0;
-            if (!ReadShaderHeader(SrcHeader, SrcHeaderOffset, Src.m_Chunks, Src.m_CommonData))
+            if (m_RenderPassMap.size() != Src.m_RenderPassMap.size())
+                LOG_ERROR_AND_THROW("Number of RenderPass resources in source and destination archive does not match");
+
+            for (auto& DstRes : m_RenderPassMap)
+            {
+                auto Iter = Src.m_RenderPassMap.find(DstRes.first);
+                if (Iter == Src.m_RenderPassMap.end())
+                    LOG_ERROR_AND_THROW("RenderPass '", DstRes.first.GetStr(), "' is not found");
+
+                const auto& SrcRes = *Iter;
+
+                RPDataHeader SrcHeader{ChunkType::RenderPass};
+                RPDataHeader DstHeader{ChunkType::RenderPass};
+                if (!ReadDataHeader(DstRes.second.Offset, DstHeader) || !Src.ReadDataHeader(SrcRes.second.Offset, SrcHeader))
+                    LOG_ERROR_AND_THROW("Failed to load RenderPass '", DstRes.first.GetStr(), "' header");
+
+                if (GetBlob(DstHeader.CommonDataBlob) != Src.GetBlob(SrcHeader.CommonDataBlob))
+                    LOG_ERROR_AND_THROW("RenderPass '", DstRes.first.GetStr(), "' common data must match");
+            }
+        }
+
+        // Copy the shaders and update the shader list
+        const auto DstHeaderOffset = GetShadersHeaderOffset();
+        if (DstHeaderOffset != InvalidOffset)
+        {
+            const auto SrcHeaderOffset = Src.GetShadersHeaderOffset();
+            if (SrcHeaderOffset == InvalidOffset)
                 LOG_ERROR_AND_THROW("Failed to find shaders in source archive");
 
-            const auto  SrcSize   = SrcHeader.DeviceSpecificDataSize[static_cast<Uint32>(Dev)];
-            const auto  SrcOffset = SrcHeader.DeviceSpecificDataOffset[static_cast<Uint32>(Dev)];
-            const auto& SrcBlock  = Src.m_DeviceSpecific[static_cast<Uint32>(Dev)];
+            ShadersDataHeader SrcHeader;
+            ShadersDataHeader DstHeader;
+            if (!ReadDataHeader(DstHeaderOffset, DstHeader) || !Src.ReadDataHeader(SrcHeaderOffset, SrcHeader))
+                LOG_ERROR_AND_THROW("Failed to read ShadersDataHeader");
+
+            if (SrcHeader.Type != ChunkType::Shaders || DstHeader.Type != ChunkType::Shaders)
+                LOG_ERROR_AND_THROW("Invalid chunk type for ShadersDataHeader");
 
-            // ignore Block.Offset
-            if (SrcOffset > SrcBlock.Size || SrcOffset + SrcSize > SrcBlock.Size)
-                LOG_ERROR_AND_THROW("Source device specific data for Shaders is out of block range");
+            Uint32 DstListIndex = InvalidBlobIndex;
 
-            DstHeader.DeviceSpecificDataSize[static_cast<Uint32>(Dev)]   = SrcSize;
-            DstHeader.DeviceSpecificDataOffset[static_cast<Uint32>(Dev)] = SrcOffset;
+            const auto SrcListIndex = SrcHeader.GetBlob(Dev);
+            if (SrcListIndex != InvalidBlobIndex)
+            {
+                const auto& SrcList = Src.GetBlob(SrcListIndex);
+                if (SrcList.Size() % sizeof(Uint32) != 0)
+                    LOG_ERROR_AND_THROW("Invalid shader list size in source archive");
+
+                // Indices in the shader list must be remapped to the destination blobs
+                SerializedData DstList;
+                if (SrcList.Size() != 0)
+                {
+                    DstList = SerializedData{SrcList.Size(), GetRawAllocator()};
+                    for (size_t i = 0; i < SrcList.Size() / sizeof(Uint32); ++i)
+                        SetShaderIndex(DstList, i, CopyBlob(Src, GetShaderIndex(SrcList, i)));
+                }
+                m_Blobs.emplace_back(std::move(DstList));
+                DstListIndex = StaticCast<Uint32>(m_Blobs.size() - 1);
+            }
+
+            DstHeader.SetBlob(Dev, DstListIndex);
 
             // Update header
-            NewCommonBlock.Write(DstHeaderOffset, sizeof(DstHeader), &DstHeader);
+            WriteDataHeader(DstHeaderOffset, DstHeader);
         }
     }
-
-    m_CommonData = std::move(NewCommonBlock);
-
-    m_DeviceSpecific[static_cast<Uint32>(Dev)] = Src.m_DeviceSpecific[static_cast<Uint32>(Dev)];
+    catch (...)
+    {
+        m_CommonData = std::move(CommonData);
+        m_Blobs.erase(m_Blobs.begin() + NumBlobs, m_Blobs.end());
+        throw;
+    }
 
     VERIFY_EXPR(Validate());
 }
 
 void ArchiveRepacker::Serialize(IFileStream* pStream) noexcept(false)
 {
-    std::vector<Uint8> Temp;
+    // Only referenced blobs are written to the archive; identical blobs are stored once.
+    ArchiveBlobTable   Blobs;
+    std::vector<Uint8> CommonData = m_CommonData;
+
+    const auto AddBlob = [&](Uint32 BlobIndex, Uint32 Section) //
+    {
+        return BlobIndex != InvalidBlobIndex ? Blobs.Add(GetBlob(BlobIndex), Section) : InvalidBlobIndex;
+    };
 
-    const auto CopyToStream = [&pStream, &Temp](const ArchiveBlock& Block, Uint32 Offset) //
+    // Shaders go first so that the shader byte code is stored together
+    const auto ShadersHeaderOffset = GetShadersHeaderOffset();
+    if (ShadersHeaderOffset != InvalidOffset)
     {
-        Temp.resize(Block.Size - Offset);
+        ShadersDataHeader Header;
+        if (!ReadDataHeader(ShadersHeaderOffset, Header))
+            LOG_ERROR_AND_THROW("Failed to read ShadersDataHeader");
 
-        if (!Block.Read(Offset, Temp.size(), Temp.data()))
-            LOG_ERROR_AND_THROW("Failed to read block from archive");
+        for (Uint32 dev = 0; dev < DeviceDataCount; ++dev)
+        {
+            const auto ListIndex = Header.GetBlob(static_cast<DeviceType>(dev));
+            if (ListIndex == InvalidBlobIndex)
+                continue;
 
-        if (!pStream->Write(Temp.data(), Temp.size()))
-            LOG_ERROR_AND_THROW("Failed to store block");
-    };
+            const auto&  SrcList  = GetBlob(ListIndex);
+            const size_t NumItems = SrcList.Size() / sizeof(Uint32);
+            const auto   Section  = ArchiveBlobTable::GetDeviceSection(static_cast<DeviceType>(dev));
 
-    ArchiveHeader Header;
-    Header.MagicNumber = HeaderMagicNumber;
-    Header.Version     = HeaderVersion;
-    Header.NumChunks   = StaticCast<Uint32>(m_Chunks.size());
+            SerializedData DstList;
+            if (NumItems != 0)
+            {
+                DstList = SerializedData{sizeof(Uint32) * NumItems, GetRawAllocator()};
+                for (size_t i = 0; i < NumItems; ++i)
+                    SetShaderIndex(DstList, i, AddBlob(GetShaderIndex(SrcList, i), Section));
+            }
+            Header.SetBlob(static_cast<DeviceType>(dev), Blobs.Add(std::move(DstList), Section));
+        }
+        memcpy(&CommonData[ShadersHeaderOffset], &Header, sizeof(Header));
+    }
 
-    size_t Offset = m_CommonData.Size;
-    for (size_t dev = 0; dev < m_DeviceSpecific.size(); ++dev)
+    for (const auto& Loc : m_DataHeaders)
     {
-        const auto& Block = m_DeviceSpecific[dev];
+        if (Loc.Type == ChunkType::Shaders)
+            continue;
+
+        if (Loc.Type == ChunkType::RenderPass)
+        {
+            RPDataHeader Header{ChunkType::RenderPass};
+            if (!ReadDataHeader(Loc.Offset, Header))
+                LOG_ERROR_AND_THROW("Failed to read render pass data header");
 
-        if (Block.IsValid())
+            Header.CommonDataBlob = AddBlob(Header.CommonDataBlob, ArchiveBlobTable::CommonSection);
+            memcpy(&CommonData[Loc.Offset], &Header, sizeof(Header));
+        }
+        else if (IsPipelineChunk(Loc.Type))
         {
-            Header.BlockBaseOffsets[dev] = StaticCast<Uint32>(Offset);
-            Offset += Block.Size;
+            PSODataHeader Header{Loc.Type};
+            if (!ReadDataHeader(Loc.Offset, Header))
+                LOG_ERROR_AND_THROW("Failed to read pipeline data header");
+
+            Header.CommonDataBlob = AddBlob(Header.CommonDataBlob, ArchiveBlobTable::CommonSection);
+            Header.ContentKeyBlob = AddBlob(Header.ContentKeyBlob, ArchiveBlobTable::CommonSection);
+            for (Uint32 dev = 0; dev < DeviceDataCount; ++dev)
+            {
+                const auto Type = static_cast<DeviceType>(dev);
+                Header.SetBlob(Type, AddBlob(Header.GetBlob(Type), ArchiveBlobTable::GetDeviceSection(Type)));
+            }
+            memcpy(&CommonData[Loc.Offset], &Header, sizeof(Header));
         }
         else
-            Header.BlockBaseOffsets[dev] = InvalidOffset;
-    }
+        {
+            BaseDataHeader Header{Loc.Type};
+            if (!ReadDataHeader(Loc.Offset, Header))
+                LOG_ERROR_AND_THROW("Failed to read data header");
 
-    pStream->Write(&Header, sizeof(Header));
-    CopyToStream(m_CommonData, sizeof(Header));
+            Header.CommonDataBlob = AddBlob(Header.CommonDataBlob, ArchiveBlobTable::CommonSection);
+            for (Uint32 dev = 0; dev < DeviceDataCount; ++dev)
+            {
+                const auto Type = static_cast<DeviceType>(dev);
+                Header.SetBlob(Type, AddBlob(Header.GetBlob(Type), ArchiveBlobTable::GetDeviceSection(Type)));
+            }
+            memcpy(&CommonData[Loc.Offset], &Header, sizeof(Header));
+        }
+    }
 
-    for (size_t dev = 0; dev < m_DeviceSpecific.size(); ++dev)
+    ArchiveHeader Header;
+    memcpy(&Header, CommonData.data(), sizeof(Header));
+    Header.MagicNumber     = HeaderMagicNumber;
+    Header.Version         = HeaderVersion;
+    Header.NumChunks       = StaticCast<Uint32>(m_Chunks.size());
+    Header.Flags           = m_Compressed ? HeaderFlags::Compressed : HeaderFlags::None;
+    Header.BlobTableOffset = StaticCast<Uint32>(CommonData.size());
+    memcpy(CommonData.data(), &Header, sizeof(Header));
+
+    std::vector<Uint8>                                 BlobData;
+    std::array<size_t, ArchiveBlobTable::SectionCount> SectionEnds{};
+    Blobs.Serialize(BlobData, &SectionEnds);
+
+    if (m_Compressed)
     {
-        const auto& Block = m_DeviceSpecific[dev];
-        if (Block.IsValid())
-        {
-            const size_t Pos = pStream->GetSize();
-            VERIFY_EXPR(Header.BlockBaseOffsets[dev] == Pos);
-            CopyToStream(Block, 0);
-        }
+        if (!pStream->Write(CommonData.data(), sizeof(Header)))
+            LOG_ERROR_AND_THROW("Failed to store archive header");
+
+        // Common data and the common section of the blob table form the first range.
+        // Every device-specific section starts a new range.
+        const auto CommonSectionEnd = SectionEnds[ArchiveBlobTable::CommonSection];
+        CommonData.insert(CommonData.end(), BlobData.begin(), BlobData.begin() + CommonSectionEnd);
+
+        std::vector<CompressedArchiveImpl::DataRange> Ranges;
+        Ranges.push_back({CommonData.data() + sizeof(Header), CommonData.size() - sizeof(Header)});
+        for (Uint32 Section = ArchiveBlobTable::CommonSection + 1; Section < ArchiveBlobTable::SectionCount; ++Section)
+            Ranges.push_back({BlobData.data() + SectionEnds[Section - 1], SectionEnds[Section] - SectionEnds[Section - 1]});
+
+        if (!CompressedArchiveImpl::Write(pStream, sizeof(Header), Ranges))
+            LOG_ERROR_AND_THROW("Failed to write compressed archive data");
+
+        return;
     }
 
-    VERIFY_EXPR(Offset == pStream->GetSize());
+    if (!pStream->Write(CommonData.data(), CommonData.size()) ||
+        !pStream->Write(BlobData.data(), BlobData.size()))
+        LOG_ERROR_AND_THROW("Failed to store archive data");
 }
 
-void ArchiveRepacker::ReadNamedResources(const ChunkHeader& Chunk, NameOffsetMap& NameAndOffset) noexcept(false)
+void ArchiveRepacker::ReadNamedResources(IArchive* pArchive, const ChunkHeader& Chunk, NameOffsetMap& NameAndOffset) noexcept(false)
 {
-    auto* pArchive = m_CommonData.pArchive.RawPtr<IArchive>();
     DeviceObjectArchiveBase::ReadNamedResources(pArchive, Chunk,
                                                 [&NameAndOffset](const char* Name, Uint32 Offset, Uint32 Size) //
                                                 {
@@ -485,99 +688,52 @@ void ArchiveRepacker::ReadNamedResources(const ChunkHeader& Chunk, NameOffsetMap
                                                 });
 }
 
-namespace
-{
-const char* GetDeviceName(Uint32 dev)
-{
-    using DeviceType = ArchiveRepacker::DeviceType;
-    switch (static_cast<DeviceType>(dev))
-    {
-        // clang-format off
-        case DeviceType::OpenGL:      return "OpenGL";
-        case DeviceType::Direct3D11:  return "Direct3D11";
-        case DeviceType::Direct3D12:  return "Direct3D12";
-        case DeviceType::Vulkan:      return "Vulkan";
-        case DeviceType::Metal_iOS:   return "Metal for iOS";
-        case DeviceType::Metal_MacOS: return "Metal for MacOS";
-        // clang-format on
-        default: return "unknown";
-    }
-}
-} // namespace
-
 bool ArchiveRepacker::Validate() const
 {
 #define VALIDATE_RES(...) \
     IsValid = false;      \
     LOG_INFO_MESSAGE(ResTypeName, " '", Res.first.GetStr(), "': ", __VA_ARGS__);
 
-    std::vector<Uint8> Temp;
-    bool               IsValid = true;
-
-    const auto ValidateResource = [&](const NameOffsetMap::value_type& Res, const char* ResTypeName) //
-    {
-        Temp.clear();
-
-        // ignore m_CommonData.Offset
-        if (Res.second.Offset > m_CommonData.Size || Res.second.Offset + Res.second.Size > m_CommonData.Size)
-        {
-            VALIDATE_RES("common data in range [", Res.second.Offset, "; ", Res.second.Offset + Res.second.Size,
-                         "] is out of common block size (", m_CommonData.Size, ")");
-            return false;
-        }
-
-        Temp.resize(Res.second.Size);
-        if (!m_CommonData.Read(Res.second.Offset, Temp.size(), Temp.data()))
-        {
-            VALIDATE_RES("failed to read data from archive");
-            return false;
-        }
-        return true;
-    };
+    bool IsValid = true;
 
-    const auto ValidateResources = [&](const NameOffsetMap& ResMap, ChunkType chunkType, const char* ResTypeName) //
+    const auto ValidateResources = [&](const NameOffsetMap& ResMap, ChunkType chunkType, const char* ResTypeName, size_t HeaderSize) //
     {
         for (auto& Res : ResMap)
         {
-            if (!ValidateResource(Res, ResTypeName))
-                continue;
-
             BaseDataHeader Header{ChunkType::Undefined};
-            if (Temp.size() < sizeof(Header))
+            if (Res.second.Size != HeaderSize || !ReadDataHeader(Res.second.Offset, Header))
             {
-                VALIDATE_RES("resource data is too small to store header - archive corrupted");
+                VALIDATE_RES("data header is out of common data range (", m_CommonData.size(), ") - archive corrupted");
                 continue;
             }
 
-            memcpy(&Header, Temp.data(), sizeof(Header));
             if (Header.Type != chunkType)
             {
                 VALIDATE_RES("invalid chunk type");
                 continue;
             }
 
-            for (Uint32 dev = 0; dev < Header.DeviceSpecificDataSize.size(); ++dev)
+            if (Header.CommonDataBlob >= m_Blobs.size())
             {
-                const auto  Size   = Header.DeviceSpecificDataSize[dev];
-                const auto  Offset = Header.DeviceSpecificDataOffset[dev];
-                const auto& Block  = m_DeviceSpecific[dev];
-
-                if (Size == 0 && Offset == InvalidOffset)
-                    continue;
+                VALIDATE_RES("common data blob index (", Header.CommonDataBlob, ") is invalid");
+            }
 
-                if (Block.IsValid())
+            for (Uint32 dev = 0; dev < DeviceDataCount; ++dev)
+            {
+                const auto BlobIndex = Header.GetBlob(static_cast<DeviceType>(dev));
+                if (BlobIndex != InvalidBlobIndex && BlobIndex >= m_Blobs.size())
                 {
-                    // ignore Block.Offset
-                    if (Offset > Block.Size || Offset + Size > Block.Size)
-                    {
-                        VALIDATE_RES(GetDeviceName(dev), " specific data is out of block size (", Block.Size, ")");
-                        continue;
-                    }
+                    VALIDATE_RES(GetDeviceName(dev), " specific data blob index (", BlobIndex, ") is out of range (", m_Blobs.size(), ")");
                 }
-                else
+            }
+
+            if (IsPipelineChunk(chunkType))
+            {
+                PSODataHeader PSOHeader{chunkType};
+                if (ReadDataHeader(Res.second.Offset, PSOHeader) &&
+                    PSOHeader.ContentKeyBlob != InvalidBlobIndex && PSOHeader.ContentKeyBlob >= m_Blobs.size())
                 {
-                    VALIDATE_RES(GetDeviceName(dev), " specific data block is not present, but resource requires that data");
-                    continue;
+                    VALIDATE_RES("content key blob index (", PSOHeader.ContentKeyBlob, ") is out of range (", m_Blobs.size(), ")");
                 }
             }
         }
@@ -585,11 +741,11 @@ bool ArchiveRepacker::Validate() const
 
     static_assert(static_cast<Uint32>(ChunkType::Count) == 9, "Please handle the new chunk type below");
     // clang-format off
-    ValidateResources(m_PRSMap,           ChunkType::ResourceSignature,        "ResourceSignature");
-    ValidateResources(m_GraphicsPSOMap,   ChunkType::GraphicsPipelineStates,   "GraphicsPipelineState");
-    ValidateResources(m_ComputePSOMap,    ChunkType::ComputePipelineStates,    "ComputePipelineState");
-    ValidateResources(m_RayTracingPSOMap, ChunkType::RayTracingPipelineStates, "RayTracingPipelineState");
-    ValidateResources(m_TilePSOMap,       ChunkType::TilePipelineStates,       "TilePipelineState");
+    ValidateResources(m_PRSMap,           ChunkType::ResourceSignature,        "ResourceSignature",       sizeof(BaseDataHeader));
+    ValidateResources(m_GraphicsPSOMap,   ChunkType::GraphicsPipelineStates,   "GraphicsPipelineState",   sizeof(PSODataHeader));
+    ValidateResources(m_ComputePSOMap,    ChunkType::ComputePipelineStates,    "ComputePipelineState",    sizeof(PSODataHeader));
+    ValidateResources(m_RayTracingPSOMap, ChunkType::RayTracingPipelineStates, "RayTracingPipelineState", sizeof(PSODataHeader));
+    ValidateResources(m_TilePSOMap,       ChunkType::TilePipelineStates,       "TilePipelineState",       sizeof(PSODataHeader));
     // clang-format on
 
     // Validate render passes
@@ -597,98 +753,195 @@ bool ArchiveRepacker::Validate() const
         const char* ResTypeName = "RenderPass";
         for (auto& Res : m_RenderPassMap)
         {
-            if (!ValidateResource(Res, ResTypeName))
-                continue;
-
             RPDataHeader Header{ChunkType::RenderPass};
-            if (Temp.size() < sizeof(Header))
+            if (Res.second.Size != sizeof(Header) || !ReadDataHeader(Res.second.Offset, Header))
             {
-                VALIDATE_RES("resource data is too small to store header - archive corrupted");
+                VALIDATE_RES("data header is out of common data range (", m_CommonData.size(), ") - archive corrupted");
                 continue;
             }
 
-            memcpy(&Header, Temp.data(), sizeof(Header));
             if (Header.Type != ChunkType::RenderPass)
             {
                 VALIDATE_RES("invalid chunk type");
                 continue;
             }
+
+            if (Header.CommonDataBlob >= m_Blobs.size())
+            {
+                VALIDATE_RES("common data blob index (", Header.CommonDataBlob, ") is invalid");
+            }
         }
     }
 
     // Validate shaders
-    for (auto& Chunk : m_Chunks)
+    const auto ShadersHeaderOffset = GetShadersHeaderOffset();
+    if (ShadersHeaderOffset != InvalidOffset)
     {
-        if (Chunk.Type == ChunkType::Shaders)
+        ShadersDataHeader Header;
+        if (!ReadDataHeader(ShadersHeaderOffset, Header) || Header.Type != ChunkType::Shaders)
         {
-            ShadersDataHeader Header;
-            VERIFY_EXPR(sizeof(Header) == Chunk.Size);
+            LOG_INFO_MESSAGE("Invalid shaders header");
+            return false;
+        }
 
-            if (m_CommonData.Read(Chunk.Offset, sizeof(Header), &Header))
+        for (Uint32 dev = 0; dev < DeviceDataCount; ++dev)
+        {
+            const auto ListIndex = Header.GetBlob(static_cast<DeviceType>(dev));
+            if (ListIndex == InvalidBlobIndex)
+                continue;
+
+            if (ListIndex >= m_Blobs.size())
+            {
+                LOG_INFO_MESSAGE(GetDeviceName(dev), " shader list blob index (", ListIndex, ") is out of range (", m_Blobs.size(), ")");
+                IsValid = false;
+                continue;
+            }
+
+            const auto& ShaderList = m_Blobs[ListIndex];
+            if (ShaderList.Size() % sizeof(Uint32) != 0)
+            {
+                LOG_INFO_MESSAGE(GetDeviceName(dev), " shader list size (", ShaderList.Size(), ") is not a multiple of ", sizeof(Uint32));
+                IsValid = false;
+                continue;
+            }
+
+            for (size_t i = 0; i < ShaderList.Size() / sizeof(Uint32); ++i)
             {
-                if (Header.Type != ChunkType::Shaders)
+                const auto ShaderIndex = GetShaderIndex(ShaderList, i);
+                if (ShaderIndex >= m_Blobs.size())
                 {
-                    LOG_INFO_MESSAGE("Invalid shaders header");
+                    LOG_INFO_MESSAGE(GetDeviceName(dev), " shader blob index (", ShaderIndex, ") is out of range (", m_Blobs.size(), ")");
                     IsValid = false;
                     break;
                 }
+            }
+        }
+    }
 
-                for (Uint32 dev = 0; dev < Header.DeviceSpecificDataSize.size(); ++dev)
-                {
-                    const auto  Size   = Header.DeviceSpecificDataSize[dev];
-                    const auto  Offset = Header.DeviceSpecificDataOffset[dev];
-                    const auto& Block  = m_DeviceSpecific[dev];
+    return IsValid;
+}
 
-                    if (Size == 0 && Offset == InvalidOffset)
-                        continue;
+ArchiveRepacker::BlobStatistics ArchiveRepacker::GetBlobStatistics() const
+{
+    // The number of references to every blob and the users that reference it.
+    // The last bit of the user mask indicates the common data.
+    constexpr Uint32                             CommonDataUser = DeviceDataCount;
+    std::vector<Uint32>                          BlobRefCount(m_Blobs.size());
+    std::vector<std::bitset<CommonDataUser + 1>> BlobUsers(m_Blobs.size());
 
-                    if (Block.IsValid())
-                    {
-                        // ignore Block.Offset
-                        if (Offset > Block.Size || Offset + Size > Block.Size)
-                        {
-                            LOG_INFO_MESSAGE(GetDeviceName(dev), " specific data for shaders is out of block size (", Block.Size, ")");
-                            IsValid = false;
-                            continue;
-                        }
-                    }
-                    else
-                    {
-                        LOG_INFO_MESSAGE(GetDeviceName(dev), " specific data for shaders block is not present, but resource requires that data");
-                        IsValid = false;
-                        continue;
-                    }
-                }
+    const auto AddBlobRef = [&](Uint32 BlobIndex, Uint32 User) //
+    {
+        if (BlobIndex >= m_Blobs.size())
+            return;
+        ++BlobRefCount[BlobIndex];
+        BlobUsers[BlobIndex][User] = true;
+    };
+
+    for (const auto& Loc : m_DataHeaders)
+    {
+        if (Loc.Type == ChunkType::Shaders)
+        {
+            ShadersDataHeader Header;
+            if (!ReadDataHeader(Loc.Offset, Header))
+                continue;
+
+            for (Uint32 dev = 0; dev < DeviceDataCount; ++dev)
+            {
+                const auto ListIndex = Header.GetBlob(static_cast<DeviceType>(dev));
+                if (ListIndex >= m_Blobs.size())
+                    continue;
+                AddBlobRef(ListIndex, dev);
+
+                const auto&  ShaderList = m_Blobs[ListIndex];
+                const size_t NumShaders = ShaderList.Size() / sizeof(Uint32);
+                for (size_t i = 0; i < NumShaders; ++i)
+                    AddBlobRef(GetShaderIndex(ShaderList, i), dev);
             }
-            break;
+        }
+        else if (Loc.Type == ChunkType::RenderPass)
+        {
+            RPDataHeader Header{ChunkType::RenderPass};
+            if (ReadDataHeader(Loc.Offset, Header))
+                AddBlobRef(Header.CommonDataBlob, CommonDataUser);
+        }
+        else if (IsPipelineChunk(Loc.Type))
+        {
+            PSODataHeader Header{Loc.Type};
+            if (!ReadDataHeader(Loc.Offset, Header))
+                continue;
+
+            AddBlobRef(Header.CommonDataBlob, CommonDataUser);
+            AddBlobRef(Header.ContentKeyBlob, CommonDataUser);
+            for (Uint32 dev = 0; dev < DeviceDataCount; ++dev)
+                AddBlobRef(Header.GetBlob(static_cast<DeviceType>(dev)), dev);
+        }
+        else
+        {
+            BaseDataHeader Header{Loc.Type};
+            if (!ReadDataHeader(Loc.Offset, Header))
+                continue;
+
+            AddBlobRef(Header.CommonDataBlob, CommonDataUser);
+            for (Uint32 dev = 0; dev < DeviceDataCount; ++dev)
+                AddBlobRef(Header.GetBlob(static_cast<DeviceType>(dev)), dev);
         }
     }
 
-    return IsValid;
+    BlobStatistics Stats;
+    auto&          Blobs = Stats.Archive;
+
+    Blobs.NumBlobs = StaticCast<Uint32>(m_Blobs.size());
+    for (size_t i = 0; i < m_Blobs.size(); ++i)
+    {
+        const auto Size = m_Blobs[i].Size();
+        Blobs.DataSize += Size;
+        if (BlobRefCount[i] == 0)
+            continue;
+
+        ++Blobs.NumReferencedBlobs;
+        Blobs.ReferencedDataSize += Size;
+        Blobs.NumReferences += BlobRefCount[i];
+        Blobs.ReferencesSize += Size * BlobRefCount[i];
+
+        for (Uint32 dev = 0; dev < DeviceDataCount; ++dev)
+        {
+            if (!BlobUsers[i][dev])
+                continue;
+
+            Stats.DeviceDataSize[dev] += Size;
+            if (BlobUsers[i].count() > 1)
+                Stats.DeviceSharedSize[dev] += Size;
+        }
+    }
+
+    return Stats;
 }
 
 void ArchiveRepacker::Print() const
 {
-    std::vector<Uint8> Temp;
-    String             Output           = "Archive content:\n";
-    size_t             MaxDevNameLen    = 0;
-    const char         CommonDataName[] = "Common";
+    String     Output           = m_Compressed ? "Archive content (compressed):\n" : "Archive content:\n";
+    size_t     MaxDevNameLen    = 0;
+    const char CommonDataName[] = "Common";
 
-    for (Uint32 i = 0, Cnt = static_cast<Uint32>(DeviceType::Count); i < Cnt; ++i)
+    for (Uint32 i = 0; i < DeviceDataCount; ++i)
     {
         MaxDevNameLen = std::max(MaxDevNameLen, strlen(GetDeviceName(i)));
     }
 
-    const auto LoadResource = [&](const NameOffsetMap::value_type& Res) //
+    const auto AppendName = [MaxDevNameLen](String& Str, const char* Name) //
     {
-        Temp.clear();
-
-        // ignore m_CommonData.Offset
-        if (Res.second.Offset > m_CommonData.Size || Res.second.Offset + Res.second.Size > m_CommonData.Size)
-            return false;
+        Str += Name;
+        for (size_t i = strlen(Name); i < MaxDevNameLen; ++i)
+            Str += ' ';
+    };
 
-        Temp.resize(Res.second.Size);
-        return m_CommonData.Read(Res.second.Offset, Temp.size(), Temp.data());
+    const auto BlobToString = [this](Uint32 BlobIndex) //
+    {
+        if (BlobIndex == InvalidBlobIndex)
+            return String{"none"};
+        if (BlobIndex >= m_Blobs.size())
+            return String{"invalid"};
+        return "blob " + std::to_string(BlobIndex) + ", " + std::to_string(m_Blobs[BlobIndex].Size()) + " bytes";
     };
 
     const auto PrintResources = [&](const NameOffsetMap& ResMap, const char* ResTypeName) //
@@ -708,37 +961,24 @@ void ArchiveRepacker::Print() const
             Log += Res.first.GetStr();
 
             BaseDataHeader Header{ChunkType::Undefined};
-            if (LoadResource(Res) &&
-                Temp.size() >= sizeof(Header))
+            if (ReadDataHeader(Res.second.Offset, Header))
             {
-                memcpy(&Header, Temp.data(), sizeof(Header));
                 Log += '\n';
 
-                // Common data & header
+                // Common data
                 {
                     Log += "    ";
-                    Log += CommonDataName;
-                    for (size_t i = strlen(CommonDataName); i < MaxDevNameLen; ++i)
-                        Log += ' ';
-                    Log += " - [" + std::to_string(Res.second.Offset) + "; " + std::to_string(Res.second.Offset + Res.second.Size) + "]\n";
+                    AppendName(Log, CommonDataName);
+                    Log += " - " + BlobToString(Header.CommonDataBlob) + "\n";
                 }
 
-                for (Uint32 dev = 0; dev < Header.DeviceSpecificDataSize.size(); ++dev)
+                for (Uint32 dev = 0; dev < DeviceDataCount; ++dev)
                 {
-                    const auto  Size    = Header.DeviceSpecificDataSize[dev];
-                    const auto  Offset  = Header.DeviceSpecificDataOffset[dev];
-                    const auto& Block   = m_DeviceSpecific[dev];
-                    const char* DevName = GetDeviceName(dev);
+                    const auto BlobIndex = Header.GetBlob(static_cast<DeviceType>(dev));
 
                     Log += "    ";
-                    Log += DevName;
-                    for (size_t i = strlen(DevName); i < MaxDevNameLen; ++i)
-                        Log += ' ';
-
-                    if (Size == 0 || Offset == InvalidOffset || !Block.IsValid())
-                        Log += " - none\n";
-                    else
-                        Log += " - [" + std::to_string(Offset) + "; " + std::to_string(Offset + Size) + "]\n";
+                    AppendName(Log, GetDeviceName(dev));
+                    Log += " - " + BlobToString(BlobIndex) + "\n";
                 }
 
                 Output += Log;
@@ -790,9 +1030,10 @@ void ArchiveRepacker::Print() const
         {
             if (Chunk.Type == ChunkType::ArchiveDebugInfo)
             {
-                Temp.resize(Chunk.Size);
-                if (m_CommonData.Read(Chunk.Offset, Temp.size(), Temp.data()))
+                if (Chunk.Offset < m_CommonData.size() && Chunk.Offset + Chunk.Size <= m_CommonData.size())
                 {
+                    std::vector<Uint8> Temp{m_CommonData.begin() + Chunk.Offset, m_CommonData.begin() + Chunk.Offset + Chunk.Size};
+
                     Serializer<SerializerMode::Read> Ser{SerializedData{Temp.data(), Temp.size()}};
 
                     Uint32      APIVersion = 0;
@@ -808,32 +1049,6 @@ void ArchiveRepacker::Print() const
         }
     }
 
-    // Print archive blocks
-    {
-        Output += "------------------\nBlocks\n";
-        Output += "  ";
-        Output += CommonDataName;
-        for (size_t i = strlen(CommonDataName); i < MaxDevNameLen; ++i)
-            Output += ' ';
-        Output += " - " + std::to_string(m_CommonData.Size) + " bytes\n";
-
-        for (Uint32 dev = 0, Cnt = static_cast<Uint32>(DeviceType::Count); dev < Cnt; ++dev)
-        {
-            const auto& Block   = m_DeviceSpecific[dev];
-            const char* DevName = GetDeviceName(dev);
-
-            Output += "  ";
-            Output += DevName;
-            for (size_t i = strlen(DevName); i < MaxDevNameLen; ++i)
-                Output += ' ';
-
-            if (!Block.IsValid())
-                Output += " - none\n";
-            else
-                Output += " - " + std::to_string(Block.Size) + " bytes\n";
-        }
-    }
-
     // Print resources
     {
         static_assert(static_cast<Uint32>(ChunkType::Count) == 9, "Please handle the new chunk type below");
@@ -856,15 +1071,16 @@ void ArchiveRepacker::Print() const
                 Log += "  ";
                 Log += Res.first.GetStr();
 
-                if (LoadResource(Res))
+                RPDataHeader Header{ChunkType::RenderPass};
+                if (ReadDataHeader(Res.second.Offset, Header))
                 {
                     Log += '\n';
 
-                    // Common data & header
+                    // Common data
                     {
                         Log += "    ";
                         Log += CommonDataName;
-                        Log += " - [" + std::to_string(Res.second.Offset) + "; " + std::to_string(Res.second.Offset + Res.second.Size) + "]\n";
+                        Log += " - " + BlobToString(Header.CommonDataBlob) + "\n";
                     }
                 }
                 else
@@ -874,56 +1090,66 @@ void ArchiveRepacker::Print() const
         }
 
         // Print shaders
-        for (auto& Chunk : m_Chunks)
+        const auto ShadersHeaderOffset = GetShadersHeaderOffset();
+
+        ShadersDataHeader Header;
+        if (ShadersHeaderOffset != InvalidOffset && ReadDataHeader(ShadersHeaderOffset, Header))
         {
-            if (Chunk.Type == ChunkType::Shaders)
+            Output += "------------------\nShaders\n";
+            for (Uint32 dev = 0; dev < DeviceDataCount; ++dev)
             {
-                ShadersDataHeader Header;
-                VERIFY_EXPR(sizeof(Header) == Chunk.Size);
+                const auto ListIndex = Header.GetBlob(static_cast<DeviceType>(dev));
+
+                Output += "  ";
+                AppendName(Output, GetDeviceName(dev));
 
-                if (m_CommonData.Read(Chunk.Offset, sizeof(Header), &Header))
+                if (ListIndex >= m_Blobs.size())
                 {
-                    Output += "------------------\nShaders\n";
-                    for (Uint32 dev = 0; dev < Header.DeviceSpecificDataSize.size(); ++dev)
-                    {
-                        const auto  Size    = Header.DeviceSpecificDataSize[dev];
-                        const auto  Offset  = Header.DeviceSpecificDataOffset[dev];
-                        const auto& Block   = m_DeviceSpecific[dev];
-                        const char* DevName = GetDeviceName(dev);
-
-                        Output += "  ";
-                        Output += DevName;
-                        for (size_t i = strlen(DevName); i < MaxDevNameLen; ++i)
-                            Output += ' ';
-
-                        if (Size == 0 || Offset == InvalidOffset || !Block.IsValid())
-                            Output += " - none\n";
-                        else
-                        {
-                            Output += " - list range: [" + std::to_string(Offset) + "; " + std::to_string(Offset + Size) + "], count: " + std::to_string(Size / sizeof(FileOffsetAndSize));
-
-                            // Calculate data size
-                            std::vector<FileOffsetAndSize> OffsetAndSizeArray(Size / sizeof(FileOffsetAndSize));
-                            if (Block.Read(Offset, OffsetAndSizeArray.size() * sizeof(OffsetAndSizeArray[0]), OffsetAndSizeArray.data()))
-                            {
-                                Uint32 MinOffset = ~0u;
-                                Uint32 MaxOffset = 0;
-                                for (auto& OffsetAndSize : OffsetAndSizeArray)
-                                {
-                                    MinOffset = std::min(MinOffset, OffsetAndSize.Offset);
-                                    MaxOffset = std::max(MaxOffset, OffsetAndSize.Offset + OffsetAndSize.Size);
-                                }
-                                Output += ", data range: [" + std::to_string(MinOffset) + "; " + std::to_string(MaxOffset) + "]";
-                            }
-                            Output += "\n";
-                        }
-                    }
+                    Output += " - none\n";
+                    continue;
                 }
-                break;
+
+                const auto&  ShaderList = m_Blobs[ListIndex];
+                const size_t NumShaders = ShaderList.Size() / sizeof(Uint32);
+
+                // Calculate data size
+                size_t DataSize = 0;
+                for (size_t i = 0; i < NumShaders; ++i)
+                {
+                    const auto ShaderIndex = GetShaderIndex(ShaderList, i);
+                    if (ShaderIndex < m_Blobs.size())
+                        DataSize += m_Blobs[ShaderIndex].Size();
+                }
+
+                Output += " - list: blob " + std::to_string(ListIndex) + ", count: " + std::to_string(NumShaders) + ", data size: " + std::to_string(DataSize) + " bytes\n";
             }
         }
     }
 
+    // Print blob statistics
+    {
+        const auto  Stats = GetBlobStatistics();
+        const auto& Blobs = Stats.Archive;
+
+        const auto SavedSize = Blobs.ReferencesSize - Blobs.ReferencedDataSize;
+
+        Output += "------------------\nBlobs\n";
+        Output += "  total:      " + std::to_string(Blobs.NumBlobs) + " blobs, " + std::to_string(Blobs.DataSize) + " bytes\n";
+        Output += "  referenced: " + std::to_string(Blobs.NumReferencedBlobs) + " blobs, " + std::to_string(Blobs.ReferencedDataSize) + " bytes\n";
+        Output += "  references: " + std::to_string(Blobs.NumReferences) + ", " + std::to_string(Blobs.ReferencesSize) + " bytes\n";
+        Output += "  deduplication saved: " + std::to_string(SavedSize) + " bytes (" + std::to_string(Blobs.ReferencesSize > 0 ? SavedSize * 100 / Blobs.ReferencesSize : 0) + "%)\n";
+
+        for (Uint32 dev = 0; dev < DeviceDataCount; ++dev)
+        {
+            Output += "  ";
+            AppendName(Output, GetDeviceName(dev));
+            if (Stats.DeviceDataSize[dev] == 0)
+                Output += " - none\n";
+            else
+                Output += " - " + std::to_string(Stats.DeviceDataSize[dev]) + " bytes, " + std::to_string(Stats.DeviceSharedSize[dev]) + " bytes shared\n";
+        }
+    }
+
     LOG_INFO_MESSAGE(Output);
 }
 
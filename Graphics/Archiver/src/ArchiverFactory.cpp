@@ -112,6 +112,7 @@ public:
     virtual Bool DILIGENT_CALL_TYPE RemoveDeviceData(IArchive* pSrcArchive, ARCHIVE_DEVICE_DATA_FLAGS DeviceFlags, IFileStream* pStream) const override final;
     virtual Bool DILIGENT_CALL_TYPE AppendDeviceData(IArchive* pSrcArchive, ARCHIVE_DEVICE_DATA_FLAGS DeviceFlags, IArchive* pDeviceArchive, IFileStream* pStream) const override final;
     virtual Bool DILIGENT_CALL_TYPE PrintArchiveContent(IArchive* pArchive) const override final;
+    virtual Bool DILIGENT_CALL_TYPE GetArchiveBlobStatistics(IArchive* pArchive, ArchiveBlobStatistics& Stats) const override final;
 
 private:
     DummyReferenceCounters<ArchiverFactoryImpl> m_RefCounters;
@@ -251,6 +252,26 @@ Bool ArchiverFactoryImpl::PrintArchiveContent(IArchive* pArchive) const
     }
 }
 
+Bool ArchiverFactoryImpl::GetArchiveBlobStatistics(IArchive* pArchive, ArchiveBlobStatistics& Stats) const
+{
+    DEV_CHECK_ERR(pArchive != nullptr, "pArchive must not be null");
+    Stats = {};
+    if (pArchive == nullptr)
+        return false;
+
+    try
+    {
+        ArchiveRepacker Repacker{pArchive};
+
+        Stats = Repacker.GetBlobStatistics().Archive;
+        return true;
+    }
+    catch (...)
+    {
+        return false;
+    }
+}
+
 } // namespace
 
 
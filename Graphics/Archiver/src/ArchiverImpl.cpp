@@ -28,12 +28,15 @@
 #include "Archiver_Inc.hpp"
 
 #include <bitset>
+#include <algorithm>
 
 #include "ShaderToolsCommon.hpp"
 #include "PipelineStateBase.hpp"
 #include "PSOSerializer.hpp"
 #include "DataBlobImpl.hpp"
 #include "MemoryFileStream.hpp"
+#include "CompressedArchiveImpl.hpp"
+#include "DynamicLinearAllocator.hpp"
 
 namespace Diligent
 {
@@ -92,7 +95,7 @@ Uint32* ArchiverImpl::InitNamedResourceArrayHeader(ChunkType      Type,
         (void)pStr;
 
         NameLengthArray[i] = StaticCast<Uint32>(NameLen + 1);
-        DataSizeArray[i]   = StaticCast<Uint32>(NameAndData.second.GetCommonData().Size());
+        DataSizeArray[i]   = 0; // will be initialized later
         ++i;
     }
 
@@ -117,75 +120,75 @@ Bool ArchiverImpl::SerializeToBlob(IDataBlob** ppBlob)
     return true;
 }
 
-void ArchiverImpl::ReserveSpace(PendingData& Pending) const
+void ArchiverImpl::ReorderShaders(PendingData& Pending)
 {
-    auto& CommonData    = Pending.CommonData;
-    auto& PerDeviceData = Pending.PerDeviceData;
-
-    CommonData = TDataElement{GetRawAllocator()};
-    for (auto& DeviceData : PerDeviceData)
-        DeviceData = TDataElement{GetRawAllocator()};
+    // Shader indices in m_Shaders depend on the order in which pipelines were added,
+    // which is not deterministic when pipelines are added from multiple threads.
+    // Assign the archive indices in the order of the first reference by pipelines, which are sorted by name.
+    std::array<std::vector<Uint32>, DeviceDataCount> ArchiveIndices;
+    for (Uint32 dev = 0; dev < DeviceDataCount; ++dev)
+        ArchiveIndices[dev].resize(m_Shaders[dev].List.size(), ~0u);
 
-    // Reserve space for shaders
-    for (Uint32 type = 0; type < DeviceDataCount; ++type)
+    const auto ReorderPSOShaders = [&](auto& PSOMap) //
     {
-        const auto& Shaders = m_Shaders[type];
-        if (Shaders.List.empty())
-            continue;
-
-        auto& DeviceData = PerDeviceData[type];
-        DeviceData.AddSpace<FileOffsetAndSize>(Shaders.List.size());
-        for (const auto& Sh : Shaders.List)
+        for (auto& PSO : PSOMap)
         {
-            DeviceData.AddSpace(Sh.Data->Size());
-        }
-    }
+            for (Uint32 dev = 0; dev < DeviceDataCount; ++dev)
+            {
+                const auto& SrcIndices = PSO.second.PerDeviceShaders[dev];
+                if (SrcIndices.empty())
+                    continue;
 
-    // Reserve space for pipeline resource signatures
-    for (const auto& PRS : m_PRSMap)
-    {
-        CommonData.AddSpace<PRSDataHeader>();
-        CommonData.AddSpace(PRS.second.GetCommonData().Size());
+                auto& Shaders = Pending.Shaders[dev];
+                auto& Indices = ArchiveIndices[dev];
 
-        for (Uint32 type = 0; type < DeviceDataCount; ++type)
-        {
-            const auto& Src = PRS.second.GetDeviceData(static_cast<DeviceType>(type));
-            PerDeviceData[type].AddSpace(Src.Size());
+                TShaderIndices DstIndices(SrcIndices.size());
+                for (size_t i = 0; i < SrcIndices.size(); ++i)
+                {
+                    auto& ArchiveIdx = Indices[SrcIndices[i]];
+                    if (ArchiveIdx == ~0u)
+                    {
+                        ArchiveIdx = StaticCast<Uint32>(Shaders.size());
+                        Shaders.push_back(m_Shaders[dev].List[SrcIndices[i]].Data.get());
+                    }
+                    DstIndices[i] = ArchiveIdx;
+                }
+                PSO.second.PerDeviceData[dev] = SerializeShadersForPSO(DstIndices);
+            }
         }
-    }
+    };
+    ReorderPSOShaders(m_GraphicsPSOMap);
+    ReorderPSOShaders(m_ComputePSOMap);
+    ReorderPSOShaders(m_TilePSOMap);
+    ReorderPSOShaders(m_RayTracingPSOMap);
+}
 
-    // Reserve space for render passes
-    for (const auto& RP : m_RPMap)
-    {
-        CommonData.AddSpace<RPDataHeader>();
-        CommonData.AddSpace(RP.second.GetCommonData().Size());
-    }
+template <typename HeaderType, typename MapType>
+void ReserveDataHeaders(ArchiverImpl::TDataElement& Data, const MapType& ObjectMap)
+{
+    // Every header is constructed individually
+    for (size_t i = 0; i < ObjectMap.size(); ++i)
+        Data.AddSpace<HeaderType>();
+}
 
-    // Reserve space for pipelines
-    const auto ReserveSpaceForPSO = [&CommonData, &PerDeviceData](auto& PSOMap) //
-    {
-        for (const auto& PSO : PSOMap)
-        {
-            CommonData.AddSpace<PSODataHeader>();
-            CommonData.AddSpace(PSO.second.CommonData.Size());
+void ArchiverImpl::ReserveSpace(PendingData& Pending) const
+{
+    auto& CommonData = Pending.CommonData;
 
-            for (Uint32 type = 0; type < DeviceDataCount; ++type)
-            {
-                const auto& Src = PSO.second.PerDeviceData[type];
-                PerDeviceData[type].AddSpace(Src.Size());
-            }
-        }
-    };
-    ReserveSpaceForPSO(m_GraphicsPSOMap);
-    ReserveSpaceForPSO(m_ComputePSOMap);
-    ReserveSpaceForPSO(m_TilePSOMap);
-    ReserveSpaceForPSO(m_RayTracingPSOMap);
+    CommonData = TDataElement{GetRawAllocator()};
+
+    // Common and device-specific data are stored in the blob table,
+    // only the data headers are written to the common data block.
+    ReserveDataHeaders<PRSDataHeader>(CommonData, m_PRSMap);
+    ReserveDataHeaders<RPDataHeader>(CommonData, m_RPMap);
+    ReserveDataHeaders<PSODataHeader>(CommonData, m_GraphicsPSOMap);
+    ReserveDataHeaders<PSODataHeader>(CommonData, m_ComputePSOMap);
+    ReserveDataHeaders<PSODataHeader>(CommonData, m_TilePSOMap);
+    ReserveDataHeaders<PSODataHeader>(CommonData, m_RayTracingPSOMap);
 
     static_assert(ChunkCount == 9, "Reserve space for new chunk type");
 
-    Pending.CommonData.Reserve();
-    for (auto& DeviceData : Pending.PerDeviceData)
-        DeviceData.Reserve();
+    CommonData.Reserve();
 }
 
 void ArchiverImpl::WriteDebugInfo(PendingData& Pending) const
@@ -223,33 +226,42 @@ template <typename HeaderType>
 HeaderType* WriteHeader(ArchiverImpl::ChunkType     Type,
                         const SerializedData&       SrcData,
                         ArchiverImpl::TDataElement& DstChunk,
+                        ArchiveBlobTable&           Blobs,
                         Uint32&                     DstOffset,
                         Uint32&                     DstArraySize)
 {
     auto* pHeader = DstChunk.Construct<HeaderType>(Type);
     VERIFY_EXPR(pHeader->Type == Type);
-    DstOffset = StaticCast<Uint32>(reinterpret_cast<const Uint8*>(pHeader) - DstChunk.GetDataPtr<const Uint8>());
-    // DeviceSpecificDataSize & DeviceSpecificDataOffset will be initialized later
+    DstOffset    = StaticCast<Uint32>(reinterpret_cast<const Uint8*>(pHeader) - DstChunk.GetDataPtr<const Uint8>());
+    DstArraySize = sizeof(*pHeader);
+    // DeviceSpecificDataBlob will be initialized later
 
-    DstChunk.Copy(SrcData.Ptr(), SrcData.Size());
-    DstArraySize += sizeof(*pHeader);
+    pHeader->CommonDataBlob = Blobs.Add(SrcData);
 
     return pHeader;
 }
 
+SerializedData CopySerializedData(const SerializedData& Src)
+{
+    SerializedData Data;
+    if (Src.Size() != 0)
+    {
+        Data = SerializedData{Src.Size(), GetRawAllocator()};
+        memcpy(Data.Ptr(), Src.Ptr(), Src.Size());
+    }
+    return Data;
+}
+
 template <typename HeaderType>
-void WritePerDeviceData(HeaderType&                 Header,
-                        ArchiverImpl::DeviceType    Type,
-                        const SerializedData&       SrcData,
-                        ArchiverImpl::TDataElement& DstChunk)
+void WritePerDeviceData(HeaderType&              Header,
+                        ArchiverImpl::DeviceType Type,
+                        const SerializedData&    SrcData,
+                        ArchiveBlobTable&        Blobs)
 {
     if (!SrcData)
         return;
 
-    auto* const pDst   = DstChunk.Copy(SrcData.Ptr(), SrcData.Size());
-    const auto  Offset = reinterpret_cast<const Uint8*>(pDst) - DstChunk.GetDataPtr<const Uint8>();
-    Header.SetSize(Type, StaticCast<Uint32>(SrcData.Size()));
-    Header.SetOffset(Type, StaticCast<Uint32>(Offset));
+    Header.SetBlob(Type, Blobs.Add(SrcData, ArchiveBlobTable::GetDeviceSection(Type)));
 }
 
 template <typename DataHeaderType, typename MapType, typename WritePerDeviceDataType>
@@ -264,7 +276,7 @@ void ArchiverImpl::WriteDeviceObjectData(ChunkType Type, PendingData& Pending, M
     Uint32 j = 0;
     for (auto& Obj : ObjectMap)
     {
-        auto* pHeader = WriteHeader<DataHeaderType>(Type, Obj.second.GetCommonData(), Pending.CommonData,
+        auto* pHeader = WriteHeader<DataHeaderType>(Type, Obj.second.GetCommonData(), Pending.CommonData, Pending.Blobs,
                                                     DataOffsetArray[j], DataSizeArray[j]);
 
         for (Uint32 type = 0; type < DeviceDataCount; ++type)
@@ -280,52 +292,40 @@ void ArchiverImpl::WriteShaderData(PendingData& Pending) const
     {
         bool HasShaders = false;
         for (Uint32 type = 0; type < DeviceDataCount && !HasShaders; ++type)
-            HasShaders = !m_Shaders[type].List.empty();
+            HasShaders = !Pending.Shaders[type].empty();
         if (!HasShaders)
             return;
     }
 
-    const auto ChunkInd        = static_cast<Uint32>(ChunkType::Shaders);
-    auto&      Chunk           = Pending.ChunkData[ChunkInd];
-    Uint32*    DataOffsetArray = nullptr; // Pending.DataOffsetArrayPerChunk[ChunkInd];
-    Uint32*    DataSizeArray   = nullptr;
-    {
-        VERIFY_EXPR(Chunk.IsEmpty());
-        Chunk = TDataElement{GetRawAllocator()};
-        Chunk.AddSpace<ShadersDataHeader>();
-        Chunk.Reserve();
+    const auto ChunkInd = static_cast<Uint32>(ChunkType::Shaders);
+    auto&      Chunk    = Pending.ChunkData[ChunkInd];
 
-        auto& Header    = *Chunk.Construct<ShadersDataHeader>(ChunkType::Shaders);
-        DataSizeArray   = Header.DeviceSpecificDataSize.data();
-        DataOffsetArray = Header.DeviceSpecificDataOffset.data();
+    VERIFY_EXPR(Chunk.IsEmpty());
+    Chunk = TDataElement{GetRawAllocator()};
+    Chunk.AddSpace<ShadersDataHeader>();
+    Chunk.Reserve();
 
-        Pending.ResourceCountPerChunk[ChunkInd] = DeviceDataCount;
-    }
+    auto& Header = *Chunk.Construct<ShadersDataHeader>(ChunkType::Shaders);
+
+    Pending.ResourceCountPerChunk[ChunkInd] = DeviceDataCount;
 
     for (Uint32 dev = 0; dev < DeviceDataCount; ++dev)
     {
-        const auto& Shaders = m_Shaders[dev];
-        auto&       Dst     = Pending.PerDeviceData[dev];
-
-        if (Shaders.List.empty())
+        const auto& Shaders = Pending.Shaders[dev];
+        if (Shaders.empty())
             continue;
 
-        VERIFY(Dst.GetCurrentSize() == 0, "Shaders must be written first");
+        // Device-specific shader list contains the indices of the shader blobs.
+        // Shaders that are identical for different devices are stored once.
+        SerializedData ShaderList{sizeof(Uint32) * Shaders.size(), GetRawAllocator()};
 
-        // Write common data
-        auto* pOffsetAndSize = Dst.ConstructArray<FileOffsetAndSize>(Shaders.List.size());
-        DataOffsetArray[dev] = StaticCast<Uint32>(reinterpret_cast<const Uint8*>(pOffsetAndSize) - Dst.GetDataPtr<const Uint8>());
-        DataSizeArray[dev]   = StaticCast<Uint32>(sizeof(FileOffsetAndSize) * Shaders.List.size());
+        const auto Section = ArchiveBlobTable::GetDeviceSection(static_cast<DeviceType>(dev));
 
-        for (auto& Sh : Shaders.List)
-        {
-            const auto& Src  = *Sh.Data;
-            auto* const pDst = Dst.Copy(Src.Ptr(), Src.Size());
+        auto* pBlobIndices = ShaderList.Ptr<Uint32>();
+        for (const auto* pShaderData : Shaders)
+            *(pBlobIndices++) = Pending.Blobs.Add(*pShaderData, Section);
 
-            pOffsetAndSize->Offset = StaticCast<Uint32>(reinterpret_cast<const Uint8*>(pDst) - Dst.GetDataPtr<const Uint8>());
-            pOffsetAndSize->Size   = StaticCast<Uint32>(Src.Size());
-            ++pOffsetAndSize;
-        }
+        Header.SetBlob(static_cast<DeviceType>(dev), Pending.Blobs.Add(std::move(ShaderList), Section));
     }
 }
 
@@ -351,6 +351,7 @@ void ArchiverImpl::UpdateOffsetsInArchive(PendingData& Pending) const
     FileHeader.MagicNumber = DeviceObjectArchiveBase::HeaderMagicNumber;
     FileHeader.Version     = DeviceObjectArchiveBase::HeaderVersion;
     FileHeader.NumChunks   = NumChunks;
+    FileHeader.Flags       = Pending.Compress ? HeaderFlags::Compressed : HeaderFlags::None;
 
     // Update offsets to the NamedResourceArrayHeader
     OffsetInFile    = HeaderData.GetCurrentSize();
@@ -392,23 +393,52 @@ void ArchiverImpl::UpdateOffsetsInArchive(PendingData& Pending) const
             OffsetInFile += Pending.CommonData.GetCurrentSize();
     }
 
-    // Device specific data
-    for (Uint32 dev = 0; dev < DeviceDataCount; ++dev)
+    // Blob table
+    FileHeader.BlobTableOffset = StaticCast<Uint32>(OffsetInFile);
+    OffsetInFile += Pending.Blobs.GetSerializedSize();
+}
+
+bool ArchiverImpl::WritePendingDataToStream(const PendingData& Pending, IFileStream* pStream) const
+{
+    std::vector<Uint8>                                 BlobData;
+    std::array<size_t, ArchiveBlobTable::SectionCount> SectionEnds{};
+    Pending.Blobs.Serialize(BlobData, &SectionEnds);
+
+    if (Pending.Compress)
     {
-        if (Pending.PerDeviceData[dev].IsEmpty())
+        // The archive header is stored uncompressed. Chunks, common data and the common section of
+        // the blob table form the first compressed range. Every device-specific section starts a new range,
+        // so that the pages of one device do not contain the data of other devices.
+        const auto* const pHeaderData = Pending.HeaderData.GetDataPtr<const Uint8>();
+        pStream->Write(pHeaderData, sizeof(ArchiveHeader));
+
+        std::vector<Uint8> CommonData{pHeaderData + sizeof(ArchiveHeader), pHeaderData + Pending.HeaderData.GetCurrentSize()};
+        for (auto& Chunk : Pending.ChunkData)
         {
-            FileHeader.BlockBaseOffsets[dev] = InvalidOffset;
+            if (Chunk.IsEmpty())
+                continue;
+
+            const auto* pChunkData = Chunk.GetDataPtr<const Uint8>();
+            CommonData.insert(CommonData.end(), pChunkData, pChunkData + Chunk.GetCurrentSize());
         }
-        else
+        if (!Pending.CommonData.IsEmpty())
         {
-            FileHeader.BlockBaseOffsets[dev] = StaticCast<Uint32>(OffsetInFile);
-            OffsetInFile += Pending.PerDeviceData[dev].GetCurrentSize();
+            const auto* pCommonData = Pending.CommonData.GetDataPtr<const Uint8>();
+            CommonData.insert(CommonData.end(), pCommonData, pCommonData + Pending.CommonData.GetCurrentSize());
         }
+
+        const auto CommonSectionEnd = SectionEnds[ArchiveBlobTable::CommonSection];
+        VERIFY_EXPR(sizeof(ArchiveHeader) + CommonData.size() + BlobData.size() == Pending.OffsetInFile);
+        CommonData.insert(CommonData.end(), BlobData.begin(), BlobData.begin() + CommonSectionEnd);
+
+        std::vector<CompressedArchiveImpl::DataRange> Ranges;
+        Ranges.push_back({CommonData.data(), CommonData.size()});
+        for (Uint32 Section = ArchiveBlobTable::CommonSection + 1; Section < ArchiveBlobTable::SectionCount; ++Section)
+            Ranges.push_back({BlobData.data() + SectionEnds[Section - 1], SectionEnds[Section] - SectionEnds[Section - 1]});
+
+        return CompressedArchiveImpl::Write(pStream, sizeof(ArchiveHeader), Ranges);
     }
-}
 
-void ArchiverImpl::WritePendingDataToStream(const PendingData& Pending, IFileStream* pStream) const
-{
     const size_t InitialSize = pStream->GetSize();
     pStream->Write(Pending.HeaderData.GetDataPtr(), Pending.HeaderData.GetCurrentSize());
 
@@ -423,15 +453,10 @@ void ArchiverImpl::WritePendingDataToStream(const PendingData& Pending, IFileStr
     if (!Pending.CommonData.IsEmpty())
         pStream->Write(Pending.CommonData.GetDataPtr(), Pending.CommonData.GetCurrentSize());
 
-    for (auto& DevData : Pending.PerDeviceData)
-    {
-        if (DevData.IsEmpty())
-            continue;
-
-        pStream->Write(DevData.GetDataPtr(), DevData.GetCurrentSize());
-    }
+    pStream->Write(BlobData.data(), BlobData.size());
 
     VERIFY_EXPR(InitialSize + pStream->GetSize() == Pending.OffsetInFile);
+    return true;
 }
 
 Bool ArchiverImpl::SerializeToStream(IFileStream* pStream)
@@ -440,14 +465,21 @@ Bool ArchiverImpl::SerializeToStream(IFileStream* pStream)
     if (pStream == nullptr)
         return false;
 
+    std::lock_guard<std::mutex> SignaturesLock{m_SignaturesMtx};
+    std::lock_guard<std::mutex> RenderPassesLock{m_RenderPassesMtx};
+    std::lock_guard<std::mutex> ShadersLock{m_ShadersMtx};
+    std::lock_guard<std::mutex> PipelinesLock{m_PipelinesMtx};
+
     PendingData Pending;
+    Pending.Compress = m_CompressionEnabled.load();
+    ReorderShaders(Pending);
     ReserveSpace(Pending);
     WriteDebugInfo(Pending);
     WriteShaderData(Pending);
 
     auto WritePRSPerDeviceData = [&Pending](PRSDataHeader& Header, DeviceType Type, const PRSData& Src) //
     {
-        WritePerDeviceData(Header, Type, Src.GetDeviceData(Type), Pending.PerDeviceData[static_cast<size_t>(Type)]);
+        WritePerDeviceData(Header, Type, Src.GetDeviceData(Type), Pending.Blobs);
     };
     WriteDeviceObjectData<PRSDataHeader>(ChunkType::ResourceSignature, Pending, m_PRSMap, WritePRSPerDeviceData);
 
@@ -455,7 +487,10 @@ Bool ArchiverImpl::SerializeToStream(IFileStream* pStream)
 
     auto WritePSOPerDeviceData = [&Pending](PSODataHeader& Header, DeviceType Type, const auto& Src) //
     {
-        WritePerDeviceData(Header, Type, Src.PerDeviceData[static_cast<size_t>(Type)], Pending.PerDeviceData[static_cast<size_t>(Type)]);
+        WritePerDeviceData(Header, Type, Src.PerDeviceData[static_cast<size_t>(Type)], Pending.Blobs);
+        Header.ContentHash = Src.ContentHash;
+        if (Header.ContentKeyBlob == ArchiveBlobTable::InvalidIndex)
+            Header.ContentKeyBlob = Pending.Blobs.Add(Src.ContentKey);
     };
     WriteDeviceObjectData<PSODataHeader>(ChunkType::GraphicsPipelineStates, Pending, m_GraphicsPSOMap, WritePSOPerDeviceData);
     WriteDeviceObjectData<PSODataHeader>(ChunkType::ComputePipelineStates, Pending, m_ComputePSOMap, WritePSOPerDeviceData);
@@ -464,7 +499,11 @@ Bool ArchiverImpl::SerializeToStream(IFileStream* pStream)
     static_assert(ChunkCount == 9, "Write data for new chunk type");
 
     UpdateOffsetsInArchive(Pending);
-    WritePendingDataToStream(Pending, pStream);
+    if (!WritePendingDataToStream(Pending, pStream))
+    {
+        LOG_ERROR_MESSAGE("Failed to write the archive data to the stream");
+        return false;
+    }
 
     return true;
 }
@@ -472,11 +511,14 @@ Bool ArchiverImpl::SerializeToStream(IFileStream* pStream)
 
 const SerializedData& ArchiverImpl::PRSData::GetCommonData() const
 {
-    return pPRS->GetCommonData();
+    return pPRS ? pPRS->GetCommonData() : CommonData;
 }
 
 const SerializedData& ArchiverImpl::PRSData::GetDeviceData(DeviceType Type) const
 {
+    if (!pPRS)
+        return DeviceData[static_cast<size_t>(Type)];
+
     const auto* pMem = pPRS->GetDeviceData(Type);
     if (pMem != nullptr)
         return *pMem;
@@ -491,8 +533,26 @@ bool ArchiverImpl::AddPipelineResourceSignature(IPipelineResourceSignature* pPRS
     if (pPRS == nullptr)
         return false;
 
-    auto* const pPRSImpl = ClassPtrCast<SerializableResourceSignatureImpl>(pPRS);
-    const auto* Name     = pPRSImpl->GetName();
+    std::lock_guard<std::mutex> Lock{m_SignaturesMtx};
+    return AddPipelineResourceSignatureUnsafe(ClassPtrCast<SerializableResourceSignatureImpl>(pPRS));
+}
+
+bool ArchiverImpl::AddPipelineResourceSignatureUnsafe(SerializableResourceSignatureImpl* pPRSImpl)
+{
+    VERIFY_EXPR(pPRSImpl != nullptr);
+    const auto* Name = pPRSImpl->GetName();
+
+    auto PendingIt = m_PendingDefaultPRSs.find(Name);
+    if (PendingIt != m_PendingDefaultPRSs.end())
+    {
+        if (PendingIt->second != pPRSImpl)
+        {
+            LOG_ERROR_MESSAGE("Pipeline resource signature name '", Name, "' is reserved by a default signature. All signature names must be unique.");
+            return false;
+        }
+        // The pipeline that uses the default signature is being added to the archive
+        m_PendingDefaultPRSs.erase(PendingIt);
+    }
 
     auto IterAndInserted = m_PRSMap.emplace(HashMapStringKey{Name, true}, PRSData{pPRSImpl});
     if (!IterAndInserted.second)
@@ -511,27 +571,6 @@ bool ArchiverImpl::AddPipelineResourceSignature(IPipelineResourceSignature* pPRS
     return true;
 }
 
-bool ArchiverImpl::CachePipelineResourceSignature(RefCntAutoPtr<SerializableResourceSignatureImpl>& pPRS)
-{
-    VERIFY_EXPR(pPRS);
-    auto IterAndInserted = m_PRSCache.insert(pPRS);
-
-    // Found same PRS in the cache
-    if (!IterAndInserted.second)
-    {
-        pPRS = *IterAndInserted.first;
-
-#ifdef DILIGENT_DEBUG
-        auto Iter = m_PRSMap.find(pPRS->GetName());
-        VERIFY_EXPR(Iter != m_PRSMap.end());
-        VERIFY_EXPR(Iter->second.pPRS == pPRS);
-#endif
-        return true;
-    }
-
-    return AddPipelineResourceSignature(pPRS);
-}
-
 Bool ArchiverImpl::AddPipelineResourceSignature(const PipelineResourceSignatureDesc& SignatureDesc,
                                                 const ResourceSignatureArchiveInfo&  ArchiveInfo)
 {
@@ -543,6 +582,25 @@ Bool ArchiverImpl::AddPipelineResourceSignature(const PipelineResourceSignatureD
     return AddPipelineResourceSignature(pPRS);
 }
 
+bool ArchiverImpl::AddArchivedSignature(const char* Name, const ArchiveRepacker::SignatureData& SrcData)
+{
+    VERIFY_EXPR(Name != nullptr && SrcData.pCommonData != nullptr);
+
+    std::lock_guard<std::mutex> Lock{m_SignaturesMtx};
+    if (m_PRSMap.find(Name) != m_PRSMap.end() || m_PendingDefaultPRSs.find(Name) != m_PendingDefaultPRSs.end())
+        return false;
+
+    PRSData Data{nullptr};
+    Data.CommonData = CopySerializedData(*SrcData.pCommonData);
+    for (size_t i = 0; i < DeviceDataCount; ++i)
+    {
+        if (SrcData.DeviceData[i] != nullptr)
+            Data.DeviceData[i] = CopySerializedData(*SrcData.DeviceData[i]);
+    }
+    m_PRSMap.emplace(HashMapStringKey{Name, true}, std::move(Data));
+    return true;
+}
+
 String ArchiverImpl::GetDefaultPRSName(const char* PSOName) const
 {
     VERIFY_EXPR(PSOName != nullptr);
@@ -550,7 +608,7 @@ String ArchiverImpl::GetDefaultPRSName(const char* PSOName) const
     for (Uint32 Index = 0;; ++Index)
     {
         auto PRSName = Index == 0 ? PRSName0 : PRSName0 + std::to_string(Index);
-        if (m_PRSMap.find(PRSName.c_str()) == m_PRSMap.end())
+        if (m_PRSMap.find(PRSName.c_str()) == m_PRSMap.end() && m_PendingDefaultPRSs.find(PRSName.c_str()) == m_PendingDefaultPRSs.end())
             return PRSName;
     }
 }
@@ -567,42 +625,27 @@ void ArchiverImpl::SerializeShaderBytecode(TShaderIndices&         ShaderIndices
                                            const void*             Bytecode,
                                            size_t                  BytecodeSize)
 {
-    auto& Shaders{m_Shaders[static_cast<Uint32>(DevType)]};
-
     constexpr SHADER_SOURCE_LANGUAGE SourceLanguage = SHADER_SOURCE_LANGUAGE_DEFAULT;
     constexpr SHADER_COMPILER        ShaderCompiler = SHADER_COMPILER_DEFAULT;
 
     Serializer<SerializerMode::Measure> MeasureSer;
     MeasureSer(CI.Desc.ShaderType, CI.EntryPoint, SourceLanguage, ShaderCompiler);
 
-    const auto   Size   = MeasureSer.GetSize() + BytecodeSize;
-    const Uint8* pBytes = static_cast<const Uint8*>(Bytecode);
+    const auto Size = MeasureSer.GetSize() + BytecodeSize;
 
     ShaderKey Key{std::make_shared<SerializedData>(Size, GetRawAllocator())};
 
     Serializer<SerializerMode::Write> Ser{*Key.Data};
     Ser(CI.Desc.ShaderType, CI.EntryPoint, SourceLanguage, ShaderCompiler);
-
-    for (size_t s = 0; s < BytecodeSize; ++s)
-        Ser(pBytes[s]);
+    Ser.SerializeBytes(Bytecode, BytecodeSize);
 
     VERIFY_EXPR(Ser.IsEnded());
 
-
-    auto IterAndInserted = Shaders.Map.emplace(Key, Shaders.List.size());
-    auto Iter            = IterAndInserted.first;
-    if (IterAndInserted.second)
-    {
-        VERIFY_EXPR(Shaders.List.size() == Iter->second);
-        Shaders.List.push_back(Key);
-    }
-    ShaderIndices.push_back(StaticCast<Uint32>(Iter->second));
+    AddShaderKey(ShaderIndices, DevType, std::move(Key));
 }
 
 void ArchiverImpl::SerializeShaderSource(TShaderIndices& ShaderIndices, DeviceType DevType, const ShaderCreateInfo& CI)
 {
-    auto& Shaders = m_Shaders[static_cast<Uint32>(DevType)];
-
     VERIFY_EXPR(CI.SourceLength > 0);
 
     String Source;
@@ -616,26 +659,32 @@ void ArchiverImpl::SerializeShaderSource(TShaderIndices& ShaderIndices, DeviceTy
     Serializer<SerializerMode::Measure> MeasureSer;
     MeasureSer(CI.Desc.ShaderType, CI.EntryPoint, CI.SourceLanguage, CI.ShaderCompiler, CI.UseCombinedTextureSamplers, CI.CombinedSamplerSuffix);
 
-    const auto   BytecodeSize = (Source.size() + 1) * sizeof(Source[0]);
-    const auto   Size         = MeasureSer.GetSize() + BytecodeSize;
-    const Uint8* pBytes       = reinterpret_cast<const Uint8*>(Source.c_str());
+    const auto BytecodeSize = (Source.size() + 1) * sizeof(Source[0]);
+    const auto Size         = MeasureSer.GetSize() + BytecodeSize;
 
     ShaderKey Key{std::make_shared<SerializedData>(Size, GetRawAllocator())};
 
     Serializer<SerializerMode::Write> Ser{*Key.Data};
     Ser(CI.Desc.ShaderType, CI.EntryPoint, CI.SourceLanguage, CI.ShaderCompiler, CI.UseCombinedTextureSamplers, CI.CombinedSamplerSuffix);
-
-    for (size_t s = 0; s < BytecodeSize; ++s)
-        Ser(pBytes[s]);
+    Ser.SerializeBytes(Source.c_str(), BytecodeSize);
 
     VERIFY_EXPR(Ser.IsEnded());
 
+    AddShaderKey(ShaderIndices, DevType, std::move(Key));
+}
+
+void ArchiverImpl::AddShaderKey(TShaderIndices& ShaderIndices, DeviceType DevType, ShaderKey Key)
+{
+    std::lock_guard<std::mutex> Lock{m_ShadersMtx};
+
+    auto& Shaders = m_Shaders[static_cast<Uint32>(DevType)];
+
     auto IterAndInserted = Shaders.Map.emplace(Key, Shaders.List.size());
     auto Iter            = IterAndInserted.first;
     if (IterAndInserted.second)
     {
         VERIFY_EXPR(Shaders.List.size() == Iter->second);
-        Shaders.List.push_back(Key);
+        Shaders.List.push_back(std::move(Key));
     }
     ShaderIndices.push_back(StaticCast<Uint32>(Iter->second));
 }
@@ -662,6 +711,8 @@ bool ArchiverImpl::AddRenderPass(IRenderPass* pRP)
     if (pRP == nullptr)
         return false;
 
+    std::lock_guard<std::mutex> Lock{m_RenderPassesMtx};
+
     auto* pRPImpl         = ClassPtrCast<SerializableRenderPassImpl>(pRP);
     auto  IterAndInserted = m_RPMap.emplace(HashMapStringKey{pRPImpl->GetDesc().Name, true}, RPData{pRPImpl});
     if (!IterAndInserted.second)
@@ -743,6 +794,93 @@ void SerializerPSOImpl(Serializer<Mode>&                                 Ser,
     PSOSerializer<Mode>::SerializeCreateInfo(Ser, PSOCreateInfo, PRSNames, nullptr, RemapShaders);
 }
 
+template <typename HandlerType>
+void ProcessPipelineShaders(const GraphicsPipelineStateCreateInfo& CreateInfo, HandlerType Handler)
+{
+    for (auto* pShader : {CreateInfo.pVS, CreateInfo.pPS, CreateInfo.pDS, CreateInfo.pHS, CreateInfo.pGS, CreateInfo.pAS, CreateInfo.pMS})
+        Handler(pShader);
+}
+
+template <typename HandlerType>
+void ProcessPipelineShaders(const ComputePipelineStateCreateInfo& CreateInfo, HandlerType Handler)
+{
+    Handler(CreateInfo.pCS);
+}
+
+template <typename HandlerType>
+void ProcessPipelineShaders(const TilePipelineStateCreateInfo& CreateInfo, HandlerType Handler)
+{
+    Handler(CreateInfo.pTS);
+}
+
+template <typename HandlerType>
+void ProcessPipelineShaders(const RayTracingPipelineStateCreateInfo& CreateInfo, HandlerType Handler)
+{
+    for (Uint32 i = 0; i < CreateInfo.GeneralShaderCount; ++i)
+        Handler(CreateInfo.pGeneralShaders[i].pShader);
+    for (Uint32 i = 0; i < CreateInfo.TriangleHitShaderCount; ++i)
+    {
+        Handler(CreateInfo.pTriangleHitShaders[i].pClosestHitShader);
+        Handler(CreateInfo.pTriangleHitShaders[i].pAnyHitShader);
+    }
+    for (Uint32 i = 0; i < CreateInfo.ProceduralHitShaderCount; ++i)
+    {
+        Handler(CreateInfo.pProceduralHitShaders[i].pIntersectionShader);
+        Handler(CreateInfo.pProceduralHitShaders[i].pClosestHitShader);
+        Handler(CreateInfo.pProceduralHitShaders[i].pAnyHitShader);
+    }
+}
+
+template <typename CreateInfoType>
+const SerializedData* GetRenderPassData(const CreateInfoType& CreateInfo)
+{
+    return nullptr;
+}
+
+template <>
+const SerializedData* GetRenderPassData<GraphicsPipelineStateCreateInfo>(const GraphicsPipelineStateCreateInfo& CreateInfo)
+{
+    const auto* pRenderPass = CreateInfo.GraphicsPipeline.pRenderPass;
+    return pRenderPass != nullptr ? &ClassPtrCast<const SerializableRenderPassImpl>(pRenderPass)->GetCommonData() : nullptr;
+}
+
+// clang-format off
+ArchiverImpl::ChunkType GetPSOChunkType(const GraphicsPipelineStateCreateInfo&)   { return ArchiverImpl::ChunkType::GraphicsPipelineStates;   }
+ArchiverImpl::ChunkType GetPSOChunkType(const ComputePipelineStateCreateInfo&)    { return ArchiverImpl::ChunkType::ComputePipelineStates;    }
+ArchiverImpl::ChunkType GetPSOChunkType(const TilePipelineStateCreateInfo&)       { return ArchiverImpl::ChunkType::TilePipelineStates;       }
+ArchiverImpl::ChunkType GetPSOChunkType(const RayTracingPipelineStateCreateInfo&) { return ArchiverImpl::ChunkType::RayTracingPipelineStates; }
+// clang-format on
+
+// Pipeline description, the names of its signatures and render pass, and the auxiliary data
+template <SerializerMode Mode, typename CreateInfoType>
+void SerializePSOCommonData(Serializer<Mode>&                                    Ser,
+                            const CreateInfoType&                                CreateInfo,
+                            DeviceObjectArchiveBase::TPRSNames&                  PRSNames,
+                            const DeviceObjectArchiveBase::SerializedPSOAuxData& AuxData)
+{
+    SerializerPSOImpl(Ser, CreateInfo, PRSNames);
+    PSOSerializer<Mode>::SerializeAuxData(Ser, AuxData, nullptr);
+}
+
+// Ray tracing shader groups are serialized by the indices of the compiled shaders,
+// so the description of a ray tracing pipeline can't be serialized before the shaders are compiled.
+template <typename CreateInfoType>
+bool DescriptionRequiresCompiledShaders(const CreateInfoType&) { return false; }
+bool DescriptionRequiresCompiledShaders(const RayTracingPipelineStateCreateInfo&) { return true; }
+
+template <typename CreateInfoType>
+bool CompilePipelineShaders(const CreateInfoType& CreateInfo)
+{
+    bool Compiled = true;
+    ProcessPipelineShaders(CreateInfo,
+                           [&](IShader* pShader) //
+                           {
+                               if (pShader != nullptr && !ClassPtrCast<SerializableShaderImpl>(pShader)->Compile())
+                                   Compiled = false;
+                           });
+    return Compiled;
+}
+
 #define LOG_PSO_ERROR_AND_THROW(...) LOG_ERROR_AND_THROW("Description of PSO is invalid: ", ##__VA_ARGS__)
 #define VERIFY_PSO(Expr, ...)                     \
     do                                            \
@@ -782,9 +920,204 @@ void ValidatePipelineStateArchiveInfo(const PipelineStateCreateInfo&  PSOCreateI
 } // namespace
 
 template <typename CreateInfoType>
-bool ArchiverImpl::SerializePSO(TNamedObjectHashMap<TPSOData<CreateInfoType>>& PSOMap,
-                                const CreateInfoType&                          InPSOCreateInfo,
-                                const PipelineStateArchiveInfo&                ArchiveInfo) noexcept
+bool ArchiverImpl::PatchShaders(ARCHIVE_DEVICE_DATA_FLAGS Flag, const CreateInfoType& CreateInfo, TPSOData<CreateInfoType>& Data)
+{
+    static_assert(ARCHIVE_DEVICE_DATA_FLAG_LAST == ARCHIVE_DEVICE_DATA_FLAG_METAL_IOS, "Please update the switch below to handle the new data type");
+    switch (Flag)
+    {
+#if D3D11_SUPPORTED
+        case ARCHIVE_DEVICE_DATA_FLAG_D3D11:
+            return PatchShadersD3D11(CreateInfo, Data);
+#endif
+#if D3D12_SUPPORTED
+        case ARCHIVE_DEVICE_DATA_FLAG_D3D12:
+            return PatchShadersD3D12(CreateInfo, Data);
+#endif
+#if GL_SUPPORTED || GLES_SUPPORTED
+        case ARCHIVE_DEVICE_DATA_FLAG_GL:
+        case ARCHIVE_DEVICE_DATA_FLAG_GLES:
+            return PatchShadersGL(CreateInfo, Data);
+#endif
+#if VULKAN_SUPPORTED
+        case ARCHIVE_DEVICE_DATA_FLAG_VULKAN:
+            return PatchShadersVk(CreateInfo, Data);
+#endif
+#if METAL_SUPPORTED
+        case ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS:
+        case ARCHIVE_DEVICE_DATA_FLAG_METAL_IOS:
+            return PatchShadersMtl(CreateInfo, Data, ArchiveDeviceDataFlagToArchiveDeviceType(Flag));
+#endif
+        case ARCHIVE_DEVICE_DATA_FLAG_NONE:
+            UNEXPECTED("ARCHIVE_DEVICE_DATA_FLAG_NONE (0) should never occur");
+            return true;
+
+        default:
+            LOG_ERROR_MESSAGE("Unexpected render device type");
+            return true;
+    }
+}
+
+template <typename CreateInfoType>
+SerializedData ArchiverImpl::ComputePipelineContentKey(const CreateInfoType&                         CreateInfo,
+                                                       const SerializedPSOAuxData&                   AuxData,
+                                                       const std::vector<ARCHIVE_DEVICE_DATA_FLAGS>& DeviceFlags)
+{
+    // The key is unknown if the compilation input of any shader is unknown
+    bool HasShaderKeys = true;
+    ProcessPipelineShaders(CreateInfo,
+                           [&](IShader* pShader) //
+                           {
+                               if (pShader != nullptr && !ClassPtrCast<const SerializableShaderImpl>(pShader)->GetContentKey())
+                                   HasShaderKeys = false;
+                           });
+    if (!HasShaderKeys)
+        return {};
+
+    // The name of the default signature is not known until the signature is created. The default signature
+    // is defined by the resource layout, which is a part of the description, and the SRB allocation granularity.
+    const bool HasExplicitSignatures = CreateInfo.ResourceSignaturesCount != 0;
+
+    TPRSNames PRSNames = {};
+    for (Uint32 i = 0; i < CreateInfo.ResourceSignaturesCount; ++i)
+        PRSNames[i] = CreateInfo.ppResourceSignatures[i]->GetDesc().Name;
+    if (!HasExplicitSignatures)
+        PRSNames[0] = "";
+
+    const auto SerializeData = [](auto& Ser, const SerializedData* pData) //
+    {
+        const Uint64 Size = pData != nullptr ? pData->Size() : 0;
+        Ser(Size);
+        Ser.SerializeBytes(pData != nullptr ? pData->Ptr() : nullptr, static_cast<size_t>(Size));
+    };
+
+    const auto SerializeKey = [&](auto& Ser) //
+    {
+        // Shaders compiled and patched by a different engine version may be different
+        Uint32 APIVersion = DILIGENT_API_VERSION;
+        Ser(APIVersion);
+
+        SerializePSOCommonData(Ser, CreateInfo, PRSNames, AuxData);
+        if (!HasExplicitSignatures)
+            Ser(CreateInfo.PSODesc.SRBAllocationGranularity);
+        SerializeData(Ser, GetRenderPassData(CreateInfo));
+
+        for (auto Flag : DeviceFlags)
+        {
+            const auto DevType = ArchiveDeviceDataFlagToArchiveDeviceType(Flag);
+            Ser(DevType);
+
+            for (Uint32 i = 0; i < CreateInfo.ResourceSignaturesCount; ++i)
+            {
+                const auto* pPRS = ClassPtrCast<const SerializableResourceSignatureImpl>(CreateInfo.ppResourceSignatures[i]);
+                SerializeData(Ser, &pPRS->GetCommonData());
+                SerializeData(Ser, pPRS->GetDeviceData(DevType));
+            }
+
+            ProcessPipelineShaders(CreateInfo,
+                                   [&](IShader* pShader) //
+                                   {
+                                       const auto* pSerShader = ClassPtrCast<const SerializableShaderImpl>(pShader);
+                                       SerializeData(Ser, pSerShader != nullptr ? &pSerShader->GetContentKey() : nullptr);
+                                   });
+        }
+    };
+
+    Serializer<SerializerMode::Measure> MeasureSer;
+    SerializeKey(MeasureSer);
+
+    auto Key = MeasureSer.AllocateData(GetRawAllocator());
+    Serializer<SerializerMode::Write> Ser{Key};
+    SerializeKey(Ser);
+    VERIFY_EXPR(Ser.IsEnded());
+
+    return Key;
+}
+
+template <typename CreateInfoType>
+bool ArchiverImpl::ReusePipelineData(const ArchiveRepacker&                        PrevArchive,
+                                     const CreateInfoType&                         CreateInfo,
+                                     const std::vector<ARCHIVE_DEVICE_DATA_FLAGS>& DeviceFlags,
+                                     TPSOData<CreateInfoType>&                     Data)
+{
+    VERIFY_EXPR(Data.ContentKey && Data.ContentHash != 0);
+
+    std::vector<DeviceType> DeviceTypes;
+    for (auto Flag : DeviceFlags)
+        DeviceTypes.push_back(ArchiveDeviceDataFlagToArchiveDeviceType(Flag));
+
+    ArchiveRepacker::PipelineData  PrevData;
+    ArchiveRepacker::SignatureData PrevDefaultSignature;
+    String                         DefaultSignatureName;
+    try
+    {
+        // All devices must be found in the previous archive before any data is added
+        if (!PrevArchive.GetPipelineData(GetPSOChunkType(CreateInfo), CreateInfo.PSODesc.Name, Data.ContentHash, Data.ContentKey, DeviceTypes, PrevData))
+            return false;
+
+        if (CreateInfo.ResourceSignaturesCount == 0)
+        {
+            // The common data of the pipeline starts with the description that contains the name of the default signature
+            PipelineStateCreateInfo          PrevCI;
+            TPRSNames                        PrevPRSNames = {};
+            DynamicLinearAllocator           Allocator{GetRawAllocator()};
+            Serializer<SerializerMode::Read> Ser{*PrevData.pCommonData};
+            PSOSerializer<SerializerMode::Read>::SerializeCreateInfo(Ser, PrevCI, PrevPRSNames, &Allocator);
+            if (PrevCI.ResourceSignaturesCount != 0 || PrevPRSNames[0] == nullptr)
+                return false;
+
+            DefaultSignatureName = PrevPRSNames[0];
+            if (!PrevArchive.GetSignatureData(DefaultSignatureName.c_str(), PrevDefaultSignature))
+                return false;
+        }
+    }
+    catch (...)
+    {
+        return false;
+    }
+
+    // The name may have been taken by another signature in this archive, in which case the pipeline is patched again
+    if (!DefaultSignatureName.empty() && !AddArchivedSignature(DefaultSignatureName.c_str(), PrevDefaultSignature))
+        return false;
+
+    // The archived bytes are copied verbatim
+    Data.CommonData = CopySerializedData(*PrevData.pCommonData);
+    for (auto DevType : DeviceTypes)
+    {
+        for (const auto* pSrcShader : PrevData.Shaders[static_cast<size_t>(DevType)])
+        {
+            ShaderKey Key{std::make_shared<SerializedData>(CopySerializedData(*pSrcShader))};
+            AddShaderKey(Data.PerDeviceShaders[static_cast<size_t>(DevType)], DevType, std::move(Key));
+        }
+    }
+
+    return true;
+}
+
+Bool ArchiverImpl::SetPreviousArchive(IArchive* pArchive)
+{
+    std::shared_ptr<const ArchiveRepacker> pPrevArchive;
+    if (pArchive != nullptr)
+    {
+        try
+        {
+            pPrevArchive = std::make_shared<ArchiveRepacker>(pArchive);
+        }
+        catch (...)
+        {
+            LOG_ERROR_MESSAGE("Failed to load the previous archive");
+            return false;
+        }
+    }
+
+    std::lock_guard<std::mutex> Lock{m_PipelinesMtx};
+    m_pPrevArchive = std::move(pPrevArchive);
+    return true;
+}
+
+template <typename CreateInfoType>
+bool ArchiverImpl::SerializePSO(TNamedObjectMap<TPSOData<CreateInfoType>>& PSOMap,
+                                const CreateInfoType&                      InPSOCreateInfo,
+                                const PipelineStateArchiveInfo&            ArchiveInfo) noexcept
 {
     CreateInfoType PSOCreateInfo = InPSOCreateInfo;
     try
@@ -797,70 +1130,79 @@ bool ArchiverImpl::SerializePSO(TNamedObjectHashMap<TPSOData<CreateInfoType>>& P
         return false;
     }
 
-    auto IterAndInserted = PSOMap.emplace(HashMapStringKey{PSOCreateInfo.PSODesc.Name, true}, TPSOData<CreateInfoType>{});
-    if (!IterAndInserted.second)
     {
-        LOG_ERROR_MESSAGE("Pipeline must have unique name");
-        return false;
+        std::lock_guard<std::mutex> Lock{m_PipelinesMtx};
+        if (PSOMap.find(PSOCreateInfo.PSODesc.Name) != PSOMap.end())
+        {
+            LOG_ERROR_MESSAGE("Pipeline must have unique name");
+            return false;
+        }
     }
 
-    auto& Data{IterAndInserted.first->second};
+    // The pipeline data is prepared without holding the lock and is added to the map when complete.
+    TPSOData<CreateInfoType> Data;
     Data.AuxData.NoShaderReflection = (ArchiveInfo.PSOFlags & PSO_ARCHIVE_FLAG_STRIP_REFLECTION) != 0;
+
+    std::vector<ARCHIVE_DEVICE_DATA_FLAGS> DeviceFlags;
     for (auto DeviceBits = ArchiveInfo.DeviceFlags; DeviceBits != 0;)
     {
         const auto Flag = ExtractLSB(DeviceBits);
+        // OpenGL and GLES share the same device data
+        if (Flag == ARCHIVE_DEVICE_DATA_FLAG_GLES && (ArchiveInfo.DeviceFlags & ARCHIVE_DEVICE_DATA_FLAG_GL) != 0)
+            continue;
+        DeviceFlags.push_back(Flag);
+    }
 
-        static_assert(ARCHIVE_DEVICE_DATA_FLAG_LAST == ARCHIVE_DEVICE_DATA_FLAG_METAL_IOS, "Please update the switch below to handle the new data type");
-        switch (Flag)
-        {
-#if D3D11_SUPPORTED
-            case ARCHIVE_DEVICE_DATA_FLAG_D3D11:
-                if (!PatchShadersD3D11(PSOCreateInfo, Data))
-                    return false;
-                break;
-#endif
-#if D3D12_SUPPORTED
-            case ARCHIVE_DEVICE_DATA_FLAG_D3D12:
-                if (!PatchShadersD3D12(PSOCreateInfo, Data))
-                    return false;
-                break;
-#endif
-#if GL_SUPPORTED || GLES_SUPPORTED
-            case ARCHIVE_DEVICE_DATA_FLAG_GL:
-            case ARCHIVE_DEVICE_DATA_FLAG_GLES:
-                if (!PatchShadersGL(PSOCreateInfo, Data))
-                    return false;
-                break;
-#endif
-#if VULKAN_SUPPORTED
-            case ARCHIVE_DEVICE_DATA_FLAG_VULKAN:
-                if (!PatchShadersVk(PSOCreateInfo, Data))
-                    return false;
-                break;
-#endif
-#if METAL_SUPPORTED
-            case ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS:
-            case ARCHIVE_DEVICE_DATA_FLAG_METAL_IOS:
-                if (!PatchShadersMtl(PSOCreateInfo, Data, ArchiveDeviceDataFlagToArchiveDeviceType(Flag)))
-                    return false;
-                break;
-#endif
-            case ARCHIVE_DEVICE_DATA_FLAG_NONE:
-                UNEXPECTED("ARCHIVE_DEVICE_DATA_FLAG_NONE (0) should never occur");
-                break;
+    // Shaders are only compiled when the pipeline can't be copied from the previous archive
+    if (DescriptionRequiresCompiledShaders(PSOCreateInfo) && !CompilePipelineShaders(PSOCreateInfo))
+        return false;
 
-            default:
-                LOG_ERROR_MESSAGE("Unexpected render device type");
-                break;
-        }
+    Data.ContentKey = ComputePipelineContentKey(PSOCreateInfo, Data.AuxData, DeviceFlags);
+    if (Data.ContentKey)
+    {
+        // Zero indicates that the key is unknown
+        Data.ContentHash = std::max(Uint64{Data.ContentKey.GetHash()}, Uint64{1});
     }
 
-    if (!Data.CommonData)
+    std::shared_ptr<const ArchiveRepacker> pPrevArchive;
     {
-        auto SignaturesCount = PSOCreateInfo.ResourceSignaturesCount;
+        std::lock_guard<std::mutex> Lock{m_PipelinesMtx};
+        pPrevArchive = m_pPrevArchive;
+    }
+
+    // The default signature is added to the archive by ReusePipelineData() when the pipeline is copied
+    const bool HasExplicitSignatures = PSOCreateInfo.ResourceSignaturesCount != 0;
+    auto       SignaturesCount       = PSOCreateInfo.ResourceSignaturesCount;
 
-        if (SignaturesCount == 0)
+    IPipelineResourceSignature* DefaultSignatures[1] = {};
+    if (!pPrevArchive || !Data.ContentKey || !ReusePipelineData(*pPrevArchive, PSOCreateInfo, DeviceFlags, Data))
+    {
+        if (!CompilePipelineShaders(PSOCreateInfo))
+            return false;
+
+        if (HasExplicitSignatures)
+        {
+            // Every backend only reads the signatures and shaders, and writes its own device data,
+            // so shaders for different backends may be patched in parallel.
+            std::vector<Uint8> Succeeded(DeviceFlags.size(), 0);
+            m_pSerializationDevice->ExecuteTasks(StaticCast<Uint32>(DeviceFlags.size()),
+                                                 [&](Uint32 i) //
+                                                 {
+                                                     Succeeded[i] = PatchShaders(DeviceFlags[i], PSOCreateInfo, Data) ? 1 : 0;
+                                                 });
+            if (std::find(Succeeded.begin(), Succeeded.end(), Uint8{0}) != Succeeded.end())
+                return false;
+        }
+        else
         {
+            // The default signature is shared by all backends. Its common description is initialized
+            // by the first device signature, so the backends must be processed in the same order every time.
+            for (auto Flag : DeviceFlags)
+            {
+                if (!PatchShaders(Flag, PSOCreateInfo, Data))
+                    return false;
+            }
+
 #if GL_SUPPORTED || GLES_SUPPORTED
             if (ArchiveInfo.DeviceFlags & (ARCHIVE_DEVICE_DATA_FLAG_GL | ARCHIVE_DEVICE_DATA_FLAG_GLES))
             {
@@ -872,7 +1214,6 @@ bool ArchiverImpl::SerializePSO(TNamedObjectHashMap<TPSOData<CreateInfoType>>& P
 #endif
         }
 
-        IPipelineResourceSignature* DefaultSignatures[1] = {};
         if (Data.pDefaultSignature)
         {
             DefaultSignatures[0]               = Data.pDefaultSignature;
@@ -882,23 +1223,29 @@ bool ArchiverImpl::SerializePSO(TNamedObjectHashMap<TPSOData<CreateInfoType>>& P
 
         TPRSNames PRSNames = {};
         for (Uint32 i = 0; i < SignaturesCount; ++i)
-        {
-            if (!AddPipelineResourceSignature(PSOCreateInfo.ppResourceSignatures[i]))
-                return false;
             PRSNames[i] = PSOCreateInfo.ppResourceSignatures[i]->GetDesc().Name;
-        }
 
         Serializer<SerializerMode::Measure> MeasureSer;
-        SerializerPSOImpl(MeasureSer, PSOCreateInfo, PRSNames);
-        PSOSerializer<SerializerMode::Measure>::SerializeAuxData(MeasureSer, Data.AuxData, nullptr);
+        SerializePSOCommonData(MeasureSer, PSOCreateInfo, PRSNames, Data.AuxData);
 
         Data.CommonData = MeasureSer.AllocateData(GetRawAllocator());
         Serializer<SerializerMode::Write> Ser{Data.CommonData};
-        SerializerPSOImpl(Ser, PSOCreateInfo, PRSNames);
-        PSOSerializer<SerializerMode::Write>::SerializeAuxData(Ser, Data.AuxData, nullptr);
-
+        SerializePSOCommonData(Ser, PSOCreateInfo, PRSNames, Data.AuxData);
         VERIFY_EXPR(Ser.IsEnded());
     }
+
+    for (Uint32 i = 0; i < SignaturesCount; ++i)
+    {
+        if (!AddPipelineResourceSignature(PSOCreateInfo.ppResourceSignatures[i]))
+            return false;
+    }
+
+    std::lock_guard<std::mutex> Lock{m_PipelinesMtx};
+    if (!PSOMap.emplace(HashMapStringKey{PSOCreateInfo.PSODesc.Name, true}, std::move(Data)).second)
+    {
+        LOG_ERROR_MESSAGE("Pipeline must have unique name");
+        return false;
+    }
     return true;
 }
 
@@ -174,7 +174,7 @@ bool ArchiverImpl::PatchShadersD3D11(const CreateInfoType& CreateInfo, TPSOData<
 
         SerializeShaderBytecode(ShaderIndices, DeviceType::Direct3D11, CI, pBytecode->GetBufferPointer(), pBytecode->GetBufferSize());
     }
-    Data.PerDeviceData[static_cast<size_t>(DeviceType::Direct3D11)] = SerializeShadersForPSO(ShaderIndices);
+    Data.PerDeviceShaders[static_cast<size_t>(DeviceType::Direct3D11)] = std::move(ShaderIndices);
     return true;
 }
 
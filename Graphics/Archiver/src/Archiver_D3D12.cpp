@@ -147,7 +147,7 @@ bool ArchiverImpl::PatchShadersD3D12(const CreateInfoType& CreateInfo, TPSOData<
         }
     }
 
-    Data.PerDeviceData[static_cast<size_t>(DeviceType::Direct3D12)] = SerializeShadersForPSO(ShaderIndices);
+    Data.PerDeviceShaders[static_cast<size_t>(DeviceType::Direct3D12)] = std::move(ShaderIndices);
     return true;
 }
 
@@ -103,7 +103,7 @@ bool ArchiverImpl::PatchShadersGL(const CreateInfoType& CreateInfo, TPSOData<Cre
     {
         SerializeShaderSource(ShaderIndices, DeviceType::OpenGL, ShaderStages[i].pShader->GetCreateInfo());
     }
-    Data.PerDeviceData[static_cast<size_t>(DeviceType::OpenGL)] = SerializeShadersForPSO(ShaderIndices);
+    Data.PerDeviceShaders[static_cast<size_t>(DeviceType::OpenGL)] = std::move(ShaderIndices);
     return true;
 }
 
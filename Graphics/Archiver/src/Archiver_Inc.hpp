@@ -29,6 +29,7 @@
 #include <unordered_map>
 #include <vector>
 #include <algorithm>
+#include <mutex>
 
 #include "PSOSerializer.hpp"
 
@@ -91,29 +92,24 @@ bool ArchiverImpl::CreateDefaultResourceSignature(DeviceType
 
         if (!pSignature)
         {
-            // Get unique name that is not yet present in the cache
+            // The lock is only held to reserve a unique name. The signature is not visible to other
+            // threads until the pipeline is added to the archive, so the device signatures are created without it.
+            std::lock_guard<std::mutex> Lock{m_SignaturesMtx};
+
+            // Get unique name that is not yet present in the archive or reserved by another default signature
             const auto UniqueName = GetDefaultPRSName(PSODesc.Name);
-            SignDesc.SetName(UniqueName.c_str());
 
             // Create empty serializable signature
             m_pSerializationDevice->CreateSerializableResourceSignature(&pSignature, UniqueName.c_str());
             if (!pSignature)
                 return false;
 
-            // Even though we are not going to reuse the default PRS, we need to add it to the cache
-            // to make its name unavailable for future signatures
-            if (!CachePipelineResourceSignature(pSignature))
-            {
-                UNEXPECTED("Failed to add default signature '", UniqueName, "' to the cache. This should've never happened as we generated the unique name.");
-                return false;
-            }
-        }
-        else
-        {
-            // Override the name to make sure it is consistent for all devices
-            SignDesc.SetName(pSignature->GetName());
+            m_PendingDefaultPRSs.emplace(HashMapStringKey{pSignature->GetName()}, pSignature);
         }
 
+        // Use the same name for all devices
+        SignDesc.SetName(pSignature->GetName());
+
         pSignature->CreateDeviceSignature<SignatureImplType>(Type, SignDesc, ActiveShaderStageFlags);
     }
     catch (...)
@@ -159,7 +159,7 @@ bool ArchiverImpl::PatchShadersMtl(const CreateInfoType&     CreateInfo,
         return false;
     }
 
-    Data.PerDeviceData[static_cast<size_t>(DevType)] = SerializeShadersForPSO(ShaderIndices);
+    Data.PerDeviceShaders[static_cast<size_t>(DevType)] = std::move(ShaderIndices);
 
     return true;
 }
@@ -169,7 +169,7 @@ bool ArchiverImpl::PatchShadersVk(const CreateInfoType& CreateInfo, TPSOData<Cre
         }
     }
 
-    Data.PerDeviceData[static_cast<size_t>(DeviceType::Vulkan)] = SerializeShadersForPSO(ShaderIndices);
+    Data.PerDeviceShaders[static_cast<size_t>(DeviceType::Vulkan)] = std::move(ShaderIndices);
     return true;
 }
 
@@ -30,6 +30,9 @@
 #include "DataBlobImpl.hpp"
 #include "PlatformMisc.hpp"
 #include "BasicMath.hpp"
+#include "HashUtils.hpp"
+
+#include <algorithm>
 
 namespace Diligent
 {
@@ -40,7 +43,9 @@ SerializableShaderImpl::SerializableShaderImpl(IReferenceCounters*       pRefCou
                                                ARCHIVE_DEVICE_DATA_FLAGS DeviceFlags) :
     TBase{pRefCounters},
     m_pDevice{pDevice},
-    m_CreateInfo{InShaderCI}
+    m_CreateInfo{InShaderCI},
+    m_DeviceFlags{DeviceFlags},
+    m_pSourceFactory{InShaderCI.pShaderSourceStreamFactory}
 {
     if ((DeviceFlags & m_pDevice->GetValidDeviceFlags()) != DeviceFlags)
     {
@@ -53,64 +58,132 @@ SerializableShaderImpl::SerializableShaderImpl(IReferenceCounters*       pRefCou
     }
 
     CopyShaderCreateInfo(InShaderCI);
+    InitContentKey(InShaderCI.pShaderSourceStreamFactory);
+
+    // Compilation is the most expensive part of the serialization, so it is deferred until the shader
+    // is used by a pipeline that can't be copied from the previous archive (see ArchiverImpl::SerializePSO()).
+    // The shader is compiled immediately when the compiler output is requested or when its content key
+    // is unknown, since pipelines that use such shader are never copied.
+    if (InShaderCI.ppCompilerOutput == nullptr && m_ContentKey)
+        return;
+
+    const auto CompilationLog = CompileShaders(InShaderCI);
+    if (!CompilationLog.empty())
+    {
+        if (InShaderCI.ppCompilerOutput)
+        {
+            auto* pLogBlob = MakeNewRCObj<DataBlobImpl>{}(CompilationLog.size() + 1);
+            std::memcpy(pLogBlob->GetDataPtr(), CompilationLog.c_str(), CompilationLog.size() + 1);
+            pLogBlob->QueryInterface(IID_DataBlob, reinterpret_cast<IObject**>(InShaderCI.ppCompilerOutput));
+        }
+        LOG_ERROR_AND_THROW("Shader '", (InShaderCI.Desc.Name ? InShaderCI.Desc.Name : ""), "' compilation failed for some backends");
+    }
+    m_CompileStatus = CompileStatus::Compiled;
+}
+
+String SerializableShaderImpl::CompileShaders(const ShaderCreateInfo& ShaderCI)
+{
+    // Every backend writes its own element of m_Shaders, so the shaders may be compiled in parallel.
+    // Metal shaders for both platforms share the same object and are compiled by the same task.
+    static_assert(ARCHIVE_DEVICE_DATA_FLAG_LAST == ARCHIVE_DEVICE_DATA_FLAG_METAL_IOS, "Metal flags are expected to be the last ones");
+    const auto MetalFlags = ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS | ARCHIVE_DEVICE_DATA_FLAG_METAL_IOS;
+
+    std::vector<ARCHIVE_DEVICE_DATA_FLAGS> DeviceFlagGroups;
+    for (auto Flags = m_DeviceFlags & ~MetalFlags; Flags != ARCHIVE_DEVICE_DATA_FLAG_NONE;)
+        DeviceFlagGroups.push_back(ExtractLSB(Flags));
+    if ((m_DeviceFlags & MetalFlags) != ARCHIVE_DEVICE_DATA_FLAG_NONE)
+        DeviceFlagGroups.push_back(m_DeviceFlags & MetalFlags);
+
+    // Logs are concatenated in the order of device flags, independent of the task completion order
+    std::vector<String> CompilationLogs(DeviceFlagGroups.size());
+    m_pDevice->ExecuteTasks(StaticCast<Uint32>(DeviceFlagGroups.size()),
+                            [&](Uint32 GroupIdx) //
+                            {
+                                for (auto Flags = DeviceFlagGroups[GroupIdx]; Flags != ARCHIVE_DEVICE_DATA_FLAG_NONE;)
+                                    CompileShader(GetReferenceCounters(), ShaderCI, ExtractLSB(Flags), CompilationLogs[GroupIdx]);
+                            });
 
     String CompilationLog;
+    for (const auto& Log : CompilationLogs)
+        CompilationLog += Log;
+
+    return CompilationLog;
+}
 
-    while (DeviceFlags != ARCHIVE_DEVICE_DATA_FLAG_NONE)
+bool SerializableShaderImpl::Compile()
+{
+    std::lock_guard<std::mutex> Lock{m_CompileMtx};
+    if (m_CompileStatus == CompileStatus::NotCompiled)
     {
-        auto       ShaderCI = InShaderCI;
-        const auto Flag     = ExtractLSB(DeviceFlags);
+        // The source code has been copied by CopyShaderCreateInfo(), the factory is only needed to load the included files
+        auto ShaderCI                       = m_CreateInfo;
+        ShaderCI.pShaderSourceStreamFactory = m_pSourceFactory;
 
-        static_assert(ARCHIVE_DEVICE_DATA_FLAG_LAST == ARCHIVE_DEVICE_DATA_FLAG_METAL_IOS, "Please update the switch below to handle the new device data type");
-        switch (Flag)
+        const auto CompilationLog = CompileShaders(ShaderCI);
+        if (CompilationLog.empty())
         {
+            m_CompileStatus = CompileStatus::Compiled;
+        }
+        else
+        {
+            LOG_ERROR_MESSAGE("Shader '", m_CreateInfo.Desc.Name, "' compilation failed for some backends:\n", CompilationLog);
+            m_CompileStatus = CompileStatus::Failed;
+        }
+    }
+    return m_CompileStatus == CompileStatus::Compiled;
+}
+
+SHADER_STATUS SerializableShaderImpl::GetStatus(bool WaitForCompletion)
+{
+    std::lock_guard<std::mutex> Lock{m_CompileMtx};
+    return m_CompileStatus == CompileStatus::Failed ? SHADER_STATUS_FAILED : SHADER_STATUS_READY;
+}
+
+void SerializableShaderImpl::CompileShader(IReferenceCounters*       pRefCounters,
+                                           const ShaderCreateInfo&   InShaderCI,
+                                           ARCHIVE_DEVICE_DATA_FLAGS Flag,
+                                           String&                   CompilationLog)
+{
+    auto ShaderCI = InShaderCI;
+
+    static_assert(ARCHIVE_DEVICE_DATA_FLAG_LAST == ARCHIVE_DEVICE_DATA_FLAG_METAL_IOS, "Please update the switch below to handle the new device data type");
+    switch (Flag)
+    {
 #if D3D11_SUPPORTED
-            case ARCHIVE_DEVICE_DATA_FLAG_D3D11:
-                CreateShaderD3D11(pRefCounters, ShaderCI, CompilationLog);
-                break;
+        case ARCHIVE_DEVICE_DATA_FLAG_D3D11:
+            CreateShaderD3D11(pRefCounters, ShaderCI, CompilationLog);
+            break;
 #endif
 #if D3D12_SUPPORTED
-            case ARCHIVE_DEVICE_DATA_FLAG_D3D12:
-                CreateShaderD3D12(pRefCounters, ShaderCI, CompilationLog);
-                break;
+        case ARCHIVE_DEVICE_DATA_FLAG_D3D12:
+            CreateShaderD3D12(pRefCounters, ShaderCI, CompilationLog);
+            break;
 #endif
-            case ARCHIVE_DEVICE_DATA_FLAG_GL:
-            case ARCHIVE_DEVICE_DATA_FLAG_GLES:
+        case ARCHIVE_DEVICE_DATA_FLAG_GL:
+        case ARCHIVE_DEVICE_DATA_FLAG_GLES:
 #if (GL_SUPPORTED || GLES_SUPPORTED) && !DILIGENT_NO_GLSLANG
-                ShaderCI = m_CreateInfo;
-                CreateShaderGL(pRefCounters, ShaderCI, CompilationLog, Flag == ARCHIVE_DEVICE_DATA_FLAG_GL ? RENDER_DEVICE_TYPE_GL : RENDER_DEVICE_TYPE_GLES);
+            ShaderCI = m_CreateInfo;
+            CreateShaderGL(pRefCounters, ShaderCI, CompilationLog, Flag == ARCHIVE_DEVICE_DATA_FLAG_GL ? RENDER_DEVICE_TYPE_GL : RENDER_DEVICE_TYPE_GLES);
 #endif
-                break;
+            break;
 #if VULKAN_SUPPORTED
-            case ARCHIVE_DEVICE_DATA_FLAG_VULKAN:
-                CreateShaderVk(pRefCounters, ShaderCI, CompilationLog);
-                break;
+        case ARCHIVE_DEVICE_DATA_FLAG_VULKAN:
+            CreateShaderVk(pRefCounters, ShaderCI, CompilationLog);
+            break;
 #endif
 #if METAL_SUPPORTED
-            case ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS:
-            case ARCHIVE_DEVICE_DATA_FLAG_METAL_IOS:
-                CreateShaderMtl(ShaderCI, CompilationLog);
-                break;
+        case ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS:
+        case ARCHIVE_DEVICE_DATA_FLAG_METAL_IOS:
+            CreateShaderMtl(ShaderCI, CompilationLog);
+            break;
 #endif
-            case ARCHIVE_DEVICE_DATA_FLAG_NONE:
-                UNEXPECTED("ARCHIVE_DEVICE_DATA_FLAG_NONE(0) should never occur");
-                break;
+        case ARCHIVE_DEVICE_DATA_FLAG_NONE:
+            UNEXPECTED("ARCHIVE_DEVICE_DATA_FLAG_NONE(0) should never occur");
+            break;
 
-            default:
-                LOG_ERROR_MESSAGE("Unexpected render device type");
-                break;
-        }
-    }
-
-    if (!CompilationLog.empty())
-    {
-        if (InShaderCI.ppCompilerOutput)
-        {
-            auto* pLogBlob = MakeNewRCObj<DataBlobImpl>{}(CompilationLog.size() + 1);
-            std::memcpy(pLogBlob->GetDataPtr(), CompilationLog.c_str(), CompilationLog.size() + 1);
-            pLogBlob->QueryInterface(IID_DataBlob, reinterpret_cast<IObject**>(InShaderCI.ppCompilerOutput));
-        }
-        LOG_ERROR_AND_THROW("Shader '", (InShaderCI.Desc.Name ? InShaderCI.Desc.Name : ""), "' compilation failed for some backends");
+        default:
+            LOG_ERROR_MESSAGE("Unexpected render device type");
+            break;
     }
 }
 
@@ -232,4 +305,132 @@ void SerializableShaderImpl::CopyShaderCreateInfo(const ShaderCreateInfo& Shader
 SerializableShaderImpl::~SerializableShaderImpl()
 {}
 
+namespace
+{
+
+using IncludedFileArray = std::vector<std::pair<String, RefCntAutoPtr<IDataBlob>>>;
+
+// Recursively loads the files included by the source. Returns false if an include directive
+// can not be resolved, e.g. when the file name is defined by a macro.
+bool LoadIncludedFiles(const char*                      Source,
+                       size_t                           SourceLength,
+                       IShaderSourceInputStreamFactory* pSourceFactory,
+                       IncludedFileArray&               Includes)
+{
+    static constexpr char   IncludeDirective[] = "include";
+    static constexpr size_t IncludeLen         = sizeof(IncludeDirective) - 1;
+
+    const char* const pEnd = Source + SourceLength;
+
+    const auto SkipSpaces = [pEnd](const char*& Pos) //
+    {
+        while (Pos < pEnd && (*Pos == ' ' || *Pos == '\t'))
+            ++Pos;
+    };
+
+    for (const char* Pos = Source; Pos < pEnd;)
+    {
+        SkipSpaces(Pos);
+        if (Pos < pEnd && *Pos == '#')
+        {
+            ++Pos;
+            SkipSpaces(Pos);
+            if (static_cast<size_t>(pEnd - Pos) > IncludeLen && strncmp(Pos, IncludeDirective, IncludeLen) == 0)
+            {
+                Pos += IncludeLen;
+                SkipSpaces(Pos);
+                if (Pos == pEnd || (*Pos != '"' && *Pos != '<'))
+                    return false;
+
+                const char  Terminator = *Pos == '"' ? '"' : '>';
+                const char* NameStart  = ++Pos;
+                while (Pos < pEnd && *Pos != Terminator && *Pos != '\n')
+                    ++Pos;
+                if (Pos == pEnd || *Pos != Terminator)
+                    return false;
+
+                String Name{NameStart, Pos};
+
+                const auto it = std::find_if(Includes.begin(), Includes.end(), [&Name](const IncludedFileArray::value_type& Include) { return Include.first == Name; });
+                if (it == Includes.end())
+                {
+                    if (pSourceFactory == nullptr)
+                        return false;
+
+                    RefCntAutoPtr<IFileStream> pStream;
+                    pSourceFactory->CreateInputStream(Name.c_str(), &pStream);
+                    if (!pStream)
+                        return false;
+
+                    RefCntAutoPtr<IDataBlob> pFileData{MakeNewRCObj<DataBlobImpl>{}(0)};
+                    pStream->ReadBlob(pFileData);
+                    Includes.emplace_back(std::move(Name), pFileData);
+
+                    if (!LoadIncludedFiles(static_cast<const char*>(pFileData->GetConstDataPtr()), pFileData->GetSize(), pSourceFactory, Includes))
+                        return false;
+                }
+            }
+        }
+
+        // Go to the next line
+        while (Pos < pEnd && *Pos != '\n')
+            ++Pos;
+        if (Pos < pEnd)
+            ++Pos;
+    }
+
+    return true;
+}
+
+} // namespace
+
+void SerializableShaderImpl::InitContentKey(IShaderSourceInputStreamFactory* pSourceFactory) noexcept(false)
+{
+    const auto& CI = m_CreateInfo;
+
+    // Included files are not known to the archiver, so their content is a part of the key.
+    IncludedFileArray Includes;
+    if (CI.Source != nullptr && !LoadIncludedFiles(CI.Source, CI.SourceLength, pSourceFactory, Includes))
+        return;
+
+    const auto SerializeKey = [&](auto& Ser) //
+    {
+        Ser(CI.Desc.Name, CI.Desc.ShaderType, CI.EntryPoint, CI.UseCombinedTextureSamplers, CI.CombinedSamplerSuffix,
+            CI.SourceLanguage, CI.ShaderCompiler, CI.CompileFlags,
+            CI.HLSLVersion.Major, CI.HLSLVersion.Minor,
+            CI.GLSLVersion.Major, CI.GLSLVersion.Minor,
+            CI.GLESSLVersion.Major, CI.GLESSLVersion.Minor);
+
+        const Uint64 SourceLength = CI.Source != nullptr ? CI.SourceLength : 0;
+        Ser(SourceLength);
+        Ser.SerializeBytes(CI.Source, static_cast<size_t>(SourceLength));
+
+        const Uint64 ByteCodeSize = CI.ByteCode != nullptr ? CI.ByteCodeSize : 0;
+        Ser(ByteCodeSize);
+        Ser.SerializeBytes(CI.ByteCode, static_cast<size_t>(ByteCodeSize));
+
+        if (CI.Macros != nullptr)
+        {
+            for (const auto* Macro = CI.Macros; Macro->Name != nullptr && Macro->Definition != nullptr; ++Macro)
+                Ser(Macro->Name, Macro->Definition);
+        }
+
+        for (const auto& Include : Includes)
+        {
+            const char*  Name = Include.first.c_str();
+            const Uint64 Size = Include.second->GetSize();
+            Ser(Name, Size);
+            Ser.SerializeBytes(Include.second->GetConstDataPtr(), static_cast<size_t>(Size));
+        }
+    };
+
+    Serializer<SerializerMode::Measure> MeasureSer;
+    SerializeKey(MeasureSer);
+
+    m_ContentKey = MeasureSer.AllocateData(GetRawAllocator());
+    Serializer<SerializerMode::Write> Ser{m_ContentKey};
+    SerializeKey(Ser);
+    VERIFY_EXPR(Ser.IsEnded());
+}
+
 } // namespace Diligent
@@ -61,7 +61,8 @@ static constexpr ARCHIVE_DEVICE_DATA_FLAGS GetSupportedDeviceFlags()
 SerializationDeviceImpl::SerializationDeviceImpl(IReferenceCounters* pRefCounters, const SerializationDeviceCreateInfo& CreateInfo) :
     TBase{pRefCounters},
     m_DeviceInfo{CreateInfo.DeviceInfo},
-    m_AdapterInfo{CreateInfo.AdapterInfo}
+    m_AdapterInfo{CreateInfo.AdapterInfo},
+    m_pThreadPool{CreateInfo.pThreadPool, IID_ThreadPool}
 {
 #if !DILIGENT_NO_GLSLANG
     GLSLangUtils::InitializeGlslang();
@@ -69,6 +70,8 @@ SerializationDeviceImpl::SerializationDeviceImpl(IReferenceCounters* pRefCounter
 
     m_ValidDeviceFlags = GetSupportedDeviceFlags();
 
+    DEV_CHECK_ERR(CreateInfo.pThreadPool == nullptr || m_pThreadPool, "CreateInfo.pThreadPool must implement IThreadPool interface");
+
     if (m_ValidDeviceFlags & ARCHIVE_DEVICE_DATA_FLAG_D3D11)
     {
         m_D3D11Props.FeatureLevel = (CreateInfo.D3D11.FeatureLevel.Major << 12u) | (CreateInfo.D3D11.FeatureLevel.Minor << 8u);
@@ -266,6 +269,7 @@ void SerializationDeviceImpl::GetPipelineResourceBindings(const PipelineResource
             break;
 #endif
         case RENDER_DEVICE_TYPE_UNDEFINED:
+        case RENDER_DEVICE_TYPE_NULL:
         case RENDER_DEVICE_TYPE_COUNT:
         default:
             return;
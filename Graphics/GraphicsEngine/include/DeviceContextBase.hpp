@@ -55,6 +55,8 @@ namespace Diligent
 // clang-format off
 bool VerifyDrawAttribs               (const DrawAttribs&                Attribs);
 bool VerifyDrawIndexedAttribs        (const DrawIndexedAttribs&         Attribs);
+bool VerifyMultiDrawAttribs          (const MultiDrawAttribs&           Attribs);
+bool VerifyMultiDrawIndexedAttribs   (const MultiDrawIndexedAttribs&    Attribs);
 bool VerifyDrawIndirectAttribs       (const DrawIndirectAttribs&        Attribs);
 bool VerifyDrawIndexedIndirectAttribs(const DrawIndexedIndirectAttribs& Attribs);
 
@@ -277,6 +279,18 @@ public:
         return m_FrameNumber;
     }
 
+    /// Implementation of IDeviceContext::GetStats.
+    virtual void DILIGENT_CALL_TYPE GetStats(DeviceContextStats& Stats) const override final
+    {
+        Stats = m_Stats;
+    }
+
+    /// Implementation of IDeviceContext::ResetStats.
+    virtual void DILIGENT_CALL_TYPE ResetStats() override final
+    {
+        m_Stats = {};
+    }
+
     /// Implementation of IDeviceContext::SetUserData.
     virtual void DILIGENT_CALL_TYPE SetUserData(IObject* pUserData) override final
     {
@@ -453,6 +467,12 @@ protected:
 
     inline void SetPipelineState(PipelineStateImplType* pPipelineState, int /*Dummy*/);
 
+    /// Checks if the pipeline state is ready to be bound. If the pipeline is still being
+    /// compiled asynchronously, waits until the compilation is complete. If the pipeline is
+    /// not ready after that, logs an error, resets the currently bound pipeline state and
+    /// returns false. The caller must not bind the pipeline in this case.
+    inline bool CheckPipelineStateStatus(PipelineStateImplType* pPipelineState);
+
     /// Clears all cached resources
     inline void ClearStateCache();
 
@@ -479,6 +499,7 @@ protected:
     void EndFrame()
     {
         ++m_FrameNumber;
+        ++m_Stats.FrameCount;
     }
 
     void PrepareCommittedResources(CommittedShaderResources& Resources, Uint32& DvpCompatibleSRBCount);
@@ -516,6 +537,8 @@ protected:
     // clang-format off
     void DvpVerifyDrawArguments                 (const DrawAttribs&                  Attribs) const;
     void DvpVerifyDrawIndexedArguments          (const DrawIndexedAttribs&           Attribs) const;
+    void DvpVerifyMultiDrawArguments            (const MultiDrawAttribs&             Attribs) const;
+    void DvpVerifyMultiDrawIndexedArguments     (const MultiDrawIndexedAttribs&      Attribs) const;
     void DvpVerifyDrawMeshArguments             (const DrawMeshAttribs&              Attribs) const;
     void DvpVerifyDrawIndirectArguments         (const DrawIndirectAttribs&          Attribs) const;
     void DvpVerifyDrawIndexedIndirectArguments  (const DrawIndexedIndirectAttribs&   Attribs) const;
@@ -542,6 +565,8 @@ protected:
     // clang-format off
     void DvpVerifyDrawArguments                 (const DrawAttribs&                  Attribs) const {}
     void DvpVerifyDrawIndexedArguments          (const DrawIndexedAttribs&           Attribs) const {}
+    void DvpVerifyMultiDrawArguments            (const MultiDrawAttribs&             Attribs) const {}
+    void DvpVerifyMultiDrawIndexedArguments     (const MultiDrawIndexedAttribs&      Attribs) const {}
     void DvpVerifyDrawMeshArguments             (const DrawMeshAttribs&              Attribs) const {}
     void DvpVerifyDrawIndirectArguments         (const DrawIndirectAttribs&          Attribs) const {}
     void DvpVerifyDrawIndexedIndirectArguments  (const DrawIndexedIndirectAttribs&   Attribs) const {}
@@ -660,6 +685,9 @@ protected:
 
     Uint64 m_FrameNumber = 0;
 
+    /// Command statistics, see IDeviceContext::GetStats().
+    DeviceContextStats m_Stats;
+
     RefCntAutoPtr<IObject> m_pUserData;
 
     // Must go before m_Desc!
@@ -762,6 +790,31 @@ inline void DeviceContextBase<ImplementationTraits>::SetPipelineState(
                   "PSO '", pPipelineState->GetDesc().Name, "' can't be used in device context '", m_Desc.Name, "'.");
 
     m_pPipelineState = pPipelineState;
+    ++m_Stats.PipelineStateChangeCount;
+}
+
+template <typename ImplementationTraits>
+inline bool DeviceContextBase<ImplementationTraits>::CheckPipelineStateStatus(PipelineStateImplType* pPipelineState)
+{
+    VERIFY_EXPR(pPipelineState != nullptr);
+
+    auto Status = pPipelineState->GetStatus(/*WaitForCompletion = */ false);
+    if (Status == PIPELINE_STATE_STATUS_COMPILING)
+    {
+#ifdef DILIGENT_DEVELOPMENT
+        LOG_WARNING_MESSAGE("Pipeline state '", pPipelineState->GetDesc().Name, "' is bound to device context '", m_Desc.Name,
+                            "' while it is still being compiled. The context will wait for the compilation to complete. "
+                            "Use IPipelineState::GetStatus() to check if the pipeline is ready.");
+#endif
+        Status = pPipelineState->GetStatus(/*WaitForCompletion = */ true);
+    }
+    if (Status == PIPELINE_STATE_STATUS_READY)
+        return true;
+
+    LOG_ERROR_MESSAGE("Pipeline state '", pPipelineState->GetDesc().Name, "' can't be bound to device context '", m_Desc.Name,
+                      "' because it has not been successfully initialized. Draw and dispatch commands will be rejected until a valid pipeline is set.");
+    m_pPipelineState.Release();
+    return false;
 }
 
 template <typename ImplementationTraits>
@@ -776,6 +829,8 @@ inline void DeviceContextBase<ImplementationTraits>::CommitShaderResources(
                   "Do not use RESOURCE_STATE_TRANSITION_MODE_TRANSITION or end the render pass first.");
 
     DEV_CHECK_ERR(pShaderResourceBinding != nullptr, "pShaderResourceBinding must not be null");
+
+    ++m_Stats.ShaderResourceCommitCount;
 }
 
 template <typename ImplementationTraits>
@@ -1399,6 +1454,8 @@ inline void DeviceContextBase<ImplementationTraits>::BeginRenderPass(const Begin
     // Reset current render targets (in Vulkan backend, this may end current render pass).
     ResetRenderTargets();
 
+    ++m_Stats.RenderPassCount;
+
     auto* pNewRenderPass  = ClassPtrCast<RenderPassImplType>(Attribs.pRenderPass);
     auto* pNewFramebuffer = ClassPtrCast<FramebufferImplType>(Attribs.pFramebuffer);
     if (Attribs.StateTransitionMode != RESOURCE_STATE_TRANSITION_MODE_NONE)
@@ -2154,6 +2211,41 @@ inline void DeviceContextBase<ImplementationTraits>::DvpVerifyDrawIndexedArgumen
     DEV_CHECK_ERR(VerifyDrawIndexedAttribs(Attribs), "DrawIndexedAttribs are invalid");
 }
 
+template <typename ImplementationTraits>
+inline void DeviceContextBase<ImplementationTraits>::DvpVerifyMultiDrawArguments(const MultiDrawAttribs& Attribs) const
+{
+    if ((Attribs.Flags & DRAW_FLAG_VERIFY_DRAW_ATTRIBS) == 0)
+        return;
+
+    DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(COMMAND_QUEUE_TYPE_GRAPHICS, "MultiDraw");
+
+    DEV_CHECK_ERR(m_pPipelineState, "MultiDraw command arguments are invalid: no pipeline state is bound.");
+
+    DEV_CHECK_ERR(m_pPipelineState->GetDesc().PipelineType == PIPELINE_TYPE_GRAPHICS,
+                  "MultiDraw command arguments are invalid: pipeline state '", m_pPipelineState->GetDesc().Name, "' is not a graphics pipeline.");
+
+    DEV_CHECK_ERR(VerifyMultiDrawAttribs(Attribs), "MultiDrawAttribs are invalid");
+}
+
+template <typename ImplementationTraits>
+inline void DeviceContextBase<ImplementationTraits>::DvpVerifyMultiDrawIndexedArguments(const MultiDrawIndexedAttribs& Attribs) const
+{
+    if ((Attribs.Flags & DRAW_FLAG_VERIFY_DRAW_ATTRIBS) == 0)
+        return;
+
+    DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(COMMAND_QUEUE_TYPE_GRAPHICS, "MultiDrawIndexed");
+
+    DEV_CHECK_ERR(m_pPipelineState, "MultiDrawIndexed command arguments are invalid: no pipeline state is bound.");
+
+    DEV_CHECK_ERR(m_pPipelineState->GetDesc().PipelineType == PIPELINE_TYPE_GRAPHICS,
+                  "MultiDrawIndexed command arguments are invalid: pipeline state '",
+                  m_pPipelineState->GetDesc().Name, "' is not a graphics pipeline.");
+
+    DEV_CHECK_ERR(m_pIndexBuffer, "MultiDrawIndexed command arguments are invalid: no index buffer is bound.");
+
+    DEV_CHECK_ERR(VerifyMultiDrawIndexedAttribs(Attribs), "MultiDrawIndexedAttribs are invalid");
+}
+
 template <typename ImplementationTraits>
 inline void DeviceContextBase<ImplementationTraits>::DvpVerifyDrawMeshArguments(const DrawMeshAttribs& Attribs) const
 {
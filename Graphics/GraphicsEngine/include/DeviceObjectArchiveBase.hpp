@@ -37,7 +37,16 @@
 //
 // | NamedResourceArrayHeader | --> offset --> | ***DataHeader |
 //
-// | ***DataHeader | --> offset --> | device specific data |
+// | ***DataHeader | --> blob index --> | common data, device specific data |
+//
+// | BlobTableHeader | FileOffsetAndSize[] | blob data |
+//
+// All data except for the headers is stored in the blob table. Identical blobs (e.g. the same shader byte code
+// used by different devices or the same pipeline description used by different pipelines) are stored once.
+//
+// If the archive is compressed (ArchiveHeader::Flags contains HeaderFlags::Compressed), everything that
+// follows the archive header is stored in the compressed pages (see CompressedArchiveImpl).
+// All offsets refer to the uncompressed data.
 
 #include <array>
 #include <mutex>
@@ -76,6 +85,15 @@ public:
         Count
     };
 
+    // Archive header flags
+    enum class HeaderFlags : Uint32
+    {
+        None = 0,
+
+        // The data that follows the archive header is compressed.
+        Compressed = 1u << 0
+    };
+
     using TPRSNames = std::array<const char*, MAX_RESOURCE_SIGNATURES>;
 
     struct ShaderIndexArray
@@ -110,27 +128,15 @@ public:
 
 protected:
     static constexpr Uint32 HeaderMagicNumber = 0xDE00000A;
-    static constexpr Uint32 HeaderVersion     = 2;
+    static constexpr Uint32 HeaderVersion     = 6;
     static constexpr Uint32 DataPtrAlign      = sizeof(Uint64);
 
+    static constexpr Uint32 InvalidOffset    = ~0u;
+    static constexpr Uint32 InvalidBlobIndex = ~0u;
+
     friend class ArchiverImpl;
     friend class ArchiveRepacker;
-
-    // Archive header contains the block offsets.
-    // Any block can be added or removed without patching all offsets in the archive,
-    // only the base offsets need to be patched.
-    enum class BlockOffsetType : Uint32
-    {
-        // Device-specific data
-        OpenGL,
-        Direct3D11,
-        Direct3D12,
-        Vulkan,
-        Metal_MacOS,
-        Metal_iOS,
-        Count
-    };
-    using TBlockBaseOffsets = std::array<Uint32, static_cast<size_t>(BlockOffsetType::Count)>;
+    friend class ArchiveBlobTable;
 
 #define CHECK_HEADER_SIZE(Header, Size)                                                                                                           \
     static_assert(sizeof(Header) % 8 == 0, "sizeof(" #Header ") must be a multiple of 8. Use padding to align it.");                              \
@@ -139,15 +145,26 @@ protected:
 
     struct ArchiveHeader
     {
-        Uint32            MagicNumber      = 0;
-        Uint32            Version          = 0;
-        TBlockBaseOffsets BlockBaseOffsets = {};
-        Uint32            NumChunks        = 0;
-        Uint32            _Padding         = ~0u;
+        Uint32      MagicNumber     = 0;
+        Uint32      Version         = 0;
+        Uint32      NumChunks       = 0;
+        HeaderFlags Flags           = HeaderFlags::None;
+        Uint32      BlobTableOffset = InvalidOffset; // offset to BlobTableHeader
+        Uint32      _Padding        = ~0u;
 
         //ChunkHeader     Chunks  [NumChunks]
     };
-    CHECK_HEADER_SIZE(ArchiveHeader, 40)
+    CHECK_HEADER_SIZE(ArchiveHeader, 24)
+
+    struct BlobTableHeader
+    {
+        Uint32 Count    = 0;
+        Uint32 _Padding = ~0u;
+
+        //FileOffsetAndSize Blobs[Count] // offsets are relative to the end of the table
+        //Uint8             BlobData[]
+    };
+    CHECK_HEADER_SIZE(BlobTableHeader, 8)
 
     enum class ChunkType : Uint32
     {
@@ -195,28 +212,21 @@ protected:
     {
         using Uint32Array = std::array<Uint32, static_cast<size_t>(DeviceType::Count)>;
 
-        static constexpr Uint32 InvalidOffset = ~0u;
-
         BaseDataHeader(ChunkType _Type) noexcept :
             Type{_Type}
         {
-            DeviceSpecificDataOffset.fill(Uint32{InvalidOffset});
+            DeviceSpecificDataBlob.fill(Uint32{InvalidBlobIndex});
         }
 
-        const ChunkType Type      = ChunkType::Undefined;
-        const Uint32    _Padding0 = ~0u;
+        const ChunkType Type           = ChunkType::Undefined;
+        Uint32          CommonDataBlob = InvalidBlobIndex;
 
-        Uint32Array DeviceSpecificDataSize{};
-        Uint32Array DeviceSpecificDataOffset{};
+        Uint32Array DeviceSpecificDataBlob{};
 
-        Uint32 GetSize(DeviceType DevType) const { return DeviceSpecificDataSize[static_cast<size_t>(DevType)]; }
-        Uint32 GetOffset(DeviceType DevType) const { return DeviceSpecificDataOffset[static_cast<size_t>(DevType)]; }
-        Uint32 GetEndOffset(DeviceType DevType) const { return GetOffset(DevType) + GetSize(DevType); }
-
-        void SetSize(DeviceType DevType, Uint32 Size) { DeviceSpecificDataSize[static_cast<size_t>(DevType)] = Size; }
-        void SetOffset(DeviceType DevType, Uint32 Offset) { DeviceSpecificDataOffset[static_cast<size_t>(DevType)] = Offset; }
+        Uint32 GetBlob(DeviceType DevType) const { return DeviceSpecificDataBlob[static_cast<size_t>(DevType)]; }
+        void   SetBlob(DeviceType DevType, Uint32 BlobIndex) { DeviceSpecificDataBlob[static_cast<size_t>(DevType)] = BlobIndex; }
     };
-    CHECK_HEADER_SIZE(BaseDataHeader, 56)
+    CHECK_HEADER_SIZE(BaseDataHeader, 32)
 
     struct PRSDataHeader : BaseDataHeader
     {
@@ -228,7 +238,7 @@ protected:
         //PipelineResourceSignatureDesc
         //PipelineResourceSignatureInternalData
     };
-    CHECK_HEADER_SIZE(PRSDataHeader, 56)
+    CHECK_HEADER_SIZE(PRSDataHeader, 32)
 
 
     struct PSODataHeader : BaseDataHeader
@@ -242,11 +252,22 @@ protected:
                          Type == ChunkType::TilePipelineStates));
         }
 
+        // Hash of the content key. Zero if the key is unknown.
+        Uint64 ContentHash = 0;
+
+        // Index of the blob that contains the content key: the pipeline create info, its signatures,
+        // render pass and the compilation input of its shaders that were used to produce the data.
+        // The archiver compares the keys to reuse patched shaders from the previous archive.
+        Uint32 ContentKeyBlob = InvalidBlobIndex;
+        Uint32 _Padding       = ~0u;
+
         //GraphicsPipelineStateCreateInfo | ComputePipelineStateCreateInfo | TilePipelineStateCreateInfo | RayTracingPipelineStateCreateInfo
     };
-    CHECK_HEADER_SIZE(PSODataHeader, 56)
+    CHECK_HEADER_SIZE(PSODataHeader, 48)
 
 
+    // Device-specific data of the shaders chunk is the array of the shader blob indices.
+    // Common data is not used.
     struct ShadersDataHeader : BaseDataHeader
     {
         ShadersDataHeader(ChunkType _Type = ChunkType::Shaders) noexcept :
@@ -255,7 +276,7 @@ protected:
             VERIFY_EXPR(Type == ChunkType::Shaders);
         }
     };
-    CHECK_HEADER_SIZE(ShadersDataHeader, 56)
+    CHECK_HEADER_SIZE(ShadersDataHeader, 32)
 
 
     struct RPDataHeader
@@ -266,8 +287,8 @@ protected:
             VERIFY_EXPR(Type == ChunkType::RenderPass);
         }
 
-        const ChunkType Type      = ChunkType::RenderPass;
-        const Uint32    _Padding1 = ~0u;
+        const ChunkType Type           = ChunkType::RenderPass;
+        Uint32          CommonDataBlob = InvalidBlobIndex;
     };
     CHECK_HEADER_SIZE(RPDataHeader, 8)
 
@@ -342,7 +363,9 @@ private:
 
     RefCntAutoPtr<IArchive> m_pArchive; // archive is thread-safe
     const DeviceType        m_DevType;
-    TBlockBaseOffsets       m_BaseOffsets = {};
+
+    // Absolute offsets and sizes of the blobs
+    std::vector<FileOffsetAndSize> m_Blobs;
 
     template <typename ResourceHandlerType>
     static void ReadNamedResources(IArchive*           pArchive,
@@ -354,7 +377,13 @@ private:
     void ReadShaders(const ChunkHeader& Chunk) noexcept(false);
     void ReadArchiveDebugInfo(const ChunkHeader& Chunk) noexcept(false);
 
-    BlockOffsetType GetBlockOffsetType() const;
+    // Reads the blob table and converts the blob offsets to absolute offsets in the archive.
+    static std::vector<FileOffsetAndSize> ReadBlobTable(IArchive* pArchive, Uint32 BlobTableOffset) noexcept(false);
+
+    SerializedData ReadBlob(Uint32 BlobIndex, DynamicLinearAllocator& Allocator);
+
+    // Returns the archive that reads the uncompressed data of pArchive.
+    static RefCntAutoPtr<IArchive> GetUncompressedArchive(IArchive* pArchive, const ArchiveHeader& Header) noexcept(false);
 
     static const char* ChunkTypeToResName(ChunkType Type);
 
@@ -428,8 +457,7 @@ private:
     template <typename HeaderType>
     SerializedData GetDeviceSpecificData(const HeaderType&       Header,
                                          DynamicLinearAllocator& Allocator,
-                                         const char*             ResTypeName,
-                                         BlockOffsetType         BlockType);
+                                         const char*             ResTypeName);
 
     template <typename CreateInfoType>
     bool UnpackPSOSignatures(PSOData<CreateInfoType>& PSO, IRenderDevice* pDevice);
@@ -478,7 +506,7 @@ RefCntAutoPtr<IPipelineResourceSignature> DeviceObjectArchiveBase::UnpackResourc
 
     PRS.Desc.SRBAllocationGranularity = DeArchiveInfo.SRBAllocationGranularity;
 
-    const auto Data = GetDeviceSpecificData(*PRS.pHeader, PRS.Allocator, "Resource signature", GetBlockOffsetType());
+    const auto Data = GetDeviceSpecificData(*PRS.pHeader, PRS.Allocator, "Resource signature");
     if (!Data)
         return {};
 
@@ -552,4 +580,6 @@ void DeviceObjectArchiveBase::ReadNamedResources(IArchive*           pArchive,
     }
 }
 
+DEFINE_FLAG_ENUM_OPERATORS(DeviceObjectArchiveBase::HeaderFlags)
+
 } // namespace Diligent
@@ -117,4 +117,10 @@ DECL_TRIVIALLY_SERIALIZABLE(RasterizerStateDesc);
 DECL_TRIVIALLY_SERIALIZABLE(DepthStencilStateDesc);
 DECL_TRIVIALLY_SERIALIZABLE(SampleDesc);
 
+// The following structures have no padding, so their memory layout is identical to
+// the field-by-field serialization, and arrays of them are serialized as spans.
+DECL_TRIVIALLY_SERIALIZABLE(AttachmentReference);
+DECL_TRIVIALLY_SERIALIZABLE(ShadingRateAttachment);
+DECL_TRIVIALLY_SERIALIZABLE(SubpassDependencyDesc);
+
 } // namespace Diligent
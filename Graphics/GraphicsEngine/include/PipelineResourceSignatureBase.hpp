@@ -37,6 +37,7 @@
 #include <functional>
 #include <vector>
 #include <unordered_set>
+#include <unordered_map>
 
 #include "PrivateConstants.h"
 #include "PipelineResourceSignature.h"
@@ -44,11 +45,13 @@
 #include "RenderDeviceBase.hpp"
 #include "FixedLinearAllocator.hpp"
 #include "BasicMath.hpp"
+#include "Align.hpp"
 #include "StringTools.hpp"
 #include "PlatformMisc.hpp"
 #include "SRBMemoryAllocator.hpp"
 #include "ShaderResourceCacheCommon.hpp"
 #include "HashUtils.hpp"
+#include "ResourceNameTable.hpp"
 
 #if defined(_MSC_VER) && defined(FindResource)
 #    error One of Windows headers leaks FindResource macro, which may result in odd errors. You need to undef the macro.
@@ -265,7 +268,34 @@ public:
             return nullptr;
 
         VERIFY_EXPR(static_cast<Uint32>(VarMngrInd) < GetNumStaticResStages());
-        return m_StaticVarsMgrs[VarMngrInd].GetVariable(Name);
+        const auto VarIndex = FindVariableIndex(m_StaticVarIndices[VarMngrInd], Name);
+        return VarIndex != InvalidVariableIndex ? m_StaticVarsMgrs[VarMngrInd].GetVariable(VarIndex) : nullptr;
+    }
+
+    /// Implementation of IPipelineResourceSignature::GetVariableHandle.
+    virtual ShaderVariableHandle DILIGENT_CALL_TYPE GetVariableHandle(SHADER_TYPE ShaderType,
+                                                                      const Char* Name) const override final
+    {
+        ShaderVariableHandle Handle;
+        if (!IsConsistentShaderType(ShaderType, m_PipelineType))
+        {
+            LOG_WARNING_MESSAGE("Unable to find mutable/dynamic variable '", Name, "' in shader stage ", GetShaderTypeLiteralName(ShaderType),
+                                " as the stage is invalid for ", GetPipelineTypeString(m_PipelineType), " pipeline resource signature '", this->m_Desc.Name, "'.");
+            return Handle;
+        }
+
+        const auto StageIndex = GetActiveShaderStageIndex(ShaderType);
+        if (StageIndex < 0)
+            return Handle;
+
+        const auto VarIndex = FindSRBVariableIndex(StageIndex, Name);
+        if (VarIndex == InvalidVariableIndex)
+            return Handle;
+
+        Handle.pSignature    = this;
+        Handle.StageIndex    = static_cast<Uint32>(StageIndex);
+        Handle.VariableIndex = VarIndex;
+        return Handle;
     }
 
     /// Implementation of IPipelineResourceSignature::GetStaticVariableByIndex.
@@ -293,6 +323,8 @@ public:
                                                         IResourceMapping*           pResourceMapping,
                                                         BIND_SHADER_RESOURCES_FLAGS Flags) override final
     {
+        const ResourceMappingAccessor ResMapping{pResourceMapping};
+
         const auto PipelineType = GetPipelineType();
         for (Uint32 ShaderInd = 0; ShaderInd < m_StaticResStageIndex.size(); ++ShaderInd)
         {
@@ -304,7 +336,7 @@ public:
                 const auto ShaderType = GetShaderTypeFromPipelineIndex(ShaderInd, PipelineType);
                 if (ShaderStages & ShaderType)
                 {
-                    m_StaticVarsMgrs[VarMngrInd].BindResources(pResourceMapping, Flags);
+                    m_StaticVarsMgrs[VarMngrInd].BindResources(ResMapping, Flags);
                 }
             }
         }
@@ -431,6 +463,28 @@ public:
         return SHADER_TYPE_UNKNOWN;
     }
 
+    // Returns the index of the active shader stage with the given type,
+    // or -1 if the stage is not active in this signature.
+    Int32 GetActiveShaderStageIndex(SHADER_TYPE ShaderType) const
+    {
+        VERIFY(IsPowerOfTwo(Uint32{ShaderType}), "Only single shader stage should be provided");
+        if ((m_ShaderStages & ShaderType) == 0)
+            return -1;
+
+        return static_cast<Int32>(PlatformMisc::CountOneBits(Uint32{m_ShaderStages} & (Uint32{ShaderType} - 1u)));
+    }
+
+    static constexpr Uint32 InvalidVariableIndex = ~0u;
+
+    // Returns the index of the mutable or dynamic variable with the given name in the shader variable
+    // manager of the active shader stage StageIndex, or InvalidVariableIndex if there is no such variable.
+    // The index is the same in every SRB created from this signature.
+    Uint32 FindSRBVariableIndex(Uint32 StageIndex, const Char* Name) const
+    {
+        VERIFY_EXPR(StageIndex < m_SRBVarIndices.size());
+        return FindVariableIndex(m_SRBVarIndices[StageIndex], Name);
+    }
+
     /// Finds a resource with the given name in the specified shader stage and returns its
     /// index in m_Desc.Resources[], or InvalidPipelineResourceIndex if the resource is not found.
     Uint32 FindResource(SHADER_TYPE ShaderStage, const char* ResourceName) const
@@ -452,6 +506,13 @@ public:
         return this->m_Desc.Resources[ResIndex];
     }
 
+    /// Returns the ID of the resource name in the engine-wide resource name table.
+    Uint32 GetResourceNameId(Uint32 ResIndex) const
+    {
+        VERIFY_EXPR(ResIndex < this->m_Desc.NumResources);
+        return m_pResourceNameIds[ResIndex];
+    }
+
     const ImmutableSamplerDesc& GetImmutableSamplerDesc(Uint32 SampIndex) const
     {
         VERIFY_EXPR(SampIndex < this->m_Desc.NumImmutableSamplers);
@@ -539,6 +600,7 @@ protected:
         ReserveSpaceForPipelineResourceSignatureDesc(Allocator, Desc);
 
         Allocator.AddSpace<PipelineResourceAttribsType>(Desc.NumResources);
+        Allocator.AddSpace<Uint32>(Desc.NumResources);
 
         const auto NumStaticResStages = GetNumStaticResStages();
         if (NumStaticResStages > 0)
@@ -572,6 +634,11 @@ protected:
             AllocResourceAttribs(Allocator) :
             Allocator.Allocate<PipelineResourceAttribsType>(Desc.NumResources);
 
+        // Intern resource names so that resources can be looked up in resource mappings by name IDs
+        m_pResourceNameIds = Allocator.Allocate<Uint32>(Desc.NumResources);
+        for (Uint32 i = 0; i < this->m_Desc.NumResources; ++i)
+            m_pResourceNameIds[i] = ResourceNameTable::GetInstance().Intern(this->m_Desc.Resources[i].Name);
+
         if (NumStaticResStages > 0)
         {
             m_pStaticResCache = Allocator.Construct<ShaderResourceCacheImplType>(ResourceCacheContentType::Signature);
@@ -604,6 +671,29 @@ protected:
             }
         }
 
+        // Build the name-to-index tables for static as well as mutable and dynamic variables so that
+        // variables can be found by name without traversing all variables in the stage.
+        m_StaticVarIndices.resize(NumStaticResStages);
+        for (Uint32 i = 0; i < NumStaticResStages; ++i)
+            InitVariableIndices(m_StaticVarsMgrs[i], m_StaticVarIndices[i]);
+
+        m_SRBVarIndices.resize(GetNumActiveShaderStages());
+        if (!m_SRBVarIndices.empty())
+        {
+            // SRB variables are created in the same order by every SRB, so we use a temporary
+            // variable manager to enumerate them.
+            ShaderResourceCacheImplType DummyCache{ResourceCacheContentType::SRB};
+            for (Uint32 s = 0; s < GetNumActiveShaderStages(); ++s)
+            {
+                constexpr SHADER_RESOURCE_VARIABLE_TYPE AllowedVarTypes[]{SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC};
+
+                ShaderVariableManagerImplType VarMgr{*this, DummyCache};
+                VarMgr.Initialize(*pThisImpl, RawAllocator, AllowedVarTypes, _countof(AllowedVarTypes), GetActiveShaderStageType(s));
+                InitVariableIndices(VarMgr, m_SRBVarIndices[s]);
+                VarMgr.Destroy(RawAllocator);
+            }
+        }
+
         if (Desc.SRBAllocationGranularity > 1)
         {
             std::array<size_t, MAX_SHADERS_IN_PIPELINE> ShaderVariableDataSizes = {};
@@ -743,8 +833,12 @@ protected:
 
         m_StaticResStageIndex.fill(-1);
 
+        m_StaticVarIndices.clear();
+        m_SRBVarIndices.clear();
+
         static_assert(std::is_trivially_destructible<PipelineResourceAttribsType>::value, "Destructors for m_pResourceAttribs[] are required");
         m_pResourceAttribs = nullptr;
+        m_pResourceNameIds = nullptr;
 
         m_pRawMemory.reset();
 
@@ -782,6 +876,32 @@ protected:
         return SamplerInd;
     }
 
+    using VariableIndexMap = std::unordered_map<HashMapStringKey, Uint32, HashMapStringKey::Hasher>;
+
+    static void InitVariableIndices(const ShaderVariableManagerImplType& VarMgr, VariableIndexMap& VarIndices)
+    {
+        const auto NumVars = VarMgr.GetVariableCount();
+        VarIndices.reserve(NumVars);
+        for (Uint32 v = 0; v < NumVars; ++v)
+        {
+            ShaderResourceDesc ResDesc;
+            VarMgr.GetVariable(v)->GetResourceDesc(ResDesc);
+            // Variable names point to the resource names in m_Desc that live as long as the signature.
+            const auto IsNew = VarIndices.emplace(HashMapStringKey{ResDesc.Name}, v).second;
+            VERIFY(IsNew, "Variable '", ResDesc.Name, "' is not unique in the shader stage");
+            (void)IsNew;
+        }
+    }
+
+    static Uint32 FindVariableIndex(const VariableIndexMap& VarIndices, const Char* Name)
+    {
+        auto it = VarIndices.find(HashMapStringKey{Name});
+        if (it == VarIndices.end())
+            return InvalidVariableIndex;
+
+        return it->second;
+    }
+
     void CalculateHash()
     {
         const auto* const pThisImpl = static_cast<const PipelineResourceSignatureImplType*>(this);
@@ -800,6 +920,9 @@ protected:
     // Pipeline resource attributes
     PipelineResourceAttribsType* m_pResourceAttribs = nullptr; // [m_Desc.NumResources]
 
+    // IDs of the resource names in the engine-wide resource name table
+    Uint32* m_pResourceNameIds = nullptr; // [m_Desc.NumResources]
+
     // Static resource cache for all static resources
     ShaderResourceCacheImplType* m_pStaticResCache = nullptr;
 
@@ -827,6 +950,13 @@ protected:
     // Allocator for shader resource binding object instances.
     SRBMemoryAllocator m_SRBMemAllocator;
 
+    // Variable name to variable index tables for every static variable manager [GetNumStaticResStages()].
+    std::vector<VariableIndexMap> m_StaticVarIndices;
+
+    // Variable name to variable index tables for mutable and dynamic variables
+    // of every active shader stage [GetNumActiveShaderStages()].
+    std::vector<VariableIndexMap> m_SRBVarIndices;
+
 #ifdef DILIGENT_DEBUG
     bool m_IsDestructed = false;
 #endif
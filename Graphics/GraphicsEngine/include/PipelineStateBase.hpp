@@ -31,6 +31,10 @@
 /// Implementation of the Diligent::PipelineStateBase template class
 
 #include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <cstring>
@@ -45,6 +49,8 @@
 #include "FixedLinearAllocator.hpp"
 #include "HashUtils.hpp"
 #include "PipelineResourceSignatureBase.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "ThreadPool.hpp"
 
 namespace Diligent
 {
@@ -296,6 +302,198 @@ private:
     // NB: when adding new members, don't forget to update move ctor!
 };
 
+
+/// Calls Handler for every non-null shader used by the graphics pipeline.
+template <typename HandlerType>
+void ForEachPipelineShader(const GraphicsPipelineStateCreateInfo& CreateInfo, HandlerType&& Handler)
+{
+    for (auto* pShader : {CreateInfo.pVS, CreateInfo.pPS, CreateInfo.pDS, CreateInfo.pHS, CreateInfo.pGS, CreateInfo.pAS, CreateInfo.pMS})
+    {
+        if (pShader != nullptr)
+            Handler(pShader);
+    }
+}
+
+/// Calls Handler for the compute shader used by the compute pipeline.
+template <typename HandlerType>
+void ForEachPipelineShader(const ComputePipelineStateCreateInfo& CreateInfo, HandlerType&& Handler)
+{
+    if (CreateInfo.pCS != nullptr)
+        Handler(CreateInfo.pCS);
+}
+
+/// Calls Handler for every non-null shader in every shader group of the ray tracing pipeline.
+/// Note that the same shader may be used by multiple groups.
+template <typename HandlerType>
+void ForEachPipelineShader(const RayTracingPipelineStateCreateInfo& CreateInfo, HandlerType&& Handler)
+{
+    auto ProcessShader = [&Handler](IShader* pShader) {
+        if (pShader != nullptr)
+            Handler(pShader);
+    };
+    for (Uint32 i = 0; i < CreateInfo.GeneralShaderCount; ++i)
+    {
+        ProcessShader(CreateInfo.pGeneralShaders[i].pShader);
+    }
+    for (Uint32 i = 0; i < CreateInfo.TriangleHitShaderCount; ++i)
+    {
+        ProcessShader(CreateInfo.pTriangleHitShaders[i].pClosestHitShader);
+        ProcessShader(CreateInfo.pTriangleHitShaders[i].pAnyHitShader);
+    }
+    for (Uint32 i = 0; i < CreateInfo.ProceduralHitShaderCount; ++i)
+    {
+        ProcessShader(CreateInfo.pProceduralHitShaders[i].pIntersectionShader);
+        ProcessShader(CreateInfo.pProceduralHitShaders[i].pClosestHitShader);
+        ProcessShader(CreateInfo.pProceduralHitShaders[i].pAnyHitShader);
+    }
+}
+
+/// Calls Handler for the tile shader used by the tile pipeline.
+template <typename HandlerType>
+void ForEachPipelineShader(const TilePipelineStateCreateInfo& CreateInfo, HandlerType&& Handler)
+{
+    if (CreateInfo.pTS != nullptr)
+        Handler(CreateInfo.pTS);
+}
+
+
+/// Owns a deep copy of the pipeline state create info that remains valid
+/// after the pipeline state creation method returns.
+///
+/// \remarks   The wrapper keeps strong references to the shaders, resource signatures,
+///             render pass and pipeline state cache referenced by the create info.
+template <typename PSOCreateInfoType>
+class PipelineStateCreateInfoWrapper
+{
+public:
+    PipelineStateCreateInfoWrapper(const PipelineStateCreateInfoWrapper&) = delete;
+    PipelineStateCreateInfoWrapper(PipelineStateCreateInfoWrapper&&)      = delete;
+    PipelineStateCreateInfoWrapper& operator=(const PipelineStateCreateInfoWrapper&) = delete;
+    PipelineStateCreateInfoWrapper& operator=(PipelineStateCreateInfoWrapper&&) = delete;
+
+    explicit PipelineStateCreateInfoWrapper(const PSOCreateInfoType& CreateInfo) :
+        m_CreateInfo{CreateInfo}
+    {
+        auto& PSODesc = m_CreateInfo.PSODesc;
+        PSODesc.Name  = CopyString(PSODesc.Name);
+
+        auto& ResLayout = PSODesc.ResourceLayout;
+        if (ResLayout.Variables != nullptr)
+        {
+            m_Variables.assign(ResLayout.Variables, ResLayout.Variables + ResLayout.NumVariables);
+            for (auto& Var : m_Variables)
+                Var.Name = CopyString(Var.Name);
+            ResLayout.Variables = m_Variables.data();
+        }
+        if (ResLayout.ImmutableSamplers != nullptr)
+        {
+            m_ImmutableSamplers.assign(ResLayout.ImmutableSamplers, ResLayout.ImmutableSamplers + ResLayout.NumImmutableSamplers);
+            for (auto& ImtblSam : m_ImmutableSamplers)
+            {
+                ImtblSam.SamplerOrTextureName = CopyString(ImtblSam.SamplerOrTextureName);
+                ImtblSam.Desc.Name            = CopyString(ImtblSam.Desc.Name);
+            }
+            ResLayout.ImmutableSamplers = m_ImmutableSamplers.data();
+        }
+
+        if (m_CreateInfo.ppResourceSignatures != nullptr)
+        {
+            m_ppSignatures.assign(m_CreateInfo.ppResourceSignatures, m_CreateInfo.ppResourceSignatures + m_CreateInfo.ResourceSignaturesCount);
+            for (auto* pSignature : m_ppSignatures)
+                AddObject(pSignature);
+            m_CreateInfo.ppResourceSignatures = m_ppSignatures.data();
+        }
+
+        AddObject(m_CreateInfo.pPSOCache);
+
+        if (m_CreateInfo.pInternalData != nullptr)
+        {
+            m_InternalInfo             = *static_cast<const PSOCreateInternalInfo*>(m_CreateInfo.pInternalData);
+            m_CreateInfo.pInternalData = &m_InternalInfo;
+        }
+
+        CopyPipelineData(m_CreateInfo);
+
+        ForEachPipelineShader(m_CreateInfo, [this](IShader* pShader) { AddObject(pShader); });
+    }
+
+    operator const PSOCreateInfoType&() const
+    {
+        return m_CreateInfo;
+    }
+
+private:
+    const char* CopyString(const char* Str)
+    {
+        return Str != nullptr ? m_StringPool.emplace(Str).first->c_str() : nullptr;
+    }
+
+    void AddObject(IObject* pObject)
+    {
+        if (pObject != nullptr)
+            m_Objects.emplace_back(pObject);
+    }
+
+    void CopyPipelineData(GraphicsPipelineStateCreateInfo& CreateInfo)
+    {
+        auto& InputLayout = CreateInfo.GraphicsPipeline.InputLayout;
+        if (InputLayout.LayoutElements != nullptr)
+        {
+            m_LayoutElements.assign(InputLayout.LayoutElements, InputLayout.LayoutElements + InputLayout.NumElements);
+            for (auto& Elem : m_LayoutElements)
+                Elem.HLSLSemantic = CopyString(Elem.HLSLSemantic);
+            InputLayout.LayoutElements = m_LayoutElements.data();
+        }
+        AddObject(CreateInfo.GraphicsPipeline.pRenderPass);
+    }
+
+    void CopyPipelineData(ComputePipelineStateCreateInfo&) {}
+
+    void CopyPipelineData(TilePipelineStateCreateInfo&) {}
+
+    void CopyPipelineData(RayTracingPipelineStateCreateInfo& CreateInfo)
+    {
+        if (CreateInfo.pGeneralShaders != nullptr)
+        {
+            m_GeneralShaders.assign(CreateInfo.pGeneralShaders, CreateInfo.pGeneralShaders + CreateInfo.GeneralShaderCount);
+            for (auto& Group : m_GeneralShaders)
+                Group.Name = CopyString(Group.Name);
+            CreateInfo.pGeneralShaders = m_GeneralShaders.data();
+        }
+        if (CreateInfo.pTriangleHitShaders != nullptr)
+        {
+            m_TriangleHitShaders.assign(CreateInfo.pTriangleHitShaders, CreateInfo.pTriangleHitShaders + CreateInfo.TriangleHitShaderCount);
+            for (auto& Group : m_TriangleHitShaders)
+                Group.Name = CopyString(Group.Name);
+            CreateInfo.pTriangleHitShaders = m_TriangleHitShaders.data();
+        }
+        if (CreateInfo.pProceduralHitShaders != nullptr)
+        {
+            m_ProceduralHitShaders.assign(CreateInfo.pProceduralHitShaders, CreateInfo.pProceduralHitShaders + CreateInfo.ProceduralHitShaderCount);
+            for (auto& Group : m_ProceduralHitShaders)
+                Group.Name = CopyString(Group.Name);
+            CreateInfo.pProceduralHitShaders = m_ProceduralHitShaders.data();
+        }
+        CreateInfo.pShaderRecordName = CopyString(CreateInfo.pShaderRecordName);
+    }
+
+private:
+    PSOCreateInfoType m_CreateInfo;
+
+    std::unordered_set<String>               m_StringPool;
+    std::vector<ShaderResourceVariableDesc>  m_Variables;
+    std::vector<ImmutableSamplerDesc>        m_ImmutableSamplers;
+    std::vector<IPipelineResourceSignature*> m_ppSignatures;
+    std::vector<RefCntAutoPtr<IObject>>      m_Objects;
+    PSOCreateInternalInfo                    m_InternalInfo;
+
+    std::vector<LayoutElement> m_LayoutElements;
+
+    std::vector<RayTracingGeneralShaderGroup>       m_GeneralShaders;
+    std::vector<RayTracingTriangleHitShaderGroup>   m_TriangleHitShaders;
+    std::vector<RayTracingProceduralHitShaderGroup> m_ProceduralHitShaders;
+};
+
 /// Template class implementing base functionality of the pipeline state object.
 
 /// \tparam EngineImplTraits - Engine implementation type traits.
@@ -375,6 +573,7 @@ public:
         DSSRegistry.ReportDeletedObject();
         */
         VERIFY(m_IsDestructed, "This object must be explicitly destructed with Destruct()");
+        VERIFY(!m_pAsyncTask || m_pAsyncTask->IsFinished(), "Asynchronous initialization task must be cancelled by the derived class destructor");
     }
 
     void Destruct()
@@ -488,6 +687,8 @@ public:
     {
         *ppShaderResourceBinding = nullptr;
 
+        DvpVerifyStatus("CreateShaderResourceBinding");
+
         if (!m_UsingImplicitSignature)
         {
             LOG_ERROR_MESSAGE("IPipelineState::CreateShaderResourceBinding is not allowed for pipelines that use explicit "
@@ -501,6 +702,8 @@ public:
     virtual IShaderResourceVariable* DILIGENT_CALL_TYPE GetStaticVariableByName(SHADER_TYPE ShaderType,
                                                                                 const Char* Name) override final
     {
+        DvpVerifyStatus("GetStaticVariableByName");
+
         if (!m_UsingImplicitSignature)
         {
             LOG_ERROR_MESSAGE("IPipelineState::GetStaticVariableByName is not allowed for pipelines that use explicit "
@@ -521,6 +724,8 @@ public:
     virtual IShaderResourceVariable* DILIGENT_CALL_TYPE GetStaticVariableByIndex(SHADER_TYPE ShaderType,
                                                                                  Uint32      Index) override final
     {
+        DvpVerifyStatus("GetStaticVariableByIndex");
+
         if (!m_UsingImplicitSignature)
         {
             LOG_ERROR_MESSAGE("IPipelineState::GetStaticVariableByIndex is not allowed for pipelines that use explicit "
@@ -540,6 +745,8 @@ public:
 
     virtual Uint32 DILIGENT_CALL_TYPE GetStaticVariableCount(SHADER_TYPE ShaderType) const override final
     {
+        DvpVerifyStatus("GetStaticVariableCount");
+
         if (!m_UsingImplicitSignature)
         {
             LOG_ERROR_MESSAGE("IPipelineState::GetStaticVariableCount is not allowed for pipelines that use explicit "
@@ -561,6 +768,8 @@ public:
                                                         IResourceMapping*           pResourceMapping,
                                                         BIND_SHADER_RESOURCES_FLAGS Flags) override final
     {
+        DvpVerifyStatus("BindStaticResources");
+
         if (!m_UsingImplicitSignature)
         {
             LOG_ERROR_MESSAGE("IPipelineState::BindStaticResources is not allowed for pipelines that use explicit "
@@ -573,6 +782,8 @@ public:
 
     virtual void DILIGENT_CALL_TYPE InitializeStaticSRBResources(IShaderResourceBinding* pSRB) const override final
     {
+        DvpVerifyStatus("InitializeStaticSRBResources");
+
         if (!m_UsingImplicitSignature)
         {
             LOG_ERROR_MESSAGE("IPipelineState::InitializeStaticSRBResources is not allowed for pipelines that use explicit "
@@ -627,6 +838,51 @@ public:
         return m_ActiveShaderStages;
     }
 
+    /// Implementation of IPipelineState::GetStatus().
+    virtual PIPELINE_STATE_STATUS DILIGENT_CALL_TYPE GetStatus(bool WaitForCompletion) override final
+    {
+        auto Status = m_Status.load();
+        if (WaitForCompletion && Status == PIPELINE_STATE_STATUS_COMPILING)
+        {
+            // If the initialization task has not been started yet, take it from the queue
+            // and initialize the pipeline in this thread.
+            if (m_pAsyncTask &&
+                this->m_pDevice->GetShaderCompilationThreadPool()->RemoveTask(m_pAsyncTask, false) &&
+                !m_pAsyncTask->IsFinished())
+            {
+                m_pAsyncTask->SetStatus(ASYNC_TASK_STATUS_RUNNING);
+                RunAsyncInitializer();
+                m_pAsyncTask->SetStatus(ASYNC_TASK_STATUS_COMPLETE);
+            }
+
+            while (Status == PIPELINE_STATE_STATUS_COMPILING)
+            {
+                std::this_thread::yield();
+                Status = m_Status.load();
+            }
+        }
+        return Status;
+    }
+
+    /// Enqueues the asynchronous initialization task prepared by ConstructPipeline(), if any.
+
+    /// \remarks   This method is called by the render device after the pipeline state object is fully
+    ///             constructed and a strong reference to it is held by the caller.
+    void EnqueueAsyncInitialization()
+    {
+        if (!m_AsyncInitializer)
+            return;
+
+        VERIFY_EXPR(m_Status.load() == PIPELINE_STATE_STATUS_COMPILING);
+        // Do not keep a strong reference to the pipeline in the task: the pipeline waits
+        // for the task in its destructor.
+        m_pAsyncTask = EnqueueAsyncWork(this->m_pDevice->GetShaderCompilationThreadPool(),
+                                        [this](Uint32 ThreadId) //
+                                        {
+                                            RunAsyncInitializer();
+                                        });
+    }
+
 protected:
     using TNameToGroupIndexMap = std::unordered_map<HashMapStringKey, Uint32, HashMapStringKey::Hasher>;
 
@@ -855,6 +1111,53 @@ protected:
         ExtractShaders<ShaderImplType>(PSOCreateInfo, ShaderStages, m_ActiveShaderStages);
     }
 
+    /// Initializes the pipeline using the InitializePipeline function.
+
+    /// \param CreateInfo         - Pipeline state create info.
+    /// \param InitializePipeline - Function that takes const PSOCreateInfoType& and initializes the pipeline.
+    ///
+    /// \remarks   If PSO_CREATE_FLAG_ASYNCHRONOUS flag is set and the device has a shader
+    ///             compilation thread pool, the function makes a copy of the create info and defers
+    ///             the initialization until EnqueueAsyncInitialization() is called.
+    ///             Otherwise, the pipeline is initialized synchronously.
+    ///             In both cases, the pipeline waits for all its shaders to be compiled before initialization.
+    template <typename PSOCreateInfoType, typename HandlerType>
+    void ConstructPipeline(const PSOCreateInfoType& CreateInfo, HandlerType InitializePipeline) noexcept(false)
+    {
+        if ((CreateInfo.Flags & PSO_CREATE_FLAG_ASYNCHRONOUS) != 0 &&
+            this->m_pDevice->GetShaderCompilationThreadPool() != nullptr)
+        {
+            auto pCreateInfo = std::make_shared<PipelineStateCreateInfoWrapper<PSOCreateInfoType>>(CreateInfo);
+            // m_Desc.ResourceLayout references the memory provided by the application
+            this->m_Desc.ResourceLayout = static_cast<const PSOCreateInfoType&>(*pCreateInfo).PSODesc.ResourceLayout;
+
+            m_AsyncInitializer = [pCreateInfo, InitializePipeline]() {
+                const PSOCreateInfoType& AsyncCreateInfo = *pCreateInfo;
+                WaitForShaders(AsyncCreateInfo);
+                InitializePipeline(AsyncCreateInfo);
+            };
+            m_Status.store(PIPELINE_STATE_STATUS_COMPILING);
+        }
+        else
+        {
+            WaitForShaders(CreateInfo);
+            InitializePipeline(CreateInfo);
+            m_Status.store(PIPELINE_STATE_STATUS_READY);
+        }
+    }
+
+    /// Removes the asynchronous initialization task from the queue or waits until it is complete.
+    /// Every derived class must call this method in its destructor before Destruct().
+    void CancelAsyncInitialization()
+    {
+        if (!m_pAsyncTask)
+            return;
+
+        if (!this->m_pDevice->GetShaderCompilationThreadPool()->RemoveTask(m_pAsyncTask, false))
+            m_pAsyncTask->WaitForCompletion();
+        m_pAsyncTask.Release();
+    }
+
     void InitializePipelineDesc(const GraphicsPipelineStateCreateInfo& CreateInfo,
                                 FixedLinearAllocator&                  MemPool)
     {
@@ -1135,6 +1438,48 @@ protected:
     }
 
 private:
+    // Pipeline resources can't be accessed until the pipeline is initialized.
+    void DvpVerifyStatus(const char* MethodName) const
+    {
+        DEV_CHECK_ERR(m_Status.load() == PIPELINE_STATE_STATUS_READY, "IPipelineState::", MethodName, " must not be called for pipeline state '",
+                      this->m_Desc.Name, "' that is not ready. Use IPipelineState::GetStatus() to check if the pipeline is ready.");
+    }
+
+    // Runs the initialization prepared by ConstructPipeline(). This is done either by the thread pool
+    // or by GetStatus() after the task has been removed from the queue, but never by both.
+    void RunAsyncInitializer()
+    {
+        try
+        {
+            m_AsyncInitializer();
+            // Release the create info copy and the references it holds
+            m_AsyncInitializer = nullptr;
+            m_Status.store(PIPELINE_STATE_STATUS_READY);
+        }
+        catch (...)
+        {
+            // Keep the create info copy as m_Desc.ResourceLayout may still reference it.
+            // The object will be destructed when it is released.
+            LOG_ERROR_MESSAGE("Failed to create pipeline state '", this->m_Desc.Name, "'.");
+            m_Status.store(PIPELINE_STATE_STATUS_FAILED);
+        }
+    }
+
+    // Waits for the shaders of the pipeline. Shaders whose compilation tasks have not been
+    // started yet are compiled in the calling thread (see ShaderBase::GetStatus()), so
+    // a pipeline task never waits for a task that is still in the thread pool queue.
+    template <typename PSOCreateInfoType>
+    static void WaitForShaders(const PSOCreateInfoType& CreateInfo) noexcept(false)
+    {
+        ForEachPipelineShader(CreateInfo, [](IShader* pShader) {
+            if (pShader->GetStatus(/*WaitForCompletion = */ true) != SHADER_STATUS_READY)
+            {
+                const auto* Name = pShader->GetDesc().Name;
+                LOG_ERROR_AND_THROW("Shader '", (Name != nullptr ? Name : ""), "' has not been successfully compiled.");
+            }
+        });
+    }
+
     static void ReserveResourceLayout(const PipelineResourceLayoutDesc& SrcLayout, FixedLinearAllocator& MemPool) noexcept
     {
         if (SrcLayout.Variables != nullptr)
@@ -1329,6 +1674,11 @@ protected:
         void*                   m_pPipelineDataRawMem = nullptr;
     };
 
+    std::atomic<PIPELINE_STATE_STATUS> m_Status{PIPELINE_STATE_STATUS_UNINITIALIZED};
+
+    std::function<void()>     m_AsyncInitializer;
+    RefCntAutoPtr<IAsyncTask> m_pAsyncTask;
+
 #ifdef DILIGENT_DEBUG
     bool m_IsDestructed = false;
 #endif
@@ -44,6 +44,7 @@
 #include "EngineMemory.h"
 #include "STDAllocator.hpp"
 #include "IndexWrapper.hpp"
+#include "ThreadPool.hpp"
 
 namespace std
 {
@@ -329,6 +330,30 @@ public:
                 TEX_FORMAT_B5G6R5_UNORM};
         for (Uint32 fmt = 0; fmt < _countof(FilterableFormats); ++fmt)
             m_TextureFormatsInfo[FilterableFormats[fmt]].Filterable = true;
+
+        // Note that the features are not yet known at this point, so we use
+        // the same rules as EnableDeviceFeatures().
+        const auto AsyncCompilationSupport = AdapterInfo.Features.AsyncShaderCompilation;
+        const auto EnableAsyncCompilation  = EngineCI.Features.AsyncShaderCompilation != DEVICE_FEATURE_STATE_DISABLED ?
+            AsyncCompilationSupport != DEVICE_FEATURE_STATE_DISABLED :
+            AsyncCompilationSupport == DEVICE_FEATURE_STATE_ENABLED;
+        if (EnableAsyncCompilation)
+        {
+            if (EngineCI.pAsyncShaderCompilationThreadPool != nullptr)
+            {
+                m_pShaderCompilationThreadPool = RefCntAutoPtr<IThreadPool>{EngineCI.pAsyncShaderCompilationThreadPool, IID_ThreadPool};
+                DEV_CHECK_ERR(m_pShaderCompilationThreadPool, "The object provided through EngineCI.pAsyncShaderCompilationThreadPool does not implement the IThreadPool interface");
+            }
+
+            if (!m_pShaderCompilationThreadPool)
+            {
+                ThreadPoolCreateInfo ThreadPoolCI;
+                ThreadPoolCI.NumThreads = EngineCI.NumAsyncShaderCompilationThreads != 0xFFFFFFFFU ?
+                    EngineCI.NumAsyncShaderCompilationThreads :
+                    std::max(std::thread::hardware_concurrency(), 2u) - 1u;
+                m_pShaderCompilationThreadPool = CreateThreadPool(ThreadPoolCI);
+            }
+        }
     }
 
     ~RenderDeviceBase()
@@ -455,6 +480,13 @@ public:
         return m_DeviceInfo.Features;
     }
 
+    /// Returns the thread pool that is used to asynchronously compile shaders and pipeline
+    /// states, or null if DeviceFeatures::AsyncShaderCompilation is disabled.
+    IThreadPool* GetShaderCompilationThreadPool() const
+    {
+        return m_pShaderCompilationThreadPool.RawPtr<IThreadPool>();
+    }
+
 protected:
     virtual void TestTextureFormat(TEXTURE_FORMAT TexFormat) = 0;
 
@@ -521,6 +553,7 @@ protected:
                            {
                                auto* pPipelineStateImpl{NEW_RC_OBJ(m_PSOAllocator, "Pipeline State instance", PipelineStateImplType)(static_cast<RenderDeviceImplType*>(this), PSOCreateInfo, ExtraArgs...)};
                                pPipelineStateImpl->QueryInterface(IID_PipelineState, reinterpret_cast<IObject**>(ppPipelineState));
+                               pPipelineStateImpl->EnqueueAsyncInitialization();
                            });
     }
 
@@ -556,6 +589,7 @@ protected:
                            {
                                auto* pShaderImpl{NEW_RC_OBJ(m_ShaderObjAllocator, "Shader instance", ShaderImplType)(static_cast<RenderDeviceImplType*>(this), ShaderCI, ExtraArgs...)};
                                pShaderImpl->QueryInterface(IID_Shader, reinterpret_cast<IObject**>(ppShader));
+                               pShaderImpl->EnqueueAsyncInitialization();
                            });
     }
 
@@ -723,6 +757,11 @@ protected:
     FixedBlockMemoryAllocator m_PipeResSignAllocator; ///< Allocator for pipeline resource signature objects
     FixedBlockMemoryAllocator m_MemObjAllocator;      ///< Allocator for device memory objects
     FixedBlockMemoryAllocator m_PSOCacheAllocator;    ///< Allocator for pipeline state cache objects
+
+    /// Thread pool for asynchronous shader and pipeline state compilation.
+    /// All shaders and pipeline states hold strong references to the device and
+    /// wait for their tasks in destructors, so the pool is idle when it is released.
+    RefCntAutoPtr<IThreadPool> m_pShaderCompilationThreadPool;
 };
 
 } // namespace Diligent
@@ -37,13 +37,21 @@
 #include "HashUtils.hpp"
 #include "STDAllocator.hpp"
 #include "RefCntAutoPtr.hpp"
+#include "ResourceNameTable.hpp"
 
 namespace Diligent
 {
 
 class FixedBlockMemoryAllocator;
 
+// {A1F9E6C7-3B52-4D0A-9C8E-5F2B7D41E3A6}
+static const INTERFACE_ID IID_ResourceMappingImpl =
+    {0xa1f9e6c7, 0x3b52, 0x4d0a, {0x9c, 0x8e, 0x5f, 0x2b, 0x7d, 0x41, 0xe3, 0xa6}};
+
 /// Implementation of the resource mapping
+
+/// Resources are keyed by the ID of their interned name (see Diligent::ResourceNameTable)
+/// and the array index, so that they can be looked up without string hashing or comparison.
 class ResourceMappingImpl : public ObjectBase<IResourceMapping>
 {
 public:
@@ -58,7 +66,22 @@ public:
 
     ~ResourceMappingImpl();
 
-    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_ResourceMapping, TObjectBase)
+    virtual void DILIGENT_CALL_TYPE QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface) override final
+    {
+        if (ppInterface == nullptr)
+            return;
+
+        // IID_ResourceMappingImpl is used by the engine to access the name-ID based look-up
+        if (IID == IID_ResourceMapping || IID == IID_ResourceMappingImpl)
+        {
+            *ppInterface = this;
+            (*ppInterface)->AddRef();
+        }
+        else
+        {
+            TObjectBase::QueryInterface(IID, ppInterface);
+        }
+    }
 
     /// Implementation of IResourceMapping::AddResource()
     virtual void DILIGENT_CALL_TYPE AddResource(const Char*    Name,
@@ -82,43 +105,31 @@ public:
     /// Returns number of resources in the resource mapping.
     virtual size_t DILIGENT_CALL_TYPE GetSize() override final;
 
+    /// Returns the resource with the given interned name ID (see Diligent::ResourceNameTable).
+    IDeviceObject* GetResource(Uint32 NameId, Uint32 ArrayIndex);
+
 private:
-    struct ResMappingHashKey : public HashMapStringKey
+    struct ResMappingHashKey
     {
-        using TBase = HashMapStringKey;
+        ResMappingHashKey(Uint32 _NameId, Uint32 _ArrayIndex) noexcept :
+            NameId{_NameId},
+            ArrayIndex{_ArrayIndex}
+        {}
 
-        ResMappingHashKey(const Char* Str, bool bMakeCopy, Uint32 ArrInd) noexcept :
-            HashMapStringKey{Str, bMakeCopy},
-            ArrayIndex{ArrInd}
+        bool operator==(const ResMappingHashKey& RHS) const
         {
-            Ownership_Hash = (ComputeHash(GetHash(), ArrInd) & HashMask) | (Ownership_Hash & StrOwnershipMask);
+            return NameId == RHS.NameId && ArrayIndex == RHS.ArrayIndex;
         }
 
-        ResMappingHashKey(ResMappingHashKey&& rhs) noexcept :
-            HashMapStringKey{std::move(rhs)},
-            ArrayIndex{rhs.ArrayIndex}
-        {}
-
-        // clang-format off
-        ResMappingHashKey             ( const ResMappingHashKey& ) = delete;
-        ResMappingHashKey& operator = ( const ResMappingHashKey& ) = delete;
-        ResMappingHashKey& operator = ( ResMappingHashKey&& )      = delete;
-        // clang-format on
-
-        bool operator==(const ResMappingHashKey& RHS) const
+        struct Hasher
         {
-            if (ArrayIndex != RHS.ArrayIndex)
+            size_t operator()(const ResMappingHashKey& Key) const
             {
-                // We must check array index first because TBase::operator==()
-                // expects that if the hashes are different, the strings must be
-                // different too. This will not be the case for different array
-                // elements of the same variable.
-                return false;
+                return ComputeHash(Key.NameId, Key.ArrayIndex);
             }
+        };
 
-            return static_cast<const TBase&>(*this) == static_cast<const TBase&>(RHS);
-        }
-
+        const Uint32 NameId;
         const Uint32 ArrayIndex;
     };
 
@@ -135,4 +146,37 @@ private:
         m_HashTable;
 };
 
+/// Helper class that looks up resources in the resource mapping provided to the
+/// IShaderResourceBinding::BindResources() and similar methods.
+
+/// If the mapping is implemented by the engine, resources are looked up by their interned name IDs.
+/// Otherwise, the look-up falls back to IResourceMapping::GetResource().
+class ResourceMappingAccessor
+{
+public:
+    explicit ResourceMappingAccessor(IResourceMapping* pMapping) :
+        m_pMapping{pMapping},
+        m_pMappingImpl{pMapping, IID_ResourceMappingImpl}
+    {}
+
+    // clang-format off
+    ResourceMappingAccessor           (const ResourceMappingAccessor&) = delete;
+    ResourceMappingAccessor& operator=(const ResourceMappingAccessor&) = delete;
+    // clang-format on
+
+    IDeviceObject* GetResource(Uint32 NameId, const Char* Name, Uint32 ArrayIndex) const
+    {
+        VERIFY_EXPR(m_pMapping != nullptr);
+        return m_pMappingImpl ?
+            m_pMappingImpl.RawPtr<ResourceMappingImpl>()->GetResource(NameId, ArrayIndex) :
+            m_pMapping->GetResource(Name, ArrayIndex);
+    }
+
+    explicit operator bool() const { return m_pMapping != nullptr; }
+
+private:
+    IResourceMapping* const            m_pMapping;
+    RefCntAutoPtr<ResourceMappingImpl> m_pMappingImpl;
+};
+
 } // namespace Diligent
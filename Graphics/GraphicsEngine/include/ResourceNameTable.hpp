@@ -0,0 +1,90 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of the Diligent::ResourceNameTable class
+
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "BasicTypes.h"
+#include "HashUtils.hpp"
+
+namespace Diligent
+{
+
+/// Engine-wide table of interned resource names.
+
+/// Every distinct name added to the table is assigned a stable non-zero ID that remains
+/// valid for the lifetime of the process. Pipeline resource signatures intern the names
+/// of their resources when they are created, and resource mappings are keyed by the name IDs.
+/// This way resources can be bound from a mapping without hashing or comparing strings.
+///
+/// Look-ups (Find, GetName) only take a shared lock and run concurrently with each other;
+/// exclusive access is only required when a new name is added.
+///
+/// \remarks   Names are never removed from the table, so its size is bounded by the number of
+///             distinct resource names the application uses (typically a few thousand at most).
+///             Every name costs one heap-allocated copy of the string plus a hash map entry.
+///             Applications that generate unique names at run time (e.g. by appending a counter)
+///             grow the table indefinitely and should use array indices instead.
+class ResourceNameTable
+{
+public:
+    /// ID that is never assigned to any name.
+    static constexpr Uint32 InvalidNameId = 0;
+
+    /// Returns the engine-wide instance of the table.
+    static ResourceNameTable& GetInstance();
+
+    /// Returns the ID of the given name, adding the name to the table if necessary.
+    Uint32 Intern(const Char* Name);
+
+    /// Returns the ID of the given name, or InvalidNameId if the name has never been interned.
+    Uint32 Find(const Char* Name) const;
+
+    /// Returns the name with the given ID, or nullptr if the ID is invalid.
+    const Char* GetName(Uint32 NameId) const;
+
+    /// Returns the number of interned names.
+    size_t GetSize() const;
+
+private:
+    ResourceNameTable() {}
+
+    mutable std::shared_timed_mutex m_Mtx;
+
+    // Name -> ID map. The keys own the copies of the strings.
+    std::unordered_map<HashMapStringKey, Uint32, HashMapStringKey::Hasher> m_NameToId;
+
+    // Interned names indexed by ID - 1.
+    std::vector<const Char*> m_Names;
+};
+
+} // namespace Diligent
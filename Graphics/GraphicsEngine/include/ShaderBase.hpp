@@ -30,6 +30,12 @@
 /// \file
 /// Implementation of the Diligent::ShaderBase template class
 
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <unordered_set>
 #include <vector>
 
 #include "Shader.h"
@@ -38,10 +44,84 @@
 #include "PlatformMisc.hpp"
 #include "EngineMemory.h"
 #include "Align.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "ThreadPool.hpp"
 
 namespace Diligent
 {
 
+/// Owns a deep copy of the shader create info that remains valid
+/// after IRenderDevice::CreateShader() returns.
+///
+/// \remarks   Compiler output and conversion stream pointers are not preserved.
+class ShaderCreateInfoWrapper
+{
+public:
+    ShaderCreateInfoWrapper(const ShaderCreateInfoWrapper&) = delete;
+    ShaderCreateInfoWrapper(ShaderCreateInfoWrapper&&)      = delete;
+    ShaderCreateInfoWrapper& operator=(const ShaderCreateInfoWrapper&) = delete;
+    ShaderCreateInfoWrapper& operator=(ShaderCreateInfoWrapper&&) = delete;
+
+    explicit ShaderCreateInfoWrapper(const ShaderCreateInfo& ShaderCI) :
+        m_CreateInfo{ShaderCI},
+        m_pSourceStreamFactory{ShaderCI.pShaderSourceStreamFactory}
+    {
+        m_CreateInfo.FilePath              = CopyString(ShaderCI.FilePath);
+        m_CreateInfo.EntryPoint            = CopyString(ShaderCI.EntryPoint);
+        m_CreateInfo.CombinedSamplerSuffix = CopyString(ShaderCI.CombinedSamplerSuffix);
+        m_CreateInfo.Desc.Name             = CopyString(ShaderCI.Desc.Name);
+
+        m_CreateInfo.ppConversionStream = nullptr;
+        m_CreateInfo.ppCompilerOutput   = nullptr;
+
+        if (ShaderCI.Source != nullptr)
+        {
+            m_Source.assign(ShaderCI.Source, ShaderCI.SourceLength != 0 ? ShaderCI.SourceLength : strlen(ShaderCI.Source));
+            m_CreateInfo.Source       = m_Source.c_str();
+            m_CreateInfo.SourceLength = m_Source.length();
+        }
+        else if (ShaderCI.ByteCode != nullptr)
+        {
+            const auto* pByteCode = static_cast<const Uint8*>(ShaderCI.ByteCode);
+            // Use Uint32 storage to keep SPIRV and DXBC byte code properly aligned
+            m_ByteCode.resize(AlignUp(ShaderCI.ByteCodeSize, sizeof(Uint32)) / sizeof(Uint32));
+            memcpy(m_ByteCode.data(), pByteCode, ShaderCI.ByteCodeSize);
+            m_CreateInfo.ByteCode     = m_ByteCode.data();
+            m_CreateInfo.ByteCodeSize = ShaderCI.ByteCodeSize;
+        }
+
+        if (ShaderCI.Macros != nullptr)
+        {
+            for (const auto* pMacro = ShaderCI.Macros; pMacro->Name != nullptr && pMacro->Definition != nullptr; ++pMacro)
+                m_Macros.emplace_back(CopyString(pMacro->Name), CopyString(pMacro->Definition));
+            m_Macros.emplace_back(nullptr, nullptr);
+            m_CreateInfo.Macros = m_Macros.data();
+        }
+    }
+
+    operator const ShaderCreateInfo&() const
+    {
+        return m_CreateInfo;
+    }
+
+private:
+    const char* CopyString(const char* Str)
+    {
+        return Str != nullptr ? m_StringPool.emplace(Str).first->c_str() : nullptr;
+    }
+
+private:
+    ShaderCreateInfo m_CreateInfo;
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> m_pSourceStreamFactory;
+
+    std::unordered_set<String> m_StringPool;
+    String                     m_Source;
+    std::vector<Uint32>        m_ByteCode;
+    std::vector<ShaderMacro>   m_Macros;
+};
+
+
 /// Template class implementing base functionality of the shader object
 
 /// \tparam EngineImplTraits - Engine implementation type traits.
@@ -94,7 +174,125 @@ public:
             LOG_ERROR_AND_THROW("Tile shaders are not supported by this device.");
     }
 
+    ~ShaderBase()
+    {
+        VERIFY(!m_pAsyncTask || m_pAsyncTask->IsFinished(), "Asynchronous compilation task must be cancelled by the derived class destructor");
+    }
+
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_Shader, TDeviceObjectBase)
+
+    /// Implementation of IShader::GetStatus().
+    virtual SHADER_STATUS DILIGENT_CALL_TYPE GetStatus(bool WaitForCompletion) override final
+    {
+        auto Status = m_Status.load();
+        if (WaitForCompletion && Status == SHADER_STATUS_COMPILING)
+        {
+            // If the compilation task has not been started yet, take it from the queue and compile
+            // the shader in this thread. Pipelines wait for their shaders in thread pool tasks, and
+            // waiting for a task that is still in the queue could block all worker threads.
+            if (m_pAsyncTask &&
+                this->m_pDevice->GetShaderCompilationThreadPool()->RemoveTask(m_pAsyncTask, false) &&
+                !m_pAsyncTask->IsFinished())
+            {
+                m_pAsyncTask->SetStatus(ASYNC_TASK_STATUS_RUNNING);
+                RunAsyncInitializer();
+                m_pAsyncTask->SetStatus(ASYNC_TASK_STATUS_COMPLETE);
+            }
+
+            // Otherwise, the task is running in another thread and will not wait for anything
+            while (Status == SHADER_STATUS_COMPILING)
+            {
+                std::this_thread::yield();
+                Status = m_Status.load();
+            }
+        }
+        return Status;
+    }
+
+    /// Enqueues the asynchronous compilation task prepared by ConstructShader(), if any.
+
+    /// \remarks   This method is called by the render device after the shader object is fully
+    ///             constructed and a strong reference to it is held by the caller.
+    void EnqueueAsyncInitialization()
+    {
+        if (!m_AsyncInitializer)
+            return;
+
+        VERIFY_EXPR(m_Status.load() == SHADER_STATUS_COMPILING);
+        // Do not keep a strong reference to the shader in the task: the shader waits
+        // for the task in its destructor.
+        m_pAsyncTask = EnqueueAsyncWork(this->m_pDevice->GetShaderCompilationThreadPool(),
+                                        [this](Uint32 ThreadId) //
+                                        {
+                                            RunAsyncInitializer();
+                                        });
+    }
+
+protected:
+    /// Initializes the shader using the InitializeShader function.
+
+    /// \param ShaderCI         - Shader create info.
+    /// \param InitializeShader - Function that takes const ShaderCreateInfo& and compiles the shader.
+    ///
+    /// \remarks   If SHADER_COMPILE_FLAG_ASYNCHRONOUS flag is set and the device has a shader
+    ///             compilation thread pool, the function makes a copy of the create info and defers
+    ///             the initialization until EnqueueAsyncInitialization() is called.
+    ///             Otherwise, the shader is initialized synchronously.
+    template <typename HandlerType>
+    void ConstructShader(const ShaderCreateInfo& ShaderCI, HandlerType InitializeShader) noexcept(false)
+    {
+        if ((ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_ASYNCHRONOUS) != 0 &&
+            this->m_pDevice != nullptr && this->m_pDevice->GetShaderCompilationThreadPool() != nullptr)
+        {
+            auto pCreateInfo   = std::make_shared<ShaderCreateInfoWrapper>(ShaderCI);
+            m_AsyncInitializer = [pCreateInfo, InitializeShader]() {
+                InitializeShader(static_cast<const ShaderCreateInfo&>(*pCreateInfo));
+            };
+            m_Status.store(SHADER_STATUS_COMPILING);
+        }
+        else
+        {
+            InitializeShader(ShaderCI);
+            m_Status.store(SHADER_STATUS_READY);
+        }
+    }
+
+    /// Removes the asynchronous compilation task from the queue or waits until it is complete.
+    /// Every derived class must call this method in its destructor before releasing any resources.
+    void CancelAsyncInitialization()
+    {
+        if (!m_pAsyncTask)
+            return;
+
+        if (!this->m_pDevice->GetShaderCompilationThreadPool()->RemoveTask(m_pAsyncTask, false))
+            m_pAsyncTask->WaitForCompletion();
+        m_pAsyncTask.Release();
+    }
+
+private:
+    // Runs the compilation prepared by ConstructShader(). This is done either by the thread pool
+    // or by GetStatus() after the task has been removed from the queue, but never by both.
+    void RunAsyncInitializer()
+    {
+        try
+        {
+            m_AsyncInitializer();
+            // Release the create info copy
+            m_AsyncInitializer = nullptr;
+            m_Status.store(SHADER_STATUS_READY);
+        }
+        catch (...)
+        {
+            LOG_ERROR_MESSAGE("Failed to compile shader '", this->m_Desc.Name, "'.");
+            m_Status.store(SHADER_STATUS_FAILED);
+        }
+    }
+
+private:
+    std::atomic<SHADER_STATUS> m_Status{SHADER_STATUS_UNINITIALIZED};
+
+    std::function<void()>     m_AsyncInitializer;
+    RefCntAutoPtr<IAsyncTask> m_pAsyncTask;
 };
 
 } // namespace Diligent
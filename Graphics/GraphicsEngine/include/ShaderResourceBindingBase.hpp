@@ -41,6 +41,7 @@
 #include "RefCntAutoPtr.hpp"
 #include "GraphicsAccessories.hpp"
 #include "ShaderResourceCacheCommon.hpp"
+#include "ResourceMappingImpl.hpp"
 #include "FixedLinearAllocator.hpp"
 #include "EngineMemory.h"
 
@@ -192,7 +193,58 @@ public:
             return nullptr;
 
         VERIFY_EXPR(static_cast<Uint32>(MgrInd) < GetNumShaders());
-        return m_pShaderVarMgrs[MgrInd].GetVariable(Name);
+        // Variable indices are the same in all SRBs, so the signature resolves the name
+        // using the table it builds once at initialization.
+        const auto VarIndex = GetSignature()->FindSRBVariableIndex(MgrInd, Name);
+        return VarIndex != ResourceSignatureType::InvalidVariableIndex ? m_pShaderVarMgrs[MgrInd].GetVariable(VarIndex) : nullptr;
+    }
+
+    /// Implementation of IShaderResourceBinding::GetVariableByHandle().
+    virtual IShaderResourceVariable* DILIGENT_CALL_TYPE GetVariableByHandle(const ShaderVariableHandle& Handle) override final
+    {
+        if (!Handle.IsValid())
+            return nullptr;
+
+        if (Handle.pSignature != static_cast<const IPipelineResourceSignature*>(GetSignature()))
+        {
+            DEV_ERROR("Variable handle was obtained from signature '", Handle.pSignature->GetDesc().Name,
+                      "' that is not the signature of this SRB ('", m_pPRS->GetDesc().Name, "').");
+            return nullptr;
+        }
+
+        VERIFY_EXPR(Handle.StageIndex < GetNumShaders());
+        return m_pShaderVarMgrs[Handle.StageIndex].GetVariable(Handle.VariableIndex);
+    }
+
+    /// Implementation of IShaderResourceBinding::SetVariables().
+    virtual void DILIGENT_CALL_TYPE SetVariables(const ShaderVariableBinding* pBindings, Uint32 NumBindings) override
+    {
+        DEV_CHECK_ERR(pBindings != nullptr || NumBindings == 0, "pBindings must not be null when NumBindings is not zero");
+
+#ifdef DILIGENT_DEVELOPMENT
+        if (!DvpValidateVariableBindings(pBindings, NumBindings))
+            return;
+#endif
+
+        for (Uint32 i = 0; i < NumBindings; ++i)
+        {
+            const auto& Binding = pBindings[i];
+            // Handles come from the application, so the stage index is always checked to
+            // prevent out-of-bounds access. The variable index is checked by GetVariable().
+            if (Binding.Handle.StageIndex >= GetNumShaders())
+            {
+                LOG_ERROR_MESSAGE("Stage index ", Binding.Handle.StageIndex, " of variable binding ", i, " is out of range. SRB of signature '",
+                                  m_pPRS->GetDesc().Name, "' has ", GetNumShaders(), " active shader stage(s).");
+                continue;
+            }
+
+            // Variable implementations are final in most backends, so SetArray() is not a virtual call.
+            auto* pVar = m_pShaderVarMgrs[Binding.Handle.StageIndex].GetVariable(Binding.Handle.VariableIndex);
+            if (pVar == nullptr)
+                continue;
+
+            pVar->SetArray(Binding.ppObjects, Binding.FirstElement, Binding.NumElements);
+        }
     }
 
     /// Implementation of IShaderResourceBinding::GetVariableCount().
@@ -240,10 +292,11 @@ public:
                                                   IResourceMapping*           pResMapping,
                                                   BIND_SHADER_RESOURCES_FLAGS Flags) override final
     {
+        const ResourceMappingAccessor ResMapping{pResMapping};
         ProcessVariables(ShaderStages,
-                         [pResMapping, Flags](ShaderVariableManagerImplType& Mgr) //
+                         [&ResMapping, Flags](ShaderVariableManagerImplType& Mgr) //
                          {
-                             Mgr.BindResources(pResMapping, Flags);
+                             Mgr.BindResources(ResMapping, Flags);
                              return true;
                          });
     }
@@ -254,11 +307,13 @@ public:
         IResourceMapping*           pResMapping,
         BIND_SHADER_RESOURCES_FLAGS Flags) const override final
     {
+        const ResourceMappingAccessor ResMapping{pResMapping};
+
         SHADER_RESOURCE_VARIABLE_TYPE_FLAGS StaleVarTypes = SHADER_RESOURCE_VARIABLE_TYPE_FLAG_NONE;
         ProcessVariables(ShaderStages,
                          [&](const ShaderVariableManagerImplType& Mgr) //
                          {
-                             Mgr.CheckResources(pResMapping, Flags, StaleVarTypes);
+                             Mgr.CheckResources(ResMapping, Flags, StaleVarTypes);
                              // Stop when both mutable and dynamic variables are stale as there is no reason to check further.
                              return (StaleVarTypes & SHADER_RESOURCE_VARIABLE_TYPE_FLAG_MUT_DYN) != SHADER_RESOURCE_VARIABLE_TYPE_FLAG_MUT_DYN;
                          });
@@ -284,6 +339,50 @@ private:
         }
     }
 
+#ifdef DILIGENT_DEVELOPMENT
+    bool DvpValidateVariableBindings(const ShaderVariableBinding* pBindings, Uint32 NumBindings) const
+    {
+        const IPipelineResourceSignature* const pSignature = GetSignature();
+
+        bool AllValid = true;
+        for (Uint32 i = 0; i < NumBindings; ++i)
+        {
+            const auto& Binding = pBindings[i];
+            const auto& Handle  = Binding.Handle;
+            if (Handle.pSignature != pSignature)
+            {
+                LOG_ERROR_MESSAGE("Variable binding ", i, (Handle.IsValid() ? " uses a handle of another signature" : " uses an invalid handle"),
+                                  ". Only handles obtained from signature '", m_pPRS->GetDesc().Name, "' can be used with this SRB.");
+                AllValid = false;
+                continue;
+            }
+
+            if (Handle.StageIndex >= GetNumShaders() || Handle.VariableIndex >= m_pShaderVarMgrs[Handle.StageIndex].GetVariableCount())
+            {
+                LOG_ERROR_MESSAGE("Variable binding ", i, " uses a handle with out-of-range stage index (", Handle.StageIndex,
+                                  ") or variable index (", Handle.VariableIndex, ").");
+                AllValid = false;
+                continue;
+            }
+
+            ShaderResourceDesc ResDesc;
+            m_pShaderVarMgrs[Handle.StageIndex].GetVariable(Handle.VariableIndex)->GetResourceDesc(ResDesc);
+            if (Binding.NumElements > 0 && Binding.ppObjects == nullptr)
+            {
+                LOG_ERROR_MESSAGE("Variable binding ", i, " ('", ResDesc.Name, "'): ppObjects must not be null when NumElements is not zero.");
+                AllValid = false;
+            }
+            if (Binding.FirstElement + Binding.NumElements > ResDesc.ArraySize)
+            {
+                LOG_ERROR_MESSAGE("Variable binding ", i, " ('", ResDesc.Name, "'): element range ", Binding.FirstElement, " .. ",
+                                  Binding.FirstElement + Binding.NumElements - 1, " is out of array bounds 0 .. ", ResDesc.ArraySize - 1, ".");
+                AllValid = false;
+            }
+        }
+        return AllValid;
+    }
+#endif
+
     template <typename HandlerType>
     void ProcessVariables(SHADER_TYPE ShaderStages,
                           HandlerType Handler) const
@@ -40,6 +40,7 @@
 #include "ShaderResourceCacheCommon.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "EngineMemory.h"
+#include "ResourceMappingImpl.hpp"
 
 namespace Diligent
 {
@@ -718,7 +719,7 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
         return m_ParentManager.GetVariableIndex(*static_cast<const ThisImplType*>(this));
     }
 
-    void BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags)
+    void BindResources(const ResourceMappingAccessor& ResMapping, BIND_SHADER_RESOURCES_FLAGS Flags)
     {
         auto* const pThis   = static_cast<ThisImplType*>(this);
         const auto& ResDesc = pThis->GetDesc();
@@ -726,12 +727,14 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
         if ((Flags & (1u << ResDesc.VarType)) == 0)
             return;
 
+        const auto NameId = m_ParentManager.GetResourceNameId(m_ResIndex);
+
         for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
         {
             if ((Flags & BIND_SHADER_RESOURCES_KEEP_EXISTING) != 0 && pThis->Get(ArrInd) != nullptr)
                 continue;
 
-            if (auto* pObj = pResourceMapping->GetResource(ResDesc.Name, ArrInd))
+            if (auto* pObj = ResMapping.GetResource(NameId, ResDesc.Name, ArrInd))
             {
                 pThis->BindResource(BindResourceInfo{ArrInd, pObj});
             }
@@ -748,7 +751,7 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
         }
     }
 
-    void CheckResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags, SHADER_RESOURCE_VARIABLE_TYPE_FLAGS& StaleVarTypes) const
+    void CheckResources(const ResourceMappingAccessor& ResMapping, BIND_SHADER_RESOURCES_FLAGS Flags, SHADER_RESOURCE_VARIABLE_TYPE_FLAGS& StaleVarTypes) const
     {
         auto* const pThis   = static_cast<const ThisImplType*>(this);
         const auto& ResDesc = pThis->GetDesc();
@@ -772,9 +775,9 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
                 return;
             }
 
-            if (pResourceMapping != nullptr)
+            if (ResMapping)
             {
-                if (auto* pObj = pResourceMapping->GetResource(ResDesc.Name, ArrInd))
+                if (auto* pObj = ResMapping.GetResource(m_ParentManager.GetResourceNameId(m_ResIndex), ResDesc.Name, ArrInd))
                 {
                     if (pObj != pBoundObj)
                     {
@@ -844,20 +847,20 @@ protected:
 #endif
     }
 
-    void BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags)
+    void BindResources(const ResourceMappingAccessor& ResMapping, BIND_SHADER_RESOURCES_FLAGS Flags)
     {
-        DEV_CHECK_ERR(pResourceMapping != nullptr, "Failed to bind resources: resource mapping is null");
+        DEV_CHECK_ERR(ResMapping, "Failed to bind resources: resource mapping is null");
 
         if ((Flags & BIND_SHADER_RESOURCES_UPDATE_ALL) == 0)
             Flags |= BIND_SHADER_RESOURCES_UPDATE_ALL;
 
         for (Uint32 v = 0; v < static_cast<ThisImplType*>(this)->m_NumVariables; ++v)
         {
-            m_pVariables[v].BindResources(pResourceMapping, Flags);
+            m_pVariables[v].BindResources(ResMapping, Flags);
         }
     }
 
-    void CheckResources(IResourceMapping*                    pResourceMapping,
+    void CheckResources(const ResourceMappingAccessor&       ResMapping,
                         BIND_SHADER_RESOURCES_FLAGS          Flags,
                         SHADER_RESOURCE_VARIABLE_TYPE_FLAGS& StaleVarTypes) const
     {
@@ -870,7 +873,7 @@ protected:
             SHADER_RESOURCE_VARIABLE_TYPE_FLAG_STATIC;
         for (Uint32 v = 0; (v < pThis->m_NumVariables) && (StaleVarTypes & AllowedTypes) != AllowedTypes; ++v)
         {
-            m_pVariables[v].CheckResources(pResourceMapping, Flags, StaleVarTypes);
+            m_pVariables[v].CheckResources(ResMapping, Flags, StaleVarTypes);
         }
     }
 
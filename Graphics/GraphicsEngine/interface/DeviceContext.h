@@ -373,6 +373,123 @@ struct DrawIndexedAttribs
 typedef struct DrawIndexedAttribs DrawIndexedAttribs;
 
 
+/// Multi-draw command item.
+struct MultiDrawItem
+{
+    /// The number of vertices to draw.
+    Uint32 NumVertices         DEFAULT_INITIALIZER(0);
+
+    /// LOCATION (or INDEX, but NOT the byte offset) of the first vertex in the
+    /// vertex buffer to start reading vertices from.
+    Uint32 StartVertexLocation DEFAULT_INITIALIZER(0);
+};
+typedef struct MultiDrawItem MultiDrawItem;
+
+
+/// Defines the multi-draw command attributes.
+
+/// This structure is used by IDeviceContext::MultiDraw().
+struct MultiDrawAttribs
+{
+    /// The number of draw items to execute.
+    Uint32               DrawCount             DEFAULT_INITIALIZER(0);
+
+    /// A pointer to the array of DrawCount draw items.
+    const MultiDrawItem* pDrawItems            DEFAULT_INITIALIZER(nullptr);
+
+    /// Additional flags, see Diligent::DRAW_FLAGS.
+    DRAW_FLAGS           Flags                 DEFAULT_INITIALIZER(DRAW_FLAG_NONE);
+
+    /// The number of instances to draw. The value is shared by all draw items.
+    Uint32               NumInstances          DEFAULT_INITIALIZER(1);
+
+    /// LOCATION (or INDEX, but NOT the byte offset) in the vertex buffer to start
+    /// reading instance data from. The value is shared by all draw items.
+    Uint32               FirstInstanceLocation DEFAULT_INITIALIZER(0);
+
+#if DILIGENT_CPP_INTERFACE
+    constexpr MultiDrawAttribs() noexcept {}
+
+    /// Initializes the structure with user-specified values.
+    constexpr MultiDrawAttribs(Uint32               _DrawCount,
+                               const MultiDrawItem* _pDrawItems,
+                               DRAW_FLAGS           _Flags,
+                               Uint32               _NumInstances          = 1,
+                               Uint32               _FirstInstanceLocation = 0) noexcept :
+        DrawCount            {_DrawCount            },
+        pDrawItems           {_pDrawItems           },
+        Flags                {_Flags                },
+        NumInstances         {_NumInstances         },
+        FirstInstanceLocation{_FirstInstanceLocation}
+    {}
+#endif
+};
+typedef struct MultiDrawAttribs MultiDrawAttribs;
+
+
+/// Multi-draw indexed command item.
+struct MultiDrawIndexedItem
+{
+    /// The number of indices to draw.
+    Uint32 NumIndices         DEFAULT_INITIALIZER(0);
+
+    /// LOCATION (NOT the byte offset) of the first index in
+    /// the index buffer to start reading indices from.
+    Uint32 FirstIndexLocation DEFAULT_INITIALIZER(0);
+
+    /// A constant which is added to each index before accessing the vertex buffer.
+    Uint32 BaseVertex         DEFAULT_INITIALIZER(0);
+};
+typedef struct MultiDrawIndexedItem MultiDrawIndexedItem;
+
+
+/// Defines the multi-draw indexed command attributes.
+
+/// This structure is used by IDeviceContext::MultiDrawIndexed().
+struct MultiDrawIndexedAttribs
+{
+    /// The number of draw items to execute.
+    Uint32                      DrawCount             DEFAULT_INITIALIZER(0);
+
+    /// A pointer to the array of DrawCount draw items.
+    const MultiDrawIndexedItem* pDrawItems            DEFAULT_INITIALIZER(nullptr);
+
+    /// The type of elements in the index buffer.
+    /// Allowed values: VT_UINT16 and VT_UINT32.
+    VALUE_TYPE                  IndexType             DEFAULT_INITIALIZER(VT_UNDEFINED);
+
+    /// Additional flags, see Diligent::DRAW_FLAGS.
+    DRAW_FLAGS                  Flags                 DEFAULT_INITIALIZER(DRAW_FLAG_NONE);
+
+    /// The number of instances to draw. The value is shared by all draw items.
+    Uint32                      NumInstances          DEFAULT_INITIALIZER(1);
+
+    /// LOCATION (or INDEX, but NOT the byte offset) in the vertex
+    /// buffer to start reading instance data from. The value is shared by all draw items.
+    Uint32                      FirstInstanceLocation DEFAULT_INITIALIZER(0);
+
+#if DILIGENT_CPP_INTERFACE
+    constexpr MultiDrawIndexedAttribs() noexcept {}
+
+    /// Initializes the structure with user-specified values.
+    constexpr MultiDrawIndexedAttribs(Uint32                      _DrawCount,
+                                      const MultiDrawIndexedItem* _pDrawItems,
+                                      VALUE_TYPE                  _IndexType,
+                                      DRAW_FLAGS                  _Flags,
+                                      Uint32                      _NumInstances          = 1,
+                                      Uint32                      _FirstInstanceLocation = 0) noexcept :
+        DrawCount            {_DrawCount            },
+        pDrawItems           {_pDrawItems           },
+        IndexType            {_IndexType            },
+        Flags                {_Flags                },
+        NumInstances         {_NumInstances         },
+        FirstInstanceLocation{_FirstInstanceLocation}
+    {}
+#endif
+};
+typedef struct MultiDrawIndexedAttribs MultiDrawIndexedAttribs;
+
+
 /// Defines the indirect draw command attributes.
 
 /// This structure is used by IDeviceContext::DrawIndirect().
@@ -1853,6 +1970,70 @@ struct BindSparseResourceMemoryAttribs
 typedef struct BindSparseResourceMemoryAttribs BindSparseResourceMemoryAttribs;
 
 
+/// Device context command statistics.
+
+/// The statistics are accumulated by the device context on the CPU side and
+/// are reset by IDeviceContext::ResetStats().
+/// Counters that are not applicable to a backend are always zero.
+struct DeviceContextStats
+{
+    /// The number of draw commands (all Draw* methods), including indirect draws.
+    /// Every item of a multi-draw command is counted as a separate draw.
+    Uint32 DrawCount                    DEFAULT_INITIALIZER(0);
+
+    /// The number of compute dispatch commands (DispatchCompute, DispatchComputeIndirect, DispatchTile).
+    Uint32 DispatchCount                DEFAULT_INITIALIZER(0);
+
+    /// The number of times a different pipeline state was set.
+    Uint32 PipelineStateChangeCount     DEFAULT_INITIALIZER(0);
+
+    /// The number of IDeviceContext::CommitShaderResources calls.
+    Uint32 ShaderResourceCommitCount    DEFAULT_INITIALIZER(0);
+
+    /// The number of native shader resource binding commands recorded by the backend.
+
+    /// \remarks - Vulkan: the number of vkCmdBindDescriptorSets commands.
+    ///          - Direct3D12: the number of root descriptor table and root view updates.
+    ///          - Direct3D11, OpenGL and Null: the number of times resources of one
+    ///            shader resource binding object were bound to the pipeline.
+    Uint32 DescriptorSetBindCount       DEFAULT_INITIALIZER(0);
+
+    /// The number of descriptor sets (Vulkan) or descriptor ranges (Direct3D12)
+    /// allocated from dynamic descriptor heaps.
+    Uint32 DescriptorSetAllocationCount DEFAULT_INITIALIZER(0);
+
+    /// The number of resource state transitions recorded by the context, both explicit
+    /// (IDeviceContext::TransitionResourceStates) and implicit (RESOURCE_STATE_TRANSITION_MODE_TRANSITION).
+    /// Transitions that do not change the resource state are not counted.
+    ///
+    /// \remarks OpenGL backend does not track resource states and this counter is always zero.
+    Uint32 BarrierCount                 DEFAULT_INITIALIZER(0);
+
+    /// The number of render passes started by the context.
+
+    /// \remarks In Vulkan backend, this includes render passes that were implicitly started
+    ///          by the engine, for instance, when a draw command follows a copy command that
+    ///          interrupted the render pass started by IDeviceContext::SetRenderTargets.
+    Uint32 RenderPassCount              DEFAULT_INITIALIZER(0);
+
+    /// The number of times the context submitted commands to the GPU queue, both
+    /// explicitly (IDeviceContext::Flush) and implicitly (e.g. in IDeviceContext::FinishFrame).
+    Uint32 FlushCount                   DEFAULT_INITIALIZER(0);
+
+    /// The number of IDeviceContext::FinishFrame calls.
+    Uint32 FrameCount                   DEFAULT_INITIALIZER(0);
+
+    /// The total size, in bytes, of the space allocated in the dynamic heap
+    /// (dynamic buffers, dynamic constant data) by the context.
+    Uint64 DynamicHeapBytes             DEFAULT_INITIALIZER(0);
+
+    /// The total size, in bytes, of the space allocated in the upload heap
+    /// (buffer and texture updates) by the context.
+    Uint64 UploadHeapBytes              DEFAULT_INITIALIZER(0);
+};
+typedef struct DeviceContextStats DeviceContextStats;
+
+
 static const Uint32 REMAINING_MIP_LEVELS   = ~0u;
 static const Uint32 REMAINING_ARRAY_SLICES = ~0u;
 
@@ -2056,6 +2237,11 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContext, IObject)
     ///
     /// \remarks Supported contexts for graphics and mesh pipeline:        graphics.
     ///          Supported contexts for compute and ray tracing pipeline:  graphics and compute.
+    ///
+    ///          If the pipeline is still being compiled asynchronously (see IPipelineState::GetStatus()),
+    ///          the method blocks until the compilation is complete. If the pipeline failed to compile,
+    ///          the method logs an error and resets the currently bound pipeline state, so subsequent
+    ///          draw and dispatch commands will be rejected until a valid pipeline is set.
     VIRTUAL void METHOD(SetPipelineState)(THIS_
                                           IPipelineState* pPipelineState) PURE;
 
@@ -2373,6 +2559,46 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContext, IObject)
                                      const DrawIndexedAttribs REF Attribs) PURE;
 
 
+    /// Executes a sequence of draw commands that share the same pipeline state and resources.
+
+    /// \param [in] Attribs - Multi-draw command attributes, see Diligent::MultiDrawAttribs for details.
+    ///
+    /// \remarks  The method is equivalent to calling IDeviceContext::Draw() for every item in
+    ///           Attribs.pDrawItems, but the pipeline state and resources are committed, and the
+    ///           arguments are validated, only once for the entire sequence.
+    ///
+    ///           If Diligent::DeviceFeatures::NativeMultiDraw is enabled, all draws are submitted
+    ///           with a single native command. Otherwise, the backend issues individual draw commands.
+    ///
+    ///           If Diligent::DRAW_FLAG_VERIFY_STATES flag is set, the method reads the state of vertex
+    ///           buffers, so no other threads are allowed to alter the states of the same resources.
+    ///           It is OK to read these states.
+    ///
+    /// \remarks Supported contexts: graphics.
+    VIRTUAL void METHOD(MultiDraw)(THIS_
+                                   const MultiDrawAttribs REF Attribs) PURE;
+
+
+    /// Executes a sequence of indexed draw commands that share the same pipeline state and resources.
+
+    /// \param [in] Attribs - Multi-draw command attributes, see Diligent::MultiDrawIndexedAttribs for details.
+    ///
+    /// \remarks  The method is equivalent to calling IDeviceContext::DrawIndexed() for every item in
+    ///           Attribs.pDrawItems, but the pipeline state and resources are committed, and the
+    ///           arguments are validated, only once for the entire sequence.
+    ///
+    ///           If Diligent::DeviceFeatures::NativeMultiDraw is enabled, all draws are submitted
+    ///           with a single native command. Otherwise, the backend issues individual draw commands.
+    ///
+    ///           If Diligent::DRAW_FLAG_VERIFY_STATES flag is set, the method reads the state of vertex/index
+    ///           buffers, so no other threads are allowed to alter the states of the same resources.
+    ///           It is OK to read these states.
+    ///
+    /// \remarks Supported contexts: graphics.
+    VIRTUAL void METHOD(MultiDrawIndexed)(THIS_
+                                          const MultiDrawIndexedAttribs REF Attribs) PURE;
+
+
     /// Executes an indirect draw command.
 
     /// \param [in] Attribs - Structure describing the command attributes, see Diligent::DrawIndirectAttribs for details.
@@ -3185,6 +3411,21 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContext, IObject)
     ///          internal queue supports COMMAND_QUEUE_TYPE_SPARSE_BINDING.
     VIRTUAL void METHOD(BindSparseResourceMemory)(THIS_
                                                   const BindSparseResourceMemoryAttribs REF Attribs) PURE;
+
+
+    /// Returns the command statistics accumulated by the context since the last
+    /// call to IDeviceContext::ResetStats().
+
+    /// \param [out] Stats - Command statistics, see Diligent::DeviceContextStats.
+    ///
+    /// \remarks The counters are maintained on the CPU side and add negligible overhead.
+    ///          A typical usage pattern is to read the statistics and reset them
+    ///          once per frame after calling IDeviceContext::FinishFrame().
+    VIRTUAL void METHOD(GetStats)(THIS_
+                                  DeviceContextStats REF Stats) CONST PURE;
+
+    /// Resets the command statistics returned by IDeviceContext::GetStats().
+    VIRTUAL void METHOD(ResetStats)(THIS) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -3213,6 +3454,8 @@ DILIGENT_END_INTERFACE
 #    define IDeviceContext_EndRenderPass(This)                      CALL_IFACE_METHOD(DeviceContext, EndRenderPass,             This)
 #    define IDeviceContext_Draw(This, ...)                          CALL_IFACE_METHOD(DeviceContext, Draw,                      This, __VA_ARGS__)
 #    define IDeviceContext_DrawIndexed(This, ...)                   CALL_IFACE_METHOD(DeviceContext, DrawIndexed,               This, __VA_ARGS__)
+#    define IDeviceContext_MultiDraw(This, ...)                     CALL_IFACE_METHOD(DeviceContext, MultiDraw,                 This, __VA_ARGS__)
+#    define IDeviceContext_MultiDrawIndexed(This, ...)              CALL_IFACE_METHOD(DeviceContext, MultiDrawIndexed,          This, __VA_ARGS__)
 #    define IDeviceContext_DrawIndirect(This, ...)                  CALL_IFACE_METHOD(DeviceContext, DrawIndirect,              This, __VA_ARGS__)
 #    define IDeviceContext_DrawIndexedIndirect(This, ...)           CALL_IFACE_METHOD(DeviceContext, DrawIndexedIndirect,       This, __VA_ARGS__)
 #    define IDeviceContext_DrawMesh(This, ...)                      CALL_IFACE_METHOD(DeviceContext, DrawMesh,                  This, __VA_ARGS__)
@@ -3262,6 +3505,8 @@ DILIGENT_END_INTERFACE
 #    define IDeviceContext_UnlockCommandQueue(This)                 CALL_IFACE_METHOD(DeviceContext, UnlockCommandQueue,        This)
 #    define IDeviceContext_SetShadingRate(This, ...)                CALL_IFACE_METHOD(DeviceContext, SetShadingRate,            This, __VA_ARGS__)
 #    define IDeviceContext_BindSparseResourceMemory(This, ...)      CALL_IFACE_METHOD(DeviceContext, BindSparseResourceMemory,  This, __VA_ARGS__)
+#    define IDeviceContext_GetStats(This, ...)                      CALL_IFACE_METHOD(DeviceContext, GetStats,                  This, __VA_ARGS__)
+#    define IDeviceContext_ResetStats(This)                         CALL_IFACE_METHOD(DeviceContext, ResetStats,                This)
 
 // clang-format on
 
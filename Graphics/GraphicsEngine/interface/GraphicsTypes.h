@@ -1552,6 +1552,7 @@ enum RENDER_DEVICE_TYPE
     RENDER_DEVICE_TYPE_GLES,           ///< OpenGLES device
     RENDER_DEVICE_TYPE_VULKAN,         ///< Vulkan device
     RENDER_DEVICE_TYPE_METAL,          ///< Metal device
+    RENDER_DEVICE_TYPE_NULL,           ///< Null device (no graphics API, all resources reside in host memory)
     RENDER_DEVICE_TYPE_COUNT           ///< The total number of device types
 };
 
@@ -1731,6 +1732,20 @@ struct DeviceFeatures
     /// Indicates if device supports sparse (aka tiled or partially resident) resources.
     DEVICE_FEATURE_STATE SparseResources                  DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
 
+    /// Indicates if device natively supports multi-draw commands (IDeviceContext::MultiDraw and
+    /// IDeviceContext::MultiDrawIndexed) that submit all draws with a single API call.
+    ///
+    /// \remarks   Multi-draw commands are always available. When this feature is not supported,
+    ///             they are emulated by issuing individual draw commands.
+    DEVICE_FEATURE_STATE NativeMultiDraw                  DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
+    /// Indicates if device supports asynchronous shader compilation and pipeline state creation
+    /// (see Diligent::SHADER_COMPILE_FLAG_ASYNCHRONOUS and Diligent::PSO_CREATE_FLAG_ASYNCHRONOUS).
+    ///
+    /// \remarks   When this feature is enabled, the engine uses the thread pool provided through
+    ///             EngineCreateInfo::pAsyncShaderCompilationThreadPool or creates its own one.
+    DEVICE_FEATURE_STATE AsyncShaderCompilation           DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
 #if DILIGENT_CPP_INTERFACE
     constexpr DeviceFeatures() noexcept {}
 
@@ -1773,9 +1788,11 @@ struct DeviceFeatures
         TileShaders                       {State},
         TransferQueueTimestampQueries     {State},
         VariableRateShading               {State},
-        SparseResources                   {State}
+        SparseResources                   {State},
+        NativeMultiDraw                   {State},
+        AsyncShaderCompilation            {State}
     {
-        static_assert(sizeof(*this) == 39, "Did you add a new feature to DeviceFeatures? Please handle its status above.");
+        static_assert(sizeof(*this) == 41, "Did you add a new feature to DeviceFeatures? Please handle its status above.");
     }
 
 
@@ -2337,6 +2354,10 @@ struct RenderDeviceInfo
     {
         return Type == RENDER_DEVICE_TYPE_METAL;
     }
+    constexpr bool IsNullDevice()const
+    {
+        return Type == RENDER_DEVICE_TYPE_NULL;
+    }
 
     // for backward compatibility
     const NDCAttribs& GetNDCAttribs()const
@@ -3284,6 +3305,21 @@ struct EngineCreateInfo
     /// Pointer to the user-specified debug message callback function
     DebugMessageCallbackType DebugMessageCallback   DEFAULT_INITIALIZER(nullptr);
 
+    /// An optional thread pool for asynchronous shader compilation and pipeline state creation.
+    /// The object must implement the Diligent::IThreadPool interface.
+
+    /// \remarks   This member is only used when DeviceFeatures::AsyncShaderCompilation is enabled.
+    ///             If null, the engine creates its own thread pool
+    ///             with NumAsyncShaderCompilationThreads worker threads.
+    struct IObject*          pAsyncShaderCompilationThreadPool DEFAULT_INITIALIZER(nullptr);
+
+    /// The number of worker threads in the thread pool created by the engine
+    /// when pAsyncShaderCompilationThreadPool is null.
+
+    /// \remarks   The default value (0xFFFFFFFF) means the number of hardware threads minus one,
+    ///             but at least one thread.
+    Uint32                   NumAsyncShaderCompilationThreads  DEFAULT_INITIALIZER(0xFFFFFFFFU);
+
 #if DILIGENT_CPP_INTERFACE
     EngineCreateInfo() noexcept
     {
@@ -3661,6 +3697,14 @@ struct EngineVkCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// pages when resources are released
     Uint32 HostVisibleMemoryReserveSize     DEFAULT_INITIALIZER(256 << 20);
 
+    /// Resources whose memory requirements are equal to or larger than this size
+    /// are placed into dedicated allocations rather than sub-allocated from memory pages.
+    /// Resources for which the driver prefers or requires a dedicated allocation always get one.
+    /// Zero disables size-based dedicated allocations.
+
+    /// \remarks   Dedicated allocations are only used when VK_KHR_dedicated_allocation extension is supported.
+    Uint32 DedicatedAllocationThreshold     DEFAULT_INITIALIZER(8 << 20);
+
     /// Page size of the upload heap that is allocated by immediate/deferred
     /// contexts from the global memory manager to perform lock-free dynamic
     /// suballocations.
@@ -3676,6 +3720,32 @@ struct EngineVkCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// the global dynamic heap to perform lock-free dynamic suballocations
     Uint32 DynamicHeapPageSize              DEFAULT_INITIALIZER(256 << 10);
 
+    /// The maximum number of descriptors of each type (sampled images, storage images,
+    /// uniform and storage texel buffers, storage buffers) in the bindless descriptor heap.
+    /// Zero disables the heap.
+
+    /// \remarks   The heap requires descriptor indexing with update-after-bind and partially bound
+    ///            descriptors, see Diligent::PIPELINE_RESOURCE_FLAG_BINDLESS_HEAP.
+    ///            The number of descriptors is clamped so that the heap takes at most half of
+    ///            every update-after-bind device limit; the rest is left to the descriptor sets
+    ///            of the pipeline resource signatures used together with the heap.
+    Uint32 BindlessHeapSize                 DEFAULT_INITIALIZER(0);
+
+    /// Whether to track the completion of command buffers with timeline semaphores and release
+    /// stale resources from a background thread instead of polling the fences on every submission.
+
+    /// \remarks   Requires timeline semaphores. The option is ignored if they are not supported.
+    bool   EnableCompletionThread           DEFAULT_INITIALIZER(false);
+
+    /// The maximum number of consecutive command buffer submissions to the same queue
+    /// that are merged into a single vkQueueSubmit call.
+
+    /// \remarks   Submissions are batched only when EnableCompletionThread is true.
+    ///            Pending submissions are sent to the GPU when the batch is full, and before
+    ///            presenting, waiting for or signaling a fence, sparse binding and waiting for idle.
+    ///            Values greater than 1 reduce the submission overhead at the cost of latency.
+    Uint32 MaxSubmitBatchSize               DEFAULT_INITIALIZER(1);
+
     /// Query pool size for each query type.
     Uint32 QueryPoolSizes[QUERY_TYPE_NUM_TYPES]
 #if DILIGENT_CPP_INTERFACE
@@ -3764,6 +3834,31 @@ struct EngineMtlCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
 typedef struct EngineMtlCreateInfo EngineMtlCreateInfo;
 
 
+/// Attributes of the Null engine implementation
+struct EngineNullCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
+
+    /// Whether the device contexts should execute data transfer commands on the CPU.
+
+    /// When this flag is true, IDeviceContext::UpdateBuffer(), IDeviceContext::CopyBuffer(),
+    /// IDeviceContext::UpdateTexture(), IDeviceContext::CopyTexture() as well as map/unmap
+    /// operations read and write resource data that is kept in host memory.
+    /// When it is false, the commands are validated, but resource contents are not touched,
+    /// which isolates the cost of the engine front-end.
+    bool ExecuteCopies DEFAULT_INITIALIZER(true);
+
+#if DILIGENT_CPP_INTERFACE
+    EngineNullCreateInfo() noexcept :
+        EngineNullCreateInfo{EngineCreateInfo{}}
+    {}
+
+    explicit EngineNullCreateInfo(const EngineCreateInfo &EngineCI) noexcept :
+        EngineCreateInfo{EngineCI}
+    {}
+#endif
+};
+typedef struct EngineNullCreateInfo EngineNullCreateInfo;
+
+
 /// Box
 struct Box
 {
@@ -125,7 +125,24 @@ DILIGENT_TYPED_ENUM(PIPELINE_RESOURCE_FLAGS, Uint8)
     /// \note This flag is only valid in Vulkan.
     PIPELINE_RESOURCE_FLAG_GENERAL_INPUT_ATTACHMENT = 1u << 4,
 
-    PIPELINE_RESOURCE_FLAG_LAST               = PIPELINE_RESOURCE_FLAG_GENERAL_INPUT_ATTACHMENT
+    /// Indicates that the resource is a run-time array that is backed by the device-wide bindless
+    /// descriptor heap rather than by the shader resource binding.
+    ///
+    /// \remarks    Every texture and buffer view is assigned a stable index in the bindless heap
+    ///             when it is created (see ITextureViewVk::GetBindlessHeapIndex() and
+    ///             IBufferViewVk::GetBindlessHeapIndex()). Shaders access the view by indexing
+    ///             the array, and the application only needs to pass the indices to the shader, e.g.
+    ///             through a constant or a structured buffer. The resource can't be bound through
+    ///             the shader resource binding or static variables.
+    ///             The flag must be used together with PIPELINE_RESOURCE_FLAG_RUNTIME_ARRAY and
+    ///             applies to SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_TYPE_TEXTURE_UAV,
+    ///             SHADER_RESOURCE_TYPE_BUFFER_SRV and SHADER_RESOURCE_TYPE_BUFFER_UAV resources.
+    ///
+    /// \note This flag is only valid in Vulkan and requires EngineVkCreateInfo::BindlessHeapSize
+    ///       to be non-zero.
+    PIPELINE_RESOURCE_FLAG_BINDLESS_HEAP      = 1u << 5,
+
+    PIPELINE_RESOURCE_FLAG_LAST               = PIPELINE_RESOURCE_FLAG_BINDLESS_HEAP
 };
 DEFINE_FLAG_ENUM_OPERATORS(PIPELINE_RESOURCE_FLAGS);
 
@@ -370,6 +387,24 @@ DILIGENT_BEGIN_INTERFACE(IPipelineResourceSignature, IDeviceObject)
     VIRTUAL Uint32 METHOD(GetStaticVariableCount)(THIS_
                                                   SHADER_TYPE ShaderType) CONST PURE;
 
+
+    /// Returns the handle of the mutable or dynamic shader resource variable.
+
+    /// \param [in] ShaderType - Type of the shader to look up the variable.
+    ///                          Must be one of Diligent::SHADER_TYPE.
+    /// \param [in] Name       - Name of the variable.
+    ///
+    /// \return     Variable handle that can be passed to IShaderResourceBinding::GetVariableByHandle()
+    ///             of any shader resource binding object created by this signature.
+    ///             If the variable is not found, the returned handle is not valid.
+    ///
+    /// \remarks    The handle is resolved once and remains valid for the lifetime of the signature.
+    ///             Applications that access the same variables in many SRBs should resolve the
+    ///             handles once rather than look up the variables by name in every SRB.
+    VIRTUAL ShaderVariableHandle METHOD(GetVariableHandle)(THIS_
+                                                           SHADER_TYPE ShaderType,
+                                                           const Char* Name) CONST PURE;
+
     /// Initializes static resources in the shader binding object.
 
     /// If static shader resources were not initialized when the SRB was created,
@@ -408,6 +443,7 @@ DILIGENT_END_INTERFACE
 #    define IPipelineResourceSignature_GetStaticVariableByName(This, ...)      CALL_IFACE_METHOD(PipelineResourceSignature, GetStaticVariableByName,     This, __VA_ARGS__)
 #    define IPipelineResourceSignature_GetStaticVariableByIndex(This, ...)     CALL_IFACE_METHOD(PipelineResourceSignature, GetStaticVariableByIndex,    This, __VA_ARGS__)
 #    define IPipelineResourceSignature_GetStaticVariableCount(This, ...)       CALL_IFACE_METHOD(PipelineResourceSignature, GetStaticVariableCount,      This, __VA_ARGS__)
+#    define IPipelineResourceSignature_GetVariableHandle(This, ...)            CALL_IFACE_METHOD(PipelineResourceSignature, GetVariableHandle,           This, __VA_ARGS__)
 #    define IPipelineResourceSignature_InitializeStaticSRBResources(This, ...) CALL_IFACE_METHOD(PipelineResourceSignature, InitializeStaticSRBResources,This, __VA_ARGS__)
 #    define IPipelineResourceSignature_IsCompatibleWith(This, ...)             CALL_IFACE_METHOD(PipelineResourceSignature, IsCompatibleWith,            This, __VA_ARGS__)
 
@@ -564,11 +564,42 @@ DILIGENT_TYPED_ENUM(PSO_CREATE_FLAGS, Uint32)
     /// by the PSO's resource signatures.
     PSO_CREATE_FLAG_DONT_REMAP_SHADER_RESOURCES       = 1u << 2u,
 
-    PSO_CREATE_FLAG_LAST = PSO_CREATE_FLAG_DONT_REMAP_SHADER_RESOURCES
+    /// Create the pipeline state asynchronously.
+
+    /// When this flag is set and the device supports asynchronous shader compilation
+    /// (see Diligent::DeviceFeatures::AsyncShaderCompilation), IRenderDevice::CreateGraphicsPipelineState()
+    /// and other PSO creation methods return immediately, while the pipeline is
+    /// initialized by the engine's thread pool. Use IPipelineState::GetStatus() to
+    /// query the pipeline state status.
+    /// If the feature is not enabled, the flag is ignored and the pipeline is created synchronously.
+    ///
+    /// \remarks   The shaders used by an asynchronous pipeline may themselves be compiled asynchronously
+    ///             (see Diligent::SHADER_COMPILE_FLAG_ASYNCHRONOUS); the pipeline waits for them.
+    PSO_CREATE_FLAG_ASYNCHRONOUS                      = 1u << 3u,
+
+    PSO_CREATE_FLAG_LAST = PSO_CREATE_FLAG_ASYNCHRONOUS
 };
 DEFINE_FLAG_ENUM_OPERATORS(PSO_CREATE_FLAGS);
 
 
+/// Pipeline state status
+DILIGENT_TYPED_ENUM(PIPELINE_STATE_STATUS, Uint32)
+{
+    /// Initial pipeline state status.
+    PIPELINE_STATE_STATUS_UNINITIALIZED = 0,
+
+    /// The pipeline state is being compiled.
+    PIPELINE_STATE_STATUS_COMPILING,
+
+    /// The pipeline state has been successfully compiled
+    /// and is ready to be used.
+    PIPELINE_STATE_STATUS_READY,
+
+    /// The pipeline state compilation has failed.
+    PIPELINE_STATE_STATUS_FAILED
+};
+
+
 /// Pipeline state creation attributes
 struct PipelineStateCreateInfo
 {
@@ -945,6 +976,21 @@ DILIGENT_BEGIN_INTERFACE(IPipelineState, IDeviceObject)
     /// \return     Pointer to pipeline resource signature interface.
     VIRTUAL IPipelineResourceSignature* METHOD(GetResourceSignature)(THIS_
                                                                      Uint32 Index) CONST PURE;
+
+    /// Returns the pipeline state status, see Diligent::PIPELINE_STATE_STATUS.
+
+    /// \param [in] WaitForCompletion - If true, the method will wait until the pipeline state is compiled.
+    ///                                 If false, the method will return the pipeline state status without waiting.
+    ///                                 This parameter is ignored if the pipeline state was created synchronously.
+    ///                                 If the initialization has not been started by the thread pool yet,
+    ///                                 the pipeline state is initialized in the calling thread.
+    ///
+    /// \remarks   Until the status is PIPELINE_STATE_STATUS_READY, the pipeline state may only be
+    ///             queried for its status, bound to a device context or released. Binding a pipeline
+    ///             that is still being compiled blocks the context until the compilation is complete
+    ///             (see IDeviceContext::SetPipelineState()).
+    VIRTUAL PIPELINE_STATE_STATUS METHOD(GetStatus)(THIS_
+                                                    bool WaitForCompletion DEFAULT_VALUE(false)) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -968,6 +1014,7 @@ DILIGENT_END_INTERFACE
 #    define IPipelineState_IsCompatibleWith(This, ...)             CALL_IFACE_METHOD(PipelineState, IsCompatibleWith,             This, __VA_ARGS__)
 #    define IPipelineState_GetResourceSignatureCount(This)         CALL_IFACE_METHOD(PipelineState, GetResourceSignatureCount,    This)
 #    define IPipelineState_GetResourceSignature(This, ...)         CALL_IFACE_METHOD(PipelineState, GetResourceSignature,         This, __VA_ARGS__)
+#    define IPipelineState_GetStatus(This, ...)                    CALL_IFACE_METHOD(PipelineState, GetStatus,                    This, __VA_ARGS__)
 
 // clang-format on
 
@@ -221,10 +221,40 @@ DILIGENT_TYPED_ENUM(SHADER_COMPILE_FLAGS, Uint32)
     /// Don't load shader reflection.
     SHADER_COMPILE_FLAG_SKIP_REFLECTION         = 0x02,
 
-    SHADER_COMPILE_FLAG_LAST = SHADER_COMPILE_FLAG_SKIP_REFLECTION
+    /// Compile the shader asynchronously.
+
+    /// \remarks   When this flag is set and the device supports asynchronous shader compilation
+    ///             (see Diligent::DeviceFeatures::AsyncShaderCompilation), IRenderDevice::CreateShader()
+    ///             returns immediately and the shader is compiled by the engine's thread pool.
+    ///             Use IShader::GetStatus() to query the compilation status.
+    ///             If the feature is not enabled, the flag is ignored and the shader is compiled synchronously.
+    ///
+    ///             ShaderCreateInfo::ppCompilerOutput and ShaderCreateInfo::ppConversionStream
+    ///             are ignored for asynchronously compiled shaders.
+    SHADER_COMPILE_FLAG_ASYNCHRONOUS            = 0x04,
+
+    SHADER_COMPILE_FLAG_LAST = SHADER_COMPILE_FLAG_ASYNCHRONOUS
 };
 DEFINE_FLAG_ENUM_OPERATORS(SHADER_COMPILE_FLAGS);
 
+
+/// Shader status
+DILIGENT_TYPED_ENUM(SHADER_STATUS, Uint32)
+{
+    /// Initial shader status.
+    SHADER_STATUS_UNINITIALIZED = 0,
+
+    /// The shader is being compiled.
+    SHADER_STATUS_COMPILING,
+
+    /// The shader has been successfully compiled
+    /// and is ready to be used.
+    SHADER_STATUS_READY,
+
+    /// The shader compilation has failed.
+    SHADER_STATUS_FAILED
+};
+
 // clang-format on
 
 
@@ -458,6 +488,20 @@ DILIGENT_BEGIN_INTERFACE(IShader, IDeviceObject)
     VIRTUAL void METHOD(GetResourceDesc)(THIS_
                                          Uint32 Index,
                                          ShaderResourceDesc REF ResourceDesc) CONST PURE;
+
+    /// Returns the shader status, see Diligent::SHADER_STATUS.
+
+    /// \param [in] WaitForCompletion - If true, the method will wait until the shader is compiled.
+    ///                                 If false, the method will return the shader status without waiting.
+    ///                                 This parameter is ignored if the shader was compiled synchronously.
+    ///                                 If the compilation has not been started by the thread pool yet,
+    ///                                 the shader is compiled in the calling thread.
+    ///
+    /// \remarks   Until the status is SHADER_STATUS_READY, shader resources must not be queried.
+    ///             A shader that is still being compiled may be used to create a pipeline state:
+    ///             the pipeline waits until compilation is complete and fails if the shader fails.
+    VIRTUAL SHADER_STATUS METHOD(GetStatus)(THIS_
+                                            bool WaitForCompletion DEFAULT_VALUE(false)) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -471,6 +515,7 @@ DILIGENT_END_INTERFACE
 
 #    define IShader_GetResourceCount(This)     CALL_IFACE_METHOD(Shader, GetResourceCount, This)
 #    define IShader_GetResourceDesc(This, ...) CALL_IFACE_METHOD(Shader, GetResourceDesc,  This, __VA_ARGS__)
+#    define IShader_GetStatus(This, ...)       CALL_IFACE_METHOD(Shader, GetStatus,        This, __VA_ARGS__)
 
 // clang-format on
 
@@ -40,6 +40,51 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 struct IPipelineState;
 struct IPipelineResourceSignature;
 
+/// Shader resource variable handle.
+
+/// A handle identifies a mutable or dynamic shader resource variable in a pipeline resource signature.
+/// It is obtained once by name through IPipelineResourceSignature::GetVariableHandle() and can then
+/// be used to access the variable in constant time in any shader resource binding object created
+/// by the same signature, see IShaderResourceBinding::GetVariableByHandle().
+struct ShaderVariableHandle
+{
+    /// Pipeline resource signature that the handle was obtained from.
+    const struct IPipelineResourceSignature* pSignature DEFAULT_INITIALIZER(nullptr);
+
+    /// Index of the active shader stage in the signature.
+    Uint32 StageIndex    DEFAULT_INITIALIZER(~0u);
+
+    /// Index of the variable in the shader stage.
+    Uint32 VariableIndex DEFAULT_INITIALIZER(~0u);
+
+#if DILIGENT_CPP_INTERFACE
+    /// Returns true if the handle references a variable.
+    bool IsValid() const
+    {
+        return pSignature != nullptr;
+    }
+#endif
+};
+typedef struct ShaderVariableHandle ShaderVariableHandle;
+
+
+/// Describes the objects to bind to a shader resource variable, see IShaderResourceBinding::SetVariables().
+struct ShaderVariableBinding
+{
+    /// Handle of the variable, see IPipelineResourceSignature::GetVariableHandle().
+    ShaderVariableHandle Handle;
+
+    /// Pointer to the array of NumElements objects to bind.
+    IDeviceObject* const* ppObjects DEFAULT_INITIALIZER(nullptr);
+
+    /// First array element to set.
+    Uint32 FirstElement DEFAULT_INITIALIZER(0);
+
+    /// Number of array elements to set.
+    Uint32 NumElements  DEFAULT_INITIALIZER(1);
+};
+typedef struct ShaderVariableBinding ShaderVariableBinding;
+
 // {061F8774-9A09-48E8-8411-B5BD20560104}
 static const INTERFACE_ID IID_ShaderResourceBinding =
     {0x61f8774, 0x9a09, 0x48e8, {0x84, 0x11, 0xb5, 0xbd, 0x20, 0x56, 0x1, 0x4}};
@@ -151,6 +196,32 @@ DILIGENT_BEGIN_INTERFACE(IShaderResourceBinding, IObject)
 
     /// Returns true if static resources have been initialized in this SRB.
     VIRTUAL bool METHOD(StaticResourcesInitialized)(THIS) CONST PURE;
+
+    /// Returns the variable by its handle.
+
+    /// \param [in] Handle - Variable handle obtained from IPipelineResourceSignature::GetVariableHandle().
+    ///                      The handle must have been obtained from the signature that
+    ///                      this SRB was created by.
+    ///
+    /// \remarks Unlike GetVariableByName(), this method does not perform a name look-up and
+    ///          runs in constant time. If the handle is not valid, the method returns null.
+    VIRTUAL IShaderResourceVariable* METHOD(GetVariableByHandle)(THIS_
+                                                                 const ShaderVariableHandle REF Handle) PURE;
+
+
+    /// Binds objects to multiple variables.
+
+    /// \param [in] pBindings   - Pointer to the array of NumBindings variable bindings,
+    ///                           see Diligent::ShaderVariableBinding.
+    /// \param [in] NumBindings - The number of elements in pBindings.
+    ///
+    /// \remarks The method has the same effect as calling IShaderResourceVariable::SetArray()
+    ///          for every binding, but all bindings are validated in one pass and the backend
+    ///          may coalesce descriptor updates (e.g. Vulkan writes all descriptors with a single
+    ///          vkUpdateDescriptorSets call). If any binding is invalid, no objects are bound.
+    VIRTUAL void METHOD(SetVariables)(THIS_
+                                      const ShaderVariableBinding* pBindings,
+                                      Uint32                       NumBindings) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -167,6 +238,8 @@ DILIGENT_END_INTERFACE
 #    define IShaderResourceBinding_GetVariableCount(This, ...)        CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableCount,             This, __VA_ARGS__)
 #    define IShaderResourceBinding_GetVariableByIndex(This, ...)      CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableByIndex,           This, __VA_ARGS__)
 #    define IShaderResourceBinding_StaticResourcesInitialized(This)   CALL_IFACE_METHOD(ShaderResourceBinding, StaticResourcesInitialized,   This)
+#    define IShaderResourceBinding_GetVariableByHandle(This, ...)     CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableByHandle,          This, __VA_ARGS__)
+#    define IShaderResourceBinding_SetVariables(This, ...)            CALL_IFACE_METHOD(ShaderResourceBinding, SetVariables,                 This, __VA_ARGS__)
 
 // clang-format on
 
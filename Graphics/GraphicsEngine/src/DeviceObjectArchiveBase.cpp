@@ -33,6 +33,7 @@
 
 #include "DebugUtilities.hpp"
 #include "PSOSerializer.hpp"
+#include "CompressedArchiveImpl.hpp"
 
 namespace Diligent
 {
@@ -139,9 +140,12 @@ DeviceObjectArchiveBase::DeviceObjectArchiveBase(IReferenceCounters* pRefCounter
             LOG_ERROR_AND_THROW("Archive version (", Header.Version, ") is not supported; expected version: ", Uint32{HeaderVersion}, ".");
         }
 
-        m_BaseOffsets = Header.BlockBaseOffsets;
+        // Compressed data is decompressed on demand when resources are loaded
+        m_pArchive = GetUncompressedArchive(m_pArchive, Header);
     }
 
+    m_Blobs = ReadBlobTable(m_pArchive, Header.BlobTableOffset);
+
     // Read chunks
     std::vector<ChunkHeader> Chunks{Header.NumChunks};
     if (!m_pArchive->Read(sizeof(Header), sizeof(Chunks[0]) * Chunks.size(), Chunks.data()))
@@ -177,23 +181,70 @@ DeviceObjectArchiveBase::DeviceObjectArchiveBase(IReferenceCounters* pRefCounter
     }
 }
 
-DeviceObjectArchiveBase::BlockOffsetType DeviceObjectArchiveBase::GetBlockOffsetType() const
+RefCntAutoPtr<IArchive> DeviceObjectArchiveBase::GetUncompressedArchive(IArchive* pArchive, const ArchiveHeader& Header) noexcept(false)
 {
-    static_assert(static_cast<size_t>(DeviceType::Count) == 6, "Please handle the new device type below");
-    switch (m_DevType)
+    if ((Header.Flags & ~HeaderFlags::Compressed) != HeaderFlags::None)
     {
-        // clang-format off
-        case DeviceType::OpenGL:      return BlockOffsetType::OpenGL;
-        case DeviceType::Direct3D11:  return BlockOffsetType::Direct3D11;
-        case DeviceType::Direct3D12:  return BlockOffsetType::Direct3D12;
-        case DeviceType::Vulkan:      return BlockOffsetType::Vulkan;
-        case DeviceType::Metal_iOS:   return BlockOffsetType::Metal_iOS;
-        case DeviceType::Metal_MacOS: return BlockOffsetType::Metal_MacOS;
-        // clang-format on
-        default:
-            UNEXPECTED("Unexpected device type");
-            return BlockOffsetType::Count;
+        LOG_ERROR_AND_THROW("Unknown archive header flags (", static_cast<Uint32>(Header.Flags), ")");
+    }
+
+    if ((Header.Flags & HeaderFlags::Compressed) == HeaderFlags::None)
+        return RefCntAutoPtr<IArchive>{pArchive};
+
+    return CompressedArchiveImpl::Create(pArchive, sizeof(ArchiveHeader));
+}
+
+std::vector<DeviceObjectArchiveBase::FileOffsetAndSize> DeviceObjectArchiveBase::ReadBlobTable(IArchive* pArchive, Uint32 BlobTableOffset) noexcept(false)
+{
+    const auto ArchiveSize = pArchive->GetSize();
+
+    BlobTableHeader Header;
+    if (BlobTableOffset == InvalidOffset || !pArchive->Read(BlobTableOffset, sizeof(Header), &Header))
+    {
+        LOG_ERROR_AND_THROW("Failed to read blob table header");
+    }
+
+    std::vector<FileOffsetAndSize> Blobs(Header.Count);
+
+    const Uint64 BlobDataOffset = Uint64{BlobTableOffset} + sizeof(Header) + sizeof(FileOffsetAndSize) * Blobs.size();
+    if (BlobDataOffset > ArchiveSize)
+    {
+        LOG_ERROR_AND_THROW("Blob table is out of archive bounds");
+    }
+    if (!pArchive->Read(BlobTableOffset + sizeof(Header), sizeof(FileOffsetAndSize) * Blobs.size(), Blobs.data()))
+    {
+        LOG_ERROR_AND_THROW("Failed to read blob table");
     }
+
+    for (auto& Blob : Blobs)
+    {
+        if (BlobDataOffset + Blob.Offset + Blob.Size > ArchiveSize)
+        {
+            LOG_ERROR_AND_THROW("Blob data is out of archive bounds");
+        }
+        Blob.Offset = StaticCast<Uint32>(BlobDataOffset + Blob.Offset);
+    }
+
+    return Blobs;
+}
+
+SerializedData DeviceObjectArchiveBase::ReadBlob(Uint32 BlobIndex, DynamicLinearAllocator& Allocator)
+{
+    if (BlobIndex >= m_Blobs.size())
+    {
+        LOG_ERROR_MESSAGE("Invalid blob index (", BlobIndex, "). The archive contains ", m_Blobs.size(), " blobs.");
+        return {};
+    }
+
+    const auto& Blob  = m_Blobs[BlobIndex];
+    auto* const pData = Allocator.Allocate(Blob.Size, DataPtrAlign);
+    if (!m_pArchive->Read(Blob.Offset, Blob.Size, pData))
+    {
+        LOG_ERROR_MESSAGE("Failed to read blob data");
+        return {};
+    }
+
+    return {pData, Blob.Size};
 }
 
 const char* DeviceObjectArchiveBase::ChunkTypeToResName(ChunkType Type)
@@ -268,19 +319,29 @@ void DeviceObjectArchiveBase::ReadShaders(const ChunkHeader& Chunk) noexcept(fal
 
     DynamicLinearAllocator Allocator{GetRawAllocator()};
 
-    const auto ShaderData = GetDeviceSpecificData(Header, Allocator, "Shader list", GetBlockOffsetType());
+    const auto ShaderData = GetDeviceSpecificData(Header, Allocator, "Shader list");
     if (!ShaderData)
         return;
 
-    VERIFY_EXPR(ShaderData.Size() % sizeof(FileOffsetAndSize) == 0);
-    const size_t Count = ShaderData.Size() / sizeof(FileOffsetAndSize);
+    if (ShaderData.Size() % sizeof(Uint32) != 0)
+    {
+        LOG_ERROR_AND_THROW("Invalid shader list size");
+    }
+    const size_t Count = ShaderData.Size() / sizeof(Uint32);
 
-    const auto* pFileOffsetAndSize = ShaderData.Ptr<const FileOffsetAndSize>();
+    const auto* pBlobIndices = ShaderData.Ptr<const Uint32>();
 
     std::unique_lock<std::mutex> WriteLock{m_ShadersGuard};
     m_Shaders.reserve(Count);
     for (Uint32 i = 0; i < Count; ++i)
-        m_Shaders.emplace_back(pFileOffsetAndSize[i]);
+    {
+        const auto BlobIndex = pBlobIndices[i];
+        if (BlobIndex >= m_Blobs.size())
+        {
+            LOG_ERROR_AND_THROW("Invalid shader blob index");
+        }
+        m_Shaders.emplace_back(m_Blobs[BlobIndex]);
+    }
 }
 
 template <typename ResType, typename ReourceDataType>
@@ -298,18 +359,21 @@ bool DeviceObjectArchiveBase::LoadResourceData(OffsetSizeAndResourceMap<ResType>
     }
     VERIFY_EXPR(StoredResourceName != nullptr && StoredResourceName != ResourceName && strcmp(ResourceName, StoredResourceName) == 0);
 
-    const auto DataSize = OffsetAndSize.Size;
-    void*      pData    = ResData.Allocator.Allocate(DataSize, DataPtrAlign);
-    if (!m_pArchive->Read(OffsetAndSize.Offset, DataSize, pData))
+    using HeaderType = typename std::remove_reference<decltype(*ResData.pHeader)>::type;
+    if (OffsetAndSize.Size != sizeof(HeaderType))
     {
-        LOG_ERROR_MESSAGE("Failed to read ", ChunkTypeToResName(ResData.ExpectedChunkType), " with name '", ResourceName, "' data from the archive");
+        LOG_ERROR_MESSAGE("Invalid header size of ", ChunkTypeToResName(ResData.ExpectedChunkType), " with name '", ResourceName, "'");
         return false;
     }
 
-    Serializer<SerializerMode::Read> Ser{SerializedData{pData, DataSize}};
+    void* pHeaderData = ResData.Allocator.Allocate(sizeof(HeaderType), DataPtrAlign);
+    if (!m_pArchive->Read(OffsetAndSize.Offset, sizeof(HeaderType), pHeaderData))
+    {
+        LOG_ERROR_MESSAGE("Failed to read ", ChunkTypeToResName(ResData.ExpectedChunkType), " with name '", ResourceName, "' data from the archive");
+        return false;
+    }
 
-    using HeaderType = typename std::remove_reference<decltype(*ResData.pHeader)>::type;
-    ResData.pHeader  = Ser.Cast<HeaderType>();
+    ResData.pHeader = reinterpret_cast<const HeaderType*>(pHeaderData);
     if (ResData.pHeader->Type != ResData.ExpectedChunkType)
     {
         LOG_ERROR_MESSAGE("Invalid chunk header: ", ChunkTypeToResName(ResData.pHeader->Type),
@@ -317,6 +381,15 @@ bool DeviceObjectArchiveBase::LoadResourceData(OffsetSizeAndResourceMap<ResType>
         return false;
     }
 
+    const auto CommonData = ReadBlob(ResData.pHeader->CommonDataBlob, ResData.Allocator);
+    if (!CommonData)
+    {
+        LOG_ERROR_MESSAGE("Failed to read common data of ", ChunkTypeToResName(ResData.ExpectedChunkType), " with name '", ResourceName, "'");
+        return false;
+    }
+
+    Serializer<SerializerMode::Read> Ser{CommonData};
+
     auto Res = ResData.Deserialize(StoredResourceName, Ser);
     VERIFY_EXPR(Ser.IsEnded());
     return Res;
@@ -331,44 +404,23 @@ template bool DeviceObjectArchiveBase::LoadResourceData<IPipelineResourceSignatu
 template <typename HeaderType>
 SerializedData DeviceObjectArchiveBase::GetDeviceSpecificData(const HeaderType&       Header,
                                                               DynamicLinearAllocator& Allocator,
-                                                              const char*             ResTypeName,
-                                                              BlockOffsetType         BlockType)
+                                                              const char*             ResTypeName)
 {
-    const Uint64 BaseOffset  = m_BaseOffsets[static_cast<size_t>(BlockType)];
-    const auto   ArchiveSize = m_pArchive->GetSize();
-    if (BaseOffset > ArchiveSize)
-    {
-        LOG_ERROR_MESSAGE("Required block does not exist in archive");
-        return {};
-    }
-    if (Header.GetSize(m_DevType) == 0)
+    const auto BlobIndex = Header.GetBlob(m_DevType);
+    if (BlobIndex == InvalidBlobIndex)
     {
         LOG_ERROR_MESSAGE("Device specific data is not specified for ", ResTypeName);
         return {};
     }
-    if (BaseOffset + Header.GetEndOffset(m_DevType) > ArchiveSize)
-    {
-        LOG_ERROR_MESSAGE("Invalid offset in the archive");
-        return {};
-    }
 
-    auto const  Size  = Header.GetSize(m_DevType);
-    auto* const pData = Allocator.Allocate(Size, DataPtrAlign);
-    if (!m_pArchive->Read(BaseOffset + Header.GetOffset(m_DevType), Size, pData))
-    {
-        LOG_ERROR_MESSAGE("Failed to read resource-specific data");
-        return {};
-    }
-
-    return {pData, Size};
+    return ReadBlob(BlobIndex, Allocator);
 }
 
 // Instantiation is required by UnpackResourceSignatureImpl
 template SerializedData DeviceObjectArchiveBase::GetDeviceSpecificData<DeviceObjectArchiveBase::PRSDataHeader>(
     const PRSDataHeader&    Header,
     DynamicLinearAllocator& Allocator,
-    const char*             ResTypeName,
-    BlockOffsetType         BlockType);
+    const char*             ResTypeName);
 
 bool DeviceObjectArchiveBase::PRSData::Deserialize(const char* Name, Serializer<SerializerMode::Read>& Ser)
 {
@@ -605,19 +657,12 @@ template <typename CreateInfoType>
 bool DeviceObjectArchiveBase::UnpackPSOShaders(PSOData<CreateInfoType>& PSO,
                                                IRenderDevice*           pDevice)
 {
-    const auto ShaderData = GetDeviceSpecificData(*PSO.pHeader, PSO.Allocator, ChunkTypeToResName(PSO.ExpectedChunkType), GetBlockOffsetType());
+    const auto ShaderData = GetDeviceSpecificData(*PSO.pHeader, PSO.Allocator, ChunkTypeToResName(PSO.ExpectedChunkType));
     if (!ShaderData)
         return false;
 
     Serializer<SerializerMode::Read> Ser{ShaderData};
 
-    const Uint64 BaseOffset = m_BaseOffsets[static_cast<size_t>(GetBlockOffsetType())];
-    if (BaseOffset > m_pArchive->GetSize())
-    {
-        LOG_ERROR_MESSAGE("Required block does not exist in archive");
-        return false;
-    }
-
     DynamicLinearAllocator Allocator{GetRawAllocator()};
 
     ShaderIndexArray ShaderIndices;
@@ -648,7 +693,7 @@ bool DeviceObjectArchiveBase::UnpackPSOShaders(PSOData<CreateInfoType>& PSO,
 
         void* pData = Allocator.Allocate(OffsetAndSize.Size, DataPtrAlign);
 
-        if (!m_pArchive->Read(BaseOffset + OffsetAndSize.Offset, OffsetAndSize.Size, pData))
+        if (!m_pArchive->Read(OffsetAndSize.Offset, OffsetAndSize.Size, pData))
             return false;
 
         {
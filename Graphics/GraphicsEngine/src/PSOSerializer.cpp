@@ -333,51 +333,25 @@ void RPSerializer<Mode>::SerializeDesc(
                        [&Allocator](Serializer<Mode>&       Ser,
                                     ConstQual<SubpassDesc>& Subpass) //
                        {
-                           auto SerializeAttachmentRef = [](Serializer<Mode>&               Ser,
-                                                            ConstQual<AttachmentReference>& AttachRef) //
-                           {
-                               Ser(AttachRef.AttachmentIndex,
-                                   AttachRef.State);
-                           };
-                           Ser.SerializeArray(Allocator, Subpass.pInputAttachments, Subpass.InputAttachmentCount, SerializeAttachmentRef);
-                           Ser.SerializeArray(Allocator, Subpass.pRenderTargetAttachments, Subpass.RenderTargetAttachmentCount, SerializeAttachmentRef);
+                           // Attachment references are serialized as spans; in Read mode they
+                           // point directly to the serialized data whenever it is properly aligned.
+                           Ser.SerializeArrayRaw(Allocator, Subpass.pInputAttachments, Subpass.InputAttachmentCount);
+                           Ser.SerializeArrayRaw(Allocator, Subpass.pRenderTargetAttachments, Subpass.RenderTargetAttachmentCount);
 
                            // Note: in Read mode, ResolveAttachCount, DepthStencilAttachCount, and ShadingRateAttachCount will be overwritten
                            Uint32 ResolveAttachCount = Subpass.pResolveAttachments != nullptr ? Subpass.RenderTargetAttachmentCount : 0;
-                           Ser.SerializeArray(Allocator, Subpass.pResolveAttachments, ResolveAttachCount, SerializeAttachmentRef);
+                           Ser.SerializeArrayRaw(Allocator, Subpass.pResolveAttachments, ResolveAttachCount);
 
                            Uint32 DepthStencilAttachCount = Subpass.pDepthStencilAttachment != nullptr ? 1 : 0;
-                           Ser.SerializeArray(Allocator, Subpass.pDepthStencilAttachment, DepthStencilAttachCount, SerializeAttachmentRef);
+                           Ser.SerializeArrayRaw(Allocator, Subpass.pDepthStencilAttachment, DepthStencilAttachCount);
 
-                           Ser.SerializeArray(Allocator, Subpass.pPreserveAttachments, Subpass.PreserveAttachmentCount,
-                                              [](Serializer<Mode>&  Ser,
-                                                 ConstQual<Uint32>& Attach) //
-                                              {
-                                                  Ser(Attach);
-                                              });
+                           Ser.SerializeArrayRaw(Allocator, Subpass.pPreserveAttachments, Subpass.PreserveAttachmentCount);
 
                            Uint32 ShadingRateAttachCount = Subpass.pShadingRateAttachment != nullptr ? 1 : 0;
-                           Ser.SerializeArray(Allocator, Subpass.pShadingRateAttachment, ShadingRateAttachCount,
-                                              [](Serializer<Mode>&                 Ser,
-                                                 ConstQual<ShadingRateAttachment>& SRAttachment) //
-                                              {
-                                                  Ser(SRAttachment.Attachment.AttachmentIndex,
-                                                      SRAttachment.Attachment.State,
-                                                      SRAttachment.TileSize);
-                                              });
+                           Ser.SerializeArrayRaw(Allocator, Subpass.pShadingRateAttachment, ShadingRateAttachCount);
                        });
 
-    Ser.SerializeArray(Allocator, RPDesc.pDependencies, RPDesc.DependencyCount,
-                       [](Serializer<Mode>&                 Ser,
-                          ConstQual<SubpassDependencyDesc>& Dep) //
-                       {
-                           Ser(Dep.SrcSubpass,
-                               Dep.DstSubpass,
-                               Dep.SrcStageMask,
-                               Dep.DstStageMask,
-                               Dep.SrcAccessMask,
-                               Dep.DstAccessMask);
-                       });
+    Ser.SerializeArrayRaw(Allocator, RPDesc.pDependencies, RPDesc.DependencyCount);
 
     ASSERT_SIZEOF64(RenderPassDesc, 56, "Did you add a new member to RenderPassDesc? Please add serialization here.");
     ASSERT_SIZEOF64(SubpassDesc, 72, "Did you add a new member to SubpassDesc? Please add serialization here.");
@@ -139,6 +139,18 @@ void ValidatePipelineResourceSignatureDesc(const PipelineResourceSignatureDesc&
             LOG_PRS_ERROR_AND_THROW("Desc.Resources[", i, "].Flags contain GENERAL_INPUT_ATTACHMENT which is only valid in Vulkan");
         }
 
+        if ((Res.Flags & PIPELINE_RESOURCE_FLAG_BINDLESS_HEAP) != 0)
+        {
+            if (!DeviceInfo.IsVulkanDevice())
+                LOG_PRS_ERROR_AND_THROW("Desc.Resources[", i, "].Flags contain BINDLESS_HEAP which is only valid in Vulkan");
+
+            if ((Res.Flags & PIPELINE_RESOURCE_FLAG_RUNTIME_ARRAY) == 0)
+                LOG_PRS_ERROR_AND_THROW("Desc.Resources[", i, "].Flags contain BINDLESS_HEAP, but not RUNTIME_ARRAY. Bindless heap resources must be run-time arrays.");
+
+            if ((Res.Flags & PIPELINE_RESOURCE_FLAG_COMBINED_SAMPLER) != 0)
+                LOG_PRS_ERROR_AND_THROW("Desc.Resources[", i, "].Flags contain BINDLESS_HEAP and COMBINED_SAMPLER. Bindless heap textures can't be combined with samplers.");
+        }
+
         Resources.emplace(Res.Name, Res);
 
         // NB: when creating immutable sampler array, we have to define the sampler as both resource and
@@ -45,13 +45,15 @@ void ResourceMappingImpl::AddResourceArray(const Char* Name, Uint32 StartIndex,
     if (Name == nullptr || *Name == 0)
         return;
 
+    const auto NameId = ResourceNameTable::GetInstance().Intern(Name);
+
     auto LockHelper = Lock();
     for (Uint32 Elem = 0; Elem < NumElements; ++Elem)
     {
         auto* pObject = ppObjects[Elem];
 
         // Try to construct new element in place
-        auto Elems = m_HashTable.emplace(ResMappingHashKey{Name, true /*Make copy*/, StartIndex + Elem}, pObject);
+        auto Elems = m_HashTable.emplace(ResMappingHashKey{NameId, StartIndex + Elem}, pObject);
         // If there is already element with the same name, replace it
         if (!Elems.second && Elems.first->second != pObject)
         {
@@ -75,13 +77,17 @@ void ResourceMappingImpl::AddResource(const Char* Name, IDeviceObject* pObject,
 
 void ResourceMappingImpl::RemoveResourceByName(const Char* Name, Uint32 ArrayIndex)
 {
-    if (*Name == 0)
+    if (Name == nullptr || *Name == 0)
+        return;
+
+    // If the name has never been interned, there is no resource with this name
+    const auto NameId = ResourceNameTable::GetInstance().Find(Name);
+    if (NameId == ResourceNameTable::InvalidNameId)
         return;
 
     auto LockHelper = Lock();
     // Remove object with the given name
-    // Name will be implicitly converted to HashMapStringKey without making a copy
-    m_HashTable.erase(ResMappingHashKey{Name, false, ArrayIndex});
+    m_HashTable.erase(ResMappingHashKey{NameId, ArrayIndex});
 }
 
 IDeviceObject* ResourceMappingImpl::GetResource(const Char* Name, Uint32 ArrayIndex)
@@ -92,10 +98,18 @@ IDeviceObject* ResourceMappingImpl::GetResource(const Char* Name, Uint32 ArrayIn
         return nullptr;
     }
 
+    return GetResource(ResourceNameTable::GetInstance().Find(Name), ArrayIndex);
+}
+
+IDeviceObject* ResourceMappingImpl::GetResource(Uint32 NameId, Uint32 ArrayIndex)
+{
+    if (NameId == ResourceNameTable::InvalidNameId)
+        return nullptr;
+
     auto LockHelper = Lock();
 
     // Find an object with the requested name
-    auto It = m_HashTable.find(ResMappingHashKey{Name, false, ArrayIndex});
+    auto It = m_HashTable.find(ResMappingHashKey{NameId, ArrayIndex});
     return It != m_HashTable.end() ? It->second.RawPtr() : nullptr;
 }
 
@@ -0,0 +1,98 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ResourceNameTable.hpp"
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+constexpr Uint32 ResourceNameTable::InvalidNameId;
+
+ResourceNameTable& ResourceNameTable::GetInstance()
+{
+    static ResourceNameTable Table;
+    return Table;
+}
+
+Uint32 ResourceNameTable::Intern(const Char* Name)
+{
+    if (Name == nullptr || *Name == '\0')
+    {
+        DEV_ERROR("Name must not be null or empty");
+        return InvalidNameId;
+    }
+
+    {
+        // Most names are already in the table, so try the shared look-up first.
+        std::shared_lock<std::shared_timed_mutex> ReadLock{m_Mtx};
+
+        auto It = m_NameToId.find(HashMapStringKey{Name});
+        if (It != m_NameToId.end())
+            return It->second;
+    }
+
+    std::lock_guard<std::shared_timed_mutex> Lock{m_Mtx};
+
+    // The name may have been added by another thread after the shared lock was released.
+    auto It = m_NameToId.find(HashMapStringKey{Name});
+    if (It != m_NameToId.end())
+        return It->second;
+
+    const auto NameId = static_cast<Uint32>(m_Names.size() + 1);
+
+    HashMapStringKey Key{Name, true /*Make copy*/};
+    m_Names.push_back(Key.GetStr());
+    m_NameToId.emplace(std::move(Key), NameId);
+
+    return NameId;
+}
+
+Uint32 ResourceNameTable::Find(const Char* Name) const
+{
+    if (Name == nullptr || *Name == '\0')
+        return InvalidNameId;
+
+    std::shared_lock<std::shared_timed_mutex> Lock{m_Mtx};
+
+    auto It = m_NameToId.find(HashMapStringKey{Name});
+    return It != m_NameToId.end() ? It->second : InvalidNameId;
+}
+
+const Char* ResourceNameTable::GetName(Uint32 NameId) const
+{
+    std::shared_lock<std::shared_timed_mutex> Lock{m_Mtx};
+    return (NameId != InvalidNameId && NameId <= m_Names.size()) ? m_Names[NameId - 1] : nullptr;
+}
+
+size_t ResourceNameTable::GetSize() const
+{
+    std::shared_lock<std::shared_timed_mutex> Lock{m_Mtx};
+    return m_Names.size();
+}
+
+} // namespace Diligent
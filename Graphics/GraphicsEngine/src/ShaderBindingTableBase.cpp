@@ -44,6 +44,11 @@ void ValidateShaderBindingTableDesc(const ShaderBindingTableDesc& Desc, Uint32 S
         LOG_SBT_ERROR_AND_THROW("pPSO must be ray tracing pipeline.");
     }
 
+    if (Desc.pPSO->GetStatus() != PIPELINE_STATE_STATUS_READY)
+    {
+        LOG_SBT_ERROR_AND_THROW("pPSO must be ready. Use IPipelineState::GetStatus() to check if the pipeline is ready.");
+    }
+
 
     const auto ShaderRecordSize   = Desc.pPSO->GetRayTracingPipelineDesc().ShaderRecordSize;
     const auto ShaderRecordStride = ShaderRecordSize + ShaderGroupHandleSize;
@@ -128,6 +128,9 @@ public:
         Uint32                            SRBAllocationGranularity) noexcept(false);
 
 private:
+    void InitializePipeline(const GraphicsPipelineStateCreateInfo& CreateInfo) noexcept(false);
+    void InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo) noexcept(false);
+
     template <typename PSOCreateInfoType>
     void InitInternalObjects(const PSOCreateInfoType& CreateInfo,
                              CComPtr<ID3DBlob>&       pVSByteCode);
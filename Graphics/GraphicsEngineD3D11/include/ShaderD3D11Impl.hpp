@@ -99,6 +99,8 @@ public:
     ID3D11DeviceChild* GetD3D11Shader(ID3DBlob* pBlob) noexcept(false);
 
 private:
+    void Initialize(const ShaderCreateInfo& ShaderCI, const CreateInfo& D3D11ShaderCI) noexcept(false);
+
     struct BlobHashKey
     {
         const size_t      Hash;
@@ -76,6 +76,7 @@ public:
     using ResourceAttribs = PipelineResourceAttribsD3D11;
 
     const PipelineResourceDesc& GetResourceDesc(Uint32 Index) const;
+    Uint32                      GetResourceNameId(Uint32 Index) const;
     const ResourceAttribs&      GetResourceAttribs(Uint32 Index) const;
 
 
@@ -183,9 +184,9 @@ public:
         __forceinline void BindResource(const BindResourceInfo& BindInfo);
     };
 
-    void BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags);
+    void BindResources(const ResourceMappingAccessor& ResMapping, BIND_SHADER_RESOURCES_FLAGS Flags);
 
-    void CheckResources(IResourceMapping*                    pResourceMapping,
+    void CheckResources(const ResourceMappingAccessor&       ResMapping,
                         BIND_SHADER_RESOURCES_FLAGS          Flags,
                         SHADER_RESOURCE_VARIABLE_TYPE_FLAGS& StaleVarTypes) const;
 
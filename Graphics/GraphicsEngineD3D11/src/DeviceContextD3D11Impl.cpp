@@ -82,6 +82,9 @@ void DeviceContextD3D11Impl::SetPipelineState(IPipelineState* pPipelineState)
     if (PipelineStateD3D11Impl::IsSameObject(m_pPipelineState, pPipelineStateD3D11))
         return;
 
+    if (!CheckPipelineStateStatus(pPipelineStateD3D11))
+        return;
+
     TDeviceContextBase::SetPipelineState(pPipelineStateD3D11, 0 /*Dummy*/);
     const auto& Desc = pPipelineStateD3D11->GetDesc();
     if (Desc.PipelineType == PIPELINE_TYPE_COMPUTE)
@@ -416,6 +419,7 @@ void DeviceContextD3D11Impl::BindShaderResources(Uint32 BindSRBMask)
             }
             BindDynamicCBs(*pResourceCache, BaseBindings);
         }
+        ++m_Stats.DescriptorSetBindCount;
     }
     m_BindInfo.StaleSRBMask &= ~m_BindInfo.ActiveSRBMask;
 
@@ -660,6 +664,7 @@ void DeviceContextD3D11Impl::PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE
 void DeviceContextD3D11Impl::Draw(const DrawAttribs& Attribs)
 {
     DvpVerifyDrawArguments(Attribs);
+    ++m_Stats.DrawCount;
 
     PrepareForDraw(Attribs.Flags);
 
@@ -675,6 +680,7 @@ void DeviceContextD3D11Impl::Draw(const DrawAttribs& Attribs)
 void DeviceContextD3D11Impl::DrawIndexed(const DrawIndexedAttribs& Attribs)
 {
     DvpVerifyDrawIndexedArguments(Attribs);
+    ++m_Stats.DrawCount;
 
     PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
 
@@ -687,9 +693,58 @@ void DeviceContextD3D11Impl::DrawIndexed(const DrawIndexedAttribs& Attribs)
     }
 }
 
+void DeviceContextD3D11Impl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    DvpVerifyMultiDrawArguments(Attribs);
+    m_Stats.DrawCount += Attribs.DrawCount;
+
+    PrepareForDraw(Attribs.Flags);
+
+    if (Attribs.NumInstances == 0)
+        return;
+
+    const bool IsInstanced = Attribs.NumInstances > 1 || Attribs.FirstInstanceLocation != 0;
+    for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+    {
+        const auto& Item = Attribs.pDrawItems[i];
+        if (Item.NumVertices == 0)
+            continue;
+
+        if (IsInstanced)
+            m_pd3d11DeviceContext->DrawInstanced(Item.NumVertices, Attribs.NumInstances, Item.StartVertexLocation, Attribs.FirstInstanceLocation);
+        else
+            m_pd3d11DeviceContext->Draw(Item.NumVertices, Item.StartVertexLocation);
+    }
+}
+
+void DeviceContextD3D11Impl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    DvpVerifyMultiDrawIndexedArguments(Attribs);
+    m_Stats.DrawCount += Attribs.DrawCount;
+
+    PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
+
+    if (Attribs.NumInstances == 0)
+        return;
+
+    const bool IsInstanced = Attribs.NumInstances > 1 || Attribs.FirstInstanceLocation != 0;
+    for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+    {
+        const auto& Item = Attribs.pDrawItems[i];
+        if (Item.NumIndices == 0)
+            continue;
+
+        if (IsInstanced)
+            m_pd3d11DeviceContext->DrawIndexedInstanced(Item.NumIndices, Attribs.NumInstances, Item.FirstIndexLocation, Item.BaseVertex, Attribs.FirstInstanceLocation);
+        else
+            m_pd3d11DeviceContext->DrawIndexed(Item.NumIndices, Item.FirstIndexLocation, Item.BaseVertex);
+    }
+}
+
 void DeviceContextD3D11Impl::DrawIndirect(const DrawIndirectAttribs& Attribs)
 {
     DvpVerifyDrawIndirectArguments(Attribs);
+    ++m_Stats.DrawCount;
     DEV_CHECK_ERR(Attribs.pCounterBuffer == nullptr, "Direct3D11 does not support indirect counter buffer");
 
     PrepareForDraw(Attribs.Flags);
@@ -724,6 +779,7 @@ void DeviceContextD3D11Impl::DrawIndirect(const DrawIndirectAttribs& Attribs)
 void DeviceContextD3D11Impl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs)
 {
     DvpVerifyDrawIndexedIndirectArguments(Attribs);
+    ++m_Stats.DrawCount;
     DEV_CHECK_ERR(Attribs.pCounterBuffer == nullptr, "Direct3D11 does not support indirect counter buffer");
 
     PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
@@ -767,6 +823,7 @@ void DeviceContextD3D11Impl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Att
 void DeviceContextD3D11Impl::DispatchCompute(const DispatchComputeAttribs& Attribs)
 {
     DvpVerifyDispatchArguments(Attribs);
+    ++m_Stats.DispatchCount;
 
     if (Uint32 BindSRBMask = m_BindInfo.GetCommitMask())
     {
@@ -797,6 +854,7 @@ void DeviceContextD3D11Impl::DispatchCompute(const DispatchComputeAttribs& Attri
 void DeviceContextD3D11Impl::DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs)
 {
     DvpVerifyDispatchIndirectArguments(Attribs);
+    ++m_Stats.DispatchCount;
 
     if (Uint32 BindSRBMask = m_BindInfo.GetCommitMask())
     {
@@ -866,6 +924,7 @@ void DeviceContextD3D11Impl::Flush()
 {
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Flushing device context inside an active render pass.");
     m_pd3d11DeviceContext->Flush();
+    ++m_Stats.FlushCount;
 }
 
 void DeviceContextD3D11Impl::UpdateBuffer(IBuffer*                       pBuffer,
@@ -2112,6 +2171,9 @@ void DeviceContextD3D11Impl::TransitionResource(TextureBaseD3D11& Texture, RESOU
         }
     }
 
+    if (OldState != NewState || NewState == RESOURCE_STATE_UNORDERED_ACCESS)
+        ++m_Stats.BarrierCount;
+
     if ((NewState & RESOURCE_STATE_UNORDERED_ACCESS) != 0)
     {
         DEV_CHECK_ERR((NewState & (RESOURCE_STATE_GENERIC_READ | RESOURCE_STATE_INPUT_ATTACHMENT)) == 0, "Unordered access state is not compatible with any input state");
@@ -2164,6 +2226,9 @@ void DeviceContextD3D11Impl::TransitionResource(BufferD3D11Impl& Buffer, RESOURC
         }
     }
 
+    if (OldState != NewState || NewState == RESOURCE_STATE_UNORDERED_ACCESS)
+        ++m_Stats.BarrierCount;
+
     if ((NewState & RESOURCE_STATE_UNORDERED_ACCESS) != 0)
     {
         DEV_CHECK_ERR((NewState & RESOURCE_STATE_GENERIC_READ) == 0, "Unordered access state is not compatible with any input state");
@@ -97,10 +97,17 @@ ShaderD3D11Impl::ShaderD3D11Impl(IReferenceCounters*     pRefCounters,
         D3D11ShaderCI.DeviceInfo,
         D3D11ShaderCI.AdapterInfo,
         IsDeviceInternal
-    },
-    ShaderD3DBase{ShaderCI, GetD3D11ShaderModel(D3D11ShaderCI.FeatureLevel, ShaderCI.HLSLVersion), nullptr}
+    }
 // clang-format on
 {
+    // D3D11ShaderCI only references objects owned by the device, so it is safe to copy it
+    ConstructShader(ShaderCI, [this, D3D11ShaderCI](const ShaderCreateInfo& CI) { Initialize(CI, D3D11ShaderCI); });
+}
+
+void ShaderD3D11Impl::Initialize(const ShaderCreateInfo& ShaderCI, const CreateInfo& D3D11ShaderCI) noexcept(false)
+{
+    ShaderD3DBase::Initialize(ShaderCI, GetD3D11ShaderModel(D3D11ShaderCI.FeatureLevel, ShaderCI.HLSLVersion), nullptr);
+
     // Load shader resources
     if ((ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_SKIP_REFLECTION) == 0)
     {
@@ -117,6 +124,7 @@ ShaderD3D11Impl::ShaderD3D11Impl(IReferenceCounters*     pRefCounters,
 
 ShaderD3D11Impl::~ShaderD3D11Impl()
 {
+    CancelAsyncInitialization();
 }
 
 void ShaderD3D11Impl::QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface)
@@ -103,6 +103,12 @@ const PipelineResourceDesc& ShaderVariableManagerD3D11::GetResourceDesc(Uint32 I
     return m_pSignature->GetResourceDesc(Index);
 }
 
+Uint32 ShaderVariableManagerD3D11::GetResourceNameId(Uint32 Index) const
+{
+    VERIFY_EXPR(m_pSignature);
+    return m_pSignature->GetResourceNameId(Index);
+}
+
 const PipelineResourceAttribsD3D11& ShaderVariableManagerD3D11::GetResourceAttribs(Uint32 Index) const
 {
     VERIFY_EXPR(m_pSignature);
@@ -454,7 +460,7 @@ void ShaderVariableManagerD3D11::BuffUAVBindInfo::BindResource(const BindResourc
 }
 
 
-void ShaderVariableManagerD3D11::CheckResources(IResourceMapping*                    pResourceMapping,
+void ShaderVariableManagerD3D11::CheckResources(const ResourceMappingAccessor&       ResMapping,
                                                 BIND_SHADER_RESOURCES_FLAGS          Flags,
                                                 SHADER_RESOURCE_VARIABLE_TYPE_FLAGS& StaleVarTypes) const
 {
@@ -467,34 +473,34 @@ void ShaderVariableManagerD3D11::CheckResources(IResourceMapping*
 
     HandleConstResources(
         [&](const ConstBuffBindInfo& cb) {
-            cb.CheckResources(pResourceMapping, Flags, StaleVarTypes);
+            cb.CheckResources(ResMapping, Flags, StaleVarTypes);
             return (StaleVarTypes & AllowedTypes) != AllowedTypes;
         },
         [&](const TexSRVBindInfo& ts) {
-            ts.CheckResources(pResourceMapping, Flags, StaleVarTypes);
+            ts.CheckResources(ResMapping, Flags, StaleVarTypes);
             return (StaleVarTypes & AllowedTypes) != AllowedTypes;
         },
         [&](const TexUAVBindInfo& uav) {
-            uav.CheckResources(pResourceMapping, Flags, StaleVarTypes);
+            uav.CheckResources(ResMapping, Flags, StaleVarTypes);
             return (StaleVarTypes & AllowedTypes) != AllowedTypes;
         },
         [&](const BuffSRVBindInfo& srv) {
-            srv.CheckResources(pResourceMapping, Flags, StaleVarTypes);
+            srv.CheckResources(ResMapping, Flags, StaleVarTypes);
             return (StaleVarTypes & AllowedTypes) != AllowedTypes;
         },
         [&](const BuffUAVBindInfo& uav) {
-            uav.CheckResources(pResourceMapping, Flags, StaleVarTypes);
+            uav.CheckResources(ResMapping, Flags, StaleVarTypes);
             return (StaleVarTypes & AllowedTypes) != AllowedTypes;
         },
         [&](const SamplerBindInfo& sam) {
-            sam.CheckResources(pResourceMapping, Flags, StaleVarTypes);
+            sam.CheckResources(ResMapping, Flags, StaleVarTypes);
             return (StaleVarTypes & AllowedTypes) != AllowedTypes;
         });
 }
 
-void ShaderVariableManagerD3D11::BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags)
+void ShaderVariableManagerD3D11::BindResources(const ResourceMappingAccessor& ResMapping, BIND_SHADER_RESOURCES_FLAGS Flags)
 {
-    if (pResourceMapping == nullptr)
+    if (!ResMapping)
     {
         LOG_ERROR_MESSAGE("Failed to bind resources: resource mapping is null");
         return;
@@ -505,22 +511,22 @@ void ShaderVariableManagerD3D11::BindResources(IResourceMapping* pResourceMappin
 
     HandleResources(
         [&](ConstBuffBindInfo& cb) {
-            cb.BindResources(pResourceMapping, Flags);
+            cb.BindResources(ResMapping, Flags);
         },
         [&](TexSRVBindInfo& ts) {
-            ts.BindResources(pResourceMapping, Flags);
+            ts.BindResources(ResMapping, Flags);
         },
         [&](TexUAVBindInfo& uav) {
-            uav.BindResources(pResourceMapping, Flags);
+            uav.BindResources(ResMapping, Flags);
         },
         [&](BuffSRVBindInfo& srv) {
-            srv.BindResources(pResourceMapping, Flags);
+            srv.BindResources(ResMapping, Flags);
         },
         [&](BuffUAVBindInfo& uav) {
-            uav.BindResources(pResourceMapping, Flags);
+            uav.BindResources(ResMapping, Flags);
         },
         [&](SamplerBindInfo& sam) {
-            sam.BindResources(pResourceMapping, Flags);
+            sam.BindResources(ResMapping, Flags);
         });
 }
 
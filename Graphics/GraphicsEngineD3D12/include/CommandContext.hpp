@@ -141,6 +141,7 @@ public:
         if (!m_PendingResourceBarriers.empty())
         {
             m_pCommandList->ResourceBarrier(static_cast<UINT>(m_PendingResourceBarriers.size()), m_PendingResourceBarriers.data());
+            m_ResourceBarrierCount += static_cast<Uint32>(m_PendingResourceBarriers.size());
             m_PendingResourceBarriers.clear();
         }
     }
@@ -182,9 +183,22 @@ public:
     {
         VERIFY(m_DynamicGPUDescriptorAllocators != nullptr, "Dynamic GPU descriptor allocators have not been initialized. Did you forget to call SetDynamicGPUDescriptorAllocators() after resetting the context?");
         VERIFY(Type >= D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV && Type <= D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER, "Invalid heap type");
+        ++m_DynamicDescriptorAllocationCount;
         return m_DynamicGPUDescriptorAllocators[Type].Allocate(Count);
     }
 
+    /// Returns the number of resource barriers recorded in the command list, including pending barriers.
+    Uint32 GetResourceBarrierCount() const
+    {
+        return m_ResourceBarrierCount + static_cast<Uint32>(m_PendingResourceBarriers.size());
+    }
+
+    /// Returns the number of descriptor ranges allocated from dynamic GPU descriptor heaps.
+    Uint32 GetDynamicDescriptorAllocationCount() const
+    {
+        return m_DynamicDescriptorAllocationCount;
+    }
+
     void ResourceBarrier(const D3D12_RESOURCE_BARRIER& Barrier)
     {
         m_PendingResourceBarriers.emplace_back(Barrier);
@@ -252,6 +266,10 @@ protected:
 
     std::vector<D3D12_RESOURCE_BARRIER, STDAllocatorRawMem<D3D12_RESOURCE_BARRIER>> m_PendingResourceBarriers;
 
+    // Command statistics, see DeviceContextD3D12Impl::AccumulateCmdContextStats()
+    Uint32 m_ResourceBarrierCount             = 0;
+    Uint32 m_DynamicDescriptorAllocationCount = 0;
+
     ShaderDescriptorHeaps m_BoundDescriptorHeaps;
 
     DynamicSuballocationsManager* m_DynamicGPUDescriptorAllocators = nullptr;
@@ -112,6 +112,10 @@ public:
         const LocalRootSignatureD3D12*    pLocalRootSig) noexcept(false);
 
 private:
+    void InitializePipeline(const GraphicsPipelineStateCreateInfo& CreateInfo) noexcept(false);
+    void InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo) noexcept(false);
+    void InitializePipeline(const RayTracingPipelineStateCreateInfo& CreateInfo) noexcept(false);
+
     template <typename PSOCreateInfoType>
     void InitInternalObjects(const PSOCreateInfoType& CreateInfo,
                              TShaderStages&           ShaderStages,
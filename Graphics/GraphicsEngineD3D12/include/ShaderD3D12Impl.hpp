@@ -86,6 +86,8 @@ public:
     const std::shared_ptr<const ShaderResourcesD3D12>& GetShaderResources() const { return m_pShaderResources; }
 
 private:
+    void Initialize(const ShaderCreateInfo& ShaderCI, const CreateInfo& D3D12ShaderCI) noexcept(false);
+
     // ShaderResources class instance must be referenced through the shared pointer, because
     // it is referenced by PipelineStateD3D12Impl class instances
     std::shared_ptr<const ShaderResourcesD3D12> m_pShaderResources;
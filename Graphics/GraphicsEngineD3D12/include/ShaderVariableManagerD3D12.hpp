@@ -108,9 +108,9 @@ public:
     IDeviceObject* Get(Uint32 ArrayIndex,
                        Uint32 ResIndex) const;
 
-    void BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags);
+    void BindResources(const ResourceMappingAccessor& ResMapping, BIND_SHADER_RESOURCES_FLAGS Flags);
 
-    void CheckResources(IResourceMapping*                    pResourceMapping,
+    void CheckResources(const ResourceMappingAccessor&       ResMapping,
                         BIND_SHADER_RESOURCES_FLAGS          Flags,
                         SHADER_RESOURCE_VARIABLE_TYPE_FLAGS& StaleVarTypes) const;
 
@@ -135,6 +135,7 @@ private:
 
     // These methods can't be defined in the header due to dependency on PipelineResourceSignatureD3D12Impl
     const PipelineResourceDesc& GetResourceDesc(Uint32 Index) const;
+    Uint32                      GetResourceNameId(Uint32 Index) const;
     const ResourceAttribs&      GetResourceAttribs(Uint32 Index) const;
 
 private:
@@ -86,6 +86,9 @@ void CommandContext::Reset(CommandListManager& CmdListManager)
     m_PendingResourceBarriers.clear();
     m_BoundDescriptorHeaps = ShaderDescriptorHeaps{};
 
+    m_ResourceBarrierCount             = 0;
+    m_DynamicDescriptorAllocationCount = 0;
+
     m_DynamicGPUDescriptorAllocators = nullptr;
 
     m_PrimitiveTopology = D3D_PRIMITIVE_TOPOLOGY_UNDEFINED;
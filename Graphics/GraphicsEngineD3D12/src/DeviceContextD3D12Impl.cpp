@@ -268,6 +268,9 @@ void DeviceContextD3D12Impl::SetPipelineState(IPipelineState* pPipelineState)
     if (PipelineStateD3D12Impl::IsSameObject(m_pPipelineState, pPipelineStateD3D12))
         return;
 
+    if (!CheckPipelineStateStatus(pPipelineStateD3D12))
+        return;
+
     const auto& PSODesc = pPipelineStateD3D12->GetDesc();
 
     bool CommitStates  = false;
@@ -631,6 +634,7 @@ void DeviceContextD3D12Impl::PrepareForDraw(GraphicsContext& GraphCtx, DRAW_FLAG
 #endif
     if (Uint32 CommitSRBMask = RootInfo.GetCommitMask(Flags & DRAW_FLAG_DYNAMIC_RESOURCE_BUFFERS_INTACT))
     {
+        m_Stats.DescriptorSetBindCount += PlatformMisc::CountOneBits(CommitSRBMask);
         CommitRootTablesAndViews<false>(RootInfo, CommitSRBMask, GraphCtx);
     }
 
@@ -666,6 +670,7 @@ void DeviceContextD3D12Impl::PrepareForIndexedDraw(GraphicsContext& GraphCtx, DR
 void DeviceContextD3D12Impl::Draw(const DrawAttribs& Attribs)
 {
     DvpVerifyDrawArguments(Attribs);
+    ++m_Stats.DrawCount;
 
     auto& GraphCtx = GetCmdContext().AsGraphicsContext();
     PrepareForDraw(GraphCtx, Attribs.Flags);
@@ -679,6 +684,7 @@ void DeviceContextD3D12Impl::Draw(const DrawAttribs& Attribs)
 void DeviceContextD3D12Impl::DrawIndexed(const DrawIndexedAttribs& Attribs)
 {
     DvpVerifyDrawIndexedArguments(Attribs);
+    ++m_Stats.DrawCount;
 
     auto& GraphCtx = GetCmdContext().AsGraphicsContext();
     PrepareForIndexedDraw(GraphCtx, Attribs.Flags, Attribs.IndexType);
@@ -689,6 +695,48 @@ void DeviceContextD3D12Impl::DrawIndexed(const DrawIndexedAttribs& Attribs)
     }
 }
 
+void DeviceContextD3D12Impl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    DvpVerifyMultiDrawArguments(Attribs);
+    m_Stats.DrawCount += Attribs.DrawCount;
+
+    auto& GraphCtx = GetCmdContext().AsGraphicsContext();
+    PrepareForDraw(GraphCtx, Attribs.Flags);
+    if (Attribs.NumInstances == 0)
+        return;
+
+    for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+    {
+        const auto& Item = Attribs.pDrawItems[i];
+        if (Item.NumVertices > 0)
+        {
+            GraphCtx.Draw(Item.NumVertices, Attribs.NumInstances, Item.StartVertexLocation, Attribs.FirstInstanceLocation);
+            ++m_State.NumCommands;
+        }
+    }
+}
+
+void DeviceContextD3D12Impl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    DvpVerifyMultiDrawIndexedArguments(Attribs);
+    m_Stats.DrawCount += Attribs.DrawCount;
+
+    auto& GraphCtx = GetCmdContext().AsGraphicsContext();
+    PrepareForIndexedDraw(GraphCtx, Attribs.Flags, Attribs.IndexType);
+    if (Attribs.NumInstances == 0)
+        return;
+
+    for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+    {
+        const auto& Item = Attribs.pDrawItems[i];
+        if (Item.NumIndices > 0)
+        {
+            GraphCtx.DrawIndexed(Item.NumIndices, Attribs.NumInstances, Item.FirstIndexLocation, Item.BaseVertex, Attribs.FirstInstanceLocation);
+            ++m_State.NumCommands;
+        }
+    }
+}
+
 void DeviceContextD3D12Impl::PrepareIndirectAttribsBuffer(CommandContext&                CmdCtx,
                                                           IBuffer*                       pAttribsBuffer,
                                                           RESOURCE_STATE_TRANSITION_MODE BufferStateTransitionMode,
@@ -714,6 +762,7 @@ void DeviceContextD3D12Impl::PrepareIndirectAttribsBuffer(CommandContext&
 void DeviceContextD3D12Impl::DrawIndirect(const DrawIndirectAttribs& Attribs)
 {
     DvpVerifyDrawIndirectArguments(Attribs);
+    ++m_Stats.DrawCount;
 
     auto& GraphCtx = GetCmdContext().AsGraphicsContext();
     PrepareForDraw(GraphCtx, Attribs.Flags);
@@ -750,6 +799,7 @@ void DeviceContextD3D12Impl::DrawIndirect(const DrawIndirectAttribs& Attribs)
 void DeviceContextD3D12Impl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs)
 {
     DvpVerifyDrawIndexedIndirectArguments(Attribs);
+    ++m_Stats.DrawCount;
 
     auto& GraphCtx = GetCmdContext().AsGraphicsContext();
     PrepareForIndexedDraw(GraphCtx, Attribs.Flags, Attribs.IndexType);
@@ -787,6 +837,7 @@ void DeviceContextD3D12Impl::DrawIndexedIndirect(const DrawIndexedIndirectAttrib
 void DeviceContextD3D12Impl::DrawMesh(const DrawMeshAttribs& Attribs)
 {
     DvpVerifyDrawMeshArguments(Attribs);
+    ++m_Stats.DrawCount;
 
     auto& GraphCtx = GetCmdContext().AsGraphicsContext6();
     PrepareForDraw(GraphCtx, Attribs.Flags);
@@ -801,6 +852,7 @@ void DeviceContextD3D12Impl::DrawMesh(const DrawMeshAttribs& Attribs)
 void DeviceContextD3D12Impl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attribs)
 {
     DvpVerifyDrawMeshIndirectArguments(Attribs);
+    ++m_Stats.DrawCount;
 
     auto& GraphCtx = GetCmdContext().AsGraphicsContext();
     PrepareForDraw(GraphCtx, Attribs.Flags);
@@ -839,6 +891,7 @@ void DeviceContextD3D12Impl::PrepareForDispatchCompute(ComputeContext& ComputeCt
 #endif
     if (Uint32 CommitSRBMask = RootInfo.GetCommitMask())
     {
+        m_Stats.DescriptorSetBindCount += PlatformMisc::CountOneBits(CommitSRBMask);
         CommitRootTablesAndViews<true>(RootInfo, CommitSRBMask, ComputeCtx);
     }
 }
@@ -851,6 +904,7 @@ void DeviceContextD3D12Impl::PrepareForDispatchRays(GraphicsContext& GraphCtx)
 #endif
     if (Uint32 CommitSRBMask = RootInfo.GetCommitMask())
     {
+        m_Stats.DescriptorSetBindCount += PlatformMisc::CountOneBits(CommitSRBMask);
         CommitRootTablesAndViews<true>(RootInfo, CommitSRBMask, GraphCtx);
     }
 }
@@ -858,6 +912,7 @@ void DeviceContextD3D12Impl::PrepareForDispatchRays(GraphicsContext& GraphCtx)
 void DeviceContextD3D12Impl::DispatchCompute(const DispatchComputeAttribs& Attribs)
 {
     DvpVerifyDispatchArguments(Attribs);
+    ++m_Stats.DispatchCount;
 
     auto& ComputeCtx = GetCmdContext().AsComputeContext();
     PrepareForDispatchCompute(ComputeCtx);
@@ -871,6 +926,7 @@ void DeviceContextD3D12Impl::DispatchCompute(const DispatchComputeAttribs& Attri
 void DeviceContextD3D12Impl::DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs)
 {
     DvpVerifyDispatchIndirectArguments(Attribs);
+    ++m_Stats.DispatchCount;
 
     auto& ComputeCtx = GetCmdContext().AsComputeContext();
     PrepareForDispatchCompute(ComputeCtx);
@@ -955,6 +1011,7 @@ void DeviceContextD3D12Impl::Flush(bool                 RequestNewCmdCtx,
     if (m_CurrCmdCtx)
     {
         VERIFY(!IsDeferred(), "Deferred contexts cannot execute command lists directly");
+        AccumulateCmdContextStats(*m_CurrCmdCtx);
         if (m_State.NumCommands != 0)
             Contexts.emplace_back(std::move(m_CurrCmdCtx));
         else
@@ -977,6 +1034,7 @@ void DeviceContextD3D12Impl::Flush(bool                 RequestNewCmdCtx,
     {
         m_pDevice->CloseAndExecuteCommandContexts(GetCommandQueueId(), static_cast<Uint32>(Contexts.size()), Contexts.data(), true, &m_SignalFences, &m_WaitFences);
         m_SignalFences.clear();
+        ++m_Stats.FlushCount;
 
 #ifdef DILIGENT_DEBUG
         for (Uint32 i = 0; i < NumCommandLists; ++i)
@@ -1568,6 +1626,14 @@ D3D12DynamicAllocation DeviceContextD3D12Impl::AllocateDynamicSpace(Uint64 NumBy
     return m_DynamicHeap.Allocate(NumBytes, Alignment, GetFrameNumber());
 }
 
+void DeviceContextD3D12Impl::AccumulateCmdContextStats(const CommandContext& CmdCtx)
+{
+    // Barriers and dynamic descriptors are recorded by the command context and are accounted
+    // for when the context is submitted or handed over to a command list.
+    m_Stats.BarrierCount += CmdCtx.GetResourceBarrierCount();
+    m_Stats.DescriptorSetAllocationCount += CmdCtx.GetDynamicDescriptorAllocationCount();
+}
+
 void DeviceContextD3D12Impl::UpdateBufferRegion(BufferD3D12Impl*               pBuffD3D12,
                                                 D3D12DynamicAllocation&        Allocation,
                                                 Uint64                         DstOffset,
@@ -1598,6 +1664,7 @@ void DeviceContextD3D12Impl::UpdateBuffer(IBuffer*                       pBuffer
     VERIFY(pBuffD3D12->GetDesc().Usage != USAGE_DYNAMIC, "Dynamic buffers must be updated via Map()");
     constexpr size_t DefaultAlignment = 16;
     auto             TmpSpace         = m_DynamicHeap.Allocate(Size, DefaultAlignment, GetFrameNumber());
+    m_Stats.UploadHeapBytes += Size;
     memcpy(TmpSpace.CPUAddress, pData, StaticCast<size_t>(Size));
     UpdateBufferRegion(pBuffD3D12, TmpSpace, Offset, Size, StateTransitionMode);
 }
@@ -1674,6 +1741,7 @@ void DeviceContextD3D12Impl::MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_F
             {
                 Uint32 Alignment = (BuffDesc.BindFlags & BIND_UNIFORM_BUFFER) ? D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT : 16;
                 DynamicData      = AllocateDynamicSpace(BuffDesc.Size, Alignment);
+                m_Stats.DynamicHeapBytes += BuffDesc.Size;
             }
             else
             {
@@ -2037,6 +2105,7 @@ DeviceContextD3D12Impl::TextureUploadSpace DeviceContextD3D12Impl::AllocateTextu
     UploadSpace.DepthStride   = UploadSpace.RowCount * UploadSpace.Stride;
     const auto MemorySize     = UpdateRegionDepth * UploadSpace.DepthStride;
     UploadSpace.Allocation    = AllocateDynamicSpace(MemorySize, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+    m_Stats.UploadHeapBytes += MemorySize;
     UploadSpace.AlignedOffset = (UploadSpace.Allocation.Offset + (D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT - 1)) & ~(D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT - 1);
     UploadSpace.Region        = Region;
 
@@ -2270,6 +2339,9 @@ void DeviceContextD3D12Impl::FinishCommandList(ICommandList** ppCommandList)
     DEV_CHECK_ERR(IsDeferred(), "Only deferred context can record command list");
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Finishing command list inside an active render pass.");
 
+    if (m_CurrCmdCtx)
+        AccumulateCmdContextStats(*m_CurrCmdCtx);
+
     CommandListD3D12Impl* pCmdListD3D12(NEW_RC_OBJ(m_CmdListAllocator, "CommandListD3D12Impl instance", CommandListD3D12Impl)(m_pDevice, this, std::move(m_CurrCmdCtx)));
     pCmdListD3D12->QueryInterface(IID_CommandList, reinterpret_cast<IObject**>(ppCommandList));
 
@@ -2742,6 +2814,7 @@ void DeviceContextD3D12Impl::BuildTLAS(const BuildTLASAttribs& Attribs)
     {
         size_t Size     = Attribs.InstanceCount * sizeof(D3D12_RAYTRACING_INSTANCE_DESC);
         auto   TmpSpace = m_DynamicHeap.Allocate(Size, 16, m_FrameNumber);
+        m_Stats.UploadHeapBytes += Size;
 
         for (Uint32 i = 0; i < Attribs.InstanceCount; ++i)
         {
@@ -99,15 +99,19 @@ ShaderD3D12Impl::ShaderD3D12Impl(IReferenceCounters*     pRefCounters,
         D3D12ShaderCI.AdapterInfo,
         IsDeviceInternal
     },
-    ShaderD3DBase
-    {
-        ShaderCI,
-        GetD3D12ShaderModel(ShaderCI.HLSLVersion, ShaderCI.ShaderCompiler, D3D12ShaderCI.pDXCompiler, D3D12ShaderCI.MaxShaderVersion),
-        D3D12ShaderCI.pDXCompiler
-    },
     m_EntryPoint{ShaderCI.EntryPoint}
 // clang-format on
 {
+    // D3D12ShaderCI only references objects owned by the device, so it is safe to copy it
+    ConstructShader(ShaderCI, [this, D3D12ShaderCI](const ShaderCreateInfo& CI) { Initialize(CI, D3D12ShaderCI); });
+}
+
+void ShaderD3D12Impl::Initialize(const ShaderCreateInfo& ShaderCI, const CreateInfo& D3D12ShaderCI) noexcept(false)
+{
+    ShaderD3DBase::Initialize(ShaderCI,
+                              GetD3D12ShaderModel(ShaderCI.HLSLVersion, ShaderCI.ShaderCompiler, D3D12ShaderCI.pDXCompiler, D3D12ShaderCI.MaxShaderVersion),
+                              D3D12ShaderCI.pDXCompiler);
+
     // Load shader resources
     if ((ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_SKIP_REFLECTION) == 0)
     {
@@ -126,6 +130,7 @@ ShaderD3D12Impl::ShaderD3D12Impl(IReferenceCounters*     pRefCounters,
 
 ShaderD3D12Impl::~ShaderD3D12Impl()
 {
+    CancelAsyncInitialization();
 }
 
 void ShaderD3D12Impl::QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface)
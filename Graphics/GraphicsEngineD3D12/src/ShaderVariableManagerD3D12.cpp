@@ -126,6 +126,12 @@ const PipelineResourceDesc& ShaderVariableManagerD3D12::GetResourceDesc(Uint32 I
     return m_pSignature->GetResourceDesc(Index);
 }
 
+Uint32 ShaderVariableManagerD3D12::GetResourceNameId(Uint32 Index) const
+{
+    VERIFY_EXPR(m_pSignature != nullptr);
+    return m_pSignature->GetResourceNameId(Index);
+}
+
 const ShaderVariableManagerD3D12::ResourceAttribs& ShaderVariableManagerD3D12::GetResourceAttribs(Uint32 Index) const
 {
     VERIFY_EXPR(m_pSignature != nullptr);
@@ -176,16 +182,16 @@ Uint32 ShaderVariableManagerD3D12::GetVariableIndex(const ShaderVariableD3D12Imp
     }
 }
 
-void ShaderVariableManagerD3D12::BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags)
+void ShaderVariableManagerD3D12::BindResources(const ResourceMappingAccessor& ResMapping, BIND_SHADER_RESOURCES_FLAGS Flags)
 {
-    TBase::BindResources(pResourceMapping, Flags);
+    TBase::BindResources(ResMapping, Flags);
 }
 
-void ShaderVariableManagerD3D12::CheckResources(IResourceMapping*                    pResourceMapping,
+void ShaderVariableManagerD3D12::CheckResources(const ResourceMappingAccessor&       ResMapping,
                                                 BIND_SHADER_RESOURCES_FLAGS          Flags,
                                                 SHADER_RESOURCE_VARIABLE_TYPE_FLAGS& StaleVarTypes) const
 {
-    TBase::CheckResources(pResourceMapping, Flags, StaleVarTypes);
+    TBase::CheckResources(ResMapping, Flags, StaleVarTypes);
 }
 
 namespace
@@ -209,6 +209,7 @@ public:
             Features.TextureUAVExtendedFormats     = DEVICE_FEATURE_STATE_ENABLED;
             Features.InstanceDataStepRate          = DEVICE_FEATURE_STATE_ENABLED;
             Features.TileShaders                   = DEVICE_FEATURE_STATE_DISABLED;
+            Features.AsyncShaderCompilation        = DEVICE_FEATURE_STATE_OPTIONAL;
         }
 
         // Set memory properties
@@ -42,10 +42,11 @@ namespace Diligent
 /// Base implementation of a D3D shader
 class ShaderD3DBase
 {
-public:
-    ShaderD3DBase(const ShaderCreateInfo& ShaderCI, ShaderVersion ShaderModel, class IDXCompiler* DxCompiler);
-
 protected:
+    /// Compiles the shader or loads its byte code. The method may be called
+    /// from a worker thread when the shader is compiled asynchronously.
+    void Initialize(const ShaderCreateInfo& ShaderCI, ShaderVersion ShaderModel, class IDXCompiler* DxCompiler) noexcept(false);
+
     CComPtr<ID3DBlob> m_pShaderByteCode;
 };
 
@@ -0,0 +1,77 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::BufferNullImpl class
+
+#include <vector>
+
+#include "EngineNullImplTraits.hpp"
+#include "BufferBase.hpp"
+#include "BufferViewNullImpl.hpp" // Required by BufferBase
+
+namespace Diligent
+{
+
+/// Buffer object implementation in Null backend.
+
+/// Buffer contents are kept in host memory. Memory is always allocated for dynamic,
+/// staging and unified buffers, since they can be mapped by the application. For other
+/// buffers, memory is only allocated when the device executes data transfer commands
+/// (see EngineNullCreateInfo::ExecuteCopies).
+class BufferNullImpl final : public BufferBase<EngineNullImplTraits>
+{
+public:
+    using TBufferBase = BufferBase<EngineNullImplTraits>;
+
+    BufferNullImpl(IReferenceCounters*        pRefCounters,
+                   FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
+                   RenderDeviceNullImpl*      pDevice,
+                   const BufferDesc&          BuffDesc,
+                   const BufferData*          pBuffData         = nullptr,
+                   bool                       bIsDeviceInternal = false);
+    ~BufferNullImpl();
+
+    /// Implementation of IBuffer::GetNativeHandle() in Null backend.
+    virtual Uint64 DILIGENT_CALL_TYPE GetNativeHandle() override final { return BitCast<Uint64>(GetData()); }
+
+    /// Implementation of IBuffer::GetSparseProperties() in Null backend.
+    virtual SparseBufferProperties DILIGENT_CALL_TYPE GetSparseProperties() const override final;
+
+    /// Returns a pointer to the buffer data in host memory, or null if the
+    /// buffer does not keep its contents.
+    Uint8* GetData() { return !m_Data.empty() ? m_Data.data() : nullptr; }
+
+private:
+    virtual void CreateViewInternal(const BufferViewDesc& ViewDesc, IBufferView** ppView, bool bIsDefaultView) override;
+
+    std::vector<Uint8> m_Data;
+};
+
+} // namespace Diligent
@@ -0,0 +1,84 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::FenceNullImpl class
+
+#include "EngineNullImplTraits.hpp"
+#include "FenceBase.hpp"
+
+namespace Diligent
+{
+
+/// Fence object implementation in Null backend.
+
+/// Commands are complete as soon as they are submitted, so the fence
+/// value is updated immediately when the fence is signaled.
+class FenceNullImpl final : public FenceBase<EngineNullImplTraits>
+{
+public:
+    using TFenceBase = FenceBase<EngineNullImplTraits>;
+
+    FenceNullImpl(IReferenceCounters*   pRefCounters,
+                  RenderDeviceNullImpl* pDevice,
+                  const FenceDesc&      Desc,
+                  bool                  bIsDeviceInternal = false) :
+        TFenceBase{pRefCounters, pDevice, Desc, bIsDeviceInternal}
+    {}
+
+    /// Implementation of IFence::GetCompletedValue() in Null backend.
+    virtual Uint64 DILIGENT_CALL_TYPE GetCompletedValue() override final
+    {
+        return m_LastCompletedFenceValue.load();
+    }
+
+    /// Implementation of IFence::Signal() in Null backend.
+    virtual void DILIGENT_CALL_TYPE Signal(Uint64 Value) override final
+    {
+        DEV_CHECK_ERR(m_Desc.Type == FENCE_TYPE_GENERAL, "Fence must have been created with FENCE_TYPE_GENERAL");
+        DvpSignal(Value);
+        UpdateLastCompletedFenceValue(Value);
+    }
+
+    /// Implementation of IFence::Wait() in Null backend.
+    virtual void DILIGENT_CALL_TYPE Wait(Uint64 Value) override final
+    {
+        DEV_CHECK_ERR(m_Desc.Type == FENCE_TYPE_GENERAL, "Fence must have been created with FENCE_TYPE_GENERAL");
+        DEV_CHECK_ERR(Value <= m_LastCompletedFenceValue.load(), "Waiting for value ", Value, " that has not been signaled will never complete");
+    }
+
+    /// Signals the fence from the device context.
+    void SignalFromContext(Uint64 Value)
+    {
+        DvpSignal(Value);
+        UpdateLastCompletedFenceValue(Value);
+    }
+};
+
+} // namespace Diligent
@@ -0,0 +1,152 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::ShaderResourceCacheNull class
+
+#include <memory>
+
+#include "EngineNullImplTraits.hpp"
+#include "ShaderResourceCacheCommon.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "STDAllocator.hpp"
+
+namespace Diligent
+{
+
+// All resources are stored in a continuous array, one slot per array element:
+//
+//   |   Res[0]   |   Res[1]   |  ...  |  Res[N-1]  |
+//
+// The slot index of the first element of every resource is given by
+// PipelineResourceAttribsNull::CacheOffset.
+class ShaderResourceCacheNull : public ShaderResourceCacheBase
+{
+public:
+    explicit ShaderResourceCacheNull(ResourceCacheContentType ContentType) noexcept :
+        m_ContentType{ContentType}
+    {}
+
+    ~ShaderResourceCacheNull();
+
+    // clang-format off
+    ShaderResourceCacheNull             (const ShaderResourceCacheNull&) = delete;
+    ShaderResourceCacheNull& operator = (const ShaderResourceCacheNull&) = delete;
+    ShaderResourceCacheNull             (ShaderResourceCacheNull&&)      = delete;
+    ShaderResourceCacheNull& operator = (ShaderResourceCacheNull&&)      = delete;
+    // clang-format on
+
+    struct Resource
+    {
+        /// Strong reference to the buffer, buffer view, texture view or sampler
+        RefCntAutoPtr<IDeviceObject> pObject;
+
+        /// Resource type, as defined by the signature
+        SHADER_RESOURCE_TYPE Type = SHADER_RESOURCE_TYPE_UNKNOWN;
+
+        /// For constant buffers, base offset and range size of the bound region
+        Uint64 BufferBaseOffset = 0;
+        Uint64 BufferRangeSize  = 0;
+
+        /// For constant buffers and structured buffers, dynamic offset set by SetBufferOffset()
+        Uint32 BufferDynamicOffset = 0;
+
+        // A buffer is dynamic if it is USAGE_DYNAMIC or if it is not bound as a whole
+        // and can thus use a dynamic offset.
+        bool IsDynamicBuffer() const;
+    };
+
+    static size_t GetRequiredMemorySize(Uint32 NumResources)
+    {
+        return sizeof(Resource) * NumResources;
+    }
+
+    void Initialize(Uint32 NumResources, IMemoryAllocator& MemAllocator);
+
+    void SetResource(Uint32                         CacheOffset,
+                     SHADER_RESOURCE_TYPE           Type,
+                     RefCntAutoPtr<IDeviceObject>&& pObject,
+                     Uint64                         BufferBaseOffset = 0,
+                     Uint64                         BufferRangeSize  = 0);
+
+    void ResetResource(Uint32 CacheOffset);
+
+    void SetDynamicBufferOffset(Uint32 CacheOffset, Uint32 DynamicBufferOffset);
+
+    const Resource& GetResource(Uint32 CacheOffset) const
+    {
+        VERIFY(CacheOffset < m_NumResources, "Cache offset (", CacheOffset, ") is out of range");
+        return m_pResources[CacheOffset];
+    }
+
+    Uint32 GetNumResources() const { return m_NumResources; }
+
+    bool IsInitialized() const { return m_IsInitialized; }
+
+    ResourceCacheContentType GetContentType() const { return m_ContentType; }
+
+    bool HasDynamicResources() const { return m_NumDynamicBuffers > 0; }
+
+#ifdef DILIGENT_DEVELOPMENT
+    void SetStaticResourcesInitialized()
+    {
+        m_bStaticResourcesInitialized = true;
+    }
+    bool StaticResourcesInitialized() const { return m_bStaticResourcesInitialized; }
+#endif
+
+    enum class StateTransitionMode
+    {
+        Transition,
+        Verify
+    };
+    // Transitions all resources in the cache
+    template <StateTransitionMode Mode>
+    void TransitionResourceStates(DeviceContextNullImpl& Ctx);
+
+private:
+    Resource* m_pResources   = nullptr;
+    Uint32    m_NumResources = 0;
+
+    // The number of dynamic buffers bound to the cache, see Resource::IsDynamicBuffer().
+    Uint32 m_NumDynamicBuffers = 0;
+
+    std::unique_ptr<Uint8, STDDeleter<Uint8, IMemoryAllocator>> m_pMemory;
+
+    bool m_IsInitialized = false;
+
+    // Indicates what types of resources are stored in the cache
+    const ResourceCacheContentType m_ContentType;
+
+#ifdef DILIGENT_DEVELOPMENT
+    bool m_bStaticResourcesInitialized = false;
+#endif
+};
+
+} // namespace Diligent
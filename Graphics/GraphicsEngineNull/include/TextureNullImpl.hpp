@@ -0,0 +1,81 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::TextureNullImpl class
+
+#include <vector>
+
+#include "EngineNullImplTraits.hpp"
+#include "TextureBase.hpp"
+#include "TextureViewNullImpl.hpp" // Required by TextureBase
+
+namespace Diligent
+{
+
+/// Texture object implementation in Null backend.
+
+/// All subresources are kept in a single host memory block using the same layout as
+/// staging textures (see GetStagingTextureSubresourceOffset()). Only one sample is stored
+/// for multisample textures. Memory is always allocated for dynamic and staging textures;
+/// for other textures, it is only allocated when the device executes data transfer
+/// commands (see EngineNullCreateInfo::ExecuteCopies).
+class TextureNullImpl final : public TextureBase<EngineNullImplTraits>
+{
+public:
+    using TTextureBase = TextureBase<EngineNullImplTraits>;
+
+    TextureNullImpl(IReferenceCounters*        pRefCounters,
+                    FixedBlockMemoryAllocator& TexViewObjAllocator,
+                    RenderDeviceNullImpl*      pDevice,
+                    const TextureDesc&         TexDesc,
+                    const TextureData*         pInitData         = nullptr,
+                    bool                       bIsDeviceInternal = false);
+    ~TextureNullImpl();
+
+    /// Implementation of ITexture::GetNativeHandle() in Null backend.
+    virtual Uint64 DILIGENT_CALL_TYPE GetNativeHandle() override final { return BitCast<Uint64>(GetData()); }
+
+    /// Returns a pointer to the texture data in host memory, or null if the
+    /// texture does not keep its contents.
+    Uint8* GetData() { return !m_Data.empty() ? m_Data.data() : nullptr; }
+
+    /// Returns the offset of the given subresource from the beginning of the texture data.
+    Uint64 GetSubresourceOffset(Uint32 MipLevel, Uint32 ArraySlice) const;
+
+    /// Alignment of every subresource in the texture data.
+    static constexpr Uint32 SubresourceAlignment = 16;
+
+private:
+    virtual void CreateViewInternal(const TextureViewDesc& ViewDesc, ITextureView** ppView, bool bIsDefaultView) override;
+
+    std::vector<Uint8> m_Data;
+};
+
+} // namespace Diligent
@@ -0,0 +1,122 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "BufferNullImpl.hpp"
+
+#include <cstring>
+
+#include "RenderDeviceNullImpl.hpp"
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+BufferNullImpl::BufferNullImpl(IReferenceCounters*        pRefCounters,
+                               FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
+                               RenderDeviceNullImpl*      pDeviceNull,
+                               const BufferDesc&          BuffDesc,
+                               const BufferData*          pBuffData /*= nullptr*/,
+                               bool                       bIsDeviceInternal) :
+    // clang-format off
+    TBufferBase
+    {
+        pRefCounters,
+        BuffViewObjMemAllocator,
+        pDeviceNull,
+        BuffDesc,
+        bIsDeviceInternal
+    }
+// clang-format on
+{
+    ValidateBufferInitData(BuffDesc, pBuffData);
+
+    if (m_Desc.Usage == USAGE_SPARSE)
+    {
+        LOG_ERROR_AND_THROW("Sparse buffers are not supported in Null backend");
+    }
+
+    // Mappable buffers always need storage, other buffers only need it when
+    // the data transfer commands are executed.
+    const bool IsMappable = m_Desc.Usage == USAGE_DYNAMIC || m_Desc.Usage == USAGE_STAGING || m_Desc.Usage == USAGE_UNIFIED;
+    if (IsMappable || pDeviceNull->ExecuteCopies())
+    {
+        m_Data.resize(StaticCast<size_t>(m_Desc.Size));
+        if (pBuffData != nullptr && pBuffData->pData != nullptr)
+        {
+            VERIFY_EXPR(pBuffData->DataSize <= m_Desc.Size);
+            memcpy(m_Data.data(), pBuffData->pData, StaticCast<size_t>(std::min(pBuffData->DataSize, m_Desc.Size)));
+        }
+    }
+
+    SetState(RESOURCE_STATE_UNDEFINED);
+
+    // Host memory is always coherent
+    m_MemoryProperties = MEMORY_PROPERTY_HOST_COHERENT;
+}
+
+BufferNullImpl::~BufferNullImpl()
+{
+}
+
+void BufferNullImpl::CreateViewInternal(const BufferViewDesc& OrigViewDesc, IBufferView** ppView, bool bIsDefaultView)
+{
+    VERIFY(ppView != nullptr, "Null pointer provided");
+    if (!ppView) return;
+    VERIFY(*ppView == nullptr, "Overwriting reference to existing object may cause memory leaks");
+
+    *ppView = nullptr;
+
+    try
+    {
+        auto* pDeviceNullImpl   = GetDevice();
+        auto& BuffViewAllocator = pDeviceNullImpl->GetBuffViewObjAllocator();
+        VERIFY(&BuffViewAllocator == &m_dbgBuffViewAllocator, "Buff view allocator does not match allocator provided at buffer initialization");
+
+        BufferViewDesc ViewDesc = OrigViewDesc;
+        ValidateAndCorrectBufferViewDesc(m_Desc, ViewDesc, pDeviceNullImpl->GetAdapterInfo().Buffer.StructuredBufferOffsetAlignment);
+
+        *ppView = NEW_RC_OBJ(BuffViewAllocator, "BufferViewNullImpl instance", BufferViewNullImpl, bIsDefaultView ? this : nullptr)(pDeviceNullImpl, ViewDesc, this, bIsDefaultView);
+
+        if (!bIsDefaultView && *ppView)
+            (*ppView)->AddRef();
+    }
+    catch (const std::runtime_error&)
+    {
+        const auto* ViewTypeName = GetBufferViewTypeLiteralName(OrigViewDesc.ViewType);
+        LOG_ERROR("Failed to create view \"", OrigViewDesc.Name ? OrigViewDesc.Name : "", "\" (", ViewTypeName, ") for buffer \"", m_Desc.Name, "\"");
+    }
+}
+
+SparseBufferProperties BufferNullImpl::GetSparseProperties() const
+{
+    DEV_ERROR("IBuffer::GetSparseProperties() is not supported in Null backend");
+    return {};
+}
+
+} // namespace Diligent
@@ -0,0 +1,934 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include <cstring>
+
+#include "DeviceContextNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+#include "CommandListNullImpl.hpp"
+#include "FenceNullImpl.hpp"
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Copies the texture region between two textures that use the staging layout
+// (see TextureNullImpl).
+void CopyTextureRegion(const TextureDesc& SrcDesc,
+                       const Uint8*       pSrcData,
+                       Uint32             SrcMipLevel,
+                       Uint32             SrcSlice,
+                       const Box&         SrcBox,
+                       const TextureDesc& DstDesc,
+                       Uint8*             pDstData,
+                       Uint32             DstMipLevel,
+                       Uint32             DstSlice,
+                       Uint32             DstX,
+                       Uint32             DstY,
+                       Uint32             DstZ)
+{
+    constexpr Uint32 Alignment = TextureNullImpl::SubresourceAlignment;
+
+    const auto CopyInfo    = GetBufferToTextureCopyInfo(SrcDesc.Format, SrcBox, 1);
+    const auto SrcMipProps = GetMipLevelProperties(SrcDesc, SrcMipLevel);
+    const auto DstMipProps = GetMipLevelProperties(DstDesc, DstMipLevel);
+
+    const auto SrcOffset = GetStagingTextureLocationOffset(SrcDesc, SrcSlice, SrcMipLevel, Alignment, SrcBox.MinX, SrcBox.MinY, SrcBox.MinZ);
+    const auto DstOffset = GetStagingTextureLocationOffset(DstDesc, DstSlice, DstMipLevel, Alignment, DstX, DstY, DstZ);
+
+    const TextureSubResData SrcSubres{pSrcData + SrcOffset, SrcMipProps.RowSize, SrcMipProps.DepthSliceSize};
+    CopyTextureSubresource(SrcSubres, CopyInfo.RowCount, SrcBox.Depth(), CopyInfo.RowSize,
+                           pDstData + DstOffset, DstMipProps.RowSize, DstMipProps.DepthSliceSize);
+}
+
+} // namespace
+
+DeviceContextNullImpl::DeviceContextNullImpl(IReferenceCounters*      pRefCounters,
+                                             RenderDeviceNullImpl*    pDevice,
+                                             const DeviceContextDesc& Desc) :
+    // clang-format off
+    TDeviceContextBase
+    {
+        pRefCounters,
+        pDevice,
+        Desc
+    },
+    m_CmdListAllocator{GetRawAllocator(), sizeof(CommandListNullImpl), 64}
+// clang-format on
+{
+}
+
+void DeviceContextNullImpl::Begin(Uint32 ImmediateContextId)
+{
+    DEV_CHECK_ERR(ImmediateContextId == 0, "Null backend supports only one immediate context");
+    TDeviceContextBase::Begin(DeviceContextIndex{ImmediateContextId}, COMMAND_QUEUE_TYPE_GRAPHICS);
+}
+
+void DeviceContextNullImpl::SetPipelineState(IPipelineState* pPipelineState)
+{
+    auto* pPipelineStateNull = ClassPtrCast<PipelineStateNullImpl>(pPipelineState);
+    if (PipelineStateNullImpl::IsSameObject(m_pPipelineState, pPipelineStateNull))
+        return;
+
+    if (!CheckPipelineStateStatus(pPipelineStateNull))
+        return;
+
+    TDeviceContextBase::SetPipelineState(pPipelineStateNull, 0 /*Dummy*/);
+
+    Uint32 DvpCompatibleSRBCount = 0;
+    PrepareCommittedResources(m_BindInfo, DvpCompatibleSRBCount);
+}
+
+void DeviceContextNullImpl::TransitionShaderResources(IPipelineState* pPipelineState, IShaderResourceBinding* pShaderResourceBinding)
+{
+    DEV_CHECK_ERR(pPipelineState != nullptr, "Pipeline state must not be null");
+    DEV_CHECK_ERR(pShaderResourceBinding != nullptr, "Shader resource binding must not be null");
+    if (m_pActiveRenderPass)
+    {
+        LOG_ERROR_MESSAGE("State transitions are not allowed inside a render pass.");
+        return;
+    }
+
+    auto* pShaderResBindingNull = ClassPtrCast<ShaderResourceBindingNullImpl>(pShaderResourceBinding);
+    auto& ResourceCache         = pShaderResBindingNull->GetResourceCache();
+
+    ResourceCache.TransitionResourceStates<ShaderResourceCacheNull::StateTransitionMode::Transition>(*this);
+}
+
+void DeviceContextNullImpl::CommitShaderResources(IShaderResourceBinding* pShaderResourceBinding, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    DeviceContextBase::CommitShaderResources(pShaderResourceBinding, StateTransitionMode, 0 /*Dummy*/);
+
+    auto* const pShaderResBindingNull = ClassPtrCast<ShaderResourceBindingNullImpl>(pShaderResourceBinding);
+    const auto  SRBIndex              = pShaderResBindingNull->GetBindingIndex();
+    auto&       ResourceCache         = pShaderResBindingNull->GetResourceCache();
+
+    m_BindInfo.Set(SRBIndex, pShaderResBindingNull);
+
+    if (StateTransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
+    {
+        ResourceCache.TransitionResourceStates<ShaderResourceCacheNull::StateTransitionMode::Transition>(*this);
+    }
+#ifdef DILIGENT_DEVELOPMENT
+    else if (StateTransitionMode == RESOURCE_STATE_TRANSITION_MODE_VERIFY)
+    {
+        ResourceCache.TransitionResourceStates<ShaderResourceCacheNull::StateTransitionMode::Verify>(*this);
+    }
+#endif
+}
+
+void DeviceContextNullImpl::CommitShaderResources()
+{
+    // There is nothing to bind in Null backend: mark all SRBs as committed.
+    m_Stats.DescriptorSetBindCount += PlatformMisc::CountOneBits(static_cast<Uint32>(m_BindInfo.StaleSRBMask & m_BindInfo.ActiveSRBMask));
+    m_BindInfo.StaleSRBMask &= ~m_BindInfo.ActiveSRBMask;
+}
+
+#ifdef DILIGENT_DEVELOPMENT
+void DeviceContextNullImpl::DvpValidateCommittedShaderResources()
+{
+    if (m_BindInfo.ResourcesValidated)
+        return;
+
+    DvpVerifySRBCompatibility(m_BindInfo);
+    m_BindInfo.ResourcesValidated = true;
+}
+#endif
+
+void DeviceContextNullImpl::SetStencilRef(Uint32 StencilRef)
+{
+    TDeviceContextBase::SetStencilRef(StencilRef, 0);
+}
+
+void DeviceContextNullImpl::SetBlendFactors(const float* pBlendFactors)
+{
+    TDeviceContextBase::SetBlendFactors(pBlendFactors, 0);
+}
+
+void DeviceContextNullImpl::PrepareForDraw(DRAW_FLAGS Flags)
+{
+#ifdef DILIGENT_DEVELOPMENT
+    if ((Flags & DRAW_FLAG_VERIFY_RENDER_TARGETS) != 0)
+        DvpVerifyRenderTargets();
+#endif
+
+    DEV_CHECK_ERR(m_NumVertexStreams >= m_pPipelineState->GetNumBufferSlotsUsed(), "Currently bound pipeline state '", m_pPipelineState->GetDesc().Name, "' expects ", m_pPipelineState->GetNumBufferSlotsUsed(), " input buffer slots, but only ", m_NumVertexStreams, " is bound");
+
+    if (m_BindInfo.GetCommitMask(Flags & DRAW_FLAG_DYNAMIC_RESOURCE_BUFFERS_INTACT) != 0)
+        CommitShaderResources();
+
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources();
+
+    if ((Flags & DRAW_FLAG_VERIFY_STATES) != 0)
+    {
+        for (Uint32 Slot = 0; Slot < m_NumVertexStreams; ++Slot)
+        {
+            if (auto* pBuffNull = m_VertexStreams[Slot].pBuffer.RawPtr())
+            {
+                DvpVerifyBufferState(*pBuffNull, RESOURCE_STATE_VERTEX_BUFFER, "Using vertex buffers (DeviceContextNullImpl::Draw)");
+            }
+        }
+    }
+#endif
+}
+
+void DeviceContextNullImpl::PrepareForIndexedDraw(DRAW_FLAGS Flags)
+{
+#ifdef DILIGENT_DEVELOPMENT
+    if ((Flags & DRAW_FLAG_VERIFY_STATES) != 0)
+    {
+        DvpVerifyBufferState(*m_pIndexBuffer, RESOURCE_STATE_INDEX_BUFFER, "Indexed draw call (DeviceContextNullImpl::Draw)");
+    }
+#endif
+    PrepareForDraw(Flags);
+}
+
+void DeviceContextNullImpl::PrepareForDispatch()
+{
+    if (m_BindInfo.GetCommitMask() != 0)
+        CommitShaderResources();
+
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources();
+#endif
+}
+
+void DeviceContextNullImpl::Draw(const DrawAttribs& Attribs)
+{
+    DvpVerifyDrawArguments(Attribs);
+    ++m_Stats.DrawCount;
+
+    PrepareForDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
+{
+    DvpVerifyDrawIndexedArguments(Attribs);
+    ++m_Stats.DrawCount;
+
+    PrepareForIndexedDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    DvpVerifyMultiDrawArguments(Attribs);
+    m_Stats.DrawCount += Attribs.DrawCount;
+
+    PrepareForDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    DvpVerifyMultiDrawIndexedArguments(Attribs);
+    m_Stats.DrawCount += Attribs.DrawCount;
+
+    PrepareForIndexedDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::DrawIndirect(const DrawIndirectAttribs& Attribs)
+{
+    DvpVerifyDrawIndirectArguments(Attribs);
+    ++m_Stats.DrawCount;
+
+    TransitionOrVerifyBufferState(*ClassPtrCast<BufferNullImpl>(Attribs.pAttribsBuffer), Attribs.AttribsBufferStateTransitionMode,
+                                  RESOURCE_STATE_INDIRECT_ARGUMENT, "Indirect draw (DeviceContextNullImpl::DrawIndirect)");
+    if (Attribs.pCounterBuffer != nullptr)
+    {
+        TransitionOrVerifyBufferState(*ClassPtrCast<BufferNullImpl>(Attribs.pCounterBuffer), Attribs.CounterBufferStateTransitionMode,
+                                      RESOURCE_STATE_INDIRECT_ARGUMENT, "Counter buffer (DeviceContextNullImpl::DrawIndirect)");
+    }
+
+    PrepareForDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs)
+{
+    DvpVerifyDrawIndexedIndirectArguments(Attribs);
+    ++m_Stats.DrawCount;
+
+    TransitionOrVerifyBufferState(*ClassPtrCast<BufferNullImpl>(Attribs.pAttribsBuffer), Attribs.AttribsBufferStateTransitionMode,
+                                  RESOURCE_STATE_INDIRECT_ARGUMENT, "Indirect draw (DeviceContextNullImpl::DrawIndexedIndirect)");
+    if (Attribs.pCounterBuffer != nullptr)
+    {
+        TransitionOrVerifyBufferState(*ClassPtrCast<BufferNullImpl>(Attribs.pCounterBuffer), Attribs.CounterBufferStateTransitionMode,
+                                      RESOURCE_STATE_INDIRECT_ARGUMENT, "Counter buffer (DeviceContextNullImpl::DrawIndexedIndirect)");
+    }
+
+    PrepareForIndexedDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::DrawMesh(const DrawMeshAttribs& Attribs)
+{
+    DvpVerifyDrawMeshArguments(Attribs);
+    ++m_Stats.DrawCount;
+
+    PrepareForDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attribs)
+{
+    DvpVerifyDrawMeshIndirectArguments(Attribs);
+    ++m_Stats.DrawCount;
+
+    TransitionOrVerifyBufferState(*ClassPtrCast<BufferNullImpl>(Attribs.pAttribsBuffer), Attribs.AttribsBufferStateTransitionMode,
+                                  RESOURCE_STATE_INDIRECT_ARGUMENT, "Indirect draw (DeviceContextNullImpl::DrawMeshIndirect)");
+    if (Attribs.pCounterBuffer != nullptr)
+    {
+        TransitionOrVerifyBufferState(*ClassPtrCast<BufferNullImpl>(Attribs.pCounterBuffer), Attribs.CounterBufferStateTransitionMode,
+                                      RESOURCE_STATE_INDIRECT_ARGUMENT, "Counter buffer (DeviceContextNullImpl::DrawMeshIndirect)");
+    }
+
+    PrepareForDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
+{
+    DvpVerifyDispatchArguments(Attribs);
+    ++m_Stats.DispatchCount;
+
+    PrepareForDispatch();
+}
+
+void DeviceContextNullImpl::DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs)
+{
+    DvpVerifyDispatchIndirectArguments(Attribs);
+    ++m_Stats.DispatchCount;
+
+    TransitionOrVerifyBufferState(*ClassPtrCast<BufferNullImpl>(Attribs.pAttribsBuffer), Attribs.AttribsBufferStateTransitionMode,
+                                  RESOURCE_STATE_INDIRECT_ARGUMENT, "Indirect dispatch (DeviceContextNullImpl::DispatchComputeIndirect)");
+
+    PrepareForDispatch();
+}
+
+void DeviceContextNullImpl::ClearDepthStencil(ITextureView*                  pView,
+                                              CLEAR_DEPTH_STENCIL_FLAGS      ClearFlags,
+                                              float                          fDepth,
+                                              Uint8                          Stencil,
+                                              RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::ClearDepthStencil(pView);
+
+    VERIFY_EXPR(pView != nullptr);
+
+    auto* pTexNull = ClassPtrCast<TextureViewNullImpl>(pView)->GetTexture<TextureNullImpl>();
+    if (!CheckIfBoundAsDepthStencil(pTexNull))
+    {
+        TransitionOrVerifyTextureState(*pTexNull, StateTransitionMode, RESOURCE_STATE_DEPTH_WRITE,
+                                       "Clearing depth-stencil buffer outside of render pass (DeviceContextNullImpl::ClearDepthStencil)");
+    }
+}
+
+void DeviceContextNullImpl::ClearRenderTarget(ITextureView* pView, const float* RGBA, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::ClearRenderTarget(pView);
+
+    VERIFY_EXPR(pView != nullptr);
+
+    auto* pTexNull = ClassPtrCast<TextureViewNullImpl>(pView)->GetTexture<TextureNullImpl>();
+    if (!CheckIfBoundAsRenderTarget(pTexNull))
+    {
+        TransitionOrVerifyTextureState(*pTexNull, StateTransitionMode, RESOURCE_STATE_RENDER_TARGET,
+                                       "Clearing render target outside of render pass (DeviceContextNullImpl::ClearRenderTarget)");
+    }
+}
+
+void DeviceContextNullImpl::Flush()
+{
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Flushing device context inside an active render pass.");
+
+    ++m_Stats.FlushCount;
+}
+
+void DeviceContextNullImpl::UpdateBuffer(IBuffer*                       pBuffer,
+                                         Uint64                         Offset,
+                                         Uint64                         Size,
+                                         const void*                    pData,
+                                         RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::UpdateBuffer(pBuffer, Offset, Size, pData, StateTransitionMode);
+
+    auto* pBuffNull = ClassPtrCast<BufferNullImpl>(pBuffer);
+    TransitionOrVerifyBufferState(*pBuffNull, StateTransitionMode, RESOURCE_STATE_COPY_DEST, "Updating buffer (DeviceContextNullImpl::UpdateBuffer)");
+
+    if (auto* pDstData = pBuffNull->GetData())
+        memcpy(pDstData + Offset, pData, StaticCast<size_t>(Size));
+}
+
+void DeviceContextNullImpl::CopyBuffer(IBuffer*                       pSrcBuffer,
+                                       Uint64                         SrcOffset,
+                                       RESOURCE_STATE_TRANSITION_MODE SrcBufferTransitionMode,
+                                       IBuffer*                       pDstBuffer,
+                                       Uint64                         DstOffset,
+                                       Uint64                         Size,
+                                       RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode)
+{
+    TDeviceContextBase::CopyBuffer(pSrcBuffer, SrcOffset, SrcBufferTransitionMode, pDstBuffer, DstOffset, Size, DstBufferTransitionMode);
+
+    auto* pSrcBuffNull = ClassPtrCast<BufferNullImpl>(pSrcBuffer);
+    auto* pDstBuffNull = ClassPtrCast<BufferNullImpl>(pDstBuffer);
+    TransitionOrVerifyBufferState(*pSrcBuffNull, SrcBufferTransitionMode, RESOURCE_STATE_COPY_SOURCE, "Using buffer as copy source (DeviceContextNullImpl::CopyBuffer)");
+    TransitionOrVerifyBufferState(*pDstBuffNull, DstBufferTransitionMode, RESOURCE_STATE_COPY_DEST, "Using buffer as copy destination (DeviceContextNullImpl::CopyBuffer)");
+
+    const auto* pSrcData = pSrcBuffNull->GetData();
+    auto*       pDstData = pDstBuffNull->GetData();
+    if (pSrcData != nullptr && pDstData != nullptr)
+        memmove(pDstData + DstOffset, pSrcData + SrcOffset, StaticCast<size_t>(Size));
+}
+
+void DeviceContextNullImpl::MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_FLAGS MapFlags, PVoid& pMappedData)
+{
+    TDeviceContextBase::MapBuffer(pBuffer, MapType, MapFlags, pMappedData);
+
+    auto* pBuffNull = ClassPtrCast<BufferNullImpl>(pBuffer);
+    pMappedData     = pBuffNull->GetData();
+    DEV_CHECK_ERR(pMappedData != nullptr, "Buffer '", pBuffNull->GetDesc().Name, "' does not have CPU-accessible storage");
+}
+
+void DeviceContextNullImpl::UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType)
+{
+    TDeviceContextBase::UnmapBuffer(pBuffer, MapType);
+}
+
+void DeviceContextNullImpl::UpdateTexture(ITexture*                      pTexture,
+                                          Uint32                         MipLevel,
+                                          Uint32                         Slice,
+                                          const Box&                     DstBox,
+                                          const TextureSubResData&       SubresData,
+                                          RESOURCE_STATE_TRANSITION_MODE SrcBufferTransitionMode,
+                                          RESOURCE_STATE_TRANSITION_MODE TextureTransitionMode)
+{
+    TDeviceContextBase::UpdateTexture(pTexture, MipLevel, Slice, DstBox, SubresData, SrcBufferTransitionMode, TextureTransitionMode);
+
+    auto* pTexNull = ClassPtrCast<TextureNullImpl>(pTexture);
+    TransitionOrVerifyTextureState(*pTexNull, TextureTransitionMode, RESOURCE_STATE_COPY_DEST, "Updating texture (DeviceContextNullImpl::UpdateTexture)");
+
+    TextureSubResData SrcSubres = SubresData;
+    if (SubresData.pSrcBuffer != nullptr)
+    {
+        auto* pSrcBuffNull = ClassPtrCast<BufferNullImpl>(SubresData.pSrcBuffer);
+        TransitionOrVerifyBufferState(*pSrcBuffNull, SrcBufferTransitionMode, RESOURCE_STATE_COPY_SOURCE, "Using buffer as copy source (DeviceContextNullImpl::UpdateTexture)");
+
+        const auto* pSrcData = pSrcBuffNull->GetData();
+        if (pSrcData == nullptr)
+            return;
+
+        SrcSubres.pData      = pSrcData + SubresData.SrcOffset;
+        SrcSubres.pSrcBuffer = nullptr;
+    }
+
+    auto* pDstData = pTexNull->GetData();
+    if (pDstData == nullptr)
+        return;
+
+    const auto& TexDesc     = pTexNull->GetDesc();
+    const auto  CopyInfo    = GetBufferToTextureCopyInfo(TexDesc.Format, DstBox, 1);
+    const auto  MipProps    = GetMipLevelProperties(TexDesc, MipLevel);
+    const auto  DstOffset   = GetStagingTextureLocationOffset(TexDesc, Slice, MipLevel, TextureNullImpl::SubresourceAlignment, DstBox.MinX, DstBox.MinY, DstBox.MinZ);
+    const auto  DepthStride = SrcSubres.DepthStride != 0 ? SrcSubres.DepthStride : SrcSubres.Stride * CopyInfo.RowCount;
+
+    SrcSubres.DepthStride = DepthStride;
+    CopyTextureSubresource(SrcSubres, CopyInfo.RowCount, DstBox.Depth(), CopyInfo.RowSize,
+                           pDstData + DstOffset, MipProps.RowSize, MipProps.DepthSliceSize);
+}
+
+void DeviceContextNullImpl::CopyTexture(const CopyTextureAttribs& CopyAttribs)
+{
+    TDeviceContextBase::CopyTexture(CopyAttribs);
+
+    auto* pSrcTexNull = ClassPtrCast<TextureNullImpl>(CopyAttribs.pSrcTexture);
+    auto* pDstTexNull = ClassPtrCast<TextureNullImpl>(CopyAttribs.pDstTexture);
+    TransitionOrVerifyTextureState(*pSrcTexNull, CopyAttribs.SrcTextureTransitionMode, RESOURCE_STATE_COPY_SOURCE, "Using texture as copy source (DeviceContextNullImpl::CopyTexture)");
+    TransitionOrVerifyTextureState(*pDstTexNull, CopyAttribs.DstTextureTransitionMode, RESOURCE_STATE_COPY_DEST, "Using texture as copy destination (DeviceContextNullImpl::CopyTexture)");
+
+    const auto* pSrcData = pSrcTexNull->GetData();
+    auto*       pDstData = pDstTexNull->GetData();
+    if (pSrcData == nullptr || pDstData == nullptr)
+        return;
+
+    const auto& SrcTexDesc = pSrcTexNull->GetDesc();
+
+    Box FullMipBox;
+    if (CopyAttribs.pSrcBox == nullptr)
+    {
+        const auto MipProps = GetMipLevelProperties(SrcTexDesc, CopyAttribs.SrcMipLevel);
+        FullMipBox.MaxX     = MipProps.LogicalWidth;
+        FullMipBox.MaxY     = MipProps.LogicalHeight;
+        FullMipBox.MaxZ     = MipProps.Depth;
+    }
+    const auto& SrcBox = CopyAttribs.pSrcBox != nullptr ? *CopyAttribs.pSrcBox : FullMipBox;
+
+    CopyTextureRegion(SrcTexDesc, pSrcData, CopyAttribs.SrcMipLevel, CopyAttribs.SrcSlice, SrcBox,
+                      pDstTexNull->GetDesc(), pDstData, CopyAttribs.DstMipLevel, CopyAttribs.DstSlice,
+                      CopyAttribs.DstX, CopyAttribs.DstY, CopyAttribs.DstZ);
+}
+
+void DeviceContextNullImpl::MapTextureSubresource(ITexture*                 pTexture,
+                                                  Uint32                    MipLevel,
+                                                  Uint32                    ArraySlice,
+                                                  MAP_TYPE                  MapType,
+                                                  MAP_FLAGS                 MapFlags,
+                                                  const Box*                pMapRegion,
+                                                  MappedTextureSubresource& MappedData)
+{
+    TDeviceContextBase::MapTextureSubresource(pTexture, MipLevel, ArraySlice, MapType, MapFlags, pMapRegion, MappedData);
+
+    auto* pTexNull = ClassPtrCast<TextureNullImpl>(pTexture);
+    auto* pData    = pTexNull->GetData();
+    if (pData == nullptr)
+    {
+        DEV_ERROR("Texture '", pTexNull->GetDesc().Name, "' does not have CPU-accessible storage");
+        MappedData = MappedTextureSubresource{};
+        return;
+    }
+
+    const auto& TexDesc  = pTexNull->GetDesc();
+    const auto  MipProps = GetMipLevelProperties(TexDesc, MipLevel);
+    const auto  Offset   = pMapRegion != nullptr ?
+        GetStagingTextureLocationOffset(TexDesc, ArraySlice, MipLevel, TextureNullImpl::SubresourceAlignment, pMapRegion->MinX, pMapRegion->MinY, pMapRegion->MinZ) :
+        pTexNull->GetSubresourceOffset(MipLevel, ArraySlice);
+
+    MappedData.pData       = pData + Offset;
+    MappedData.Stride      = MipProps.RowSize;
+    MappedData.DepthStride = MipProps.DepthSliceSize;
+}
+
+void DeviceContextNullImpl::UnmapTextureSubresource(ITexture* pTexture, Uint32 MipLevel, Uint32 ArraySlice)
+{
+    TDeviceContextBase::UnmapTextureSubresource(pTexture, MipLevel, ArraySlice);
+}
+
+void DeviceContextNullImpl::GenerateMips(ITextureView* pTextureView)
+{
+    TDeviceContextBase::GenerateMips(pTextureView);
+}
+
+void DeviceContextNullImpl::FinishFrame()
+{
+    TDeviceContextBase::EndFrame();
+}
+
+void DeviceContextNullImpl::SetVertexBuffers(Uint32                         StartSlot,
+                                             Uint32                         NumBuffersSet,
+                                             IBuffer**                      ppBuffers,
+                                             const Uint64*                  pOffsets,
+                                             RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
+                                             SET_VERTEX_BUFFERS_FLAGS       Flags)
+{
+    TDeviceContextBase::SetVertexBuffers(StartSlot, NumBuffersSet, ppBuffers, pOffsets, StateTransitionMode, Flags);
+    for (Uint32 Slot = 0; Slot < m_NumVertexStreams; ++Slot)
+    {
+        if (auto* pBuffNull = m_VertexStreams[Slot].pBuffer.RawPtr())
+        {
+            TransitionOrVerifyBufferState(*pBuffNull, StateTransitionMode, RESOURCE_STATE_VERTEX_BUFFER, "Setting vertex buffers (DeviceContextNullImpl::SetVertexBuffers)");
+        }
+    }
+}
+
+void DeviceContextNullImpl::SetIndexBuffer(IBuffer* pIndexBuffer, Uint64 ByteOffset, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::SetIndexBuffer(pIndexBuffer, ByteOffset, StateTransitionMode);
+
+    if (m_pIndexBuffer)
+    {
+        TransitionOrVerifyBufferState(*m_pIndexBuffer, StateTransitionMode, RESOURCE_STATE_INDEX_BUFFER, "Setting index buffer (DeviceContextNullImpl::SetIndexBuffer)");
+    }
+}
+
+void DeviceContextNullImpl::SetViewports(Uint32 NumViewports, const Viewport* pViewports, Uint32 RTWidth, Uint32 RTHeight)
+{
+    TDeviceContextBase::SetViewports(NumViewports, pViewports, RTWidth, RTHeight);
+}
+
+void DeviceContextNullImpl::SetScissorRects(Uint32 NumRects, const Rect* pRects, Uint32 RTWidth, Uint32 RTHeight)
+{
+    TDeviceContextBase::SetScissorRects(NumRects, pRects, RTWidth, RTHeight);
+}
+
+void DeviceContextNullImpl::SetRenderTargetsExt(const SetRenderTargetsAttribs& Attribs)
+{
+#ifdef DILIGENT_DEVELOPMENT
+    if (m_pActiveRenderPass != nullptr)
+    {
+        LOG_ERROR_MESSAGE("Calling SetRenderTargets inside active render pass is invalid. End the render pass first");
+        return;
+    }
+#endif
+
+    if (TDeviceContextBase::SetRenderTargets(Attribs))
+    {
+        for (Uint32 RT = 0; RT < m_NumBoundRenderTargets; ++RT)
+        {
+            if (m_pBoundRenderTargets[RT])
+            {
+                auto* pTexNull = m_pBoundRenderTargets[RT]->GetTexture<TextureNullImpl>();
+                TransitionOrVerifyTextureState(*pTexNull, Attribs.StateTransitionMode, RESOURCE_STATE_RENDER_TARGET,
+                                               "Setting render targets (DeviceContextNullImpl::SetRenderTargets)");
+            }
+        }
+
+        if (m_pBoundDepthStencil)
+        {
+            auto*      pTexNull  = m_pBoundDepthStencil->GetTexture<TextureNullImpl>();
+            const auto ViewType  = m_pBoundDepthStencil->GetDesc().ViewType;
+            const auto DSVState  = ViewType == TEXTURE_VIEW_DEPTH_STENCIL ? RESOURCE_STATE_DEPTH_WRITE : RESOURCE_STATE_DEPTH_READ;
+            TransitionOrVerifyTextureState(*pTexNull, Attribs.StateTransitionMode, DSVState,
+                                           "Setting depth-stencil buffer (DeviceContextNullImpl::SetRenderTargets)");
+        }
+
+        // Set the viewport to match the render target size
+        SetViewports(1, nullptr, 0, 0);
+    }
+}
+
+void DeviceContextNullImpl::BeginRenderPass(const BeginRenderPassAttribs& Attribs)
+{
+    TDeviceContextBase::BeginRenderPass(Attribs);
+    // BeginRenderPass() transitions resources to required states
+
+    // Set the viewport to match the framebuffer size
+    SetViewports(1, nullptr, 0, 0);
+}
+
+void DeviceContextNullImpl::NextSubpass()
+{
+    TDeviceContextBase::NextSubpass();
+}
+
+void DeviceContextNullImpl::EndRenderPass()
+{
+    TDeviceContextBase::EndRenderPass();
+}
+
+void DeviceContextNullImpl::InvalidateState()
+{
+    TDeviceContextBase::InvalidateState();
+
+    // Value-initialize the struct: copy-list-initialization would use the explicit RefCntWeakPtr constructor
+    m_BindInfo = CommittedShaderResources();
+}
+
+void DeviceContextNullImpl::FinishCommandList(ICommandList** ppCommandList)
+{
+    DEV_CHECK_ERR(IsDeferred(), "Only deferred contexts can record command list");
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Finishing command list inside an active render pass.");
+
+    CommandListNullImpl* pCmdListNull(NEW_RC_OBJ(m_CmdListAllocator, "CommandListNullImpl instance", CommandListNullImpl)(m_pDevice, this));
+    pCmdListNull->QueryInterface(IID_CommandList, reinterpret_cast<IObject**>(ppCommandList));
+
+    // Device context is now in default state
+    InvalidateState();
+
+    TDeviceContextBase::FinishCommandList();
+}
+
+void DeviceContextNullImpl::ExecuteCommandLists(Uint32               NumCommandLists,
+                                                ICommandList* const* ppCommandLists)
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Only immediate context can execute command list");
+
+    if (NumCommandLists == 0)
+        return;
+    DEV_CHECK_ERR(ppCommandLists != nullptr, "ppCommandLists must not be null when NumCommandLists is not zero");
+
+    // Commands recorded by deferred contexts have already been executed at record time.
+
+    // Device context is now in default state
+    InvalidateState();
+}
+
+void DeviceContextNullImpl::EnqueueSignal(IFence* pFence, Uint64 Value)
+{
+    TDeviceContextBase::EnqueueSignal(pFence, Value, 0);
+    ClassPtrCast<FenceNullImpl>(pFence)->SignalFromContext(Value);
+}
+
+void DeviceContextNullImpl::DeviceWaitForFence(IFence* pFence, Uint64 Value)
+{
+    TDeviceContextBase::DeviceWaitForFence(pFence, Value, 0);
+}
+
+void DeviceContextNullImpl::WaitForIdle()
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Only immediate contexts can be idled");
+    Flush();
+}
+
+void DeviceContextNullImpl::BeginQuery(IQuery* pQuery)
+{
+    TDeviceContextBase::BeginQuery(pQuery, 0);
+}
+
+void DeviceContextNullImpl::EndQuery(IQuery* pQuery)
+{
+    TDeviceContextBase::EndQuery(pQuery, 0);
+}
+
+void DeviceContextNullImpl::TransitionResourceStates(Uint32 BarrierCount, const StateTransitionDesc* pResourceBarriers)
+{
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+
+    for (Uint32 i = 0; i < BarrierCount; ++i)
+    {
+        const auto& Barrier = pResourceBarriers[i];
+#ifdef DILIGENT_DEVELOPMENT
+        DvpVerifyStateTransitionDesc(Barrier);
+#endif
+
+        if (Barrier.TransitionType == STATE_TRANSITION_TYPE_BEGIN)
+        {
+            // Skip begin-split barriers
+            VERIFY((Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) == 0, "Resource state can't be updated in begin-split barrier");
+            continue;
+        }
+        VERIFY(Barrier.TransitionType == STATE_TRANSITION_TYPE_IMMEDIATE || Barrier.TransitionType == STATE_TRANSITION_TYPE_END, "Unexpected barrier type");
+
+        if (Barrier.Flags & STATE_TRANSITION_FLAG_ALIASING)
+        {
+            // Aliasing barriers are no-ops in Null backend
+            continue;
+        }
+
+        DEV_CHECK_ERR(Barrier.NewState != RESOURCE_STATE_UNKNOWN, "New resource state can't be unknown");
+        const bool UpdateState = (Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) != 0;
+        if (RefCntAutoPtr<ITexture> pTexture{Barrier.pResource, IID_Texture})
+        {
+            TransitionResource(*pTexture.RawPtr<TextureNullImpl>(), Barrier.NewState, Barrier.OldState, UpdateState);
+        }
+        else if (RefCntAutoPtr<IBuffer> pBuffer{Barrier.pResource, IID_Buffer})
+        {
+            TransitionResource(*pBuffer.RawPtr<BufferNullImpl>(), Barrier.NewState, Barrier.OldState, UpdateState);
+        }
+        else
+        {
+            UNEXPECTED("The type of resource '", Barrier.pResource->GetDesc().Name, "' is not supported in Null backend");
+        }
+    }
+}
+
+void DeviceContextNullImpl::TransitionResource(TextureNullImpl& Texture, RESOURCE_STATE NewState, RESOURCE_STATE OldState, bool UpdateResourceState)
+{
+    if (OldState == RESOURCE_STATE_UNKNOWN)
+    {
+        if (!Texture.IsInKnownState())
+        {
+            LOG_ERROR_MESSAGE("Failed to transition the state of texture '", Texture.GetDesc().Name, "' because its state is unknown and is not explicitly specified");
+            return;
+        }
+    }
+    else
+    {
+        if (Texture.IsInKnownState() && Texture.GetState() != OldState)
+        {
+            LOG_ERROR_MESSAGE("The state ", GetResourceStateString(Texture.GetState()), " of texture '",
+                              Texture.GetDesc().Name, "' does not match the old state ", GetResourceStateString(OldState),
+                              " specified by the barrier");
+        }
+    }
+
+    const auto StateBefore = OldState != RESOURCE_STATE_UNKNOWN ? OldState : Texture.GetState();
+    if (StateBefore != NewState || NewState == RESOURCE_STATE_UNORDERED_ACCESS)
+        ++m_Stats.BarrierCount;
+
+    if (UpdateResourceState)
+    {
+        Texture.SetState(NewState);
+    }
+}
+
+void DeviceContextNullImpl::TransitionResource(BufferNullImpl& Buffer, RESOURCE_STATE NewState, RESOURCE_STATE OldState, bool UpdateResourceState)
+{
+    if (OldState == RESOURCE_STATE_UNKNOWN)
+    {
+        if (!Buffer.IsInKnownState())
+        {
+            LOG_ERROR_MESSAGE("Failed to transition the state of buffer '", Buffer.GetDesc().Name, "' because the buffer state is unknown and is not explicitly specified");
+            return;
+        }
+    }
+    else
+    {
+        if (Buffer.IsInKnownState() && Buffer.GetState() != OldState)
+        {
+            LOG_ERROR_MESSAGE("The state ", GetResourceStateString(Buffer.GetState()), " of buffer '",
+                              Buffer.GetDesc().Name, "' does not match the old state ", GetResourceStateString(OldState),
+                              " specified by the barrier");
+        }
+    }
+
+    const auto StateBefore = OldState != RESOURCE_STATE_UNKNOWN ? OldState : Buffer.GetState();
+    if (StateBefore != NewState || NewState == RESOURCE_STATE_UNORDERED_ACCESS)
+        ++m_Stats.BarrierCount;
+
+    if (UpdateResourceState)
+    {
+        Buffer.SetState(NewState);
+    }
+}
+
+void DeviceContextNullImpl::TransitionOrVerifyTextureState(TextureNullImpl&               Texture,
+                                                           RESOURCE_STATE_TRANSITION_MODE TransitionMode,
+                                                           RESOURCE_STATE                 RequiredState,
+                                                           const char*                    OperationName)
+{
+    if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
+    {
+        VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+        if (Texture.IsInKnownState() && !Texture.CheckState(RequiredState))
+            TransitionResource(Texture, RequiredState);
+    }
+#ifdef DILIGENT_DEVELOPMENT
+    else if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_VERIFY)
+    {
+        DvpVerifyTextureState(Texture, RequiredState, OperationName);
+    }
+#endif
+}
+
+void DeviceContextNullImpl::TransitionOrVerifyBufferState(BufferNullImpl&                Buffer,
+                                                          RESOURCE_STATE_TRANSITION_MODE TransitionMode,
+                                                          RESOURCE_STATE                 RequiredState,
+                                                          const char*                    OperationName)
+{
+    if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
+    {
+        VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+        if (Buffer.IsInKnownState() && !Buffer.CheckState(RequiredState))
+            TransitionResource(Buffer, RequiredState);
+    }
+#ifdef DILIGENT_DEVELOPMENT
+    else if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_VERIFY)
+    {
+        DvpVerifyBufferState(Buffer, RequiredState, OperationName);
+    }
+#endif
+}
+
+void DeviceContextNullImpl::ResolveTextureSubresource(ITexture*                               pSrcTexture,
+                                                      ITexture*                               pDstTexture,
+                                                      const ResolveTextureSubresourceAttribs& ResolveAttribs)
+{
+    TDeviceContextBase::ResolveTextureSubresource(pSrcTexture, pDstTexture, ResolveAttribs);
+
+    auto* pSrcTexNull = ClassPtrCast<TextureNullImpl>(pSrcTexture);
+    auto* pDstTexNull = ClassPtrCast<TextureNullImpl>(pDstTexture);
+    TransitionOrVerifyTextureState(*pSrcTexNull, ResolveAttribs.SrcTextureTransitionMode, RESOURCE_STATE_RESOLVE_SOURCE, "Resolving multi-sampled texture (DeviceContextNullImpl::ResolveTextureSubresource)");
+    TransitionOrVerifyTextureState(*pDstTexNull, ResolveAttribs.DstTextureTransitionMode, RESOURCE_STATE_RESOLVE_DEST, "Resolving multi-sampled texture (DeviceContextNullImpl::ResolveTextureSubresource)");
+
+    // Only one sample is stored, so resolve is a plain copy
+    const auto* pSrcData = pSrcTexNull->GetData();
+    auto*       pDstData = pDstTexNull->GetData();
+    if (pSrcData == nullptr || pDstData == nullptr)
+        return;
+
+    const auto& SrcTexDesc = pSrcTexNull->GetDesc();
+    const auto  MipProps   = GetMipLevelProperties(SrcTexDesc, ResolveAttribs.SrcMipLevel);
+
+    Box SrcBox;
+    SrcBox.MaxX = MipProps.LogicalWidth;
+    SrcBox.MaxY = MipProps.LogicalHeight;
+    CopyTextureRegion(SrcTexDesc, pSrcData, ResolveAttribs.SrcMipLevel, ResolveAttribs.SrcSlice, SrcBox,
+                      pDstTexNull->GetDesc(), pDstData, ResolveAttribs.DstMipLevel, ResolveAttribs.DstSlice,
+                      0, 0, 0);
+}
+
+void DeviceContextNullImpl::BuildBLAS(const BuildBLASAttribs& Attribs)
+{
+    UNSUPPORTED("BuildBLAS is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::BuildTLAS(const BuildTLASAttribs& Attribs)
+{
+    UNSUPPORTED("BuildTLAS is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::CopyBLAS(const CopyBLASAttribs& Attribs)
+{
+    UNSUPPORTED("CopyBLAS is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::CopyTLAS(const CopyTLASAttribs& Attribs)
+{
+    UNSUPPORTED("CopyTLAS is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::WriteBLASCompactedSize(const WriteBLASCompactedSizeAttribs& Attribs)
+{
+    UNSUPPORTED("WriteBLASCompactedSize is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::WriteTLASCompactedSize(const WriteTLASCompactedSizeAttribs& Attribs)
+{
+    UNSUPPORTED("WriteTLASCompactedSize is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::TraceRays(const TraceRaysAttribs& Attribs)
+{
+    UNSUPPORTED("TraceRays is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::TraceRaysIndirect(const TraceRaysIndirectAttribs& Attribs)
+{
+    UNSUPPORTED("TraceRaysIndirect is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::UpdateSBT(IShaderBindingTable* pSBT, const UpdateIndirectRTBufferAttribs* pUpdateIndirectBufferAttribs)
+{
+    UNSUPPORTED("UpdateSBT is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::SetShadingRate(SHADING_RATE BaseRate, SHADING_RATE_COMBINER PrimitiveCombiner, SHADING_RATE_COMBINER TextureCombiner)
+{
+    UNSUPPORTED("SetShadingRate is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::BindSparseResourceMemory(const BindSparseResourceMemoryAttribs& Attribs)
+{
+    UNSUPPORTED("BindSparseResourceMemory is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::BeginDebugGroup(const Char* Name, const float* pColor)
+{
+    TDeviceContextBase::BeginDebugGroup(Name, pColor, 0);
+}
+
+void DeviceContextNullImpl::EndDebugGroup()
+{
+    TDeviceContextBase::EndDebugGroup(0);
+}
+
+void DeviceContextNullImpl::InsertDebugLabel(const Char* Label, const float* pColor)
+{
+    TDeviceContextBase::InsertDebugLabel(Label, pColor, 0);
+}
+
+} // namespace Diligent
@@ -0,0 +1,266 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+/// \file
+/// Routines that initialize Null engine implementation
+
+#include "pch.h"
+
+#include <cstring>
+
+#include "EngineFactoryNull.h"
+#include "RenderDeviceNullImpl.hpp"
+#include "DeviceContextNullImpl.hpp"
+#include "SwapChainNullImpl.hpp"
+#include "EngineMemory.h"
+#include "EngineFactoryBase.hpp"
+
+namespace Diligent
+{
+
+/// Engine factory for Null implementation
+class EngineFactoryNullImpl : public EngineFactoryBase<IEngineFactoryNull>
+{
+public:
+    static EngineFactoryNullImpl* GetInstance()
+    {
+        static EngineFactoryNullImpl TheFactory;
+        return &TheFactory;
+    }
+
+    using TBase = EngineFactoryBase<IEngineFactoryNull>;
+
+    EngineFactoryNullImpl() :
+        TBase{IID_EngineFactoryNull, nullptr}
+    {}
+
+    virtual void DILIGENT_CALL_TYPE CreateDeviceAndContextsNull(const EngineNullCreateInfo& EngineCI,
+                                                                IRenderDevice**             ppDevice,
+                                                                IDeviceContext**            ppContexts) override final;
+
+    virtual void DILIGENT_CALL_TYPE CreateSwapChainNull(IRenderDevice*       pDevice,
+                                                        IDeviceContext*      pImmediateContext,
+                                                        const SwapChainDesc& SCDesc,
+                                                        ISwapChain**         ppSwapChain) override final;
+
+    virtual void DILIGENT_CALL_TYPE EnumerateAdapters(Version              MinVersion,
+                                                      Uint32&              NumAdapters,
+                                                      GraphicsAdapterInfo* Adapters) const override final;
+
+#if PLATFORM_ANDROID
+    virtual void DILIGENT_CALL_TYPE InitAndroidFileSystem(struct ANativeActivity* NativeActivity,
+                                                          const char*             NativeActivityClassName,
+                                                          struct AAssetManager*   AssetManager) const override final
+    {
+    }
+#endif
+};
+
+
+void EngineFactoryNullImpl::CreateDeviceAndContextsNull(const EngineNullCreateInfo& EngineCI,
+                                                        IRenderDevice**             ppDevice,
+                                                        IDeviceContext**            ppContexts)
+{
+    if (EngineCI.DebugMessageCallback != nullptr)
+        SetDebugMessageCallback(EngineCI.DebugMessageCallback);
+
+    if (EngineCI.EngineAPIVersion != DILIGENT_API_VERSION)
+    {
+        LOG_ERROR_MESSAGE("Diligent Engine runtime (", DILIGENT_API_VERSION, ") is not compatible with the client API version (", EngineCI.EngineAPIVersion, ")");
+        return;
+    }
+
+    VERIFY(ppDevice && ppContexts, "Null pointer provided");
+    if (!ppDevice || !ppContexts)
+        return;
+
+    const auto NumImmediateContexts = std::max(1u, EngineCI.NumImmediateContexts);
+
+    *ppDevice = nullptr;
+    memset(ppContexts, 0, sizeof(*ppContexts) * (NumImmediateContexts + EngineCI.NumDeferredContexts));
+
+    if (NumImmediateContexts > 1)
+    {
+        LOG_ERROR_MESSAGE("Null backend does not support multiple immediate contexts");
+        return;
+    }
+
+    try
+    {
+        const auto AdapterInfo = RenderDeviceNullImpl::GetNullAdapterInfo();
+        VerifyEngineCreateInfo(EngineCI, AdapterInfo);
+
+        SetRawAllocator(EngineCI.pRawMemAllocator);
+        auto& RawAllocator = GetRawAllocator();
+
+        RenderDeviceNullImpl* pRenderDeviceNull{
+            NEW_RC_OBJ(RawAllocator, "RenderDeviceNullImpl instance", RenderDeviceNullImpl)(
+                RawAllocator, this, EngineCI, AdapterInfo) //
+        };
+        pRenderDeviceNull->QueryInterface(IID_RenderDevice, reinterpret_cast<IObject**>(ppDevice));
+
+        RefCntAutoPtr<DeviceContextNullImpl> pDeviceContextNull{
+            NEW_RC_OBJ(RawAllocator, "DeviceContextNullImpl instance", DeviceContextNullImpl)(
+                pRenderDeviceNull,
+                DeviceContextDesc{
+                    EngineCI.pImmediateContextInfo ? EngineCI.pImmediateContextInfo[0].Name : nullptr,
+                    pRenderDeviceNull->GetAdapterInfo().Queues[0].QueueType,
+                    False, // IsDefered
+                    0,     // Context id
+                    0      // Queue id
+                }          //
+                )};
+        // We must call AddRef() (implicitly through QueryInterface()) because pRenderDeviceNull will
+        // keep a weak reference to the context
+        pDeviceContextNull->QueryInterface(IID_DeviceContext, reinterpret_cast<IObject**>(ppContexts));
+        pRenderDeviceNull->SetImmediateContext(0, pDeviceContextNull);
+
+        for (Uint32 DeferredCtx = 0; DeferredCtx < EngineCI.NumDeferredContexts; ++DeferredCtx)
+        {
+            RefCntAutoPtr<DeviceContextNullImpl> pDeferredCtxNull{
+                NEW_RC_OBJ(RawAllocator, "DeviceContextNullImpl instance", DeviceContextNullImpl)(
+                    pRenderDeviceNull,
+                    DeviceContextDesc{
+                        nullptr,
+                        COMMAND_QUEUE_TYPE_UNKNOWN,
+                        true,
+                        1 + DeferredCtx // Context id
+                    }                   //
+                    )};
+            // We must call AddRef() (implicitly through QueryInterface()) because pRenderDeviceNull will
+            // keep a weak reference to the context
+            pDeferredCtxNull->QueryInterface(IID_DeviceContext, reinterpret_cast<IObject**>(ppContexts + 1 + DeferredCtx));
+            pRenderDeviceNull->SetDeferredContext(DeferredCtx, pDeferredCtxNull);
+        }
+    }
+    catch (const std::runtime_error&)
+    {
+        if (*ppDevice)
+        {
+            (*ppDevice)->Release();
+            *ppDevice = nullptr;
+        }
+        for (Uint32 ctx = 0; ctx < NumImmediateContexts + EngineCI.NumDeferredContexts; ++ctx)
+        {
+            if (ppContexts[ctx] != nullptr)
+            {
+                ppContexts[ctx]->Release();
+                ppContexts[ctx] = nullptr;
+            }
+        }
+
+        LOG_ERROR("Failed to initialize Null device and contexts");
+    }
+}
+
+
+void EngineFactoryNullImpl::CreateSwapChainNull(IRenderDevice*       pDevice,
+                                                IDeviceContext*      pImmediateContext,
+                                                const SwapChainDesc& SCDesc,
+                                                ISwapChain**         ppSwapChain)
+{
+    VERIFY(ppSwapChain, "Null pointer provided");
+    if (!ppSwapChain)
+        return;
+
+    *ppSwapChain = nullptr;
+
+    try
+    {
+        auto* pDeviceNull        = ClassPtrCast<RenderDeviceNullImpl>(pDevice);
+        auto* pDeviceContextNull = ClassPtrCast<DeviceContextNullImpl>(pImmediateContext);
+        auto& RawMemAllocator    = GetRawAllocator();
+
+        auto* pSwapChainNull = NEW_RC_OBJ(RawMemAllocator, "SwapChainNullImpl instance", SwapChainNullImpl)(SCDesc, pDeviceNull, pDeviceContextNull);
+        pSwapChainNull->QueryInterface(IID_SwapChain, reinterpret_cast<IObject**>(ppSwapChain));
+    }
+    catch (const std::runtime_error&)
+    {
+        if (*ppSwapChain)
+        {
+            (*ppSwapChain)->Release();
+            *ppSwapChain = nullptr;
+        }
+
+        LOG_ERROR("Failed to create the swap chain");
+    }
+}
+
+
+void EngineFactoryNullImpl::EnumerateAdapters(Version              MinVersion,
+                                              Uint32&              NumAdapters,
+                                              GraphicsAdapterInfo* Adapters) const
+{
+    if (Adapters == nullptr)
+    {
+        NumAdapters = 1;
+        return;
+    }
+
+    if (NumAdapters > 0)
+    {
+        Adapters[0] = RenderDeviceNullImpl::GetNullAdapterInfo();
+        NumAdapters = 1;
+    }
+}
+
+
+#ifdef DOXYGEN
+/// Loads Null engine implementation and exports factory functions
+///
+/// \return      - Pointer to the function that returns factory for Null engine implementation
+///                See Diligent::EngineFactoryNullImpl.
+///
+/// \remarks Depending on the configuration and platform, the function loads different dll:
+///
+/// Platform\\Configuration   |           Debug               |        Release
+/// --------------------------|-------------------------------|----------------------------
+///         x86               | GraphicsEngineNull_32d.dll    |    GraphicsEngineNull_32r.dll
+///         x64               | GraphicsEngineNull_64d.dll    |    GraphicsEngineNull_64r.dll
+///
+GetEngineFactoryNullType LoadGraphicsEngineNull()
+{
+// This function is only required because DoxyGen refuses to generate documentation for a static function when SHOW_FILES==NO
+#    error This function must never be compiled;
+}
+#endif
+
+
+IEngineFactoryNull* GetEngineFactoryNull()
+{
+    return EngineFactoryNullImpl::GetInstance();
+}
+
+} // namespace Diligent
+
+extern "C"
+{
+    Diligent::IEngineFactoryNull* Diligent_GetEngineFactoryNull()
+    {
+        return Diligent::GetEngineFactoryNull();
+    }
+}
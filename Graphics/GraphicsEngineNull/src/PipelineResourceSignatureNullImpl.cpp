@@ -0,0 +1,183 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "PipelineResourceSignatureNullImpl.hpp"
+
+#include <algorithm>
+
+#include "RenderDeviceNullImpl.hpp"
+
+namespace Diligent
+{
+
+PipelineResourceSignatureNullImpl::PipelineResourceSignatureNullImpl(IReferenceCounters*                  pRefCounters,
+                                                                     RenderDeviceNullImpl*                pDeviceNull,
+                                                                     const PipelineResourceSignatureDesc& Desc,
+                                                                     SHADER_TYPE                          ShaderStages,
+                                                                     bool                                 bIsDeviceInternal) :
+    TPipelineResourceSignatureBase{pRefCounters, pDeviceNull, Desc, ShaderStages, bIsDeviceInternal}
+{
+    try
+    {
+        Initialize(
+            GetRawAllocator(), Desc, m_ImmutableSamplers,
+            [this]() //
+            {
+                CreateLayout();
+            },
+            [this]() //
+            {
+                return ShaderResourceCacheNull::GetRequiredMemorySize(m_NumCacheSlots);
+            });
+    }
+    catch (...)
+    {
+        Destruct();
+        throw;
+    }
+}
+
+void PipelineResourceSignatureNullImpl::CreateLayout()
+{
+    Uint32 StaticCacheSize = 0;
+
+    for (Uint32 s = 0; s < m_Desc.NumImmutableSamplers; ++s)
+        GetDevice()->CreateSampler(m_Desc.ImmutableSamplers[s].Desc, &m_ImmutableSamplers[s]);
+
+    for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
+    {
+        const auto& ResDesc = m_Desc.Resources[i];
+        VERIFY(i == 0 || ResDesc.VarType >= m_Desc.Resources[i - 1].VarType, "Resources must be sorted by variable type");
+
+        auto ImtblSamplerIdx = InvalidImmutableSamplerIndex;
+        auto SamplerIdx      = ResourceAttribs::InvalidSamplerInd;
+        if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER)
+        {
+            ImtblSamplerIdx = FindImmutableSampler(ResDesc.ShaderStages, ResDesc.Name);
+            if (ImtblSamplerIdx != InvalidImmutableSamplerIndex)
+            {
+                // Immutable samplers have no space in the cache
+                new (m_pResourceAttribs + i) ResourceAttribs{ResourceAttribs::InvalidCacheOffset, ImtblSamplerIdx, true};
+                continue;
+            }
+        }
+        else if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_TEXTURE_SRV)
+        {
+            ImtblSamplerIdx = FindImmutableSampler(ResDesc.ShaderStages, ResDesc.Name);
+            if (ImtblSamplerIdx != InvalidImmutableSamplerIndex)
+                SamplerIdx = ImtblSamplerIdx;
+            else
+                SamplerIdx = FindAssignedSampler(ResDesc, ResourceAttribs::InvalidSamplerInd);
+        }
+
+        new (m_pResourceAttribs + i) ResourceAttribs //
+            {
+                m_NumCacheSlots,
+                SamplerIdx,
+                ImtblSamplerIdx != InvalidImmutableSamplerIndex // _ImtblSamplerAssigned
+            };
+
+        m_NumCacheSlots += ResDesc.ArraySize;
+
+        if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
+        {
+            // Since resources in the static cache are indexed by the same offsets, we need to
+            // make sure that there is enough space in the cache.
+            StaticCacheSize = std::max(StaticCacheSize, m_NumCacheSlots);
+        }
+    }
+
+    if (m_pStaticResCache)
+    {
+        m_pStaticResCache->Initialize(StaticCacheSize, GetRawAllocator());
+    }
+}
+
+PipelineResourceSignatureNullImpl::~PipelineResourceSignatureNullImpl()
+{
+    Destruct();
+}
+
+void PipelineResourceSignatureNullImpl::Destruct()
+{
+    if (m_ImmutableSamplers != nullptr)
+    {
+        for (Uint32 s = 0; s < m_Desc.NumImmutableSamplers; ++s)
+            m_ImmutableSamplers[s].~SamplerPtr();
+
+        m_ImmutableSamplers = nullptr;
+    }
+
+    TPipelineResourceSignatureBase::Destruct();
+}
+
+void PipelineResourceSignatureNullImpl::CopyStaticResources(ShaderResourceCacheNull& DstResourceCache) const
+{
+    if (m_pStaticResCache == nullptr)
+        return;
+
+    // SrcResourceCache contains only static resources.
+    // DstResourceCache contains static, mutable and dynamic resources.
+    const auto& SrcResourceCache = *m_pStaticResCache;
+
+    VERIFY_EXPR(SrcResourceCache.GetContentType() == ResourceCacheContentType::Signature);
+    VERIFY_EXPR(DstResourceCache.GetContentType() == ResourceCacheContentType::SRB);
+
+    const auto StaticResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+    for (Uint32 r = StaticResIdxRange.first; r < StaticResIdxRange.second; ++r)
+    {
+        const auto& ResDesc = GetResourceDesc(r);
+        const auto& ResAttr = GetResourceAttribs(r);
+        VERIFY_EXPR(ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+
+        if (ResAttr.CacheOffset == ResourceAttribs::InvalidCacheOffset)
+            continue; // Skip immutable samplers
+
+        for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+        {
+            const auto  CacheOffset = ResAttr.CacheOffset + ArrInd;
+            const auto& SrcRes      = SrcResourceCache.GetResource(CacheOffset);
+            if (!SrcRes.pObject)
+                LOG_ERROR_MESSAGE("No resource is assigned to static shader variable '", GetShaderResourcePrintName(ResDesc, ArrInd), "' in pipeline resource signature '", m_Desc.Name, "'.");
+
+            DstResourceCache.SetResource(CacheOffset, SrcRes.Type, RefCntAutoPtr<IDeviceObject>{SrcRes.pObject}, SrcRes.BufferBaseOffset, SrcRes.BufferRangeSize);
+        }
+    }
+
+#ifdef DILIGENT_DEVELOPMENT
+    DstResourceCache.SetStaticResourcesInitialized();
+#endif
+}
+
+void PipelineResourceSignatureNullImpl::InitSRBResourceCache(ShaderResourceCacheNull& ResourceCache)
+{
+    ResourceCache.Initialize(m_NumCacheSlots, m_SRBMemAllocator.GetResourceCacheDataAllocator(0));
+}
+
+} // namespace Diligent
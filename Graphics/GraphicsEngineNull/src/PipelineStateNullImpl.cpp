@@ -0,0 +1,117 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "PipelineStateNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+#include "FixedLinearAllocator.hpp"
+
+namespace Diligent
+{
+
+template <typename PSOCreateInfoType>
+void PipelineStateNullImpl::InitInternalObjects(const PSOCreateInfoType& CreateInfo)
+{
+    TShaderStages ShaderStages;
+    ExtractShaders<ShaderNullImpl>(CreateInfo, ShaderStages);
+
+    FixedLinearAllocator MemPool{GetRawAllocator()};
+
+    ReserveSpaceForPipelineDesc(CreateInfo, MemPool);
+
+    MemPool.Reserve();
+
+    InitializePipelineDesc(CreateInfo, MemPool);
+
+    if (m_UsingImplicitSignature)
+    {
+        // Null shaders are not reflected, so the implicit signature may only contain
+        // immutable samplers from the resource layout. Resources must be defined
+        // through explicit resource signatures.
+        if (m_Desc.ResourceLayout.NumVariables > 0)
+        {
+            LOG_WARNING_MESSAGE("Pipeline state '", m_Desc.Name, "' defines ", m_Desc.ResourceLayout.NumVariables,
+                                " variable(s) in the resource layout, which will be ignored as Null backend does not perform "
+                                "shader reflection. Use explicit resource signatures to define shader resources.");
+        }
+
+        PipelineResourceSignatureDescWrapper SignDesc{m_Desc.Name, m_Desc.ResourceLayout, m_Desc.SRBAllocationGranularity};
+        // Always initialize default resource signature as internal device object.
+        // This is necessary to avoid cyclic references.
+        constexpr bool bIsDeviceInternal = true;
+        InitDefaultSignature(SignDesc, GetActiveShaderStages(), bIsDeviceInternal);
+        VERIFY_EXPR(m_Signatures[0]);
+    }
+}
+
+PipelineStateNullImpl::PipelineStateNullImpl(IReferenceCounters*                    pRefCounters,
+                                             RenderDeviceNullImpl*                  pDevice,
+                                             const GraphicsPipelineStateCreateInfo& CreateInfo,
+                                             bool                                   IsDeviceInternal) :
+    TPipelineStateBase{pRefCounters, pDevice, CreateInfo, IsDeviceInternal}
+{
+    try
+    {
+        ConstructPipeline(CreateInfo, [this](const auto& CI) { InitInternalObjects(CI); });
+    }
+    catch (...)
+    {
+        Destruct();
+        throw;
+    }
+}
+
+PipelineStateNullImpl::PipelineStateNullImpl(IReferenceCounters*                   pRefCounters,
+                                             RenderDeviceNullImpl*                 pDevice,
+                                             const ComputePipelineStateCreateInfo& CreateInfo,
+                                             bool                                  IsDeviceInternal) :
+    TPipelineStateBase{pRefCounters, pDevice, CreateInfo, IsDeviceInternal}
+{
+    try
+    {
+        ConstructPipeline(CreateInfo, [this](const auto& CI) { InitInternalObjects(CI); });
+    }
+    catch (...)
+    {
+        Destruct();
+        throw;
+    }
+}
+
+PipelineStateNullImpl::~PipelineStateNullImpl()
+{
+    CancelAsyncInitialization();
+    Destruct();
+}
+
+void PipelineStateNullImpl::Destruct()
+{
+    TPipelineStateBase::Destruct();
+}
+
+} // namespace Diligent
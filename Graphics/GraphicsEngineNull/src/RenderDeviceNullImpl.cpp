@@ -0,0 +1,372 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "RenderDeviceNullImpl.hpp"
+
+#include <cstring>
+
+#include "DeviceContextNullImpl.hpp"
+#include "BufferNullImpl.hpp"
+#include "TextureNullImpl.hpp"
+#include "ShaderNullImpl.hpp"
+#include "SamplerNullImpl.hpp"
+#include "FenceNullImpl.hpp"
+#include "QueryNullImpl.hpp"
+#include "RenderPassNullImpl.hpp"
+#include "FramebufferNullImpl.hpp"
+#include "PipelineStateNullImpl.hpp"
+#include "PipelineResourceSignatureNullImpl.hpp"
+#include "ShaderResourceBindingNullImpl.hpp"
+
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+class BottomLevelASNullImpl
+{};
+class TopLevelASNullImpl
+{};
+class ShaderBindingTableNullImpl
+{};
+class DeviceMemoryNullImpl
+{};
+
+RenderDeviceNullImpl::RenderDeviceNullImpl(IReferenceCounters*         pRefCounters,
+                                           IMemoryAllocator&           RawMemAllocator,
+                                           IEngineFactory*             pEngineFactory,
+                                           const EngineNullCreateInfo& EngineCI,
+                                           const GraphicsAdapterInfo&  AdapterInfo) :
+    // clang-format off
+    TRenderDeviceBase
+    {
+        pRefCounters,
+        RawMemAllocator,
+        pEngineFactory,
+        EngineCI,
+        AdapterInfo
+    },
+    m_ExecuteCopies{EngineCI.ExecuteCopies}
+// clang-format on
+{
+    m_DeviceInfo.Type       = RENDER_DEVICE_TYPE_NULL;
+    m_DeviceInfo.APIVersion = Version{1, 0};
+
+    // Initialize device features
+    m_DeviceInfo.Features = EnableDeviceFeatures(m_AdapterInfo.Features, EngineCI.Features);
+
+    // All formats are stored in host memory, so every format is supported
+    for (Uint32 Fmt = TEX_FORMAT_UNKNOWN + 1; Fmt < TEX_FORMAT_NUM_FORMATS; ++Fmt)
+        m_TextureFormatsInfo[Fmt].Supported = true;
+}
+
+RenderDeviceNullImpl::~RenderDeviceNullImpl()
+{
+}
+
+void RenderDeviceNullImpl::TestTextureFormat(TEXTURE_FORMAT TexFormat)
+{
+    auto& TexFormatInfo = m_TextureFormatsInfo[TexFormat];
+    VERIFY(TexFormatInfo.Supported, "Texture format is not supported");
+
+    switch (TexFormatInfo.ComponentType)
+    {
+        case COMPONENT_TYPE_DEPTH:
+        case COMPONENT_TYPE_DEPTH_STENCIL:
+            TexFormatInfo.BindFlags    = BIND_SHADER_RESOURCE | BIND_DEPTH_STENCIL;
+            TexFormatInfo.Dimensions   = RESOURCE_DIMENSION_SUPPORT_TEX_1D | RESOURCE_DIMENSION_SUPPORT_TEX_1D_ARRAY |
+                RESOURCE_DIMENSION_SUPPORT_TEX_2D | RESOURCE_DIMENSION_SUPPORT_TEX_2D_ARRAY |
+                RESOURCE_DIMENSION_SUPPORT_TEX_CUBE | RESOURCE_DIMENSION_SUPPORT_TEX_CUBE_ARRAY;
+            TexFormatInfo.SampleCounts = SAMPLE_COUNT_1 | SAMPLE_COUNT_2 | SAMPLE_COUNT_4 | SAMPLE_COUNT_8;
+            TexFormatInfo.Filterable   = True;
+            break;
+
+        case COMPONENT_TYPE_COMPRESSED:
+            TexFormatInfo.BindFlags    = BIND_SHADER_RESOURCE;
+            TexFormatInfo.Dimensions   = RESOURCE_DIMENSION_SUPPORT_TEX_2D | RESOURCE_DIMENSION_SUPPORT_TEX_2D_ARRAY |
+                RESOURCE_DIMENSION_SUPPORT_TEX_CUBE | RESOURCE_DIMENSION_SUPPORT_TEX_CUBE_ARRAY;
+            TexFormatInfo.SampleCounts = SAMPLE_COUNT_1;
+            TexFormatInfo.Filterable   = True;
+            break;
+
+        default:
+            TexFormatInfo.BindFlags    = BIND_SHADER_RESOURCE | BIND_RENDER_TARGET | BIND_UNORDERED_ACCESS;
+            TexFormatInfo.Dimensions   = RESOURCE_DIMENSION_SUPPORT_TEX_1D | RESOURCE_DIMENSION_SUPPORT_TEX_1D_ARRAY |
+                RESOURCE_DIMENSION_SUPPORT_TEX_2D | RESOURCE_DIMENSION_SUPPORT_TEX_2D_ARRAY |
+                RESOURCE_DIMENSION_SUPPORT_TEX_3D |
+                RESOURCE_DIMENSION_SUPPORT_TEX_CUBE | RESOURCE_DIMENSION_SUPPORT_TEX_CUBE_ARRAY;
+            TexFormatInfo.SampleCounts = SAMPLE_COUNT_1 | SAMPLE_COUNT_2 | SAMPLE_COUNT_4 | SAMPLE_COUNT_8;
+            TexFormatInfo.Filterable   =
+                TexFormatInfo.ComponentType != COMPONENT_TYPE_SINT &&
+                TexFormatInfo.ComponentType != COMPONENT_TYPE_UINT;
+            break;
+    }
+}
+
+GraphicsAdapterInfo RenderDeviceNullImpl::GetNullAdapterInfo()
+{
+    GraphicsAdapterInfo AdapterInfo;
+
+    strncpy(AdapterInfo.Description, "Null device", _countof(AdapterInfo.Description) - 1);
+    AdapterInfo.Type       = ADAPTER_TYPE_SOFTWARE;
+    AdapterInfo.Vendor     = ADAPTER_VENDOR_UNKNOWN;
+    AdapterInfo.NumOutputs = 0;
+
+    // Enable features that do not require shader compilation or GPU execution
+    {
+        auto& Features{AdapterInfo.Features};
+        Features.SeparablePrograms                 = DEVICE_FEATURE_STATE_ENABLED;
+        Features.WireframeFill                     = DEVICE_FEATURE_STATE_ENABLED;
+        Features.MultithreadedResourceCreation     = DEVICE_FEATURE_STATE_ENABLED;
+        Features.ComputeShaders                    = DEVICE_FEATURE_STATE_ENABLED;
+        Features.GeometryShaders                   = DEVICE_FEATURE_STATE_ENABLED;
+        Features.Tessellation                      = DEVICE_FEATURE_STATE_ENABLED;
+        Features.MeshShaders                       = DEVICE_FEATURE_STATE_ENABLED;
+        Features.BindlessResources                 = DEVICE_FEATURE_STATE_ENABLED;
+        Features.OcclusionQueries                  = DEVICE_FEATURE_STATE_ENABLED;
+        Features.BinaryOcclusionQueries            = DEVICE_FEATURE_STATE_ENABLED;
+        Features.TimestampQueries                  = DEVICE_FEATURE_STATE_ENABLED;
+        Features.PipelineStatisticsQueries         = DEVICE_FEATURE_STATE_ENABLED;
+        Features.DurationQueries                   = DEVICE_FEATURE_STATE_ENABLED;
+        Features.DepthBiasClamp                    = DEVICE_FEATURE_STATE_ENABLED;
+        Features.DepthClamp                        = DEVICE_FEATURE_STATE_ENABLED;
+        Features.IndependentBlend                  = DEVICE_FEATURE_STATE_ENABLED;
+        Features.DualSourceBlend                   = DEVICE_FEATURE_STATE_ENABLED;
+        Features.MultiViewport                     = DEVICE_FEATURE_STATE_ENABLED;
+        Features.TextureCompressionBC              = DEVICE_FEATURE_STATE_ENABLED;
+        Features.VertexPipelineUAVWritesAndAtomics = DEVICE_FEATURE_STATE_ENABLED;
+        Features.PixelUAVWritesAndAtomics          = DEVICE_FEATURE_STATE_ENABLED;
+        Features.TextureUAVExtendedFormats         = DEVICE_FEATURE_STATE_ENABLED;
+        Features.ShaderResourceRuntimeArray        = DEVICE_FEATURE_STATE_ENABLED;
+        Features.InstanceDataStepRate              = DEVICE_FEATURE_STATE_ENABLED;
+        Features.NativeFence                       = DEVICE_FEATURE_STATE_ENABLED;
+        Features.NativeMultiDraw                   = DEVICE_FEATURE_STATE_ENABLED;
+        Features.AsyncShaderCompilation            = DEVICE_FEATURE_STATE_OPTIONAL;
+    }
+    ASSERT_SIZEOF(AdapterInfo.Features, 41, "Did you add a new feature to DeviceFeatures? Please handle its status here.");
+
+    // Texture properties
+    {
+        auto& TexProps{AdapterInfo.Texture};
+        TexProps.MaxTexture1DDimension      = 16384;
+        TexProps.MaxTexture1DArraySlices    = 2048;
+        TexProps.MaxTexture2DDimension      = 16384;
+        TexProps.MaxTexture2DArraySlices    = 2048;
+        TexProps.MaxTexture3DDimension      = 2048;
+        TexProps.MaxTextureCubeDimension    = 16384;
+        TexProps.Texture2DMSSupported       = True;
+        TexProps.Texture2DMSArraySupported  = True;
+        TexProps.TextureViewSupported       = True;
+        TexProps.CubemapArraysSupported     = True;
+        TexProps.TextureView2DOn3DSupported = True;
+    }
+
+    // Sampler properties
+    {
+        auto& SamProps{AdapterInfo.Sampler};
+        SamProps.BorderSamplingModeSupported   = True;
+        SamProps.AnisotropicFilteringSupported = True;
+        SamProps.LODBiasSupported              = True;
+    }
+
+    // Buffer properties
+    {
+        auto& BufferProps{AdapterInfo.Buffer};
+        BufferProps.ConstantBufferOffsetAlignment   = 256;
+        BufferProps.StructuredBufferOffsetAlignment = 16;
+    }
+
+    // Mesh shader properties
+    {
+        auto& MeshProps{AdapterInfo.MeshShader};
+        MeshProps.MaxTaskCount = 65535;
+    }
+
+    // Compute shader properties
+    {
+        auto& CompProps{AdapterInfo.ComputeShader};
+        CompProps.SharedMemorySize          = 32u << 10;
+        CompProps.MaxThreadGroupInvocations = 1024;
+        CompProps.MaxThreadGroupSizeX       = 1024;
+        CompProps.MaxThreadGroupSizeY       = 1024;
+        CompProps.MaxThreadGroupSizeZ       = 64;
+        CompProps.MaxThreadGroupCountX      = 65535;
+        CompProps.MaxThreadGroupCountY      = 65535;
+        CompProps.MaxThreadGroupCountZ      = 65535;
+    }
+
+    // Draw command properties
+    {
+        auto& DrawCommandProps{AdapterInfo.DrawCommand};
+        DrawCommandProps.CapFlags =
+            DRAW_COMMAND_CAP_FLAG_BASE_VERTEX |
+            DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT |
+            DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_FIRST_INSTANCE |
+            DRAW_COMMAND_CAP_FLAG_NATIVE_MULTI_DRAW_INDIRECT |
+            DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_COUNTER_BUFFER;
+        DrawCommandProps.MaxIndexValue        = ~0u;
+        DrawCommandProps.MaxDrawIndirectCount = ~0u;
+    }
+
+    // Single graphics queue that executes all commands
+    AdapterInfo.NumQueues = 1;
+    {
+        auto& Queue{AdapterInfo.Queues[0]};
+        Queue.QueueType                 = COMMAND_QUEUE_TYPE_GRAPHICS;
+        Queue.MaxDeviceContexts         = 1;
+        Queue.TextureCopyGranularity[0] = 1;
+        Queue.TextureCopyGranularity[1] = 1;
+        Queue.TextureCopyGranularity[2] = 1;
+    }
+
+    return AdapterInfo;
+}
+
+void RenderDeviceNullImpl::CreateBuffer(const BufferDesc& BuffDesc, const BufferData* pBuffData, IBuffer** ppBuffer, bool bIsDeviceInternal)
+{
+    CreateBufferImpl(ppBuffer, BuffDesc, pBuffData, bIsDeviceInternal);
+}
+
+void RenderDeviceNullImpl::CreateBuffer(const BufferDesc& BuffDesc, const BufferData* pBuffData, IBuffer** ppBuffer)
+{
+    CreateBuffer(BuffDesc, pBuffData, ppBuffer, false);
+}
+
+void RenderDeviceNullImpl::CreateShader(const ShaderCreateInfo& ShaderCI, IShader** ppShader)
+{
+    CreateShaderImpl(ppShader, ShaderCI, false);
+}
+
+void RenderDeviceNullImpl::CreateTexture(const TextureDesc& TexDesc, const TextureData* pData, ITexture** ppTexture, bool bIsDeviceInternal)
+{
+    CreateTextureImpl(ppTexture, TexDesc, pData, bIsDeviceInternal);
+}
+
+void RenderDeviceNullImpl::CreateTexture(const TextureDesc& TexDesc, const TextureData* pData, ITexture** ppTexture)
+{
+    CreateTexture(TexDesc, pData, ppTexture, false);
+}
+
+void RenderDeviceNullImpl::CreateSampler(const SamplerDesc& SamplerDesc, ISampler** ppSampler)
+{
+    CreateSamplerImpl(ppSampler, SamplerDesc);
+}
+
+void RenderDeviceNullImpl::CreateGraphicsPipelineState(const GraphicsPipelineStateCreateInfo& PSOCreateInfo, IPipelineState** ppPipelineState)
+{
+    CreatePipelineStateImpl(ppPipelineState, PSOCreateInfo);
+}
+
+void RenderDeviceNullImpl::CreateComputePipelineState(const ComputePipelineStateCreateInfo& PSOCreateInfo, IPipelineState** ppPipelineState)
+{
+    CreatePipelineStateImpl(ppPipelineState, PSOCreateInfo);
+}
+
+void RenderDeviceNullImpl::CreateRayTracingPipelineState(const RayTracingPipelineStateCreateInfo& PSOCreateInfo, IPipelineState** ppPipelineState)
+{
+    UNSUPPORTED("Ray tracing is not supported in Null backend");
+    *ppPipelineState = nullptr;
+}
+
+void RenderDeviceNullImpl::CreateFence(const FenceDesc& Desc, IFence** ppFence)
+{
+    CreateFenceImpl(ppFence, Desc);
+}
+
+void RenderDeviceNullImpl::CreateQuery(const QueryDesc& Desc, IQuery** ppQuery)
+{
+    CreateQueryImpl(ppQuery, Desc);
+}
+
+void RenderDeviceNullImpl::CreateRenderPass(const RenderPassDesc& Desc, IRenderPass** ppRenderPass)
+{
+    CreateRenderPassImpl(ppRenderPass, Desc);
+}
+
+void RenderDeviceNullImpl::CreateFramebuffer(const FramebufferDesc& Desc, IFramebuffer** ppFramebuffer)
+{
+    CreateFramebufferImpl(ppFramebuffer, Desc);
+}
+
+void RenderDeviceNullImpl::CreateBLAS(const BottomLevelASDesc& Desc,
+                                      IBottomLevelAS**         ppBLAS)
+{
+    UNSUPPORTED("CreateBLAS is not supported in Null backend");
+    *ppBLAS = nullptr;
+}
+
+void RenderDeviceNullImpl::CreateTLAS(const TopLevelASDesc& Desc,
+                                      ITopLevelAS**         ppTLAS)
+{
+    UNSUPPORTED("CreateTLAS is not supported in Null backend");
+    *ppTLAS = nullptr;
+}
+
+void RenderDeviceNullImpl::CreateSBT(const ShaderBindingTableDesc& Desc,
+                                     IShaderBindingTable**         ppSBT)
+{
+    UNSUPPORTED("CreateSBT is not supported in Null backend");
+    *ppSBT = nullptr;
+}
+
+void RenderDeviceNullImpl::CreatePipelineResourceSignature(const PipelineResourceSignatureDesc& Desc,
+                                                           IPipelineResourceSignature**         ppSignature)
+{
+    CreatePipelineResourceSignature(Desc, ppSignature, SHADER_TYPE_UNKNOWN, false);
+}
+
+void RenderDeviceNullImpl::CreatePipelineResourceSignature(const PipelineResourceSignatureDesc& Desc,
+                                                           IPipelineResourceSignature**         ppSignature,
+                                                           SHADER_TYPE                          ShaderStages,
+                                                           bool                                 IsDeviceInternal)
+{
+    CreatePipelineResourceSignatureImpl(ppSignature, Desc, ShaderStages, IsDeviceInternal);
+}
+
+void RenderDeviceNullImpl::CreateDeviceMemory(const DeviceMemoryCreateInfo& CreateInfo, IDeviceMemory** ppMemory)
+{
+    UNSUPPORTED("CreateDeviceMemory is not supported in Null backend");
+    *ppMemory = nullptr;
+}
+
+void RenderDeviceNullImpl::CreatePipelineStateCache(const PipelineStateCacheCreateInfo& CreateInfo,
+                                                    IPipelineStateCache**               ppPSOCache)
+{
+    *ppPSOCache = nullptr;
+}
+
+SparseTextureFormatInfo RenderDeviceNullImpl::GetSparseTextureFormatInfo(TEXTURE_FORMAT     TexFormat,
+                                                                         RESOURCE_DIMENSION Dimension,
+                                                                         Uint32             SampleCount) const
+{
+    // Sparse resources are not supported
+    return {};
+}
+
+} // namespace Diligent
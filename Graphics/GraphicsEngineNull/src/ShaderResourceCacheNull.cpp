@@ -0,0 +1,199 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "ShaderResourceCacheNull.hpp"
+
+#include "BufferNullImpl.hpp"
+#include "BufferViewNullImpl.hpp"
+#include "TextureNullImpl.hpp"
+#include "TextureViewNullImpl.hpp"
+#include "SamplerNullImpl.hpp"
+#include "DeviceContextNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+
+namespace Diligent
+{
+
+bool ShaderResourceCacheNull::Resource::IsDynamicBuffer() const
+{
+    const BufferNullImpl* pBuffer = nullptr;
+    if (Type == SHADER_RESOURCE_TYPE_CONSTANT_BUFFER)
+    {
+        pBuffer = pObject.RawPtr<BufferNullImpl>();
+        if (pBuffer != nullptr && BufferRangeSize != 0 && BufferRangeSize < pBuffer->GetDesc().Size)
+            return true;
+    }
+    else if (Type == SHADER_RESOURCE_TYPE_BUFFER_SRV || Type == SHADER_RESOURCE_TYPE_BUFFER_UAV)
+    {
+        if (const auto* pView = pObject.RawPtr<BufferViewNullImpl>())
+        {
+            pBuffer = pView->GetBuffer<const BufferNullImpl>();
+            if (pView->GetDesc().ByteWidth < pBuffer->GetDesc().Size)
+                return true;
+        }
+    }
+    return pBuffer != nullptr && pBuffer->GetDesc().Usage == USAGE_DYNAMIC;
+}
+
+void ShaderResourceCacheNull::Initialize(Uint32 NumResources, IMemoryAllocator& MemAllocator)
+{
+    VERIFY(!m_IsInitialized, "Cache has already been initialized");
+
+    m_NumResources = NumResources;
+    if (NumResources > 0)
+    {
+        const auto MemSize = GetRequiredMemorySize(NumResources);
+        m_pMemory          = decltype(m_pMemory){
+            ALLOCATE(MemAllocator, "Shader resource cache data buffer", Uint8, MemSize),
+            STDDeleter<Uint8, IMemoryAllocator>(MemAllocator) //
+        };
+        m_pResources = reinterpret_cast<Resource*>(m_pMemory.get());
+        for (Uint32 r = 0; r < NumResources; ++r)
+            new (m_pResources + r) Resource{};
+    }
+
+    m_IsInitialized = true;
+}
+
+ShaderResourceCacheNull::~ShaderResourceCacheNull()
+{
+    for (Uint32 r = 0; r < m_NumResources; ++r)
+        m_pResources[r].~Resource();
+    m_pResources = nullptr;
+    m_pMemory.reset();
+}
+
+void ShaderResourceCacheNull::SetResource(Uint32                         CacheOffset,
+                                          SHADER_RESOURCE_TYPE           Type,
+                                          RefCntAutoPtr<IDeviceObject>&& pObject,
+                                          Uint64                         BufferBaseOffset,
+                                          Uint64                         BufferRangeSize)
+{
+    VERIFY(CacheOffset < m_NumResources, "Cache offset (", CacheOffset, ") is out of range");
+    auto& Res = m_pResources[CacheOffset];
+
+    if (Res.IsDynamicBuffer())
+    {
+        VERIFY_EXPR(m_NumDynamicBuffers > 0);
+        --m_NumDynamicBuffers;
+    }
+
+    Res.pObject             = std::move(pObject);
+    Res.Type                = Type;
+    Res.BufferBaseOffset    = BufferBaseOffset;
+    Res.BufferRangeSize     = BufferRangeSize;
+    Res.BufferDynamicOffset = 0;
+
+    if (Res.IsDynamicBuffer())
+        ++m_NumDynamicBuffers;
+
+    UpdateRevision();
+}
+
+void ShaderResourceCacheNull::ResetResource(Uint32 CacheOffset)
+{
+    VERIFY(CacheOffset < m_NumResources, "Cache offset (", CacheOffset, ") is out of range");
+    SetResource(CacheOffset, m_pResources[CacheOffset].Type, RefCntAutoPtr<IDeviceObject>{});
+}
+
+void ShaderResourceCacheNull::SetDynamicBufferOffset(Uint32 CacheOffset, Uint32 DynamicBufferOffset)
+{
+    VERIFY(CacheOffset < m_NumResources, "Cache offset (", CacheOffset, ") is out of range");
+    m_pResources[CacheOffset].BufferDynamicOffset = DynamicBufferOffset;
+}
+
+template <ShaderResourceCacheNull::StateTransitionMode Mode>
+void ShaderResourceCacheNull::TransitionResourceStates(DeviceContextNullImpl& Ctx)
+{
+    VERIFY_EXPR(IsInitialized());
+
+    auto ProcessResource = [&](auto& Resource, RESOURCE_STATE RequiredState, const char* StateName) //
+    {
+        if (Resource.IsInKnownState() && !Resource.CheckState(RequiredState))
+        {
+            if (Mode == StateTransitionMode::Transition)
+            {
+                Ctx.TransitionResource(Resource, RequiredState);
+            }
+            else
+            {
+                LOG_ERROR_MESSAGE("Resource '", Resource.GetDesc().Name, "' has not been transitioned to ", StateName,
+                                  " state. Call TransitionShaderResources(), use RESOURCE_STATE_TRANSITION_MODE_TRANSITION "
+                                  "mode or explicitly transition the resource to required state.");
+            }
+        }
+    };
+
+    for (Uint32 r = 0; r < m_NumResources; ++r)
+    {
+        const auto& Res = m_pResources[r];
+        if (!Res.pObject)
+            continue;
+
+        static_assert(SHADER_RESOURCE_TYPE_LAST == 8, "Please update the switch below to handle the new shader resource type");
+        switch (Res.Type)
+        {
+            case SHADER_RESOURCE_TYPE_CONSTANT_BUFFER:
+                ProcessResource(*Res.pObject.RawPtr<BufferNullImpl>(), RESOURCE_STATE_CONSTANT_BUFFER, "Constant Buffer");
+                break;
+
+            case SHADER_RESOURCE_TYPE_BUFFER_SRV:
+                ProcessResource(*Res.pObject.RawPtr<BufferViewNullImpl>()->GetBuffer<BufferNullImpl>(), RESOURCE_STATE_SHADER_RESOURCE, "Shader Resource");
+                break;
+
+            case SHADER_RESOURCE_TYPE_BUFFER_UAV:
+                ProcessResource(*Res.pObject.RawPtr<BufferViewNullImpl>()->GetBuffer<BufferNullImpl>(), RESOURCE_STATE_UNORDERED_ACCESS, "Unordered Access");
+                break;
+
+            case SHADER_RESOURCE_TYPE_TEXTURE_SRV:
+                ProcessResource(*Res.pObject.RawPtr<TextureViewNullImpl>()->GetTexture<TextureNullImpl>(), RESOURCE_STATE_SHADER_RESOURCE, "Shader Resource");
+                break;
+
+            case SHADER_RESOURCE_TYPE_INPUT_ATTACHMENT:
+                ProcessResource(*Res.pObject.RawPtr<TextureViewNullImpl>()->GetTexture<TextureNullImpl>(), RESOURCE_STATE_INPUT_ATTACHMENT, "Input Attachment");
+                break;
+
+            case SHADER_RESOURCE_TYPE_TEXTURE_UAV:
+                ProcessResource(*Res.pObject.RawPtr<TextureViewNullImpl>()->GetTexture<TextureNullImpl>(), RESOURCE_STATE_UNORDERED_ACCESS, "Unordered Access");
+                break;
+
+            case SHADER_RESOURCE_TYPE_SAMPLER:
+                // Nothing to do with samplers
+                break;
+
+            default:
+                UNEXPECTED("Unexpected resource type");
+        }
+    }
+}
+
+template void ShaderResourceCacheNull::TransitionResourceStates<ShaderResourceCacheNull::StateTransitionMode::Transition>(DeviceContextNullImpl& Ctx);
+template void ShaderResourceCacheNull::TransitionResourceStates<ShaderResourceCacheNull::StateTransitionMode::Verify>(DeviceContextNullImpl& Ctx);
+
+} // namespace Diligent
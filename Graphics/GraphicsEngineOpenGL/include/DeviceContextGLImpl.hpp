@@ -125,6 +125,10 @@ public:
     virtual void DILIGENT_CALL_TYPE Draw               (const DrawAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndexed() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE DrawIndexed        (const DrawIndexedAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDraw() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE MultiDraw          (const MultiDrawAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDrawIndexed() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE MultiDrawIndexed   (const MultiDrawIndexedAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndirect() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE DrawIndirect       (const DrawIndirectAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndexedIndirect() in OpenGL backend.
@@ -314,6 +318,11 @@ private:
     __forceinline void PrepareForIndirectDrawCount(IBuffer* pCountBuffer);
     __forceinline void PostDraw();
 
+    // Issue a single (possibly instanced) non-indexed or indexed draw command. The draw state
+    // must have been prepared by PrepareForDraw() and PrepareForIndexedDraw().
+    __forceinline void DrawArrays(GLenum GlTopology, Uint32 NumVertices, Uint32 StartVertexLocation, Uint32 NumInstances, Uint32 FirstInstanceLocation);
+    __forceinline void DrawElements(GLenum GlTopology, Uint32 NumIndices, GLenum GLIndexType, size_t FirstIndexByteOffset, Uint32 BaseVertex, Uint32 NumInstances, Uint32 FirstInstanceLocation);
+
     using TBindings = PipelineResourceSignatureGLImpl::TBindings;
     void BindProgramResources(Uint32 BindSRBMask);
 
@@ -352,6 +361,15 @@ private:
     GLObjectWrappers::GLFrameBufferObj m_DefaultFBO;
 
     std::vector<OptimizedClearValue> m_AttachmentClearValues;
+
+    // Scratch arrays that hold per-draw arguments of native multi-draw commands.
+    struct MultiDrawArgs
+    {
+        std::vector<GLint>       First;
+        std::vector<GLsizei>     Count;
+        std::vector<GLvoid*>     Indices;
+        std::vector<GLint>       BaseVertex;
+    } m_MultiDrawArgs;
 };
 
 } // namespace Diligent
@@ -61,6 +61,9 @@ public:
 
     SHADER_SOURCE_LANGUAGE GetSourceLanguage() const { return m_SourceLanguage; }
 
+private:
+    void CompileShader(const ShaderCreateInfo& ShaderCI) noexcept(false);
+
 private:
     const SHADER_SOURCE_LANGUAGE             m_SourceLanguage;
     GLObjectWrappers::GLShaderObj            m_GLShaderObj;
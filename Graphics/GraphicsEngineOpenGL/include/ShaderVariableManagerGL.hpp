@@ -96,8 +96,9 @@ public:
 
     using ResourceAttribs = PipelineResourceAttribsGL;
 
-    // These two methods can't be implemented in the header because they depend on PipelineResourceSignatureGLImpl
+    // These methods can't be implemented in the header because they depend on PipelineResourceSignatureGLImpl
     const PipelineResourceDesc& GetResourceDesc(Uint32 Index) const;
+    Uint32                      GetResourceNameId(Uint32 Index) const;
     const ResourceAttribs&      GetResourceAttribs(Uint32 Index) const;
 
     template <typename ThisImplType>
@@ -190,9 +191,9 @@ public:
         void SetDynamicOffset(Uint32 ArrayIndex, Uint32 Offset);
     };
 
-    void BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags);
+    void BindResources(const ResourceMappingAccessor& ResMapping, BIND_SHADER_RESOURCES_FLAGS Flags);
 
-    void CheckResources(IResourceMapping*                    pResourceMapping,
+    void CheckResources(const ResourceMappingAccessor&       ResMapping,
                         BIND_SHADER_RESOURCES_FLAGS          Flags,
                         SHADER_RESOURCE_VARIABLE_TYPE_FLAGS& StaleVarTypes) const;
 
@@ -93,6 +93,9 @@ void DeviceContextGLImpl::SetPipelineState(IPipelineState* pPipelineState)
     if (PipelineStateGLImpl::IsSameObject(m_pPipelineState, pPipelineStateGLImpl))
         return;
 
+    if (!CheckPipelineStateStatus(pPipelineStateGLImpl))
+        return;
+
     TDeviceContextBase::SetPipelineState(pPipelineStateGLImpl, 0 /*Dummy*/);
 
     const auto& Desc = pPipelineStateGLImpl->GetDesc();
@@ -681,6 +684,7 @@ void DeviceContextGLImpl::BindProgramResources(Uint32 BindSRBMask)
                           "in the cache have changed, but the SRB has not been committed before the draw/dispatch command.");
             pResourceCache->BindDynamicBuffers(GetContextState(), BaseBindings);
         }
+        ++m_Stats.DescriptorSetBindCount;
     }
     m_BindInfo.StaleSRBMask &= ~m_BindInfo.ActiveSRBMask;
 
@@ -794,26 +798,66 @@ void DeviceContextGLImpl::PostDraw()
     m_CommittedResourcesTentativeBarriers = MEMORY_BARRIER_NONE;
 }
 
-void DeviceContextGLImpl::Draw(const DrawAttribs& Attribs)
+void DeviceContextGLImpl::DrawArrays(GLenum GlTopology, Uint32 NumVertices, Uint32 StartVertexLocation, Uint32 NumInstances, Uint32 FirstInstanceLocation)
 {
-    DvpVerifyDrawArguments(Attribs);
+    if (NumInstances > 1 || FirstInstanceLocation != 0)
+    {
+        if (FirstInstanceLocation != 0)
+            glDrawArraysInstancedBaseInstance(GlTopology, StartVertexLocation, NumVertices, NumInstances, FirstInstanceLocation);
+        else
+            glDrawArraysInstanced(GlTopology, StartVertexLocation, NumVertices, NumInstances);
+    }
+    else
+    {
+        glDrawArrays(GlTopology, StartVertexLocation, NumVertices);
+    }
+}
 
-    GLenum GlTopology;
-    PrepareForDraw(Attribs.Flags, false, GlTopology);
+void DeviceContextGLImpl::DrawElements(GLenum GlTopology, Uint32 NumIndices, GLenum GLIndexType, size_t FirstIndexByteOffset, Uint32 BaseVertex, Uint32 NumInstances, Uint32 FirstInstanceLocation)
+{
+    // NOTE: Base Vertex and Base Instance versions are not supported even in OpenGL ES 3.1
+    // This functionality can be emulated by adjusting stream offsets. This, however may cause
+    // errors in case instance data is read from the same stream as vertex data. Thus handling
+    // such cases is left to the application
 
-    if (Attribs.NumVertices > 0 && Attribs.NumInstances > 0)
+    auto* pIndices = reinterpret_cast<GLvoid*>(FirstIndexByteOffset);
+    if (NumInstances > 1 || FirstInstanceLocation != 0)
     {
-        if (Attribs.NumInstances > 1 || Attribs.FirstInstanceLocation != 0)
+        if (BaseVertex > 0)
         {
-            if (Attribs.FirstInstanceLocation != 0)
-                glDrawArraysInstancedBaseInstance(GlTopology, Attribs.StartVertexLocation, Attribs.NumVertices, Attribs.NumInstances, Attribs.FirstInstanceLocation);
+            if (FirstInstanceLocation != 0)
+                glDrawElementsInstancedBaseVertexBaseInstance(GlTopology, NumIndices, GLIndexType, pIndices, NumInstances, BaseVertex, FirstInstanceLocation);
             else
-                glDrawArraysInstanced(GlTopology, Attribs.StartVertexLocation, Attribs.NumVertices, Attribs.NumInstances);
+                glDrawElementsInstancedBaseVertex(GlTopology, NumIndices, GLIndexType, pIndices, NumInstances, BaseVertex);
         }
         else
         {
-            glDrawArrays(GlTopology, Attribs.StartVertexLocation, Attribs.NumVertices);
+            if (FirstInstanceLocation != 0)
+                glDrawElementsInstancedBaseInstance(GlTopology, NumIndices, GLIndexType, pIndices, NumInstances, FirstInstanceLocation);
+            else
+                glDrawElementsInstanced(GlTopology, NumIndices, GLIndexType, pIndices, NumInstances);
         }
+    }
+    else
+    {
+        if (BaseVertex > 0)
+            glDrawElementsBaseVertex(GlTopology, NumIndices, GLIndexType, pIndices, BaseVertex);
+        else
+            glDrawElements(GlTopology, NumIndices, GLIndexType, pIndices);
+    }
+}
+
+void DeviceContextGLImpl::Draw(const DrawAttribs& Attribs)
+{
+    DvpVerifyDrawArguments(Attribs);
+    ++m_Stats.DrawCount;
+
+    GLenum GlTopology;
+    PrepareForDraw(Attribs.Flags, false, GlTopology);
+
+    if (Attribs.NumVertices > 0 && Attribs.NumInstances > 0)
+    {
+        DrawArrays(GlTopology, Attribs.NumVertices, Attribs.StartVertexLocation, Attribs.NumInstances, Attribs.FirstInstanceLocation);
         DEV_CHECK_GL_ERROR("OpenGL draw command failed");
     }
 
@@ -823,6 +867,7 @@ void DeviceContextGLImpl::Draw(const DrawAttribs& Attribs)
 void DeviceContextGLImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
 {
     DvpVerifyDrawIndexedArguments(Attribs);
+    ++m_Stats.DrawCount;
 
     GLenum GlTopology;
     PrepareForDraw(Attribs.Flags, true, GlTopology);
@@ -830,38 +875,101 @@ void DeviceContextGLImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
     size_t FirstIndexByteOffset;
     PrepareForIndexedDraw(Attribs.IndexType, Attribs.FirstIndexLocation, GLIndexType, FirstIndexByteOffset);
 
-    // NOTE: Base Vertex and Base Instance versions are not supported even in OpenGL ES 3.1
-    // This functionality can be emulated by adjusting stream offsets. This, however may cause
-    // errors in case instance data is read from the same stream as vertex data. Thus handling
-    // such cases is left to the application
-
     if (Attribs.NumIndices > 0 && Attribs.NumInstances > 0)
     {
-        if (Attribs.NumInstances > 1 || Attribs.FirstInstanceLocation != 0)
+        DrawElements(GlTopology, Attribs.NumIndices, GLIndexType, FirstIndexByteOffset, Attribs.BaseVertex, Attribs.NumInstances, Attribs.FirstInstanceLocation);
+        DEV_CHECK_GL_ERROR("OpenGL draw command failed");
+    }
+
+    PostDraw();
+}
+
+void DeviceContextGLImpl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    DvpVerifyMultiDrawArguments(Attribs);
+    m_Stats.DrawCount += Attribs.DrawCount;
+
+    GLenum GlTopology;
+    PrepareForDraw(Attribs.Flags, false, GlTopology);
+
+    if (Attribs.DrawCount > 0 && Attribs.NumInstances > 0)
+    {
+#if GL_ARB_draw_elements_base_vertex
+        // There is no non-indirect instanced multi-draw command in OpenGL
+        if (m_pDevice->GetFeatures().NativeMultiDraw && Attribs.NumInstances == 1 && Attribs.FirstInstanceLocation == 0)
         {
-            if (Attribs.BaseVertex > 0)
+            auto& Args = m_MultiDrawArgs;
+            Args.First.resize(Attribs.DrawCount);
+            Args.Count.resize(Attribs.DrawCount);
+            for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
             {
-                if (Attribs.FirstInstanceLocation != 0)
-                    glDrawElementsInstancedBaseVertexBaseInstance(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), Attribs.NumInstances, Attribs.BaseVertex, Attribs.FirstInstanceLocation);
-                else
-                    glDrawElementsInstancedBaseVertex(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), Attribs.NumInstances, Attribs.BaseVertex);
+                const auto& Item = Attribs.pDrawItems[i];
+                Args.First[i]    = static_cast<GLint>(Item.StartVertexLocation);
+                Args.Count[i]    = static_cast<GLsizei>(Item.NumVertices);
             }
-            else
+            glMultiDrawArrays(GlTopology, Args.First.data(), Args.Count.data(), static_cast<GLsizei>(Attribs.DrawCount));
+        }
+        else
+#endif
+        {
+            for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+            {
+                const auto& Item = Attribs.pDrawItems[i];
+                if (Item.NumVertices > 0)
+                    DrawArrays(GlTopology, Item.NumVertices, Item.StartVertexLocation, Attribs.NumInstances, Attribs.FirstInstanceLocation);
+            }
+        }
+        DEV_CHECK_GL_ERROR("OpenGL multi-draw command failed");
+    }
+
+    PostDraw();
+}
+
+void DeviceContextGLImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    DvpVerifyMultiDrawIndexedArguments(Attribs);
+    m_Stats.DrawCount += Attribs.DrawCount;
+
+    GLenum GlTopology;
+    PrepareForDraw(Attribs.Flags, true, GlTopology);
+    GLenum GLIndexType;
+    size_t BaseIndexByteOffset;
+    PrepareForIndexedDraw(Attribs.IndexType, 0, GLIndexType, BaseIndexByteOffset);
+    const auto IndexSize = GetValueSize(Attribs.IndexType);
+
+    if (Attribs.DrawCount > 0 && Attribs.NumInstances > 0)
+    {
+#if GL_ARB_draw_elements_base_vertex
+        // There is no non-indirect instanced multi-draw command in OpenGL
+        if (m_pDevice->GetFeatures().NativeMultiDraw && Attribs.NumInstances == 1 && Attribs.FirstInstanceLocation == 0)
+        {
+            auto& Args = m_MultiDrawArgs;
+            Args.Count.resize(Attribs.DrawCount);
+            Args.Indices.resize(Attribs.DrawCount);
+            Args.BaseVertex.resize(Attribs.DrawCount);
+            for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
             {
-                if (Attribs.FirstInstanceLocation != 0)
-                    glDrawElementsInstancedBaseInstance(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), Attribs.NumInstances, Attribs.FirstInstanceLocation);
-                else
-                    glDrawElementsInstanced(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), Attribs.NumInstances);
+                const auto& Item   = Attribs.pDrawItems[i];
+                Args.Count[i]      = static_cast<GLsizei>(Item.NumIndices);
+                Args.Indices[i]    = reinterpret_cast<GLvoid*>(BaseIndexByteOffset + size_t{IndexSize} * Item.FirstIndexLocation);
+                Args.BaseVertex[i] = static_cast<GLint>(Item.BaseVertex);
             }
+            glMultiDrawElementsBaseVertex(GlTopology, Args.Count.data(), GLIndexType, Args.Indices.data(), static_cast<GLsizei>(Attribs.DrawCount), Args.BaseVertex.data());
         }
         else
+#endif
         {
-            if (Attribs.BaseVertex > 0)
-                glDrawElementsBaseVertex(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), Attribs.BaseVertex);
-            else
-                glDrawElements(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)));
+            for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+            {
+                const auto& Item = Attribs.pDrawItems[i];
+                if (Item.NumIndices > 0)
+                {
+                    DrawElements(GlTopology, Item.NumIndices, GLIndexType, BaseIndexByteOffset + size_t{IndexSize} * Item.FirstIndexLocation,
+                                 Item.BaseVertex, Attribs.NumInstances, Attribs.FirstInstanceLocation);
+                }
+            }
         }
-        DEV_CHECK_GL_ERROR("OpenGL draw command failed");
+        DEV_CHECK_GL_ERROR("OpenGL multi-draw command failed");
     }
 
     PostDraw();
@@ -908,6 +1016,7 @@ void DeviceContextGLImpl::PrepareForIndirectDrawCount(IBuffer* pCountBuffer)
 void DeviceContextGLImpl::DrawIndirect(const DrawIndirectAttribs& Attribs)
 {
     DvpVerifyDrawIndirectArguments(Attribs);
+    ++m_Stats.DrawCount;
 
     GLenum GlTopology;
     PrepareForDraw(Attribs.Flags, true, GlTopology);
@@ -982,6 +1091,7 @@ void DeviceContextGLImpl::DrawIndirect(const DrawIndirectAttribs& Attribs)
 void DeviceContextGLImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs)
 {
     DvpVerifyDrawIndexedIndirectArguments(Attribs);
+    ++m_Stats.DrawCount;
 
     GLenum GlTopology;
     PrepareForDraw(Attribs.Flags, true, GlTopology);
@@ -1074,6 +1184,7 @@ void DeviceContextGLImpl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attrib
 void DeviceContextGLImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
 {
     DvpVerifyDispatchArguments(Attribs);
+    ++m_Stats.DispatchCount;
 
 #if GL_ARB_compute_shader
     // The program might have changed since the last SetPipelineState call if a shader was
@@ -1104,6 +1215,7 @@ void DeviceContextGLImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
 void DeviceContextGLImpl::DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs)
 {
     DvpVerifyDispatchIndirectArguments(Attribs);
+    ++m_Stats.DispatchCount;
 
 #if GL_ARB_compute_shader
     // The program might have changed since the last SetPipelineState call if a shader was
@@ -1235,6 +1347,7 @@ void DeviceContextGLImpl::Flush()
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Flushing device context inside an active render pass.");
 
     glFlush();
+    ++m_Stats.FlushCount;
 
     m_BindInfo = {};
 }
@@ -304,25 +304,28 @@ PipelineStateGLImpl::PipelineStateGLImpl(IReferenceCounters*
 {
     try
     {
-        TShaderStages Shaders;
-        ExtractShaders<ShaderGLImpl>(CreateInfo, Shaders);
+        // GL device does not have a shader compilation thread pool, so the pipeline is always created synchronously
+        ConstructPipeline(CreateInfo, [this](const GraphicsPipelineStateCreateInfo& GraphicsPipelineCI) {
+            TShaderStages Shaders;
+            ExtractShaders<ShaderGLImpl>(GraphicsPipelineCI, Shaders);
 
-        RefCntAutoPtr<ShaderGLImpl> pTempPS;
-        if (CreateInfo.pPS == nullptr)
-        {
-            // Some OpenGL implementations fail if fragment shader is not present, so
-            // create a dummy one.
-            ShaderCreateInfo ShaderCI;
-            ShaderCI.SourceLanguage  = SHADER_SOURCE_LANGUAGE_GLSL;
-            ShaderCI.Source          = "void main(){}";
-            ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
-            ShaderCI.Desc.Name       = "Dummy fragment shader";
-            pDeviceGL->CreateShader(ShaderCI, pTempPS.DblPtr<IShader>());
-
-            Shaders.emplace_back(pTempPS);
-        }
+            RefCntAutoPtr<ShaderGLImpl> pTempPS;
+            if (GraphicsPipelineCI.pPS == nullptr)
+            {
+                // Some OpenGL implementations fail if fragment shader is not present, so
+                // create a dummy one.
+                ShaderCreateInfo ShaderCI;
+                ShaderCI.SourceLanguage  = SHADER_SOURCE_LANGUAGE_GLSL;
+                ShaderCI.Source          = "void main(){}";
+                ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+                ShaderCI.Desc.Name       = "Dummy fragment shader";
+                GetDevice()->CreateShader(ShaderCI, pTempPS.DblPtr<IShader>());
+
+                Shaders.emplace_back(pTempPS);
+            }
 
-        InitInternalObjects(CreateInfo, Shaders);
+            InitInternalObjects(GraphicsPipelineCI, Shaders);
+        });
     }
     catch (...)
     {
@@ -347,10 +350,12 @@ PipelineStateGLImpl::PipelineStateGLImpl(IReferenceCounters*                   p
 {
     try
     {
-        TShaderStages Shaders;
-        ExtractShaders<ShaderGLImpl>(CreateInfo, Shaders);
+        ConstructPipeline(CreateInfo, [this](const ComputePipelineStateCreateInfo& ComputePipelineCI) {
+            TShaderStages Shaders;
+            ExtractShaders<ShaderGLImpl>(ComputePipelineCI, Shaders);
 
-        InitInternalObjects(CreateInfo, Shaders);
+            InitInternalObjects(ComputePipelineCI, Shaders);
+        });
     }
     catch (...)
     {
@@ -361,6 +366,7 @@ PipelineStateGLImpl::PipelineStateGLImpl(IReferenceCounters*                   p
 
 PipelineStateGLImpl::~PipelineStateGLImpl()
 {
+    CancelAsyncInitialization();
     Destruct();
 }
 
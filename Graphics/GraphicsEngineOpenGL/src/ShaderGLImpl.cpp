@@ -64,8 +64,14 @@ ShaderGLImpl::ShaderGLImpl(IReferenceCounters*     pRefCounters,
     DEV_CHECK_ERR(ShaderCI.ByteCode == nullptr, "'ByteCode' must be null when shader is created from the source code or a file");
     DEV_CHECK_ERR(ShaderCI.ShaderCompiler == SHADER_COMPILER_DEFAULT, "only default compiler is supported in OpenGL");
 
-    const auto& DeviceInfo  = pDeviceGL->GetDeviceInfo();
-    const auto& AdapterInfo = pDeviceGL->GetAdapterInfo();
+    // GL device does not have a shader compilation thread pool, so the shader is always compiled synchronously
+    ConstructShader(ShaderCI, [this](const ShaderCreateInfo& CI) { CompileShader(CI); });
+}
+
+void ShaderGLImpl::CompileShader(const ShaderCreateInfo& ShaderCI) noexcept(false)
+{
+    const auto& DeviceInfo  = m_pDevice->GetDeviceInfo();
+    const auto& AdapterInfo = m_pDevice->GetAdapterInfo();
 
     // Note: there is a simpler way to create the program:
     //m_uiShaderSeparateProg = glCreateShaderProgramv(GL_VERTEX_SHADER, _countof(ShaderStrings), ShaderStrings);
@@ -106,7 +112,7 @@ ShaderGLImpl::ShaderGLImpl(IReferenceCounters*     pRefCounters,
         // platform definitions, user-provided shader macros, etc.
         GLSLSourceString = BuildGLSLSourceString(
             ShaderCI, DeviceInfo, AdapterInfo, TargetGLSLCompiler::driver,
-            (pDeviceGL->GetDeviceInfo().NDC.MinZ >= 0 ? NDCDefine : nullptr));
+            (DeviceInfo.NDC.MinZ >= 0 ? NDCDefine : nullptr));
         ShaderStrings[0] = GLSLSourceString.c_str();
         Lengths[0]       = static_cast<GLint>(GLSLSourceString.length());
     }
@@ -186,6 +192,7 @@ ShaderGLImpl::ShaderGLImpl(IReferenceCounters*     pRefCounters,
 
 ShaderGLImpl::~ShaderGLImpl()
 {
+    CancelAsyncInitialization();
 }
 
 IMPLEMENT_QUERY_INTERFACE(ShaderGLImpl, IID_ShaderGL, TShaderBase)
@@ -389,9 +389,9 @@ void ShaderVariableManagerGL::StorageBufferBindInfo::SetDynamicOffset(Uint32 Arr
     m_ParentManager.m_ResourceCache.SetDynamicSSBOOffset(Attr.CacheOffset + ArrayIndex, Offset);
 }
 
-void ShaderVariableManagerGL::BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags)
+void ShaderVariableManagerGL::BindResources(const ResourceMappingAccessor& ResMapping, BIND_SHADER_RESOURCES_FLAGS Flags)
 {
-    if (pResourceMapping == nullptr)
+    if (!ResMapping)
     {
         LOG_ERROR_MESSAGE("Failed to bind resources: resource mapping is null");
         return;
@@ -402,20 +402,20 @@ void ShaderVariableManagerGL::BindResources(IResourceMapping* pResourceMapping,
 
     HandleResources(
         [&](UniformBuffBindInfo& ub) {
-            ub.BindResources(pResourceMapping, Flags);
+            ub.BindResources(ResMapping, Flags);
         },
         [&](TextureBindInfo& tex) {
-            tex.BindResources(pResourceMapping, Flags);
+            tex.BindResources(ResMapping, Flags);
         },
         [&](ImageBindInfo& img) {
-            img.BindResources(pResourceMapping, Flags);
+            img.BindResources(ResMapping, Flags);
         },
         [&](StorageBufferBindInfo& ssbo) {
-            ssbo.BindResources(pResourceMapping, Flags);
+            ssbo.BindResources(ResMapping, Flags);
         });
 }
 
-void ShaderVariableManagerGL::CheckResources(IResourceMapping*                    pResourceMapping,
+void ShaderVariableManagerGL::CheckResources(const ResourceMappingAccessor&       ResMapping,
                                              BIND_SHADER_RESOURCES_FLAGS          Flags,
                                              SHADER_RESOURCE_VARIABLE_TYPE_FLAGS& StaleVarTypes) const
 {
@@ -428,19 +428,19 @@ void ShaderVariableManagerGL::CheckResources(IResourceMapping*
 
     HandleConstResources(
         [&](const UniformBuffBindInfo& ub) {
-            ub.CheckResources(pResourceMapping, Flags, StaleVarTypes);
+            ub.CheckResources(ResMapping, Flags, StaleVarTypes);
             return (StaleVarTypes & AllowedTypes) != AllowedTypes;
         },
         [&](const TextureBindInfo& tex) {
-            tex.CheckResources(pResourceMapping, Flags, StaleVarTypes);
+            tex.CheckResources(ResMapping, Flags, StaleVarTypes);
             return (StaleVarTypes & AllowedTypes) != AllowedTypes;
         },
         [&](const ImageBindInfo& img) {
-            img.CheckResources(pResourceMapping, Flags, StaleVarTypes);
+            img.CheckResources(ResMapping, Flags, StaleVarTypes);
             return (StaleVarTypes & AllowedTypes) != AllowedTypes;
         },
         [&](const StorageBufferBindInfo& ssbo) {
-            ssbo.CheckResources(pResourceMapping, Flags, StaleVarTypes);
+            ssbo.CheckResources(ResMapping, Flags, StaleVarTypes);
             return (StaleVarTypes & AllowedTypes) != AllowedTypes;
         });
 }
@@ -602,6 +602,12 @@ const PipelineResourceDesc& ShaderVariableManagerGL::GetResourceDesc(Uint32 Inde
     return m_pSignature->GetResourceDesc(Index);
 }
 
+Uint32 ShaderVariableManagerGL::GetResourceNameId(Uint32 Index) const
+{
+    VERIFY_EXPR(m_pSignature);
+    return m_pSignature->GetResourceNameId(Index);
+}
+
 const ShaderVariableManagerGL::ResourceAttribs& ShaderVariableManagerGL::GetResourceAttribs(Uint32 Index) const
 {
     VERIFY_EXPR(m_pSignature);
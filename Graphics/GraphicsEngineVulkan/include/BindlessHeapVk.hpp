@@ -0,0 +1,132 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::BindlessHeapVk class
+
+#include <array>
+#include <mutex>
+#include <vector>
+
+#include "PipelineResourceSignature.h"
+#include "VulkanUtilities/VulkanObjectWrappers.hpp"
+
+namespace Diligent
+{
+
+class RenderDeviceVkImpl;
+
+/// Device-wide bindless descriptor heap.
+
+/// The heap is a single descriptor set with one partially bound, update-after-bind binding per descriptor type.
+/// Every shader resource and unordered access view is assigned a stable index in the binding of its type
+/// when it is created, and the descriptor is written once. Pipeline resource signatures expose the heap to
+/// shaders through the resources with PIPELINE_RESOURCE_FLAG_BINDLESS_HEAP flag; the heap set is bound by
+/// the device context after all signature sets.
+class BindlessHeapVk
+{
+public:
+    enum BINDING : Uint32
+    {
+        BINDING_TEXTURE_SRV = 0,        // VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE
+        BINDING_TEXTURE_UAV,            // VK_DESCRIPTOR_TYPE_STORAGE_IMAGE
+        BINDING_FORMATTED_BUFFER_SRV,   // VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER
+        BINDING_FORMATTED_BUFFER_UAV,   // VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER
+        BINDING_STRUCTURED_BUFFER,      // VK_DESCRIPTOR_TYPE_STORAGE_BUFFER
+        BINDING_COUNT
+    };
+
+    static constexpr Uint32 InvalidIndex = ~0u;
+
+    // The heap takes at most 1/HeapLimitDivisor of every update-after-bind descriptor limit,
+    // the remaining descriptors are left to the signature sets.
+    static constexpr Uint32 HeapLimitDivisor = 2;
+
+    BindlessHeapVk(RenderDeviceVkImpl& DeviceVk, Uint32 Size) noexcept(false);
+
+    // clang-format off
+    BindlessHeapVk             (const BindlessHeapVk&) = delete;
+    BindlessHeapVk             (BindlessHeapVk&&)      = delete;
+    BindlessHeapVk& operator = (const BindlessHeapVk&) = delete;
+    BindlessHeapVk& operator = (BindlessHeapVk&&)      = delete;
+    // clang-format on
+
+    ~BindlessHeapVk();
+
+    // Returns true if the device supports all features required by the heap
+    static bool IsSupported(const RenderDeviceVkImpl& DeviceVk);
+
+    // Returns the heap binding that backs the pipeline resource with PIPELINE_RESOURCE_FLAG_BINDLESS_HEAP flag
+    static BINDING GetBinding(const PipelineResourceDesc& ResDesc);
+
+    static VkDescriptorType GetVkDescriptorType(BINDING Binding);
+
+    // Allocates an index in the texture binding and writes the image view descriptor.
+    // Returns InvalidIndex if the binding is full.
+    Uint32 AllocateImageView(BINDING Binding, VkImageView vkView, VkImageLayout Layout);
+
+    // Allocates an index in the formatted buffer binding and writes the texel buffer view descriptor.
+    Uint32 AllocateTexelBufferView(BINDING Binding, VkBufferView vkView);
+
+    // Allocates an index in the structured buffer binding and writes the storage buffer descriptor.
+    Uint32 AllocateStorageBuffer(VkBuffer vkBuffer, VkDeviceSize Offset, VkDeviceSize Range);
+
+    // Returns the index to the heap once all commands that may use the descriptor are complete.
+    void Free(BINDING Binding, Uint32 Index, Uint64 QueueMask);
+
+    VkDescriptorSetLayout GetVkDescriptorSetLayout() const { return m_SetLayout; }
+    VkDescriptorSet       GetVkDescriptorSet() const { return m_vkSet; }
+
+    Uint32 GetCapacity(BINDING Binding) const { return m_Bindings[Binding].Capacity; }
+
+private:
+    Uint32 AllocateIndex(BINDING Binding);
+    void   ReleaseIndex(BINDING Binding, Uint32 Index);
+
+    class IndexReleaser;
+
+    RenderDeviceVkImpl& m_DeviceVkImpl;
+
+    VulkanUtilities::DescriptorSetLayoutWrapper m_SetLayout;
+    VulkanUtilities::DescriptorPoolWrapper      m_Pool;
+    VkDescriptorSet                             m_vkSet = VK_NULL_HANDLE;
+
+    struct BindingInfo
+    {
+        Uint32              Capacity  = 0;
+        Uint32              NextIndex = 0;
+        std::vector<Uint32> FreeIndices;
+    };
+
+    // Protects the index allocators and descriptor writes, as host access
+    // to the descriptor set must be externally synchronized.
+    std::mutex                              m_Mtx;
+    std::array<BindingInfo, BINDING_COUNT> m_Bindings;
+};
+
+} // namespace Diligent
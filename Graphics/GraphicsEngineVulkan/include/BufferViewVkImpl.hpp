@@ -33,6 +33,7 @@
 #include "EngineVkImplTraits.hpp"
 #include "BufferViewBase.hpp"
 #include "VulkanUtilities/VulkanObjectWrappers.hpp"
+#include "BindlessHeapVk.hpp"
 
 namespace Diligent
 {
@@ -56,8 +57,16 @@ public:
     /// Implementation of IBufferViewVk::GetVkBufferView().
     virtual VkBufferView DILIGENT_CALL_TYPE GetVkBufferView() const override final { return m_BuffView; }
 
+    /// Implementation of IBufferViewVk::GetBindlessHeapIndex().
+    virtual Uint32 DILIGENT_CALL_TYPE GetBindlessHeapIndex() const override final { return m_BindlessHeapIndex; }
+
 protected:
+    BindlessHeapVk::BINDING GetBindlessHeapBinding() const;
+
     VulkanUtilities::BufferViewWrapper m_BuffView;
+
+    /// Index of the view in the bindless heap
+    Uint32 m_BindlessHeapIndex = BindlessHeapVk::InvalidIndex;
 };
 
 } // namespace Diligent
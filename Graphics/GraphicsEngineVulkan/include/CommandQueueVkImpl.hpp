@@ -33,6 +33,7 @@
 #include <mutex>
 #include <deque>
 #include <atomic>
+#include <vector>
 
 #include "EngineVkImplTraits.hpp"
 #include "ObjectBase.hpp"
@@ -155,11 +156,35 @@ public:
         return m_LastSyncPoint;
     }
 
+    // Makes every submission signal the queue timeline semaphore with its fence value, which
+    // allows tracking the completion without fences, and enables merging up to MaxSubmitBatchSize
+    // consecutive submissions into one vkQueueSubmit call.
+    // Requires timeline semaphores and must be called before the first submission.
+    void EnableCompletionTracking(Uint32 MaxSubmitBatchSize);
+
+    // Returns the timeline semaphore that is signaled with the fence value of every submission,
+    // or null if completion tracking is disabled.
+    VkSemaphore GetCompletionSemaphore() const { return m_CompletionSemaphore; }
+
+    // Submits batched submissions to the Vulkan queue.
+    void SubmitPendingBatch();
+
 private:
     SyncPointVkPtr CreateSyncPoint(Uint64 dbgValue);
 
     void InternalSignalSemaphore(VkSemaphore vkTimelineSemaphore, Uint64 Value);
 
+    Uint64 SubmitTracked(const VkSubmitInfo& SubmitInfo);
+    void   AppendToBatch(const VkSubmitInfo& SubmitInfo, Uint64 FenceValue);
+    void   InternalSubmitPendingBatch();
+    void   AddPendingSyncPoint(Uint64 FenceValue, SyncPointVkPtr SyncPoint);
+
+    void SetLastSyncPoint(SyncPointVkPtr SyncPoint)
+    {
+        ThreadingTools::LockHelper Lock{m_LastSyncPointGuard};
+        m_LastSyncPoint = std::move(SyncPoint);
+    }
+
     std::shared_ptr<VulkanUtilities::VulkanLogicalDevice> m_LogicalDevice;
 
     const VkQueue            m_VkQueue;
@@ -191,6 +216,52 @@ private:
 
     std::shared_ptr<VulkanUtilities::VulkanSyncObjectManager> m_SyncObjectManager;
     FixedBlockMemoryAllocator                                 m_SyncPointAllocator;
+
+    // Timeline semaphore that is signaled with the fence value of every submission
+    // when completion tracking is enabled.
+    VulkanUtilities::SemaphoreWrapper m_CompletionSemaphore;
+
+    Uint32 m_MaxSubmitBatchSize = 1;
+
+    // Submissions that have not yet been passed to vkQueueSubmit. Wait and signal semaphores
+    // and command buffers of all submissions are stored in shared arrays.
+    struct SubmitBatch
+    {
+        struct Range
+        {
+            Uint32 First = 0;
+            Uint32 Count = 0;
+        };
+        struct Entry
+        {
+            Range Waits;
+            Range CmdBuffers;
+            Range Signals;
+        };
+        std::vector<Entry> Entries;
+
+        std::vector<VkSemaphore>          WaitSemaphores;
+        std::vector<VkPipelineStageFlags> WaitDstStageMasks;
+        std::vector<Uint64>               WaitValues;
+        std::vector<VkCommandBuffer>      CmdBuffers;
+        std::vector<VkSemaphore>          SignalSemaphores;
+        std::vector<Uint64>               SignalValues;
+
+        std::vector<VkSubmitInfo>                  SubmitInfos;
+        std::vector<VkTimelineSemaphoreSubmitInfo> TimelineInfos;
+
+        // All submissions of the batch share the fence that is signaled by vkQueueSubmit
+        SyncPointVkPtr SyncPoint;
+
+        // Fence value of the last submission in the batch
+        Uint64 LastFenceValue = 0;
+
+        void Clear();
+    };
+    SubmitBatch m_Batch;
+
+    // Allows skipping the queue mutex when there are no batched submissions
+    std::atomic<bool> m_HasPendingBatch{false};
 };
 
 } // namespace Diligent
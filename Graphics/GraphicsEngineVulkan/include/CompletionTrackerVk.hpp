@@ -0,0 +1,68 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::CompletionTrackerVk class
+
+#include <atomic>
+#include <thread>
+
+namespace Diligent
+{
+
+class RenderDeviceVkImpl;
+
+/// Releases stale resources from a background thread as soon as the GPU completes the command buffers.
+
+/// The thread blocks in vkWaitSemaphores on the completion semaphores of all command queues
+/// (see CommandQueueVkImpl::EnableCompletionTracking()) and purges the release queue of the queue
+/// whose semaphore has advanced, so the submission and ReleaseStaleResources() do not need to poll fences.
+class CompletionTrackerVk
+{
+public:
+    explicit CompletionTrackerVk(RenderDeviceVkImpl& DeviceVk);
+
+    // clang-format off
+    CompletionTrackerVk             (const CompletionTrackerVk&) = delete;
+    CompletionTrackerVk             (CompletionTrackerVk&&)      = delete;
+    CompletionTrackerVk& operator = (const CompletionTrackerVk&) = delete;
+    CompletionTrackerVk& operator = (CompletionTrackerVk&&)      = delete;
+    // clang-format on
+
+    ~CompletionTrackerVk();
+
+private:
+    void ThreadFunc();
+
+    RenderDeviceVkImpl& m_DeviceVk;
+
+    std::atomic<bool> m_Stop{false};
+    std::thread       m_Thread;
+};
+
+} // namespace Diligent
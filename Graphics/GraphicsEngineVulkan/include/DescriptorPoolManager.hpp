@@ -34,31 +34,73 @@
 #include <deque>
 #include <mutex>
 #include <atomic>
+#include <array>
+#include <memory>
+#include <unordered_set>
 
 #include "VulkanUtilities/VulkanObjectWrappers.hpp"
+#include "DebugUtilities.hpp"
 
 namespace Diligent
 {
 
 class DescriptorSetAllocator;
 class RenderDeviceVkImpl;
+struct DescriptorSetPool;
+struct DescriptorSetAllocatorStatsVk;
+
+// Number of descriptors of every type, e.g. in a descriptor set layout or in a descriptor pool
+struct DescriptorTypeCounts
+{
+    // VK_DESCRIPTOR_TYPE_SAMPLER ... VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT, VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR
+    static constexpr Uint32 NumTypes = VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT + 2;
+
+    std::array<Uint32, NumTypes> Counts = {};
+
+    static Uint32 TypeToIndex(VkDescriptorType Type)
+    {
+        if (Type >= VK_DESCRIPTOR_TYPE_SAMPLER && Type <= VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT)
+            return static_cast<Uint32>(Type);
+
+        VERIFY(Type == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR, "Unexpected descriptor type");
+        return NumTypes - 1;
+    }
+
+    static VkDescriptorType IndexToType(Uint32 Index)
+    {
+        VERIFY_EXPR(Index < NumTypes);
+        return Index < NumTypes - 1 ? static_cast<VkDescriptorType>(Index) : VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR;
+    }
+
+    Uint32& operator[](VkDescriptorType Type) { return Counts[TypeToIndex(Type)]; }
+    Uint32  operator[](VkDescriptorType Type) const { return Counts[TypeToIndex(Type)]; }
+
+    bool operator==(const DescriptorTypeCounts& rhs) const { return Counts == rhs.Counts; }
+
+    struct Hasher
+    {
+        size_t operator()(const DescriptorTypeCounts& Counts) const;
+    };
+};
 
 // This class manages descriptor set allocation.
 // The class destructor calls DescriptorSetAllocator::FreeDescriptorSet() that moves
 // the set into the release queue.
-// sizeof(DescriptorSetAllocation) == 32 (x64)
+// sizeof(DescriptorSetAllocation) == 40 (x64)
 class DescriptorSetAllocation
 {
 public:
     // clang-format off
-    DescriptorSetAllocation(VkDescriptorSet         _Set,
-                            VkDescriptorPool        _Pool,
-                            Uint64                  _CmdQueueMask,
-                            DescriptorSetAllocator& _DescrSetAllocator)noexcept :
+    DescriptorSetAllocation(VkDescriptorSet             _Set,
+                            DescriptorSetPool*          _Pool,
+                            Uint64                      _CmdQueueMask,
+                            DescriptorSetAllocator&     _DescrSetAllocator,
+                            const DescriptorTypeCounts* _LayoutCounts)noexcept :
         Set              {_Set               },
         Pool             {_Pool              },
         CmdQueueMask     {_CmdQueueMask      },
-        DescrSetAllocator{&_DescrSetAllocator}
+        DescrSetAllocator{&_DescrSetAllocator},
+        LayoutCounts     {_LayoutCounts      }
     {}
     DescriptorSetAllocation()noexcept{}
 
@@ -69,7 +111,8 @@ public:
         Set              {rhs.Set              },
         Pool             {rhs.Pool             },
         CmdQueueMask     {rhs.CmdQueueMask     },
-        DescrSetAllocator{rhs.DescrSetAllocator}
+        DescrSetAllocator{rhs.DescrSetAllocator},
+        LayoutCounts     {rhs.LayoutCounts     }
     {
         rhs.Reset();
     }
@@ -83,6 +126,7 @@ public:
         CmdQueueMask      = rhs.CmdQueueMask;
         Pool              = rhs.Pool;
         DescrSetAllocator = rhs.DescrSetAllocator;
+        LayoutCounts      = rhs.LayoutCounts;
 
         rhs.Reset();
 
@@ -97,9 +141,10 @@ public:
     void Reset()
     {
         Set               = VK_NULL_HANDLE;
-        Pool              = VK_NULL_HANDLE;
+        Pool              = nullptr;
         CmdQueueMask      = 0;
         DescrSetAllocator = nullptr;
+        LayoutCounts      = nullptr;
     }
 
     void Release();
@@ -112,10 +157,11 @@ public:
     VkDescriptorSet GetVkDescriptorSet() const { return Set; }
 
 private:
-    VkDescriptorSet         Set               = VK_NULL_HANDLE;
-    VkDescriptorPool        Pool              = VK_NULL_HANDLE;
-    Uint64                  CmdQueueMask      = 0;
-    DescriptorSetAllocator* DescrSetAllocator = nullptr;
+    VkDescriptorSet             Set               = VK_NULL_HANDLE;
+    DescriptorSetPool*          Pool              = nullptr;
+    Uint64                      CmdQueueMask      = 0;
+    DescriptorSetAllocator*     DescrSetAllocator = nullptr;
+    const DescriptorTypeCounts* LayoutCounts      = nullptr;
 };
 
 
@@ -162,6 +208,9 @@ public:
 
 protected:
     VulkanUtilities::DescriptorPoolWrapper CreateDescriptorPool(const char* DebugName) const;
+    VulkanUtilities::DescriptorPoolWrapper CreateDescriptorPool(const char*                              DebugName,
+                                                                const std::vector<VkDescriptorPoolSize>& PoolSizes,
+                                                                uint32_t                                 MaxSets) const;
 
     RenderDeviceVkImpl& m_DeviceVkImpl;
     const std::string   m_PoolName;
@@ -182,8 +231,49 @@ private:
 };
 
 
+// Descriptor pool owned by the DescriptorSetAllocator that keeps track of its remaining capacity
+struct DescriptorSetPool
+{
+    VulkanUtilities::DescriptorPoolWrapper vkPool;
+
+    // Index of the thread cache the pool belongs to
+    const Uint32 CacheIdx;
+
+    const Uint32 MaxSets;
+
+    Uint32               RemainingSets = 0;
+    DescriptorTypeCounts RemainingDescriptors;
+
+    // Set when vkAllocateDescriptorSets fails even though the pool has enough space.
+    // The pool is skipped until one of its sets is freed.
+    bool IsFragmented = false;
+
+    DescriptorSetPool(VulkanUtilities::DescriptorPoolWrapper&& _vkPool,
+                      Uint32                                   _CacheIdx,
+                      const std::vector<VkDescriptorPoolSize>& PoolSizes,
+                      Uint32                                   _MaxSets) noexcept;
+
+    bool CanAllocate(const DescriptorTypeCounts& LayoutCounts) const;
+    void OnAllocate(const DescriptorTypeCounts& LayoutCounts);
+    void OnFree(const DescriptorTypeCounts& LayoutCounts);
+};
+
+
 // The class allocates descriptor sets from the main descriptor pool.
-// Descriptors sets can be released and returned to the pool
+// Descriptors sets can be released and returned to the pool.
+// Every thread allocates sets from its own cache of pools, so that threads that
+// create resource bindings in parallel do not contend for the same lock. Every pool
+// keeps track of its remaining capacity, so that pools that can't fit the layout are
+// skipped without a driver call. New pools are sized from the histogram of the
+// descriptor types that have been allocated by the thread.
+//   _______________________________________________________________
+//  |                                                               |
+//  |                      DescriptorSetAllocator                   |
+//  |                                                               |
+//  |   ThreadCache[0]          ThreadCache[1]             ...      |
+//  |  | Pool[0] | Pool[1] |   | Pool[0] | Pool[1] | ... |          |
+//  |_______________________________________________________________|
+//
 class DescriptorSetAllocator : public DescriptorPoolManager
 {
 public:
@@ -192,26 +282,26 @@ public:
                            std::string                       PoolName,
                            std::vector<VkDescriptorPoolSize> PoolSizes,
                            uint32_t                          MaxSets,
-                           bool                              AllowFreeing) noexcept :
-        // clang-format off
-        DescriptorPoolManager
-        {
-            DeviceVkImpl,
-            std::move(PoolName),
-            std::move(PoolSizes),
-            MaxSets,
-            AllowFreeing
-        }
-    // clang-format on
-    {
-#ifdef DILIGENT_DEVELOPMENT
-        m_AllocatedSetCounter = 0;
-#endif
-    }
+                           bool                              AllowFreeing) noexcept;
 
     ~DescriptorSetAllocator();
 
-    DescriptorSetAllocation Allocate(Uint64 CommandQueueMask, VkDescriptorSetLayout SetLayout, const char* DebugName = "");
+    // Returns the pointer to the descriptor counts that remains valid for the lifetime of the allocator.
+    // The pointer must be passed to Allocate().
+    const DescriptorTypeCounts* GetLayoutDescriptorCounts(const DescriptorTypeCounts& LayoutCounts);
+
+    DescriptorSetAllocation Allocate(Uint64                      CommandQueueMask,
+                                     VkDescriptorSetLayout       SetLayout,
+                                     const DescriptorTypeCounts* pLayoutCounts,
+                                     const char*                 DebugName = "");
+
+    // Returns the number of vkAllocateDescriptorSets calls that have failed
+    Uint32 GetFailedAllocationCounter() const
+    {
+        return m_FailedAllocationCounter.load();
+    }
+
+    void GetStats(DescriptorSetAllocatorStatsVk& Stats);
 
 #ifdef DILIGENT_DEVELOPMENT
     Int32 GetAllocatedDescriptorSetCounter() const
@@ -221,7 +311,32 @@ public:
 #endif
 
 private:
-    void FreeDescriptorSet(VkDescriptorSet Set, VkDescriptorPool Pool, Uint64 QueueMask);
+    void FreeDescriptorSet(VkDescriptorSet Set, DescriptorSetPool* Pool, const DescriptorTypeCounts* LayoutCounts, Uint64 QueueMask);
+
+    struct ThreadCache
+    {
+        // Descriptor pools are externally synchronized (13.2.3)
+        std::mutex Mtx;
+
+        std::deque<std::unique_ptr<DescriptorSetPool>> Pools;
+
+        // The total number of descriptors of every type and the number of sets allocated from this cache
+        std::array<Uint64, DescriptorTypeCounts::NumTypes> DescriptorHistogram = {};
+        Uint64                                             NumAllocatedSets    = 0;
+    };
+    // Threads are assigned to the caches in round-robin order
+    static constexpr Uint32                  NumThreadCaches = 16;
+    std::array<ThreadCache, NumThreadCaches> m_ThreadCaches;
+
+    void GetNewPoolSize(const ThreadCache&                 Cache,
+                        const DescriptorTypeCounts&        LayoutCounts,
+                        std::vector<VkDescriptorPoolSize>& PoolSizes,
+                        Uint32&                            MaxSets) const;
+
+    std::mutex                                                             m_LayoutCountsMtx;
+    std::unordered_set<DescriptorTypeCounts, DescriptorTypeCounts::Hasher> m_LayoutCounts;
+
+    std::atomic<Uint32> m_FailedAllocationCounter{0};
 
 #ifdef DILIGENT_DEVELOPMENT
     std::atomic<Int32> m_AllocatedSetCounter;
@@ -43,6 +43,7 @@
 #include "QueryVkImpl.hpp"
 #include "FramebufferVkImpl.hpp"
 #include "RenderPassVkImpl.hpp"
+#include "RenderPassCache.hpp"
 #include "BottomLevelASVkImpl.hpp"
 #include "TopLevelASVkImpl.hpp"
 #include "ShaderBindingTableVkImpl.hpp"
@@ -143,6 +144,10 @@ public:
     virtual void DILIGENT_CALL_TYPE Draw               (const DrawAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndexed() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE DrawIndexed        (const DrawIndexedAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDraw() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE MultiDraw          (const MultiDrawAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDrawIndexed() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE MultiDrawIndexed   (const MultiDrawIndexedAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndirect() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE DrawIndirect       (const DrawIndirectAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndexedIndirect() in Vulkan backend.
@@ -300,6 +305,12 @@ public:
                                 STATE_TRANSITION_FLAGS   Flags,
                                 VkImageSubresourceRange* pSubresRange = nullptr);
 
+    // Makes the aliased transient texture the owner of its memory before it is used in RequiredState.
+    // If another texture that shares the memory may have been used since this texture was last used
+    // by the context, records an aliasing barrier and transitions the texture from the undefined layout.
+    // This is done in all state transition modes and for textures in unknown state.
+    void AcquireTransientTexture(TextureVkImpl& TextureVk, RESOURCE_STATE RequiredState);
+
     /// Implementation of IDeviceContextVk::TransitionImageLayout().
     virtual void DILIGENT_CALL_TYPE TransitionImageLayout(ITexture* pTexture, VkImageLayout NewLayout) override final;
 
@@ -419,6 +430,10 @@ private:
                                                      VkAccessFlagBits               ExpectedAccessFlags,
                                                      const char*                    OperationName);
 
+    // Updates the transient memory ownership of the aliased texture and records a memory barrier
+    // if the texture has become the owner. Returns true if the texture contents must be discarded.
+    bool AcquireTransientMemory(TextureVkImpl& TextureVk);
+
     __forceinline void TransitionOrVerifyTextureState(TextureVkImpl&                 Texture,
                                                       RESOURCE_STATE_TRANSITION_MODE TransitionMode,
                                                       RESOURCE_STATE                 RequiredState,
@@ -485,6 +500,12 @@ private:
     void PrepareCommandPool(SoftwareQueueIndex CommandQueueId);
 
     void ChooseRenderPassAndFramebuffer();
+    void PrepareDynamicRenderingInfo();
+
+    RenderPassCache::RenderPassCacheKey GetImplicitRenderPassKey() const;
+
+    // Returns true if render targets are bound either through a render pass and framebuffer or for dynamic rendering
+    bool HasBoundFramebuffer() const { return m_vkFramebuffer != VK_NULL_HANDLE || m_vkRenderingInfo.layerCount != 0; }
 
     VulkanUtilities::VulkanCommandBuffer m_CommandBuffer;
 
@@ -524,6 +545,10 @@ private:
             // Note that this is not the actual number of dynamic buffers in the resource cache.
             Uint32 DynamicOffsetCount = 0;
 
+            // Whether the dynamic descriptor set is pushed to the command buffer rather than bound.
+            // The pushed set always follows the sets in vkSets.
+            bool PushDynamicSet = false;
+
 #ifdef DILIGENT_DEVELOPMENT
             // The descriptor set base index that was used in the last BindDescriptorSets() call
             Uint32 LastBoundBaseInd = ~0u;
@@ -534,6 +559,11 @@ private:
         // Pipeline layout of the currently bound pipeline
         VkPipelineLayout vkPipelineLayout = VK_NULL_HANDLE;
 
+        // Descriptor data and writes of the push descriptor set. Only the signature
+        // with binding index 0 may use push descriptors.
+        std::vector<Uint8>                PushDescriptorData;
+        std::vector<VkWriteDescriptorSet> PushDescriptorWrites;
+
         ResourceBindInfo()
         {}
     };
@@ -551,6 +581,13 @@ private:
     /// Memory to store dynamic buffer offsets for descriptor sets.
     std::vector<Uint32> m_DynamicBufferOffsets;
 
+    /// Scratch memory for the dynamic descriptor set update template data.
+    std::vector<Uint8> m_DynamicDescriptorData;
+
+    /// Memory to store per-draw arguments of native multi-draw commands.
+    std::vector<VkMultiDrawInfoEXT>        m_MultiDrawInfo;
+    std::vector<VkMultiDrawIndexedInfoEXT> m_MultiDrawIndexedInfo;
+
     /// Render pass that matches currently bound render targets.
     /// This render pass may or may not be currently set in the command buffer
     VkRenderPass m_vkRenderPass = VK_NULL_HANDLE;
@@ -559,6 +596,19 @@ private:
     /// This framebuffer may or may not be currently set in the command buffer
     VkFramebuffer m_vkFramebuffer = VK_NULL_HANDLE;
 
+    /// Indicates if render targets set by SetRenderTargets() are bound using dynamic rendering
+    /// rather than implicit render pass and framebuffer from the caches.
+    const bool m_DynamicRenderingEnabled;
+
+    /// Rendering info that matches currently bound render targets when dynamic rendering is used
+    /// (layerCount is zero otherwise). Attachment descriptions are stored in the context, so that
+    /// SetRenderTargets() neither allocates memory nor locks the render pass and framebuffer caches.
+    /// Similar to the framebuffer, this rendering may or may not be currently active in the command buffer.
+    VkRenderingInfoKHR                                           m_vkRenderingInfo     = {};
+    std::array<VkRenderingAttachmentInfoKHR, MAX_RENDER_TARGETS> m_vkColorAttachments  = {};
+    VkRenderingAttachmentInfoKHR                                 m_vkDepthAttachment   = {};
+    VkRenderingAttachmentInfoKHR                                 m_vkStencilAttachment = {};
+
     FixedBlockMemoryAllocator m_CmdListAllocator;
 
     // Semaphores are not owned by the command context
@@ -607,6 +657,12 @@ private:
     };
     std::unordered_map<MappedTextureKey, MappedTexture, MappedTextureKey::Hasher> m_MappedTextures;
 
+    // Owners of the transient memory ranges in the recording order of this context, for every
+    // transient memory object (see TransientMemoryVk::Acquire()). Ownership is unknown at the beginning
+    // of a command list, after command lists are executed and at the beginning of a frame, so the map
+    // is cleared and the next use of every aliased texture records an aliasing barrier.
+    std::unordered_map<UniqueIdentifier, std::vector<bool>> m_TransientMemoryOwners;
+
     // Command pools for every queue family
     std::unique_ptr<std::unique_ptr<VulkanUtilities::VulkanCommandBufferPool>[]> m_QueueFamilyCmdPools;
     // Command pool for the family for which we are recording commands
@@ -59,6 +59,16 @@ public:
         return m_FirstDescrSetIndex[Index];
     }
 
+    // Returns true if the layout includes the bindless heap descriptor set
+    bool HasBindlessHeapSet() const { return m_BindlessHeapSetIndex != InvalidSetIndex; }
+
+    // Returns the index of the bindless heap descriptor set, which always follows the sets of all resource signatures
+    Uint32 GetBindlessHeapSetIndex() const
+    {
+        VERIFY_EXPR(HasBindlessHeapSet());
+        return m_BindlessHeapSetIndex;
+    }
+
 private:
     VulkanUtilities::PipelineLayoutWrapper m_VkPipelineLayout;
 
@@ -70,6 +80,11 @@ private:
     // (Maximum is MAX_RESOURCE_SIGNATURES * 2)
     Uint8 m_DescrSetCount = 0;
 
+    static constexpr Uint8 InvalidSetIndex = 0xFF;
+
+    // Index of the bindless heap descriptor set, or InvalidSetIndex if no signature uses the heap
+    Uint8 m_BindlessHeapSetIndex = InvalidSetIndex;
+
 #ifdef DILIGENT_DEBUG
     Uint32 m_DbgMaxBindIndex = 0;
 #endif
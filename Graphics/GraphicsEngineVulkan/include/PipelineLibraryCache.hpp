@@ -0,0 +1,162 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::PipelineLibraryCache class
+
+#include <unordered_map>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <cstring>
+#include <type_traits>
+
+#include "VulkanUtilities/VulkanObjectWrappers.hpp"
+#include "HashUtils.hpp"
+
+namespace Diligent
+{
+
+class RenderDeviceVkImpl;
+
+/// Cache of graphics pipeline libraries (VK_EXT_graphics_pipeline_library).
+
+/// A graphics pipeline is split into vertex input, pre-rasterization shaders, fragment shader and
+/// fragment output parts. Every part is compiled into a pipeline library that is shared by all pipeline
+/// states that use identical state for that part, and pipelines are then created by linking the libraries.
+/// The cache does not own the libraries: a library is destroyed when the last pipeline state that
+/// references it is released.
+class PipelineLibraryCache
+{
+public:
+    PipelineLibraryCache(RenderDeviceVkImpl& DeviceVk) noexcept;
+
+    // clang-format off
+    PipelineLibraryCache             (const PipelineLibraryCache&) = delete;
+    PipelineLibraryCache             (PipelineLibraryCache&&)      = delete;
+    PipelineLibraryCache& operator = (const PipelineLibraryCache&) = delete;
+    PipelineLibraryCache& operator = (PipelineLibraryCache&&)      = delete;
+    // clang-format on
+
+    ~PipelineLibraryCache();
+
+    // This structure is used as the key to find a pipeline library.
+    // All state that affects the library is packed into an array of 32-bit words.
+    class LibraryKey
+    {
+    public:
+        explicit LibraryKey(VkGraphicsPipelineLibraryFlagsEXT Type) :
+            m_Type{Type}
+        {}
+
+        // Adds a scalar value, an enum or a Vulkan handle to the key
+        template <typename T>
+        void Add(const T& Value)
+        {
+            static_assert(std::is_scalar<T>::value, "Only scalar values can be added to the key");
+            static_assert(sizeof(T) % sizeof(Uint32) == 0 || sizeof(T) < sizeof(Uint32), "Unexpected value size");
+
+            Uint32 Words[(sizeof(T) + sizeof(Uint32) - 1) / sizeof(Uint32)] = {};
+            std::memcpy(Words, &Value, sizeof(T));
+            AddWords(Words, _countof(Words));
+        }
+
+        void AddWords(const Uint32* pWords, size_t Count)
+        {
+            m_Data.insert(m_Data.end(), pWords, pWords + Count);
+            m_Hash = 0;
+        }
+
+        void AddString(const char* Str);
+
+        VkGraphicsPipelineLibraryFlagsEXT GetType() const { return m_Type; }
+
+        bool operator==(const LibraryKey& rhs) const
+        {
+            return GetHash() == rhs.GetHash() && m_Type == rhs.m_Type && m_Data == rhs.m_Data;
+        }
+
+        size_t GetHash() const
+        {
+            if (m_Hash == 0)
+            {
+                m_Hash = ComputeHashRaw(m_Data.data(), m_Data.size() * sizeof(Uint32));
+                HashCombine(m_Hash, m_Type);
+            }
+            return m_Hash;
+        }
+
+        struct Hasher
+        {
+            size_t operator()(const LibraryKey& Key) const
+            {
+                return Key.GetHash();
+            }
+        };
+
+    private:
+        VkGraphicsPipelineLibraryFlagsEXT m_Type;
+        std::vector<Uint32>               m_Data;
+        mutable size_t                    m_Hash = 0;
+    };
+
+    using LibraryPtr = std::shared_ptr<const VulkanUtilities::PipelineWrapper>;
+
+    // Returns the library that matches the key. If there is no such library, creates a new one
+    // from LibraryCI, which must include VkGraphicsPipelineLibraryCreateInfoEXT with the same type as the key.
+    // The library creation is performed without holding the cache lock.
+    LibraryPtr GetLibrary(const LibraryKey&                   Key,
+                          const VkGraphicsPipelineCreateInfo& LibraryCI,
+                          VkPipelineCache                     vkPSOCache,
+                          const char*                         DebugName) noexcept(false);
+
+    struct Statistics
+    {
+        Uint32 NumLibraries = 0; // The number of libraries that are alive
+        Uint32 NumCreated   = 0;
+        Uint32 NumReused    = 0;
+    };
+    Statistics GetStatistics();
+
+private:
+    // Removes entries whose libraries have been released
+    void PurgeExpiredEntries();
+
+    RenderDeviceVkImpl& m_DeviceVkImpl;
+
+    std::mutex                                                                                                m_Mutex;
+    std::unordered_map<LibraryKey, std::weak_ptr<const VulkanUtilities::PipelineWrapper>, LibraryKey::Hasher> m_Cache;
+
+    // The cache size at which expired entries are purged next time
+    size_t m_NextPurgeSize = 64;
+
+    Uint32 m_NumHits   = 0;
+    Uint32 m_NumMisses = 0;
+};
+
+} // namespace Diligent
@@ -31,6 +31,7 @@
 /// Declaration of Diligent::PipelineResourceSignatureVkImpl class
 
 #include <array>
+#include <vector>
 
 #include "EngineVkImplTraits.hpp"
 #include "PipelineResourceSignatureBase.hpp"
@@ -155,9 +156,37 @@ public:
     // Copies static resources from the static resource cache to the destination cache
     void CopyStaticResources(ShaderResourceCacheVk& ResourceCache) const;
 
-    // Commits dynamic resources from ResourceCache to vkDynamicDescriptorSet
+    // Commits dynamic resources from ResourceCache to vkDynamicDescriptorSet.
+    // DescriptorData is the scratch memory for the descriptor update template.
     void CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
-                                VkDescriptorSet              vkDynamicDescriptorSet) const;
+                                VkDescriptorSet              vkDynamicDescriptorSet,
+                                std::vector<Uint8>&          DescriptorData) const;
+
+    // Writes descriptors of all dynamic resources from ResourceCache to pData in the layout
+    // of the dynamic set update template (see GetDynamicDescriptorDataSize()).
+    // If pWrites is not null, also fills the descriptor writes that reference pData and skip
+    // null descriptors. Otherwise, stops at the first null descriptor.
+    // Returns true if all descriptors are not null.
+    bool WriteDynamicDescriptors(const ShaderResourceCacheVk&       ResourceCache,
+                                 Uint8*                             pData,
+                                 std::vector<VkWriteDescriptorSet>* pWrites) const;
+
+    // Returns the size of the dynamic descriptor data, in bytes
+    Uint32 GetDynamicDescriptorDataSize() const { return m_DynamicDescriptorDataSize; }
+
+    // Returns true if the dynamic descriptor set is not allocated, but pushed
+    // to the command buffer with vkCmdPushDescriptorSetKHR.
+    bool HasPushDescriptorSet() const { return m_HasPushDescriptorSet; }
+
+    // Returns true if the resource is backed by the device bindless heap rather than
+    // by the signature descriptor sets (see PIPELINE_RESOURCE_FLAG_BINDLESS_HEAP).
+    static bool IsBindlessHeapResource(const PipelineResourceDesc& ResDesc)
+    {
+        return (ResDesc.Flags & PIPELINE_RESOURCE_FLAG_BINDLESS_HEAP) != 0;
+    }
+
+    // Returns true if the signature has at least one bindless heap resource
+    bool HasBindlessHeapResources() const { return m_HasBindlessHeapResources; }
 
 #ifdef DILIGENT_DEVELOPMENT
     /// Verifies committed resource using the SPIRV resource attributes from the PSO.
@@ -203,12 +232,28 @@ private:
 
     void CreateSetLayouts(bool IsSerialized);
 
+    void InitDynamicSetUpdateEntries();
+
     static inline CACHE_GROUP       GetResourceCacheGroup(const PipelineResourceDesc& Res);
     static inline DESCRIPTOR_SET_ID VarTypeToDescriptorSetId(SHADER_RESOURCE_VARIABLE_TYPE VarType);
 
 private:
     std::array<VulkanUtilities::DescriptorSetLayoutWrapper, DESCRIPTOR_SET_ID_NUM_SETS> m_VkDescrSetLayouts;
 
+    // Descriptor update template that writes the entire dynamic descriptor set with a single call
+    VulkanUtilities::DescrUpdateTemplateWrapper m_DynamicSetUpdateTemplate;
+
+    // Update template entries for every dynamic resource except for separate immutable samplers,
+    // in the same order as the resources.
+    std::vector<VkDescriptorUpdateTemplateEntry> m_DynamicSetUpdateEntries;
+
+    // The size of the dynamic descriptor data that is referenced by m_DynamicSetUpdateEntries, in bytes
+    Uint32 m_DynamicDescriptorDataSize = 0;
+
+    // The number of descriptors of every type in the static/mutable descriptor set layout.
+    // The counts are owned by the device's descriptor set allocator.
+    const DescriptorTypeCounts* m_StaticMutableSetDescriptorCounts = nullptr;
+
     // Descriptor set sizes indexed by the set index in the layout (not DESCRIPTOR_SET_ID!)
     std::array<Uint32, MAX_DESCRIPTOR_SETS> m_DescriptorSetSizes = {~0U, ~0U};
 
@@ -219,6 +264,12 @@ private:
     // accounting for array size.
     Uint16 m_DynamicStorageBufferCount = 0;
 
+    // Whether the dynamic descriptor set layout was created with VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR
+    bool m_HasPushDescriptorSet = false;
+
+    // Whether the signature has resources with PIPELINE_RESOURCE_FLAG_BINDLESS_HEAP flag
+    bool m_HasBindlessHeapResources = false;
+
     ImmutableSamplerAttribs* m_ImmutableSamplers = nullptr; // [m_Desc.NumImmutableSamplers]
 };
 
@@ -32,6 +32,7 @@
 
 #include <array>
 #include <memory>
+#include <atomic>
 
 #include "EngineVkImplTraits.hpp"
 #include "PipelineStateBase.hpp"
@@ -41,6 +42,7 @@
 #include "FixedBlockMemoryAllocator.hpp"
 #include "SRBMemoryAllocator.hpp"
 #include "PipelineLayoutVk.hpp"
+#include "PipelineLibraryCache.hpp"
 #include "VulkanUtilities/VulkanObjectWrappers.hpp"
 #include "VulkanUtilities/VulkanCommandBuffer.hpp"
 
@@ -66,7 +68,11 @@ public:
     virtual IRenderPassVk* DILIGENT_CALL_TYPE GetRenderPass() const override final { return GetRenderPassPtr().RawPtr<IRenderPassVk>(); }
 
     /// Implementation of IPipelineStateVk::GetVkPipeline().
-    virtual VkPipeline DILIGENT_CALL_TYPE GetVkPipeline() const override final { return m_Pipeline; }
+    virtual VkPipeline DILIGENT_CALL_TYPE GetVkPipeline() const override final
+    {
+        // Once the optimized pipeline is linked in the background, it transparently replaces the fast-linked one
+        return m_OptimizedPipelineReady.load(std::memory_order_acquire) ? m_OptimizedPipeline : m_Pipeline;
+    }
 
     const PipelineLayoutVk& GetPipelineLayout() const { return m_PipelineLayout; }
 
@@ -118,6 +124,10 @@ public:
         Uint32                            SRBAllocationGranularity) noexcept(false);
 
 private:
+    void InitializePipeline(const GraphicsPipelineStateCreateInfo& CreateInfo) noexcept(false);
+    void InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo) noexcept(false);
+    void InitializePipeline(const RayTracingPipelineStateCreateInfo& CreateInfo) noexcept(false);
+
     template <typename PSOCreateInfoType>
     TShaderStages InitInternalObjects(const PSOCreateInfoType&                           CreateInfo,
                                       std::vector<VkPipelineShaderStageCreateInfo>&      vkShaderStages,
@@ -126,11 +136,30 @@ private:
     void InitPipelineLayout(const PipelineStateCreateInfo& CreateInfo,
                             TShaderStages&                 ShaderStages) noexcept(false);
 
+    // Vertex input, pre-rasterization shaders, fragment shader and fragment output libraries
+    using GraphicsPipelineLibraries = std::array<PipelineLibraryCache::LibraryPtr, 4>;
+
+    VulkanUtilities::PipelineWrapper CreateGraphicsPipelineFromLibraries(const VkGraphicsPipelineCreateInfo& PipelineCI,
+                                                                         const TShaderStages&                ShaderStages,
+                                                                         VkPipelineCache                     vkPSOCache,
+                                                                         bool&                               NeedsOptimizedLink) noexcept(false);
+
+    void EnqueueOptimizedLink(IPipelineStateCache* pPSOCache);
+
     void Destruct();
 
     VulkanUtilities::PipelineWrapper m_Pipeline;
     PipelineLayoutVk                 m_PipelineLayout;
 
+    // Pipeline libraries this pipeline was linked from (only used if graphics pipeline libraries are enabled).
+    // Keeping them alive guarantees that the libraries stay in the cache while there are pipelines that use them.
+    GraphicsPipelineLibraries m_Libraries;
+
+    // Pipeline linked with link-time optimizations by m_pOptimizedLinkTask
+    VulkanUtilities::PipelineWrapper m_OptimizedPipeline;
+    std::atomic<bool>                m_OptimizedPipelineReady{false};
+    RefCntAutoPtr<IAsyncTask>        m_pOptimizedLinkTask;
+
 #ifdef DILIGENT_DEVELOPMENT
     // Shader resources for all shaders in all shader stages
     TShaderResources m_ShaderResources;
@@ -29,6 +29,7 @@
 
 /// \file
 /// Declaration of Diligent::RenderDeviceVkImpl class
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -51,6 +52,8 @@
 #include "VulkanUploadHeap.hpp"
 #include "FramebufferCache.hpp"
 #include "RenderPassCache.hpp"
+#include "PipelineLibraryCache.hpp"
+#include "BindlessHeapVk.hpp"
 #include "CommandPoolManager.hpp"
 #include "DXCompiler.hpp"
 
@@ -58,6 +61,7 @@ namespace Diligent
 {
 
 class QueryManagerVk;
+class CompletionTrackerVk;
 
 /// Render device implementation in Vulkan backend.
 class RenderDeviceVkImpl final : public RenderDeviceNextGenBase<RenderDeviceBase<EngineVkImplTraits>, ICommandQueueVk>
@@ -199,6 +203,24 @@ public:
                                                                   const FenceDesc& Desc,
                                                                   IFence**         ppFence) override final;
 
+    /// Implementation of IRenderDeviceVk::GetMemoryBudget().
+    virtual void DILIGENT_CALL_TYPE GetMemoryBudget(MemoryBudgetVk& Budget) override final;
+
+    /// Implementation of IRenderDeviceVk::CreateTransientTextures().
+    virtual void DILIGENT_CALL_TYPE CreateTransientTextures(const TransientTextureDescVk* pTexDescs,
+                                                            Uint32                        NumTextures,
+                                                            ITexture**                    ppTextures,
+                                                            TransientMemoryStatsVk*       pStats) override final;
+
+    /// Implementation of IRenderDeviceVk::GetPipelineLibraryStats().
+    virtual void DILIGENT_CALL_TYPE GetPipelineLibraryStats(PipelineLibraryStatsVk& Stats) override final;
+
+    /// Implementation of IRenderDeviceVk::GetDescriptorSetAllocatorStats().
+    virtual void DILIGENT_CALL_TYPE GetDescriptorSetAllocatorStats(DescriptorSetAllocatorStatsVk& Stats) override final
+    {
+        m_DescriptorSetAllocator.GetStats(Stats);
+    }
+
     /// Implementation of IRenderDevice::IdleGPU() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE IdleGPU() override final;
 
@@ -220,10 +242,11 @@ public:
                                                                                   RESOURCE_DIMENSION Dimension,
                                                                                   Uint32             SampleCount) const override final;
 
-    DescriptorSetAllocation AllocateDescriptorSet(Uint64 CommandQueueMask, VkDescriptorSetLayout SetLayout, const char* DebugName = "")
+    DescriptorSetAllocation AllocateDescriptorSet(Uint64 CommandQueueMask, VkDescriptorSetLayout SetLayout, const DescriptorTypeCounts* pLayoutCounts, const char* DebugName = "")
     {
-        return m_DescriptorSetAllocator.Allocate(CommandQueueMask, SetLayout, DebugName);
+        return m_DescriptorSetAllocator.Allocate(CommandQueueMask, SetLayout, pLayoutCounts, DebugName);
     }
+    DescriptorSetAllocator& GetDescriptorSetAllocator() { return m_DescriptorSetAllocator; }
     DescriptorPoolManager& GetDynamicDescriptorPool() { return m_DynamicDescriptorPool; }
 
     std::shared_ptr<const VulkanUtilities::VulkanInstance> GetVulkanInstance() const { return m_VulkanInstance; }
@@ -234,16 +257,41 @@ public:
     FramebufferCache& GetFramebufferCache() { return m_FramebufferCache; }
     RenderPassCache&  GetImplicitRenderPassCache() { return m_ImplicitRenderPassCache; }
 
-    VulkanUtilities::VulkanMemoryAllocation AllocateMemory(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProperties, VkMemoryAllocateFlags AllocateFlags = 0)
+    PipelineLibraryCache& GetPipelineLibraryCache() { return m_PipelineLibraryCache; }
+
+    // Returns null if the bindless heap is disabled
+    BindlessHeapVk* GetBindlessHeap() const { return m_pBindlessHeap.get(); }
+
+    // Returns true if transient textures that share memory have ever been created by the device.
+    // Device contexts use this flag to skip looking for such textures in shader resource bindings.
+    bool HasAliasedTextures() const { return m_HasAliasedTextures.load(std::memory_order_relaxed); }
+
+    CommandQueueVkImpl* GetCommandQueueVk(SoftwareQueueIndex CommandQueueId);
+
+    // Enables completion tracking in all command queues and starts the completion thread
+    // if EngineCI.EnableCompletionThread is true. Must be called after the queue fences are initialized.
+    void InitCompletionTracking(const EngineVkCreateInfo& EngineCI);
+
+    // Submits batched command buffers in all command queues to the GPU
+    void SubmitPendingCommandBatches();
+
+    VulkanUtilities::VulkanMemoryAllocation AllocateMemory(const VkMemoryRequirements&                    MemReqs,
+                                                           VkMemoryPropertyFlags                          MemoryProperties,
+                                                           VkMemoryAllocateFlags                          AllocateFlags = 0,
+                                                           const VulkanUtilities::VulkanDedicatedResource* pDedicatedRes = nullptr)
     {
-        return m_MemoryMgr.Allocate(MemReqs, MemoryProperties, AllocateFlags);
+        return m_MemoryMgr.Allocate(MemReqs, MemoryProperties, AllocateFlags, pDedicatedRes);
     }
-    VulkanUtilities::VulkanMemoryAllocation AllocateMemory(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, VkMemoryAllocateFlags AllocateFlags = 0)
+    VulkanUtilities::VulkanMemoryAllocation AllocateMemory(VkDeviceSize                                    Size,
+                                                           VkDeviceSize                                    Alignment,
+                                                           uint32_t                                        MemoryTypeIndex,
+                                                           VkMemoryAllocateFlags                           AllocateFlags = 0,
+                                                           const VulkanUtilities::VulkanDedicatedResource* pDedicatedRes = nullptr)
     {
         const auto& MemoryProps = m_PhysicalDevice->GetMemoryProperties();
         VERIFY_EXPR(MemoryTypeIndex < MemoryProps.memoryTypeCount);
         const auto MemoryFlags = MemoryProps.memoryTypes[MemoryTypeIndex].propertyFlags;
-        return m_MemoryMgr.Allocate(Size, Alignment, MemoryTypeIndex, (MemoryFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0, AllocateFlags);
+        return m_MemoryMgr.Allocate(Size, Alignment, MemoryTypeIndex, (MemoryFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0, AllocateFlags, pDedicatedRes);
     }
     VulkanUtilities::VulkanMemoryManager& GetGlobalMemoryManager() { return m_MemoryMgr; }
 
@@ -295,9 +343,12 @@ private:
 
     FramebufferCache       m_FramebufferCache;
     RenderPassCache        m_ImplicitRenderPassCache;
+    PipelineLibraryCache   m_PipelineLibraryCache;
     DescriptorSetAllocator m_DescriptorSetAllocator;
     DescriptorPoolManager  m_DynamicDescriptorPool;
 
+    std::unique_ptr<BindlessHeapVk> m_pBindlessHeap;
+
     // These one-time command pools are used by buffer and texture constructors to
     // issue copy commands. Vulkan requires that every command pool is used by one thread
     // at a time, so every constructor must allocate command buffer from its own pool.
@@ -311,6 +362,11 @@ private:
     VulkanDynamicMemoryManager m_DynamicMemoryManager;
 
     std::unique_ptr<IDXCompiler> m_pDxCompiler;
+
+    // Releases stale resources when command buffers complete; null if the completion thread is disabled
+    std::unique_ptr<CompletionTrackerVk> m_pCompletionTracker;
+
+    std::atomic<bool> m_HasAliasedTextures{false};
 };
 
 } // namespace Diligent
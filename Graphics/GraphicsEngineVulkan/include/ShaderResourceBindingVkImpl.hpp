@@ -55,6 +55,9 @@ public:
     ~ShaderResourceBindingVkImpl();
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_ShaderResourceBindingVk, TBase)
+
+    /// Implementation of IShaderResourceBinding::SetVariables() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE SetVariables(const ShaderVariableBinding* pBindings, Uint32 NumBindings) override final;
 };
 
 } // namespace Diligent
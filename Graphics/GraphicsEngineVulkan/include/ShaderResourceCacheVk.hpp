@@ -68,7 +68,7 @@ namespace Diligent
 
 class DeviceContextVkImpl;
 
-// sizeof(ShaderResourceCacheVk) == 24 (x64, msvc, Release)
+// sizeof(ShaderResourceCacheVk) == 32 (x64, msvc, Release)
 class ShaderResourceCacheVk : public ShaderResourceCacheBase
 {
 public:
@@ -140,7 +140,7 @@ public:
         explicit operator bool() const { return !IsNull(); }
     };
 
-    // sizeof(DescriptorSet) == 48 (x64, msvc, Release)
+    // sizeof(DescriptorSet) == 56 (x64, msvc, Release)
     class DescriptorSet
     {
     public:
@@ -174,7 +174,7 @@ public:
     private:
 /* 8 */ Resource* const m_pResources = nullptr;
 /*16 */ DescriptorSetAllocation m_DescriptorSetAllocation;
-/*48 */ // End of structure
+/*56 */ // End of structure
         // clang-format on
 
     private:
@@ -235,6 +235,42 @@ public:
                                 Uint32                                      CacheOffset,
                                 SetResourceInfo&&                           SrcRes);
 
+    // Descriptor info that VkWriteDescriptorSet references
+    union DescriptorWriteInfo
+    {
+        VkDescriptorImageInfo                        vkDescrImageInfo;
+        VkDescriptorBufferInfo                       vkDescrBufferInfo;
+        VkBufferView                                 vkDescrBufferView;
+        VkWriteDescriptorSetAccelerationStructureKHR vkDescrAccelStructInfo;
+    };
+
+    // Descriptor writes accumulated while the batch is active, see BeginDescriptorWriteBatch().
+    struct DescriptorWriteBatch
+    {
+        // The write and the descriptor info are copied when the write is queued, so that
+        // the batch does not depend on the cache resources that may be rebound or reset
+        // before the batch is flushed. Pointers in vkWrite are fixed up by EndDescriptorWriteBatch()
+        // as the vector may be reallocated.
+        struct PendingWrite
+        {
+            VkWriteDescriptorSet vkWrite;
+            DescriptorWriteInfo  Info;
+            // Acceleration structure write info references the handle
+            VkAccelerationStructureKHR vkTLAS;
+        };
+        std::vector<PendingWrite> Writes;
+    };
+
+    // While the batch is active, SetResource() does not write descriptors to the descriptor
+    // sets immediately, but adds them to the batch. All accumulated descriptors are then
+    // written by EndDescriptorWriteBatch() with a single vkUpdateDescriptorSets call.
+    void BeginDescriptorWriteBatch(DescriptorWriteBatch& Batch)
+    {
+        VERIFY(m_pWriteBatch == nullptr, "Another descriptor write batch is already active");
+        m_pWriteBatch = &Batch;
+    }
+    void EndDescriptorWriteBatch(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice);
+
     const Resource& ResetResource(Uint32 SetIndex,
                                   Uint32 Offset)
     {
@@ -260,6 +296,9 @@ public:
     template <bool VerifyOnly>
     void TransitionResources(DeviceContextVkImpl* pCtxVkImpl);
 
+    // Makes aliased transient textures in the cache the owners of their memory (see DeviceContextVkImpl::AcquireTransientTexture())
+    void AcquireTransientTextures(DeviceContextVkImpl* pCtxVkImpl);
+
     __forceinline Uint32 GetDynamicBufferOffsets(DeviceContextIndex CtxId, std::vector<uint32_t>& Offsets) const;
 
 private:
@@ -280,6 +319,9 @@ private:
 
     std::unique_ptr<void, STDDeleter<void, IMemoryAllocator>> m_pMemory;
 
+    // Active descriptor write batch, see BeginDescriptorWriteBatch().
+    DescriptorWriteBatch* m_pWriteBatch = nullptr;
+
     Uint16 m_NumSets = 0;
 
     // Total actual number of dynamic buffers (that were created with USAGE_DYNAMIC) bound in the resource cache
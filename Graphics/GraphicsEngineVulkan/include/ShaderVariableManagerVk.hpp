@@ -102,9 +102,9 @@ public:
     IDeviceObject* Get(Uint32 ArrayIndex,
                        Uint32 ResIndex) const;
 
-    void BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags);
+    void BindResources(const ResourceMappingAccessor& ResMapping, BIND_SHADER_RESOURCES_FLAGS Flags);
 
-    void CheckResources(IResourceMapping*                    pResourceMapping,
+    void CheckResources(const ResourceMappingAccessor&       ResMapping,
                         BIND_SHADER_RESOURCES_FLAGS          Flags,
                         SHADER_RESOURCE_VARIABLE_TYPE_FLAGS& StaleVarTypes) const;
 
@@ -127,8 +127,9 @@ private:
 
     Uint32 GetVariableIndex(const ShaderVariableVkImpl& Variable);
 
-    // These two methods can't be implemented in the header because they depend on PipelineResourceSignatureVkImpl
+    // These methods can't be implemented in the header because they depend on PipelineResourceSignatureVkImpl
     const PipelineResourceDesc& GetResourceDesc(Uint32 Index) const;
+    Uint32                      GetResourceNameId(Uint32 Index) const;
     const ResourceAttribs&      GetResourceAttribs(Uint32 Index) const;
 
 private:
@@ -81,6 +81,8 @@ public:
     const char* GetEntryPoint() const { return m_EntryPoint.c_str(); }
 
 private:
+    void Initialize(const ShaderCreateInfo& ShaderCI, const CreateInfo& VkShaderCI) noexcept(false);
+
     void MapHLSLVertexShaderInputs();
 
     std::shared_ptr<const SPIRVShaderResources> m_pShaderResources;
@@ -33,6 +33,7 @@
 #include "EngineVkImplTraits.hpp"
 #include "TextureViewBase.hpp"
 #include "VulkanUtilities/VulkanObjectWrappers.hpp"
+#include "BindlessHeapVk.hpp"
 
 namespace Diligent
 {
@@ -56,9 +57,15 @@ public:
     /// Implementation of ITextureViewVk::GetVulkanImageView().
     virtual VkImageView DILIGENT_CALL_TYPE GetVulkanImageView() const override final { return m_ImageView; }
 
+    /// Implementation of ITextureViewVk::GetBindlessHeapIndex().
+    virtual Uint32 DILIGENT_CALL_TYPE GetBindlessHeapIndex() const override final { return m_BindlessHeapIndex; }
+
 protected:
     /// Vulkan image view descriptor handle
     VulkanUtilities::ImageViewWrapper m_ImageView;
+
+    /// Index of the view in the bindless heap
+    Uint32 m_BindlessHeapIndex = BindlessHeapVk::InvalidIndex;
 };
 
 } // namespace Diligent
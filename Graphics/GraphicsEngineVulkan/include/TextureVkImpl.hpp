@@ -30,6 +30,8 @@
 /// \file
 /// Declaration of Diligent::TextureVkImpl class
 
+#include <memory>
+
 #include "EngineVkImplTraits.hpp"
 #include "TextureBase.hpp"
 #include "TextureViewVkImpl.hpp"
@@ -38,6 +40,8 @@
 namespace Diligent
 {
 
+class TransientMemoryVk;
+
 /// Texture object implementation in Vulkan backend.
 class TextureVkImpl final : public TextureBase<EngineVkImplTraits>
 {
@@ -60,6 +64,15 @@ public:
                   RESOURCE_STATE             InitialState,
                   VkImage                    VkImageHandle);
 
+    // Creates a transient texture from the image bound to the shared transient memory
+    TextureVkImpl(IReferenceCounters*                pRefCounters,
+                  FixedBlockMemoryAllocator&         TexViewObjAllocator,
+                  RenderDeviceVkImpl*                pDeviceVk,
+                  const TextureDesc&                 TexDesc,
+                  VulkanUtilities::ImageWrapper&&    Image,
+                  std::shared_ptr<TransientMemoryVk> pTransientMemory,
+                  Uint32                             TransientIndex);
+
     ~TextureVkImpl();
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_TextureVk, TTextureBase)
@@ -98,6 +111,15 @@ public:
     // ("Copying Data Between Buffers and Images")
     static constexpr Uint32 StagingBufferOffsetAlignment = 16; // max texel size - 16 bytes (RGBA32F), max texel block size - 16 bytes.
 
+    // Returns true if the texture shares memory with other transient textures
+    bool IsAliased() const { return m_IsAliased; }
+
+    // Returns the memory shared by transient textures, or null if the texture is not transient
+    const TransientMemoryVk* GetTransientMemory() const { return m_pTransientMemory.get(); }
+
+    // Returns the index of the texture's memory range in the transient memory
+    Uint32 GetTransientIndex() const { return m_TransientIndex; }
+
 protected:
     void CreateViewInternal(const struct TextureViewDesc& ViewDesc, ITextureView** ppView, bool bIsDefaultView) override;
     //void PrepareVkInitData(const TextureData &InitData, Uint32 NumSubresources, std::vector<Vk_SUBRESOURCE_DATA> &VkInitData);
@@ -116,6 +138,10 @@ protected:
     VulkanUtilities::BufferWrapper          m_StagingBuffer;
     VulkanUtilities::VulkanMemoryAllocation m_MemoryAllocation;
     VkDeviceSize                            m_StagingDataAlignedOffset;
+
+    std::shared_ptr<TransientMemoryVk> m_pTransientMemory;
+    Uint32                             m_TransientIndex = 0;
+    bool                               m_IsAliased      = false;
 };
 
 VkImageCreateInfo TextureDescToVkImageCreateInfo(const TextureDesc& Desc, const RenderDeviceVkImpl* pDevice) noexcept;
@@ -0,0 +1,126 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::TransientMemoryVk class
+
+#include <vector>
+
+#include "GraphicsTypes.h"
+#include "UniqueIdentifier.hpp"
+#include "VulkanUtilities/VulkanMemoryManager.hpp"
+
+namespace Diligent
+{
+
+class RenderDeviceVkImpl;
+
+/// Device memory shared by transient textures whose lifetimes do not overlap.
+
+/// The memory ranges of the textures are assigned once, when the textures are created (see PlaceResources()).
+/// Which of the aliased textures was used last is tracked by every device context in its recording order
+/// (see Acquire()), so that the context can insert an aliasing barrier and discard the contents when a texture
+/// is used after another texture that shares its memory.
+class TransientMemoryVk
+{
+public:
+    struct ResourceInfo
+    {
+        VkDeviceSize Size      = 0;
+        VkDeviceSize Alignment = 1;
+
+        // The range of passes in which the resource is used
+        Uint32 FirstPass = 0;
+        Uint32 LastPass  = 0;
+    };
+
+    struct Range
+    {
+        VkDeviceSize Offset = 0;
+        VkDeviceSize Size   = 0;
+    };
+
+    // Assigns memory ranges to the resources so that the ranges of the resources
+    // whose lifetimes overlap do not intersect. Returns the required memory size.
+    static VkDeviceSize PlaceResources(const std::vector<ResourceInfo>& Resources, std::vector<Range>& Ranges);
+
+    TransientMemoryVk(RenderDeviceVkImpl&                       DeviceVk,
+                      VulkanUtilities::VulkanMemoryAllocation&& Allocation,
+                      VkDeviceSize                              Alignment,
+                      std::vector<Range>                        Ranges,
+                      BIND_FLAGS                                BindFlags,
+                      Uint64                                    ImmediateContextMask);
+
+    // clang-format off
+    TransientMemoryVk             (const TransientMemoryVk&) = delete;
+    TransientMemoryVk             (TransientMemoryVk&&)      = delete;
+    TransientMemoryVk& operator = (const TransientMemoryVk&) = delete;
+    TransientMemoryVk& operator = (TransientMemoryVk&&)      = delete;
+    // clang-format on
+
+    ~TransientMemoryVk();
+
+    VkDeviceMemory GetVkMemory() const { return m_Allocation.Page->GetVkMemory(); }
+
+    // Returns the memory offset of the resource
+    VkDeviceSize GetOffset(Uint32 Index) const { return m_BaseOffset + m_Ranges[Index].Offset; }
+
+    // Returns true if the memory of the resource is shared with other resources
+    bool IsAliased(Uint32 Index) const { return !m_Aliases[Index].empty(); }
+
+    // Combined bind flags of all resources that share the memory
+    BIND_FLAGS GetBindFlags() const { return m_BindFlags; }
+
+    // Unique identifier used by device contexts to track the owners of the memory ranges
+    UniqueIdentifier GetUniqueID() const { return m_UniqueID.GetID(); }
+
+    // Makes the resource the owner of its memory range in the ownership state IsOwner that is
+    // maintained by a device context. Returns true if the resource was not the owner, i.e. if
+    // another resource that shares the memory may have been used since this resource was last used.
+    // An empty state is initialized so that no resource owns its range.
+    bool Acquire(Uint32 Index, std::vector<bool>& IsOwner) const;
+
+private:
+    RenderDeviceVkImpl& m_DeviceVk;
+
+    VulkanUtilities::VulkanMemoryAllocation m_Allocation;
+
+    VkDeviceSize m_BaseOffset = 0;
+
+    const std::vector<Range> m_Ranges;
+
+    // Indices of the resources whose memory ranges intersect the range of each resource
+    std::vector<std::vector<Uint32>> m_Aliases;
+
+    const BIND_FLAGS m_BindFlags;
+    const Uint64     m_ImmediateContextMask;
+
+    UniqueIdHelper<TransientMemoryVk> m_UniqueID;
+};
+
+} // namespace Diligent
@@ -30,6 +30,9 @@
 #include <mutex>
 #include <array>
 #include <unordered_map>
+#include <map>
+#include <list>
+#include <memory>
 #include <atomic>
 #include <string>
 #include "MemoryAllocator.h"
@@ -44,6 +47,7 @@ namespace VulkanUtilities
 
 class VulkanMemoryPage;
 class VulkanMemoryManager;
+struct VulkanMemoryPagePool;
 
 struct VulkanMemoryAllocation
 {
@@ -92,55 +96,102 @@ struct VulkanMemoryAllocation
     VkDeviceSize      Size            = 0;       // Reserved size of this allocation
 };
 
+// Resource that may be placed in a dedicated memory allocation (VK_KHR_dedicated_allocation).
+// Exactly one of Buffer and Image must not be null.
+struct VulkanDedicatedResource
+{
+    VkBuffer Buffer = VK_NULL_HANDLE;
+    VkImage  Image  = VK_NULL_HANDLE;
+
+    // Set if the driver prefers or requires dedicated allocation for this resource
+    // (see VkMemoryDedicatedRequirements).
+    bool PrefersDedicated = false;
+};
+
 class VulkanMemoryPage
 {
 public:
-    VulkanMemoryPage(VulkanMemoryManager&  ParentMemoryMgr,
-                     VkDeviceSize          PageSize,
-                     uint32_t              MemoryTypeIndex,
-                     bool                  IsHostVisible,
-                     VkMemoryAllocateFlags AllocateFlags) noexcept;
+    // If pDedicatedInfo is not null, the page is a dedicated allocation of the resource
+    // that holds exactly one suballocation and is destroyed as soon as it is released.
+    VulkanMemoryPage(VulkanMemoryManager&                 ParentMemoryMgr,
+                     VulkanMemoryPagePool&                ParentPool,
+                     Diligent::Uint32                     SizeClass,
+                     VkDeviceSize                         PageSize,
+                     uint32_t                             MemoryTypeIndex,
+                     bool                                 IsHostVisible,
+                     VkMemoryAllocateFlags                AllocateFlags,
+                     const VkMemoryDedicatedAllocateInfo* pDedicatedInfo = nullptr) noexcept;
     ~VulkanMemoryPage();
 
     // clang-format off
-    VulkanMemoryPage(VulkanMemoryPage&& rhs)noexcept :
-        m_ParentMemoryMgr {rhs.m_ParentMemoryMgr         },
-        m_AllocationMgr   {std::move(rhs.m_AllocationMgr)},
-        m_VkMemory        {std::move(rhs.m_VkMemory)     },
-        m_CPUMemory       {rhs.m_CPUMemory               }
-    {
-        rhs.m_CPUMemory = nullptr;
-    }
-
-    VulkanMemoryPage            (const VulkanMemoryPage&) = delete;
-    VulkanMemoryPage& operator= (VulkanMemoryPage&)       = delete;
-    VulkanMemoryPage& operator= (VulkanMemoryPage&& rhs)  = delete;
+    VulkanMemoryPage            (const VulkanMemoryPage&)  = delete;
+    VulkanMemoryPage            (VulkanMemoryPage&&)       = delete;
+    VulkanMemoryPage& operator= (const VulkanMemoryPage&)  = delete;
+    VulkanMemoryPage& operator= (VulkanMemoryPage&& rhs)   = delete;
 
     bool IsEmpty() const { return m_AllocationMgr.IsEmpty(); }
     bool IsFull()  const { return m_AllocationMgr.IsFull();  }
     VkDeviceSize GetPageSize() const { return m_AllocationMgr.GetMaxSize();  }
     VkDeviceSize GetUsedSize() const { return m_AllocationMgr.GetUsedSize(); }
+    VkDeviceSize GetMaxFreeBlockSize() const { return m_AllocationMgr.GetMaxFreeBlockSize(); }
+    Diligent::Uint32 GetSizeClass() const { return m_SizeClass; }
+    uint32_t GetMemoryTypeIndex() const { return m_MemoryTypeIndex; }
+    bool IsDedicated() const { return m_IsDedicated; }
 
     // clang-format on
 
-    VulkanMemoryAllocation Allocate(VkDeviceSize size, VkDeviceSize alignment);
-
     VkDeviceMemory GetVkMemory() const { return m_VkMemory; }
     void*          GetCPUMemory() const { return m_CPUMemory; }
 
 private:
     using AllocationsMgrOffsetType = Diligent::VariableSizeAllocationsManager::OffsetType;
+    using PagesByMaxFreeBlockMap   = std::multimap<VkDeviceSize, VulkanMemoryPage*>;
 
     friend struct VulkanMemoryAllocation;
+    friend class VulkanMemoryManager;
+
+    // Must be called while the parent pool mutex is locked
+    VulkanMemoryAllocation Allocate(VkDeviceSize size, VkDeviceSize alignment);
 
     // Memory is reclaimed immediately. The application is responsible to ensure it is not in use by the GPU
     void Free(VulkanMemoryAllocation&& Allocation);
 
+    // Updates the position of the page in the parent pool's free block index.
+    // Must be called while the parent pool mutex is locked.
+    void UpdateFreeBlockIndex();
+
     VulkanMemoryManager&                     m_ParentMemoryMgr;
-    std::mutex                               m_Mutex;
+    VulkanMemoryPagePool&                    m_ParentPool;
+    const Diligent::Uint32                   m_SizeClass;
+    const uint32_t                           m_MemoryTypeIndex;
+    const bool                               m_IsDedicated;
     Diligent::VariableSizeAllocationsManager m_AllocationMgr;
     VulkanUtilities::DeviceMemoryWrapper     m_VkMemory;
     void*                                    m_CPUMemory = nullptr;
+
+    PagesByMaxFreeBlockMap::iterator m_FreeBlockIndexIt;
+};
+
+// Memory pages of one memory type (see VulkanMemoryManager::MemoryPageIndex).
+// Every pool has its own mutex, so that allocations from different memory types
+// do not serialize with each other. The mutex protects all pages in the pool.
+struct VulkanMemoryPagePool
+{
+    // Allocations are segregated into size classes that never share pages, so that small
+    // short-living allocations do not fragment pages that hold large resources.
+    static constexpr Diligent::Uint32 SizeClassCount = 2;
+
+    std::mutex Mtx;
+
+    // Pages of every size class ordered by the size of their largest free block.
+    // The first page whose largest free block fits the allocation is the best fit.
+    // Pages remove themselves from the index when destroyed, so it must outlive the page list.
+    std::array<std::multimap<VkDeviceSize, VulkanMemoryPage*>, SizeClassCount> PagesByMaxFreeBlock;
+
+    std::list<VulkanMemoryPage> Pages;
+
+    // Dedicated allocations are not suballocated and do not participate in the index
+    std::unordered_map<const VulkanMemoryPage*, std::unique_ptr<VulkanMemoryPage>> DedicatedPages;
 };
 
 class VulkanMemoryManager
@@ -154,7 +205,8 @@ public:
                         VkDeviceSize                 DeviceLocalPageSize,
                         VkDeviceSize                 HostVisiblePageSize,
                         VkDeviceSize                 DeviceLocalReserveSize,
-                        VkDeviceSize                 HostVisibleReserveSize) :
+                        VkDeviceSize                 HostVisibleReserveSize,
+                        VkDeviceSize                 DedicatedAllocationThreshold = 0) :
         m_MgrName               {std::move(MgrName)    },
         m_LogicalDevice         {LogicalDevice         },
         m_PhysicalDevice        {PhysicalDevice        },
@@ -162,7 +214,8 @@ public:
         m_DeviceLocalPageSize   {DeviceLocalPageSize   },
         m_HostVisiblePageSize   {HostVisiblePageSize   },
         m_DeviceLocalReserveSize{DeviceLocalReserveSize},
-        m_HostVisibleReserveSize{HostVisibleReserveSize}
+        m_HostVisibleReserveSize{HostVisibleReserveSize},
+        m_DedicatedAllocationThreshold{DedicatedAllocationThreshold}
     {}
 
 
@@ -174,17 +227,19 @@ public:
         m_LogicalDevice   {rhs.m_LogicalDevice     },
         m_PhysicalDevice  {rhs.m_PhysicalDevice    },
         m_Allocator       {rhs.m_Allocator         },
-        m_Pages           {std::move(rhs.m_Pages)  },
+        m_PagePools       {std::move(rhs.m_PagePools)},
 
         m_DeviceLocalPageSize    {rhs.m_DeviceLocalPageSize   },
         m_HostVisiblePageSize    {rhs.m_HostVisiblePageSize   },
         m_DeviceLocalReserveSize {rhs.m_DeviceLocalReserveSize},
         m_HostVisibleReserveSize {rhs.m_HostVisibleReserveSize},
+        m_DedicatedAllocationThreshold{rhs.m_DedicatedAllocationThreshold},
 
         //m_CurrUsedSize      {rhs.m_CurrUsedSize},
         m_PeakUsedSize      {rhs.m_PeakUsedSize     },
         m_CurrAllocatedSize {rhs.m_CurrAllocatedSize},
-        m_PeakAllocatedSize {rhs.m_PeakAllocatedSize}
+        m_PeakAllocatedSize {rhs.m_PeakAllocatedSize},
+        m_HeapStats         {rhs.m_HeapStats        }
     {
         // clang-format on
         for (size_t i = 0; i < m_CurrUsedSize.size(); ++i)
@@ -199,10 +254,22 @@ public:
     VulkanMemoryManager& operator= (VulkanMemoryManager&&)      = delete;
     // clang-format on
 
-    VulkanMemoryAllocation Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags);
-    VulkanMemoryAllocation Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags);
+    // If pDedicatedRes is not null, the resource is placed in a dedicated allocation when
+    // the driver prefers it or when the size is not less than the dedicated allocation threshold.
+    VulkanMemoryAllocation Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags, const VulkanDedicatedResource* pDedicatedRes = nullptr);
+    VulkanMemoryAllocation Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags, const VulkanDedicatedResource* pDedicatedRes = nullptr);
     void                   ShrinkMemory();
 
+    struct HeapStatistics
+    {
+        // Total size of device memory objects allocated by the manager from the heap
+        VkDeviceSize AllocatedSize = 0;
+        // Total size and the number of dedicated allocations in the heap
+        VkDeviceSize     DedicatedSize  = 0;
+        Diligent::Uint32 DedicatedCount = 0;
+    };
+    HeapStatistics GetHeapStatistics(uint32_t HeapIndex);
+
 protected:
     friend class VulkanMemoryPage;
 
@@ -216,7 +283,6 @@ protected:
 
     Diligent::IMemoryAllocator& m_Allocator;
 
-    std::mutex m_PagesMtx;
     struct MemoryPageIndex
     {
         const uint32_t              MemoryTypeIndex;
@@ -248,12 +314,42 @@ protected:
             }
         };
     };
-    std::unordered_multimap<MemoryPageIndex, VulkanMemoryPage, MemoryPageIndex::Hasher> m_Pages;
+
+    VulkanMemoryPagePool& GetPagePool(const MemoryPageIndex& PageIdx);
+
+    bool UseDedicatedAllocation(VkDeviceSize Size, const VulkanDedicatedResource& DedicatedRes) const;
+
+    VulkanMemoryAllocation AllocateDedicated(VkDeviceSize Size, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags, const VulkanDedicatedResource& DedicatedRes);
+
+    // Destroys the dedicated page after its allocation has been released.
+    // Must be called while the parent pool mutex is locked.
+    void DestroyDedicatedPage(VulkanMemoryPage& Page);
+
+    // Updates allocated size statistics when a page is created (positive Delta) or destroyed.
+    // Must be called while m_PagesMtx is locked.
+    void UpdateAllocatedSize(uint32_t MemoryTypeIndex, bool IsHostVisible, int64_t Delta, bool IsDedicated = false);
+
+    // Allocations that are not larger than the page size divided by this value
+    // belong to the small size class.
+    static constexpr VkDeviceSize SmallAllocationPageFraction = 64;
+
+    Diligent::Uint32 GetSizeClass(VkDeviceSize Size, bool HostVisible) const
+    {
+        const auto PageSize = HostVisible ? m_HostVisiblePageSize : m_DeviceLocalPageSize;
+        return Size <= PageSize / SmallAllocationPageFraction ? 0 : 1;
+    }
+
+    // Protects m_PagePools map (but not the pools themselves) and allocated size statistics.
+    // When both are required, pool mutex must be locked first.
+    std::mutex m_PagesMtx;
+
+    std::unordered_map<MemoryPageIndex, std::unique_ptr<VulkanMemoryPagePool>, MemoryPageIndex::Hasher> m_PagePools;
 
     const VkDeviceSize m_DeviceLocalPageSize;
     const VkDeviceSize m_HostVisiblePageSize;
     const VkDeviceSize m_DeviceLocalReserveSize;
     const VkDeviceSize m_HostVisibleReserveSize;
+    const VkDeviceSize m_DedicatedAllocationThreshold;
 
     void OnFreeAllocation(VkDeviceSize Size, bool IsHostVisible);
 
@@ -263,6 +359,8 @@ protected:
     std::array<VkDeviceSize, 2>         m_CurrAllocatedSize = {};
     std::array<VkDeviceSize, 2>         m_PeakAllocatedSize = {};
 
+    std::array<HeapStatistics, VK_MAX_MEMORY_HEAPS> m_HeapStats = {};
+
     // If adding new member, do not forget to update move ctor
 };
 
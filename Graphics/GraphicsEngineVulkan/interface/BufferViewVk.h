@@ -52,6 +52,16 @@ DILIGENT_BEGIN_INTERFACE(IBufferViewVk, IBufferView)
 {
     /// Returns a Vulkan handle of the internal buffer view object.
     VIRTUAL VkBufferView METHOD(GetVkBufferView)(THIS) CONST PURE;
+
+    /// Returns the index of the buffer view in the bindless descriptor heap.
+
+    /// \remarks   Shader resource and unordered access views are assigned a stable index
+    ///            when they are created, if the bindless heap is enabled
+    ///            (see EngineVkCreateInfo::BindlessHeapSize). The index is valid in the
+    ///            run-time array of the matching type declared with
+    ///            PIPELINE_RESOURCE_FLAG_BINDLESS_HEAP flag.
+    ///            If the view is not in the heap, the method returns ~0u.
+    VIRTUAL Uint32 METHOD(GetBindlessHeapIndex)(THIS) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -61,7 +71,8 @@ DILIGENT_END_INTERFACE
 
 // clang-format off
 
-#    define IBufferViewVk_GetVkBufferView(This) CALL_IFACE_METHOD(BufferViewVk, GetVkBufferView, This)
+#    define IBufferViewVk_GetVkBufferView(This)      CALL_IFACE_METHOD(BufferViewVk, GetVkBufferView, This)
+#    define IBufferViewVk_GetBindlessHeapIndex(This) CALL_IFACE_METHOD(BufferViewVk, GetBindlessHeapIndex, This)
 
 // clang-format on
 
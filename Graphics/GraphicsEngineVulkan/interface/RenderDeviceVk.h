@@ -47,6 +47,122 @@ static const INTERFACE_ID IID_RenderDeviceVk =
 
 // clang-format off
 
+/// Describes the size, budget and current usage of a Vulkan memory heap.
+struct MemoryHeapBudgetVk
+{
+    /// Total heap size, in bytes.
+    VkDeviceSize      Size                     DEFAULT_INITIALIZER(0);
+
+    /// Estimated amount of memory, in bytes, that the process can allocate from the heap
+    /// before allocations may fail or cause performance degradation.
+    /// If VK_EXT_memory_budget is not supported, this is the heap size.
+    VkDeviceSize      Budget                   DEFAULT_INITIALIZER(0);
+
+    /// Estimated amount of memory, in bytes, currently used by the process in the heap.
+    /// If VK_EXT_memory_budget is not supported, this is the amount of memory
+    /// allocated by the engine's memory manager.
+    VkDeviceSize      Usage                    DEFAULT_INITIALIZER(0);
+
+    /// Heap flags, see VkMemoryHeapFlagBits.
+    VkMemoryHeapFlags Flags                    DEFAULT_INITIALIZER(0);
+
+    /// The amount of memory, in bytes, allocated from the heap by the engine's memory manager,
+    /// including memory pages and dedicated allocations.
+    VkDeviceSize      AllocatedSize            DEFAULT_INITIALIZER(0);
+
+    /// The amount of memory, in bytes, allocated from the heap in dedicated allocations.
+    VkDeviceSize      DedicatedAllocationSize  DEFAULT_INITIALIZER(0);
+
+    /// The number of dedicated allocations in the heap.
+    Uint32            DedicatedAllocationCount DEFAULT_INITIALIZER(0);
+};
+typedef struct MemoryHeapBudgetVk MemoryHeapBudgetVk;
+
+/// This structure is returned by IRenderDeviceVk::GetMemoryBudget()
+struct MemoryBudgetVk
+{
+    /// The number of valid elements in the Heaps array.
+    Uint32             HeapCount                   DEFAULT_INITIALIZER(0);
+
+    /// Indicates whether Budget and Usage values were reported
+    /// by the driver through VK_EXT_memory_budget extension.
+    Bool               IsDriverReported            DEFAULT_INITIALIZER(False);
+
+    /// Indicates whether the engine uses dedicated allocations (VK_KHR_dedicated_allocation
+    /// extension is enabled), see Diligent::EngineVkCreateInfo::DedicatedAllocationThreshold.
+    Bool               DedicatedAllocationsEnabled DEFAULT_INITIALIZER(False);
+
+    /// Per-heap budget information.
+    MemoryHeapBudgetVk Heaps[VK_MAX_MEMORY_HEAPS];
+};
+typedef struct MemoryBudgetVk MemoryBudgetVk;
+
+/// Describes a transient texture created by IRenderDeviceVk::CreateTransientTextures()
+struct TransientTextureDescVk
+{
+    /// Texture description. Usage must be Diligent::USAGE_DEFAULT.
+    TextureDesc Desc;
+
+    /// The index of the first pass in which the texture is used.
+    Uint32      FirstPass DEFAULT_INITIALIZER(0);
+
+    /// The index of the last pass in which the texture is used.
+    Uint32      LastPass  DEFAULT_INITIALIZER(0);
+};
+typedef struct TransientTextureDescVk TransientTextureDescVk;
+
+/// Memory statistics returned by IRenderDeviceVk::CreateTransientTextures()
+struct TransientMemoryStatsVk
+{
+    /// The total memory size, in bytes, that the textures would require without aliasing.
+    Uint64 RequiredSize   DEFAULT_INITIALIZER(0);
+
+    /// The size of the memory, in bytes, that was allocated for the textures.
+    Uint64 AllocatedSize  DEFAULT_INITIALIZER(0);
+
+    /// The number of memory allocations.
+    Uint32 NumAllocations DEFAULT_INITIALIZER(0);
+};
+typedef struct TransientMemoryStatsVk TransientMemoryStatsVk;
+
+/// Pipeline library statistics returned by IRenderDeviceVk::GetPipelineLibraryStats()
+struct PipelineLibraryStatsVk
+{
+    /// Indicates whether graphics pipelines are linked from shared pipeline libraries
+    /// (VK_EXT_graphics_pipeline_library extension is enabled).
+    Bool   Enabled      DEFAULT_INITIALIZER(False);
+
+    /// The number of pipeline libraries that are currently used by pipeline states.
+    Uint32 NumLibraries DEFAULT_INITIALIZER(0);
+
+    /// The total number of pipeline libraries that have been created.
+    Uint32 NumCreated   DEFAULT_INITIALIZER(0);
+
+    /// The total number of times an existing pipeline library has been reused by a new pipeline state.
+    Uint32 NumReused    DEFAULT_INITIALIZER(0);
+};
+typedef struct PipelineLibraryStatsVk PipelineLibraryStatsVk;
+
+/// Statistics of the allocator of static and mutable descriptor sets returned by
+/// IRenderDeviceVk::GetDescriptorSetAllocatorStats()
+struct DescriptorSetAllocatorStatsVk
+{
+    /// The number of descriptor pools that have been created by the allocator.
+    Uint32 NumPools             DEFAULT_INITIALIZER(0);
+
+    /// The number of descriptor sets that are currently allocated, including the sets
+    /// that have been released, but are waiting in the release queue.
+    Uint32 NumAllocatedSets     DEFAULT_INITIALIZER(0);
+
+    /// The number of pools that are skipped because the driver failed to allocate a set from them
+    /// even though they have enough space. A pool is used again once one of its sets is freed.
+    Uint32 NumFragmentedPools   DEFAULT_INITIALIZER(0);
+
+    /// The total number of descriptor set allocations that have failed in the driver.
+    Uint32 NumFailedAllocations DEFAULT_INITIALIZER(0);
+};
+typedef struct DescriptorSetAllocatorStatsVk DescriptorSetAllocatorStatsVk;
+
 /// Exposes Vulkan-specific functionality of a render device.
 DILIGENT_BEGIN_INTERFACE(IRenderDeviceVk, IRenderDevice)
 {
@@ -157,6 +273,63 @@ DILIGENT_BEGIN_INTERFACE(IRenderDeviceVk, IRenderDevice)
                                                        VkSemaphore         vkTimelineSemaphore,
                                                        const FenceDesc REF Desc,
                                                        IFence**            ppFence) PURE;
+
+    /// Returns the current memory budget and usage of every Vulkan memory heap
+
+    /// \param [out] Budget - Memory budget information, see Diligent::MemoryBudgetVk.
+    ///
+    /// \remarks   When VK_EXT_memory_budget extension is supported, the values are queried from the driver
+    ///            and account for all allocations made by the process. Otherwise, the budget is the heap size
+    ///            and the usage is the amount of memory allocated by the engine.
+    VIRTUAL void METHOD(GetMemoryBudget)(THIS_
+                                         MemoryBudgetVk REF Budget) PURE;
+
+    /// Creates a group of transient textures that share memory
+
+    /// \param [in]  pTexDescs   - Array of NumTextures transient texture descriptions.
+    /// \param [in]  NumTextures - The number of textures to create.
+    /// \param [out] ppTextures  - Array of NumTextures pointers where the texture interfaces will be stored.
+    ///                            The function calls AddRef() for every created texture.
+    /// \param [out] pStats      - Optional pointer to the structure that receives the memory statistics.
+    ///
+    /// \remarks   Passes are application-defined indices, e.g. the indices of the frame graph nodes.
+    ///            Textures whose pass ranges [FirstPass, LastPass] do not overlap may be placed in the same memory,
+    ///            and their contents are not preserved from one pass range to another.
+    ///            Memoryless textures (Diligent::MISC_TEXTURE_FLAG_MEMORYLESS) are placed in the lazily allocated memory.
+    ///
+    ///            When a texture is bound (as a render target, render pass attachment or shader resource),
+    ///            transitioned or used by a copy command after another texture that shares its memory has been used,
+    ///            the device context inserts an aliasing barrier and discards the texture contents.
+    ///            This is done in every state transition mode, and a texture whose state is not tracked is expected
+    ///            to be in the state required by the command. Ownership of the memory is tracked by every context
+    ///            in its recording order and is reset at the beginning of every frame and command list, so
+    ///            the texture contents are not preserved across frames. Textures that share memory must not be used
+    ///            in the same pass or in different immediate contexts.
+    ///
+    ///            If the function fails, all elements of ppTextures are set to null.
+    VIRTUAL void METHOD(CreateTransientTextures)(THIS_
+                                                 const TransientTextureDescVk* pTexDescs,
+                                                 Uint32                        NumTextures,
+                                                 ITexture**                    ppTextures,
+                                                 TransientMemoryStatsVk*       pStats DEFAULT_VALUE(nullptr)) PURE;
+
+    /// Returns the statistics of the graphics pipeline library cache
+
+    /// \param [out] Stats - Pipeline library statistics, see Diligent::PipelineLibraryStatsVk.
+    ///
+    /// \remarks   Pipeline states whose vertex input, shaders, fragment output or render target
+    ///            state match share the corresponding pipeline libraries.
+    VIRTUAL void METHOD(GetPipelineLibraryStats)(THIS_
+                                                 PipelineLibraryStatsVk REF Stats) PURE;
+
+    /// Returns the statistics of the descriptor set allocator
+
+    /// \param [out] Stats - Descriptor set allocator statistics, see Diligent::DescriptorSetAllocatorStatsVk.
+    ///
+    /// \remarks   The allocator manages the static and mutable descriptor sets of shader resource bindings.
+    ///            Dynamic descriptor sets are allocated by device contexts and are not included.
+    VIRTUAL void METHOD(GetDescriptorSetAllocatorStats)(THIS_
+                                                        DescriptorSetAllocatorStatsVk REF Stats) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -174,6 +347,10 @@ DILIGENT_END_INTERFACE
 #    define IRenderDeviceVk_CreateBLASFromVulkanResource(This, ...)   CALL_IFACE_METHOD(RenderDeviceVk, CreateBLASFromVulkanResource,   This, __VA_ARGS__)
 #    define IRenderDeviceVk_CreateTLASFromVulkanResource(This, ...)   CALL_IFACE_METHOD(RenderDeviceVk, CreateTLASFromVulkanResource,   This, __VA_ARGS__)
 #    define IRenderDeviceVk_CreateFenceFromVulkanResource(This, ...)  CALL_IFACE_METHOD(RenderDeviceVk, CreateFenceFromVulkanResource,  This, __VA_ARGS__)
+#    define IRenderDeviceVk_GetMemoryBudget(This, ...)                CALL_IFACE_METHOD(RenderDeviceVk, GetMemoryBudget,                This, __VA_ARGS__)
+#    define IRenderDeviceVk_CreateTransientTextures(This, ...)        CALL_IFACE_METHOD(RenderDeviceVk, CreateTransientTextures,        This, __VA_ARGS__)
+#    define IRenderDeviceVk_GetPipelineLibraryStats(This, ...)        CALL_IFACE_METHOD(RenderDeviceVk, GetPipelineLibraryStats,        This, __VA_ARGS__)
+#    define IRenderDeviceVk_GetDescriptorSetAllocatorStats(This, ...) CALL_IFACE_METHOD(RenderDeviceVk, GetDescriptorSetAllocatorStats, This, __VA_ARGS__)
 
 // clang-format on
 
@@ -52,6 +52,16 @@ DILIGENT_BEGIN_INTERFACE(ITextureViewVk, ITextureView)
 {
     /// Returns Vulkan image view handle
     VIRTUAL VkImageView METHOD(GetVulkanImageView)(THIS) CONST PURE;
+
+    /// Returns the index of the texture view in the bindless descriptor heap.
+
+    /// \remarks   Shader resource and unordered access views are assigned a stable index
+    ///            when they are created, if the bindless heap is enabled
+    ///            (see EngineVkCreateInfo::BindlessHeapSize). The index is valid in the
+    ///            run-time array of the matching type declared with
+    ///            PIPELINE_RESOURCE_FLAG_BINDLESS_HEAP flag.
+    ///            If the view is not in the heap, the method returns ~0u.
+    VIRTUAL Uint32 METHOD(GetBindlessHeapIndex)(THIS) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -61,7 +71,8 @@ DILIGENT_END_INTERFACE
 
 // clang-format off
 
-#    define ITextureViewVk_GetVulkanImageView(This) CALL_IFACE_METHOD(TextureViewVk, GetVulkanImageView, This)
+#    define ITextureViewVk_GetVulkanImageView(This)   CALL_IFACE_METHOD(TextureViewVk, GetVulkanImageView, This)
+#    define ITextureViewVk_GetBindlessHeapIndex(This) CALL_IFACE_METHOD(TextureViewVk, GetBindlessHeapIndex, This)
 
 // clang-format on
 
@@ -0,0 +1,340 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "BindlessHeapVk.hpp"
+
+#include <algorithm>
+
+#include "RenderDeviceVkImpl.hpp"
+
+namespace Diligent
+{
+
+bool BindlessHeapVk::IsSupported(const RenderDeviceVkImpl& DeviceVk)
+{
+    const auto& DescrIndexing = DeviceVk.GetLogicalDevice().GetEnabledExtFeatures().DescriptorIndexing;
+    // clang-format off
+    return DescrIndexing.runtimeDescriptorArray                             != VK_FALSE &&
+           DescrIndexing.descriptorBindingPartiallyBound                    != VK_FALSE &&
+           DescrIndexing.descriptorBindingSampledImageUpdateAfterBind       != VK_FALSE &&
+           DescrIndexing.descriptorBindingStorageImageUpdateAfterBind       != VK_FALSE &&
+           DescrIndexing.descriptorBindingStorageBufferUpdateAfterBind      != VK_FALSE &&
+           DescrIndexing.descriptorBindingUniformTexelBufferUpdateAfterBind != VK_FALSE &&
+           DescrIndexing.descriptorBindingStorageTexelBufferUpdateAfterBind != VK_FALSE;
+    // clang-format on
+}
+
+BindlessHeapVk::BINDING BindlessHeapVk::GetBinding(const PipelineResourceDesc& ResDesc)
+{
+    VERIFY_EXPR((ResDesc.Flags & PIPELINE_RESOURCE_FLAG_BINDLESS_HEAP) != 0);
+
+    const bool IsFormatted = (ResDesc.Flags & PIPELINE_RESOURCE_FLAG_FORMATTED_BUFFER) != 0;
+    switch (ResDesc.ResourceType)
+    {
+        case SHADER_RESOURCE_TYPE_TEXTURE_SRV:
+            return BINDING_TEXTURE_SRV;
+
+        case SHADER_RESOURCE_TYPE_TEXTURE_UAV:
+            return BINDING_TEXTURE_UAV;
+
+        case SHADER_RESOURCE_TYPE_BUFFER_SRV:
+            return IsFormatted ? BINDING_FORMATTED_BUFFER_SRV : BINDING_STRUCTURED_BUFFER;
+
+        case SHADER_RESOURCE_TYPE_BUFFER_UAV:
+            return IsFormatted ? BINDING_FORMATTED_BUFFER_UAV : BINDING_STRUCTURED_BUFFER;
+
+        default:
+            UNEXPECTED("Resource type ", GetShaderResourceTypeLiteralName(ResDesc.ResourceType), " can't be placed into the bindless heap");
+            return BINDING_COUNT;
+    }
+}
+
+VkDescriptorType BindlessHeapVk::GetVkDescriptorType(BINDING Binding)
+{
+    static_assert(BINDING_COUNT == 5, "Please update the switch below to handle the new binding");
+    switch (Binding)
+    {
+        // clang-format off
+        case BINDING_TEXTURE_SRV:          return VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+        case BINDING_TEXTURE_UAV:          return VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+        case BINDING_FORMATTED_BUFFER_SRV: return VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;
+        case BINDING_FORMATTED_BUFFER_UAV: return VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER;
+        case BINDING_STRUCTURED_BUFFER:    return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        // clang-format on
+        default:
+            UNEXPECTED("Unexpected binding");
+            return VK_DESCRIPTOR_TYPE_MAX_ENUM;
+    }
+}
+
+BindlessHeapVk::BindlessHeapVk(RenderDeviceVkImpl& DeviceVk, Uint32 Size) noexcept(false) :
+    m_DeviceVkImpl{DeviceVk}
+{
+    VERIFY_EXPR(Size > 0);
+    VERIFY_EXPR(IsSupported(DeviceVk));
+
+    const auto& LogicalDevice = DeviceVk.GetLogicalDevice();
+    const auto& DescrIndProps = DeviceVk.GetPhysicalDevice().GetExtProperties().DescriptorIndexing;
+
+    // All bindings are visible to every shader stage, so the per-stage limits apply to each binding.
+    // Uniform texel buffers count against the sampled image limits, and storage texel buffers count
+    // against the storage image limits.
+    // When a pipeline layout contains an update-after-bind set, the update-after-bind limits apply to
+    // all descriptors in the layout, including the ones in the signature sets. The heap thus only takes
+    // a share of every limit and leaves the rest to the signature sets (see PipelineLayoutVk::Create()).
+    const Uint32 MaxSampledImages  = std::min(DescrIndProps.maxDescriptorSetUpdateAfterBindSampledImages, DescrIndProps.maxPerStageDescriptorUpdateAfterBindSampledImages) / HeapLimitDivisor;
+    const Uint32 MaxStorageImages  = std::min(DescrIndProps.maxDescriptorSetUpdateAfterBindStorageImages, DescrIndProps.maxPerStageDescriptorUpdateAfterBindStorageImages) / HeapLimitDivisor;
+    const Uint32 MaxStorageBuffers = std::min(DescrIndProps.maxDescriptorSetUpdateAfterBindStorageBuffers, DescrIndProps.maxPerStageDescriptorUpdateAfterBindStorageBuffers) / HeapLimitDivisor;
+    // The total number of resources accessible to a stage is limited too.
+    const Uint32 MaxPerBindingResources = DescrIndProps.maxPerStageUpdateAfterBindResources / HeapLimitDivisor / BINDING_COUNT;
+    const Uint32 MaxPerTypeCapacity     = std::min(DescrIndProps.maxUpdateAfterBindDescriptorsInAllPools / BINDING_COUNT, MaxPerBindingResources);
+
+    m_Bindings[BINDING_TEXTURE_SRV].Capacity          = std::min({Size, MaxSampledImages / 2, MaxPerTypeCapacity});
+    m_Bindings[BINDING_TEXTURE_UAV].Capacity          = std::min({Size, MaxStorageImages / 2, MaxPerTypeCapacity});
+    m_Bindings[BINDING_FORMATTED_BUFFER_SRV].Capacity = std::min({Size, MaxSampledImages / 2, MaxPerTypeCapacity});
+    m_Bindings[BINDING_FORMATTED_BUFFER_UAV].Capacity = std::min({Size, MaxStorageImages / 2, MaxPerTypeCapacity});
+    m_Bindings[BINDING_STRUCTURED_BUFFER].Capacity    = std::min({Size, MaxStorageBuffers, MaxPerTypeCapacity});
+
+    std::array<VkDescriptorSetLayoutBinding, BINDING_COUNT> LayoutBindings{};
+    std::array<VkDescriptorBindingFlagsEXT, BINDING_COUNT>  BindingFlags{};
+    std::array<VkDescriptorPoolSize, BINDING_COUNT>         PoolSizes{};
+    for (Uint32 b = 0; b < BINDING_COUNT; ++b)
+    {
+        const auto Capacity = m_Bindings[b].Capacity;
+        if (Capacity < Size)
+        {
+            LOG_WARNING_MESSAGE("Bindless heap binding ", b, " size (", Size, ") exceeds the device limits and is clamped to ", Capacity);
+        }
+
+        auto& Binding              = LayoutBindings[b];
+        Binding.binding            = b;
+        Binding.descriptorType     = GetVkDescriptorType(static_cast<BINDING>(b));
+        Binding.descriptorCount    = Capacity;
+        Binding.stageFlags         = VK_SHADER_STAGE_ALL;
+        Binding.pImmutableSamplers = nullptr;
+
+        // Partially bound descriptors don't need to be valid unless they are dynamically used,
+        // and update-after-bind allows writing descriptors that are not used by pending command buffers.
+        BindingFlags[b] = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT;
+
+        PoolSizes[b].type            = Binding.descriptorType;
+        PoolSizes[b].descriptorCount = Capacity;
+    }
+
+    VkDescriptorSetLayoutBindingFlagsCreateInfoEXT BindingFlagsCI{};
+    BindingFlagsCI.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT;
+    BindingFlagsCI.pNext         = nullptr;
+    BindingFlagsCI.bindingCount  = BINDING_COUNT;
+    BindingFlagsCI.pBindingFlags = BindingFlags.data();
+
+    VkDescriptorSetLayoutCreateInfo SetLayoutCI{};
+    SetLayoutCI.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    SetLayoutCI.pNext        = &BindingFlagsCI;
+    SetLayoutCI.flags        = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT;
+    SetLayoutCI.bindingCount = BINDING_COUNT;
+    SetLayoutCI.pBindings    = LayoutBindings.data();
+    m_SetLayout              = LogicalDevice.CreateDescriptorSetLayout(SetLayoutCI, "Bindless heap layout");
+
+    VkDescriptorPoolCreateInfo PoolCI{};
+    PoolCI.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    PoolCI.pNext         = nullptr;
+    PoolCI.flags         = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT;
+    PoolCI.maxSets       = 1;
+    PoolCI.poolSizeCount = BINDING_COUNT;
+    PoolCI.pPoolSizes    = PoolSizes.data();
+    m_Pool               = LogicalDevice.CreateDescriptorPool(PoolCI, "Bindless heap pool");
+
+    VkDescriptorSetLayout vkSetLayout = m_SetLayout;
+
+    VkDescriptorSetAllocateInfo AllocInfo{};
+    AllocInfo.sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    AllocInfo.pNext              = nullptr;
+    AllocInfo.descriptorPool     = m_Pool;
+    AllocInfo.descriptorSetCount = 1;
+    AllocInfo.pSetLayouts        = &vkSetLayout;
+    m_vkSet                      = LogicalDevice.AllocateVkDescriptorSet(AllocInfo, "Bindless heap");
+    if (m_vkSet == VK_NULL_HANDLE)
+        LOG_ERROR_AND_THROW("Failed to allocate bindless heap descriptor set");
+}
+
+BindlessHeapVk::~BindlessHeapVk()
+{
+    // The set is released together with the pool.
+    for (Uint32 b = 0; b < BINDING_COUNT; ++b)
+    {
+        const auto& Binding = m_Bindings[b];
+        DEV_CHECK_ERR(Binding.FreeIndices.size() == Binding.NextIndex,
+                      "Not all bindless heap indices have been released. This indicates that some views have not been destroyed.");
+        if (Binding.NextIndex > 0)
+            LOG_INFO_MESSAGE("Bindless heap binding ", b, ": peak usage ", Binding.NextIndex, " out of ", Binding.Capacity, " descriptors");
+    }
+}
+
+Uint32 BindlessHeapVk::AllocateIndex(BINDING Binding)
+{
+    auto& Info = m_Bindings[Binding];
+    if (!Info.FreeIndices.empty())
+    {
+        const auto Index = Info.FreeIndices.back();
+        Info.FreeIndices.pop_back();
+        return Index;
+    }
+
+    if (Info.NextIndex < Info.Capacity)
+        return Info.NextIndex++;
+
+    LOG_ERROR_MESSAGE("Bindless heap binding ", Uint32{Binding}, " is full (", Info.Capacity,
+                      " descriptors). Increase EngineVkCreateInfo::BindlessHeapSize.");
+    return InvalidIndex;
+}
+
+Uint32 BindlessHeapVk::AllocateImageView(BINDING Binding, VkImageView vkView, VkImageLayout Layout)
+{
+    VERIFY_EXPR(Binding == BINDING_TEXTURE_SRV || Binding == BINDING_TEXTURE_UAV);
+
+    VkDescriptorImageInfo ImageInfo{};
+    ImageInfo.sampler     = VK_NULL_HANDLE;
+    ImageInfo.imageView   = vkView;
+    ImageInfo.imageLayout = Layout;
+
+    VkWriteDescriptorSet Write{};
+    Write.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    Write.dstSet          = m_vkSet;
+    Write.dstBinding      = Binding;
+    Write.descriptorCount = 1;
+    Write.descriptorType  = GetVkDescriptorType(Binding);
+    Write.pImageInfo      = &ImageInfo;
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    Write.dstArrayElement = AllocateIndex(Binding);
+    if (Write.dstArrayElement != InvalidIndex)
+        m_DeviceVkImpl.GetLogicalDevice().UpdateDescriptorSets(1, &Write, 0, nullptr);
+
+    return Write.dstArrayElement;
+}
+
+Uint32 BindlessHeapVk::AllocateTexelBufferView(BINDING Binding, VkBufferView vkView)
+{
+    VERIFY_EXPR(Binding == BINDING_FORMATTED_BUFFER_SRV || Binding == BINDING_FORMATTED_BUFFER_UAV);
+
+    VkWriteDescriptorSet Write{};
+    Write.sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    Write.dstSet           = m_vkSet;
+    Write.dstBinding       = Binding;
+    Write.descriptorCount  = 1;
+    Write.descriptorType   = GetVkDescriptorType(Binding);
+    Write.pTexelBufferView = &vkView;
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    Write.dstArrayElement = AllocateIndex(Binding);
+    if (Write.dstArrayElement != InvalidIndex)
+        m_DeviceVkImpl.GetLogicalDevice().UpdateDescriptorSets(1, &Write, 0, nullptr);
+
+    return Write.dstArrayElement;
+}
+
+Uint32 BindlessHeapVk::AllocateStorageBuffer(VkBuffer vkBuffer, VkDeviceSize Offset, VkDeviceSize Range)
+{
+    VkDescriptorBufferInfo BufferInfo{};
+    BufferInfo.buffer = vkBuffer;
+    BufferInfo.offset = Offset;
+    BufferInfo.range  = Range;
+
+    VkWriteDescriptorSet Write{};
+    Write.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    Write.dstSet          = m_vkSet;
+    Write.dstBinding      = BINDING_STRUCTURED_BUFFER;
+    Write.descriptorCount = 1;
+    Write.descriptorType  = GetVkDescriptorType(BINDING_STRUCTURED_BUFFER);
+    Write.pBufferInfo     = &BufferInfo;
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    Write.dstArrayElement = AllocateIndex(BINDING_STRUCTURED_BUFFER);
+    if (Write.dstArrayElement != InvalidIndex)
+        m_DeviceVkImpl.GetLogicalDevice().UpdateDescriptorSets(1, &Write, 0, nullptr);
+
+    return Write.dstArrayElement;
+}
+
+void BindlessHeapVk::ReleaseIndex(BINDING Binding, Uint32 Index)
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    VERIFY_EXPR(Index < m_Bindings[Binding].NextIndex);
+    m_Bindings[Binding].FreeIndices.push_back(Index);
+}
+
+class BindlessHeapVk::IndexReleaser
+{
+public:
+    // clang-format off
+    IndexReleaser(BindlessHeapVk& _Heap,
+                  BINDING         _Binding,
+                  Uint32          _Index) :
+        Heap   {&_Heap   },
+        Binding{_Binding },
+        Index  {_Index   }
+    {}
+
+    IndexReleaser             (const IndexReleaser&) = delete;
+    IndexReleaser& operator = (const IndexReleaser&) = delete;
+    IndexReleaser& operator = (      IndexReleaser&&)= delete;
+
+    IndexReleaser(IndexReleaser&& rhs)noexcept :
+        Heap   {rhs.Heap   },
+        Binding{rhs.Binding},
+        Index  {rhs.Index  }
+    {
+        rhs.Heap  = nullptr;
+        rhs.Index = InvalidIndex;
+    }
+    // clang-format on
+
+    ~IndexReleaser()
+    {
+        if (Heap != nullptr)
+            Heap->ReleaseIndex(Binding, Index);
+    }
+
+private:
+    BindlessHeapVk* Heap;
+    BINDING         Binding;
+    Uint32          Index;
+};
+
+void BindlessHeapVk::Free(BINDING Binding, Uint32 Index, Uint64 QueueMask)
+{
+    VERIFY_EXPR(Binding < BINDING_COUNT && Index != InvalidIndex);
+    // The descriptor may still be accessed by the GPU, so the index can only be reused
+    // once all command buffers submitted so far are complete.
+    m_DeviceVkImpl.SafeReleaseDeviceObject(IndexReleaser{*this, Binding, Index}, QueueMask);
+}
+
+} // namespace Diligent
@@ -51,10 +51,38 @@ BufferViewVkImpl::BufferViewVkImpl(IReferenceCounters*                  pRefCoun
     m_BuffView{std::move(BuffView)}
 // clang-format on
 {
+    auto* pBindlessHeap = pDevice->GetBindlessHeap();
+    // Dynamic buffers have no fixed location, so they can't be placed into the heap
+    if (pBindlessHeap != nullptr && m_pBuffer->GetDesc().Usage != USAGE_DYNAMIC)
+    {
+        const auto Binding = GetBindlessHeapBinding();
+        if (Binding == BindlessHeapVk::BINDING_STRUCTURED_BUFFER)
+        {
+            const auto* pBufferVk = ClassPtrCast<const BufferVkImpl>(m_pBuffer);
+            m_BindlessHeapIndex   = pBindlessHeap->AllocateStorageBuffer(pBufferVk->GetVkBuffer(), m_Desc.ByteOffset, m_Desc.ByteWidth);
+        }
+        else
+        {
+            m_BindlessHeapIndex = pBindlessHeap->AllocateTexelBufferView(Binding, m_BuffView);
+        }
+    }
+}
+
+BindlessHeapVk::BINDING BufferViewVkImpl::GetBindlessHeapBinding() const
+{
+    // Formatted buffer views are the only ones that have Vulkan buffer view
+    if (m_BuffView == VK_NULL_HANDLE)
+        return BindlessHeapVk::BINDING_STRUCTURED_BUFFER;
+
+    return m_Desc.ViewType == BUFFER_VIEW_SHADER_RESOURCE ?
+        BindlessHeapVk::BINDING_FORMATTED_BUFFER_SRV :
+        BindlessHeapVk::BINDING_FORMATTED_BUFFER_UAV;
 }
 
 BufferViewVkImpl::~BufferViewVkImpl()
 {
+    if (m_BindlessHeapIndex != BindlessHeapVk::InvalidIndex)
+        m_pDevice->GetBindlessHeap()->Free(GetBindlessHeapBinding(), m_BindlessHeapIndex, m_pBuffer->GetDesc().ImmediateContextMask);
     m_pDevice->SafeReleaseDeviceObject(std::move(m_BuffView), m_pBuffer->GetDesc().ImmediateContextMask);
 }
 
@@ -238,7 +238,8 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
 
         m_VulkanBuffer = LogicalDevice.CreateBuffer(VkBuffCI, m_Desc.Name);
 
-        VkMemoryRequirements MemReqs = LogicalDevice.GetBufferMemoryRequirements(m_VulkanBuffer);
+        VkMemoryDedicatedRequirements DedicatedReqs = {};
+        VkMemoryRequirements          MemReqs       = LogicalDevice.GetBufferMemoryRequirements(m_VulkanBuffer, &DedicatedReqs);
 
         static constexpr auto InvalidMemoryTypeIndex = VulkanUtilities::VulkanPhysicalDevice::InvalidMemoryTypeIndex;
 
@@ -315,8 +316,15 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
             MemReqs.size      = AlignUp(MemReqs.size, DeviceLimits.nonCoherentAtomSize);
         }
 
+        VulkanUtilities::VulkanDedicatedResource DedicatedRes;
+        DedicatedRes.Buffer           = m_VulkanBuffer;
+        DedicatedRes.PrefersDedicated = DedicatedReqs.prefersDedicatedAllocation != VK_FALSE || DedicatedReqs.requiresDedicatedAllocation != VK_FALSE;
+
+        // The size of the dedicated allocation must be equal to the size of the buffer
+        const bool AllowDedicated = !AlignToNonCoherentAtomSize;
+
         VERIFY(IsPowerOfTwo(RequiredAlignment), "Alignment is not power of 2!");
-        m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs.size, RequiredAlignment, MemoryTypeIndex, AllocateFlags);
+        m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs.size, RequiredAlignment, MemoryTypeIndex, AllocateFlags, AllowDedicated ? &DedicatedRes : nullptr);
 
         m_BufferMemoryAlignedOffset = AlignUp(VkDeviceSize{m_MemoryAllocation.UnalignedOffset}, RequiredAlignment);
         VERIFY(m_MemoryAllocation.Size >= MemReqs.size + (m_BufferMemoryAlignedOffset - m_MemoryAllocation.UnalignedOffset), "Size of memory allocation is too small");
@@ -147,10 +147,49 @@ __forceinline SyncPointVkPtr CommandQueueVkImpl::CreateSyncPoint(Uint64 dbgValue
     return {new (ptr) SyncPointVk{m_CommandQueueId, m_NumCommandQueues, *m_SyncObjectManager, m_LogicalDevice->GetVkDevice(), dbgValue}, std::move(Deleter)};
 }
 
+void CommandQueueVkImpl::SubmitBatch::Clear()
+{
+    Entries.clear();
+    WaitSemaphores.clear();
+    WaitDstStageMasks.clear();
+    WaitValues.clear();
+    CmdBuffers.clear();
+    SignalSemaphores.clear();
+    SignalValues.clear();
+    SyncPoint.reset();
+    LastFenceValue = 0;
+}
+
+void CommandQueueVkImpl::EnableCompletionTracking(Uint32 MaxSubmitBatchSize)
+{
+    std::lock_guard<std::mutex> Lock{m_QueueMutex};
+
+    VERIFY(!m_CompletionSemaphore, "Completion tracking is already enabled");
+    if (!m_SupportedTimelineSemaphore)
+    {
+        UNEXPECTED("Completion tracking requires timeline semaphores");
+        return;
+    }
+
+    // Make sure that all previous submissions are complete so that
+    // the initial semaphore value correctly represents them.
+    vkQueueWaitIdle(m_VkQueue);
+    VERIFY(m_pFence != nullptr, "Command queue fence has not been initialized");
+    m_pFence->Wait(UINT64_MAX);
+
+    const auto  LastFenceValue = m_NextFenceValue.load() - 1;
+    std::string Name           = std::string{"Completion semaphore of queue "} + std::to_string(Uint32{m_CommandQueueId});
+    m_CompletionSemaphore      = m_LogicalDevice->CreateTimelineSemaphore(LastFenceValue, Name.c_str());
+    m_MaxSubmitBatchSize       = std::max(MaxSubmitBatchSize, 1u);
+}
+
 Uint64 CommandQueueVkImpl::Submit(const VkSubmitInfo& InSubmitInfo)
 {
     std::lock_guard<std::mutex> Lock{m_QueueMutex};
 
+    if (m_CompletionSemaphore)
+        return SubmitTracked(InSubmitInfo);
+
     // Increment the value before submitting the buffer to be overly safe
     const uint64_t FenceValue = m_NextFenceValue.fetch_add(1);
 
@@ -202,6 +241,155 @@ Uint64 CommandQueueVkImpl::Submit(const VkSubmitInfo& InSubmitInfo)
     return FenceValue;
 }
 
+Uint64 CommandQueueVkImpl::SubmitTracked(const VkSubmitInfo& SubmitInfo)
+{
+    const uint64_t FenceValue = m_NextFenceValue.fetch_add(1);
+
+    // Only submissions that have no extension structures other than VkTimelineSemaphoreSubmitInfo can be merged
+    const auto* pTimelineInfo = static_cast<const VkTimelineSemaphoreSubmitInfo*>(SubmitInfo.pNext);
+    if (pTimelineInfo == nullptr ||
+        (pTimelineInfo->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO && pTimelineInfo->pNext == nullptr))
+    {
+        AppendToBatch(SubmitInfo, FenceValue);
+        if (m_Batch.Entries.size() >= m_MaxSubmitBatchSize)
+            InternalSubmitPendingBatch();
+        return FenceValue;
+    }
+
+    // Submit the pending batch first to preserve the submission order.
+    InternalSubmitPendingBatch();
+
+    auto NewSyncPoint = CreateSyncPoint(FenceValue);
+
+    // The completion semaphore is signaled by a separate submission that follows the original one
+    VkSemaphore vkCompletionSemaphore = m_CompletionSemaphore;
+
+    VkTimelineSemaphoreSubmitInfo TimelineInfo{};
+    TimelineInfo.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    TimelineInfo.signalSemaphoreValueCount = 1;
+    TimelineInfo.pSignalSemaphoreValues    = &FenceValue;
+
+    VkSubmitInfo SubmitInfos[2] = {SubmitInfo, {}};
+    SubmitInfos[1].sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    SubmitInfos[1].pNext                = &TimelineInfo;
+    SubmitInfos[1].signalSemaphoreCount = 1;
+    SubmitInfos[1].pSignalSemaphores    = &vkCompletionSemaphore;
+
+    auto err = vkQueueSubmit(m_VkQueue, _countof(SubmitInfos), SubmitInfos, NewSyncPoint->GetFence());
+    DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit command buffer to the command queue");
+    (void)err;
+
+    AddPendingSyncPoint(FenceValue, std::move(NewSyncPoint));
+
+    return FenceValue;
+}
+
+void CommandQueueVkImpl::AppendToBatch(const VkSubmitInfo& SubmitInfo, Uint64 FenceValue)
+{
+    auto& Batch = m_Batch;
+
+    // All submissions of the batch are represented by the same sync point
+    // whose fence is signaled when the entire batch is complete.
+    if (!Batch.SyncPoint)
+        Batch.SyncPoint = CreateSyncPoint(FenceValue);
+    SetLastSyncPoint(Batch.SyncPoint);
+
+    const auto* pTimelineInfo = static_cast<const VkTimelineSemaphoreSubmitInfo*>(SubmitInfo.pNext);
+
+    SubmitBatch::Entry Entry;
+
+    Entry.Waits = {static_cast<Uint32>(Batch.WaitSemaphores.size()), SubmitInfo.waitSemaphoreCount};
+    for (uint32_t i = 0; i < SubmitInfo.waitSemaphoreCount; ++i)
+    {
+        Batch.WaitSemaphores.push_back(SubmitInfo.pWaitSemaphores[i]);
+        Batch.WaitDstStageMasks.push_back(SubmitInfo.pWaitDstStageMask[i]);
+        // Values of binary semaphores are ignored
+        Batch.WaitValues.push_back(pTimelineInfo != nullptr && i < pTimelineInfo->waitSemaphoreValueCount ? pTimelineInfo->pWaitSemaphoreValues[i] : 0);
+    }
+
+    Entry.CmdBuffers = {static_cast<Uint32>(Batch.CmdBuffers.size()), SubmitInfo.commandBufferCount};
+    for (uint32_t i = 0; i < SubmitInfo.commandBufferCount; ++i)
+        Batch.CmdBuffers.push_back(SubmitInfo.pCommandBuffers[i]);
+
+    Entry.Signals = {static_cast<Uint32>(Batch.SignalSemaphores.size()), SubmitInfo.signalSemaphoreCount + 1};
+    for (uint32_t i = 0; i < SubmitInfo.signalSemaphoreCount; ++i)
+    {
+        Batch.SignalSemaphores.push_back(SubmitInfo.pSignalSemaphores[i]);
+        Batch.SignalValues.push_back(pTimelineInfo != nullptr && i < pTimelineInfo->signalSemaphoreValueCount ? pTimelineInfo->pSignalSemaphoreValues[i] : 0);
+    }
+    Batch.SignalSemaphores.push_back(m_CompletionSemaphore);
+    Batch.SignalValues.push_back(FenceValue);
+
+    Batch.Entries.push_back(Entry);
+    Batch.LastFenceValue = FenceValue;
+    m_HasPendingBatch.store(true);
+}
+
+void CommandQueueVkImpl::InternalSubmitPendingBatch()
+{
+    auto& Batch = m_Batch;
+    if (Batch.Entries.empty())
+        return;
+
+    const auto NumEntries = Batch.Entries.size();
+    Batch.SubmitInfos.resize(NumEntries);
+    Batch.TimelineInfos.resize(NumEntries);
+    for (size_t i = 0; i < NumEntries; ++i)
+    {
+        const auto& Entry = Batch.Entries[i];
+
+        auto& TimelineInfo                     = Batch.TimelineInfos[i];
+        TimelineInfo                           = {};
+        TimelineInfo.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        TimelineInfo.waitSemaphoreValueCount   = Entry.Waits.Count;
+        TimelineInfo.pWaitSemaphoreValues      = Batch.WaitValues.data() + Entry.Waits.First;
+        TimelineInfo.signalSemaphoreValueCount = Entry.Signals.Count;
+        TimelineInfo.pSignalSemaphoreValues    = Batch.SignalValues.data() + Entry.Signals.First;
+
+        auto& SubmitInfo                = Batch.SubmitInfos[i];
+        SubmitInfo                      = {};
+        SubmitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        SubmitInfo.pNext                = &TimelineInfo;
+        SubmitInfo.waitSemaphoreCount   = Entry.Waits.Count;
+        SubmitInfo.pWaitSemaphores      = Batch.WaitSemaphores.data() + Entry.Waits.First;
+        SubmitInfo.pWaitDstStageMask    = Batch.WaitDstStageMasks.data() + Entry.Waits.First;
+        SubmitInfo.commandBufferCount   = Entry.CmdBuffers.Count;
+        SubmitInfo.pCommandBuffers      = Batch.CmdBuffers.data() + Entry.CmdBuffers.First;
+        SubmitInfo.signalSemaphoreCount = Entry.Signals.Count;
+        SubmitInfo.pSignalSemaphores    = Batch.SignalSemaphores.data() + Entry.Signals.First;
+    }
+
+    auto err = vkQueueSubmit(m_VkQueue, static_cast<uint32_t>(NumEntries), Batch.SubmitInfos.data(), Batch.SyncPoint->GetFence());
+    DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit command buffers to the command queue");
+    (void)err;
+
+    // The fence of the batch is signaled when all its submissions are complete, so the sync point
+    // must be kept alive by the queue fence until the last fence value of the batch is reached.
+    AddPendingSyncPoint(Batch.LastFenceValue, Batch.SyncPoint);
+
+    Batch.Clear();
+    m_HasPendingBatch.store(false);
+}
+
+void CommandQueueVkImpl::AddPendingSyncPoint(Uint64 FenceValue, SyncPointVkPtr SyncPoint)
+{
+    // The queue fence keeps the sync point alive until the GPU reaches the fence value,
+    // so its VkFence is not recycled while the submission may still be in flight.
+    VERIFY(m_pFence != nullptr, "Command queue fence has not been initialized");
+    m_pFence->AddPendingSyncPoint(m_CommandQueueId, FenceValue, SyncPoint);
+
+    SetLastSyncPoint(std::move(SyncPoint));
+}
+
+void CommandQueueVkImpl::SubmitPendingBatch()
+{
+    if (!m_HasPendingBatch.load())
+        return;
+
+    std::lock_guard<std::mutex> Lock{m_QueueMutex};
+    InternalSubmitPendingBatch();
+}
+
 Uint64 CommandQueueVkImpl::SubmitCmdBuffer(VkCommandBuffer cmdBuffer)
 {
     VkSubmitInfo SubmitInfo{};
@@ -228,7 +416,26 @@ Uint64 CommandQueueVkImpl::WaitForIdle()
     // Update last completed fence value to unlock all waiting events.
     const auto FenceValue = m_NextFenceValue.fetch_add(1);
 
-    vkQueueWaitIdle(m_VkQueue);
+    if (m_CompletionSemaphore)
+    {
+        InternalSubmitPendingBatch();
+        vkQueueWaitIdle(m_VkQueue);
+
+        // No submission signals this value, so signal it from the host to mark all submissions as complete
+        VkSemaphoreSignalInfo SignalInfo{};
+        SignalInfo.sType     = VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO;
+        SignalInfo.semaphore = m_CompletionSemaphore;
+        SignalInfo.value     = FenceValue;
+
+        auto err = m_LogicalDevice->SignalSemaphore(SignalInfo);
+        DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to signal the completion semaphore");
+        (void)err;
+    }
+    else
+    {
+        vkQueueWaitIdle(m_VkQueue);
+    }
+
     // For some reason after idling the queue not all fences are signaled
     m_pFence->Wait(UINT64_MAX);
     m_pFence->Reset(FenceValue);
@@ -238,6 +445,18 @@ Uint64 CommandQueueVkImpl::WaitForIdle()
 
 Uint64 CommandQueueVkImpl::GetCompletedFenceValue()
 {
+    if (m_CompletionSemaphore)
+    {
+        // The caller may be waiting for the value, so batched submissions must be sent to the GPU
+        SubmitPendingBatch();
+
+        Uint64 CompletedValue = 0;
+        auto   err            = m_LogicalDevice->GetSemaphoreCounter(m_CompletionSemaphore, &CompletedValue);
+        DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to get the completion semaphore counter");
+        (void)err;
+        return CompletedValue;
+    }
+
     return m_pFence->GetCompletedValue();
 }
 
@@ -247,6 +466,8 @@ void CommandQueueVkImpl::EnqueueSignalFence(VkFence vkFence)
 
     std::lock_guard<std::mutex> Lock{m_QueueMutex};
 
+    InternalSubmitPendingBatch();
+
     auto err = vkQueueSubmit(m_VkQueue, 0, nullptr, vkFence);
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit fence signal command to the command queue");
     (void)err;
@@ -255,6 +476,7 @@ void CommandQueueVkImpl::EnqueueSignalFence(VkFence vkFence)
 void CommandQueueVkImpl::EnqueueSignal(VkSemaphore vkTimelineSemaphore, Uint64 Value)
 {
     std::lock_guard<std::mutex> Lock{m_QueueMutex};
+    InternalSubmitPendingBatch();
     InternalSignalSemaphore(vkTimelineSemaphore, Value);
 }
 
@@ -287,6 +509,7 @@ void CommandQueueVkImpl::InternalSignalSemaphore(VkSemaphore vkTimelineSemaphore
 VkResult CommandQueueVkImpl::Present(const VkPresentInfoKHR& PresentInfo)
 {
     std::lock_guard<std::mutex> Lock{m_QueueMutex};
+    InternalSubmitPendingBatch();
     return vkQueuePresentKHR(m_VkQueue, &PresentInfo);
 }
 
@@ -294,11 +517,54 @@ Uint64 CommandQueueVkImpl::BindSparse(const VkBindSparseInfo& InBindInfo)
 {
     std::lock_guard<std::mutex> Lock{m_QueueMutex};
 
+    // Sparse binding must be executed after all previous submissions
+    InternalSubmitPendingBatch();
+
     // Increment the value before submitting the buffer to be overly safe
     const uint64_t FenceValue = m_NextFenceValue.fetch_add(1);
 
     auto NewSyncPoint = CreateSyncPoint(FenceValue);
 
+    const auto* pTimelineInfo = static_cast<const VkTimelineSemaphoreSubmitInfo*>(InBindInfo.pNext);
+    if (m_CompletionSemaphore &&
+        (pTimelineInfo == nullptr ||
+         (pTimelineInfo->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO && pTimelineInfo->pNext == nullptr)))
+    {
+        // Append the completion semaphore to the signal semaphores of the sparse binding operation
+        m_TempSignalSemaphores.clear();
+        std::vector<Uint64> SignalValues;
+        SignalValues.reserve(size_t{InBindInfo.signalSemaphoreCount} + 1);
+        for (uint32_t s = 0; s < InBindInfo.signalSemaphoreCount; ++s)
+        {
+            m_TempSignalSemaphores.push_back(InBindInfo.pSignalSemaphores[s]);
+            // Values of binary semaphores are ignored
+            SignalValues.push_back(pTimelineInfo != nullptr && s < pTimelineInfo->signalSemaphoreValueCount ? pTimelineInfo->pSignalSemaphoreValues[s] : 0);
+        }
+        m_TempSignalSemaphores.push_back(m_CompletionSemaphore);
+        SignalValues.push_back(FenceValue);
+
+        VkTimelineSemaphoreSubmitInfo TimelineInfo{};
+        if (pTimelineInfo != nullptr)
+            TimelineInfo = *pTimelineInfo;
+        TimelineInfo.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        TimelineInfo.signalSemaphoreValueCount = static_cast<uint32_t>(SignalValues.size());
+        TimelineInfo.pSignalSemaphoreValues    = SignalValues.data();
+
+        VkBindSparseInfo BindInfo     = InBindInfo;
+        BindInfo.pNext                = &TimelineInfo;
+        BindInfo.signalSemaphoreCount = static_cast<Uint32>(m_TempSignalSemaphores.size());
+        BindInfo.pSignalSemaphores    = m_TempSignalSemaphores.data();
+
+        auto err = vkQueueBindSparse(m_VkQueue, 1, &BindInfo, NewSyncPoint->GetFence());
+        DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit sparse bind commands to the command queue");
+        (void)err;
+
+        AddPendingSyncPoint(FenceValue, std::move(NewSyncPoint));
+
+        return FenceValue;
+    }
+    DEV_CHECK_ERR(!m_CompletionSemaphore, "Sparse binding operations with extension structures other than VkTimelineSemaphoreSubmitInfo are not supported when completion tracking is enabled");
+
     m_TempSignalSemaphores.clear();
     NewSyncPoint->GetSemaphores(m_TempSignalSemaphores);
 
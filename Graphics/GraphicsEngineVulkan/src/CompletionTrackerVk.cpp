@@ -0,0 +1,122 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "CompletionTrackerVk.hpp"
+
+#include <chrono>
+#include <vector>
+
+#include "RenderDeviceVkImpl.hpp"
+#include "CommandQueueVkImpl.hpp"
+#include "VulkanUtilities/VulkanDebug.hpp"
+
+namespace Diligent
+{
+
+// The thread wakes up at least this often to check the stop flag
+static constexpr std::chrono::milliseconds CompletionWaitTimeout{100};
+
+CompletionTrackerVk::CompletionTrackerVk(RenderDeviceVkImpl& DeviceVk) :
+    m_DeviceVk{DeviceVk},
+    m_Thread{&CompletionTrackerVk::ThreadFunc, this}
+{
+}
+
+CompletionTrackerVk::~CompletionTrackerVk()
+{
+    m_Stop.store(true);
+    if (m_Thread.joinable())
+        m_Thread.join();
+}
+
+void CompletionTrackerVk::ThreadFunc()
+{
+    const auto& LogicalDevice = m_DeviceVk.GetLogicalDevice();
+
+    std::vector<SoftwareQueueIndex> Queues;
+    std::vector<VkSemaphore>        Semaphores;
+    std::vector<Uint64>             CompletedValues;
+    for (Uint32 q = 0; q < m_DeviceVk.GetCommandQueueCount(); ++q)
+    {
+        const SoftwareQueueIndex QueueId{q};
+
+        VkSemaphore vkSemaphore = m_DeviceVk.GetCommandQueueVk(QueueId)->GetCompletionSemaphore();
+        if (vkSemaphore == VK_NULL_HANDLE)
+            continue;
+
+        Uint64 Value = 0;
+        LogicalDevice.GetSemaphoreCounter(vkSemaphore, &Value);
+
+        Queues.push_back(QueueId);
+        Semaphores.push_back(vkSemaphore);
+        CompletedValues.push_back(Value);
+    }
+    if (Semaphores.empty())
+        return;
+
+    std::vector<Uint64> WaitValues(Semaphores.size());
+
+    const auto TimeoutNs = static_cast<uint64_t>(std::chrono::nanoseconds{CompletionWaitTimeout}.count());
+    while (!m_Stop.load())
+    {
+        // Wake up when any queue completes the next submission. Timeline semaphores allow
+        // waiting for the values that have not been submitted for signal operation yet.
+        for (size_t i = 0; i < Semaphores.size(); ++i)
+            WaitValues[i] = CompletedValues[i] + 1;
+
+        VkSemaphoreWaitInfo WaitInfo{};
+        WaitInfo.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+        WaitInfo.flags          = VK_SEMAPHORE_WAIT_ANY_BIT;
+        WaitInfo.semaphoreCount = static_cast<uint32_t>(Semaphores.size());
+        WaitInfo.pSemaphores    = Semaphores.data();
+        WaitInfo.pValues        = WaitValues.data();
+
+        auto err = LogicalDevice.WaitSemaphores(WaitInfo, TimeoutNs);
+        if (err == VK_TIMEOUT)
+            continue;
+
+        if (err != VK_SUCCESS)
+        {
+            LOG_ERROR_MESSAGE("Failed to wait for the completion semaphores: ", VulkanUtilities::VkResultToString(err));
+            std::this_thread::sleep_for(CompletionWaitTimeout);
+            continue;
+        }
+
+        for (size_t i = 0; i < Semaphores.size(); ++i)
+        {
+            Uint64 Value = 0;
+            if (LogicalDevice.GetSemaphoreCounter(Semaphores[i], &Value) != VK_SUCCESS || Value <= CompletedValues[i])
+                continue;
+
+            CompletedValues[i] = Value;
+            m_DeviceVk.GetReleaseQueue(Queues[i]).Purge(Value);
+        }
+    }
+}
+
+} // namespace Diligent
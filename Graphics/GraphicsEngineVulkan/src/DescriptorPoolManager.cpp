@@ -26,8 +26,10 @@
  */
 
 #include "pch.h"
+
 #include "DescriptorPoolManager.hpp"
 #include "RenderDeviceVkImpl.hpp"
+#include "HashUtils.hpp"
 
 namespace Diligent
 {
@@ -36,14 +38,29 @@ void DescriptorSetAllocation::Release()
 {
     if (Set != VK_NULL_HANDLE)
     {
-        VERIFY_EXPR(DescrSetAllocator != nullptr && Pool != VK_NULL_HANDLE);
-        DescrSetAllocator->FreeDescriptorSet(Set, Pool, CmdQueueMask);
+        VERIFY_EXPR(DescrSetAllocator != nullptr && Pool != nullptr && LayoutCounts != nullptr);
+        DescrSetAllocator->FreeDescriptorSet(Set, Pool, LayoutCounts, CmdQueueMask);
 
         Reset();
     }
 }
 
+size_t DescriptorTypeCounts::Hasher::operator()(const DescriptorTypeCounts& Counts) const
+{
+    size_t Hash = 0;
+    for (auto Count : Counts.Counts)
+        HashCombine(Hash, Count);
+    return Hash;
+}
+
 VulkanUtilities::DescriptorPoolWrapper DescriptorPoolManager::CreateDescriptorPool(const char* DebugName) const
+{
+    return CreateDescriptorPool(DebugName, m_PoolSizes, m_MaxSets);
+}
+
+VulkanUtilities::DescriptorPoolWrapper DescriptorPoolManager::CreateDescriptorPool(const char*                              DebugName,
+                                                                                   const std::vector<VkDescriptorPoolSize>& PoolSizes,
+                                                                                   uint32_t                                 MaxSets) const
 {
     VkDescriptorPoolCreateInfo PoolCI = {};
 
@@ -53,9 +70,9 @@ VulkanUtilities::DescriptorPoolWrapper DescriptorPoolManager::CreateDescriptorPo
     // return their individual allocations to the pool, i.e. all of vkAllocateDescriptorSets,
     // vkFreeDescriptorSets, and vkResetDescriptorPool are allowed. (13.2.3)
     PoolCI.flags         = m_AllowFreeing ? VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT : 0;
-    PoolCI.maxSets       = m_MaxSets;
-    PoolCI.poolSizeCount = static_cast<uint32_t>(m_PoolSizes.size());
-    PoolCI.pPoolSizes    = m_PoolSizes.data();
+    PoolCI.maxSets       = MaxSets;
+    PoolCI.poolSizeCount = static_cast<uint32_t>(PoolSizes.size());
+    PoolCI.pPoolSizes    = PoolSizes.data();
     return m_DeviceVkImpl.GetLogicalDevice().CreateDescriptorPool(PoolCI, DebugName);
 }
 
@@ -100,7 +117,8 @@ DescriptorPoolManager::DescriptorPoolManager(RenderDeviceVkImpl&               D
 DescriptorPoolManager::~DescriptorPoolManager()
 {
     DEV_CHECK_ERR(m_AllocatedPoolCounter == 0, "Not all allocated descriptor pools are returned to the pool manager");
-    LOG_INFO_MESSAGE(m_PoolName, " stats: allocated ", m_Pools.size(), " pool(s)");
+    if (!m_Pools.empty())
+        LOG_INFO_MESSAGE(m_PoolName, " stats: allocated ", m_Pools.size(), " pool(s)");
 }
 
 VulkanUtilities::DescriptorPoolWrapper DescriptorPoolManager::GetPool(const char* DebugName)
@@ -190,65 +208,256 @@ static VkDescriptorSet AllocateDescriptorSet(const VulkanUtilities::VulkanLogica
 }
 
 
+DescriptorSetPool::DescriptorSetPool(VulkanUtilities::DescriptorPoolWrapper&& _vkPool,
+                                     Uint32                                   _CacheIdx,
+                                     const std::vector<VkDescriptorPoolSize>& PoolSizes,
+                                     Uint32                                   _MaxSets) noexcept :
+    // clang-format off
+    vkPool       {std::move(_vkPool)},
+    CacheIdx     {_CacheIdx         },
+    MaxSets      {_MaxSets          },
+    RemainingSets{_MaxSets          }
+// clang-format on
+{
+    for (const auto& PoolSize : PoolSizes)
+        RemainingDescriptors[PoolSize.type] += PoolSize.descriptorCount;
+}
+
+bool DescriptorSetPool::CanAllocate(const DescriptorTypeCounts& LayoutCounts) const
+{
+    if (RemainingSets == 0 || IsFragmented)
+        return false;
+
+    for (Uint32 i = 0; i < DescriptorTypeCounts::NumTypes; ++i)
+    {
+        if (LayoutCounts.Counts[i] > RemainingDescriptors.Counts[i])
+            return false;
+    }
+    return true;
+}
+
+void DescriptorSetPool::OnAllocate(const DescriptorTypeCounts& LayoutCounts)
+{
+    VERIFY_EXPR(CanAllocate(LayoutCounts));
+    --RemainingSets;
+    for (Uint32 i = 0; i < DescriptorTypeCounts::NumTypes; ++i)
+        RemainingDescriptors.Counts[i] -= LayoutCounts.Counts[i];
+}
+
+void DescriptorSetPool::OnFree(const DescriptorTypeCounts& LayoutCounts)
+{
+    ++RemainingSets;
+    for (Uint32 i = 0; i < DescriptorTypeCounts::NumTypes; ++i)
+        RemainingDescriptors.Counts[i] += LayoutCounts.Counts[i];
+    IsFragmented = false;
+}
+
+
+// Returns the sequential index of the calling thread
+static Uint32 GetThreadIndex()
+{
+    static std::atomic<Uint32> NextThreadIndex{0};
+    thread_local const Uint32  ThreadIndex = NextThreadIndex.fetch_add(1);
+    return ThreadIndex;
+}
+
+DescriptorSetAllocator::DescriptorSetAllocator(RenderDeviceVkImpl&               DeviceVkImpl,
+                                               std::string                       PoolName,
+                                               std::vector<VkDescriptorPoolSize> PoolSizes,
+                                               uint32_t                          MaxSets,
+                                               bool                              AllowFreeing) noexcept :
+    // clang-format off
+    DescriptorPoolManager
+    {
+        DeviceVkImpl,
+        std::move(PoolName),
+        std::move(PoolSizes),
+        MaxSets,
+        AllowFreeing
+    }
+// clang-format on
+{
+#ifdef DILIGENT_DEVELOPMENT
+    m_AllocatedSetCounter = 0;
+#endif
+}
+
 DescriptorSetAllocator::~DescriptorSetAllocator()
 {
     DEV_CHECK_ERR(m_AllocatedSetCounter == 0, m_AllocatedSetCounter, " descriptor set(s) have not been returned to the allocator. If there are outstanding references to the sets in release queues, the app will crash when DescriptorSetAllocator::FreeDescriptorSet() is called");
+
+    size_t NumPools = 0;
+    for (const auto& Cache : m_ThreadCaches)
+        NumPools += Cache.Pools.size();
+    LOG_INFO_MESSAGE(m_PoolName, " stats: allocated ", NumPools, " pool(s), failed allocation attempts: ", m_FailedAllocationCounter.load());
+}
+
+const DescriptorTypeCounts* DescriptorSetAllocator::GetLayoutDescriptorCounts(const DescriptorTypeCounts& LayoutCounts)
+{
+    std::lock_guard<std::mutex> Lock{m_LayoutCountsMtx};
+    // Elements of unordered_set are never moved in memory
+    return &*m_LayoutCounts.insert(LayoutCounts).first;
+}
+
+void DescriptorSetAllocator::GetStats(DescriptorSetAllocatorStatsVk& Stats)
+{
+    Stats = {};
+    for (auto& Cache : m_ThreadCaches)
+    {
+        std::lock_guard<std::mutex> Lock{Cache.Mtx};
+        for (const auto& pPool : Cache.Pools)
+        {
+            ++Stats.NumPools;
+            Stats.NumAllocatedSets += pPool->MaxSets - pPool->RemainingSets;
+            if (pPool->IsFragmented)
+                ++Stats.NumFragmentedPools;
+        }
+    }
+    Stats.NumFailedAllocations = m_FailedAllocationCounter.load();
 }
 
-DescriptorSetAllocation DescriptorSetAllocator::Allocate(Uint64 CommandQueueMask, VkDescriptorSetLayout SetLayout, const char* DebugName)
+void DescriptorSetAllocator::GetNewPoolSize(const ThreadCache&                 Cache,
+                                            const DescriptorTypeCounts&        LayoutCounts,
+                                            std::vector<VkDescriptorPoolSize>& PoolSizes,
+                                            Uint32&                            MaxSets) const
 {
+    Uint64 TotalDescriptors = 0;
+    for (auto Count : Cache.DescriptorHistogram)
+        TotalDescriptors += Count;
+
+    if (TotalDescriptors == 0)
+    {
+        // No allocation history: use the sizes from the engine create info
+        PoolSizes = m_PoolSizes;
+        MaxSets   = m_MaxSets;
+    }
+    else
+    {
+        Uint64 DescriptorBudget = 0;
+        for (const auto& PoolSize : m_PoolSizes)
+            DescriptorBudget += PoolSize.descriptorCount;
+
+        // Size the pool to hold m_MaxSets sets with the average descriptor type distribution
+        // of the sets allocated by this thread, but do not exceed the configured number of descriptors.
+        const auto NumAllocatedSets = Cache.NumAllocatedSets;
+        Uint64     NumSets          = m_MaxSets;
+        if (TotalDescriptors * NumSets > DescriptorBudget * NumAllocatedSets)
+            NumSets = std::max(DescriptorBudget * NumAllocatedSets / TotalDescriptors, Uint64{1});
+        MaxSets = static_cast<Uint32>(NumSets);
+
+        PoolSizes.clear();
+        for (Uint32 i = 0; i < DescriptorTypeCounts::NumTypes; ++i)
+        {
+            if (Cache.DescriptorHistogram[i] == 0)
+                continue;
+
+            const auto Count = (Cache.DescriptorHistogram[i] * NumSets + NumAllocatedSets - 1) / NumAllocatedSets;
+            PoolSizes.push_back({DescriptorTypeCounts::IndexToType(i), static_cast<uint32_t>(Count)});
+        }
+    }
+
+    // Make sure that the layout fits into the new pool
+    for (Uint32 i = 0; i < DescriptorTypeCounts::NumTypes; ++i)
+    {
+        const auto LayoutCount = LayoutCounts.Counts[i];
+        if (LayoutCount == 0)
+            continue;
+
+        const auto Type = DescriptorTypeCounts::IndexToType(i);
+        auto       it   = std::find_if(PoolSizes.begin(), PoolSizes.end(), [Type](const VkDescriptorPoolSize& Size) { return Size.type == Type; });
+        if (it != PoolSizes.end())
+            it->descriptorCount = std::max(it->descriptorCount, LayoutCount);
+        else
+            PoolSizes.push_back({Type, LayoutCount});
+    }
+    MaxSets = std::max(MaxSets, 1u);
+}
+
+DescriptorSetAllocation DescriptorSetAllocator::Allocate(Uint64                      CommandQueueMask,
+                                                         VkDescriptorSetLayout       SetLayout,
+                                                         const DescriptorTypeCounts* pLayoutCounts,
+                                                         const char*                 DebugName)
+{
+    VERIFY(pLayoutCounts != nullptr, "Layout descriptor counts must not be null");
+    const auto& LayoutCounts = *pLayoutCounts;
+
+    const auto CacheIdx = GetThreadIndex() % NumThreadCaches;
+    auto&      Cache    = m_ThreadCaches[CacheIdx];
+
     // Descriptor pools are externally synchronized, meaning that the application must not allocate
     // and/or free descriptor sets from the same pool in multiple threads simultaneously (13.2.3)
-    std::lock_guard<std::mutex> Lock{m_Mutex};
+    std::lock_guard<std::mutex> Lock{Cache.Mtx};
 
     const auto& LogicalDevice = m_DeviceVkImpl.GetLogicalDevice();
-    // Try all pools starting from the frontmost
-    for (auto it = m_Pools.begin(); it != m_Pools.end(); ++it)
+
+    DescriptorSetPool* pPool = nullptr;
+    VkDescriptorSet    Set   = VK_NULL_HANDLE;
+    // Try all pools that have enough space starting from the frontmost
+    for (auto it = Cache.Pools.begin(); it != Cache.Pools.end(); ++it)
     {
-        auto& Pool = *it;
-        auto  Set  = AllocateDescriptorSet(LogicalDevice, Pool, SetLayout, DebugName);
-        if (Set != VK_NULL_HANDLE)
+        auto& Pool = **it;
+        if (!Pool.CanAllocate(LayoutCounts))
+            continue;
+
+        Set = AllocateDescriptorSet(LogicalDevice, Pool.vkPool, SetLayout, DebugName);
+        if (Set == VK_NULL_HANDLE)
         {
-            // Move the pool to the front
-            if (it != m_Pools.begin())
-            {
-                std::swap(*it, m_Pools.front());
-            }
+            // The pool is too fragmented to fit the set
+            Pool.IsFragmented = true;
+            m_FailedAllocationCounter.fetch_add(1);
+            continue;
+        }
 
-#ifdef DILIGENT_DEVELOPMENT
-            ++m_AllocatedSetCounter;
-#endif
-            return {Set, Pool, CommandQueueMask, *this};
+        pPool = &Pool;
+        // Move the pool to the front
+        if (it != Cache.Pools.begin())
+        {
+            std::swap(*it, Cache.Pools.front());
         }
+        break;
     }
 
-    // Failed to allocate descriptor from existing pools -> create a new one
-    LOG_INFO_MESSAGE("Allocated new descriptor pool");
-    m_Pools.emplace_front(CreateDescriptorPool("Descriptor pool"));
+    if (Set == VK_NULL_HANDLE)
+    {
+        // Failed to allocate descriptor from existing pools -> create a new one
+        std::vector<VkDescriptorPoolSize> PoolSizes;
+        Uint32                            MaxSets = 0;
+        GetNewPoolSize(Cache, LayoutCounts, PoolSizes, MaxSets);
+
+        LOG_INFO_MESSAGE("Allocated new descriptor pool");
+        Cache.Pools.emplace_front(new DescriptorSetPool{CreateDescriptorPool("Descriptor pool", PoolSizes, MaxSets), CacheIdx, PoolSizes, MaxSets});
+
+        pPool = Cache.Pools.front().get();
+        Set   = AllocateDescriptorSet(LogicalDevice, pPool->vkPool, SetLayout, DebugName);
+        DEV_CHECK_ERR(Set != VK_NULL_HANDLE, "Failed to allocate descriptor set");
+    }
 
-    auto& NewPool = m_Pools.front();
-    auto  Set     = AllocateDescriptorSet(LogicalDevice, NewPool, SetLayout, DebugName);
-    DEV_CHECK_ERR(Set != VK_NULL_HANDLE, "Failed to allocate descriptor set");
+    pPool->OnAllocate(LayoutCounts);
+    for (Uint32 i = 0; i < DescriptorTypeCounts::NumTypes; ++i)
+        Cache.DescriptorHistogram[i] += LayoutCounts.Counts[i];
+    ++Cache.NumAllocatedSets;
 
 #ifdef DILIGENT_DEVELOPMENT
     ++m_AllocatedSetCounter;
 #endif
 
-    return {Set, NewPool, CommandQueueMask, *this};
+    return {Set, pPool, CommandQueueMask, *this, pLayoutCounts};
 }
 
-void DescriptorSetAllocator::FreeDescriptorSet(VkDescriptorSet Set, VkDescriptorPool Pool, Uint64 QueueMask)
+void DescriptorSetAllocator::FreeDescriptorSet(VkDescriptorSet Set, DescriptorSetPool* Pool, const DescriptorTypeCounts* LayoutCounts, Uint64 QueueMask)
 {
     class DescriptorSetDeleter
     {
     public:
         // clang-format off
-        DescriptorSetDeleter(DescriptorSetAllocator& _Allocator,
-                             VkDescriptorSet         _Set,
-                             VkDescriptorPool        _Pool) :
-            Allocator {&_Allocator},
-            Set       {_Set       },
-            Pool      {_Pool      }
+        DescriptorSetDeleter(DescriptorSetAllocator&     _Allocator,
+                             VkDescriptorSet             _Set,
+                             DescriptorSetPool*          _Pool,
+                             const DescriptorTypeCounts* _LayoutCounts) :
+            Allocator   {&_Allocator  },
+            Set         {_Set         },
+            Pool        {_Pool        },
+            LayoutCounts{_LayoutCounts}
         {}
 
         DescriptorSetDeleter             (const DescriptorSetDeleter&) = delete;
@@ -256,13 +465,15 @@ void DescriptorSetAllocator::FreeDescriptorSet(VkDescriptorSet Set, VkDescriptor
         DescriptorSetDeleter& operator = (      DescriptorSetDeleter&&)= delete;
 
         DescriptorSetDeleter(DescriptorSetDeleter&& rhs)noexcept :
-            Allocator {rhs.Allocator},
-            Set       {rhs.Set      },
-            Pool      {rhs.Pool     }
+            Allocator   {rhs.Allocator   },
+            Set         {rhs.Set         },
+            Pool        {rhs.Pool        },
+            LayoutCounts{rhs.LayoutCounts}
         {
-            rhs.Allocator = nullptr;
-            rhs.Set       = VK_NULL_HANDLE;
-            rhs.Pool      = VK_NULL_HANDLE;
+            rhs.Allocator    = nullptr;
+            rhs.Set          = VK_NULL_HANDLE;
+            rhs.Pool         = nullptr;
+            rhs.LayoutCounts = nullptr;
         }
         // clang-format on
 
@@ -270,8 +481,9 @@ void DescriptorSetAllocator::FreeDescriptorSet(VkDescriptorSet Set, VkDescriptor
         {
             if (Allocator != nullptr)
             {
-                std::lock_guard<std::mutex> Lock{Allocator->m_Mutex};
-                Allocator->m_DeviceVkImpl.GetLogicalDevice().FreeDescriptorSet(Pool, Set);
+                std::lock_guard<std::mutex> Lock{Allocator->m_ThreadCaches[Pool->CacheIdx].Mtx};
+                Allocator->m_DeviceVkImpl.GetLogicalDevice().FreeDescriptorSet(Pool->vkPool, Set);
+                Pool->OnFree(*LayoutCounts);
 #ifdef DILIGENT_DEVELOPMENT
                 --Allocator->m_AllocatedSetCounter;
 #endif
@@ -279,11 +491,12 @@ void DescriptorSetAllocator::FreeDescriptorSet(VkDescriptorSet Set, VkDescriptor
         }
 
     private:
-        DescriptorSetAllocator* Allocator;
-        VkDescriptorSet         Set;
-        VkDescriptorPool        Pool;
+        DescriptorSetAllocator*     Allocator;
+        VkDescriptorSet             Set;
+        DescriptorSetPool*          Pool;
+        const DescriptorTypeCounts* LayoutCounts;
     };
-    m_DeviceVkImpl.SafeReleaseDeviceObject(DescriptorSetDeleter{*this, Set, Pool}, QueueMask);
+    m_DeviceVkImpl.SafeReleaseDeviceObject(DescriptorSetDeleter{*this, Set, Pool, LayoutCounts}, QueueMask);
 }
 
 
@@ -35,6 +35,7 @@
 #include "RenderDeviceVkImpl.hpp"
 #include "PipelineStateVkImpl.hpp"
 #include "TextureVkImpl.hpp"
+#include "TransientMemoryVk.hpp"
 #include "BufferVkImpl.hpp"
 #include "RenderPassVkImpl.hpp"
 #include "FenceVkImpl.hpp"
@@ -72,6 +73,7 @@ DeviceContextVkImpl::DeviceContextVkImpl(IReferenceCounters*       pRefCounters,
         pDeviceVkImpl,
         Desc
     },
+    m_DynamicRenderingEnabled{pDeviceVkImpl->GetLogicalDevice().GetEnabledExtFeatures().DynamicRendering.dynamicRendering != VK_FALSE},
     m_CmdListAllocator { GetRawAllocator(), sizeof(CommandListVkImpl), 64 },
     // Upload heap must always be thread-safe as Finish() may be called from another thread
     m_QueueFamilyCmdPools
@@ -211,6 +213,7 @@ void DeviceContextVkImpl::Begin(Uint32 ImmediateContextId)
     m_DstImmediateContextId = static_cast<Uint8>(ImmediateContextId);
     VERIFY_EXPR(m_DstImmediateContextId == ImmediateContextId);
     m_pQueryMgr = &m_pDevice->GetQueryMgr(CommandQueueId);
+    m_TransientMemoryOwners.clear();
 }
 
 void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkCommandBuffer vkCmdBuff, Uint64 FenceValue)
@@ -263,7 +266,7 @@ void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkComm
 
 inline void DeviceContextVkImpl::DisposeCurrentCmdBuffer(SoftwareQueueIndex CmdQueue, Uint64 FenceValue)
 {
-    VERIFY(m_CommandBuffer.GetState().RenderPass == VK_NULL_HANDLE, "Disposing command buffer with unfinished render pass");
+    VERIFY(!m_CommandBuffer.IsInRenderPass(), "Disposing command buffer with unfinished render pass");
     auto vkCmdBuff = m_CommandBuffer.GetVkCmdBuffer();
     if (vkCmdBuff != VK_NULL_HANDLE)
     {
@@ -279,6 +282,9 @@ void DeviceContextVkImpl::SetPipelineState(IPipelineState* pPipelineState)
     if (PipelineStateVkImpl::IsSameObject(m_pPipelineState, pPipelineStateVk))
         return;
 
+    if (!CheckPipelineStateStatus(pPipelineStateVk))
+        return;
+
     const auto& PSODesc = pPipelineStateVk->GetDesc();
 
     bool CommitStates  = false;
@@ -361,6 +367,7 @@ void DeviceContextVkImpl::SetPipelineState(IPipelineState* pPipelineState)
     {
         // Do not clear DescriptorSetBaseInd and DynamicOffsetCount!
         BindInfo.SetInfo[sign].vkSets.fill(VK_NULL_HANDLE);
+        BindInfo.SetInfo[sign].PushDynamicSet = false;
     }
 #endif
 
@@ -379,6 +386,17 @@ void DeviceContextVkImpl::SetPipelineState(IPipelineState* pPipelineState)
         SetInfo.BaseInd            = Layout.GetFirstDescrSetIndex(pSignature->GetDesc().BindingIndex);
         SetInfo.DynamicOffsetCount = pSignature->GetDynamicOffsetCount();
     }
+
+    if (Layout.HasBindlessHeapSet())
+    {
+        // The heap set never changes, so it is bound once per pipeline. Binding the signature sets
+        // with lower indices later does not disturb it as they use the same pipeline layout.
+        const auto* pBindlessHeap = m_pDevice->GetBindlessHeap();
+        VERIFY_EXPR(pBindlessHeap != nullptr);
+        const VkDescriptorSet vkHeapSet = pBindlessHeap->GetVkDescriptorSet();
+        m_CommandBuffer.BindDescriptorSets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, Layout.GetBindlessHeapSetIndex(),
+                                           1, &vkHeapSet, 0, nullptr);
+    }
 }
 
 DeviceContextVkImpl::ResourceBindInfo& DeviceContextVkImpl::GetBindInfo(PIPELINE_TYPE Type)
@@ -417,11 +435,11 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
         DEV_CHECK_ERR(pResourceCache != nullptr, "Resource cache at index ", sign, " is null");
 
         auto& SetInfo = BindInfo.SetInfo[sign];
-        VERIFY(SetInfo.vkSets[0] != VK_NULL_HANDLE,
+        VERIFY(SetInfo.vkSets[0] != VK_NULL_HANDLE || SetInfo.PushDynamicSet,
                "At least one descriptor set in the stale SRB must not be NULL. Empty SRBs should not be marked as stale by CommitShaderResources()");
-        const Uint32 SetCount = 1 + (SetInfo.vkSets[1] != VK_NULL_HANDLE ? 1 : 0);
+        const Uint32 SetCount = (SetInfo.vkSets[0] != VK_NULL_HANDLE ? 1 : 0) + (SetInfo.vkSets[1] != VK_NULL_HANDLE ? 1 : 0);
 
-        VERIFY_EXPR(SetCount == pResourceCache->GetNumDescriptorSets());
+        VERIFY_EXPR(SetCount + (SetInfo.PushDynamicSet ? 1 : 0) == pResourceCache->GetNumDescriptorSets());
 
         if (SetInfo.DynamicOffsetCount > 0)
         {
@@ -440,8 +458,20 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
         // (either compute or graphics, according to the pipelineBindPoint). Any bindings that were previously
         // applied via these sets are no longer valid (13.2.5)
         VERIFY_EXPR(m_State.vkPipelineBindPoint != VK_PIPELINE_BIND_POINT_MAX_ENUM);
-        m_CommandBuffer.BindDescriptorSets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, SetInfo.BaseInd, SetCount,
-                                           SetInfo.vkSets.data(), SetInfo.DynamicOffsetCount, m_DynamicBufferOffsets.data());
+        if (SetCount > 0)
+        {
+            m_CommandBuffer.BindDescriptorSets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, SetInfo.BaseInd, SetCount,
+                                               SetInfo.vkSets.data(), SetInfo.DynamicOffsetCount, m_DynamicBufferOffsets.data());
+            ++m_Stats.DescriptorSetBindCount;
+        }
+
+        // Push descriptor sets can't contain descriptors with dynamic offsets, so all offsets belong to the bound sets
+        if (SetInfo.PushDynamicSet && !BindInfo.PushDescriptorWrites.empty())
+        {
+            VERIFY(sign == 0, "Only the signature with binding index 0 may use push descriptors");
+            m_CommandBuffer.PushDescriptorSet(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, SetInfo.BaseInd + SetCount,
+                                              static_cast<uint32_t>(BindInfo.PushDescriptorWrites.size()), BindInfo.PushDescriptorWrites.data());
+        }
 
 #ifdef DILIGENT_DEVELOPMENT
         SetInfo.LastBoundBaseInd = SetInfo.BaseInd;
@@ -470,7 +500,8 @@ void DeviceContextVkImpl::DvpValidateCommittedShaderResources(ResourceBindInfo&
         DEV_CHECK_ERR((BindInfo.StaleSRBMask & BindInfo.ActiveSRBMask) == 0, "CommitDescriptorSets() must be called before validation.");
 
         const auto& SetInfo = BindInfo.SetInfo[i];
-        const auto  DSCount = pSign->GetNumDescriptorSets();
+        // The pushed dynamic set is always the last one
+        const auto DSCount = pSign->GetNumDescriptorSets() - (SetInfo.PushDynamicSet ? 1 : 0);
         for (Uint32 s = 0; s < DSCount; ++s)
         {
             DEV_CHECK_ERR(SetInfo.vkSets[s] != VK_NULL_HANDLE,
@@ -517,6 +548,12 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
     ResourceCache.DbgVerifyDynamicBuffersCounter();
 #endif
 
+    if (m_pDevice->HasAliasedTextures())
+    {
+        // Aliased textures take over their memory when they are bound, in every state transition mode
+        ResourceCache.AcquireTransientTextures(this);
+    }
+
     if (StateTransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
     {
         ResourceCache.TransitionResources<false>(this);
@@ -536,7 +573,8 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
     BindInfo.Set(SRBIndex, pResBindingVkImpl);
     // We must not clear entire ResInfo as DescriptorSetBaseInd and DynamicOffsetCount
     // are set by SetPipelineState().
-    SetInfo.vkSets = {};
+    SetInfo.vkSets         = {};
+    SetInfo.PushDynamicSet = false;
 
     Uint32 DSIndex = 0;
     if (pSignature->HasDescriptorSet(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE))
@@ -553,24 +591,39 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
         VERIFY_EXPR(DSIndex == pSignature->GetDescriptorSetIndex<PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC>());
         VERIFY_EXPR(const_cast<const ShaderResourceCacheVk&>(ResourceCache).GetDescriptorSet(DSIndex).GetVkDescriptorSet() == VK_NULL_HANDLE);
 
-        const auto vkLayout = pSignature->GetVkDescriptorSetLayout(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC);
+        if (pSignature->HasPushDescriptorSet())
+        {
+            VERIFY(SRBIndex == 0, "Only the signature with binding index 0 may use push descriptors");
 
-        VkDescriptorSet vkDynamicDescrSet   = VK_NULL_HANDLE;
-        const char*     DynamicDescrSetName = "Dynamic Descriptor Set";
+            // Descriptors are pushed by CommitDescriptorSets() as the pipeline layout may not be known yet.
+            // Note that the writes reference the descriptor data, so it must not be reallocated until then.
+            BindInfo.PushDescriptorData.resize(pSignature->GetDynamicDescriptorDataSize());
+            pSignature->WriteDynamicDescriptors(ResourceCache, BindInfo.PushDescriptorData.data(), &BindInfo.PushDescriptorWrites);
+
+            SetInfo.PushDynamicSet = true;
+        }
+        else
+        {
+            const auto vkLayout = pSignature->GetVkDescriptorSetLayout(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC);
+
+            VkDescriptorSet vkDynamicDescrSet   = VK_NULL_HANDLE;
+            const char*     DynamicDescrSetName = "Dynamic Descriptor Set";
 #ifdef DILIGENT_DEVELOPMENT
-        String _DynamicDescrSetName{DynamicDescrSetName};
-        _DynamicDescrSetName.append(" (");
-        _DynamicDescrSetName.append(pSignature->GetDesc().Name);
-        _DynamicDescrSetName += ')';
-        DynamicDescrSetName = _DynamicDescrSetName.c_str();
+            String _DynamicDescrSetName{DynamicDescrSetName};
+            _DynamicDescrSetName.append(" (");
+            _DynamicDescrSetName.append(pSignature->GetDesc().Name);
+            _DynamicDescrSetName += ')';
+            DynamicDescrSetName = _DynamicDescrSetName.c_str();
 #endif
-        // Allocate vulkan descriptor set for dynamic resources
-        vkDynamicDescrSet = AllocateDynamicDescriptorSet(vkLayout, DynamicDescrSetName);
+            // Allocate vulkan descriptor set for dynamic resources
+            vkDynamicDescrSet = AllocateDynamicDescriptorSet(vkLayout, DynamicDescrSetName);
+            ++m_Stats.DescriptorSetAllocationCount;
 
-        // Write all dynamic resource descriptors
-        pSignature->CommitDynamicResources(ResourceCache, vkDynamicDescrSet);
+            // Write all dynamic resource descriptors
+            pSignature->CommitDynamicResources(ResourceCache, vkDynamicDescrSet, m_DynamicDescriptorData);
 
-        SetInfo.vkSets[DSIndex] = vkDynamicDescrSet;
+            SetInfo.vkSets[DSIndex] = vkDynamicDescrSet;
+        }
         ++DSIndex;
     }
 
@@ -698,8 +751,7 @@ void DeviceContextVkImpl::PrepareForDraw(DRAW_FLAGS Flags)
     if ((Flags & DRAW_FLAG_VERIFY_RENDER_TARGETS) != 0)
         DvpVerifyRenderTargets();
 
-    VERIFY(m_vkRenderPass != VK_NULL_HANDLE, "No render pass is active while executing draw command");
-    VERIFY(m_vkFramebuffer != VK_NULL_HANDLE, "No framebuffer is bound while executing draw command");
+    VERIFY(HasBoundFramebuffer(), "No render pass or dynamic rendering is active while executing draw command");
 #endif
 
     EnsureVkCmdBuffer();
@@ -738,7 +790,9 @@ void DeviceContextVkImpl::PrepareForDraw(DRAW_FLAGS Flags)
     if (m_pPipelineState->GetGraphicsPipelineDesc().pRenderPass == nullptr)
     {
 #ifdef DILIGENT_DEVELOPMENT
-        if (m_pPipelineState->GetRenderPass()->GetVkRenderPass() != m_vkRenderPass)
+        // With dynamic rendering, there is no render pass to compare, and
+        // pipeline formats are verified by DvpVerifyRenderTargets()
+        if (m_vkRenderPass != VK_NULL_HANDLE && m_pPipelineState->GetRenderPass()->GetVkRenderPass() != m_vkRenderPass)
         {
             // Note that different Vulkan render passes may still be compatible,
             // so we should only verify implicit render passes
@@ -786,6 +840,7 @@ void DeviceContextVkImpl::PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE Ind
 void DeviceContextVkImpl::Draw(const DrawAttribs& Attribs)
 {
     DvpVerifyDrawArguments(Attribs);
+    ++m_Stats.DrawCount;
 
     PrepareForDraw(Attribs.Flags);
 
@@ -799,6 +854,7 @@ void DeviceContextVkImpl::Draw(const DrawAttribs& Attribs)
 void DeviceContextVkImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
 {
     DvpVerifyDrawIndexedArguments(Attribs);
+    ++m_Stats.DrawCount;
 
     PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
 
@@ -809,9 +865,99 @@ void DeviceContextVkImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
     }
 }
 
+void DeviceContextVkImpl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    DvpVerifyMultiDrawArguments(Attribs);
+    m_Stats.DrawCount += Attribs.DrawCount;
+
+    PrepareForDraw(Attribs.Flags);
+
+    if (Attribs.DrawCount == 0 || Attribs.NumInstances == 0)
+        return;
+
+    if (m_pDevice->GetFeatures().NativeMultiDraw)
+    {
+        m_MultiDrawInfo.resize(Attribs.DrawCount);
+        for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+        {
+            const auto& Item = Attribs.pDrawItems[i];
+
+            m_MultiDrawInfo[i].firstVertex = Item.StartVertexLocation;
+            m_MultiDrawInfo[i].vertexCount = Item.NumVertices;
+        }
+
+        const auto MaxMultiDrawCount = m_pDevice->GetPhysicalDevice().GetExtProperties().MultiDraw.maxMultiDrawCount;
+        VERIFY_EXPR(MaxMultiDrawCount > 0);
+        for (Uint32 FirstDraw = 0; FirstDraw < Attribs.DrawCount; FirstDraw += MaxMultiDrawCount)
+        {
+            const auto DrawCount = std::min(Attribs.DrawCount - FirstDraw, MaxMultiDrawCount);
+            m_CommandBuffer.DrawMulti(DrawCount, &m_MultiDrawInfo[FirstDraw], Attribs.NumInstances, Attribs.FirstInstanceLocation);
+            ++m_State.NumCommands;
+        }
+    }
+    else
+    {
+        for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+        {
+            const auto& Item = Attribs.pDrawItems[i];
+            if (Item.NumVertices > 0)
+            {
+                m_CommandBuffer.Draw(Item.NumVertices, Attribs.NumInstances, Item.StartVertexLocation, Attribs.FirstInstanceLocation);
+                ++m_State.NumCommands;
+            }
+        }
+    }
+}
+
+void DeviceContextVkImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    DvpVerifyMultiDrawIndexedArguments(Attribs);
+    m_Stats.DrawCount += Attribs.DrawCount;
+
+    PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
+
+    if (Attribs.DrawCount == 0 || Attribs.NumInstances == 0)
+        return;
+
+    if (m_pDevice->GetFeatures().NativeMultiDraw)
+    {
+        m_MultiDrawIndexedInfo.resize(Attribs.DrawCount);
+        for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+        {
+            const auto& Item = Attribs.pDrawItems[i];
+
+            m_MultiDrawIndexedInfo[i].firstIndex   = Item.FirstIndexLocation;
+            m_MultiDrawIndexedInfo[i].indexCount   = Item.NumIndices;
+            m_MultiDrawIndexedInfo[i].vertexOffset = static_cast<int32_t>(Item.BaseVertex);
+        }
+
+        const auto MaxMultiDrawCount = m_pDevice->GetPhysicalDevice().GetExtProperties().MultiDraw.maxMultiDrawCount;
+        VERIFY_EXPR(MaxMultiDrawCount > 0);
+        for (Uint32 FirstDraw = 0; FirstDraw < Attribs.DrawCount; FirstDraw += MaxMultiDrawCount)
+        {
+            const auto DrawCount = std::min(Attribs.DrawCount - FirstDraw, MaxMultiDrawCount);
+            m_CommandBuffer.DrawMultiIndexed(DrawCount, &m_MultiDrawIndexedInfo[FirstDraw], Attribs.NumInstances, Attribs.FirstInstanceLocation);
+            ++m_State.NumCommands;
+        }
+    }
+    else
+    {
+        for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+        {
+            const auto& Item = Attribs.pDrawItems[i];
+            if (Item.NumIndices > 0)
+            {
+                m_CommandBuffer.DrawIndexed(Item.NumIndices, Attribs.NumInstances, Item.FirstIndexLocation, Item.BaseVertex, Attribs.FirstInstanceLocation);
+                ++m_State.NumCommands;
+            }
+        }
+    }
+}
+
 void DeviceContextVkImpl::DrawIndirect(const DrawIndirectAttribs& Attribs)
 {
     DvpVerifyDrawIndirectArguments(Attribs);
+    ++m_Stats.DrawCount;
 
     // We must prepare indirect draw attribs buffer first because state transitions must
     // be performed outside of render pass, and PrepareForDraw commits render pass
@@ -847,6 +993,7 @@ void DeviceContextVkImpl::DrawIndirect(const DrawIndirectAttribs& Attribs)
 void DeviceContextVkImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs)
 {
     DvpVerifyDrawIndexedIndirectArguments(Attribs);
+    ++m_Stats.DrawCount;
 
     // We must prepare indirect draw attribs buffer first because state transitions must
     // be performed outside of render pass, and PrepareForDraw commits render pass
@@ -882,6 +1029,7 @@ void DeviceContextVkImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs&
 void DeviceContextVkImpl::DrawMesh(const DrawMeshAttribs& Attribs)
 {
     DvpVerifyDrawMeshArguments(Attribs);
+    ++m_Stats.DrawCount;
 
     PrepareForDraw(Attribs.Flags);
 
@@ -895,6 +1043,7 @@ void DeviceContextVkImpl::DrawMesh(const DrawMeshAttribs& Attribs)
 void DeviceContextVkImpl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attribs)
 {
     DvpVerifyDrawMeshIndirectArguments(Attribs);
+    ++m_Stats.DrawCount;
 
     // We must prepare indirect draw attribs buffer first because state transitions must
     // be performed outside of render pass, and PrepareForDraw commits render pass
@@ -933,7 +1082,7 @@ void DeviceContextVkImpl::PrepareForDispatchCompute()
     EnsureVkCmdBuffer();
 
     // Dispatch commands must be executed outside of render pass
-    if (m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
+    if (m_CommandBuffer.IsInRenderPass())
         m_CommandBuffer.EndRenderPass();
 
     auto& BindInfo = GetBindInfo(PIPELINE_TYPE_COMPUTE);
@@ -967,6 +1116,7 @@ void DeviceContextVkImpl::PrepareForRayTracing()
 void DeviceContextVkImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
 {
     DvpVerifyDispatchArguments(Attribs);
+    ++m_Stats.DispatchCount;
 
     PrepareForDispatchCompute();
 
@@ -980,6 +1130,7 @@ void DeviceContextVkImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
 void DeviceContextVkImpl::DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs)
 {
     DvpVerifyDispatchIndirectArguments(Attribs);
+    ++m_Stats.DispatchCount;
 
     PrepareForDispatchCompute();
 
@@ -1003,11 +1154,19 @@ void DeviceContextVkImpl::GetTileSize(Uint32& TileSizeX, Uint32& TileSizeY)
     TileSizeX = 0;
     TileSizeY = 0;
 
-    if (m_vkRenderPass != VK_NULL_HANDLE)
+    auto vkRenderPass = m_vkRenderPass;
+    if (vkRenderPass == VK_NULL_HANDLE && m_vkRenderingInfo.layerCount != 0)
+    {
+        // Dynamic rendering does not use render passes, so query the granularity
+        // of the compatible implicit render pass.
+        vkRenderPass = m_pDevice->GetImplicitRenderPassCache().GetRenderPass(GetImplicitRenderPassKey())->GetVkRenderPass();
+    }
+
+    if (vkRenderPass != VK_NULL_HANDLE)
     {
         const auto& LogicalDevice = m_pDevice->GetLogicalDevice();
         VkExtent2D  Granularity   = {};
-        vkGetRenderAreaGranularity(LogicalDevice.GetVkDevice(), m_vkRenderPass, &Granularity);
+        vkGetRenderAreaGranularity(LogicalDevice.GetVkDevice(), vkRenderPass, &Granularity);
 
         TileSizeX = Granularity.width;
         TileSizeY = Granularity.height;
@@ -1036,7 +1195,7 @@ void DeviceContextVkImpl::ClearDepthStencil(ITextureView*                  pView
            "checks if the DSV is bound as a framebuffer attachment and triggers an assert otherwise (in development mode).");
     if (ClearAsAttachment)
     {
-        VERIFY_EXPR(m_vkRenderPass != VK_NULL_HANDLE && m_vkFramebuffer != VK_NULL_HANDLE);
+        VERIFY_EXPR(HasBoundFramebuffer());
         if (m_pActiveRenderPass == nullptr)
         {
             // Render pass may not be currently committed
@@ -1068,7 +1227,7 @@ void DeviceContextVkImpl::ClearDepthStencil(ITextureView*                  pView
     else
     {
         // End render pass to clear the buffer with vkCmdClearDepthStencilImage
-        if (m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
+        if (m_CommandBuffer.IsInRenderPass())
             m_CommandBuffer.EndRenderPass();
 
         auto* pTexture   = pVkDSV->GetTexture();
@@ -1154,7 +1313,7 @@ void DeviceContextVkImpl::ClearRenderTarget(ITextureView* pView, const float* RG
 
     if (attachmentIndex != InvalidAttachmentIndex)
     {
-        VERIFY_EXPR(m_vkRenderPass != VK_NULL_HANDLE && m_vkFramebuffer != VK_NULL_HANDLE);
+        VERIFY_EXPR(HasBoundFramebuffer());
         if (m_pActiveRenderPass == nullptr)
         {
             // Render pass may not be currently committed
@@ -1188,7 +1347,7 @@ void DeviceContextVkImpl::ClearRenderTarget(ITextureView* pView, const float* RG
         VERIFY(m_pActiveRenderPass == nullptr, "This branch should never execute inside a render pass.");
 
         // End current render pass and clear the image with vkCmdClearColorImage
-        if (m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
+        if (m_CommandBuffer.IsInRenderPass())
             m_CommandBuffer.EndRenderPass();
 
         auto* pTexture   = pVkRTV->GetTexture();
@@ -1279,6 +1438,9 @@ void DeviceContextVkImpl::FinishFrame()
     // be destroyed before the pools are actually returned to the global pool manager.
     m_DynamicDescrSetAllocator.ReleasePools(QueueMask);
 
+    // Memory of released transient textures is not tracked anymore
+    m_TransientMemoryOwners.clear();
+
     EndFrame();
 }
 
@@ -1318,7 +1480,7 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
 
         if (m_State.NumCommands != 0)
         {
-            if (m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
+            if (m_CommandBuffer.IsInRenderPass())
             {
                 m_CommandBuffer.EndRenderPass();
             }
@@ -1430,6 +1592,7 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
 
     // Submit command buffer even if there are no commands to release stale resources.
     auto SubmittedFenceValue = m_pDevice->ExecuteCommandBuffer(GetCommandQueueId(), SubmitInfo, &m_SignalFences);
+    ++m_Stats.FlushCount;
 
     // Recycle semaphores
     {
@@ -1507,10 +1670,11 @@ void DeviceContextVkImpl::InvalidateState()
     TDeviceContextBase::InvalidateState();
     m_State         = {};
     m_BindInfo      = {};
-    m_vkRenderPass  = VK_NULL_HANDLE;
-    m_vkFramebuffer = VK_NULL_HANDLE;
+    m_vkRenderPass    = VK_NULL_HANDLE;
+    m_vkFramebuffer   = VK_NULL_HANDLE;
+    m_vkRenderingInfo = {};
 
-    VERIFY(m_CommandBuffer.GetState().RenderPass == VK_NULL_HANDLE, "Invalidating context with unfinished render pass");
+    VERIFY(!m_CommandBuffer.IsInRenderPass(), "Invalidating context with unfinished render pass");
     m_CommandBuffer.Reset();
 }
 
@@ -1656,9 +1820,29 @@ void DeviceContextVkImpl::CommitRenderPassAndFramebuffer(bool VerifyStates)
     VERIFY(m_pActiveRenderPass == nullptr, "This method must not be called inside an active render pass.");
 
     const auto& CmdBufferState = m_CommandBuffer.GetState();
-    if (CmdBufferState.Framebuffer != m_vkFramebuffer)
+    if (m_vkRenderingInfo.layerCount != 0)
     {
-        if (CmdBufferState.RenderPass != VK_NULL_HANDLE)
+        VERIFY_EXPR(m_vkFramebuffer == VK_NULL_HANDLE);
+        // Dynamic rendering is ended whenever render targets change, so if it is
+        // active, it always matches the bound render targets.
+        if (!CmdBufferState.DynamicRendering)
+        {
+            if (m_CommandBuffer.IsInRenderPass())
+                m_CommandBuffer.EndRenderPass();
+
+#ifdef DILIGENT_DEVELOPMENT
+            if (VerifyStates)
+            {
+                TransitionRenderTargets(RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+            }
+#endif
+            m_CommandBuffer.BeginRendering(m_vkRenderingInfo);
+            ++m_Stats.RenderPassCount;
+        }
+    }
+    else if (CmdBufferState.Framebuffer != m_vkFramebuffer)
+    {
+        if (m_CommandBuffer.IsInRenderPass())
             m_CommandBuffer.EndRenderPass();
 
         if (m_vkFramebuffer != VK_NULL_HANDLE)
@@ -1671,28 +1855,26 @@ void DeviceContextVkImpl::CommitRenderPassAndFramebuffer(bool VerifyStates)
             }
 #endif
             m_CommandBuffer.BeginRenderPass(m_vkRenderPass, m_vkFramebuffer, m_FramebufferWidth, m_FramebufferHeight);
+            // Explicit render passes are counted by DeviceContextBase::BeginRenderPass()
+            ++m_Stats.RenderPassCount;
         }
     }
 }
 
-void DeviceContextVkImpl::ChooseRenderPassAndFramebuffer()
+RenderPassCache::RenderPassCacheKey DeviceContextVkImpl::GetImplicitRenderPassKey() const
 {
-    FramebufferCache::FramebufferCacheKey FBKey;
-    RenderPassCache::RenderPassCacheKey   RenderPassKey;
+    RenderPassCache::RenderPassCacheKey RenderPassKey;
     if (m_pBoundDepthStencil)
     {
         auto* pDepthBuffer        = m_pBoundDepthStencil->GetTexture();
-        FBKey.DSV                 = m_pBoundDepthStencil->GetVulkanImageView();
         RenderPassKey.DSVFormat   = m_pBoundDepthStencil->GetDesc().Format;
         RenderPassKey.SampleCount = static_cast<Uint8>(pDepthBuffer->GetDesc().SampleCount);
     }
     else
     {
-        FBKey.DSV               = VK_NULL_HANDLE;
         RenderPassKey.DSVFormat = TEX_FORMAT_UNKNOWN;
     }
 
-    FBKey.NumRenderTargets         = m_NumBoundRenderTargets;
     RenderPassKey.NumRenderTargets = static_cast<Uint8>(m_NumBoundRenderTargets);
 
     for (Uint32 rt = 0; rt < m_NumBoundRenderTargets; ++rt)
@@ -1700,7 +1882,6 @@ void DeviceContextVkImpl::ChooseRenderPassAndFramebuffer()
         if (auto* pRTVVk = m_pBoundRenderTargets[rt].RawPtr())
         {
             auto* pRenderTarget          = pRTVVk->GetTexture();
-            FBKey.RTVs[rt]               = pRTVVk->GetVulkanImageView();
             RenderPassKey.RTVFormats[rt] = pRenderTarget->GetDesc().Format;
             if (RenderPassKey.SampleCount == 0)
                 RenderPassKey.SampleCount = static_cast<Uint8>(pRenderTarget->GetDesc().SampleCount);
@@ -1709,26 +1890,101 @@ void DeviceContextVkImpl::ChooseRenderPassAndFramebuffer()
         }
         else
         {
-            FBKey.RTVs[rt]               = VK_NULL_HANDLE;
             RenderPassKey.RTVFormats[rt] = TEX_FORMAT_UNKNOWN;
         }
     }
 
-    if (m_pBoundShadingRateMap)
+    RenderPassKey.EnableVRS = m_pBoundShadingRateMap != nullptr;
+
+    return RenderPassKey;
+}
+
+void DeviceContextVkImpl::PrepareDynamicRenderingInfo()
+{
+    VERIFY_EXPR(m_DynamicRenderingEnabled && !m_pBoundShadingRateMap);
+
+    // Attachment layouts must match the layouts set by TransitionRenderTargets().
+    // Attachments are always loaded and stored, same as in implicit render passes (see RenderPassCache).
+    for (Uint32 rt = 0; rt < m_NumBoundRenderTargets; ++rt)
     {
-        FBKey.ShadingRate       = m_pBoundShadingRateMap.RawPtr<TextureViewVkImpl>()->GetVulkanImageView();
-        RenderPassKey.EnableVRS = true;
+        auto& ColorAttachment = m_vkColorAttachments[rt];
+
+        ColorAttachment.sType              = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+        ColorAttachment.pNext              = nullptr;
+        ColorAttachment.imageView          = m_pBoundRenderTargets[rt] ? m_pBoundRenderTargets[rt]->GetVulkanImageView() : VK_NULL_HANDLE; // Writes to null attachments are discarded
+        ColorAttachment.imageLayout        = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        ColorAttachment.resolveMode        = VK_RESOLVE_MODE_NONE;
+        ColorAttachment.resolveImageView   = VK_NULL_HANDLE;
+        ColorAttachment.resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        ColorAttachment.loadOp             = VK_ATTACHMENT_LOAD_OP_LOAD;
+        ColorAttachment.storeOp            = VK_ATTACHMENT_STORE_OP_STORE;
+        ColorAttachment.clearValue         = {};
     }
-    else
+
+    bool HasStencil = false;
+    if (m_pBoundDepthStencil)
+    {
+        m_vkDepthAttachment.sType              = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+        m_vkDepthAttachment.pNext              = nullptr;
+        m_vkDepthAttachment.imageView          = m_pBoundDepthStencil->GetVulkanImageView();
+        m_vkDepthAttachment.imageLayout        = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+        m_vkDepthAttachment.resolveMode        = VK_RESOLVE_MODE_NONE;
+        m_vkDepthAttachment.resolveImageView   = VK_NULL_HANDLE;
+        m_vkDepthAttachment.resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        m_vkDepthAttachment.loadOp             = VK_ATTACHMENT_LOAD_OP_LOAD;
+        m_vkDepthAttachment.storeOp            = VK_ATTACHMENT_STORE_OP_STORE;
+        m_vkDepthAttachment.clearValue         = {};
+
+        // Stencil attachment must be null if the format does not have a stencil component
+        HasStencil = GetTextureFormatAttribs(m_pBoundDepthStencil->GetDesc().Format).ComponentType == COMPONENT_TYPE_DEPTH_STENCIL;
+        if (HasStencil)
+            m_vkStencilAttachment = m_vkDepthAttachment;
+    }
+
+    m_vkRenderingInfo.sType                = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR;
+    m_vkRenderingInfo.pNext                = nullptr;
+    m_vkRenderingInfo.flags                = 0;
+    m_vkRenderingInfo.renderArea           = {{0, 0}, {m_FramebufferWidth, m_FramebufferHeight}};
+    m_vkRenderingInfo.layerCount           = std::max(m_FramebufferSlices, 1u);
+    m_vkRenderingInfo.viewMask             = 0;
+    m_vkRenderingInfo.colorAttachmentCount = m_NumBoundRenderTargets;
+    m_vkRenderingInfo.pColorAttachments    = m_NumBoundRenderTargets > 0 ? m_vkColorAttachments.data() : nullptr;
+    m_vkRenderingInfo.pDepthAttachment     = m_pBoundDepthStencil ? &m_vkDepthAttachment : nullptr;
+    m_vkRenderingInfo.pStencilAttachment   = HasStencil ? &m_vkStencilAttachment : nullptr;
+}
+
+void DeviceContextVkImpl::ChooseRenderPassAndFramebuffer()
+{
+    // Rendering that uses previous render targets must be ended before
+    // the new render targets are transitioned to the required states.
+    if (m_CommandBuffer.GetVkCmdBuffer() != VK_NULL_HANDLE && m_CommandBuffer.GetState().DynamicRendering)
+        m_CommandBuffer.EndRenderPass();
+
+    // Shading rate attachments are only supported by implicit render passes
+    if (m_DynamicRenderingEnabled && !m_pBoundShadingRateMap)
+    {
+        m_vkRenderPass  = VK_NULL_HANDLE;
+        m_vkFramebuffer = VK_NULL_HANDLE;
+        PrepareDynamicRenderingInfo();
+        return;
+    }
+
+    m_vkRenderingInfo = {};
+
+    FramebufferCache::FramebufferCacheKey FBKey;
+    FBKey.DSV              = m_pBoundDepthStencil ? m_pBoundDepthStencil->GetVulkanImageView() : VK_NULL_HANDLE;
+    FBKey.NumRenderTargets = m_NumBoundRenderTargets;
+    for (Uint32 rt = 0; rt < m_NumBoundRenderTargets; ++rt)
     {
-        FBKey.ShadingRate       = VK_NULL_HANDLE;
-        RenderPassKey.EnableVRS = false;
+        auto* pRTVVk   = m_pBoundRenderTargets[rt].RawPtr();
+        FBKey.RTVs[rt] = pRTVVk != nullptr ? pRTVVk->GetVulkanImageView() : VK_NULL_HANDLE;
     }
+    FBKey.ShadingRate = m_pBoundShadingRateMap ? m_pBoundShadingRateMap.RawPtr<TextureViewVkImpl>()->GetVulkanImageView() : VK_NULL_HANDLE;
 
     auto& FBCache = m_pDevice->GetFramebufferCache();
     auto& RPCache = m_pDevice->GetImplicitRenderPassCache();
 
-    m_vkRenderPass         = RPCache.GetRenderPass(RenderPassKey)->GetVkRenderPass();
+    m_vkRenderPass         = RPCache.GetRenderPass(GetImplicitRenderPassKey())->GetVkRenderPass();
     FBKey.Pass             = m_vkRenderPass;
     FBKey.CommandQueueMask = ~Uint64{0};
     m_vkFramebuffer        = FBCache.GetFramebuffer(FBKey, m_FramebufferWidth, m_FramebufferHeight, m_FramebufferSlices);
@@ -1756,21 +2012,36 @@ void DeviceContextVkImpl::SetRenderTargetsExt(const SetRenderTargetsAttribs& Att
 void DeviceContextVkImpl::ResetRenderTargets()
 {
     TDeviceContextBase::ResetRenderTargets();
-    m_vkRenderPass  = VK_NULL_HANDLE;
-    m_vkFramebuffer = VK_NULL_HANDLE;
-    if (m_CommandBuffer.GetVkCmdBuffer() != VK_NULL_HANDLE && m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
+    m_vkRenderPass    = VK_NULL_HANDLE;
+    m_vkFramebuffer   = VK_NULL_HANDLE;
+    m_vkRenderingInfo = {};
+    if (m_CommandBuffer.GetVkCmdBuffer() != VK_NULL_HANDLE && m_CommandBuffer.IsInRenderPass())
         m_CommandBuffer.EndRenderPass();
     m_State.ShadingRateIsSet = false;
 }
 
 void DeviceContextVkImpl::BeginRenderPass(const BeginRenderPassAttribs& Attribs)
 {
+    if (m_pDevice->HasAliasedTextures() && Attribs.pRenderPass != nullptr && Attribs.pFramebuffer != nullptr)
+    {
+        // Aliased attachments must take over their memory before the render pass begins, in every
+        // state transition mode. Render pass attachments are expected to be in their initial states.
+        const auto& RPDesc = Attribs.pRenderPass->GetDesc();
+        const auto& FBDesc = Attribs.pFramebuffer->GetDesc();
+        for (Uint32 i = 0; i < std::min(RPDesc.AttachmentCount, FBDesc.AttachmentCount); ++i)
+        {
+            if (auto* pView = FBDesc.ppAttachments[i])
+                AcquireTransientTexture(*ClassPtrCast<TextureVkImpl>(pView->GetTexture()), RPDesc.pAttachments[i].InitialState);
+        }
+    }
+
     TDeviceContextBase::BeginRenderPass(Attribs);
 
     VERIFY_EXPR(m_pActiveRenderPass != nullptr);
     VERIFY_EXPR(m_pBoundFramebuffer != nullptr);
     VERIFY_EXPR(m_vkRenderPass == VK_NULL_HANDLE);
     VERIFY_EXPR(m_vkFramebuffer == VK_NULL_HANDLE);
+    VERIFY_EXPR(m_vkRenderingInfo.layerCount == 0);
 
     m_vkRenderPass  = m_pActiveRenderPass->GetVkRenderPass();
     m_vkFramebuffer = m_pBoundFramebuffer->GetVkFramebuffer();
@@ -1865,6 +2136,7 @@ void DeviceContextVkImpl::UpdateBuffer(IBuffer*                       pBuffer,
     constexpr size_t Alignment = 4;
     // Source buffer offset must be multiple of 4 (18.4)
     auto TmpSpace = m_UploadHeap.Allocate(Size, Alignment);
+    m_Stats.UploadHeapBytes += Size;
     memcpy(TmpSpace.CPUAddress, pData, StaticCast<size_t>(Size));
     UpdateBufferRegion(pBuffVk, Offset, Size, TmpSpace.vkBuffer, TmpSpace.AlignedOffset, StateTransitionMode);
     // The allocation will stay in the upload heap until the end of the frame at which point all upload
@@ -2216,6 +2488,7 @@ void DeviceContextVkImpl::UpdateTextureRegion(const void*                    pSr
         BufferOffsetAlignment = std::max(BufferOffsetAlignment, VkDeviceSize{FmtAttribs.ComponentSize});
     }
     auto Allocation = m_UploadHeap.Allocate(CopyInfo.MemorySize, BufferOffsetAlignment);
+    m_Stats.UploadHeapBytes += CopyInfo.MemorySize;
     // The allocation will stay in the upload heap until the end of the frame at which point all upload
     // pages will be discarded
     VERIFY((Allocation.AlignedOffset % BufferOffsetAlignment) == 0, "Allocation offset must be at least 32-bit aligned");
@@ -2528,7 +2801,7 @@ void DeviceContextVkImpl::FinishCommandList(ICommandList** ppCommandList)
     DEV_CHECK_ERR(IsDeferred(), "Only deferred context can record command list");
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Finishing command list inside an active render pass.");
 
-    if (m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
+    if (m_CommandBuffer.IsInRenderPass())
     {
         m_CommandBuffer.EndRenderPass();
     }
@@ -2563,6 +2836,9 @@ void DeviceContextVkImpl::ExecuteCommandLists(Uint32               NumCommandLis
     Flush(NumCommandLists, ppCommandLists);
 
     InvalidateState();
+
+    // Command lists may have used transient textures
+    m_TransientMemoryOwners.clear();
 }
 
 void DeviceContextVkImpl::EnqueueSignal(IFence* pFence, Uint64 Value)
@@ -2662,12 +2938,12 @@ void DeviceContextVkImpl::EndQuery(IQuery* pQuery)
                "No query flag is set which indicates there was no matching BeginQuery call or there was an error while beginning the query.");
         if (CmdBuffState.OutsidePassQueries & (1 << QueryType))
         {
-            if (m_CommandBuffer.GetState().RenderPass)
+            if (m_CommandBuffer.IsInRenderPass())
                 m_CommandBuffer.EndRenderPass();
         }
         else
         {
-            if (!m_CommandBuffer.GetState().RenderPass)
+            if (!m_CommandBuffer.IsInRenderPass())
                 LOG_ERROR_MESSAGE("The query was started inside render pass, but is being ended outside of render pass. "
                                   "Vulkan requires that a query must either begin and end inside the same "
                                   "subpass of a render pass instance, or must both begin and end outside of a render pass "
@@ -2744,6 +3020,9 @@ void DeviceContextVkImpl::TransitionTextureState(TextureVkImpl&           Textur
 
     EnsureVkCmdBuffer();
 
+    if (TextureVk.IsAliased() && AcquireTransientMemory(TextureVk))
+        Flags |= STATE_TRANSITION_FLAG_DISCARD_CONTENT;
+
     auto vkImg = TextureVk.GetVkImage();
 
     VkImageSubresourceRange FullSubresRange;
@@ -2788,6 +3067,7 @@ void DeviceContextVkImpl::TransitionTextureState(TextureVkImpl&           Textur
     if (((OldState & NewState) != NewState) || OldLayout != NewLayout || AfterWrite)
     {
         m_CommandBuffer.TransitionImageLayout(vkImg, OldLayout, NewLayout, *pSubresRange, OldStages, NewStages);
+        ++m_Stats.BarrierCount;
         if ((Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) != 0)
         {
             TextureVk.SetState(NewState);
@@ -2796,12 +3076,61 @@ void DeviceContextVkImpl::TransitionTextureState(TextureVkImpl&           Textur
     }
 }
 
+bool DeviceContextVkImpl::AcquireTransientMemory(TextureVkImpl& TextureVk)
+{
+    VERIFY_EXPR(TextureVk.IsAliased());
+    const auto* pMemory = TextureVk.GetTransientMemory();
+    if (!pMemory->Acquire(TextureVk.GetTransientIndex(), m_TransientMemoryOwners[pMemory->GetUniqueID()]))
+        return false;
+
+    if (m_pActiveRenderPass != nullptr)
+    {
+        LOG_ERROR_MESSAGE("Transient texture '", TextureVk.GetDesc().Name, "' shares memory with another texture that may have been used ",
+                          "since this texture was last used, and can't take over the memory inside an active render pass. ",
+                          "Use the texture before the render pass begins, e.g. bind its shader resource binding or transition its state.");
+        return false;
+    }
+
+    EnsureVkCmdBuffer();
+
+    // Another transient texture may have used the memory of this texture. Wait for all accesses
+    // to the shared memory; the contents of this texture are now undefined.
+    VkPipelineStageFlags vkSrcStages     = 0;
+    VkAccessFlags        vkSrcAccessMask = 0;
+    GetAllowedStagesAndAccessMask(pMemory->GetBindFlags(), vkSrcStages, vkSrcAccessMask);
+
+    VkPipelineStageFlags vkDstStages     = 0;
+    VkAccessFlags        vkDstAccessMask = 0;
+    GetAllowedStagesAndAccessMask(TextureVk.GetDesc().BindFlags, vkDstStages, vkDstAccessMask);
+
+    m_CommandBuffer.MemoryBarrier(vkSrcAccessMask, vkDstAccessMask, vkSrcStages, vkDstStages);
+    ++m_Stats.BarrierCount;
+
+    return true;
+}
+
+void DeviceContextVkImpl::AcquireTransientTexture(TextureVkImpl& TextureVk, RESOURCE_STATE RequiredState)
+{
+    if (!TextureVk.IsAliased() || !AcquireTransientMemory(TextureVk))
+        return;
+
+    // The texture layout is undefined after another texture has used the memory. If the state of the texture
+    // is not tracked, the application is responsible for the state and the texture is expected to be in RequiredState.
+    const auto IsInKnownState = TextureVk.IsInKnownState();
+    const auto OldState       = IsInKnownState ? TextureVk.GetState() : RequiredState;
+    TransitionTextureState(TextureVk, OldState, RequiredState,
+                           STATE_TRANSITION_FLAG_DISCARD_CONTENT | (IsInKnownState ? STATE_TRANSITION_FLAG_UPDATE_STATE : STATE_TRANSITION_FLAG_NONE));
+}
+
 void DeviceContextVkImpl::TransitionOrVerifyTextureState(TextureVkImpl&                 Texture,
                                                          RESOURCE_STATE_TRANSITION_MODE TransitionMode,
                                                          RESOURCE_STATE                 RequiredState,
                                                          VkImageLayout                  ExpectedLayout,
                                                          const char*                    OperationName)
 {
+    // Aliased memory must be acquired whether or not the context manages the texture state
+    AcquireTransientTexture(Texture, RequiredState);
+
     if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
     {
         VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
@@ -2881,6 +3210,7 @@ void DeviceContextVkImpl::TransitionBufferState(BufferVkImpl& BufferVk, RESOURCE
         auto OldStages      = ResourceStateFlagsToVkPipelineStageFlags(OldState);
         auto NewStages      = ResourceStateFlagsToVkPipelineStageFlags(NewState);
         m_CommandBuffer.MemoryBarrier(OldAccessFlags, NewAccessFlags, OldStages, NewStages);
+        ++m_Stats.BarrierCount;
         if (UpdateBufferState)
         {
             BufferVk.SetState(NewState);
@@ -2950,6 +3280,7 @@ void DeviceContextVkImpl::TransitionBLASState(BottomLevelASVkImpl& BLAS,
         auto OldStages      = ResourceStateFlagsToVkPipelineStageFlags(OldState);
         auto NewStages      = ResourceStateFlagsToVkPipelineStageFlags(NewState);
         m_CommandBuffer.MemoryBarrier(OldAccessFlags, NewAccessFlags, OldStages, NewStages);
+        ++m_Stats.BarrierCount;
         if (UpdateInternalState)
         {
             BLAS.SetState(NewState);
@@ -2996,6 +3327,7 @@ void DeviceContextVkImpl::TransitionTLASState(TopLevelASVkImpl& TLAS,
         auto OldStages      = ResourceStateFlagsToVkPipelineStageFlags(OldState);
         auto NewStages      = ResourceStateFlagsToVkPipelineStageFlags(NewState);
         m_CommandBuffer.MemoryBarrier(OldAccessFlags, NewAccessFlags, OldStages, NewStages);
+        ++m_Stats.BarrierCount;
         if (UpdateInternalState)
         {
             TLAS.SetState(NewState);
@@ -3056,6 +3388,7 @@ VulkanDynamicAllocation DeviceContextVkImpl::AllocateDynamicSpace(Uint64 SizeInB
                   "Dynamic allocation size must be less than 2^32");
 
     auto DynAlloc = m_DynamicHeap.Allocate(static_cast<Uint32>(SizeInBytes), Alignment);
+    m_Stats.DynamicHeapBytes += SizeInBytes;
 #ifdef DILIGENT_DEVELOPMENT
     DynAlloc.dvpFrameNumber = GetFrameNumber();
 #endif
@@ -3150,6 +3483,7 @@ void DeviceContextVkImpl::AliasingBarrier(IDeviceObject* pResourceBefore, IDevic
 
     EnsureVkCmdBuffer();
     m_CommandBuffer.MemoryBarrier(vkSrcAccessMask, vkDstAccessMask, vkSrcStages, vkDstStages);
+    ++m_Stats.BarrierCount;
 }
 
 void DeviceContextVkImpl::ResolveTextureSubresource(ITexture*                               pSrcTexture,
@@ -3410,6 +3744,7 @@ void DeviceContextVkImpl::BuildTLAS(const BuildTLASAttribs& Attribs)
     {
         size_t Size     = Attribs.InstanceCount * sizeof(VkAccelerationStructureInstanceKHR);
         auto   TmpSpace = m_UploadHeap.Allocate(Size, 16);
+        m_Stats.UploadHeapBytes += Size;
 
         for (Uint32 i = 0; i < Attribs.InstanceCount; ++i)
         {
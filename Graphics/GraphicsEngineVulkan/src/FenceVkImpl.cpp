@@ -106,6 +106,9 @@ void FenceVkImpl::ImmediatelyReleaseResources()
 
 Uint64 FenceVkImpl::GetCompletedValue()
 {
+    // The fence may be signaled by batched command buffers that have not been submitted yet
+    m_pDevice->SubmitPendingCommandBatches();
+
     if (IsTimelineSemaphore())
     {
         // GetSemaphoreCounter() is thread safe
@@ -190,6 +193,8 @@ void FenceVkImpl::Reset(Uint64 Value)
 
 void FenceVkImpl::Wait(Uint64 Value)
 {
+    m_pDevice->SubmitPendingCommandBatches();
+
     if (IsTimelineSemaphore())
     {
         const auto& LogicalDevice = m_pDevice->GetLogicalDevice();
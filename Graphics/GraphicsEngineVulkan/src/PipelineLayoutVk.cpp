@@ -34,6 +34,7 @@
 
 #include "RenderDeviceVkImpl.hpp"
 #include "PipelineResourceSignatureVkImpl.hpp"
+#include "BindlessHeapVk.hpp"
 
 #include "VulkanTypeConversions.hpp"
 #include "StringTools.hpp"
@@ -41,6 +42,159 @@
 namespace Diligent
 {
 
+namespace
+{
+
+// Descriptor types that have separate update-after-bind limits
+enum DESCR_LIMIT : Uint32
+{
+    DESCR_LIMIT_SAMPLED_IMAGES = 0,
+    DESCR_LIMIT_STORAGE_IMAGES,
+    DESCR_LIMIT_STORAGE_BUFFERS,
+    DESCR_LIMIT_COUNT
+};
+
+DESCR_LIMIT GetDescriptorLimit(VkDescriptorType vkType)
+{
+    switch (vkType)
+    {
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            return DESCR_LIMIT_SAMPLED_IMAGES;
+
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            return DESCR_LIMIT_STORAGE_IMAGES;
+
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            return DESCR_LIMIT_STORAGE_BUFFERS;
+
+        default:
+            return DESCR_LIMIT_COUNT;
+    }
+}
+
+// Returns true if the descriptor counts against maxPerStageUpdateAfterBindResources limit
+bool IsCountedInStageResources(VkDescriptorType vkType)
+{
+    return vkType != VK_DESCRIPTOR_TYPE_SAMPLER && vkType != VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR;
+}
+
+// When a pipeline layout contains an update-after-bind set, the update-after-bind limits apply to all
+// descriptors in the layout. Verifies that the signature sets fit into these limits together with the bindless heap.
+void VerifyBindlessHeapLimits(const RenderDeviceVkImpl&                            DeviceVk,
+                              const BindlessHeapVk&                                Heap,
+                              const RefCntAutoPtr<PipelineResourceSignatureVkImpl> ppSignatures[],
+                              Uint32                                               SignatureCount) noexcept(false)
+{
+    const auto& Props = DeviceVk.GetPhysicalDevice().GetExtProperties().DescriptorIndexing;
+
+    // clang-format off
+    const Uint32 LayoutLimits[DESCR_LIMIT_COUNT] =
+    {
+        Props.maxDescriptorSetUpdateAfterBindSampledImages,
+        Props.maxDescriptorSetUpdateAfterBindStorageImages,
+        Props.maxDescriptorSetUpdateAfterBindStorageBuffers
+    };
+    const Uint32 StageLimits[DESCR_LIMIT_COUNT] =
+    {
+        Props.maxPerStageDescriptorUpdateAfterBindSampledImages,
+        Props.maxPerStageDescriptorUpdateAfterBindStorageImages,
+        Props.maxPerStageDescriptorUpdateAfterBindStorageBuffers
+    };
+    // clang-format on
+    static constexpr const char* LimitNames[DESCR_LIMIT_COUNT] = {"sampled images", "storage images", "storage buffers"};
+
+    // All heap bindings are visible to every shader stage
+    std::array<Uint32, DESCR_LIMIT_COUNT> HeapCounts{};
+    Uint32                                HeapResources = 0;
+    for (Uint32 b = 0; b < BindlessHeapVk::BINDING_COUNT; ++b)
+    {
+        const auto Binding  = static_cast<BindlessHeapVk::BINDING>(b);
+        const auto Capacity = Heap.GetCapacity(Binding);
+        HeapCounts[GetDescriptorLimit(BindlessHeapVk::GetVkDescriptorType(Binding))] += Capacity;
+        HeapResources += Capacity;
+    }
+
+    static constexpr Uint32 NumShaderStages = 16;
+    static_assert(SHADER_TYPE_LAST < (1u << NumShaderStages), "Not enough shader stages");
+
+    struct StageCounts
+    {
+        std::array<Uint32, DESCR_LIMIT_COUNT> Descriptors{};
+        Uint32                                Resources = 0;
+    };
+    std::array<StageCounts, NumShaderStages> PerStageCounts{};
+    std::array<Uint32, DESCR_LIMIT_COUNT>    LayoutCounts{};
+
+    for (Uint32 i = 0; i < SignatureCount; ++i)
+    {
+        const auto& pSignature = ppSignatures[i];
+        if (pSignature == nullptr)
+            continue;
+
+        for (Uint32 r = 0; r < pSignature->GetTotalResourceCount(); ++r)
+        {
+            const auto& ResDesc = pSignature->GetResourceDesc(r);
+            if (PipelineResourceSignatureVkImpl::IsBindlessHeapResource(ResDesc))
+                continue;
+
+            const auto& Attribs   = pSignature->GetResourceAttribs(r);
+            const auto  vkType    = DescriptorTypeToVkDescriptorType(Attribs.GetDescriptorType());
+            const auto  Limit     = GetDescriptorLimit(vkType);
+            const auto  ArraySize = Uint32{Attribs.ArraySize};
+            if (Limit < DESCR_LIMIT_COUNT)
+                LayoutCounts[Limit] += ArraySize;
+
+            for (auto Stages = ResDesc.ShaderStages; Stages != SHADER_TYPE_UNKNOWN;)
+            {
+                auto& Counts = PerStageCounts[ExtractFirstShaderStageIndex(Stages)];
+                if (Limit < DESCR_LIMIT_COUNT)
+                    Counts.Descriptors[Limit] += ArraySize;
+                if (IsCountedInStageResources(vkType))
+                    Counts.Resources += ArraySize;
+            }
+        }
+    }
+
+    for (Uint32 l = 0; l < DESCR_LIMIT_COUNT; ++l)
+    {
+        if (LayoutCounts[l] + HeapCounts[l] > LayoutLimits[l])
+        {
+            LOG_ERROR_AND_THROW("The number of ", LimitNames[l], " in the signature descriptor sets (", LayoutCounts[l],
+                                ") together with the bindless heap (", HeapCounts[l], ") exceeds the update-after-bind device limit (",
+                                LayoutLimits[l], "). Reduce EngineVkCreateInfo::BindlessHeapSize or the number of resources in the signatures.");
+        }
+    }
+
+    for (Uint32 s = 0; s < NumShaderStages; ++s)
+    {
+        const auto& Counts = PerStageCounts[s];
+        for (Uint32 l = 0; l < DESCR_LIMIT_COUNT; ++l)
+        {
+            if (Counts.Descriptors[l] + HeapCounts[l] > StageLimits[l])
+            {
+                LOG_ERROR_AND_THROW("The number of ", LimitNames[l], " accessible to ", GetShaderTypeLiteralName(static_cast<SHADER_TYPE>(1u << s)),
+                                    " in the signature descriptor sets (", Counts.Descriptors[l], ") together with the bindless heap (", HeapCounts[l],
+                                    ") exceeds the per-stage update-after-bind device limit (", StageLimits[l],
+                                    "). Reduce EngineVkCreateInfo::BindlessHeapSize or the number of resources in the signatures.");
+            }
+        }
+
+        if (Counts.Resources + HeapResources > Props.maxPerStageUpdateAfterBindResources)
+        {
+            LOG_ERROR_AND_THROW("The number of resources accessible to ", GetShaderTypeLiteralName(static_cast<SHADER_TYPE>(1u << s)),
+                                " in the signature descriptor sets (", Counts.Resources, ") together with the bindless heap (", HeapResources,
+                                ") exceeds the per-stage update-after-bind device limit (", Props.maxPerStageUpdateAfterBindResources,
+                                "). Reduce EngineVkCreateInfo::BindlessHeapSize or the number of resources in the signatures.");
+        }
+    }
+}
+
+} // namespace
+
 PipelineLayoutVk::PipelineLayoutVk()
 {
     m_FirstDescrSetIndex.fill(std::numeric_limits<FirstDescrSetIndexArrayType::value_type>::max());
@@ -63,11 +217,13 @@ void PipelineLayoutVk::Create(RenderDeviceVkImpl* pDeviceVk, RefCntAutoPtr<Pipel
 {
     VERIFY(m_DescrSetCount == 0 && !m_VkPipelineLayout, "This pipeline layout is already initialized");
 
-    std::array<VkDescriptorSetLayout, MAX_RESOURCE_SIGNATURES * PipelineResourceSignatureVkImpl::MAX_DESCRIPTOR_SETS> DescSetLayouts;
+    // Signature sets and the bindless heap set
+    std::array<VkDescriptorSetLayout, MAX_RESOURCE_SIGNATURES * PipelineResourceSignatureVkImpl::MAX_DESCRIPTOR_SETS + 1> DescSetLayouts;
 
     Uint32 DescSetLayoutCount        = 0;
     Uint32 DynamicUniformBufferCount = 0;
     Uint32 DynamicStorageBufferCount = 0;
+    bool   UsesBindlessHeap          = false;
 
     for (Uint32 i = 0; i < SignatureCount; ++i)
     {
@@ -85,6 +241,8 @@ void PipelineLayoutVk::Create(RenderDeviceVkImpl* pDeviceVk, RefCntAutoPtr<Pipel
                 DescSetLayouts[DescSetLayoutCount++] = pSignature->GetVkDescriptorSetLayout(SetId);
         }
 
+        UsesBindlessHeap = UsesBindlessHeap || pSignature->HasBindlessHeapResources();
+
         DynamicUniformBufferCount += pSignature->GetDynamicUniformBufferCount();
         DynamicStorageBufferCount += pSignature->GetDynamicStorageBufferCount();
 #ifdef DILIGENT_DEBUG
@@ -93,6 +251,17 @@ void PipelineLayoutVk::Create(RenderDeviceVkImpl* pDeviceVk, RefCntAutoPtr<Pipel
     }
     VERIFY_EXPR(DescSetLayoutCount <= MAX_RESOURCE_SIGNATURES * 2);
 
+    if (UsesBindlessHeap)
+    {
+        // Signatures can't be created with bindless heap resources when the heap is disabled
+        const auto* pBindlessHeap = pDeviceVk->GetBindlessHeap();
+        VERIFY_EXPR(pBindlessHeap != nullptr);
+        m_BindlessHeapSetIndex               = static_cast<Uint8>(DescSetLayoutCount);
+        DescSetLayouts[DescSetLayoutCount++] = pBindlessHeap->GetVkDescriptorSetLayout();
+
+        VerifyBindlessHeapLimits(*pDeviceVk, *pBindlessHeap, ppSignatures, SignatureCount);
+    }
+
     const auto& Limits = pDeviceVk->GetPhysicalDevice().GetProperties().limits;
     if (DescSetLayoutCount > Limits.maxBoundDescriptorSets)
     {
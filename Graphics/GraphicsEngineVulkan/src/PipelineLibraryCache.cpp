@@ -0,0 +1,142 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "PipelineLibraryCache.hpp"
+
+#include <algorithm>
+
+#include "RenderDeviceVkImpl.hpp"
+
+namespace Diligent
+{
+
+void PipelineLibraryCache::LibraryKey::AddString(const char* Str)
+{
+    if (Str == nullptr)
+        Str = "";
+
+    const auto Len = strlen(Str);
+    Add(static_cast<Uint32>(Len));
+
+    const auto StartIdx = m_Data.size();
+    m_Data.resize(StartIdx + (Len + sizeof(Uint32) - 1) / sizeof(Uint32), 0);
+    std::memcpy(&m_Data[StartIdx], Str, Len);
+}
+
+PipelineLibraryCache::PipelineLibraryCache(RenderDeviceVkImpl& DeviceVk) noexcept :
+    m_DeviceVkImpl{DeviceVk}
+{}
+
+PipelineLibraryCache::~PipelineLibraryCache()
+{
+    // Libraries are owned by pipeline states that must all be released by now
+    PurgeExpiredEntries();
+    VERIFY(m_Cache.empty(), "Pipeline library cache is not empty. This indicates that some pipeline states have not been released.");
+
+    if (m_NumHits + m_NumMisses > 0)
+    {
+        LOG_INFO_MESSAGE("Pipeline library cache: ", m_NumMisses, " libraries created, ", m_NumHits, " reused (",
+                         m_NumHits * 100 / (m_NumHits + m_NumMisses), "% hit rate)");
+    }
+}
+
+void PipelineLibraryCache::PurgeExpiredEntries()
+{
+    for (auto it = m_Cache.begin(); it != m_Cache.end();)
+    {
+        if (it->second.expired())
+            it = m_Cache.erase(it);
+        else
+            ++it;
+    }
+}
+
+PipelineLibraryCache::LibraryPtr PipelineLibraryCache::GetLibrary(const LibraryKey&                   Key,
+                                                                  const VkGraphicsPipelineCreateInfo& LibraryCI,
+                                                                  VkPipelineCache                     vkPSOCache,
+                                                                  const char*                         DebugName) noexcept(false)
+{
+    VERIFY_EXPR((LibraryCI.flags & VK_PIPELINE_CREATE_LIBRARY_BIT_KHR) != 0);
+
+    {
+        std::lock_guard<std::mutex> Lock{m_Mutex};
+
+        auto it = m_Cache.find(Key);
+        if (it != m_Cache.end())
+        {
+            if (auto pLibrary = it->second.lock())
+            {
+                ++m_NumHits;
+                return pLibrary;
+            }
+        }
+    }
+
+    // Compile the library without holding the lock so that other threads
+    // can retrieve existing libraries in the meantime.
+    LibraryPtr pNewLibrary = std::make_shared<const VulkanUtilities::PipelineWrapper>(
+        m_DeviceVkImpl.GetLogicalDevice().CreateGraphicsPipeline(LibraryCI, vkPSOCache, DebugName));
+
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+
+    auto& Entry = m_Cache[Key];
+    if (auto pLibrary = Entry.lock())
+    {
+        // Another thread has created the same library while we were compiling ours
+        ++m_NumHits;
+        return pLibrary;
+    }
+
+    ++m_NumMisses;
+    Entry = pNewLibrary;
+
+    if (m_Cache.size() >= m_NextPurgeSize)
+    {
+        PurgeExpiredEntries();
+        m_NextPurgeSize = std::max(m_Cache.size() * 2, size_t{64});
+    }
+
+    return pNewLibrary;
+}
+
+PipelineLibraryCache::Statistics PipelineLibraryCache::GetStatistics()
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+
+    Statistics Stats;
+    for (const auto& it : m_Cache)
+    {
+        if (!it.second.expired())
+            ++Stats.NumLibraries;
+    }
+    Stats.NumCreated = m_NumMisses;
+    Stats.NumReused  = m_NumHits;
+    return Stats;
+}
+
+} // namespace Diligent
@@ -48,7 +48,8 @@ DescriptorType GetDescriptorType(const PipelineResourceDesc& Res)
     VERIFY((Res.Flags & ~GetValidPipelineResourceFlags(Res.ResourceType)) == 0,
            "Invalid resource flags. This error should've been caught by ValidatePipelineResourceSignatureDesc.");
 
-    const bool WithDynamicOffset = (Res.Flags & PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS) == 0;
+    // Bindless heap buffers are never bound with dynamic offsets
+    const bool WithDynamicOffset = (Res.Flags & (PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS | PIPELINE_RESOURCE_FLAG_BINDLESS_HEAP)) == 0;
     const bool CombinedSampler   = (Res.Flags & PIPELINE_RESOURCE_FLAG_COMBINED_SAMPLER) != 0;
     const bool UseTexelBuffer    = (Res.Flags & PIPELINE_RESOURCE_FLAG_FORMATTED_BUFFER) != 0;
     const bool GeneralInputAtt   = (Res.Flags & PIPELINE_RESOURCE_FLAG_GENERAL_INPUT_ATTACHMENT) != 0;
@@ -111,6 +112,125 @@ Uint32 FindImmutableSamplerVk(const PipelineResourceDesc&          Res,
     return FindImmutableSampler(Desc.ImmutableSamplers, Desc.NumImmutableSamplers, Res.ShaderStages, Res.Name, SamplerSuffix);
 }
 
+// Returns the size of a single descriptor in the descriptor update template data
+size_t GetDescriptorDataStride(DescriptorType DescrType)
+{
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (DescrType)
+    {
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+            return sizeof(VkDescriptorBufferInfo);
+
+        case DescriptorType::UniformTexelBuffer:
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+            return sizeof(VkBufferView);
+
+        case DescriptorType::CombinedImageSampler:
+        case DescriptorType::SeparateImage:
+        case DescriptorType::StorageImage:
+        case DescriptorType::InputAttachment:
+        case DescriptorType::InputAttachment_General:
+        case DescriptorType::Sampler:
+            return sizeof(VkDescriptorImageInfo);
+
+        case DescriptorType::AccelerationStructure:
+            return sizeof(VkAccelerationStructureKHR);
+
+        default:
+            UNEXPECTED("Unexpected descriptor type");
+            return 0;
+    }
+}
+
+// Writes the descriptor of the cached resource to pDst in the format expected by the descriptor update template
+void WriteDescriptorData(const ShaderResourceCacheVk::Resource& Res, DescriptorType DescrType, Uint8* pDst)
+{
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (DescrType)
+    {
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:
+            *reinterpret_cast<VkDescriptorBufferInfo*>(pDst) = Res.GetDescriptorWriteInfo<DescriptorType::UniformBuffer>();
+            break;
+
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+            *reinterpret_cast<VkDescriptorBufferInfo*>(pDst) = Res.GetDescriptorWriteInfo<DescriptorType::StorageBuffer>();
+            break;
+
+        case DescriptorType::UniformTexelBuffer:
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+            *reinterpret_cast<VkBufferView*>(pDst) = Res.GetDescriptorWriteInfo<DescriptorType::UniformTexelBuffer>();
+            break;
+
+        case DescriptorType::CombinedImageSampler:
+        case DescriptorType::SeparateImage:
+        case DescriptorType::StorageImage:
+            *reinterpret_cast<VkDescriptorImageInfo*>(pDst) = Res.GetDescriptorWriteInfo<DescriptorType::SeparateImage>();
+            break;
+
+        case DescriptorType::InputAttachment:
+        case DescriptorType::InputAttachment_General:
+            *reinterpret_cast<VkDescriptorImageInfo*>(pDst) = Res.GetDescriptorWriteInfo<DescriptorType::InputAttachment>();
+            break;
+
+        case DescriptorType::Sampler:
+            *reinterpret_cast<VkDescriptorImageInfo*>(pDst) = Res.GetDescriptorWriteInfo<DescriptorType::Sampler>();
+            break;
+
+        case DescriptorType::AccelerationStructure:
+            *reinterpret_cast<VkAccelerationStructureKHR*>(pDst) = *Res.GetDescriptorWriteInfo<DescriptorType::AccelerationStructure>().pAccelerationStructures;
+            break;
+
+        default:
+            UNEXPECTED("Unexpected descriptor type");
+    }
+}
+
+// Makes the descriptor write reference the descriptor data written by WriteDescriptorData()
+void SetDescriptorWriteData(VkWriteDescriptorSet& WriteDescrSet, DescriptorType DescrType, const Uint8* pData)
+{
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (DescrType)
+    {
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+            WriteDescrSet.pBufferInfo = reinterpret_cast<const VkDescriptorBufferInfo*>(pData);
+            break;
+
+        case DescriptorType::UniformTexelBuffer:
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+            WriteDescrSet.pTexelBufferView = reinterpret_cast<const VkBufferView*>(pData);
+            break;
+
+        case DescriptorType::CombinedImageSampler:
+        case DescriptorType::SeparateImage:
+        case DescriptorType::StorageImage:
+        case DescriptorType::InputAttachment:
+        case DescriptorType::InputAttachment_General:
+        case DescriptorType::Sampler:
+            WriteDescrSet.pImageInfo = reinterpret_cast<const VkDescriptorImageInfo*>(pData);
+            break;
+
+        default:
+            UNEXPECTED("Acceleration structures must be written through VkWriteDescriptorSetAccelerationStructureKHR");
+    }
+}
+
 } // namespace
 
 inline PipelineResourceSignatureVkImpl::CACHE_GROUP PipelineResourceSignatureVkImpl::GetResourceCacheGroup(const PipelineResourceDesc& Res)
@@ -194,7 +314,7 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
         for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
         {
             const auto& ResDesc = m_Desc.Resources[i];
-            if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
+            if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC && !IsBindlessHeapResource(ResDesc))
                 StaticResourceCount += ResDesc.ArraySize;
         }
         m_pStaticResCache->InitializeSets(GetRawAllocator(), 1, &StaticResourceCount);
@@ -204,8 +324,15 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
     BindingCountType BindingCount    = {}; // Binding count in each cache group
     for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
     {
-        const auto& ResDesc    = m_Desc.Resources[i];
-        const auto  CacheGroup = GetResourceCacheGroup(ResDesc);
+        const auto& ResDesc = m_Desc.Resources[i];
+        if (IsBindlessHeapResource(ResDesc))
+        {
+            // Bindless heap resources are not stored in the signature descriptor sets
+            m_HasBindlessHeapResources = true;
+            continue;
+        }
+
+        const auto CacheGroup = GetResourceCacheGroup(ResDesc);
 
         BindingCount[CacheGroup] += 1;
         // Note that we may reserve space for separate immutable samplers, which will never be used, but this is OK.
@@ -260,6 +387,12 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
             BindingCount[CACHE_GROUP_DYN_UB_DYN_VAR] + BindingCount[CACHE_GROUP_DYN_SB_DYN_VAR] //
         };
 
+    if (m_HasBindlessHeapResources && HasDevice() && GetDevice()->GetBindlessHeap() == nullptr)
+    {
+        LOG_ERROR_AND_THROW("Pipeline resource signature '", m_Desc.Name,
+                            "' contains bindless heap resources, but the bindless heap is disabled. Set EngineVkCreateInfo::BindlessHeapSize to a non-zero value.");
+    }
+
     // Current offset in the static resource cache
     Uint32 StaticCacheOffset = 0;
 
@@ -278,6 +411,36 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
 
         VERIFY(i == 0 || ResDesc.VarType >= m_Desc.Resources[i - 1].VarType, "Resources must be sorted by variable type");
 
+        if (IsBindlessHeapResource(ResDesc))
+        {
+            // Bindless heap resources only need the binding in the heap descriptor set, which is
+            // bound by the device context after all signature descriptor sets.
+            const auto HeapBinding = BindlessHeapVk::GetBinding(ResDesc);
+
+            auto* const pAttribs = m_pResourceAttribs + i;
+            if (!IsSerialized)
+            {
+                new (pAttribs) ResourceAttribs //
+                    {
+                        HeapBinding,
+                        ResourceAttribs::InvalidSamplerInd,
+                        ResDesc.ArraySize,
+                        DescrType,
+                        0,
+                        false,
+                        ~0u,
+                        ~0u //
+                    };
+            }
+            else
+            {
+                DEV_CHECK_ERR(pAttribs->BindingIndex == HeapBinding,
+                              "Deserialized binding index (", pAttribs->BindingIndex, ") is invalid: ", Uint32{HeapBinding}, " is expected.");
+                DEV_CHECK_ERR(pAttribs->GetDescriptorType() == DescrType, "Deserialized descriptor type in invalid");
+            }
+            continue;
+        }
+
         // If all resources are dynamic, then the signature contains only one descriptor set layout with index 0,
         // so remap SetId to the actual descriptor set index.
         VERIFY_EXPR(DSMapping[SetId] < MAX_DESCRIPTOR_SETS);
@@ -476,6 +639,30 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
     if (HasDevice())
     {
         const auto& LogicalDevice = GetDevice()->GetLogicalDevice();
+        const auto& ExtFeatures   = LogicalDevice.GetEnabledExtFeatures();
+
+        // Small dynamic sets are pushed to the command buffer instead of being allocated and written on every commit.
+        // Only one push descriptor set is allowed in a pipeline layout, so we only use it for the signature
+        // with binding index 0. Push descriptor sets can't contain descriptors with dynamic offsets.
+        if (ExtFeatures.PushDescriptor && m_Desc.BindingIndex == 0 &&
+            DSMapping[DESCRIPTOR_SET_ID_DYNAMIC] < MAX_DESCRIPTOR_SETS &&
+            CacheGroupSizes[CACHE_GROUP_DYN_UB_DYN_VAR] == 0 &&
+            CacheGroupSizes[CACHE_GROUP_DYN_SB_DYN_VAR] == 0)
+        {
+            const auto MaxPushDescriptors = GetDevice()->GetPhysicalDevice().GetExtProperties().PushDescriptor.maxPushDescriptors;
+
+            Uint32 NumDescriptors     = 0;
+            bool   HasAccelStructures = false;
+            for (const auto& vkBinding : vkSetLayoutBindings[DESCRIPTOR_SET_ID_DYNAMIC])
+            {
+                NumDescriptors += vkBinding.descriptorCount;
+                // Acceleration structure writes require VkWriteDescriptorSetAccelerationStructureKHR
+                // in the pNext chain, which is not supported by WriteDynamicDescriptors().
+                if (vkBinding.descriptorType == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR)
+                    HasAccelStructures = true;
+            }
+            m_HasPushDescriptorSet = NumDescriptors <= MaxPushDescriptors && !HasAccelStructures;
+        }
 
         for (size_t i = 0; i < vkSetLayoutBindings.size(); ++i)
         {
@@ -483,12 +670,74 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
             if (vkSetLayoutBinding.empty())
                 continue;
 
+            SetLayoutCI.flags        = (i == DESCRIPTOR_SET_ID_DYNAMIC && m_HasPushDescriptorSet) ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR : 0;
             SetLayoutCI.bindingCount = StaticCast<uint32_t>(vkSetLayoutBinding.size());
             SetLayoutCI.pBindings    = vkSetLayoutBinding.data();
             m_VkDescrSetLayouts[i]   = LogicalDevice.CreateDescriptorSetLayout(SetLayoutCI);
         }
         VERIFY_EXPR(NumSets == GetNumDescriptorSets());
+
+        if (HasDescriptorSet(DESCRIPTOR_SET_ID_STATIC_MUTABLE))
+        {
+            // Descriptor pools are sized from the descriptor counts of the allocated layouts
+            DescriptorTypeCounts LayoutCounts;
+            for (const auto& vkBinding : vkSetLayoutBindings[DESCRIPTOR_SET_ID_STATIC_MUTABLE])
+                LayoutCounts[vkBinding.descriptorType] += vkBinding.descriptorCount;
+            m_StaticMutableSetDescriptorCounts = GetDevice()->GetDescriptorSetAllocator().GetLayoutDescriptorCounts(LayoutCounts);
+        }
+
+        if (HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC))
+        {
+            InitDynamicSetUpdateEntries();
+
+            // Push descriptor update templates require the pipeline layout, so pushed sets use descriptor writes
+            if (ExtFeatures.DescriptorUpdateTemplate && !m_HasPushDescriptorSet && !m_DynamicSetUpdateEntries.empty())
+            {
+                VkDescriptorUpdateTemplateCreateInfo TemplateCI{};
+                TemplateCI.sType                      = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+                TemplateCI.descriptorUpdateEntryCount = StaticCast<uint32_t>(m_DynamicSetUpdateEntries.size());
+                TemplateCI.pDescriptorUpdateEntries   = m_DynamicSetUpdateEntries.data();
+                TemplateCI.templateType               = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+                TemplateCI.descriptorSetLayout        = m_VkDescrSetLayouts[DESCRIPTOR_SET_ID_DYNAMIC];
+                m_DynamicSetUpdateTemplate            = LogicalDevice.CreateDescriptorUpdateTemplate(TemplateCI);
+            }
+        }
+    }
+}
+
+void PipelineResourceSignatureVkImpl::InitDynamicSetUpdateEntries()
+{
+    VERIFY_EXPR(m_DynamicSetUpdateEntries.empty());
+
+    const auto DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+    m_DynamicSetUpdateEntries.reserve(DynResIdxRange.second - DynResIdxRange.first);
+
+    size_t DataSize = 0;
+    for (Uint32 ResIdx = DynResIdxRange.first; ResIdx < DynResIdxRange.second; ++ResIdx)
+    {
+        const auto& Attr      = GetResourceAttribs(ResIdx);
+        const auto  DescrType = Attr.GetDescriptorType();
+
+        // Immutable samplers are permanently bound into the set layout (13.2.1)
+        if (DescrType == DescriptorType::Sampler && Attr.IsImmutableSamplerAssigned())
+            continue;
+
+        if (IsBindlessHeapResource(GetResourceDesc(ResIdx)))
+            continue;
+
+        VkDescriptorUpdateTemplateEntry Entry{};
+        Entry.dstBinding      = Attr.BindingIndex;
+        Entry.dstArrayElement = 0;
+        Entry.descriptorCount = Attr.ArraySize;
+        Entry.descriptorType  = DescriptorTypeToVkDescriptorType(DescrType);
+        Entry.offset          = DataSize;
+        Entry.stride          = GetDescriptorDataStride(DescrType);
+        m_DynamicSetUpdateEntries.push_back(Entry);
+
+        DataSize += Entry.stride * Attr.ArraySize;
     }
+
+    m_DynamicDescriptorDataSize = StaticCast<Uint32>(DataSize);
 }
 
 PipelineResourceSignatureVkImpl::~PipelineResourceSignatureVkImpl()
@@ -504,6 +753,9 @@ void PipelineResourceSignatureVkImpl::Destruct()
             GetDevice()->SafeReleaseDeviceObject(std::move(Layout), ~0ull);
     }
 
+    if (m_DynamicSetUpdateTemplate)
+        GetDevice()->SafeReleaseDeviceObject(std::move(m_DynamicSetUpdateTemplate), ~0ull);
+
     if (m_ImmutableSamplers != nullptr)
     {
         for (Uint32 i = 0; i < m_Desc.NumImmutableSamplers; ++i)
@@ -532,7 +784,10 @@ void PipelineResourceSignatureVkImpl::InitSRBResourceCache(ShaderResourceCacheVk
     for (Uint32 r = 0; r < TotalResources; ++r)
     {
         const auto& ResDesc = GetResourceDesc(r);
-        const auto& Attr    = GetResourceAttribs(r);
+        if (IsBindlessHeapResource(ResDesc))
+            continue;
+
+        const auto& Attr = GetResourceAttribs(r);
         ResourceCache.InitializeResources(Attr.DescrSet, Attr.CacheOffset(CacheType), ResDesc.ArraySize,
                                           Attr.GetDescriptorType(), Attr.IsImmutableSamplerAssigned());
     }
@@ -549,7 +804,7 @@ void PipelineResourceSignatureVkImpl::InitSRBResourceCache(ShaderResourceCacheVk
         _DescrSetName.append(" - static/mutable set");
         DescrSetName = _DescrSetName.c_str();
 #endif
-        DescriptorSetAllocation SetAllocation = GetDevice()->AllocateDescriptorSet(~Uint64{0}, vkLayout, DescrSetName);
+        DescriptorSetAllocation SetAllocation = GetDevice()->AllocateDescriptorSet(~Uint64{0}, vkLayout, m_StaticMutableSetDescriptorCounts, DescrSetName);
         ResourceCache.AssignDescriptorSetAllocation(GetDescriptorSetIndex<DESCRIPTOR_SET_ID_STATIC_MUTABLE>(), std::move(SetAllocation));
     }
 }
@@ -569,6 +824,10 @@ void PipelineResourceSignatureVkImpl::CopyStaticResources(ShaderResourceCacheVk&
     const auto  SrcCacheType     = SrcResourceCache.GetContentType();
     const auto  DstCacheType     = DstResourceCache.GetContentType();
 
+    // Write all static descriptors with a single vkUpdateDescriptorSets call
+    ShaderResourceCacheVk::DescriptorWriteBatch WriteBatch;
+    DstResourceCache.BeginDescriptorWriteBatch(WriteBatch);
+
     for (Uint32 r = ResIdxRange.first; r < ResIdxRange.second; ++r)
     {
         const auto& ResDesc = GetResourceDesc(r);
@@ -578,6 +837,9 @@ void PipelineResourceSignatureVkImpl::CopyStaticResources(ShaderResourceCacheVk&
         if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER && Attr.IsImmutableSamplerAssigned())
             continue; // Skip immutable separate samplers
 
+        if (IsBindlessHeapResource(ResDesc))
+            continue;
+
         for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
         {
             const auto     SrcCacheOffset = Attr.CacheOffset(SrcCacheType) + ArrInd;
@@ -608,6 +870,8 @@ void PipelineResourceSignatureVkImpl::CopyStaticResources(ShaderResourceCacheVk&
         }
     }
 
+    DstResourceCache.EndDescriptorWriteBatch(GetDevice()->GetLogicalDevice());
+
 #ifdef DILIGENT_DEBUG
     DstResourceCache.DbgVerifyDynamicBuffersCounter();
 #endif
@@ -627,13 +891,97 @@ Uint32 PipelineResourceSignatureVkImpl::GetDescriptorSetIndex<PipelineResourceSi
     return HasDescriptorSet(DESCRIPTOR_SET_ID_STATIC_MUTABLE) ? 1 : 0;
 }
 
+bool PipelineResourceSignatureVkImpl::WriteDynamicDescriptors(const ShaderResourceCacheVk&       ResourceCache,
+                                                              Uint8*                             pData,
+                                                              std::vector<VkWriteDescriptorSet>* pWrites) const
+{
+    VERIFY(HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC), "This signature does not contain dynamic resources");
+    VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
+    VERIFY_EXPR(pData != nullptr || m_DynamicDescriptorDataSize == 0);
+
+    const auto& SetResources   = ResourceCache.GetDescriptorSet(GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>());
+    const auto  DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+
+    if (pWrites != nullptr)
+        pWrites->clear();
+
+    bool AllDescriptorsValid = true;
+
+    auto EntryIt = m_DynamicSetUpdateEntries.begin();
+    for (Uint32 ResIdx = DynResIdxRange.first; ResIdx < DynResIdxRange.second; ++ResIdx)
+    {
+        const auto& Attr      = GetResourceAttribs(ResIdx);
+        const auto  DescrType = Attr.GetDescriptorType();
+        if ((DescrType == DescriptorType::Sampler && Attr.IsImmutableSamplerAssigned()) || IsBindlessHeapResource(GetResourceDesc(ResIdx)))
+            continue;
+
+        VERIFY_EXPR(EntryIt != m_DynamicSetUpdateEntries.end() && EntryIt->dstBinding == Attr.BindingIndex);
+        const auto& Entry       = *(EntryIt++);
+        const auto  CacheOffset = Attr.CacheOffset(ResourceCacheContentType::SRB);
+
+        // Index of the descriptor write that the next non-null element can be appended to
+        size_t WriteIdx = ~size_t{0};
+        for (Uint32 ArrElem = 0; ArrElem < Attr.ArraySize; ++ArrElem)
+        {
+            auto* const pDst      = pData + Entry.offset + Entry.stride * ArrElem;
+            const auto& CachedRes = SetResources.GetResource(CacheOffset + ArrElem);
+            if (!CachedRes)
+            {
+                AllDescriptorsValid = false;
+                if (pWrites == nullptr)
+                    return false;
+
+                // We need to use a new VkWriteDescriptorSet since we skipped an array element
+                WriteIdx = ~size_t{0};
+                continue;
+            }
+
+            WriteDescriptorData(CachedRes, DescrType, pDst);
+
+            if (pWrites != nullptr)
+            {
+                if (WriteIdx == ~size_t{0})
+                {
+                    WriteIdx = pWrites->size();
+
+                    VkWriteDescriptorSet WriteDescrSet{};
+                    WriteDescrSet.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+                    WriteDescrSet.dstBinding      = Entry.dstBinding;
+                    WriteDescrSet.dstArrayElement = ArrElem;
+                    WriteDescrSet.descriptorType  = Entry.descriptorType;
+                    SetDescriptorWriteData(WriteDescrSet, DescrType, pDst);
+                    pWrites->push_back(WriteDescrSet);
+                }
+                ++(*pWrites)[WriteIdx].descriptorCount;
+            }
+        }
+    }
+    VERIFY_EXPR(EntryIt == m_DynamicSetUpdateEntries.end());
+
+    return AllDescriptorsValid;
+}
+
 void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
-                                                             VkDescriptorSet              vkDynamicDescriptorSet) const
+                                                             VkDescriptorSet              vkDynamicDescriptorSet,
+                                                             std::vector<Uint8>&          DescriptorData) const
 {
     VERIFY(HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC), "This signature does not contain dynamic resources");
+    VERIFY(!m_HasPushDescriptorSet, "Push descriptor sets can't be allocated");
     VERIFY_EXPR(vkDynamicDescriptorSet != VK_NULL_HANDLE);
     VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
 
+    if (m_DynamicSetUpdateTemplate)
+    {
+        // Write the entire set with a single call
+        DescriptorData.resize(m_DynamicDescriptorDataSize);
+        if (WriteDynamicDescriptors(ResourceCache, DescriptorData.data(), nullptr))
+        {
+            GetDevice()->GetLogicalDevice().UpdateDescriptorSetWithTemplate(vkDynamicDescriptorSet, m_DynamicSetUpdateTemplate, DescriptorData.data());
+            return;
+        }
+        // The template writes all array elements, so null resources require individual descriptor writes below
+    }
+
 #ifdef DILIGENT_DEBUG
     static constexpr size_t ImgUpdateBatchSize          = 4;
     static constexpr size_t BuffUpdateBatchSize         = 2;
@@ -670,6 +1018,13 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
 
     for (Uint32 ResIdx = DynResIdxRange.first, ArrElem = 0; ResIdx < DynResIdxRange.second;)
     {
+        if (IsBindlessHeapResource(GetResourceDesc(ResIdx)))
+        {
+            VERIFY_EXPR(ArrElem == 0);
+            ++ResIdx;
+            continue;
+        }
+
         const auto& Attr        = GetResourceAttribs(ResIdx);
         const auto  CacheOffset = Attr.CacheOffset(CacheType);
         const auto  ArraySize   = Attr.ArraySize;
@@ -830,6 +1185,9 @@ bool PipelineResourceSignatureVkImpl::DvpValidateCommittedResource(const DeviceC
     if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER && ResAttribs.IsImmutableSamplerAssigned())
         return true; // Skip immutable separate samplers
 
+    if (IsBindlessHeapResource(ResDesc))
+        return true; // Bindless heap descriptors are written when views are created
+
     const auto& DescrSetResources = ResourceCache.GetDescriptorSet(ResAttribs.DescrSet);
     const auto  CacheType         = ResourceCache.GetContentType();
     const auto  CacheOffset       = ResAttribs.CacheOffset(CacheType);
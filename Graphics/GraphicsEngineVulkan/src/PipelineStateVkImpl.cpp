@@ -31,6 +31,7 @@
 
 #include <array>
 #include <unordered_map>
+#include <functional>
 
 #include "RenderDeviceVkImpl.hpp"
 #include "DeviceContextVkImpl.hpp"
@@ -157,6 +158,9 @@ void CreateComputePipeline(RenderDeviceVkImpl*                           pDevice
 }
 
 
+// Creates the pipeline from the fully initialized create info instead of vkCreateGraphicsPipelines
+using CreatePipelineFromLibrariesType = std::function<VulkanUtilities::PipelineWrapper(const VkGraphicsPipelineCreateInfo&)>;
+
 void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDeviceVk,
                             std::vector<VkPipelineShaderStageCreateInfo>& Stages,
                             const PipelineLayoutVk&                       Layout,
@@ -164,14 +168,24 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
                             const GraphicsPipelineDesc&                   GraphicsPipeline,
                             VulkanUtilities::PipelineWrapper&             Pipeline,
                             RefCntAutoPtr<IRenderPass>&                   pRenderPass,
-                            VkPipelineCache                               vkPSOCache)
+                            VkPipelineCache                               vkPSOCache,
+                            const CreatePipelineFromLibrariesType&        CreatePipelineFromLibraries)
 {
     const auto& LogicalDevice  = pDeviceVk->GetLogicalDevice();
     const auto& PhysicalDevice = pDeviceVk->GetPhysicalDevice();
     auto&       RPCache        = pDeviceVk->GetImplicitRenderPassCache();
 
+    // Pipelines that use implicit render passes are created for dynamic rendering if it is enabled.
+    // Shading rate textures are only supported by implicit render passes, which the context
+    // uses when a shading rate map is bound (see DeviceContextVkImpl::ChooseRenderPassAndFramebuffer).
+    const bool UseDynamicRendering =
+        pRenderPass == nullptr &&
+        LogicalDevice.GetEnabledExtFeatures().DynamicRendering.dynamicRendering != VK_FALSE &&
+        (GraphicsPipeline.ShadingRateFlags & PIPELINE_SHADING_RATE_FLAG_TEXTURE_BASED) == 0;
+
     if (pRenderPass == nullptr)
     {
+        // The implicit render pass is still required by IPipelineState::GetRenderPass() even if dynamic rendering is used
         RenderPassCache::RenderPassCacheKey Key{
             GraphicsPipeline.NumRenderTargets,
             GraphicsPipeline.SmplDesc.Count,
@@ -346,12 +360,76 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
     PipelineCI.pDynamicState         = &DynamicStateCI;
 
 
-    PipelineCI.renderPass         = pRenderPass.RawPtr<IRenderPassVk>()->GetVkRenderPass();
-    PipelineCI.subpass            = GraphicsPipeline.SubpassIndex;
+    std::array<VkFormat, MAX_RENDER_TARGETS> ColorAttachmentFormats = {};
+    VkPipelineRenderingCreateInfoKHR         RenderingCI{};
+    if (UseDynamicRendering)
+    {
+        for (Uint32 rt = 0; rt < GraphicsPipeline.NumRenderTargets; ++rt)
+            ColorAttachmentFormats[rt] = TexFormatToVkFormat(GraphicsPipeline.RTVFormats[rt]);
+
+        const auto& DSVFmtAttribs = GetTextureFormatAttribs(GraphicsPipeline.DSVFormat);
+
+        RenderingCI.sType                   = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+        RenderingCI.pNext                   = nullptr;
+        RenderingCI.viewMask                = 0;
+        RenderingCI.colorAttachmentCount    = GraphicsPipeline.NumRenderTargets;
+        RenderingCI.pColorAttachmentFormats = GraphicsPipeline.NumRenderTargets > 0 ? ColorAttachmentFormats.data() : nullptr;
+        RenderingCI.depthAttachmentFormat   = TexFormatToVkFormat(GraphicsPipeline.DSVFormat);
+        RenderingCI.stencilAttachmentFormat = DSVFmtAttribs.ComponentType == COMPONENT_TYPE_DEPTH_STENCIL ?
+            TexFormatToVkFormat(GraphicsPipeline.DSVFormat) :
+            VK_FORMAT_UNDEFINED;
+
+        // The pipeline may be used with any render targets of matching formats
+        // set by IDeviceContext::SetRenderTargets() without a render pass object.
+        PipelineCI.pNext      = &RenderingCI;
+        PipelineCI.renderPass = VK_NULL_HANDLE;
+        PipelineCI.subpass    = 0;
+    }
+    else
+    {
+        PipelineCI.renderPass = pRenderPass.RawPtr<IRenderPassVk>()->GetVkRenderPass();
+        PipelineCI.subpass    = GraphicsPipeline.SubpassIndex;
+    }
     PipelineCI.basePipelineHandle = VK_NULL_HANDLE; // a pipeline to derive from
     PipelineCI.basePipelineIndex  = -1;             // an index into the pCreateInfos parameter to use as a pipeline to derive from
 
-    Pipeline = LogicalDevice.CreateGraphicsPipeline(PipelineCI, vkPSOCache, PSODesc.Name);
+    if (CreatePipelineFromLibraries)
+        Pipeline = CreatePipelineFromLibraries(PipelineCI);
+    else
+        Pipeline = LogicalDevice.CreateGraphicsPipeline(PipelineCI, vkPSOCache, PSODesc.Name);
+}
+
+
+VulkanUtilities::PipelineWrapper LinkGraphicsPipelineLibraries(const VulkanUtilities::VulkanLogicalDevice&            LogicalDevice,
+                                                               const std::array<PipelineLibraryCache::LibraryPtr, 4>& Libraries,
+                                                               VkPipelineLayout                                       vkLayout,
+                                                               bool                                                   Optimize,
+                                                               VkPipelineCache                                        vkPSOCache,
+                                                               const char*                                            Name)
+{
+    std::array<VkPipeline, 4> vkLibraries{};
+    for (size_t i = 0; i < Libraries.size(); ++i)
+    {
+        VERIFY_EXPR(Libraries[i]);
+        vkLibraries[i] = *Libraries[i];
+    }
+
+    VkPipelineLibraryCreateInfoKHR LibraryCI{};
+    LibraryCI.sType        = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+    LibraryCI.pNext        = nullptr;
+    LibraryCI.libraryCount = static_cast<uint32_t>(vkLibraries.size());
+    LibraryCI.pLibraries   = vkLibraries.data();
+
+    VkGraphicsPipelineCreateInfo PipelineCI{};
+    PipelineCI.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    PipelineCI.pNext = &LibraryCI;
+    // Without link-time optimizations, linking is expected to be very fast (graphicsPipelineLibraryFastLinking)
+    PipelineCI.flags              = Optimize ? VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT : 0;
+    PipelineCI.layout             = vkLayout;
+    PipelineCI.basePipelineHandle = VK_NULL_HANDLE;
+    PipelineCI.basePipelineIndex  = -1;
+
+    return LogicalDevice.CreateGraphicsPipeline(PipelineCI, vkPSOCache, Name);
 }
 
 
@@ -654,6 +732,14 @@ void PipelineStateVkImpl::RemapOrVerifyShaderResources(
     TShaderResources*                                    pDvpShaderResources,
     TResourceAttibutions*                                pDvpResourceAttibutions) noexcept(false)
 {
+    // The bindless heap set follows the descriptor sets of all signatures (see PipelineLayoutVk::Create)
+    Uint32 BindlessHeapSetIndex = 0;
+    for (Uint32 i = 0; i < SignatureCount; ++i)
+    {
+        if (const auto& pSignature = pSignatures[i])
+            BindlessHeapSetIndex += pSignature->GetNumDescriptorSets();
+    }
+
     // Verify that pipeline layout is compatible with shader resources and
     // remap resource bindings.
     for (size_t s = 0; s < ShaderStages.size(); ++s)
@@ -692,6 +778,7 @@ void PipelineStateVkImpl::RemapOrVerifyShaderResources(
 
                     Uint32 ResourceBinding = ~0u;
                     Uint32 DescriptorSet   = ~0u;
+                    bool   IsHeapResource  = false;
                     if (ResAttribution.ResourceIndex != ResourceAttribution::InvalidResourceIndex)
                     {
                         const auto& ResDesc = ResAttribution.pSignature->GetResourceDesc(ResAttribution.ResourceIndex);
@@ -701,6 +788,10 @@ void PipelineStateVkImpl::RemapOrVerifyShaderResources(
                         const auto& ResAttribs{ResAttribution.pSignature->GetResourceAttribs(ResAttribution.ResourceIndex)};
                         ResourceBinding = ResAttribs.BindingIndex;
                         DescriptorSet   = ResAttribs.DescrSet;
+
+                        // Heap resources are not allocated in the signature sets; the binding index
+                        // of their attribs is the binding in the heap set.
+                        IsHeapResource = PipelineResourceSignatureVkImpl::IsBindlessHeapResource(ResDesc);
                     }
                     else if (ResAttribution.ImmutableSamplerIndex != ResourceAttribution::InvalidResourceIndex)
                     {
@@ -721,7 +812,10 @@ void PipelineStateVkImpl::RemapOrVerifyShaderResources(
                     }
 
                     VERIFY_EXPR(ResourceBinding != ~0u && DescriptorSet != ~0u);
-                    DescriptorSet += BindIndexToDescSetIndex[SignDesc.BindingIndex];
+                    if (IsHeapResource)
+                        DescriptorSet = BindlessHeapSetIndex;
+                    else
+                        DescriptorSet += BindIndexToDescSetIndex[SignDesc.BindingIndex];
                     if (bVerifyOnly)
                     {
                         const auto SpvBinding  = SPIRV[SPIRVAttribs.BindingDecorationOffset];
@@ -830,18 +924,396 @@ PipelineStateVkImpl::TShaderStages PipelineStateVkImpl::InitInternalObjects(
     return ShaderStages;
 }
 
+VulkanUtilities::PipelineWrapper PipelineStateVkImpl::CreateGraphicsPipelineFromLibraries(const VkGraphicsPipelineCreateInfo& PipelineCI,
+                                                                                          const TShaderStages&                ShaderStages,
+                                                                                          VkPipelineCache                     vkPSOCache,
+                                                                                          bool&                               NeedsOptimizedLink) noexcept(false)
+{
+    auto* const pDeviceVk     = GetDevice();
+    const auto& LogicalDevice = pDeviceVk->GetLogicalDevice();
+    auto&       LibraryCache  = pDeviceVk->GetPipelineLibraryCache();
+
+    using LibraryKey = PipelineLibraryCache::LibraryKey;
+
+    // If the pipeline is created for dynamic rendering, VkPipelineRenderingCreateInfoKHR is the only structure in the chain
+    const auto* pRenderingCI = PipelineCI.renderPass == VK_NULL_HANDLE ? static_cast<const VkPipelineRenderingCreateInfoKHR*>(PipelineCI.pNext) : nullptr;
+    VERIFY_EXPR(pRenderingCI == nullptr || pRenderingCI->sType == VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR);
+
+    const VkPipelineCreateFlags LibraryFlags =
+        PipelineCI.flags | VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+
+    static_assert(sizeof(VkDynamicState) == sizeof(Uint32), "Unexpected size of VkDynamicState");
+    auto InitKey = [&](VkGraphicsPipelineLibraryFlagsEXT Type) {
+        LibraryKey Key{Type};
+        Key.Add(LibraryFlags);
+        const auto& DynamicStateCI = *PipelineCI.pDynamicState;
+        Key.Add(DynamicStateCI.dynamicStateCount);
+        Key.AddWords(reinterpret_cast<const Uint32*>(DynamicStateCI.pDynamicStates), DynamicStateCI.dynamicStateCount);
+        return Key;
+    };
+
+    auto AddRenderPassToKey = [&](LibraryKey& Key, bool AddFormats) {
+        if (pRenderingCI != nullptr)
+        {
+            Key.Add(pRenderingCI->viewMask);
+            if (AddFormats)
+            {
+                Key.Add(pRenderingCI->colorAttachmentCount);
+                for (Uint32 rt = 0; rt < pRenderingCI->colorAttachmentCount; ++rt)
+                    Key.Add(pRenderingCI->pColorAttachmentFormats[rt]);
+                Key.Add(pRenderingCI->depthAttachmentFormat);
+                Key.Add(pRenderingCI->stencilAttachmentFormat);
+            }
+        }
+        else
+        {
+            // The render pass is kept alive by the pipeline states that use the library,
+            // so the handle can't be reused while the library is in the cache.
+            Key.Add(PipelineCI.renderPass);
+            Key.Add(PipelineCI.subpass);
+        }
+    };
+
+    // Libraries that use pipeline layouts must be linked with identically defined layouts.
+    // Like the render pass, descriptor set layouts are kept alive by the pipeline states that use the library.
+    auto AddLayoutToKey = [&](LibraryKey& Key) {
+        const auto SignCount = GetResourceSignatureCount();
+        Key.Add(SignCount);
+        for (Uint32 i = 0; i < SignCount; ++i)
+        {
+            const auto* pSignature = GetResourceSignature(i);
+            for (auto SetId : {PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE, PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC})
+                Key.Add(pSignature != nullptr ? pSignature->GetVkDescriptorSetLayout(SetId) : VK_NULL_HANDLE);
+        }
+    };
+
+    auto AddStagesToKey = [&](LibraryKey& Key, bool FragmentStage) {
+        for (const auto& Stage : ShaderStages)
+        {
+            if ((Stage.Type == SHADER_TYPE_PIXEL) != FragmentStage)
+                continue;
+
+            Key.Add(Stage.Type);
+            for (size_t i = 0; i < Stage.Shaders.size(); ++i)
+            {
+                const auto& SPIRV = Stage.SPIRVs[i];
+                Key.AddString(Stage.Shaders[i]->GetEntryPoint());
+                Key.Add(static_cast<Uint32>(SPIRV.size()));
+                Key.AddWords(SPIRV.data(), SPIRV.size());
+            }
+        }
+    };
+
+    auto AddMultisampleStateToKey = [&](LibraryKey& Key) {
+        const auto& MSStateCI = *PipelineCI.pMultisampleState;
+        Key.Add(MSStateCI.rasterizationSamples);
+        Key.Add(MSStateCI.sampleShadingEnable);
+        Key.Add(MSStateCI.minSampleShading);
+        Key.Add(MSStateCI.pSampleMask != nullptr ? MSStateCI.pSampleMask[0] : ~Uint32{0});
+        Key.Add(MSStateCI.alphaToCoverageEnable);
+        Key.Add(MSStateCI.alphaToOneEnable);
+    };
+
+    auto InitLibraryCI = [&](VkGraphicsPipelineLibraryCreateInfoEXT& LibraryTypeCI, VkGraphicsPipelineLibraryFlagsEXT Type) {
+        // Vertex input interface does not depend on the render pass
+        const bool UsesRenderPass = Type != VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT;
+
+        LibraryTypeCI.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
+        LibraryTypeCI.pNext = UsesRenderPass ? PipelineCI.pNext : nullptr;
+        LibraryTypeCI.flags = Type;
+
+        VkGraphicsPipelineCreateInfo LibraryCI{};
+        LibraryCI.sType              = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        LibraryCI.pNext              = &LibraryTypeCI;
+        LibraryCI.flags              = LibraryFlags;
+        LibraryCI.pDynamicState      = PipelineCI.pDynamicState;
+        LibraryCI.renderPass         = UsesRenderPass ? PipelineCI.renderPass : VK_NULL_HANDLE;
+        LibraryCI.subpass            = UsesRenderPass ? PipelineCI.subpass : 0;
+        LibraryCI.basePipelineHandle = VK_NULL_HANDLE;
+        LibraryCI.basePipelineIndex  = -1;
+        return LibraryCI;
+    };
+
+    std::vector<VkPipelineShaderStageCreateInfo> PreRasterStages;
+    std::vector<VkPipelineShaderStageCreateInfo> FragmentStages;
+    for (Uint32 i = 0; i < PipelineCI.stageCount; ++i)
+    {
+        const auto& StageCI = PipelineCI.pStages[i];
+        (StageCI.stage == VK_SHADER_STAGE_FRAGMENT_BIT ? FragmentStages : PreRasterStages).push_back(StageCI);
+    }
+
+    GraphicsPipelineLibraries Libraries;
+
+    // Vertex input interface
+    {
+        constexpr auto Type = VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT;
+
+        auto        Key          = InitKey(Type);
+        const auto& VertexInput  = *PipelineCI.pVertexInputState;
+        const auto& InputAsembly = *PipelineCI.pInputAssemblyState;
+        Key.Add(VertexInput.vertexBindingDescriptionCount);
+        for (Uint32 i = 0; i < VertexInput.vertexBindingDescriptionCount; ++i)
+        {
+            const auto& Binding = VertexInput.pVertexBindingDescriptions[i];
+            Key.Add(Binding.binding);
+            Key.Add(Binding.stride);
+            Key.Add(Binding.inputRate);
+        }
+        Key.Add(VertexInput.vertexAttributeDescriptionCount);
+        for (Uint32 i = 0; i < VertexInput.vertexAttributeDescriptionCount; ++i)
+        {
+            const auto& Attrib = VertexInput.pVertexAttributeDescriptions[i];
+            Key.Add(Attrib.location);
+            Key.Add(Attrib.binding);
+            Key.Add(Attrib.format);
+            Key.Add(Attrib.offset);
+        }
+        if (const auto* pDivisorCI = static_cast<const VkPipelineVertexInputDivisorStateCreateInfoEXT*>(VertexInput.pNext))
+        {
+            Key.Add(pDivisorCI->vertexBindingDivisorCount);
+            for (Uint32 i = 0; i < pDivisorCI->vertexBindingDivisorCount; ++i)
+            {
+                Key.Add(pDivisorCI->pVertexBindingDivisors[i].binding);
+                Key.Add(pDivisorCI->pVertexBindingDivisors[i].divisor);
+            }
+        }
+        Key.Add(InputAsembly.topology);
+        Key.Add(InputAsembly.primitiveRestartEnable);
+
+        VkGraphicsPipelineLibraryCreateInfoEXT LibraryTypeCI{};
+
+        auto LibraryCI                = InitLibraryCI(LibraryTypeCI, Type);
+        LibraryCI.pVertexInputState   = PipelineCI.pVertexInputState;
+        LibraryCI.pInputAssemblyState = PipelineCI.pInputAssemblyState;
+        Libraries[0]                  = LibraryCache.GetLibrary(Key, LibraryCI, vkPSOCache, "Vertex input library");
+    }
+
+    // Pre-rasterization shaders
+    {
+        constexpr auto Type = VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT;
+
+        auto Key = InitKey(Type);
+        AddStagesToKey(Key, false);
+        AddLayoutToKey(Key);
+        AddRenderPassToKey(Key, false);
+
+        const auto& ViewportState = *PipelineCI.pViewportState;
+        Key.Add(ViewportState.viewportCount);
+        Key.Add(ViewportState.scissorCount);
+        if (ViewportState.pScissors != nullptr)
+        {
+            Key.Add(ViewportState.pScissors[0].extent.width);
+            Key.Add(ViewportState.pScissors[0].extent.height);
+        }
+
+        const auto& RasterizerState = *PipelineCI.pRasterizationState;
+        Key.Add(RasterizerState.depthClampEnable);
+        Key.Add(RasterizerState.rasterizerDiscardEnable);
+        Key.Add(RasterizerState.polygonMode);
+        Key.Add(RasterizerState.cullMode);
+        Key.Add(RasterizerState.frontFace);
+        Key.Add(RasterizerState.depthBiasEnable);
+        Key.Add(RasterizerState.depthBiasConstantFactor);
+        Key.Add(RasterizerState.depthBiasClamp);
+        Key.Add(RasterizerState.depthBiasSlopeFactor);
+        Key.Add(RasterizerState.lineWidth);
+
+        if (PipelineCI.pTessellationState != nullptr)
+            Key.Add(PipelineCI.pTessellationState->patchControlPoints);
+
+        VkGraphicsPipelineLibraryCreateInfoEXT LibraryTypeCI{};
+
+        auto LibraryCI                = InitLibraryCI(LibraryTypeCI, Type);
+        LibraryCI.stageCount          = static_cast<uint32_t>(PreRasterStages.size());
+        LibraryCI.pStages             = PreRasterStages.data();
+        LibraryCI.layout              = PipelineCI.layout;
+        LibraryCI.pViewportState      = PipelineCI.pViewportState;
+        LibraryCI.pRasterizationState = PipelineCI.pRasterizationState;
+        LibraryCI.pTessellationState  = PipelineCI.pTessellationState;
+        Libraries[1]                  = LibraryCache.GetLibrary(Key, LibraryCI, vkPSOCache, "Pre-rasterization shaders library");
+    }
+
+    // Fragment shader
+    {
+        constexpr auto Type = VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT;
+
+        auto Key = InitKey(Type);
+        AddStagesToKey(Key, true);
+        AddLayoutToKey(Key);
+        AddRenderPassToKey(Key, false);
+        AddMultisampleStateToKey(Key);
+
+        const auto& DepthStencilState = *PipelineCI.pDepthStencilState;
+        Key.Add(DepthStencilState.depthTestEnable);
+        Key.Add(DepthStencilState.depthWriteEnable);
+        Key.Add(DepthStencilState.depthCompareOp);
+        Key.Add(DepthStencilState.depthBoundsTestEnable);
+        Key.Add(DepthStencilState.stencilTestEnable);
+        for (const auto* pFace : {&DepthStencilState.front, &DepthStencilState.back})
+        {
+            Key.Add(pFace->failOp);
+            Key.Add(pFace->passOp);
+            Key.Add(pFace->depthFailOp);
+            Key.Add(pFace->compareOp);
+            Key.Add(pFace->compareMask);
+            Key.Add(pFace->writeMask);
+        }
+        Key.Add(DepthStencilState.minDepthBounds);
+        Key.Add(DepthStencilState.maxDepthBounds);
+
+        VkGraphicsPipelineLibraryCreateInfoEXT LibraryTypeCI{};
+
+        auto LibraryCI               = InitLibraryCI(LibraryTypeCI, Type);
+        LibraryCI.stageCount         = static_cast<uint32_t>(FragmentStages.size());
+        LibraryCI.pStages            = !FragmentStages.empty() ? FragmentStages.data() : nullptr;
+        LibraryCI.layout             = PipelineCI.layout;
+        LibraryCI.pDepthStencilState = PipelineCI.pDepthStencilState;
+        LibraryCI.pMultisampleState  = PipelineCI.pMultisampleState;
+        Libraries[2]                 = LibraryCache.GetLibrary(Key, LibraryCI, vkPSOCache, "Fragment shader library");
+    }
+
+    // Fragment output interface
+    {
+        constexpr auto Type = VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT;
+
+        auto Key = InitKey(Type);
+        AddRenderPassToKey(Key, true);
+        AddMultisampleStateToKey(Key);
+
+        const auto& BlendState = *PipelineCI.pColorBlendState;
+        Key.Add(BlendState.logicOpEnable);
+        Key.Add(BlendState.logicOp);
+        Key.Add(BlendState.attachmentCount);
+        for (Uint32 i = 0; i < BlendState.attachmentCount; ++i)
+        {
+            const auto& Attachment = BlendState.pAttachments[i];
+            Key.Add(Attachment.blendEnable);
+            Key.Add(Attachment.srcColorBlendFactor);
+            Key.Add(Attachment.dstColorBlendFactor);
+            Key.Add(Attachment.colorBlendOp);
+            Key.Add(Attachment.srcAlphaBlendFactor);
+            Key.Add(Attachment.dstAlphaBlendFactor);
+            Key.Add(Attachment.alphaBlendOp);
+            Key.Add(Attachment.colorWriteMask);
+        }
+
+        VkGraphicsPipelineLibraryCreateInfoEXT LibraryTypeCI{};
+
+        auto LibraryCI              = InitLibraryCI(LibraryTypeCI, Type);
+        LibraryCI.pColorBlendState  = PipelineCI.pColorBlendState;
+        LibraryCI.pMultisampleState = PipelineCI.pMultisampleState;
+        Libraries[3]                = LibraryCache.GetLibrary(Key, LibraryCI, vkPSOCache, "Fragment output library");
+    }
+
+    m_Libraries = std::move(Libraries);
+
+    // Link-time optimizations are meaningless if optimizations are disabled
+    const bool CanOptimize = (PipelineCI.flags & VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT) == 0;
+
+    // If fast linking is supported, link the pipeline without optimizations right away so that it can be used
+    // immediately, and link the optimized pipeline in the background. Otherwise, link the optimized pipeline now.
+    NeedsOptimizedLink =
+        CanOptimize &&
+        pDeviceVk->GetPhysicalDevice().GetExtProperties().GraphicsPipelineLibrary.graphicsPipelineLibraryFastLinking != VK_FALSE &&
+        pDeviceVk->GetShaderCompilationThreadPool() != nullptr;
+
+    return LinkGraphicsPipelineLibraries(LogicalDevice, m_Libraries, PipelineCI.layout, CanOptimize && !NeedsOptimizedLink, vkPSOCache, m_Desc.Name);
+}
+
+void PipelineStateVkImpl::EnqueueOptimizedLink(IPipelineStateCache* pPSOCache)
+{
+    VERIFY_EXPR(!m_pOptimizedLinkTask);
+
+    RefCntAutoPtr<IPipelineStateCache> pCache{pPSOCache};
+    // Do not keep a strong reference to the pipeline in the task: the pipeline
+    // cancels or waits for the task in Destruct(). The optimized link has lower priority
+    // than the initialization of other pipelines and shaders.
+    m_pOptimizedLinkTask = EnqueueAsyncWork(GetDevice()->GetShaderCompilationThreadPool(),
+                                            [this, pCache](Uint32 ThreadId) //
+                                            {
+                                                try
+                                                {
+                                                    const auto vkSPOCache = pCache ? pCache.RawPtr<PipelineStateCacheVkImpl>()->GetVkPipelineCache() : VK_NULL_HANDLE;
+
+                                                    m_OptimizedPipeline = LinkGraphicsPipelineLibraries(GetDevice()->GetLogicalDevice(), m_Libraries, m_PipelineLayout.GetVkPipelineLayout(),
+                                                                                                        /*Optimize = */ true, vkSPOCache, m_Desc.Name);
+                                                    m_OptimizedPipelineReady.store(true, std::memory_order_release);
+                                                }
+                                                catch (...)
+                                                {
+                                                    LOG_WARNING_MESSAGE("Failed to link optimized pipeline '", m_Desc.Name, "'. Fast-linked pipeline will be used.");
+                                                }
+                                            },
+                                            -1.f);
+}
+
+void PipelineStateVkImpl::InitializePipeline(const GraphicsPipelineStateCreateInfo& CreateInfo) noexcept(false)
+{
+    std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
+    std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
+
+    const auto ShaderStages = InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
+
+    const auto vkSPOCache = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
+
+    // Mesh pipelines are always created as a whole
+    const bool UseLibraries =
+        m_Desc.PipelineType == PIPELINE_TYPE_GRAPHICS &&
+        GetDevice()->GetLogicalDevice().GetEnabledExtFeatures().GraphicsPipelineLibrary.graphicsPipelineLibrary != VK_FALSE;
+
+    bool NeedsOptimizedLink = false;
+
+    CreatePipelineFromLibrariesType CreatePipelineFromLibraries;
+    if (UseLibraries)
+    {
+        CreatePipelineFromLibraries = [&](const VkGraphicsPipelineCreateInfo& PipelineCI) {
+            return CreateGraphicsPipelineFromLibraries(PipelineCI, ShaderStages, vkSPOCache, NeedsOptimizedLink);
+        };
+    }
+    CreateGraphicsPipeline(GetDevice(), vkShaderStages, m_PipelineLayout, m_Desc, GetGraphicsPipelineDesc(), m_Pipeline, GetRenderPassPtr(), vkSPOCache, CreatePipelineFromLibraries);
+
+    if (NeedsOptimizedLink)
+        EnqueueOptimizedLink(CreateInfo.pPSOCache);
+}
+
+void PipelineStateVkImpl::InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo) noexcept(false)
+{
+    std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
+    std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
+
+    InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
+
+    const auto vkSPOCache = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
+    CreateComputePipeline(GetDevice(), vkShaderStages, m_PipelineLayout, m_Desc, m_Pipeline, vkSPOCache);
+}
+
+void PipelineStateVkImpl::InitializePipeline(const RayTracingPipelineStateCreateInfo& CreateInfo) noexcept(false)
+{
+    const auto& LogicalDevice = GetDevice()->GetLogicalDevice();
+
+    std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
+    std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
+
+    const auto ShaderStages   = InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
+    const auto vkShaderGroups = BuildRTShaderGroupDescription(CreateInfo, m_pRayTracingPipelineData->NameToGroupIndex, ShaderStages);
+    const auto vkSPOCache     = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
+
+    CreateRayTracingPipeline(GetDevice(), vkShaderStages, vkShaderGroups, m_PipelineLayout, m_Desc, GetRayTracingPipelineDesc(), m_Pipeline, vkSPOCache);
+
+    VERIFY(m_pRayTracingPipelineData->NameToGroupIndex.size() == vkShaderGroups.size(),
+           "The size of NameToGroupIndex map does not match the actual number of groups in the pipeline. This is a bug.");
+    // Get shader group handles from the PSO.
+    auto err = LogicalDevice.GetRayTracingShaderGroupHandles(m_Pipeline, 0, static_cast<uint32_t>(vkShaderGroups.size()), m_pRayTracingPipelineData->ShaderDataSize, m_pRayTracingPipelineData->ShaderHandles);
+    DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to get shader group handles");
+    (void)err;
+}
+
 PipelineStateVkImpl::PipelineStateVkImpl(IReferenceCounters* pRefCounters, RenderDeviceVkImpl* pDeviceVk, const GraphicsPipelineStateCreateInfo& CreateInfo) :
     TPipelineStateBase{pRefCounters, pDeviceVk, CreateInfo}
 {
     try
     {
-        std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
-        std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
-
-        InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
-
-        const auto vkSPOCache = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
-        CreateGraphicsPipeline(pDeviceVk, vkShaderStages, m_PipelineLayout, m_Desc, GetGraphicsPipelineDesc(), m_Pipeline, GetRenderPassPtr(), vkSPOCache);
+        ConstructPipeline(CreateInfo, [this](const GraphicsPipelineStateCreateInfo& CI) { InitializePipeline(CI); });
     }
     catch (...)
     {
@@ -855,13 +1327,7 @@ PipelineStateVkImpl::PipelineStateVkImpl(IReferenceCounters* pRefCounters, Rende
 {
     try
     {
-        std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
-        std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
-
-        InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
-
-        const auto vkSPOCache = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
-        CreateComputePipeline(pDeviceVk, vkShaderStages, m_PipelineLayout, m_Desc, m_Pipeline, vkSPOCache);
+        ConstructPipeline(CreateInfo, [this](const ComputePipelineStateCreateInfo& CI) { InitializePipeline(CI); });
     }
     catch (...)
     {
@@ -875,23 +1341,7 @@ PipelineStateVkImpl::PipelineStateVkImpl(IReferenceCounters* pRefCounters, Rende
 {
     try
     {
-        const auto& LogicalDevice = pDeviceVk->GetLogicalDevice();
-
-        std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
-        std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
-
-        const auto ShaderStages   = InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
-        const auto vkShaderGroups = BuildRTShaderGroupDescription(CreateInfo, m_pRayTracingPipelineData->NameToGroupIndex, ShaderStages);
-        const auto vkSPOCache     = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
-
-        CreateRayTracingPipeline(pDeviceVk, vkShaderStages, vkShaderGroups, m_PipelineLayout, m_Desc, GetRayTracingPipelineDesc(), m_Pipeline, vkSPOCache);
-
-        VERIFY(m_pRayTracingPipelineData->NameToGroupIndex.size() == vkShaderGroups.size(),
-               "The size of NameToGroupIndex map does not match the actual number of groups in the pipeline. This is a bug.");
-        // Get shader group handles from the PSO.
-        auto err = LogicalDevice.GetRayTracingShaderGroupHandles(m_Pipeline, 0, static_cast<uint32_t>(vkShaderGroups.size()), m_pRayTracingPipelineData->ShaderDataSize, m_pRayTracingPipelineData->ShaderHandles);
-        DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to get shader group handles");
-        (void)err;
+        ConstructPipeline(CreateInfo, [this](const RayTracingPipelineStateCreateInfo& CI) { InitializePipeline(CI); });
     }
     catch (...)
     {
@@ -902,12 +1352,24 @@ PipelineStateVkImpl::PipelineStateVkImpl(IReferenceCounters* pRefCounters, Rende
 
 PipelineStateVkImpl::~PipelineStateVkImpl()
 {
+    CancelAsyncInitialization();
     Destruct();
 }
 
 void PipelineStateVkImpl::Destruct()
 {
+    if (m_pOptimizedLinkTask)
+    {
+        if (!m_pDevice->GetShaderCompilationThreadPool()->RemoveTask(m_pOptimizedLinkTask, false))
+            m_pOptimizedLinkTask->WaitForCompletion();
+        m_pOptimizedLinkTask.Release();
+    }
+
     m_pDevice->SafeReleaseDeviceObject(std::move(m_Pipeline), m_Desc.ImmediateContextMask);
+    m_pDevice->SafeReleaseDeviceObject(std::move(m_OptimizedPipeline), m_Desc.ImmediateContextMask);
+    // Libraries are never bound to command buffers, and linked pipelines do not depend on them
+    for (auto& pLibrary : m_Libraries)
+        pLibrary.reset();
     m_PipelineLayout.Release(m_pDevice, m_Desc.ImmediateContextMask);
 
     TPipelineStateBase::Destruct();
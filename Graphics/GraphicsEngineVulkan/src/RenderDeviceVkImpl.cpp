@@ -27,6 +27,8 @@
 
 #include "pch.h"
 
+#include <map>
+
 #include "RenderDeviceVkImpl.hpp"
 
 #include "PipelineStateVkImpl.hpp"
@@ -46,6 +48,8 @@
 #include "DeviceMemoryVkImpl.hpp"
 #include "PipelineStateCacheVkImpl.hpp"
 #include "CommandQueueVkImpl.hpp"
+#include "CompletionTrackerVk.hpp"
+#include "TransientMemoryVk.hpp"
 #include "PipelineResourceSignatureVkImpl.hpp"
 
 #include "VulkanTypeConversions.hpp"
@@ -81,6 +85,7 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
     m_LogicalVkDevice        {std::move(LogicalDevice) },
     m_FramebufferCache       {*this                    },
     m_ImplicitRenderPassCache{*this                    },
+    m_PipelineLibraryCache   {*this                    },
     m_DescriptorSetAllocator
     {
         *this,
@@ -134,7 +139,8 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
         EngineCI.DeviceLocalMemoryPageSize,
         EngineCI.HostVisibleMemoryPageSize,
         EngineCI.DeviceLocalMemoryReserveSize,
-        EngineCI.HostVisibleMemoryReserveSize
+        EngineCI.HostVisibleMemoryReserveSize,
+        EngineCI.DedicatedAllocationThreshold
     },
     m_DynamicMemoryManager
     {
@@ -157,6 +163,11 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
                                                        m_PhysicalDevice->GetProperties(),
                                                        m_LogicalVkDevice->GetEnabledExtFeatures(),
                                                        m_PhysicalDevice->GetExtProperties());
+    // Asynchronous shader compilation does not map to a Vulkan feature and
+    // is only enabled when requested by the application.
+    m_DeviceInfo.Features.AsyncShaderCompilation = GetShaderCompilationThreadPool() != nullptr ?
+        DEVICE_FEATURE_STATE_ENABLED :
+        DEVICE_FEATURE_STATE_DISABLED;
 
     // Note that Vulkan itself does not invert Y coordinate when transforming
     // normalized device Y to window space. However, we use negative viewport
@@ -189,10 +200,26 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
 
     for (Uint32 fmt = 1; fmt < m_TextureFormatsInfo.size(); ++fmt)
         m_TextureFormatsInfo[fmt].Supported = true; // We will test every format on a specific hardware device
+
+    if (EngineCI.BindlessHeapSize > 0)
+    {
+        if (BindlessHeapVk::IsSupported(*this))
+        {
+            m_pBindlessHeap = std::make_unique<BindlessHeapVk>(*this, EngineCI.BindlessHeapSize);
+        }
+        else
+        {
+            LOG_WARNING_MESSAGE("Bindless heap is disabled because the device does not support update-after-bind and partially bound descriptors. "
+                                "Note that the heap requires ShaderResourceRuntimeArray feature to be enabled.");
+        }
+    }
 }
 
 RenderDeviceVkImpl::~RenderDeviceVkImpl()
 {
+    // Stop the completion thread before any resources are released
+    m_pCompletionTracker.reset();
+
     // Explicitly destroy dynamic heap. This will move resources owned by
     // the heap into release queues
     m_DynamicMemoryManager.Destroy();
@@ -416,12 +443,51 @@ Uint64 RenderDeviceVkImpl::ExecuteCommandBuffer(SoftwareQueueIndex CommandQueueI
     Uint64 SubmittedCmdBuffNumber = 0;
     SubmitCommandBuffer(CommandQueueId, SubmitInfo, SubmittedCmdBuffNumber, SubmittedFenceValue, pSignalFences);
 
+    // When the completion thread is running, it releases the resources as soon as the command buffer completes
+    if (!m_pCompletionTracker)
+        PurgeReleaseQueue(CommandQueueId);
+    // Shrink after purging the queue so that the pages emptied by the released resources are destroyed now
     m_MemoryMgr.ShrinkMemory();
-    PurgeReleaseQueue(CommandQueueId);
 
     return SubmittedFenceValue;
 }
 
+CommandQueueVkImpl* RenderDeviceVkImpl::GetCommandQueueVk(SoftwareQueueIndex CommandQueueId)
+{
+    VERIFY_EXPR(CommandQueueId < m_CmdQueueCount);
+    return m_CommandQueues[CommandQueueId].CmdQueue.RawPtr<CommandQueueVkImpl>();
+}
+
+void RenderDeviceVkImpl::InitCompletionTracking(const EngineVkCreateInfo& EngineCI)
+{
+    if (!EngineCI.EnableCompletionThread)
+    {
+        if (EngineCI.MaxSubmitBatchSize > 1)
+            LOG_WARNING_MESSAGE("Submit batching is disabled because EngineVkCreateInfo::EnableCompletionThread is false.");
+        return;
+    }
+
+    if (!m_LogicalVkDevice->GetEnabledExtFeatures().TimelineSemaphore.timelineSemaphore)
+    {
+        LOG_WARNING_MESSAGE("Completion thread is disabled because timeline semaphores are not supported by the device.");
+        return;
+    }
+
+    for (Uint32 q = 0; q < m_CmdQueueCount; ++q)
+        GetCommandQueueVk(SoftwareQueueIndex{q})->EnableCompletionTracking(EngineCI.MaxSubmitBatchSize);
+
+    m_pCompletionTracker = std::make_unique<CompletionTrackerVk>(*this);
+}
+
+void RenderDeviceVkImpl::SubmitPendingCommandBatches()
+{
+    if (!m_pCompletionTracker)
+        return;
+
+    for (Uint32 q = 0; q < m_CmdQueueCount; ++q)
+        GetCommandQueueVk(SoftwareQueueIndex{q})->SubmitPendingBatch();
+}
+
 
 void RenderDeviceVkImpl::IdleGPU()
 {
@@ -441,8 +507,9 @@ void RenderDeviceVkImpl::FlushStaleResources(SoftwareQueueIndex CmdQueueIndex)
 
 void RenderDeviceVkImpl::ReleaseStaleResources(bool ForceRelease)
 {
+    if (ForceRelease || !m_pCompletionTracker)
+        PurgeReleaseQueues(ForceRelease);
     m_MemoryMgr.ShrinkMemory();
-    PurgeReleaseQueues(ForceRelease);
 }
 
 
@@ -682,6 +749,193 @@ void RenderDeviceVkImpl::CreateFenceFromVulkanResource(VkSemaphore      vkTimeli
     CreateFenceImpl(ppFence, Desc, vkTimelineSemaphore);
 }
 
+void RenderDeviceVkImpl::GetMemoryBudget(MemoryBudgetVk& Budget)
+{
+    Budget = {};
+
+    const auto& MemoryProps = m_PhysicalDevice->GetMemoryProperties();
+    Budget.HeapCount        = MemoryProps.memoryHeapCount;
+
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT VkBudget{};
+    Budget.IsDriverReported = m_LogicalVkDevice->GetEnabledExtFeatures().MemoryBudget && m_PhysicalDevice->GetMemoryBudget(VkBudget);
+
+    Budget.DedicatedAllocationsEnabled = m_LogicalVkDevice->GetEnabledExtFeatures().DedicatedAllocation;
+
+    for (uint32_t HeapIdx = 0; HeapIdx < MemoryProps.memoryHeapCount; ++HeapIdx)
+    {
+        auto& Heap = Budget.Heaps[HeapIdx];
+
+        const auto HeapStats = m_MemoryMgr.GetHeapStatistics(HeapIdx);
+
+        Heap.Size                     = MemoryProps.memoryHeaps[HeapIdx].size;
+        Heap.Flags                    = MemoryProps.memoryHeaps[HeapIdx].flags;
+        Heap.AllocatedSize            = HeapStats.AllocatedSize;
+        Heap.DedicatedAllocationSize  = HeapStats.DedicatedSize;
+        Heap.DedicatedAllocationCount = HeapStats.DedicatedCount;
+        if (Budget.IsDriverReported)
+        {
+            Heap.Budget = VkBudget.heapBudget[HeapIdx];
+            Heap.Usage  = VkBudget.heapUsage[HeapIdx];
+        }
+        else
+        {
+            Heap.Budget = Heap.Size;
+            Heap.Usage  = HeapStats.AllocatedSize;
+        }
+    }
+}
+
+void RenderDeviceVkImpl::GetPipelineLibraryStats(PipelineLibraryStatsVk& Stats)
+{
+    Stats = {};
+
+    Stats.Enabled = m_LogicalVkDevice->GetEnabledExtFeatures().GraphicsPipelineLibrary.graphicsPipelineLibrary != VK_FALSE;
+
+    const auto CacheStats = m_PipelineLibraryCache.GetStatistics();
+
+    Stats.NumLibraries = CacheStats.NumLibraries;
+    Stats.NumCreated   = CacheStats.NumCreated;
+    Stats.NumReused    = CacheStats.NumReused;
+}
+
+void RenderDeviceVkImpl::CreateTransientTextures(const TransientTextureDescVk* pTexDescs,
+                                                 Uint32                        NumTextures,
+                                                 ITexture**                    ppTextures,
+                                                 TransientMemoryStatsVk*       pStats)
+{
+    DEV_CHECK_ERR(NumTextures == 0 || (pTexDescs != nullptr && ppTextures != nullptr), "pTexDescs and ppTextures must not be null");
+    if (pStats != nullptr)
+        *pStats = {};
+    if (NumTextures == 0 || pTexDescs == nullptr || ppTextures == nullptr)
+        return;
+
+    for (Uint32 i = 0; i < NumTextures; ++i)
+    {
+        DEV_CHECK_ERR(ppTextures[i] == nullptr, "Overwriting reference to existing object may cause memory leaks");
+        ppTextures[i] = nullptr;
+    }
+
+    try
+    {
+        std::vector<VulkanUtilities::ImageWrapper> Images(NumTextures);
+        std::vector<VkMemoryRequirements>          MemReqs(NumTextures);
+        std::map<uint32_t, std::vector<Uint32>>    MemoryTypeGroups;
+        for (Uint32 i = 0; i < NumTextures; ++i)
+        {
+            const auto& TexDesc = pTexDescs[i].Desc;
+            if (TexDesc.Usage != USAGE_DEFAULT)
+                LOG_ERROR_AND_THROW("Transient texture '", (TexDesc.Name ? TexDesc.Name : ""), "' must have USAGE_DEFAULT usage");
+            if (pTexDescs[i].FirstPass > pTexDescs[i].LastPass)
+                LOG_ERROR_AND_THROW("The first pass (", pTexDescs[i].FirstPass, ") of transient texture '", (TexDesc.Name ? TexDesc.Name : ""),
+                                    "' is greater than the last pass (", pTexDescs[i].LastPass, ")");
+
+            VkImageCreateInfo ImageCI = TextureDescToVkImageCreateInfo(TexDesc, this);
+
+            const auto QueueFamilyIndices = PlatformMisc::CountOneBits(TexDesc.ImmediateContextMask) > 1 ?
+                ConvertCmdQueueIdsToQueueFamilies(TexDesc.ImmediateContextMask) :
+                std::vector<uint32_t>{};
+            if (QueueFamilyIndices.size() > 1)
+            {
+                ImageCI.sharingMode           = VK_SHARING_MODE_CONCURRENT;
+                ImageCI.pQueueFamilyIndices   = QueueFamilyIndices.data();
+                ImageCI.queueFamilyIndexCount = static_cast<uint32_t>(QueueFamilyIndices.size());
+            }
+
+            Images[i] = m_LogicalVkDevice->CreateImage(ImageCI, TexDesc.Name);
+
+            VkMemoryDedicatedRequirements DedicatedReqs{};
+            MemReqs[i] = m_LogicalVkDevice->GetImageMemoryRequirements(Images[i], &DedicatedReqs);
+            if (DedicatedReqs.requiresDedicatedAllocation != VK_FALSE)
+                LOG_ERROR_AND_THROW("Transient texture '", (TexDesc.Name ? TexDesc.Name : ""), "' requires a dedicated allocation and can't share memory");
+
+            const auto MemoryProps     = (TexDesc.MiscFlags & MISC_TEXTURE_FLAG_MEMORYLESS) != 0 ? VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT : VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+            const auto MemoryTypeIndex = m_PhysicalDevice->GetMemoryTypeIndex(MemReqs[i].memoryTypeBits, MemoryProps);
+            if (MemoryTypeIndex == VulkanUtilities::VulkanPhysicalDevice::InvalidMemoryTypeIndex)
+                LOG_ERROR_AND_THROW("Failed to find suitable memory type for transient texture '", (TexDesc.Name ? TexDesc.Name : ""), "'");
+
+            // Only textures that use the same memory type can share memory
+            MemoryTypeGroups[MemoryTypeIndex].push_back(i);
+        }
+
+        TransientMemoryStatsVk Stats;
+        for (const auto& it : MemoryTypeGroups)
+        {
+            const auto& Group = it.second;
+
+            std::vector<TransientMemoryVk::ResourceInfo> Resources(Group.size());
+
+            VkDeviceSize Alignment            = 1;
+            BIND_FLAGS   BindFlags            = BIND_NONE;
+            Uint64       ImmediateContextMask = 0;
+            for (size_t r = 0; r < Group.size(); ++r)
+            {
+                const auto  i   = Group[r];
+                auto&       Res = Resources[r];
+                Res.Size        = MemReqs[i].size;
+                Res.Alignment   = MemReqs[i].alignment;
+                Res.FirstPass   = pTexDescs[i].FirstPass;
+                Res.LastPass    = pTexDescs[i].LastPass;
+
+                Alignment = std::max(Alignment, Res.Alignment);
+                BindFlags |= pTexDescs[i].Desc.BindFlags;
+                ImmediateContextMask |= pTexDescs[i].Desc.ImmediateContextMask;
+
+                Stats.RequiredSize += Res.Size;
+            }
+
+            std::vector<TransientMemoryVk::Range> Ranges;
+            const auto                            MemorySize = TransientMemoryVk::PlaceResources(Resources, Ranges);
+
+            auto Allocation = AllocateMemory(MemorySize, Alignment, it.first);
+            if (Allocation.Page == nullptr)
+                LOG_ERROR_AND_THROW("Failed to allocate ", MemorySize, " bytes of transient memory");
+
+            auto pMemory = std::make_shared<TransientMemoryVk>(*this, std::move(Allocation), Alignment, std::move(Ranges), BindFlags, ImmediateContextMask);
+
+            Stats.AllocatedSize += MemorySize;
+            Stats.NumAllocations += 1;
+
+            for (Uint32 r = 0; r < Group.size(); ++r)
+            {
+                const auto  i       = Group[r];
+                const auto& TexDesc = pTexDescs[i].Desc;
+
+                auto err = m_LogicalVkDevice->BindImageMemory(Images[i], pMemory->GetVkMemory(), pMemory->GetOffset(r));
+                CHECK_VK_ERROR_AND_THROW(err, "Failed to bind transient image memory");
+
+                CreateDeviceObject(
+                    "texture", TexDesc, &ppTextures[i],
+                    [&]() //
+                    {
+                        TextureVkImpl* pTextureVk = NEW_RC_OBJ(m_TexObjAllocator, "TextureVkImpl instance", TextureVkImpl)(m_TexViewObjAllocator, this, TexDesc, std::move(Images[i]), pMemory, r);
+                        pTextureVk->QueryInterface(IID_Texture, reinterpret_cast<IObject**>(&ppTextures[i]));
+                    } //
+                );
+                if (ppTextures[i] == nullptr)
+                    LOG_ERROR_AND_THROW("Failed to create transient texture '", (TexDesc.Name ? TexDesc.Name : ""), "'");
+
+                if (pMemory->IsAliased(r))
+                    m_HasAliasedTextures.store(true, std::memory_order_relaxed);
+            }
+        }
+
+        if (pStats != nullptr)
+            *pStats = Stats;
+    }
+    catch (...)
+    {
+        for (Uint32 i = 0; i < NumTextures; ++i)
+        {
+            if (ppTextures[i] != nullptr)
+            {
+                ppTextures[i]->Release();
+                ppTextures[i] = nullptr;
+            }
+        }
+        LOG_ERROR("Failed to create ", NumTextures, " transient textures");
+    }
+}
+
 void RenderDeviceVkImpl::CreateTLAS(const TopLevelASDesc& Desc,
                                     ITopLevelAS**         ppTLAS)
 {
@@ -43,4 +43,15 @@ ShaderResourceBindingVkImpl::~ShaderResourceBindingVkImpl()
 {
 }
 
+void ShaderResourceBindingVkImpl::SetVariables(const ShaderVariableBinding* pBindings, Uint32 NumBindings)
+{
+    // Accumulate descriptor writes for all variables and write them with a single vkUpdateDescriptorSets call
+    ShaderResourceCacheVk::DescriptorWriteBatch WriteBatch;
+    WriteBatch.Writes.reserve(NumBindings);
+
+    m_ShaderResourceCache.BeginDescriptorWriteBatch(WriteBatch);
+    TBase::SetVariables(pBindings, NumBindings);
+    m_ShaderResourceCache.EndDescriptorWriteBatch(GetSignature()->GetDevice()->GetLogicalDevice());
+}
+
 } // namespace Diligent
@@ -288,6 +288,86 @@ void ShaderResourceCacheVk::Resource::SetStorageBuffer(RefCntAutoPtr<IDeviceObje
 #endif
 }
 
+namespace
+{
+
+using DescriptorWriteInfo = ShaderResourceCacheVk::DescriptorWriteInfo;
+
+// Initializes the write of a single descriptor. WriteInfo must be alive until the write is performed.
+void InitDescriptorWrite(const ShaderResourceCacheVk::Resource& Res,
+                         VkDescriptorSet                        vkSet,
+                         Uint32                                 BindingIndex,
+                         Uint32                                 ArrayIndex,
+                         VkWriteDescriptorSet&                  WriteDescrSet,
+                         DescriptorWriteInfo&                   WriteInfo)
+{
+    WriteDescrSet.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    WriteDescrSet.pNext           = nullptr;
+    WriteDescrSet.dstSet          = vkSet;
+    WriteDescrSet.dstBinding      = BindingIndex;
+    WriteDescrSet.dstArrayElement = ArrayIndex;
+    WriteDescrSet.descriptorCount = 1;
+    // descriptorType must be the same type as that specified in VkDescriptorSetLayoutBinding for dstSet at dstBinding.
+    // The type of the descriptor also controls which array the descriptors are taken from. (13.2.4)
+    WriteDescrSet.descriptorType   = DescriptorTypeToVkDescriptorType(Res.Type);
+    WriteDescrSet.pImageInfo       = nullptr;
+    WriteDescrSet.pBufferInfo      = nullptr;
+    WriteDescrSet.pTexelBufferView = nullptr;
+
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (Res.Type)
+    {
+        case DescriptorType::Sampler:
+            WriteInfo.vkDescrImageInfo = Res.GetSamplerDescriptorWriteInfo();
+            WriteDescrSet.pImageInfo   = &WriteInfo.vkDescrImageInfo;
+            break;
+
+        case DescriptorType::CombinedImageSampler:
+        case DescriptorType::SeparateImage:
+        case DescriptorType::StorageImage:
+            WriteInfo.vkDescrImageInfo = Res.GetImageDescriptorWriteInfo();
+            WriteDescrSet.pImageInfo   = &WriteInfo.vkDescrImageInfo;
+            break;
+
+        case DescriptorType::UniformTexelBuffer:
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+            WriteInfo.vkDescrBufferView    = Res.GetBufferViewWriteInfo();
+            WriteDescrSet.pTexelBufferView = &WriteInfo.vkDescrBufferView;
+            break;
+
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:
+            WriteInfo.vkDescrBufferInfo = Res.GetUniformBufferDescriptorWriteInfo();
+            WriteDescrSet.pBufferInfo   = &WriteInfo.vkDescrBufferInfo;
+            break;
+
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+            WriteInfo.vkDescrBufferInfo = Res.GetStorageBufferDescriptorWriteInfo();
+            WriteDescrSet.pBufferInfo   = &WriteInfo.vkDescrBufferInfo;
+            break;
+
+        case DescriptorType::InputAttachment:
+        case DescriptorType::InputAttachment_General:
+            WriteInfo.vkDescrImageInfo = Res.GetInputAttachmentDescriptorWriteInfo();
+            WriteDescrSet.pImageInfo   = &WriteInfo.vkDescrImageInfo;
+            break;
+
+        case DescriptorType::AccelerationStructure:
+            WriteInfo.vkDescrAccelStructInfo = Res.GetAccelerationStructureWriteInfo();
+            WriteDescrSet.pNext              = &WriteInfo.vkDescrAccelStructInfo;
+            break;
+
+        default:
+            UNEXPECTED("Unexpected descriptor type");
+    }
+}
+
+} // namespace
+
 const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
     const VulkanUtilities::VulkanLogicalDevice* pLogicalDevice,
     Uint32                                      DescrSetIndex,
@@ -331,88 +411,64 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
     auto vkSet = DescrSet.GetVkDescriptorSet();
     if (vkSet != VK_NULL_HANDLE && DstRes.pObject)
     {
-        VERIFY(pLogicalDevice != nullptr, "Logical device must not be null to write descriptor to a non-null set");
-
-        VkWriteDescriptorSet WriteDescrSet;
-        WriteDescrSet.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        WriteDescrSet.pNext           = nullptr;
-        WriteDescrSet.dstSet          = vkSet;
-        WriteDescrSet.dstBinding      = SrcRes.BindingIndex;
-        WriteDescrSet.dstArrayElement = SrcRes.ArrayIndex;
-        WriteDescrSet.descriptorCount = 1;
-        // descriptorType must be the same type as that specified in VkDescriptorSetLayoutBinding for dstSet at dstBinding.
-        // The type of the descriptor also controls which array the descriptors are taken from. (13.2.4)
-        WriteDescrSet.descriptorType   = DescriptorTypeToVkDescriptorType(DstRes.Type);
-        WriteDescrSet.pImageInfo       = nullptr;
-        WriteDescrSet.pBufferInfo      = nullptr;
-        WriteDescrSet.pTexelBufferView = nullptr;
-
-        // Do not zero-initialize!
-        union
+        if (m_pWriteBatch != nullptr)
         {
-            VkDescriptorImageInfo                        vkDescrImageInfo;
-            VkDescriptorBufferInfo                       vkDescrBufferInfo;
-            VkBufferView                                 vkDescrBufferView;
-            VkWriteDescriptorSetAccelerationStructureKHR vkDescrAccelStructInfo;
-        };
-
-        static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
-        switch (DstRes.Type)
+            // The descriptor will be written by EndDescriptorWriteBatch()
+            m_pWriteBatch->Writes.emplace_back();
+            auto& Write = m_pWriteBatch->Writes.back();
+            InitDescriptorWrite(DstRes, vkSet, SrcRes.BindingIndex, SrcRes.ArrayIndex, Write.vkWrite, Write.Info);
+            if (DstRes.Type == DescriptorType::AccelerationStructure)
+                Write.vkTLAS = *Write.Info.vkDescrAccelStructInfo.pAccelerationStructures;
+        }
+        else
         {
-            case DescriptorType::Sampler:
-                vkDescrImageInfo         = DstRes.GetSamplerDescriptorWriteInfo();
-                WriteDescrSet.pImageInfo = &vkDescrImageInfo;
-                break;
-
-            case DescriptorType::CombinedImageSampler:
-            case DescriptorType::SeparateImage:
-            case DescriptorType::StorageImage:
-                vkDescrImageInfo         = DstRes.GetImageDescriptorWriteInfo();
-                WriteDescrSet.pImageInfo = &vkDescrImageInfo;
-                break;
+            VERIFY(pLogicalDevice != nullptr, "Logical device must not be null to write descriptor to a non-null set");
 
-            case DescriptorType::UniformTexelBuffer:
-            case DescriptorType::StorageTexelBuffer:
-            case DescriptorType::StorageTexelBuffer_ReadOnly:
-                vkDescrBufferView              = DstRes.GetBufferViewWriteInfo();
-                WriteDescrSet.pTexelBufferView = &vkDescrBufferView;
-                break;
+            VkWriteDescriptorSet WriteDescrSet;
+            // Do not zero-initialize!
+            DescriptorWriteInfo WriteInfo;
+            InitDescriptorWrite(DstRes, vkSet, SrcRes.BindingIndex, SrcRes.ArrayIndex, WriteDescrSet, WriteInfo);
+            pLogicalDevice->UpdateDescriptorSets(1, &WriteDescrSet, 0, nullptr);
+        }
+    }
 
-            case DescriptorType::UniformBuffer:
-            case DescriptorType::UniformBufferDynamic:
-                vkDescrBufferInfo         = DstRes.GetUniformBufferDescriptorWriteInfo();
-                WriteDescrSet.pBufferInfo = &vkDescrBufferInfo;
-                break;
+    UpdateRevision();
 
-            case DescriptorType::StorageBuffer:
-            case DescriptorType::StorageBuffer_ReadOnly:
-            case DescriptorType::StorageBufferDynamic:
-            case DescriptorType::StorageBufferDynamic_ReadOnly:
-                vkDescrBufferInfo         = DstRes.GetStorageBufferDescriptorWriteInfo();
-                WriteDescrSet.pBufferInfo = &vkDescrBufferInfo;
-                break;
+    return DstRes;
+}
 
-            case DescriptorType::InputAttachment:
-            case DescriptorType::InputAttachment_General:
-                vkDescrImageInfo         = DstRes.GetInputAttachmentDescriptorWriteInfo();
-                WriteDescrSet.pImageInfo = &vkDescrImageInfo;
-                break;
+void ShaderResourceCacheVk::EndDescriptorWriteBatch(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice)
+{
+    VERIFY(m_pWriteBatch != nullptr, "There is no active descriptor write batch");
+    auto& Writes  = m_pWriteBatch->Writes;
+    m_pWriteBatch = nullptr;
 
-            case DescriptorType::AccelerationStructure:
-                vkDescrAccelStructInfo = DstRes.GetAccelerationStructureWriteInfo();
-                WriteDescrSet.pNext    = &vkDescrAccelStructInfo;
-                break;
+    if (Writes.empty())
+        return;
 
-            default:
-                UNEXPECTED("Unexpected descriptor type");
+    std::vector<VkWriteDescriptorSet> vkWrites(Writes.size());
+    for (size_t i = 0; i < Writes.size(); ++i)
+    {
+        auto& Write   = Writes[i];
+        auto& vkWrite = vkWrites[i];
+
+        // Re-point the write to the descriptor info at its final location in the vector
+        vkWrite = Write.vkWrite;
+        if (vkWrite.pImageInfo != nullptr)
+            vkWrite.pImageInfo = &Write.Info.vkDescrImageInfo;
+        if (vkWrite.pBufferInfo != nullptr)
+            vkWrite.pBufferInfo = &Write.Info.vkDescrBufferInfo;
+        if (vkWrite.pTexelBufferView != nullptr)
+            vkWrite.pTexelBufferView = &Write.Info.vkDescrBufferView;
+        if (vkWrite.pNext != nullptr)
+        {
+            Write.Info.vkDescrAccelStructInfo.pAccelerationStructures = &Write.vkTLAS;
+            vkWrite.pNext                                             = &Write.Info.vkDescrAccelStructInfo;
         }
-
-        pLogicalDevice->UpdateDescriptorSets(1, &WriteDescrSet, 0, nullptr);
     }
+    LogicalDevice.UpdateDescriptorSets(static_cast<uint32_t>(vkWrites.size()), vkWrites.data(), 0, nullptr);
 
-    UpdateRevision();
-
-    return DstRes;
+    Writes.clear();
 }
 
 void ShaderResourceCacheVk::SetDynamicBufferOffset(Uint32 DescrSetIndex,
@@ -463,6 +519,58 @@ static RESOURCE_STATE DescriptorTypeToResourceState(DescriptorType Type)
     }
 }
 
+// Returns the state the texture must be in to be accessed through the image descriptor
+static RESOURCE_STATE GetRequiredImageState(DescriptorType Type, const TextureVkImpl& TextureVk)
+{
+    // The image subresources for a storage image must be in the VK_IMAGE_LAYOUT_GENERAL layout in
+    // order to access its data in a shader (13.1.1)
+    // The image subresources for a sampled image or a combined image sampler must be in the
+    // VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+    // or VK_IMAGE_LAYOUT_GENERAL layout in order to access its data in a shader (13.1.3, 13.1.4).
+    RESOURCE_STATE RequiredState;
+    if (Type == DescriptorType::StorageImage)
+    {
+        RequiredState = RESOURCE_STATE_UNORDERED_ACCESS;
+        VERIFY_EXPR(ResourceStateToVkImageLayout(RequiredState) == VK_IMAGE_LAYOUT_GENERAL);
+    }
+    else
+    {
+        if (TextureVk.GetDesc().BindFlags & BIND_DEPTH_STENCIL)
+        {
+            // VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL must only be used as a read - only depth / stencil attachment
+            // in a VkFramebuffer and/or as a read - only image in a shader (which can be read as a sampled image, combined
+            // image / sampler and /or input attachment). This layout is valid only for image subresources of images created
+            // with the VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT usage bit enabled. (11.4)
+            RequiredState = RESOURCE_STATE_DEPTH_READ;
+            VERIFY_EXPR(ResourceStateToVkImageLayout(RequiredState) == VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL);
+        }
+        else
+        {
+            RequiredState = RESOURCE_STATE_SHADER_RESOURCE;
+            VERIFY_EXPR(ResourceStateToVkImageLayout(RequiredState) == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+        }
+    }
+    return RequiredState;
+}
+
+void ShaderResourceCacheVk::AcquireTransientTextures(DeviceContextVkImpl* pCtxVkImpl)
+{
+    auto* pResources = GetFirstResourcePtr();
+    for (Uint32 res = 0; res < m_TotalResources; ++res)
+    {
+        auto& Res = pResources[res];
+        if (Res.Type != DescriptorType::CombinedImageSampler &&
+            Res.Type != DescriptorType::SeparateImage &&
+            Res.Type != DescriptorType::StorageImage)
+            continue;
+
+        auto* pTextureViewVk = Res.pObject.RawPtr<TextureViewVkImpl>();
+        auto* pTextureVk     = pTextureViewVk != nullptr ? pTextureViewVk->GetTexture<TextureVkImpl>() : nullptr;
+        if (pTextureVk != nullptr && pTextureVk->IsAliased())
+            pCtxVkImpl->AcquireTransientTexture(*pTextureVk, GetRequiredImageState(Res.Type, *pTextureVk));
+    }
+}
+
 template <bool VerifyOnly>
 void ShaderResourceCacheVk::TransitionResources(DeviceContextVkImpl* pCtxVkImpl)
 {
@@ -562,35 +670,8 @@ void ShaderResourceCacheVk::TransitionResources(DeviceContextVkImpl* pCtxVkImpl)
                 auto* pTextureVk     = pTextureViewVk != nullptr ? pTextureViewVk->GetTexture<TextureVkImpl>() : nullptr;
                 if (pTextureVk != nullptr && pTextureVk->IsInKnownState())
                 {
-                    // The image subresources for a storage image must be in the VK_IMAGE_LAYOUT_GENERAL layout in
-                    // order to access its data in a shader (13.1.1)
-                    // The image subresources for a sampled image or a combined image sampler must be in the
-                    // VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-                    // or VK_IMAGE_LAYOUT_GENERAL layout in order to access its data in a shader (13.1.3, 13.1.4).
-                    RESOURCE_STATE RequiredState;
-                    if (Res.Type == DescriptorType::StorageImage)
-                    {
-                        RequiredState = RESOURCE_STATE_UNORDERED_ACCESS;
-                        VERIFY_EXPR(ResourceStateToVkImageLayout(RequiredState) == VK_IMAGE_LAYOUT_GENERAL);
-                    }
-                    else
-                    {
-                        if (pTextureVk->GetDesc().BindFlags & BIND_DEPTH_STENCIL)
-                        {
-                            // VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL must only be used as a read - only depth / stencil attachment
-                            // in a VkFramebuffer and/or as a read - only image in a shader (which can be read as a sampled image, combined
-                            // image / sampler and /or input attachment). This layout is valid only for image subresources of images created
-                            // with the VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT usage bit enabled. (11.4)
-                            RequiredState = RESOURCE_STATE_DEPTH_READ;
-                            VERIFY_EXPR(ResourceStateToVkImageLayout(RequiredState) == VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL);
-                        }
-                        else
-                        {
-                            RequiredState = RESOURCE_STATE_SHADER_RESOURCE;
-                            VERIFY_EXPR(ResourceStateToVkImageLayout(RequiredState) == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-                        }
-                    }
-                    const bool IsInRequiredState = pTextureVk->CheckState(RequiredState);
+                    const RESOURCE_STATE RequiredState     = GetRequiredImageState(Res.Type, *pTextureVk);
+                    const bool           IsInRequiredState = pTextureVk->CheckState(RequiredState);
 
                     if (VerifyOnly)
                     {
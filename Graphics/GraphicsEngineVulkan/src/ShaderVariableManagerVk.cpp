@@ -56,6 +56,10 @@ void ProcessSignatureResources(const PipelineResourceSignatureVkImpl& Signature,
                                        (!UsingSeparateSamplers || ResAttr.IsImmutableSamplerAssigned()))
                                        return;
 
+                                   // Bindless heap resources are not bound through shader variables
+                                   if (PipelineResourceSignatureVkImpl::IsBindlessHeapResource(ResDesc))
+                                       return;
+
                                    Handler(Index);
                                });
 }
@@ -163,22 +167,28 @@ const PipelineResourceDesc& ShaderVariableManagerVk::GetResourceDesc(Uint32 Inde
     return m_pSignature->GetResourceDesc(Index);
 }
 
+Uint32 ShaderVariableManagerVk::GetResourceNameId(Uint32 Index) const
+{
+    VERIFY_EXPR(m_pSignature);
+    return m_pSignature->GetResourceNameId(Index);
+}
+
 const ShaderVariableManagerVk::ResourceAttribs& ShaderVariableManagerVk::GetResourceAttribs(Uint32 Index) const
 {
     VERIFY_EXPR(m_pSignature);
     return m_pSignature->GetResourceAttribs(Index);
 }
 
-void ShaderVariableManagerVk::BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags)
+void ShaderVariableManagerVk::BindResources(const ResourceMappingAccessor& ResMapping, BIND_SHADER_RESOURCES_FLAGS Flags)
 {
-    TBase::BindResources(pResourceMapping, Flags);
+    TBase::BindResources(ResMapping, Flags);
 }
 
-void ShaderVariableManagerVk::CheckResources(IResourceMapping*                    pResourceMapping,
+void ShaderVariableManagerVk::CheckResources(const ResourceMappingAccessor&       ResMapping,
                                              BIND_SHADER_RESOURCES_FLAGS          Flags,
                                              SHADER_RESOURCE_VARIABLE_TYPE_FLAGS& StaleVarTypes) const
 {
-    TBase::CheckResources(pResourceMapping, Flags, StaleVarTypes);
+    TBase::CheckResources(ResMapping, Flags, StaleVarTypes);
 }
 
 
@@ -61,6 +61,12 @@ ShaderVkImpl::ShaderVkImpl(IReferenceCounters*     pRefCounters,
         IsDeviceInternal
     }
 // clang-format on
+{
+    // VkShaderCI only references objects owned by the device, so it is safe to copy it
+    ConstructShader(ShaderCI, [this, VkShaderCI](const ShaderCreateInfo& CI) { Initialize(CI, VkShaderCI); });
+}
+
+void ShaderVkImpl::Initialize(const ShaderCreateInfo& ShaderCI, const CreateInfo& VkShaderCI) noexcept(false)
 {
     if (ShaderCI.Source != nullptr || ShaderCI.FilePath != nullptr)
     {
@@ -241,6 +247,7 @@ void ShaderVkImpl::MapHLSLVertexShaderInputs()
 
 ShaderVkImpl::~ShaderVkImpl()
 {
+    CancelAsyncInitialization();
 }
 
 void ShaderVkImpl::GetResourceDesc(Uint32 Index, ShaderResourceDesc& ResourceDesc) const
@@ -51,6 +51,22 @@ TextureViewVkImpl::TextureViewVkImpl(IReferenceCounters*                 pRefCou
     m_ImageView{std::move(ImgView)}
 // clang-format on
 {
+    if (auto* pBindlessHeap = pDevice->GetBindlessHeap())
+    {
+        if (m_Desc.ViewType == TEXTURE_VIEW_SHADER_RESOURCE)
+        {
+            // The layout must match the one used by the shader resource cache
+            const auto Layout = (m_pTexture->GetDesc().BindFlags & BIND_DEPTH_STENCIL) != 0 ?
+                VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL :
+                VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+            m_BindlessHeapIndex = pBindlessHeap->AllocateImageView(BindlessHeapVk::BINDING_TEXTURE_SRV, m_ImageView, Layout);
+        }
+        else if (m_Desc.ViewType == TEXTURE_VIEW_UNORDERED_ACCESS)
+        {
+            m_BindlessHeapIndex = pBindlessHeap->AllocateImageView(BindlessHeapVk::BINDING_TEXTURE_UAV, m_ImageView, VK_IMAGE_LAYOUT_GENERAL);
+        }
+    }
 }
 
 TextureViewVkImpl::~TextureViewVkImpl()
@@ -61,6 +77,11 @@ TextureViewVkImpl::~TextureViewVkImpl()
     {
         m_pDevice->GetFramebufferCache().OnDestroyImageView(m_ImageView);
     }
+    if (m_BindlessHeapIndex != BindlessHeapVk::InvalidIndex)
+    {
+        const auto Binding = m_Desc.ViewType == TEXTURE_VIEW_SHADER_RESOURCE ? BindlessHeapVk::BINDING_TEXTURE_SRV : BindlessHeapVk::BINDING_TEXTURE_UAV;
+        m_pDevice->GetBindlessHeap()->Free(Binding, m_BindlessHeapIndex, m_pTexture->GetDesc().ImmediateContextMask);
+    }
     m_pDevice->SafeReleaseDeviceObject(std::move(m_ImageView), m_pTexture->GetDesc().ImmediateContextMask);
 }
 
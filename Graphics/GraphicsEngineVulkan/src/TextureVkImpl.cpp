@@ -34,6 +34,7 @@
 #include "EngineMemory.h"
 #include "StringTools.hpp"
 #include "GraphicsAccessories.hpp"
+#include "TransientMemoryVk.hpp"
 
 namespace Diligent
 {
@@ -209,11 +210,16 @@ TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
         {
             m_VulkanImage = LogicalDevice.CreateImage(ImageCI, m_Desc.Name);
 
-            VkMemoryRequirements MemReqs = LogicalDevice.GetImageMemoryRequirements(m_VulkanImage);
+            VkMemoryDedicatedRequirements DedicatedReqs = {};
+            VkMemoryRequirements          MemReqs       = LogicalDevice.GetImageMemoryRequirements(m_VulkanImage, &DedicatedReqs);
+
+            VulkanUtilities::VulkanDedicatedResource DedicatedRes;
+            DedicatedRes.Image            = m_VulkanImage;
+            DedicatedRes.PrefersDedicated = DedicatedReqs.prefersDedicatedAllocation != VK_FALSE || DedicatedReqs.requiresDedicatedAllocation != VK_FALSE;
 
             const auto ImageMemoryFlags = IsMemoryless ? VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT : VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
             VERIFY(IsPowerOfTwo(MemReqs.alignment), "Alignment is not power of 2!");
-            m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs, ImageMemoryFlags);
+            m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs, ImageMemoryFlags, 0, &DedicatedRes);
             auto AlignedOffset = AlignUp(m_MemoryAllocation.UnalignedOffset, MemReqs.alignment);
             VERIFY_EXPR(m_MemoryAllocation.Size >= MemReqs.size + (AlignedOffset - m_MemoryAllocation.UnalignedOffset));
             auto Memory = m_MemoryAllocation.Page->GetVkMemory();
@@ -520,6 +526,25 @@ TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
         InitSparseProperties();
 }
 
+TextureVkImpl::TextureVkImpl(IReferenceCounters*                pRefCounters,
+                             FixedBlockMemoryAllocator&         TexViewObjAllocator,
+                             RenderDeviceVkImpl*                pDeviceVk,
+                             const TextureDesc&                 TexDesc,
+                             VulkanUtilities::ImageWrapper&&    Image,
+                             std::shared_ptr<TransientMemoryVk> pTransientMemory,
+                             Uint32                             TransientIndex) :
+    // clang-format off
+    TTextureBase{pRefCounters, TexViewObjAllocator, pDeviceVk, TexDesc},
+    m_VulkanImage     {std::move(Image)},
+    m_pTransientMemory{std::move(pTransientMemory)},
+    m_TransientIndex  {TransientIndex},
+    m_IsAliased       {m_pTransientMemory->IsAliased(TransientIndex)}
+// clang-format on
+{
+    VERIFY_EXPR(m_Desc.Usage == USAGE_DEFAULT);
+    SetState(RESOURCE_STATE_UNDEFINED);
+}
+
 void TextureVkImpl::CreateViewInternal(const TextureViewDesc& ViewDesc, ITextureView** ppView, bool bIsDefaultView)
 {
     VERIFY(ppView != nullptr, "View pointer address is null");
@@ -561,6 +586,8 @@ TextureVkImpl::~TextureVkImpl()
     if (m_StagingBuffer)
         m_pDevice->SafeReleaseDeviceObject(std::move(m_StagingBuffer), m_Desc.ImmediateContextMask);
     m_pDevice->SafeReleaseDeviceObject(std::move(m_MemoryAllocation), m_Desc.ImmediateContextMask);
+    // Shared transient memory is released when the last texture that uses it is destroyed
+    m_pTransientMemory.reset();
 }
 
 VulkanUtilities::ImageViewWrapper TextureVkImpl::CreateImageView(TextureViewDesc& ViewDesc)
@@ -0,0 +1,145 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "TransientMemoryVk.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include "RenderDeviceVkImpl.hpp"
+#include "Align.hpp"
+
+namespace Diligent
+{
+
+VkDeviceSize TransientMemoryVk::PlaceResources(const std::vector<ResourceInfo>& Resources, std::vector<Range>& Ranges)
+{
+    Ranges.assign(Resources.size(), Range{});
+
+    // Placing larger resources first reduces fragmentation
+    std::vector<Uint32> Order(Resources.size());
+    std::iota(Order.begin(), Order.end(), 0u);
+    std::stable_sort(Order.begin(), Order.end(),
+                     [&Resources](Uint32 lhs, Uint32 rhs) {
+                         return Resources[lhs].Size > Resources[rhs].Size;
+                     });
+
+    VkDeviceSize        RequiredSize = 0;
+    std::vector<Uint32> Placed;
+    std::vector<Range>  Occupied;
+    Placed.reserve(Resources.size());
+    for (auto i : Order)
+    {
+        const auto& Res = Resources[i];
+        VERIFY(IsPowerOfTwo(Res.Alignment), "Alignment is not power of 2!");
+
+        // Memory ranges of the placed resources that are alive at the same time as this one
+        Occupied.clear();
+        for (auto j : Placed)
+        {
+            if (Resources[j].FirstPass <= Res.LastPass && Res.FirstPass <= Resources[j].LastPass)
+                Occupied.push_back(Ranges[j]);
+        }
+        std::sort(Occupied.begin(), Occupied.end(),
+                  [](const Range& lhs, const Range& rhs) {
+                      return lhs.Offset < rhs.Offset;
+                  });
+
+        // Find the lowest offset at which the resource does not intersect any occupied range
+        VkDeviceSize Offset = 0;
+        for (const auto& Occ : Occupied)
+        {
+            if (Offset + Res.Size <= Occ.Offset)
+                break;
+            Offset = std::max(Offset, AlignUp(Occ.Offset + Occ.Size, Res.Alignment));
+        }
+
+        Ranges[i]    = {Offset, Res.Size};
+        RequiredSize = std::max(RequiredSize, Offset + Res.Size);
+        Placed.push_back(i);
+    }
+
+    return RequiredSize;
+}
+
+TransientMemoryVk::TransientMemoryVk(RenderDeviceVkImpl&                       DeviceVk,
+                                     VulkanUtilities::VulkanMemoryAllocation&& Allocation,
+                                     VkDeviceSize                              Alignment,
+                                     std::vector<Range>                        Ranges,
+                                     BIND_FLAGS                                BindFlags,
+                                     Uint64                                    ImmediateContextMask) :
+    // clang-format off
+    m_DeviceVk            {DeviceVk},
+    m_Allocation          {std::move(Allocation)},
+    m_BaseOffset          {AlignUp(m_Allocation.UnalignedOffset, Alignment)},
+    m_Ranges              {std::move(Ranges)},
+    m_Aliases             (m_Ranges.size()),
+    m_BindFlags           {BindFlags},
+    m_ImmediateContextMask{ImmediateContextMask}
+// clang-format on
+{
+    for (Uint32 i = 0; i < m_Ranges.size(); ++i)
+    {
+        const auto& Range0 = m_Ranges[i];
+        VERIFY_EXPR(m_BaseOffset + Range0.Offset + Range0.Size <= m_Allocation.UnalignedOffset + m_Allocation.Size);
+        for (Uint32 j = i + 1; j < m_Ranges.size(); ++j)
+        {
+            const auto& Range1 = m_Ranges[j];
+            if (Range0.Offset < Range1.Offset + Range1.Size && Range1.Offset < Range0.Offset + Range0.Size)
+            {
+                m_Aliases[i].push_back(j);
+                m_Aliases[j].push_back(i);
+            }
+        }
+    }
+}
+
+TransientMemoryVk::~TransientMemoryVk()
+{
+    m_DeviceVk.SafeReleaseDeviceObject(std::move(m_Allocation), m_ImmediateContextMask);
+}
+
+bool TransientMemoryVk::Acquire(Uint32 Index, std::vector<bool>& IsOwner) const
+{
+    VERIFY_EXPR(Index < m_Ranges.size());
+
+    if (IsOwner.empty())
+        IsOwner.resize(m_Ranges.size(), false);
+    VERIFY_EXPR(IsOwner.size() == m_Ranges.size());
+
+    if (IsOwner[Index])
+        return false;
+
+    IsOwner[Index] = true;
+    for (auto Alias : m_Aliases[Index])
+        IsOwner[Alias] = false;
+
+    return true;
+}
+
+} // namespace Diligent
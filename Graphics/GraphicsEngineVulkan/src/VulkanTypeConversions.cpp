@@ -2009,6 +2009,17 @@ DeviceFeatures VkFeaturesToDeviceFeatures(uint32_t
                   ExtFeatures.ShadingRate.attachmentFragmentShadingRate != VK_FALSE ||
                   ExtFeatures.FragmentDensityMap.fragmentDensityMap != VK_FALSE));
 
+#if DILIGENT_USE_VOLK
+    INIT_FEATURE(NativeMultiDraw,
+                 ExtFeatures.MultiDraw.multiDraw != VK_FALSE);
+#else
+    // vkCmdDrawMulti*EXT commands are not exported by the static Vulkan library
+    INIT_FEATURE(NativeMultiDraw, false);
+#endif
+
+    // Shaders and pipelines are compiled by the engine's thread pool
+    INIT_FEATURE(AsyncShaderCompilation, true);
+
 #undef INIT_FEATURE
 
     // Not supported in Vulkan on top of Metal.
@@ -2018,7 +2029,7 @@ DeviceFeatures VkFeaturesToDeviceFeatures(uint32_t
     Features.DurationQueries        = DEVICE_FEATURE_STATE_DISABLED;
 #endif
 
-    ASSERT_SIZEOF(DeviceFeatures, 39, "Did you add a new feature to DeviceFeatures? Please handle its status here (if necessary).");
+    ASSERT_SIZEOF(DeviceFeatures, 41, "Did you add a new feature to DeviceFeatures? Please handle its status here (if necessary).");
 
     return Features;
 }
@@ -155,7 +155,7 @@ void VulkanCommandBuffer::TransitionImageLayout(VkImage                        I
                                                 VkPipelineStageFlags           SrcStages,
                                                 VkPipelineStageFlags           DstStages)
 {
-    if (m_State.RenderPass != VK_NULL_HANDLE)
+    if (IsInRenderPass())
     {
         // Image layout transitions within a render pass execute
         // dependencies between attachments
@@ -228,7 +228,7 @@ void VulkanCommandBuffer::MemoryBarrier(VkAccessFlags        srcAccessMask,
                                         VkPipelineStageFlags SrcStages,
                                         VkPipelineStageFlags DstStages)
 {
-    if (m_State.RenderPass != VK_NULL_HANDLE)
+    if (IsInRenderPass())
     {
         EndRenderPass();
     }
@@ -248,7 +248,7 @@ void VulkanCommandBuffer::FlushBarriers()
     if (m_Barrier.MemorySrcStages == 0 && m_Barrier.MemoryDstStages == 0 && m_ImageBarriers.empty())
         return;
 
-    if (m_State.RenderPass != VK_NULL_HANDLE)
+    if (IsInRenderPass())
     {
         EndRenderPass();
     }
@@ -27,6 +27,7 @@
 
 #include "pch.h"
 #include <sstream>
+#include <vector>
 #include "VulkanUtilities/VulkanMemoryManager.hpp"
 
 namespace VulkanUtilities
@@ -40,16 +41,24 @@ VulkanMemoryAllocation::~VulkanMemoryAllocation()
     }
 }
 
-VulkanMemoryPage::VulkanMemoryPage(VulkanMemoryManager&  ParentMemoryMgr,
-                                   VkDeviceSize          PageSize,
-                                   uint32_t              MemoryTypeIndex,
-                                   bool                  IsHostVisible,
-                                   VkMemoryAllocateFlags AllocateFlags) noexcept :
+VulkanMemoryPage::VulkanMemoryPage(VulkanMemoryManager&                 ParentMemoryMgr,
+                                   VulkanMemoryPagePool&                ParentPool,
+                                   Diligent::Uint32                     SizeClass,
+                                   VkDeviceSize                         PageSize,
+                                   uint32_t                             MemoryTypeIndex,
+                                   bool                                 IsHostVisible,
+                                   VkMemoryAllocateFlags                AllocateFlags,
+                                   const VkMemoryDedicatedAllocateInfo* pDedicatedInfo) noexcept :
     // clang-format off
     m_ParentMemoryMgr{ParentMemoryMgr},
+    m_ParentPool     {ParentPool},
+    m_SizeClass      {SizeClass},
+    m_MemoryTypeIndex{MemoryTypeIndex},
+    m_IsDedicated    {pDedicatedInfo != nullptr},
     m_AllocationMgr  {static_cast<AllocationsMgrOffsetType>(PageSize), ParentMemoryMgr.m_Allocator}
 // clang-format on
 {
+    VERIFY_EXPR(SizeClass < VulkanMemoryPagePool::SizeClassCount);
     VERIFY(PageSize <= std::numeric_limits<AllocationsMgrOffsetType>::max(),
            "PageSize (", PageSize, ") exceeds maximum allowed value ",
            std::numeric_limits<AllocationsMgrOffsetType>::max());
@@ -70,6 +79,17 @@ VulkanMemoryPage::VulkanMemoryPage(VulkanMemoryManager&  ParentMemoryMgr,
         MemFlagInfo.flags = AllocateFlags;
     }
 
+    VkMemoryDedicatedAllocateInfo DedicatedInfo = {};
+    if (pDedicatedInfo != nullptr)
+    {
+        VERIFY((pDedicatedInfo->buffer != VK_NULL_HANDLE) != (pDedicatedInfo->image != VK_NULL_HANDLE),
+               "Exactly one of buffer and image must be specified for dedicated allocation");
+        DedicatedInfo       = *pDedicatedInfo;
+        DedicatedInfo.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+        DedicatedInfo.pNext = MemAlloc.pNext;
+        MemAlloc.pNext      = &DedicatedInfo;
+    }
+
     auto MemoryName = Diligent::FormatString("Device memory page. Size: ", Diligent::FormatMemorySize(PageSize, 2), ", type: ", MemoryTypeIndex);
     m_VkMemory      = ParentMemoryMgr.m_LogicalDevice.AllocateDeviceMemory(MemAlloc, MemoryName.c_str());
 
@@ -83,6 +103,9 @@ VulkanMemoryPage::VulkanMemoryPage(VulkanMemoryManager&  ParentMemoryMgr,
             &m_CPUMemory);
         CHECK_VK_ERROR_AND_THROW(err, "Failed to map staging memory");
     }
+
+    if (!m_IsDedicated)
+        m_FreeBlockIndexIt = m_ParentPool.PagesByMaxFreeBlock[m_SizeClass].emplace(GetMaxFreeBlockSize(), this);
 }
 
 VulkanMemoryPage::~VulkanMemoryPage()
@@ -94,11 +117,27 @@ VulkanMemoryPage::~VulkanMemoryPage()
     }
 
     VERIFY(IsEmpty(), "Destroying a page with not all allocations released");
+
+    if (!m_IsDedicated)
+        m_ParentPool.PagesByMaxFreeBlock[m_SizeClass].erase(m_FreeBlockIndexIt);
+}
+
+void VulkanMemoryPage::UpdateFreeBlockIndex()
+{
+    if (m_IsDedicated)
+        return;
+
+    const auto MaxFreeBlockSize = GetMaxFreeBlockSize();
+    if (m_FreeBlockIndexIt->first == MaxFreeBlockSize)
+        return;
+
+    auto& PagesByMaxFreeBlock = m_ParentPool.PagesByMaxFreeBlock[m_SizeClass];
+    PagesByMaxFreeBlock.erase(m_FreeBlockIndexIt);
+    m_FreeBlockIndexIt = PagesByMaxFreeBlock.emplace(MaxFreeBlockSize, this);
 }
 
 VulkanMemoryAllocation VulkanMemoryPage::Allocate(VkDeviceSize size, VkDeviceSize alignment)
 {
-    std::lock_guard<std::mutex> Lock{m_Mutex};
     VERIFY(size <= std::numeric_limits<AllocationsMgrOffsetType>::max(),
            "Allocation size (", size, ") exceeds maximum allowed value ",
            std::numeric_limits<AllocationsMgrOffsetType>::max());
@@ -108,6 +147,7 @@ VulkanMemoryAllocation VulkanMemoryPage::Allocate(VkDeviceSize size, VkDeviceSiz
         // Offset may not necessarily be aligned, but the allocation is guaranteed to be large enough
         // to accommodate requested alignment
         VERIFY_EXPR(Diligent::AlignUp(VkDeviceSize{Allocation.UnalignedOffset}, alignment) - Allocation.UnalignedOffset + size <= Allocation.Size);
+        UpdateFreeBlockIndex();
         return VulkanMemoryAllocation{this, Allocation.UnalignedOffset, Allocation.Size};
     }
     else
@@ -119,14 +159,23 @@ VulkanMemoryAllocation VulkanMemoryPage::Allocate(VkDeviceSize size, VkDeviceSiz
 void VulkanMemoryPage::Free(VulkanMemoryAllocation&& Allocation)
 {
     m_ParentMemoryMgr.OnFreeAllocation(Allocation.Size, m_CPUMemory != nullptr);
-    std::lock_guard<std::mutex> Lock{m_Mutex};
+    std::lock_guard<std::mutex> Lock{m_ParentPool.Mtx};
     VERIFY_EXPR(Allocation.UnalignedOffset <= std::numeric_limits<AllocationsMgrOffsetType>::max());
     VERIFY_EXPR(Allocation.Size <= std::numeric_limits<AllocationsMgrOffsetType>::max());
     m_AllocationMgr.Free(static_cast<AllocationsMgrOffsetType>(Allocation.UnalignedOffset), static_cast<AllocationsMgrOffsetType>(Allocation.Size));
     Allocation = VulkanMemoryAllocation{};
+    if (m_IsDedicated)
+    {
+        // Dedicated memory is released immediately. The page is destroyed and must not be accessed after this call.
+        m_ParentMemoryMgr.DestroyDedicatedPage(*this);
+    }
+    else
+    {
+        UpdateFreeBlockIndex();
+    }
 }
 
-VulkanMemoryAllocation VulkanMemoryManager::Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags)
+VulkanMemoryAllocation VulkanMemoryManager::Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags, const VulkanDedicatedResource* pDedicatedRes)
 {
     // memoryTypeBits is a bitmask and contains one bit set for every supported memory type for the resource.
     // Bit i is set if the memory type i in the VkPhysicalDeviceMemoryProperties structure for the
@@ -155,11 +204,116 @@ VulkanMemoryAllocation VulkanMemoryManager::Allocate(const VkMemoryRequirements&
     }
 
     bool HostVisible = (MemoryProps & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0;
-    return Allocate(MemReqs.size, MemReqs.alignment, MemoryTypeIndex, HostVisible, AllocateFlags);
+    return Allocate(MemReqs.size, MemReqs.alignment, MemoryTypeIndex, HostVisible, AllocateFlags, pDedicatedRes);
 }
 
-VulkanMemoryAllocation VulkanMemoryManager::Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags)
+VulkanMemoryPagePool& VulkanMemoryManager::GetPagePool(const MemoryPageIndex& PageIdx)
 {
+    std::lock_guard<std::mutex> Lock{m_PagesMtx};
+
+    auto& pPool = m_PagePools[PageIdx];
+    if (!pPool)
+        pPool.reset(new VulkanMemoryPagePool);
+    return *pPool;
+}
+
+bool VulkanMemoryManager::UseDedicatedAllocation(VkDeviceSize Size, const VulkanDedicatedResource& DedicatedRes) const
+{
+    if (!m_LogicalDevice.GetEnabledExtFeatures().DedicatedAllocation)
+        return false;
+
+    // Resources that are comparable to the page size would otherwise inflate the page size
+    // and strand free space that only resources of the same size can use.
+    return DedicatedRes.PrefersDedicated || (m_DedicatedAllocationThreshold != 0 && Size >= m_DedicatedAllocationThreshold);
+}
+
+void VulkanMemoryManager::UpdateAllocatedSize(uint32_t MemoryTypeIndex, bool IsHostVisible, int64_t Delta, bool IsDedicated)
+{
+    const auto stat_ind = IsHostVisible ? 1 : 0;
+    const auto HeapIdx  = m_PhysicalDevice.GetMemoryProperties().memoryTypes[MemoryTypeIndex].heapIndex;
+    VERIFY_EXPR(HeapIdx < m_HeapStats.size());
+    VERIFY_EXPR(Delta >= 0 || m_CurrAllocatedSize[stat_ind] >= static_cast<VkDeviceSize>(-Delta));
+
+    // Unsigned arithmetic correctly handles negative deltas
+    m_CurrAllocatedSize[stat_ind] += static_cast<VkDeviceSize>(Delta);
+    m_PeakAllocatedSize[stat_ind] = std::max(m_PeakAllocatedSize[stat_ind], m_CurrAllocatedSize[stat_ind]);
+
+    auto& HeapStats = m_HeapStats[HeapIdx];
+    HeapStats.AllocatedSize += static_cast<VkDeviceSize>(Delta);
+    if (IsDedicated)
+    {
+        VERIFY_EXPR(Delta >= 0 || HeapStats.DedicatedCount > 0);
+        HeapStats.DedicatedSize += static_cast<VkDeviceSize>(Delta);
+        if (Delta >= 0)
+            ++HeapStats.DedicatedCount;
+        else
+            --HeapStats.DedicatedCount;
+    }
+}
+
+VulkanMemoryManager::HeapStatistics VulkanMemoryManager::GetHeapStatistics(uint32_t HeapIndex)
+{
+    std::lock_guard<std::mutex> Lock{m_PagesMtx};
+    return HeapIndex < m_HeapStats.size() ? m_HeapStats[HeapIndex] : HeapStatistics{};
+}
+
+VulkanMemoryAllocation VulkanMemoryManager::AllocateDedicated(VkDeviceSize Size, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags, const VulkanDedicatedResource& DedicatedRes)
+{
+    VkMemoryDedicatedAllocateInfo DedicatedInfo = {};
+
+    DedicatedInfo.sType  = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+    DedicatedInfo.buffer = DedicatedRes.Buffer;
+    DedicatedInfo.image  = DedicatedRes.Image;
+
+    auto& Pool = GetPagePool(MemoryPageIndex{MemoryTypeIndex, HostVisible, AllocateFlags});
+
+    std::lock_guard<std::mutex> Lock{Pool.Mtx};
+
+    // The size of the dedicated allocation must be exactly the size of the resource.
+    // Offset 0 satisfies any alignment requirement.
+    std::unique_ptr<VulkanMemoryPage> pPage{new VulkanMemoryPage{*this, Pool, 0, Size, MemoryTypeIndex, HostVisible, AllocateFlags, &DedicatedInfo}};
+
+    auto Allocation = pPage->Allocate(Size, 1);
+    DEV_CHECK_ERR(Allocation.Page != nullptr && Allocation.UnalignedOffset == 0, "Failed to allocate memory from the dedicated page");
+
+    {
+        std::lock_guard<std::mutex> StatsLock{m_PagesMtx};
+        UpdateAllocatedSize(MemoryTypeIndex, HostVisible, static_cast<int64_t>(Size), /*IsDedicated = */ true);
+    }
+    OnNewPageCreated(*pPage);
+
+    auto* pPageRaw = pPage.get();
+    Pool.DedicatedPages.emplace(pPageRaw, std::move(pPage));
+
+    const size_t stat_ind = HostVisible ? 1 : 0;
+    m_CurrUsedSize[stat_ind].fetch_add(Allocation.Size);
+    m_PeakUsedSize[stat_ind] = std::max(m_PeakUsedSize[stat_ind], static_cast<VkDeviceSize>(m_CurrUsedSize[stat_ind].load()));
+
+    return Allocation;
+}
+
+void VulkanMemoryManager::DestroyDedicatedPage(VulkanMemoryPage& Page)
+{
+    VERIFY_EXPR(Page.IsDedicated() && Page.IsEmpty());
+
+    {
+        std::lock_guard<std::mutex> StatsLock{m_PagesMtx};
+        UpdateAllocatedSize(Page.GetMemoryTypeIndex(), Page.GetCPUMemory() != nullptr, -static_cast<int64_t>(Page.GetPageSize()), /*IsDedicated = */ true);
+    }
+    OnPageDestroy(Page);
+
+    auto& DedicatedPages = Page.m_ParentPool.DedicatedPages;
+
+    auto it = DedicatedPages.find(&Page);
+    VERIFY_EXPR(it != DedicatedPages.end());
+    DedicatedPages.erase(it);
+}
+
+VulkanMemoryAllocation VulkanMemoryManager::Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags, const VulkanDedicatedResource* pDedicatedRes)
+{
+    if (pDedicatedRes != nullptr && UseDedicatedAllocation(Size, *pDedicatedRes))
+        return AllocateDedicated(Size, MemoryTypeIndex, HostVisible, AllocateFlags, *pDedicatedRes);
+
     VulkanMemoryAllocation Allocation;
 
     // On integrated GPUs, there is no difference between host-visible and GPU-only
@@ -169,13 +323,20 @@ VulkanMemoryAllocation VulkanMemoryManager::Allocate(VkDeviceSize Size, VkDevice
     // even though on integrated GPUs same pages can be used for both GPU-only and staging
     // allocations. Staging allocations are short-living and will be released when upload is
     // complete, while GPU-only allocations are expected to be long-living.
-    MemoryPageIndex             PageIdx{MemoryTypeIndex, HostVisible, AllocateFlags};
-    std::lock_guard<std::mutex> Lock{m_PagesMtx};
+    const MemoryPageIndex PageIdx{MemoryTypeIndex, HostVisible, AllocateFlags};
+
+    auto&      Pool      = GetPagePool(PageIdx);
+    const auto SizeClass = GetSizeClass(Size, HostVisible);
+
+    std::lock_guard<std::mutex> Lock{Pool.Mtx};
 
-    auto range = m_Pages.equal_range(PageIdx);
-    for (auto page_it = range.first; page_it != range.second; ++page_it)
+    // Pages whose largest free block is smaller than the aligned size can't accommodate the allocation.
+    // The first page in the index is the best fit, but may still fail because of the alignment reserve.
+    auto& PagesByMaxFreeBlock = Pool.PagesByMaxFreeBlock[SizeClass];
+    for (auto page_it = PagesByMaxFreeBlock.lower_bound(Diligent::AlignUp(Size, Alignment)); page_it != PagesByMaxFreeBlock.end(); ++page_it)
     {
-        Allocation = page_it->second.Allocate(Size, Alignment);
+        // Successful allocation invalidates the iterator, so we must break immediately
+        Allocation = page_it->second->Allocate(Size, Alignment);
         if (Allocation.Page != nullptr)
             break;
     }
@@ -187,15 +348,20 @@ VulkanMemoryAllocation VulkanMemoryManager::Allocate(VkDeviceSize Size, VkDevice
         while (PageSize < Size)
             PageSize *= 2;
 
-        m_CurrAllocatedSize[stat_ind] += PageSize;
-        m_PeakAllocatedSize[stat_ind] = std::max(m_PeakAllocatedSize[stat_ind], m_CurrAllocatedSize[stat_ind]);
+        VkDeviceSize CurrAllocatedSize = 0;
+        {
+            std::lock_guard<std::mutex> StatsLock{m_PagesMtx};
+            UpdateAllocatedSize(MemoryTypeIndex, HostVisible, static_cast<int64_t>(PageSize));
+            CurrAllocatedSize = m_CurrAllocatedSize[stat_ind];
+        }
 
-        auto it = m_Pages.emplace(PageIdx, VulkanMemoryPage{*this, PageSize, MemoryTypeIndex, HostVisible, AllocateFlags});
+        Pool.Pages.emplace_back(*this, Pool, SizeClass, PageSize, MemoryTypeIndex, HostVisible, AllocateFlags);
+        auto& NewPage = Pool.Pages.back();
         LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "': created new ", (HostVisible ? "host-visible" : "device-local"),
                          " page. (", Diligent::FormatMemorySize(PageSize, 2), ", type idx: ", MemoryTypeIndex,
-                         "). Current allocated size: ", Diligent::FormatMemorySize(m_CurrAllocatedSize[stat_ind], 2));
-        OnNewPageCreated(it->second);
-        Allocation = it->second.Allocate(Size, Alignment);
+                         "). Current allocated size: ", Diligent::FormatMemorySize(CurrAllocatedSize, 2));
+        OnNewPageCreated(NewPage);
+        Allocation = NewPage.Allocate(Size, Alignment);
         DEV_CHECK_ERR(Allocation.Page != nullptr, "Failed to allocate new memory page");
     }
 
@@ -212,28 +378,48 @@ VulkanMemoryAllocation VulkanMemoryManager::Allocate(VkDeviceSize Size, VkDevice
 
 void VulkanMemoryManager::ShrinkMemory()
 {
-    std::lock_guard<std::mutex> Lock{m_PagesMtx};
-    if (m_CurrAllocatedSize[0] <= m_DeviceLocalReserveSize && m_CurrAllocatedSize[1] <= m_HostVisibleReserveSize)
-        return;
+    std::vector<VulkanMemoryPagePool*> Pools;
+    {
+        std::lock_guard<std::mutex> Lock{m_PagesMtx};
+        if (m_CurrAllocatedSize[0] <= m_DeviceLocalReserveSize && m_CurrAllocatedSize[1] <= m_HostVisibleReserveSize)
+            return;
+
+        Pools.reserve(m_PagePools.size());
+        for (auto& it : m_PagePools)
+            Pools.push_back(it.second.get());
+    }
 
-    auto it = m_Pages.begin();
-    while (it != m_Pages.end())
+    // Pool mutex must be locked before m_PagesMtx
+    for (auto* pPool : Pools)
     {
-        auto curr_it = it;
-        ++it;
-        auto& Page          = curr_it->second;
-        bool  IsHostVisible = Page.GetCPUMemory() != nullptr;
-        auto  ReserveSize   = IsHostVisible ? m_HostVisibleReserveSize : m_DeviceLocalReserveSize;
-        if (Page.IsEmpty() && m_CurrAllocatedSize[IsHostVisible ? 1 : 0] > ReserveSize)
+        std::lock_guard<std::mutex> PoolLock{pPool->Mtx};
+
+        auto it = pPool->Pages.begin();
+        while (it != pPool->Pages.end())
         {
-            auto PageSize = Page.GetPageSize();
-            m_CurrAllocatedSize[IsHostVisible ? 1 : 0] -= PageSize;
+            auto curr_it = it;
+            ++it;
+            auto& Page          = *curr_it;
+            bool  IsHostVisible = Page.GetCPUMemory() != nullptr;
+            auto  ReserveSize   = IsHostVisible ? m_HostVisibleReserveSize : m_DeviceLocalReserveSize;
+            if (!Page.IsEmpty())
+                continue;
+
+            auto         PageSize          = Page.GetPageSize();
+            VkDeviceSize CurrAllocatedSize = 0;
+            {
+                std::lock_guard<std::mutex> StatsLock{m_PagesMtx};
+                if (m_CurrAllocatedSize[IsHostVisible ? 1 : 0] <= ReserveSize)
+                    continue;
+                UpdateAllocatedSize(Page.GetMemoryTypeIndex(), IsHostVisible, -static_cast<int64_t>(PageSize));
+                CurrAllocatedSize = m_CurrAllocatedSize[IsHostVisible ? 1 : 0];
+            }
             LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "': destroying ", (IsHostVisible ? "host-visible" : "device-local"),
                              " page (", Diligent::FormatMemorySize(PageSize, 2),
                              "). Current allocated size: ",
-                             Diligent::FormatMemorySize(m_CurrAllocatedSize[IsHostVisible ? 1 : 0], 2));
+                             Diligent::FormatMemorySize(CurrAllocatedSize, 2));
             OnPageDestroy(Page);
-            m_Pages.erase(curr_it);
+            pPool->Pages.erase(curr_it);
         }
     }
 }
@@ -257,8 +443,13 @@ VulkanMemoryManager::~VulkanMemoryManager()
                      Diligent::FormatMemorySize(m_PeakAllocatedSize[1], 2, m_PeakAllocatedSize[1]),
                      " (", PeakHostVisiblePages, (PeakHostVisiblePages == 1 ? " page)" : " pages)"));
 
-    for (auto it = m_Pages.begin(); it != m_Pages.end(); ++it)
-        VERIFY(it->second.IsEmpty(), "The page contains outstanding allocations");
+    for (const auto& it : m_PagePools)
+    {
+        const auto& Pages = it.second->Pages;
+        for (auto page_it = Pages.begin(); page_it != Pages.end(); ++page_it)
+            VERIFY(page_it->IsEmpty(), "The page contains outstanding allocations");
+        VERIFY(it.second->DedicatedPages.empty(), "Not all dedicated allocations have been released");
+    }
     VERIFY(m_CurrUsedSize[0] == 0 && m_CurrUsedSize[1] == 0, "Not all allocations have been released");
 }
 
@@ -0,0 +1,165 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/CommandList.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Deferred context pool create information.
+struct DeferredContextPoolCreateInfo
+{
+    /// Immediate context where the recorded command lists will be executed.
+    IDeviceContext* pImmediateContext = nullptr;
+
+    /// Deferred contexts managed by the pool, see EngineCreateInfo::NumDeferredContexts.
+    IDeviceContext* const* ppDeferredContexts = nullptr;
+
+    /// The number of elements in ppDeferredContexts array.
+    Uint32 NumDeferredContexts = 0;
+};
+
+/// Helper class that hands out deferred contexts to worker threads on demand
+/// and submits the recorded command lists in the caller-specified order.
+
+/// A typical frame looks like this:
+///
+///     // Any number of worker threads, e.g. jobs of a job system:
+///     IDeviceContext* pCtx = Pool.Begin();
+///     // ... record commands into pCtx ...
+///     Pool.Finish(pCtx, JobIndex);
+///
+///     // Render thread, after all jobs have finished:
+///     Pool.Submit();
+///
+/// A context is returned to the pool as soon as its command list is finished, so the number of
+/// jobs is not limited by the number of deferred contexts. Contexts last used by the calling thread
+/// are handed out first, so that every thread keeps reusing the same command pools and dynamic heap pages.
+///
+/// \remarks All methods are thread-safe except for Submit() that must not run concurrently with
+///          other methods.
+///
+///          Submit() calls IDeviceContext::FinishFrame() for the deferred contexts from the calling thread.
+///          In Metal backend FinishFrame must be called from the thread that recorded the commands, so the pool
+///          must not be used with Metal deferred contexts.
+class DeferredContextPool
+{
+public:
+    explicit DeferredContextPool(const DeferredContextPoolCreateInfo& CI);
+    ~DeferredContextPool();
+
+    // clang-format off
+    DeferredContextPool           (const DeferredContextPool&) = delete;
+    DeferredContextPool& operator=(const DeferredContextPool&) = delete;
+    DeferredContextPool           (DeferredContextPool&&)      = delete;
+    DeferredContextPool& operator=(DeferredContextPool&&)      = delete;
+    // clang-format on
+
+
+    /// Acquires a deferred context and begins recording commands.
+
+    /// \return     Deferred context that is ready to record commands that will be executed
+    ///             in the immediate context of the pool.
+    ///
+    /// \remarks    If all contexts are in use, the method blocks until one of them is finished.
+    IDeviceContext* Begin();
+
+
+    /// Finishes recording commands and returns the context to the pool.
+
+    /// \param [in] pCtx        - Context previously returned by Begin().
+    /// \param [in] SubmitIndex - Position of the command list in the submission order.
+    ///                           Command lists are executed in increasing order of SubmitIndex;
+    ///                           command lists with the same index are executed in the order
+    ///                           in which they were finished.
+    void Finish(IDeviceContext* pCtx, Uint32 SubmitIndex);
+
+
+    /// Executes all finished command lists with a single IDeviceContext::ExecuteCommandLists() call
+    /// and finishes the frame in every deferred context that recorded commands.
+
+    /// \return     The number of executed command lists.
+    ///
+    /// \remarks    All contexts acquired with Begin() must be finished before the method is called.
+    Uint32 Submit();
+
+
+    /// Returns the number of deferred contexts managed by the pool.
+    Uint32 GetNumContexts() const
+    {
+        return static_cast<Uint32>(m_Contexts.size());
+    }
+
+private:
+    struct ContextInfo
+    {
+        RefCntAutoPtr<IDeviceContext> pCtx;
+
+        // Thread that last recorded commands into the context
+        std::thread::id LastThread;
+
+        bool IsRecording = false;
+
+        // Indicates if the context recorded any commands since the last Submit()
+        bool NeedsFinishFrame = false;
+    };
+
+    ContextInfo* FindContext(IDeviceContext* pCtx);
+
+    struct PendingCommandList
+    {
+        PendingCommandList(Uint32 _SubmitIndex, RefCntAutoPtr<ICommandList>&& _pCmdList) :
+            SubmitIndex{_SubmitIndex},
+            pCmdList{std::move(_pCmdList)}
+        {}
+
+        Uint32                      SubmitIndex;
+        RefCntAutoPtr<ICommandList> pCmdList;
+    };
+
+    RefCntAutoPtr<IDeviceContext> m_pImmediateContext;
+
+    const Uint32 m_ImmediateContextId;
+
+    std::mutex              m_Mtx;
+    std::condition_variable m_ContextAvailableCV;
+
+    std::vector<ContextInfo> m_Contexts;
+    Uint32                   m_NumAvailableContexts = 0;
+
+    std::vector<PendingCommandList> m_PendingCmdLists;
+};
+
+} // namespace Diligent
@@ -0,0 +1,242 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <string>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/Query.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "../../../Common/interface/Timer.hpp"
+
+namespace Diligent
+{
+
+/// Hierarchical CPU/GPU frame profiler.
+
+/// The profiler records named, nestable scopes. Every scope is timed on the CPU with the
+/// Timer and on the GPU with a pair of timestamp queries. Queries are taken from per-frame
+/// pools that are reused once the frame is resolved, so no queries are created in the steady state.
+/// Frames are resolved a few frames late, when all their queries are available, and the
+/// profiler never waits for the GPU.
+///
+/// GPU timestamps are converted to the CPU timeline using the smallest observed difference
+/// between the GPU and CPU times of the frame start: the GPU can't execute the frame start
+/// timestamp before the CPU records it, so the estimate converges as soon as the GPU is idle
+/// at the beginning of any frame.
+///
+/// One FrameProfiler instance must be used with one immediate context, and must not be
+/// accessed from multiple threads simultaneously.
+class FrameProfiler
+{
+public:
+    struct CreateInfo
+    {
+        /// The number of timestamp queries that are added to the frame query pool at once.
+        Uint32 QueryBatchSize = 64;
+
+        /// The expected number of frames that are in flight. A warning is logged if the
+        /// number of frames that are waiting for the query results exceeds this number.
+        Uint32 ExpectedFrameLatency = 5;
+
+        /// The number of resolved frames that are kept by the profiler.
+        Uint32 MaxResolvedFrames = 16;
+    };
+
+    FrameProfiler(IRenderDevice* pDevice, const CreateInfo& CI);
+
+    // clang-format off
+    FrameProfiler           (const FrameProfiler&) = delete;
+    FrameProfiler& operator=(const FrameProfiler&) = delete;
+    FrameProfiler           (FrameProfiler&&)      = default;
+    FrameProfiler& operator=(FrameProfiler&&)      = delete;
+    // clang-format on
+
+    ~FrameProfiler();
+
+
+    /// Resolves the frames whose query results are available and begins a new frame.
+
+    /// \param [in] pCtx - Immediate context to record the frame start timestamp.
+    ///
+    /// \remarks    The frame is the root scope of all scopes recorded until EndFrame() call.
+    void BeginFrame(IDeviceContext* pCtx);
+
+
+    /// Ends the frame.
+
+    /// \param [in] pCtx - Immediate context to record the frame end timestamp.
+    ///
+    /// \remarks    All scopes started in the frame must be ended before this call.
+    void EndFrame(IDeviceContext* pCtx);
+
+
+    /// Begins a named scope nested in the most recently begun scope.
+
+    /// \param [in] pCtx - Context to record the scope start timestamp.
+    /// \param [in] Name - Scope name. The string is copied.
+    ///
+    /// \remarks    There must be exactly one matching EndScope() for every BeginScope() call, otherwise
+    ///             the behavior is undefined.
+    void BeginScope(IDeviceContext* pCtx, const Char* Name);
+
+
+    /// Ends the most recently begun scope.
+
+    /// \param [in] pCtx - Context to record the scope end timestamp.
+    void EndScope(IDeviceContext* pCtx);
+
+
+    /// Begins a scope in the constructor and ends it in the destructor.
+    class Scope
+    {
+    public:
+        Scope(FrameProfiler& Profiler, IDeviceContext* pCtx, const Char* Name) :
+            m_Profiler{Profiler},
+            m_pCtx{pCtx}
+        {
+            m_Profiler.BeginScope(m_pCtx, Name);
+        }
+
+        ~Scope()
+        {
+            m_Profiler.EndScope(m_pCtx);
+        }
+
+        // clang-format off
+        Scope           (const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope           (Scope&&)      = delete;
+        Scope& operator=(Scope&&)      = delete;
+        // clang-format on
+
+    private:
+        FrameProfiler&  m_Profiler;
+        IDeviceContext* m_pCtx;
+    };
+
+
+    struct ScopeData
+    {
+        std::string Name;
+
+        /// Nesting level. The frame scope has depth 0.
+        Uint32 Depth = 0;
+
+        /// CPU start and end times, in seconds since the profiler creation.
+        double CPUStartTime = 0;
+        double CPUEndTime   = 0;
+
+        /// GPU start and end times, in seconds, converted to the CPU timeline.
+        double GPUStartTime = 0;
+        double GPUEndTime   = 0;
+
+        /// Whether the GPU times are valid. GPU times are not available when
+        /// the device does not support timestamp queries.
+        bool GPUTimeValid = false;
+    };
+
+    struct FrameData
+    {
+        Uint64 FrameNumber = 0;
+
+        /// Frame scopes in the order they were begun. The first scope is the frame itself.
+        std::vector<ScopeData> Scopes;
+    };
+
+    /// Returns the resolved frames, from the oldest to the most recent.
+    const std::deque<FrameData>& GetResolvedFrames() const { return m_ResolvedFrames; }
+
+    /// Returns the most recently resolved frame, or null if no frames have been resolved yet.
+    const FrameData* GetLastResolvedFrame() const
+    {
+        return !m_ResolvedFrames.empty() ? &m_ResolvedFrames.back() : nullptr;
+    }
+
+    /// Returns the resolved frames in Chrome trace event format (chrome://tracing, Perfetto).
+    /// CPU and GPU scopes are written to separate threads of the same process.
+    std::string GetChromeTrace() const;
+
+    /// Writes the Chrome trace of the resolved frames to a file.
+    bool SaveChromeTrace(const Char* FilePath) const;
+
+private:
+    static constexpr Uint32 InvalidQueryIndex = ~0u;
+
+    struct ScopeRecord
+    {
+        ScopeData Data;
+
+        Uint32 StartQuery = InvalidQueryIndex;
+        Uint32 EndQuery   = InvalidQueryIndex;
+    };
+
+    struct FrameRecord
+    {
+        Uint64 FrameNumber = 0;
+
+        std::vector<RefCntAutoPtr<IQuery>> Queries;
+
+        Uint32 NumUsedQueries = 0;
+
+        std::vector<ScopeRecord> Scopes;
+    };
+
+    void   CloseScope(IDeviceContext* pCtx);
+    Uint32 RecordTimestamp(IDeviceContext* pCtx);
+    bool   ResolveFrame(FrameRecord& Frame);
+
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+
+    const CreateInfo m_CI;
+    const bool       m_GPUTimestampsSupported;
+
+    Timer m_Timer;
+
+    // The smallest observed difference between the GPU and CPU frame start times
+    double m_GPUClockOffset;
+
+    Uint64 m_FrameNumber = 0;
+
+    FrameRecord m_CurrFrame;
+    bool        m_FrameActive = false;
+
+    // Indices of the open scopes in the current frame
+    std::vector<Uint32> m_ScopeStack;
+
+    std::deque<FrameRecord>  m_PendingFrames;
+    std::vector<FrameRecord> m_AvailableFrames;
+
+    std::vector<double> m_GPUTimes;
+
+    std::deque<FrameData> m_ResolvedFrames;
+};
+
+} // namespace Diligent
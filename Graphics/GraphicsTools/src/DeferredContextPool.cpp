@@ -0,0 +1,176 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "DeferredContextPool.hpp"
+
+#include <algorithm>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+DeferredContextPool::DeferredContextPool(const DeferredContextPoolCreateInfo& CI) :
+    m_pImmediateContext{CI.pImmediateContext},
+    m_ImmediateContextId{CI.pImmediateContext != nullptr ? CI.pImmediateContext->GetDesc().ContextId : Uint32{0}}
+{
+    DEV_CHECK_ERR(m_pImmediateContext != nullptr, "Immediate context must not be null");
+    DEV_CHECK_ERR(!m_pImmediateContext->GetDesc().IsDeferred, "The context where command lists are executed must be an immediate context");
+    DEV_CHECK_ERR(CI.NumDeferredContexts == 0 || CI.ppDeferredContexts != nullptr, "ppDeferredContexts must not be null");
+
+    m_Contexts.resize(CI.NumDeferredContexts);
+    for (Uint32 i = 0; i < CI.NumDeferredContexts; ++i)
+    {
+        auto* pCtx = CI.ppDeferredContexts[i];
+        DEV_CHECK_ERR(pCtx != nullptr, "Deferred context ", i, " is null");
+        DEV_CHECK_ERR(pCtx->GetDesc().IsDeferred, "Context ", i, " is not a deferred context");
+        m_Contexts[i].pCtx = pCtx;
+    }
+    m_NumAvailableContexts = CI.NumDeferredContexts;
+}
+
+DeferredContextPool::~DeferredContextPool()
+{
+    DEV_CHECK_ERR(m_NumAvailableContexts == m_Contexts.size(), "Destroying the pool while some contexts are still recording commands");
+    DEV_CHECK_ERR(m_PendingCmdLists.empty(), "Destroying the pool with command lists that have not been submitted. Call Submit() first.");
+}
+
+DeferredContextPool::ContextInfo* DeferredContextPool::FindContext(IDeviceContext* pCtx)
+{
+    for (auto& Ctx : m_Contexts)
+    {
+        if (Ctx.pCtx == pCtx)
+            return &Ctx;
+    }
+    return nullptr;
+}
+
+IDeviceContext* DeferredContextPool::Begin()
+{
+    DEV_CHECK_ERR(!m_Contexts.empty(), "The pool has no deferred contexts");
+
+    const auto ThisThread = std::this_thread::get_id();
+
+    IDeviceContext* pCtx = nullptr;
+    {
+        std::unique_lock<std::mutex> Lock{m_Mtx};
+        m_ContextAvailableCV.wait(Lock, [this]() { return m_NumAvailableContexts > 0; });
+
+        // Prefer the context last used by this thread, then a context that has never been used,
+        // and only then a context last used by another thread.
+        ContextInfo* pSelected = nullptr;
+        for (auto& Ctx : m_Contexts)
+        {
+            if (Ctx.IsRecording)
+                continue;
+
+            if (Ctx.LastThread == ThisThread)
+            {
+                pSelected = &Ctx;
+                break;
+            }
+
+            if (pSelected == nullptr || (pSelected->LastThread != std::thread::id{} && Ctx.LastThread == std::thread::id{}))
+                pSelected = &Ctx;
+        }
+        VERIFY(pSelected != nullptr, "There must be at least one available context");
+
+        pSelected->IsRecording      = true;
+        pSelected->NeedsFinishFrame = true;
+        pSelected->LastThread       = ThisThread;
+        --m_NumAvailableContexts;
+
+        pCtx = pSelected->pCtx;
+    }
+
+    pCtx->Begin(m_ImmediateContextId);
+    return pCtx;
+}
+
+void DeferredContextPool::Finish(IDeviceContext* pCtx, Uint32 SubmitIndex)
+{
+    DEV_CHECK_ERR(pCtx != nullptr, "Context must not be null");
+
+    RefCntAutoPtr<ICommandList> pCmdList;
+    pCtx->FinishCommandList(&pCmdList);
+
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        auto* pCtxInfo = FindContext(pCtx);
+        if (pCtxInfo == nullptr)
+        {
+            DEV_ERROR("The context does not belong to this pool");
+            return;
+        }
+        DEV_CHECK_ERR(pCtxInfo->IsRecording, "The context has not been acquired with Begin()");
+
+        if (pCmdList)
+            m_PendingCmdLists.emplace_back(SubmitIndex, std::move(pCmdList));
+
+        pCtxInfo->IsRecording = false;
+        ++m_NumAvailableContexts;
+    }
+    m_ContextAvailableCV.notify_one();
+}
+
+Uint32 DeferredContextPool::Submit()
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    DEV_CHECK_ERR(m_NumAvailableContexts == m_Contexts.size(), "All contexts must be finished before the command lists are submitted");
+
+    std::stable_sort(m_PendingCmdLists.begin(), m_PendingCmdLists.end(),
+                     [](const PendingCommandList& lhs, const PendingCommandList& rhs) {
+                         return lhs.SubmitIndex < rhs.SubmitIndex;
+                     });
+
+    const auto NumCmdLists = static_cast<Uint32>(m_PendingCmdLists.size());
+    if (NumCmdLists > 0)
+    {
+        std::vector<ICommandList*> ppCmdLists(NumCmdLists);
+        for (Uint32 i = 0; i < NumCmdLists; ++i)
+            ppCmdLists[i] = m_PendingCmdLists[i].pCmdList;
+
+        m_pImmediateContext->ExecuteCommandLists(NumCmdLists, ppCmdLists.data());
+
+        // Command lists are no longer valid after they have been executed
+        m_PendingCmdLists.clear();
+    }
+
+    // Dynamic resources may only be released after the command lists that reference them have been executed
+    for (auto& Ctx : m_Contexts)
+    {
+        if (Ctx.NeedsFinishFrame)
+        {
+            Ctx.pCtx->FinishFrame();
+            Ctx.NeedsFinishFrame = false;
+        }
+    }
+
+    return NumCmdLists;
+}
+
+} // namespace Diligent
@@ -0,0 +1,312 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FrameProfiler.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <iomanip>
+
+#include "FileWrapper.hpp"
+
+namespace Diligent
+{
+
+FrameProfiler::FrameProfiler(IRenderDevice* pDevice, const CreateInfo& CI) :
+    m_pDevice{pDevice},
+    m_CI{CI},
+    m_GPUTimestampsSupported{pDevice->GetDeviceInfo().Features.TimestampQueries != DEVICE_FEATURE_STATE_DISABLED},
+    m_GPUClockOffset{std::numeric_limits<double>::max()}
+{
+    DEV_CHECK_ERR(m_CI.QueryBatchSize > 0, "Query batch size must not be zero");
+    if (!m_GPUTimestampsSupported)
+        LOG_INFO_MESSAGE("Timestamp queries are not supported by the device: frame profiler will only record CPU times");
+}
+
+FrameProfiler::~FrameProfiler()
+{
+    DEV_CHECK_ERR(!m_FrameActive, "Frame profiler is destroyed in the middle of a frame");
+}
+
+Uint32 FrameProfiler::RecordTimestamp(IDeviceContext* pCtx)
+{
+    if (!m_GPUTimestampsSupported)
+        return InvalidQueryIndex;
+
+    auto& Queries = m_CurrFrame.Queries;
+    if (m_CurrFrame.NumUsedQueries == Queries.size())
+    {
+        // Grow the pool by a whole batch to avoid creating queries in the middle of every new scope
+        QueryDesc queryDesc{QUERY_TYPE_TIMESTAMP};
+        queryDesc.Name = "Frame profiler timestamp query";
+        for (Uint32 i = 0; i < m_CI.QueryBatchSize; ++i)
+        {
+            RefCntAutoPtr<IQuery> pQuery;
+            m_pDevice->CreateQuery(queryDesc, &pQuery);
+            if (!pQuery)
+            {
+                LOG_ERROR_MESSAGE("Failed to create frame profiler timestamp query");
+                break;
+            }
+            Queries.emplace_back(std::move(pQuery));
+        }
+        if (m_CurrFrame.NumUsedQueries == Queries.size())
+            return InvalidQueryIndex;
+    }
+
+    const auto QueryIdx = m_CurrFrame.NumUsedQueries++;
+    pCtx->EndQuery(Queries[QueryIdx]);
+    return QueryIdx;
+}
+
+void FrameProfiler::BeginFrame(IDeviceContext* pCtx)
+{
+    DEV_CHECK_ERR(!m_FrameActive, "BeginFrame() is called without ending the previous frame");
+
+    while (!m_PendingFrames.empty())
+    {
+        auto& OldestFrame = m_PendingFrames.front();
+        if (!ResolveFrame(OldestFrame))
+            break;
+
+        m_AvailableFrames.emplace_back(std::move(OldestFrame));
+        m_PendingFrames.pop_front();
+    }
+
+    if (m_PendingFrames.size() > m_CI.ExpectedFrameLatency)
+    {
+        LOG_WARNING_MESSAGE("There are ", m_PendingFrames.size(), " frames waiting for the query results which exceeds the expected frame latency (",
+                            m_CI.ExpectedFrameLatency, ")");
+    }
+
+    if (!m_AvailableFrames.empty())
+    {
+        m_CurrFrame = std::move(m_AvailableFrames.back());
+        m_AvailableFrames.pop_back();
+    }
+    m_CurrFrame.FrameNumber    = m_FrameNumber++;
+    m_CurrFrame.NumUsedQueries = 0;
+    m_CurrFrame.Scopes.clear();
+
+    m_FrameActive = true;
+    BeginScope(pCtx, "Frame");
+}
+
+void FrameProfiler::EndFrame(IDeviceContext* pCtx)
+{
+    DEV_CHECK_ERR(m_FrameActive, "EndFrame() is called without matching BeginFrame()");
+    VERIFY_EXPR(!m_ScopeStack.empty());
+    if (m_ScopeStack.size() > 1)
+    {
+        LOG_ERROR_MESSAGE("There are ", m_ScopeStack.size() - 1, " scopes that have not been ended, which likely indicates inconsistent BeginScope()/EndScope() calls");
+        while (m_ScopeStack.size() > 1)
+            CloseScope(pCtx);
+    }
+    // Close the frame scope
+    CloseScope(pCtx);
+
+    m_PendingFrames.emplace_back(std::move(m_CurrFrame));
+    m_CurrFrame   = {};
+    m_FrameActive = false;
+}
+
+void FrameProfiler::BeginScope(IDeviceContext* pCtx, const Char* Name)
+{
+    DEV_CHECK_ERR(m_FrameActive, "Scopes must be recorded between BeginFrame() and EndFrame()");
+
+    m_ScopeStack.push_back(static_cast<Uint32>(m_CurrFrame.Scopes.size()));
+
+    m_CurrFrame.Scopes.emplace_back();
+    auto& Record{m_CurrFrame.Scopes.back()};
+    Record.Data.Name  = Name != nullptr ? Name : "";
+    Record.Data.Depth = static_cast<Uint32>(m_ScopeStack.size() - 1);
+
+    Record.Data.CPUStartTime = m_Timer.GetElapsedTime();
+    Record.StartQuery        = RecordTimestamp(pCtx);
+}
+
+void FrameProfiler::EndScope(IDeviceContext* pCtx)
+{
+    // The frame scope is only closed by EndFrame()
+    if (m_ScopeStack.size() <= 1)
+    {
+        LOG_ERROR_MESSAGE("There are no open scopes, which likely indicates inconsistent BeginScope()/EndScope() calls");
+        return;
+    }
+
+    CloseScope(pCtx);
+}
+
+void FrameProfiler::CloseScope(IDeviceContext* pCtx)
+{
+    VERIFY_EXPR(!m_ScopeStack.empty());
+
+    auto& Record = m_CurrFrame.Scopes[m_ScopeStack.back()];
+    m_ScopeStack.pop_back();
+
+    Record.EndQuery        = RecordTimestamp(pCtx);
+    Record.Data.CPUEndTime = m_Timer.GetElapsedTime();
+}
+
+bool FrameProfiler::ResolveFrame(FrameRecord& Frame)
+{
+    if (Frame.NumUsedQueries > 0)
+    {
+        // The frame end timestamp is recorded last, so if it is available, all other queries are available too.
+        // Do not invalidate the query until we read all other timestamps.
+        QueryDataTimestamp TimestampData;
+        if (!Frame.Queries[Frame.NumUsedQueries - 1]->GetData(&TimestampData, sizeof(TimestampData), false))
+            return false;
+    }
+
+    m_GPUTimes.resize(Frame.NumUsedQueries);
+    for (Uint32 i = 0; i < Frame.NumUsedQueries; ++i)
+    {
+        QueryDataTimestamp TimestampData;
+        if (Frame.Queries[i]->GetData(&TimestampData, sizeof(TimestampData)) && TimestampData.Frequency != 0)
+            m_GPUTimes[i] = static_cast<double>(TimestampData.Counter) / static_cast<double>(TimestampData.Frequency);
+        else
+            m_GPUTimes[i] = -1;
+    }
+
+    auto IsValidTime = [this](Uint32 QueryIdx) {
+        return QueryIdx != InvalidQueryIndex && m_GPUTimes[QueryIdx] >= 0;
+    };
+
+    VERIFY_EXPR(!Frame.Scopes.empty());
+    const auto& FrameScope = Frame.Scopes.front();
+    if (IsValidTime(FrameScope.StartQuery))
+        m_GPUClockOffset = std::min(m_GPUClockOffset, m_GPUTimes[FrameScope.StartQuery] - FrameScope.Data.CPUStartTime);
+
+    FrameData ResolvedFrame;
+    if (m_ResolvedFrames.size() >= std::max(m_CI.MaxResolvedFrames, 1u))
+    {
+        // Reuse the storage of the oldest frame
+        ResolvedFrame = std::move(m_ResolvedFrames.front());
+        m_ResolvedFrames.pop_front();
+    }
+    ResolvedFrame.FrameNumber = Frame.FrameNumber;
+    ResolvedFrame.Scopes.resize(Frame.Scopes.size());
+    for (size_t i = 0; i < Frame.Scopes.size(); ++i)
+    {
+        const auto& Src = Frame.Scopes[i];
+        auto&       Dst = ResolvedFrame.Scopes[i];
+
+        Dst              = Src.Data;
+        Dst.GPUTimeValid = IsValidTime(Src.StartQuery) && IsValidTime(Src.EndQuery);
+        if (Dst.GPUTimeValid)
+        {
+            Dst.GPUStartTime = m_GPUTimes[Src.StartQuery] - m_GPUClockOffset;
+            Dst.GPUEndTime   = m_GPUTimes[Src.EndQuery] - m_GPUClockOffset;
+        }
+    }
+    m_ResolvedFrames.emplace_back(std::move(ResolvedFrame));
+
+    return true;
+}
+
+namespace
+{
+
+void WriteJSONString(std::ostream& Stream, const std::string& Str)
+{
+    Stream << '"';
+    for (auto c : Str)
+    {
+        switch (c)
+        {
+            case '"': Stream << "\\\""; break;
+            case '\\': Stream << "\\\\"; break;
+            case '\n': Stream << "\\n"; break;
+            case '\t': Stream << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                    Stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec << std::setfill(' ');
+                else
+                    Stream << c;
+        }
+    }
+    Stream << '"';
+}
+
+} // namespace
+
+std::string FrameProfiler::GetChromeTrace() const
+{
+    constexpr int CPUThreadId = 1;
+    constexpr int GPUThreadId = 2;
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3);
+    ss << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    ss << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << CPUThreadId << ",\"args\":{\"name\":\"CPU\"}},\n";
+    ss << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << GPUThreadId << ",\"args\":{\"name\":\"GPU\"}}";
+
+    auto WriteEvent = [&ss](const ScopeData& Scope, Uint64 FrameNumber, int ThreadId, double StartTime, double EndTime) {
+        // Trace event times are in microseconds
+        ss << ",\n{\"name\":";
+        WriteJSONString(ss, Scope.Name);
+        ss << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << ThreadId
+           << ",\"ts\":" << StartTime * 1e+6
+           << ",\"dur\":" << std::max(EndTime - StartTime, 0.0) * 1e+6
+           << ",\"args\":{\"frame\":" << FrameNumber << "}}";
+    };
+
+    for (const auto& Frame : m_ResolvedFrames)
+    {
+        for (const auto& Scope : Frame.Scopes)
+        {
+            WriteEvent(Scope, Frame.FrameNumber, CPUThreadId, Scope.CPUStartTime, Scope.CPUEndTime);
+            if (Scope.GPUTimeValid)
+                WriteEvent(Scope, Frame.FrameNumber, GPUThreadId, Scope.GPUStartTime, Scope.GPUEndTime);
+        }
+    }
+    ss << "\n]}\n";
+
+    return ss.str();
+}
+
+bool FrameProfiler::SaveChromeTrace(const Char* FilePath) const
+{
+    FileWrapper File{FilePath, EFileAccessMode::Overwrite};
+    if (!File)
+    {
+        LOG_ERROR_MESSAGE("Failed to open file '", FilePath, "' to save the frame profiler trace");
+        return false;
+    }
+
+    const auto Trace = GetChromeTrace();
+    if (!File->Write(Trace.data(), Trace.size()))
+    {
+        LOG_ERROR_MESSAGE("Failed to write the frame profiler trace to file '", FilePath, "'");
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace Diligent
@@ -0,0 +1,110 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::SPIRVReflection class
+
+#include <vector>
+#include <string>
+#include <array>
+
+#include "GraphicsTypes.h"
+
+namespace Diligent
+{
+
+/// Lightweight SPIRV reflection.
+
+/// The class decodes only the instructions that are required to initialize
+/// SPIRVShaderResources (names, decorations, types, global variables, entry points
+/// and execution modes) in a single pass over the binary, without building the
+/// SPIRV-Cross IR. The results are expected to match what SPIRV-Cross reports
+/// through Compiler::get_shader_resources().
+class SPIRVReflection
+{
+public:
+    struct Resource
+    {
+        std::string        Name;
+        Uint32             ArraySize                     = 1;
+        RESOURCE_DIMENSION ResourceDim                   = RESOURCE_DIM_UNDEFINED;
+        bool               IsMS                          = false;
+        bool               IsTexelBuffer                 = false; // Image with DimBuffer dimension
+        bool               IsReadOnly                    = false; // Storage buffer decorated as NonWritable
+        Uint32             BindingDecorationOffset       = 0;
+        Uint32             DescriptorSetDecorationOffset = 0;
+        Uint32             BufferStaticSize              = 0;
+        Uint32             BufferStride                  = 0;
+    };
+
+    struct StageInput
+    {
+        std::string Name;
+        const char* Semantic                 = nullptr; // HlslSemanticGOOGLE decoration, if present
+        Uint32      LocationDecorationOffset = 0;
+    };
+
+    // Resource lists in the same order as in diligent_spirv_cross::ShaderResources
+    std::vector<Resource>   UniformBuffers;
+    std::vector<Resource>   StorageBuffers;
+    std::vector<Resource>   StorageImages;
+    std::vector<Resource>   SampledImages;
+    std::vector<Resource>   AtomicCounters;
+    std::vector<Resource>   SeparateImages;
+    std::vector<Resource>   SeparateSamplers;
+    std::vector<Resource>   SubpassInputs;
+    std::vector<Resource>   AccelerationStructures;
+    std::vector<StageInput> StageInputs;
+
+    // Name of the selected entry point
+    std::string EntryPoint;
+
+    // The number of entry points whose execution model matches the shader type
+    Uint32 NumMatchingEntryPoints = 0;
+
+    std::array<Uint32, 3> ComputeGroupSize = {};
+
+    bool IsHLSLSource       = false;
+    bool HlslFunctionality1 = false; // SPV_GOOGLE_hlsl_functionality1 extension is declared
+
+    /// Parses the SPIRV binary.
+
+    /// \param [in] SPIRV      - SPIRV binary. Semantic strings in StageInputs point into this
+    ///                          binary, so it must be alive while the reflection is used.
+    /// \param [in] ShaderType - Shader type that defines the execution model of the entry point.
+    /// \param [in] EntryPoint - Entry point name. If empty, the first entry point with the
+    ///                          matching execution model is selected.
+    ///
+    /// \return     true if the binary was successfully parsed, and false if it is malformed or uses
+    ///             constructs that the parser does not handle (decoration groups, specialization
+    ///             constant array sizes, etc.). In the latter case, the caller should fall back to SPIRV-Cross.
+    bool Parse(const std::vector<uint32_t>& SPIRV, SHADER_TYPE ShaderType, const std::string& EntryPoint);
+};
+
+} // namespace Diligent
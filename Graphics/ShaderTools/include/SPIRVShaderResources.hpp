@@ -46,6 +46,7 @@
 #include "STDAllocator.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "StringPool.hpp"
+#include "SPIRVReflection.hpp"
 
 namespace diligent_spirv_cross
 {
@@ -105,6 +106,10 @@ struct SPIRVShaderResourceAttribs
                                Uint32                                _BufferStaticSize = 0,
                                Uint32                                _BufferStride     = 0) noexcept;
 
+    SPIRVShaderResourceAttribs(const SPIRVReflection::Resource& Res,
+                               const char*                      _Name,
+                               ResourceType                     _Type) noexcept;
+
     ShaderResourceDesc GetResourceDesc() const
     {
         return ShaderResourceDesc{Name, GetShaderResourceType(Type), ArraySize};
@@ -141,12 +146,27 @@ static_assert(sizeof(SPIRVShaderStageInputAttribs) % sizeof(void*) == 0, "Size o
 class SPIRVShaderResources
 {
 public:
+    /// Method that is used to reflect the SPIRV binary
+    enum class ReflectionMode : Uint8
+    {
+        /// Use the lightweight SPIRVReflection parser and fall back to SPIRV-Cross
+        /// if the binary contains constructs the parser does not handle.
+        Auto,
+
+        /// Only use the SPIRVReflection parser. An exception is thrown if it fails.
+        Native,
+
+        /// Only use SPIRV-Cross.
+        SPIRVCross
+    };
+
     SPIRVShaderResources(IMemoryAllocator&     Allocator,
                          std::vector<uint32_t> spirv_binary,
                          const ShaderDesc&     shaderDesc,
                          const char*           CombinedSamplerSuffix,
                          bool                  LoadShaderStageInputs,
-                         std::string&          EntryPoint);
+                         std::string&          EntryPoint,
+                         ReflectionMode        Mode = ReflectionMode::Auto);
 
     // clang-format off
     SPIRVShaderResources             (const SPIRVShaderResources&)  = delete;
@@ -311,6 +331,19 @@ public:
     bool IsHLSLSource() const { return m_IsHLSLSource; }
 
 private:
+    void LoadWithSPIRVReflection(IMemoryAllocator&      Allocator,
+                                 const SPIRVReflection& Reflection,
+                                 const ShaderDesc&      shaderDesc,
+                                 const char*            CombinedSamplerSuffix,
+                                 bool                   LoadShaderStageInputs);
+
+    void LoadWithSPIRVCross(IMemoryAllocator&     Allocator,
+                            std::vector<uint32_t> spirv_binary,
+                            const ShaderDesc&     shaderDesc,
+                            const char*           CombinedSamplerSuffix,
+                            bool                  LoadShaderStageInputs,
+                            std::string&          EntryPoint);
+
     void Initialize(IMemoryAllocator&       Allocator,
                     const ResourceCounters& Counters,
                     Uint32                  NumShaderStageInputs,
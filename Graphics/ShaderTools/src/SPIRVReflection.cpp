@@ -0,0 +1,955 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "SPIRVReflection.hpp"
+
+#include <cstring>
+#include <algorithm>
+
+#include "spirv.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+// Defined in SPIRVShaderResources.cpp
+spv::ExecutionModel ShaderTypeToSpvExecutionModel(SHADER_TYPE ShaderType);
+
+namespace
+{
+
+// The parser mirrors the logic of diligent_spirv_cross::Compiler::get_shader_resources(),
+// get_declared_struct_size() and related functions, but only looks at the instructions
+// that precede the first function definition. If anything unexpected is encountered,
+// parsing fails and the caller falls back to SPIRV-Cross.
+class SPIRVParser
+{
+public:
+    explicit SPIRVParser(const std::vector<uint32_t>& SPIRV) :
+        m_SPIRV{SPIRV}
+    {}
+
+    bool Parse(SHADER_TYPE ShaderType, const std::string& EntryPoint, SPIRVReflection& Refl);
+
+private:
+    enum ID_FLAGS : Uint8
+    {
+        ID_FLAG_NONE           = 0u,
+        ID_FLAG_BLOCK          = 1u << 0u,
+        ID_FLAG_BUFFER_BLOCK   = 1u << 1u,
+        ID_FLAG_NON_WRITABLE   = 1u << 2u,
+        ID_FLAG_BUILTIN        = 1u << 3u,
+        ID_FLAG_MEMBER_BUILTIN = 1u << 4u,
+        ID_FLAG_ARRAY_STRIDE   = 1u << 5u
+    };
+
+    struct IdInfo
+    {
+        // Offset of the instruction that defines this id (types, constants and variables only)
+        Uint32 DefOffset = 0;
+
+        // Offsets of the decoration literals, in words
+        Uint32 BindingOffset       = 0;
+        Uint32 DescriptorSetOffset = 0;
+        Uint32 LocationOffset      = 0;
+
+        Uint32 ArrayStride = 0;
+
+        const char* Name         = nullptr;
+        const char* HlslSemantic = nullptr;
+
+        Uint8 Flags = ID_FLAG_NONE;
+    };
+
+    struct MemberDecoration
+    {
+        Uint32          StructId;
+        Uint32          Member;
+        spv::Decoration Decoration;
+        Uint32          Value;
+
+        bool operator<(const MemberDecoration& rhs) const
+        {
+            return StructId != rhs.StructId ? StructId < rhs.StructId : Member < rhs.Member;
+        }
+    };
+
+    struct MemberDecorations
+    {
+        Uint32 Offset       = 0;
+        Uint32 MatrixStride = 0;
+        bool   HasOffset       = false;
+        bool   HasMatrixStride = false;
+        bool   RowMajor        = false;
+        bool   ColMajor        = false;
+        bool   NonWritable     = false;
+    };
+
+    struct EntryPointInfo
+    {
+        spv::ExecutionModel Model;
+        Uint32              FunctionId;
+        const char*         Name;
+        Uint32              InterfaceStart;
+        Uint32              InterfaceEnd;
+    };
+
+    struct LocalSizeInfo
+    {
+        Uint32                FunctionId;
+        bool                  IsId;
+        std::array<Uint32, 3> Size;
+    };
+
+    const uint32_t* GetDef(Uint32 Id) const
+    {
+        return Id < m_Ids.size() && m_Ids[Id].DefOffset != 0 ? &m_SPIRV[m_Ids[Id].DefOffset] : nullptr;
+    }
+
+    static spv::Op GetOpcode(const uint32_t* pInstr)
+    {
+        return static_cast<spv::Op>(pInstr[0] & spv::OpCodeMask);
+    }
+
+    static Uint32 GetWordCount(const uint32_t* pInstr)
+    {
+        return pInstr[0] >> spv::WordCountShift;
+    }
+
+    // Returns the string literal that starts at word Offset, or null if the string
+    // is not terminated before word End.
+    const char* GetString(size_t Offset, size_t End) const
+    {
+        if (Offset >= End)
+            return nullptr;
+        const auto* Str    = reinterpret_cast<const char*>(&m_SPIRV[Offset]);
+        const auto  MaxLen = (End - Offset) * sizeof(uint32_t);
+        return memchr(Str, 0, MaxLen) != nullptr ? Str : nullptr;
+    }
+
+    // Minimal number of words in a valid type declaration instruction, so that
+    // all operands accessed by the parser are guaranteed to be present.
+    static Uint32 GetMinTypeWordCount(spv::Op OpCode)
+    {
+        switch (OpCode)
+        {
+            // clang-format off
+            case spv::OpTypeImage:        return 9;
+            case spv::OpTypeVector:
+            case spv::OpTypeMatrix:
+            case spv::OpTypeArray:
+            case spv::OpTypePointer:      return 4;
+            case spv::OpTypeInt:
+            case spv::OpTypeFloat:
+            case spv::OpTypeSampledImage:
+            case spv::OpTypeRuntimeArray: return 3;
+            default:                      return 2;
+            // clang-format on
+        }
+    }
+
+    static size_t GetStringWordCount(const char* Str)
+    {
+        return strlen(Str) / sizeof(uint32_t) + 1;
+    }
+
+    bool ParseInstructions();
+
+    bool GetConstantU32(Uint32 Id, Uint32& Value) const;
+
+    // Strips arrays from the type and returns the innermost element type.
+    // ArraySize receives the size of the innermost array dimension (0 for runtime arrays).
+    const uint32_t* StripArrays(Uint32 TypeId, Uint32& ArraySize, bool& Success) const;
+
+    MemberDecorations GetMemberDecorations(Uint32 StructId, Uint32 Member) const;
+
+    bool GetDeclaredStructSize(Uint32 StructId, Uint32& Size) const;
+    bool GetDeclaredStructMemberSize(Uint32 StructId, Uint32 Member, Uint32& Size) const;
+    bool GetRuntimeArrayStride(Uint32 StructId, Uint32& Stride) const;
+
+    bool IsSSBOInstanceNameSignificant() const;
+
+    const std::string& GetName(Uint32 Id, std::string& Buffer, bool Fallback) const;
+
+    bool InitResource(Uint32 VarId, const uint32_t* pPtrType, SPIRVReflection::Resource& Res) const;
+
+private:
+    const std::vector<uint32_t>& m_SPIRV;
+
+    std::vector<IdInfo>           m_Ids;
+    std::vector<MemberDecoration> m_MemberDecorations;
+    std::vector<EntryPointInfo>   m_EntryPoints;
+    std::vector<LocalSizeInfo>    m_LocalSizes;
+    std::vector<Uint32>           m_Variables;
+
+    Uint32 m_Version = 0;
+
+    bool m_SourceKnown        = false;
+    bool m_IsHLSL             = false;
+    bool m_HlslFunctionality1 = false;
+};
+
+bool SPIRVParser::ParseInstructions()
+{
+    if (m_SPIRV.size() < 5 || m_SPIRV[0] != spv::MagicNumber)
+        return false;
+
+    m_Version = m_SPIRV[1];
+
+    const auto Bound = m_SPIRV[3];
+    // Protect against corrupted headers
+    if (Bound > m_SPIRV.size() * 4)
+        return false;
+    m_Ids.resize(Bound);
+
+    size_t Offset = 5;
+    while (Offset < m_SPIRV.size())
+    {
+        const auto* pInstr    = &m_SPIRV[Offset];
+        const auto  WordCount = GetWordCount(pInstr);
+        const auto  OpCode    = GetOpcode(pInstr);
+        if (WordCount == 0 || Offset + WordCount > m_SPIRV.size())
+            return false;
+
+        const auto End = Offset + WordCount;
+
+        auto GetId = [&](Uint32 Word) -> IdInfo* {
+            if (Word >= WordCount)
+                return nullptr;
+            const auto Id = pInstr[Word];
+            return Id < m_Ids.size() ? &m_Ids[Id] : nullptr;
+        };
+
+        auto SetDef = [&](Uint32 IdWord) {
+            auto* pId = GetId(IdWord);
+            if (pId == nullptr)
+                return false;
+            pId->DefOffset = static_cast<Uint32>(Offset);
+            return true;
+        };
+
+        switch (OpCode)
+        {
+            case spv::OpSource:
+                if (WordCount < 2)
+                    return false;
+                switch (static_cast<spv::SourceLanguage>(pInstr[1]))
+                {
+                    case spv::SourceLanguageESSL:
+                    case spv::SourceLanguageGLSL:
+                        m_SourceKnown = true;
+                        m_IsHLSL      = false;
+                        break;
+
+                    case spv::SourceLanguageHLSL:
+                        m_SourceKnown = true;
+                        m_IsHLSL      = true;
+                        break;
+
+                    default:
+                        m_SourceKnown = false;
+                }
+                break;
+
+            case spv::OpName:
+            {
+                auto* pId = GetId(1);
+                if (pId == nullptr)
+                    return false;
+                pId->Name = GetString(Offset + 2, End);
+                if (pId->Name == nullptr)
+                    return false;
+                break;
+            }
+
+            case spv::OpExtension:
+            {
+                const auto* Ext = GetString(Offset + 1, End);
+                if (Ext == nullptr)
+                    return false;
+                if (strcmp(Ext, "SPV_GOOGLE_hlsl_functionality1") == 0)
+                    m_HlslFunctionality1 = true;
+                break;
+            }
+
+            case spv::OpEntryPoint:
+            {
+                if (WordCount < 4)
+                    return false;
+                const auto* Name = GetString(Offset + 3, End);
+                if (Name == nullptr)
+                    return false;
+                const auto InterfaceStart = Offset + 3 + GetStringWordCount(Name);
+                m_EntryPoints.push_back({static_cast<spv::ExecutionModel>(pInstr[1]), pInstr[2], Name,
+                                         static_cast<Uint32>(std::min(InterfaceStart, End)), static_cast<Uint32>(End)});
+                break;
+            }
+
+            case spv::OpExecutionMode:
+            case spv::OpExecutionModeId:
+            {
+                if (WordCount < 3)
+                    return false;
+                const auto Mode = static_cast<spv::ExecutionMode>(pInstr[2]);
+                if (Mode == spv::ExecutionModeLocalSize || Mode == spv::ExecutionModeLocalSizeId)
+                {
+                    if (WordCount < 6)
+                        return false;
+                    m_LocalSizes.push_back({pInstr[1], Mode == spv::ExecutionModeLocalSizeId, {pInstr[3], pInstr[4], pInstr[5]}});
+                }
+                break;
+            }
+
+            case spv::OpDecorate:
+            case spv::OpDecorateId:
+            {
+                auto* pId = GetId(1);
+                if (pId == nullptr || WordCount < 3)
+                    return false;
+                const auto Decoration = static_cast<spv::Decoration>(pInstr[2]);
+                const auto HasValue   = WordCount >= 4;
+                switch (Decoration)
+                {
+                    // clang-format off
+                    case spv::DecorationBinding:       pId->BindingOffset       = HasValue ? static_cast<Uint32>(Offset + 3) : 0; break;
+                    case spv::DecorationDescriptorSet: pId->DescriptorSetOffset = HasValue ? static_cast<Uint32>(Offset + 3) : 0; break;
+                    case spv::DecorationLocation:      pId->LocationOffset      = HasValue ? static_cast<Uint32>(Offset + 3) : 0; break;
+                    case spv::DecorationBlock:         pId->Flags |= ID_FLAG_BLOCK;        break;
+                    case spv::DecorationBufferBlock:   pId->Flags |= ID_FLAG_BUFFER_BLOCK; break;
+                    case spv::DecorationNonWritable:   pId->Flags |= ID_FLAG_NON_WRITABLE; break;
+                    case spv::DecorationBuiltIn:       pId->Flags |= ID_FLAG_BUILTIN;      break;
+                    // clang-format on
+                    case spv::DecorationArrayStride:
+                        if (!HasValue)
+                            return false;
+                        pId->ArrayStride = pInstr[3];
+                        pId->Flags |= ID_FLAG_ARRAY_STRIDE;
+                        break;
+
+                    default:
+                        break;
+                }
+                break;
+            }
+
+            case spv::OpDecorateStringGOOGLE:
+            {
+                auto* pId = GetId(1);
+                if (pId == nullptr || WordCount < 4)
+                    return false;
+                if (static_cast<spv::Decoration>(pInstr[2]) == spv::DecorationHlslSemanticGOOGLE)
+                {
+                    pId->HlslSemantic = GetString(Offset + 3, End);
+                    if (pId->HlslSemantic == nullptr)
+                        return false;
+                }
+                break;
+            }
+
+            case spv::OpMemberDecorate:
+            {
+                auto* pId = GetId(1);
+                if (pId == nullptr || WordCount < 4)
+                    return false;
+                const auto Decoration = static_cast<spv::Decoration>(pInstr[3]);
+                switch (Decoration)
+                {
+                    case spv::DecorationBuiltIn:
+                        pId->Flags |= ID_FLAG_MEMBER_BUILTIN;
+                        break;
+
+                    case spv::DecorationOffset:
+                    case spv::DecorationMatrixStride:
+                    case spv::DecorationRowMajor:
+                    case spv::DecorationColMajor:
+                    case spv::DecorationNonWritable:
+                        m_MemberDecorations.push_back({pInstr[1], pInstr[2], Decoration, WordCount >= 5 ? pInstr[4] : 0});
+                        break;
+
+                    default:
+                        break;
+                }
+                break;
+            }
+
+            case spv::OpGroupDecorate:
+            case spv::OpGroupMemberDecorate:
+                // Decoration groups are deprecated and are not emitted by modern compilers
+                return false;
+
+            case spv::OpTypeVoid:
+            case spv::OpTypeBool:
+            case spv::OpTypeInt:
+            case spv::OpTypeFloat:
+            case spv::OpTypeVector:
+            case spv::OpTypeMatrix:
+            case spv::OpTypeImage:
+            case spv::OpTypeSampler:
+            case spv::OpTypeSampledImage:
+            case spv::OpTypeArray:
+            case spv::OpTypeRuntimeArray:
+            case spv::OpTypeStruct:
+            case spv::OpTypePointer:
+            case spv::OpTypeAccelerationStructureKHR:
+                if (WordCount < GetMinTypeWordCount(OpCode) || !SetDef(1))
+                    return false;
+                break;
+
+            case spv::OpConstant:
+            case spv::OpConstantTrue:
+            case spv::OpConstantFalse:
+            case spv::OpConstantComposite:
+            case spv::OpConstantNull:
+            case spv::OpSpecConstant:
+            case spv::OpSpecConstantTrue:
+            case spv::OpSpecConstantFalse:
+            case spv::OpSpecConstantComposite:
+            case spv::OpSpecConstantOp:
+                if (WordCount < 3 || !SetDef(2))
+                    return false;
+                break;
+
+            case spv::OpVariable:
+                if (WordCount < 4 || !SetDef(2))
+                    return false;
+                if (static_cast<spv::StorageClass>(pInstr[3]) != spv::StorageClassFunction)
+                    m_Variables.push_back(pInstr[2]);
+                break;
+
+            case spv::OpFunction:
+                // All global declarations precede function definitions
+                return true;
+
+            default:
+                break;
+        }
+
+        Offset = End;
+    }
+
+    return true;
+}
+
+bool SPIRVParser::GetConstantU32(Uint32 Id, Uint32& Value) const
+{
+    const auto* pConst = GetDef(Id);
+    // Specialization constants are not handled
+    if (pConst == nullptr || GetOpcode(pConst) != spv::OpConstant || GetWordCount(pConst) < 4)
+        return false;
+    Value = pConst[3];
+    return true;
+}
+
+const uint32_t* SPIRVParser::StripArrays(Uint32 TypeId, Uint32& ArraySize, bool& Success) const
+{
+    ArraySize = 1;
+    Success   = true;
+
+    const auto* pType = GetDef(TypeId);
+    while (pType != nullptr)
+    {
+        const auto OpCode = GetOpcode(pType);
+        if (OpCode == spv::OpTypeArray)
+        {
+            if (!GetConstantU32(pType[3], ArraySize))
+            {
+                Success = false;
+                return nullptr;
+            }
+        }
+        else if (OpCode == spv::OpTypeRuntimeArray)
+        {
+            ArraySize = 0;
+        }
+        else
+        {
+            return pType;
+        }
+        pType = GetDef(pType[2]);
+    }
+
+    Success = false;
+    return nullptr;
+}
+
+SPIRVParser::MemberDecorations SPIRVParser::GetMemberDecorations(Uint32 StructId, Uint32 Member) const
+{
+    MemberDecorations Decorations;
+
+    const MemberDecoration Key{StructId, Member, spv::DecorationMax, 0};
+    const auto             Range = std::equal_range(m_MemberDecorations.begin(), m_MemberDecorations.end(), Key);
+    for (auto it = Range.first; it != Range.second; ++it)
+    {
+        switch (it->Decoration)
+        {
+            case spv::DecorationOffset:
+                Decorations.Offset    = it->Value;
+                Decorations.HasOffset = true;
+                break;
+
+            case spv::DecorationMatrixStride:
+                Decorations.MatrixStride    = it->Value;
+                Decorations.HasMatrixStride = true;
+                break;
+
+            // clang-format off
+            case spv::DecorationRowMajor:    Decorations.RowMajor    = true; break;
+            case spv::DecorationColMajor:    Decorations.ColMajor    = true; break;
+            case spv::DecorationNonWritable: Decorations.NonWritable = true; break;
+            // clang-format on
+            default:
+                UNEXPECTED("Unexpected member decoration");
+        }
+    }
+
+    return Decorations;
+}
+
+bool SPIRVParser::GetDeclaredStructSize(Uint32 StructId, Uint32& Size) const
+{
+    const auto* pStruct = GetDef(StructId);
+    if (pStruct == nullptr || GetOpcode(pStruct) != spv::OpTypeStruct)
+        return false;
+
+    const auto NumMembers = GetWordCount(pStruct) - 2;
+    if (NumMembers == 0)
+        return false;
+
+    // Offsets can be declared out of order, so the size is deduced from the member with the highest offset
+    Uint32 HighestOffset = 0;
+    Uint32 MemberIndex   = 0;
+    for (Uint32 i = 0; i < NumMembers; ++i)
+    {
+        const auto Decorations = GetMemberDecorations(StructId, i);
+        if (!Decorations.HasOffset)
+            return false;
+        if (Decorations.Offset > HighestOffset)
+        {
+            HighestOffset = Decorations.Offset;
+            MemberIndex   = i;
+        }
+    }
+
+    Uint32 MemberSize = 0;
+    if (!GetDeclaredStructMemberSize(StructId, MemberIndex, MemberSize))
+        return false;
+
+    Size = HighestOffset + MemberSize;
+    return true;
+}
+
+bool SPIRVParser::GetDeclaredStructMemberSize(Uint32 StructId, Uint32 Member, Uint32& Size) const
+{
+    const auto* pStruct      = GetDef(StructId);
+    const auto  MemberTypeId = pStruct[2 + Member];
+    const auto* pType        = GetDef(MemberTypeId);
+    if (pType == nullptr)
+        return false;
+
+    auto GetScalarSize = [this](Uint32 TypeId, Uint32& ScalarSize) {
+        const auto* pScalar = GetDef(TypeId);
+        if (pScalar == nullptr)
+            return false;
+        const auto OpCode = GetOpcode(pScalar);
+        if (OpCode != spv::OpTypeInt && OpCode != spv::OpTypeFloat)
+            return false;
+        ScalarSize = pScalar[2] / 8;
+        return true;
+    };
+
+    switch (GetOpcode(pType))
+    {
+        case spv::OpTypeArray:
+        case spv::OpTypeRuntimeArray:
+        {
+            Uint32 ArraySize = 0;
+            if (GetOpcode(pType) == spv::OpTypeArray && !GetConstantU32(pType[3], ArraySize))
+                return false;
+            const auto& TypeInfo = m_Ids[MemberTypeId];
+            if ((TypeInfo.Flags & ID_FLAG_ARRAY_STRIDE) == 0)
+                return false;
+            Size = TypeInfo.ArrayStride * ArraySize;
+            return true;
+        }
+
+        case spv::OpTypeStruct:
+            return GetDeclaredStructSize(MemberTypeId, Size);
+
+        case spv::OpTypeInt:
+        case spv::OpTypeFloat:
+            return GetScalarSize(MemberTypeId, Size);
+
+        case spv::OpTypeVector:
+        {
+            Uint32 ComponentSize = 0;
+            if (!GetScalarSize(pType[2], ComponentSize))
+                return false;
+            Size = ComponentSize * pType[3];
+            return true;
+        }
+
+        case spv::OpTypeMatrix:
+        {
+            const auto* pColumn = GetDef(pType[2]);
+            if (pColumn == nullptr || GetOpcode(pColumn) != spv::OpTypeVector)
+                return false;
+
+            const auto VecSize     = pColumn[3];
+            const auto Columns     = pType[3];
+            const auto Decorations = GetMemberDecorations(StructId, Member);
+            if (!Decorations.HasMatrixStride)
+                return false;
+
+            // Per SPIR-V spec, matrices must be tightly packed and aligned up for vec3 accesses.
+            if (Decorations.RowMajor)
+                Size = Decorations.MatrixStride * VecSize;
+            else if (Decorations.ColMajor)
+                Size = Decorations.MatrixStride * Columns;
+            else
+                return false;
+            return true;
+        }
+
+        case spv::OpTypePointer:
+            if (static_cast<spv::StorageClass>(pType[2]) != spv::StorageClassPhysicalStorageBuffer)
+                return false;
+            Size = 8;
+            return true;
+
+        default:
+            // Opaque types have no declared size
+            return false;
+    }
+}
+
+bool SPIRVParser::GetRuntimeArrayStride(Uint32 StructId, Uint32& Stride) const
+{
+    Stride = 0;
+
+    const auto* pStruct      = GetDef(StructId);
+    const auto  NumMembers   = GetWordCount(pStruct) - 2;
+    const auto  LastMemberId = pStruct[2 + NumMembers - 1];
+    const auto* pLastType    = GetDef(LastMemberId);
+    if (pLastType == nullptr)
+        return false;
+
+    const auto OpCode = GetOpcode(pLastType);
+    if (OpCode != spv::OpTypeArray && OpCode != spv::OpTypeRuntimeArray)
+        return true;
+
+    // Only the innermost array dimension is checked, exactly as SPIRV-Cross does
+    Uint32 InnermostSize = 0;
+    bool   Success       = false;
+    StripArrays(LastMemberId, InnermostSize, Success);
+    if (!Success || InnermostSize != 0)
+        return Success;
+
+    const auto& TypeInfo = m_Ids[LastMemberId];
+    if ((TypeInfo.Flags & ID_FLAG_ARRAY_STRIDE) == 0)
+        return false;
+
+    Stride = TypeInfo.ArrayStride;
+    return true;
+}
+
+bool SPIRVParser::IsSSBOInstanceNameSignificant() const
+{
+    if (m_SourceKnown)
+    {
+        // UAVs from HLSL source tend to be declared in a way where the type is reused
+        // but the instance name is significant.
+        return m_IsHLSL;
+    }
+
+    // If the source language is unknown, assume HLSL-style UAV declarations if
+    // a block type is used by more than one storage buffer.
+    std::vector<Uint32> SSBOTypes;
+    for (auto VarId : m_Variables)
+    {
+        const auto* pVar     = GetDef(VarId);
+        const auto* pPtrType = GetDef(pVar[1]);
+        if (pPtrType == nullptr || GetOpcode(pPtrType) != spv::OpTypePointer)
+            continue;
+
+        Uint32      ArraySize = 0;
+        bool        Success   = false;
+        const auto* pType     = StripArrays(pPtrType[3], ArraySize, Success);
+        if (pType == nullptr)
+            continue;
+
+        const auto Storage = static_cast<spv::StorageClass>(pVar[3]);
+        const auto TypeId  = pType[1];
+        const bool IsSSBO  = Storage == spv::StorageClassStorageBuffer ||
+            (Storage == spv::StorageClassUniform && (m_Ids[TypeId].Flags & ID_FLAG_BUFFER_BLOCK) != 0);
+        if (IsSSBO)
+        {
+            if (std::find(SSBOTypes.begin(), SSBOTypes.end(), TypeId) != SSBOTypes.end())
+                return true;
+            SSBOTypes.push_back(TypeId);
+        }
+    }
+    return false;
+}
+
+const std::string& SPIRVParser::GetName(Uint32 Id, std::string& Buffer, bool Fallback) const
+{
+    const auto* Name = m_Ids[Id].Name;
+    if (Name != nullptr && *Name != '\0')
+        Buffer = Name;
+    else if (Fallback)
+        Buffer = "_" + std::to_string(Id);
+    else
+        Buffer.clear();
+    return Buffer;
+}
+
+bool SPIRVParser::InitResource(Uint32 VarId, const uint32_t* pPtrType, SPIRVReflection::Resource& Res) const
+{
+    bool        Success = false;
+    const auto* pType   = StripArrays(pPtrType[3], Res.ArraySize, Success);
+    if (!Success)
+        return false;
+
+    const auto& VarInfo = m_Ids[VarId];
+
+    Res.BindingDecorationOffset       = VarInfo.BindingOffset;
+    Res.DescriptorSetDecorationOffset = VarInfo.DescriptorSetOffset;
+
+    if (GetOpcode(pType) == spv::OpTypeSampledImage)
+    {
+        pType = GetDef(pType[2]);
+        if (pType == nullptr)
+            return false;
+    }
+
+    if (GetOpcode(pType) == spv::OpTypeImage)
+    {
+        const auto Dim     = static_cast<spv::Dim>(pType[3]);
+        const auto Arrayed = pType[5] != 0;
+
+        Res.IsMS          = pType[6] != 0;
+        Res.IsTexelBuffer = Dim == spv::DimBuffer;
+        switch (Dim)
+        {
+            // clang-format off
+            case spv::Dim1D:     Res.ResourceDim = Arrayed ? RESOURCE_DIM_TEX_1D_ARRAY : RESOURCE_DIM_TEX_1D;     break;
+            case spv::Dim2D:     Res.ResourceDim = Arrayed ? RESOURCE_DIM_TEX_2D_ARRAY : RESOURCE_DIM_TEX_2D;     break;
+            case spv::Dim3D:     Res.ResourceDim = RESOURCE_DIM_TEX_3D;                                           break;
+            case spv::DimCube:   Res.ResourceDim = Arrayed ? RESOURCE_DIM_TEX_CUBE_ARRAY : RESOURCE_DIM_TEX_CUBE; break;
+            case spv::DimBuffer: Res.ResourceDim = RESOURCE_DIM_BUFFER;                                           break;
+            // clang-format on
+            default: Res.ResourceDim = RESOURCE_DIM_UNDEFINED;
+        }
+    }
+
+    return true;
+}
+
+bool SPIRVParser::Parse(SHADER_TYPE ShaderType, const std::string& EntryPoint, SPIRVReflection& Refl)
+{
+    if (!ParseInstructions())
+        return false;
+
+    std::stable_sort(m_MemberDecorations.begin(), m_MemberDecorations.end());
+
+    const auto ExecutionModel = ShaderTypeToSpvExecutionModel(ShaderType);
+
+    const EntryPointInfo* pEntryPoint = nullptr;
+    for (const auto& EP : m_EntryPoints)
+    {
+        if (EP.Model != ExecutionModel)
+            continue;
+
+        ++Refl.NumMatchingEntryPoints;
+        if (pEntryPoint == nullptr && (EntryPoint.empty() || EntryPoint == EP.Name))
+            pEntryPoint = &EP;
+    }
+    if (pEntryPoint == nullptr)
+        return false;
+
+    Refl.EntryPoint         = pEntryPoint->Name;
+    Refl.IsHLSLSource       = m_IsHLSL;
+    Refl.HlslFunctionality1 = m_HlslFunctionality1;
+
+    if (ShaderType == SHADER_TYPE_COMPUTE)
+    {
+        for (const auto& LocalSize : m_LocalSizes)
+        {
+            if (LocalSize.FunctionId != pEntryPoint->FunctionId)
+                continue;
+            // Workgroup sizes defined by constant ids are not handled
+            if (LocalSize.IsId)
+                return false;
+            Refl.ComputeGroupSize = LocalSize.Size;
+        }
+    }
+
+    auto IsInEntryPointInterface = [&](Uint32 VarId) {
+        for (auto i = pEntryPoint->InterfaceStart; i < pEntryPoint->InterfaceEnd; ++i)
+        {
+            if (m_SPIRV[i] == VarId)
+                return true;
+        }
+        return false;
+    };
+
+    const auto IsSSBOInstanceNameSignificant = this->IsSSBOInstanceNameSignificant();
+
+    std::string NameBuffer;
+    for (auto VarId : m_Variables)
+    {
+        const auto* pVar     = GetDef(VarId);
+        const auto* pPtrType = GetDef(pVar[1]);
+        if (pPtrType == nullptr || GetOpcode(pPtrType) != spv::OpTypePointer)
+            continue;
+
+        const auto Storage = static_cast<spv::StorageClass>(pVar[3]);
+
+        // In SPIR-V 1.4 and up, every global must be present in the entry point interface list,
+        // not just IO variables. Old shaders with a single entry point are assumed to use all variables.
+        bool IsActive = true;
+        if (m_Version < 0x10400)
+        {
+            if ((Storage == spv::StorageClassInput || Storage == spv::StorageClassOutput) && m_EntryPoints.size() > 1)
+                IsActive = IsInEntryPointInterface(VarId);
+        }
+        else
+        {
+            IsActive = IsInEntryPointInterface(VarId);
+        }
+        if (!IsActive)
+            continue;
+
+        Uint32      ArraySize = 0;
+        bool        Success   = false;
+        const auto* pType     = StripArrays(pPtrType[3], ArraySize, Success);
+        if (!Success)
+            return false;
+
+        const auto  TypeId   = pType[1];
+        const auto& TypeInfo = m_Ids[TypeId];
+        const auto  OpCode   = GetOpcode(pType);
+
+        if ((m_Ids[VarId].Flags & ID_FLAG_BUILTIN) != 0 || (TypeInfo.Flags & ID_FLAG_MEMBER_BUILTIN) != 0)
+            continue;
+
+        const bool IsImage         = OpCode == spv::OpTypeImage;
+        const bool IsUniformConst  = Storage == spv::StorageClassUniformConstant;
+        const bool IsSubpassInput  = IsUniformConst && IsImage && static_cast<spv::Dim>(pType[3]) == spv::DimSubpassData;
+        const auto ImageSampled    = IsImage ? pType[7] : 0;
+        const bool IsUniformBuffer = Storage == spv::StorageClassUniform && (TypeInfo.Flags & ID_FLAG_BLOCK) != 0;
+        const bool IsStorageBuffer = (Storage == spv::StorageClassUniform && (TypeInfo.Flags & ID_FLAG_BUFFER_BLOCK) != 0) ||
+            Storage == spv::StorageClassStorageBuffer;
+
+        if (Storage == spv::StorageClassInput)
+        {
+            SPIRVReflection::StageInput Input;
+            Input.Name                     = GetName(VarId, NameBuffer, false);
+            Input.Semantic                 = m_Ids[VarId].HlslSemantic;
+            Input.LocationDecorationOffset = m_Ids[VarId].LocationOffset;
+            Refl.StageInputs.emplace_back(std::move(Input));
+            continue;
+        }
+
+        std::vector<SPIRVReflection::Resource>* pResources = nullptr;
+        if (IsSubpassInput)
+            pResources = &Refl.SubpassInputs;
+        else if (IsUniformBuffer)
+            pResources = &Refl.UniformBuffers;
+        else if (IsStorageBuffer)
+            pResources = &Refl.StorageBuffers;
+        else if (IsUniformConst && IsImage && ImageSampled == 2)
+            pResources = &Refl.StorageImages;
+        else if (IsUniformConst && IsImage && ImageSampled == 1)
+            pResources = &Refl.SeparateImages;
+        else if (IsUniformConst && OpCode == spv::OpTypeSampler)
+            pResources = &Refl.SeparateSamplers;
+        else if (IsUniformConst && OpCode == spv::OpTypeSampledImage)
+            pResources = &Refl.SampledImages;
+        else if (Storage == spv::StorageClassAtomicCounter)
+            pResources = &Refl.AtomicCounters;
+        else if (IsUniformConst && OpCode == spv::OpTypeAccelerationStructureKHR)
+            pResources = &Refl.AccelerationStructures;
+        else
+            continue; // Outputs, push constants, shader record buffers, etc.
+
+        SPIRVReflection::Resource Res;
+        if (!InitResource(VarId, pPtrType, Res))
+            return false;
+
+        if (IsUniformBuffer || IsStorageBuffer)
+        {
+            // Block name is reported for uniform buffers. For storage buffers, the instance name
+            // is used when it is significant (e.g. HLSL source).
+            if (IsStorageBuffer && IsSSBOInstanceNameSignificant)
+                Res.Name = GetName(VarId, NameBuffer, true);
+            else if (TypeInfo.Name != nullptr && *TypeInfo.Name != '\0')
+                Res.Name = TypeInfo.Name;
+            else if (!GetName(VarId, NameBuffer, false).empty())
+                Res.Name = NameBuffer;
+            else
+                Res.Name = "_" + std::to_string(TypeId) + "_" + std::to_string(VarId);
+
+            // DXC emits the instance name that matches the cbuffer name in HLSL
+            if (IsUniformBuffer && m_IsHLSL && !GetName(VarId, NameBuffer, false).empty())
+                Res.Name = NameBuffer;
+
+            if (!GetDeclaredStructSize(TypeId, Res.BufferStaticSize))
+                return false;
+
+            if (IsStorageBuffer)
+            {
+                if (!GetRuntimeArrayStride(TypeId, Res.BufferStride))
+                    return false;
+
+                // Non-writable flag is propagated from the members if all of them have it
+                bool AllMembersNonWritable = true;
+                for (Uint32 i = 0; i < GetWordCount(pType) - 2 && AllMembersNonWritable; ++i)
+                    AllMembersNonWritable = GetMemberDecorations(TypeId, i).NonWritable;
+                Res.IsReadOnly = (m_Ids[VarId].Flags & ID_FLAG_NON_WRITABLE) != 0 || AllMembersNonWritable;
+            }
+        }
+        else
+        {
+            Res.Name = GetName(VarId, NameBuffer, false);
+        }
+
+        pResources->emplace_back(std::move(Res));
+    }
+
+    return true;
+}
+
+} // namespace
+
+bool SPIRVReflection::Parse(const std::vector<uint32_t>& SPIRV, SHADER_TYPE ShaderType, const std::string& EntryPoint)
+{
+    *this = {};
+    return SPIRVParser{SPIRV}.Parse(ShaderType, EntryPoint, *this);
+}
+
+} // namespace Diligent
@@ -124,6 +124,26 @@ SPIRVShaderResourceAttribs::SPIRVShaderResourceAttribs(const diligent_spirv_cros
 // clang-format on
 {}
 
+SPIRVShaderResourceAttribs::SPIRVShaderResourceAttribs(const SPIRVReflection::Resource& Res,
+                                                       const char*                      _Name,
+                                                       ResourceType                     _Type) noexcept :
+    // clang-format off
+    Name                          {_Name},
+    ArraySize                     {static_cast<Uint16>(Res.ArraySize)},
+    Type                          {_Type},
+    ResourceDim                   {Res.ResourceDim},
+    IsMS                          {Res.IsMS ? Uint8{1} : Uint8{0}},
+    BindingDecorationOffset       {Res.BindingDecorationOffset},
+    DescriptorSetDecorationOffset {Res.DescriptorSetDecorationOffset},
+    BufferStaticSize              {Res.BufferStaticSize},
+    BufferStride                  {Res.BufferStride}
+// clang-format on
+{
+    VERIFY(Res.ArraySize <= std::numeric_limits<decltype(ArraySize)>::max(), "Array size exceeds maximum representable value ", std::numeric_limits<decltype(ArraySize)>::max());
+    VERIFY(Res.BindingDecorationOffset != 0, "Resource \'", Res.Name, "\' has no binding decoration");
+    VERIFY(Res.DescriptorSetDecorationOffset != 0, "Resource \'", Res.Name, "\' has no descriptor set decoration");
+}
+
 
 SHADER_RESOURCE_TYPE SPIRVShaderResourceAttribs::GetShaderResourceType(ResourceType Type)
 {
@@ -265,8 +285,215 @@ SPIRVShaderResources::SPIRVShaderResources(IMemoryAllocator&     Allocator,
                                            const ShaderDesc&     shaderDesc,
                                            const char*           CombinedSamplerSuffix,
                                            bool                  LoadShaderStageInputs,
-                                           std::string&          EntryPoint) :
+                                           std::string&          EntryPoint,
+                                           ReflectionMode        Mode) :
     m_ShaderType{shaderDesc.ShaderType}
+{
+    if (Mode != ReflectionMode::SPIRVCross)
+    {
+        // Building the SPIRV-Cross IR is much more expensive than extracting
+        // the few bits of information we actually need, so try the lightweight parser first.
+        SPIRVReflection Reflection;
+        if (Reflection.Parse(spirv_binary, shaderDesc.ShaderType, EntryPoint))
+        {
+            EntryPoint = Reflection.EntryPoint;
+            if (Reflection.NumMatchingEntryPoints > 1)
+            {
+                LOG_WARNING_MESSAGE("More than one entry point of type ", GetShaderTypeLiteralName(shaderDesc.ShaderType), " found in SPIRV binary for shader '", shaderDesc.Name, "'. The first one ('", EntryPoint, "') will be used.");
+            }
+            LoadWithSPIRVReflection(Allocator, Reflection, shaderDesc, CombinedSamplerSuffix, LoadShaderStageInputs);
+            return;
+        }
+
+        if (Mode == ReflectionMode::Native)
+        {
+            LOG_ERROR_AND_THROW("Failed to parse SPIRV binary for shader '", shaderDesc.Name, "'");
+        }
+    }
+
+    LoadWithSPIRVCross(Allocator, std::move(spirv_binary), shaderDesc, CombinedSamplerSuffix, LoadShaderStageInputs, EntryPoint);
+}
+
+void SPIRVShaderResources::LoadWithSPIRVReflection(IMemoryAllocator&      Allocator,
+                                                   const SPIRVReflection& Reflection,
+                                                   const ShaderDesc&      shaderDesc,
+                                                   const char*            CombinedSamplerSuffix,
+                                                   bool                   LoadShaderStageInputs)
+{
+    m_IsHLSLSource = Reflection.IsHLSLSource;
+
+    size_t ResourceNamesPoolSize = 0;
+    static_assert(Uint32{SPIRVShaderResourceAttribs::ResourceType::NumResourceTypes} == 12, "Please account for the new resource type below");
+    for (auto* pResType :
+         {
+             &Reflection.UniformBuffers,
+             &Reflection.StorageBuffers,
+             &Reflection.StorageImages,
+             &Reflection.SampledImages,
+             &Reflection.AtomicCounters,
+             &Reflection.SeparateImages,
+             &Reflection.SeparateSamplers,
+             &Reflection.SubpassInputs,
+             &Reflection.AccelerationStructures //
+         })                                     //
+    {
+        for (const auto& res : *pResType)
+            ResourceNamesPoolSize += res.Name.length() + 1;
+    }
+
+    if (CombinedSamplerSuffix != nullptr)
+    {
+        ResourceNamesPoolSize += strlen(CombinedSamplerSuffix) + 1;
+    }
+
+    VERIFY_EXPR(shaderDesc.Name != nullptr);
+    ResourceNamesPoolSize += strlen(shaderDesc.Name) + 1;
+
+    Uint32 NumShaderStageInputs = 0;
+
+    if (!m_IsHLSLSource || Reflection.StageInputs.empty())
+        LoadShaderStageInputs = false;
+    if (LoadShaderStageInputs)
+    {
+        if (Reflection.HlslFunctionality1)
+        {
+            for (const auto& Input : Reflection.StageInputs)
+            {
+                if (Input.Semantic != nullptr)
+                {
+                    ResourceNamesPoolSize += strlen(Input.Semantic) + 1;
+                    ++NumShaderStageInputs;
+                }
+                else
+                {
+                    LOG_ERROR_MESSAGE("Shader input '", Input.Name, "' does not have DecorationHlslSemanticGOOGLE decoration, which is unexpected as the shader declares SPV_GOOGLE_hlsl_functionality1 extension");
+                }
+            }
+        }
+        else
+        {
+            LoadShaderStageInputs = false;
+            LOG_WARNING_MESSAGE("SPIRV byte code of shader '", shaderDesc.Name,
+                                "' does not use SPV_GOOGLE_hlsl_functionality1 extension. "
+                                "As a result, it is not possible to get semantics of shader inputs and map them to proper locations. "
+                                "The shader will still work correctly if all attributes are declared in ascending order without any gaps. "
+                                "Enable SPV_GOOGLE_hlsl_functionality1 in your compiler to allow proper mapping of vertex shader inputs.");
+        }
+    }
+
+    ResourceCounters ResCounters;
+    ResCounters.NumUBs          = static_cast<Uint32>(Reflection.UniformBuffers.size());
+    ResCounters.NumSBs          = static_cast<Uint32>(Reflection.StorageBuffers.size());
+    ResCounters.NumImgs         = static_cast<Uint32>(Reflection.StorageImages.size());
+    ResCounters.NumSmpldImgs    = static_cast<Uint32>(Reflection.SampledImages.size());
+    ResCounters.NumACs          = static_cast<Uint32>(Reflection.AtomicCounters.size());
+    ResCounters.NumSepSmplrs    = static_cast<Uint32>(Reflection.SeparateSamplers.size());
+    ResCounters.NumSepImgs      = static_cast<Uint32>(Reflection.SeparateImages.size());
+    ResCounters.NumInptAtts     = static_cast<Uint32>(Reflection.SubpassInputs.size());
+    ResCounters.NumAccelStructs = static_cast<Uint32>(Reflection.AccelerationStructures.size());
+    static_assert(Uint32{SPIRVShaderResourceAttribs::ResourceType::NumResourceTypes} == 12, "Please set the new resource type counter here");
+
+    // Resource names pool is only needed to facilitate string allocation.
+    StringPool ResourceNamesPool;
+    Initialize(Allocator, ResCounters, NumShaderStageInputs, ResourceNamesPoolSize, ResourceNamesPool);
+
+    using ResourceType = SPIRVShaderResourceAttribs::ResourceType;
+
+    for (Uint32 i = 0; i < ResCounters.NumUBs; ++i)
+    {
+        const auto& UB = Reflection.UniformBuffers[i];
+        new (&GetUB(i)) SPIRVShaderResourceAttribs{UB, ResourceNamesPool.CopyString(UB.Name), ResourceType::UniformBuffer};
+    }
+
+    for (Uint32 i = 0; i < ResCounters.NumSBs; ++i)
+    {
+        const auto& SB      = Reflection.StorageBuffers[i];
+        const auto  ResType = SB.IsReadOnly ? ResourceType::ROStorageBuffer : ResourceType::RWStorageBuffer;
+        new (&GetSB(i)) SPIRVShaderResourceAttribs{SB, ResourceNamesPool.CopyString(SB.Name), ResType};
+    }
+
+    for (Uint32 i = 0; i < ResCounters.NumSmpldImgs; ++i)
+    {
+        const auto& SmplImg = Reflection.SampledImages[i];
+        const auto  ResType = SmplImg.IsTexelBuffer ? ResourceType::UniformTexelBuffer : ResourceType::SampledImage;
+        new (&GetSmpldImg(i)) SPIRVShaderResourceAttribs{SmplImg, ResourceNamesPool.CopyString(SmplImg.Name), ResType};
+    }
+
+    for (Uint32 i = 0; i < ResCounters.NumImgs; ++i)
+    {
+        const auto& Img     = Reflection.StorageImages[i];
+        const auto  ResType = Img.IsTexelBuffer ? ResourceType::StorageTexelBuffer : ResourceType::StorageImage;
+        new (&GetImg(i)) SPIRVShaderResourceAttribs{Img, ResourceNamesPool.CopyString(Img.Name), ResType};
+    }
+
+    for (Uint32 i = 0; i < ResCounters.NumACs; ++i)
+    {
+        const auto& AC = Reflection.AtomicCounters[i];
+        new (&GetAC(i)) SPIRVShaderResourceAttribs{AC, ResourceNamesPool.CopyString(AC.Name), ResourceType::AtomicCounter};
+    }
+
+    for (Uint32 i = 0; i < ResCounters.NumSepSmplrs; ++i)
+    {
+        const auto& SepSam = Reflection.SeparateSamplers[i];
+        new (&GetSepSmplr(i)) SPIRVShaderResourceAttribs{SepSam, ResourceNamesPool.CopyString(SepSam.Name), ResourceType::SeparateSampler};
+    }
+
+    for (Uint32 i = 0; i < ResCounters.NumSepImgs; ++i)
+    {
+        const auto& SepImg  = Reflection.SeparateImages[i];
+        const auto  ResType = SepImg.IsTexelBuffer ? ResourceType::UniformTexelBuffer : ResourceType::SeparateImage;
+        new (&GetSepImg(i)) SPIRVShaderResourceAttribs{SepImg, ResourceNamesPool.CopyString(SepImg.Name), ResType};
+    }
+
+    for (Uint32 i = 0; i < ResCounters.NumInptAtts; ++i)
+    {
+        const auto& SubpassInput = Reflection.SubpassInputs[i];
+        new (&GetInptAtt(i)) SPIRVShaderResourceAttribs{SubpassInput, ResourceNamesPool.CopyString(SubpassInput.Name), ResourceType::InputAttachment};
+    }
+
+    for (Uint32 i = 0; i < ResCounters.NumAccelStructs; ++i)
+    {
+        const auto& AccelStruct = Reflection.AccelerationStructures[i];
+        new (&GetAccelStruct(i)) SPIRVShaderResourceAttribs{AccelStruct, ResourceNamesPool.CopyString(AccelStruct.Name), ResourceType::AccelerationStructure};
+    }
+
+    static_assert(Uint32{SPIRVShaderResourceAttribs::ResourceType::NumResourceTypes} == 12, "Please initialize SPIRVShaderResourceAttribs for the new resource type here");
+
+    if (CombinedSamplerSuffix != nullptr)
+    {
+        m_CombinedSamplerSuffix = ResourceNamesPool.CopyString(CombinedSamplerSuffix);
+    }
+
+    m_ShaderName = ResourceNamesPool.CopyString(shaderDesc.Name);
+
+    if (LoadShaderStageInputs)
+    {
+        Uint32 CurrStageInput = 0;
+        for (const auto& Input : Reflection.StageInputs)
+        {
+            if (Input.Semantic != nullptr)
+            {
+                new (&GetShaderStageInputAttribs(CurrStageInput++)) SPIRVShaderStageInputAttribs //
+                    {
+                        ResourceNamesPool.CopyString(Input.Semantic),
+                        Input.LocationDecorationOffset //
+                    };
+            }
+        }
+        VERIFY_EXPR(CurrStageInput == GetNumShaderStageInputs());
+    }
+
+    VERIFY(ResourceNamesPool.GetRemainingSize() == 0, "Names pool must be empty");
+
+    m_ComputeGroupSize = Reflection.ComputeGroupSize;
+}
+
+void SPIRVShaderResources::LoadWithSPIRVCross(IMemoryAllocator&     Allocator,
+                                              std::vector<uint32_t> spirv_binary,
+                                              const ShaderDesc&     shaderDesc,
+                                              const char*           CombinedSamplerSuffix,
+                                              bool                  LoadShaderStageInputs,
+                                              std::string&          EntryPoint)
 {
     // https://github.com/KhronosGroup/SPIRV-Cross/wiki/Reflection-API-user-guide
     diligent_spirv_cross::Parser parser(move(spirv_binary));
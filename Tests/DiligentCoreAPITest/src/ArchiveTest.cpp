@@ -25,6 +25,9 @@
  */
 
 #include <array>
+#include <thread>
+#include <set>
+#include <cstring>
 
 #include "TestingEnvironment.hpp"
 #include "TestingSwapChainBase.hpp"
@@ -35,6 +38,8 @@
 #include "ShaderMacroHelper.hpp"
 #include "DataBlobImpl.hpp"
 #include "MemoryFileStream.hpp"
+#include "ThreadPool.hpp"
+#include "Timer.hpp"
 
 #include "ResourceLayoutTestCommon.hpp"
 #include "gtest/gtest.h"
@@ -2126,4 +2131,931 @@ TEST(ArchiveTest, ImmutableSamplers_GLSL)
     TestSamplers(true, SHADER_SOURCE_LANGUAGE_GLSL);
 }
 
+TEST(ArchiveTest, ParallelArchiving)
+{
+    auto* pEnv             = TestingEnvironment::GetInstance();
+    auto* pArchiverFactory = pEnv->GetArchiverFactory();
+
+    if (!pArchiverFactory)
+        GTEST_SKIP() << "Archiver library is not loaded";
+
+    constexpr Uint32 NumPipelines = 16;
+    constexpr Uint32 NumThreads   = 4;
+
+    constexpr char CSSource[] = R"(
+RWTexture2D<float4> g_tex2DUAV;
+
+[numthreads(16, 16, 1)]
+void main(uint3 DTid : SV_DispatchThreadID)
+{
+    g_tex2DUAV[DTid.xy] = float4(float(VALUE) / 16.0, 0.0, 0.0, 1.0);
+}
+)";
+
+    // Creates an archive with NumPipelines compute pipelines. Even pipelines use explicit
+    // resource signature, odd pipelines use default signatures.
+    const auto CreateArchive = [&](IThreadPool* pThreadPool, bool Reverse) //
+    {
+        SerializationDeviceCreateInfo DeviceCI;
+        DeviceCI.pThreadPool = pThreadPool;
+
+        RefCntAutoPtr<ISerializationDevice> pSerializationDevice;
+        pArchiverFactory->CreateSerializationDevice(DeviceCI, &pSerializationDevice);
+        if (!pSerializationDevice)
+            return RefCntAutoPtr<IDataBlob>{};
+
+        RefCntAutoPtr<IArchiver> pArchiver;
+        pArchiverFactory->CreateArchiver(pSerializationDevice, &pArchiver);
+        if (!pArchiver)
+            return RefCntAutoPtr<IDataBlob>{};
+
+        RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+        {
+            constexpr PipelineResourceDesc Resources[] = {{SHADER_TYPE_COMPUTE, "g_tex2DUAV", 1, SHADER_RESOURCE_TYPE_TEXTURE_UAV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC}};
+
+            PipelineResourceSignatureDesc PRSDesc;
+            PRSDesc.Name         = "ArchiveTest.ParallelArchiving - PRS";
+            PRSDesc.Resources    = Resources;
+            PRSDesc.NumResources = _countof(Resources);
+
+            pSerializationDevice->CreatePipelineResourceSignature(PRSDesc, GetDeviceBits(), &pPRS);
+            if (!pPRS)
+                return RefCntAutoPtr<IDataBlob>{};
+        }
+
+        std::atomic<Uint32> NumFailures{0};
+
+        const auto AddPipeline = [&](Uint32 Idx) //
+        {
+            const auto Value = std::to_string(Idx % (NumPipelines / 2));
+
+            ShaderMacroHelper Macros;
+            Macros.AddShaderMacro("VALUE", Value.c_str());
+
+            ShaderCreateInfo ShaderCI;
+            ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+            ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+            ShaderCI.UseCombinedTextureSamplers = true;
+            ShaderCI.Desc.ShaderType            = SHADER_TYPE_COMPUTE;
+            ShaderCI.Desc.Name                  = "Parallel archiving test CS";
+            ShaderCI.EntryPoint                 = "main";
+            ShaderCI.Source                     = CSSource;
+            ShaderCI.Macros                     = Macros;
+
+            RefCntAutoPtr<IShader> pCS;
+            pSerializationDevice->CreateShader(ShaderCI, GetDeviceBits(), &pCS);
+            if (!pCS)
+            {
+                ++NumFailures;
+                return;
+            }
+
+            const auto PSOName = std::string{"ArchiveTest.ParallelArchiving - PSO "} + std::to_string(Idx);
+
+            ComputePipelineStateCreateInfo PSOCreateInfo;
+            PSOCreateInfo.PSODesc.Name         = PSOName.c_str();
+            PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+            PSOCreateInfo.pCS                  = pCS;
+
+            IPipelineResourceSignature* Signatures[] = {pPRS};
+            if (Idx % 2 == 0)
+            {
+                PSOCreateInfo.ResourceSignaturesCount = _countof(Signatures);
+                PSOCreateInfo.ppResourceSignatures    = Signatures;
+            }
+            else
+            {
+                PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+            }
+
+            PipelineStateArchiveInfo ArchiveInfo;
+            ArchiveInfo.DeviceFlags = GetDeviceBits();
+            if (!pArchiver->AddComputePipelineState(PSOCreateInfo, ArchiveInfo))
+                ++NumFailures;
+        };
+
+        if (pThreadPool != nullptr)
+        {
+            // Add pipelines from multiple threads
+            std::vector<std::thread> Threads(NumThreads);
+            for (Uint32 t = 0; t < NumThreads; ++t)
+            {
+                Threads[t] = std::thread{
+                    [&, t]() //
+                    {
+                        for (Uint32 i = t; i < NumPipelines; i += NumThreads)
+                            AddPipeline(Reverse ? NumPipelines - 1 - i : i);
+                    }};
+            }
+            for (auto& Thread : Threads)
+                Thread.join();
+        }
+        else
+        {
+            for (Uint32 i = 0; i < NumPipelines; ++i)
+                AddPipeline(Reverse ? NumPipelines - 1 - i : i);
+        }
+
+        RefCntAutoPtr<IDataBlob> pBlob;
+        if (NumFailures == 0)
+            pArchiver->SerializeToBlob(&pBlob);
+        return pBlob;
+    };
+
+    auto pRefBlob = CreateArchive(nullptr, false);
+    ASSERT_NE(pRefBlob, nullptr);
+
+    // Pipelines added in different order must produce the same archive
+    auto pReverseBlob = CreateArchive(nullptr, true);
+    ASSERT_NE(pReverseBlob, nullptr);
+    ASSERT_EQ(pRefBlob->GetSize(), pReverseBlob->GetSize());
+    EXPECT_EQ(memcmp(pRefBlob->GetConstDataPtr(), pReverseBlob->GetConstDataPtr(), pRefBlob->GetSize()), 0);
+
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    for (Uint32 Attempt = 0; Attempt < 4; ++Attempt)
+    {
+        auto pParallelBlob = CreateArchive(pThreadPool, (Attempt & 0x01) != 0);
+        ASSERT_NE(pParallelBlob, nullptr);
+        ASSERT_EQ(pRefBlob->GetSize(), pParallelBlob->GetSize());
+        EXPECT_EQ(memcmp(pRefBlob->GetConstDataPtr(), pParallelBlob->GetConstDataPtr(), pRefBlob->GetSize()), 0);
+    }
+
+    pThreadPool->StopThreads();
+}
+
+TEST(ArchiveTest, CompressedArchive)
+{
+    auto* pEnv             = TestingEnvironment::GetInstance();
+    auto* pDevice          = pEnv->GetDevice();
+    auto* pArchiverFactory = pEnv->GetArchiverFactory();
+    auto* pDearchiver      = pDevice->GetEngineFactory()->GetDearchiver();
+
+    if (!pDearchiver || !pArchiverFactory)
+        GTEST_SKIP() << "Archiver library is not loaded";
+
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+        GTEST_SKIP() << "Compute shaders are not supported by device";
+
+    TestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr Uint32 NumPipelines = 32;
+
+    constexpr char CSSource[] = R"(
+RWTexture2D<float4> g_tex2DUAV;
+
+[numthreads(16, 16, 1)]
+void main(uint3 DTid : SV_DispatchThreadID)
+{
+    float4 Color = float4(0.0, 0.0, 0.0, 1.0);
+    for (int i = 0; i < VALUE; ++i)
+        Color.r += sin(float(DTid.x + i)) * cos(float(DTid.y + i));
+    g_tex2DUAV[DTid.xy] = Color;
+}
+)";
+
+    const auto GetPSOName = [](Uint32 Idx) //
+    {
+        return std::string{"ArchiveTest.CompressedArchive - PSO "} + std::to_string(Idx);
+    };
+
+    SerializationDeviceCreateInfo DeviceCI;
+
+    RefCntAutoPtr<ISerializationDevice> pSerializationDevice;
+    pArchiverFactory->CreateSerializationDevice(DeviceCI, &pSerializationDevice);
+    ASSERT_NE(pSerializationDevice, nullptr);
+
+    RefCntAutoPtr<IArchiver> pArchiver;
+    pArchiverFactory->CreateArchiver(pSerializationDevice, &pArchiver);
+    ASSERT_NE(pArchiver, nullptr);
+
+    for (Uint32 i = 0; i < NumPipelines; ++i)
+    {
+        const auto Value = std::to_string(i + 1);
+
+        ShaderMacroHelper Macros;
+        Macros.AddShaderMacro("VALUE", Value.c_str());
+
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+        ShaderCI.UseCombinedTextureSamplers = true;
+        ShaderCI.Desc.ShaderType            = SHADER_TYPE_COMPUTE;
+        ShaderCI.Desc.Name                  = "Compressed archive test CS";
+        ShaderCI.EntryPoint                 = "main";
+        ShaderCI.Source                     = CSSource;
+        ShaderCI.Macros                     = Macros;
+
+        RefCntAutoPtr<IShader> pCS;
+        pSerializationDevice->CreateShader(ShaderCI, GetDeviceBits(), &pCS);
+        ASSERT_NE(pCS, nullptr);
+
+        const auto PSOName = GetPSOName(i);
+
+        ComputePipelineStateCreateInfo PSOCreateInfo;
+        PSOCreateInfo.PSODesc.Name                               = PSOName.c_str();
+        PSOCreateInfo.PSODesc.PipelineType                       = PIPELINE_TYPE_COMPUTE;
+        PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+        PSOCreateInfo.pCS                                        = pCS;
+
+        PipelineStateArchiveInfo ArchiveInfo;
+        ArchiveInfo.DeviceFlags = GetDeviceBits();
+        ASSERT_TRUE(pArchiver->AddComputePipelineState(PSOCreateInfo, ArchiveInfo));
+    }
+
+    RefCntAutoPtr<IDataBlob> pBlob;
+    pArchiver->SerializeToBlob(&pBlob);
+    ASSERT_NE(pBlob, nullptr);
+
+    pArchiver->EnableCompression(True);
+    RefCntAutoPtr<IDataBlob> pCompressedBlob;
+    pArchiver->SerializeToBlob(&pCompressedBlob);
+    ASSERT_NE(pCompressedBlob, nullptr);
+    EXPECT_LT(pCompressedBlob->GetSize(), pBlob->GetSize());
+
+    {
+        RefCntAutoPtr<IArchive> pSource{MakeNewRCObj<ArchiveMemoryImpl>{}(pCompressedBlob)};
+        EXPECT_TRUE(pArchiverFactory->PrintArchiveContent(pSource));
+    }
+
+    // Removing device data must preserve the compression
+    RefCntAutoPtr<IDataBlob> pRepackedBlob;
+
+    const auto CurrentDeviceFlag = static_cast<ARCHIVE_DEVICE_DATA_FLAGS>(1u << pDevice->GetDeviceInfo().Type);
+    auto       RemovedFlags      = GetDeviceBits() & ~CurrentDeviceFlag;
+    if ((CurrentDeviceFlag & (ARCHIVE_DEVICE_DATA_FLAG_GL | ARCHIVE_DEVICE_DATA_FLAG_GLES)) != 0)
+    {
+        // OpenGL and OpenGLES share the same device data
+        RemovedFlags &= ~(ARCHIVE_DEVICE_DATA_FLAG_GL | ARCHIVE_DEVICE_DATA_FLAG_GLES);
+    }
+    if (RemovedFlags != ARCHIVE_DEVICE_DATA_FLAG_NONE)
+    {
+        pRepackedBlob = DataBlobImpl::Create();
+        auto pStream  = MemoryFileStream::Create(pRepackedBlob);
+
+        RefCntAutoPtr<IArchive> pSource{MakeNewRCObj<ArchiveMemoryImpl>{}(pCompressedBlob)};
+        ASSERT_TRUE(pArchiverFactory->RemoveDeviceData(pSource, RemovedFlags, pStream));
+        EXPECT_LT(pRepackedBlob->GetSize(), pCompressedBlob->GetSize());
+    }
+
+    const auto UnpackPipelines = [&](IDataBlob* pData) //
+    {
+        Timer T;
+
+        RefCntAutoPtr<IArchive>             pSource{MakeNewRCObj<ArchiveMemoryImpl>{}(pData)};
+        RefCntAutoPtr<IDeviceObjectArchive> pArchive;
+        pDearchiver->CreateDeviceObjectArchive(pSource, &pArchive);
+        EXPECT_NE(pArchive, nullptr);
+        if (!pArchive)
+            return 0.0;
+
+        for (Uint32 i = 0; i < NumPipelines; ++i)
+        {
+            const auto PSOName = GetPSOName(i);
+
+            PipelineStateUnpackInfo UnpackInfo;
+            UnpackInfo.Name         = PSOName.c_str();
+            UnpackInfo.pArchive     = pArchive;
+            UnpackInfo.pDevice      = pDevice;
+            UnpackInfo.PipelineType = PIPELINE_TYPE_COMPUTE;
+
+            RefCntAutoPtr<IPipelineState> pPSO;
+            pDearchiver->UnpackPipelineState(UnpackInfo, &pPSO);
+            EXPECT_NE(pPSO, nullptr) << PSOName;
+        }
+
+        return T.GetElapsedTime();
+    };
+
+    const auto LoadTime           = UnpackPipelines(pBlob);
+    const auto CompressedLoadTime = UnpackPipelines(pCompressedBlob);
+    if (pRepackedBlob)
+        UnpackPipelines(pRepackedBlob);
+
+    LOG_INFO_MESSAGE("Archive with ", NumPipelines, " compute pipelines:\n",
+                     "    uncompressed: ", pBlob->GetSize(), " bytes, load time: ", LoadTime * 1000.0, " ms\n",
+                     "    compressed:   ", pCompressedBlob->GetSize(), " bytes (",
+                     static_cast<double>(pCompressedBlob->GetSize()) / static_cast<double>(pBlob->GetSize()) * 100.0,
+                     "%), load time: ", CompressedLoadTime * 1000.0, " ms");
+}
+
+TEST(ArchiveTest, BlobTable)
+{
+    auto* pEnv             = TestingEnvironment::GetInstance();
+    auto* pDevice          = pEnv->GetDevice();
+    auto* pArchiverFactory = pEnv->GetArchiverFactory();
+
+    if (!pArchiverFactory)
+        GTEST_SKIP() << "Archiver library is not loaded";
+
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+        GTEST_SKIP() << "Compute shaders are not supported by device";
+
+    TestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr Uint32 NumPipelines = 4;
+
+    constexpr char CSSource[] = R"(
+RWTexture2D<float4> g_tex2DUAV;
+
+[numthreads(16, 16, 1)]
+void main(uint3 DTid : SV_DispatchThreadID)
+{
+    g_tex2DUAV[DTid.xy] = float4(1.0, 0.0, 0.0, 1.0);
+}
+)";
+
+    SerializationDeviceCreateInfo DeviceCI;
+
+    RefCntAutoPtr<ISerializationDevice> pSerializationDevice;
+    pArchiverFactory->CreateSerializationDevice(DeviceCI, &pSerializationDevice);
+    ASSERT_NE(pSerializationDevice, nullptr);
+
+    RefCntAutoPtr<IArchiver> pArchiver;
+    pArchiverFactory->CreateArchiver(pSerializationDevice, &pArchiver);
+    ASSERT_NE(pArchiver, nullptr);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.UseCombinedTextureSamplers = true;
+    ShaderCI.Desc.ShaderType            = SHADER_TYPE_COMPUTE;
+    ShaderCI.Desc.Name                  = "Blob table test CS";
+    ShaderCI.EntryPoint                 = "main";
+    ShaderCI.Source                     = CSSource;
+
+    RefCntAutoPtr<IShader> pCS;
+    pSerializationDevice->CreateShader(ShaderCI, GetDeviceBits(), &pCS);
+    ASSERT_NE(pCS, nullptr);
+
+    // All pipelines use the same shader, so their device-specific data is identical
+    for (Uint32 i = 0; i < NumPipelines; ++i)
+    {
+        const auto PSOName = std::string{"ArchiveTest.BlobTable - PSO "} + std::to_string(i);
+
+        ComputePipelineStateCreateInfo PSOCreateInfo;
+        PSOCreateInfo.PSODesc.Name                               = PSOName.c_str();
+        PSOCreateInfo.PSODesc.PipelineType                       = PIPELINE_TYPE_COMPUTE;
+        PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+        PSOCreateInfo.pCS                                        = pCS;
+
+        PipelineStateArchiveInfo ArchiveInfo;
+        ArchiveInfo.DeviceFlags = GetDeviceBits();
+        ASSERT_TRUE(pArchiver->AddComputePipelineState(PSOCreateInfo, ArchiveInfo));
+    }
+
+    RefCntAutoPtr<IDataBlob> pBlob;
+    pArchiver->SerializeToBlob(&pBlob);
+    ASSERT_NE(pBlob, nullptr);
+
+    // On-disk archive layout, see DeviceObjectArchiveBase
+    struct ArchiveHeader
+    {
+        Uint32 MagicNumber;
+        Uint32 Version;
+        Uint32 NumChunks;
+        Uint32 Flags;
+        Uint32 BlobTableOffset;
+        Uint32 _Padding;
+    };
+    struct BlobTableHeader
+    {
+        Uint32 Count;
+        Uint32 _Padding;
+    };
+    struct FileOffsetAndSize
+    {
+        Uint32 Offset;
+        Uint32 Size;
+    };
+
+    const auto*  pData    = static_cast<const Uint8*>(pBlob->GetConstDataPtr());
+    const size_t DataSize = pBlob->GetSize();
+
+    ArchiveHeader Header;
+    ASSERT_GE(DataSize, sizeof(Header));
+    memcpy(&Header, pData, sizeof(Header));
+    EXPECT_EQ(Header.MagicNumber, 0xDE00000Au);
+    // Version 4 introduced the blob table, version 6 added pipeline content keys
+    EXPECT_EQ(Header.Version, 6u);
+    EXPECT_EQ(Header.Flags, 0u);
+
+    BlobTableHeader TableHeader;
+    ASSERT_LE(size_t{Header.BlobTableOffset} + sizeof(TableHeader), DataSize);
+    memcpy(&TableHeader, pData + Header.BlobTableOffset, sizeof(TableHeader));
+    ASSERT_GT(TableHeader.Count, 0u);
+
+    const size_t EntriesOffset  = size_t{Header.BlobTableOffset} + sizeof(TableHeader);
+    const size_t BlobDataOffset = EntriesOffset + sizeof(FileOffsetAndSize) * TableHeader.Count;
+    ASSERT_LE(BlobDataOffset, DataSize);
+
+    // Every blob must be within the archive, and all blobs must be unique
+    size_t                BlobDataSize = 0;
+    std::set<std::string> UniqueBlobs;
+    for (Uint32 i = 0; i < TableHeader.Count; ++i)
+    {
+        FileOffsetAndSize Entry;
+        memcpy(&Entry, pData + EntriesOffset + sizeof(Entry) * i, sizeof(Entry));
+        EXPECT_GT(Entry.Size, 0u);
+        ASSERT_LE(BlobDataOffset + Entry.Offset + Entry.Size, DataSize) << "Blob " << i << " is out of range";
+
+        BlobDataSize += Entry.Size;
+
+        const auto* pBlobData = reinterpret_cast<const char*>(pData + BlobDataOffset + Entry.Offset);
+        EXPECT_TRUE(UniqueBlobs.emplace(pBlobData, Entry.Size).second) << "Blob " << i << " is duplicated";
+    }
+    EXPECT_EQ(BlobDataOffset + BlobDataSize, DataSize);
+
+    RefCntAutoPtr<IArchive> pSource{MakeNewRCObj<ArchiveMemoryImpl>{}(pBlob)};
+
+    ArchiveBlobStatistics Stats;
+    ASSERT_TRUE(pArchiverFactory->GetArchiveBlobStatistics(pSource, Stats));
+    EXPECT_EQ(Stats.NumBlobs, TableHeader.Count);
+    EXPECT_EQ(Stats.DataSize, BlobDataSize);
+    // The archiver only writes referenced blobs
+    EXPECT_EQ(Stats.NumReferencedBlobs, Stats.NumBlobs);
+    EXPECT_EQ(Stats.ReferencedDataSize, Stats.DataSize);
+    // Identical device-specific data of all pipelines must be stored once
+    EXPECT_GE(Stats.NumReferences, Stats.NumReferencedBlobs + NumPipelines - 1);
+    EXPECT_GT(Stats.ReferencesSize, Stats.ReferencedDataSize);
+
+    // Repacking must preserve the blob table
+    {
+        auto pRepackedBlob = DataBlobImpl::Create();
+        auto pStream       = MemoryFileStream::Create(pRepackedBlob);
+        ASSERT_TRUE(pArchiverFactory->RemoveDeviceData(pSource, ARCHIVE_DEVICE_DATA_FLAG_NONE, pStream));
+
+        RefCntAutoPtr<IArchive> pRepacked{MakeNewRCObj<ArchiveMemoryImpl>{}(pRepackedBlob)};
+
+        ArchiveBlobStatistics RepackedStats;
+        ASSERT_TRUE(pArchiverFactory->GetArchiveBlobStatistics(pRepacked, RepackedStats));
+        EXPECT_EQ(RepackedStats.NumBlobs, Stats.NumBlobs);
+        EXPECT_EQ(RepackedStats.NumReferences, Stats.NumReferences);
+        EXPECT_EQ(RepackedStats.DataSize, Stats.DataSize);
+    }
+}
+
+TEST(ArchiveTest, IncrementalRebuild)
+{
+    auto* pEnv             = TestingEnvironment::GetInstance();
+    auto* pDevice          = pEnv->GetDevice();
+    auto* pArchiverFactory = pEnv->GetArchiverFactory();
+    auto* pDearchiver      = pDevice->GetEngineFactory()->GetDearchiver();
+
+    if (!pDearchiver || !pArchiverFactory)
+        GTEST_SKIP() << "Archiver library is not loaded";
+
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+        GTEST_SKIP() << "Compute shaders are not supported by device";
+
+    TestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr Uint32 NumPipelines = 16;
+
+    constexpr char CSSource[] = R"(
+RWTexture2D<float4> g_tex2DUAV;
+
+[numthreads(16, 16, 1)]
+void main(uint3 DTid : SV_DispatchThreadID)
+{
+    float4 Color = float4(0.0, 0.0, 0.0, 1.0);
+    for (int i = 0; i < VALUE; ++i)
+        Color.g += sin(float(DTid.x + i)) * cos(float(DTid.y + i));
+    g_tex2DUAV[DTid.xy] = Color;
+}
+)";
+
+    const auto GetPSOName = [](Uint32 Idx) //
+    {
+        return std::string{"ArchiveTest.IncrementalRebuild - PSO "} + std::to_string(Idx);
+    };
+
+    RefCntAutoPtr<ISerializationDevice> pSerializationDevice;
+    pArchiverFactory->CreateSerializationDevice(SerializationDeviceCreateInfo{}, &pSerializationDevice);
+    ASSERT_NE(pSerializationDevice, nullptr);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    {
+        constexpr PipelineResourceDesc Resources[] = {{SHADER_TYPE_COMPUTE, "g_tex2DUAV", 1, SHADER_RESOURCE_TYPE_TEXTURE_UAV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC}};
+
+        PipelineResourceSignatureDesc PRSDesc;
+        PRSDesc.Name         = "ArchiveTest.IncrementalRebuild - PRS";
+        PRSDesc.Resources    = Resources;
+        PRSDesc.NumResources = _countof(Resources);
+
+        pSerializationDevice->CreatePipelineResourceSignature(PRSDesc, GetDeviceBits(), &pPRS);
+        ASSERT_NE(pPRS, nullptr);
+    }
+
+    // Builds the archive; the pipeline with index ChangedIdx uses a different shader
+    const auto BuildArchive = [&](IDataBlob* pPrevArchive, Uint32 ChangedIdx) //
+    {
+        RefCntAutoPtr<IArchiver> pArchiver;
+        pArchiverFactory->CreateArchiver(pSerializationDevice, &pArchiver);
+        EXPECT_NE(pArchiver, nullptr);
+        if (!pArchiver)
+            return RefCntAutoPtr<IDataBlob>{};
+
+        if (pPrevArchive != nullptr)
+        {
+            RefCntAutoPtr<IArchive> pSource{MakeNewRCObj<ArchiveMemoryImpl>{}(pPrevArchive)};
+            EXPECT_TRUE(pArchiver->SetPreviousArchive(pSource));
+        }
+
+        for (Uint32 i = 0; i < NumPipelines; ++i)
+        {
+            const auto Value = std::to_string(i == ChangedIdx ? NumPipelines + 1 : i + 1);
+
+            ShaderMacroHelper Macros;
+            Macros.AddShaderMacro("VALUE", Value.c_str());
+
+            ShaderCreateInfo ShaderCI;
+            ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+            ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+            ShaderCI.UseCombinedTextureSamplers = true;
+            ShaderCI.Desc.ShaderType            = SHADER_TYPE_COMPUTE;
+            ShaderCI.Desc.Name                  = "Incremental rebuild test CS";
+            ShaderCI.EntryPoint                 = "main";
+            ShaderCI.Source                     = CSSource;
+            ShaderCI.Macros                     = Macros;
+
+            RefCntAutoPtr<IShader> pCS;
+            pSerializationDevice->CreateShader(ShaderCI, GetDeviceBits(), &pCS);
+            EXPECT_NE(pCS, nullptr);
+            if (!pCS)
+                return RefCntAutoPtr<IDataBlob>{};
+
+            const auto PSOName = GetPSOName(i);
+
+            ComputePipelineStateCreateInfo PSOCreateInfo;
+            PSOCreateInfo.PSODesc.Name         = PSOName.c_str();
+            PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+            PSOCreateInfo.pCS                  = pCS;
+
+            IPipelineResourceSignature* Signatures[] = {pPRS};
+            PSOCreateInfo.ResourceSignaturesCount    = _countof(Signatures);
+            PSOCreateInfo.ppResourceSignatures       = Signatures;
+
+            PipelineStateArchiveInfo ArchiveInfo;
+            ArchiveInfo.DeviceFlags = GetDeviceBits();
+            EXPECT_TRUE(pArchiver->AddComputePipelineState(PSOCreateInfo, ArchiveInfo));
+        }
+
+        RefCntAutoPtr<IDataBlob> pBlob;
+        pArchiver->SerializeToBlob(&pBlob);
+        EXPECT_NE(pBlob, nullptr);
+        return pBlob;
+    };
+
+    const auto IsEqual = [](IDataBlob* pLhs, IDataBlob* pRhs) //
+    {
+        return pLhs->GetSize() == pRhs->GetSize() && memcmp(pLhs->GetConstDataPtr(), pRhs->GetConstDataPtr(), pLhs->GetSize()) == 0;
+    };
+
+    constexpr Uint32 NoChanges  = ~0u;
+    constexpr Uint32 ChangedIdx = NumPipelines / 2;
+
+    auto pFullArchive = BuildArchive(nullptr, NoChanges);
+    ASSERT_NE(pFullArchive, nullptr);
+
+    // Rebuilding the same content must produce the same archive
+    auto pRebuiltArchive = BuildArchive(pFullArchive, NoChanges);
+    ASSERT_NE(pRebuiltArchive, nullptr);
+    EXPECT_TRUE(IsEqual(pFullArchive, pRebuiltArchive));
+
+    // Changed pipelines must be patched again
+    auto pChangedArchive = BuildArchive(pFullArchive, ChangedIdx);
+    ASSERT_NE(pChangedArchive, nullptr);
+    auto pChangedFullArchive = BuildArchive(nullptr, ChangedIdx);
+    ASSERT_NE(pChangedFullArchive, nullptr);
+    EXPECT_TRUE(IsEqual(pChangedArchive, pChangedFullArchive));
+    EXPECT_FALSE(IsEqual(pChangedArchive, pFullArchive));
+
+    RefCntAutoPtr<IArchive>             pSource{MakeNewRCObj<ArchiveMemoryImpl>{}(pChangedArchive)};
+    RefCntAutoPtr<IDeviceObjectArchive> pArchive;
+    pDearchiver->CreateDeviceObjectArchive(pSource, &pArchive);
+    ASSERT_NE(pArchive, nullptr);
+
+    for (Uint32 i = 0; i < NumPipelines; ++i)
+    {
+        const auto PSOName = GetPSOName(i);
+
+        PipelineStateUnpackInfo UnpackInfo;
+        UnpackInfo.Name         = PSOName.c_str();
+        UnpackInfo.pArchive     = pArchive;
+        UnpackInfo.pDevice      = pDevice;
+        UnpackInfo.PipelineType = PIPELINE_TYPE_COMPUTE;
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        pDearchiver->UnpackPipelineState(UnpackInfo, &pPSO);
+        EXPECT_NE(pPSO, nullptr) << PSOName;
+    }
+}
+
+TEST(ArchiveTest, IncrementalRebuildDefaultSignature)
+{
+    auto* pEnv             = TestingEnvironment::GetInstance();
+    auto* pDevice          = pEnv->GetDevice();
+    auto* pArchiverFactory = pEnv->GetArchiverFactory();
+    auto* pDearchiver      = pDevice->GetEngineFactory()->GetDearchiver();
+
+    if (!pDearchiver || !pArchiverFactory)
+        GTEST_SKIP() << "Archiver library is not loaded";
+
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+        GTEST_SKIP() << "Compute shaders are not supported by device";
+
+    TestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr Uint32 NumPipelines = 8;
+
+    constexpr char CSSource[] = R"(
+RWTexture2D<float4> g_tex2DUAV;
+
+[numthreads(16, 16, 1)]
+void main(uint3 DTid : SV_DispatchThreadID)
+{
+    g_tex2DUAV[DTid.xy] = float4(VALUE, 0.0, 0.0, 1.0);
+}
+)";
+
+    const auto GetPSOName = [](Uint32 Idx) //
+    {
+        return std::string{"ArchiveTest.IncrementalRebuildDefaultSignature - PSO "} + std::to_string(Idx);
+    };
+
+    RefCntAutoPtr<ISerializationDevice> pSerializationDevice;
+    pArchiverFactory->CreateSerializationDevice(SerializationDeviceCreateInfo{}, &pSerializationDevice);
+    ASSERT_NE(pSerializationDevice, nullptr);
+
+    // Builds the archive of the pipelines with default signatures.
+    // The pipeline with index ChangedIdx uses a different resource layout.
+    const auto BuildArchive = [&](IDataBlob* pPrevArchive, Uint32 ChangedIdx) //
+    {
+        RefCntAutoPtr<IArchiver> pArchiver;
+        pArchiverFactory->CreateArchiver(pSerializationDevice, &pArchiver);
+        EXPECT_NE(pArchiver, nullptr);
+        if (!pArchiver)
+            return RefCntAutoPtr<IDataBlob>{};
+
+        if (pPrevArchive != nullptr)
+        {
+            RefCntAutoPtr<IArchive> pSource{MakeNewRCObj<ArchiveMemoryImpl>{}(pPrevArchive)};
+            EXPECT_TRUE(pArchiver->SetPreviousArchive(pSource));
+        }
+
+        for (Uint32 i = 0; i < NumPipelines; ++i)
+        {
+            const auto Value = std::to_string(i + 1);
+
+            ShaderMacroHelper Macros;
+            Macros.AddShaderMacro("VALUE", Value.c_str());
+
+            ShaderCreateInfo ShaderCI;
+            ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+            ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+            ShaderCI.UseCombinedTextureSamplers = true;
+            ShaderCI.Desc.ShaderType            = SHADER_TYPE_COMPUTE;
+            ShaderCI.Desc.Name                  = "Incremental rebuild default signature test CS";
+            ShaderCI.EntryPoint                 = "main";
+            ShaderCI.Source                     = CSSource;
+            ShaderCI.Macros                     = Macros;
+
+            RefCntAutoPtr<IShader> pCS;
+            pSerializationDevice->CreateShader(ShaderCI, GetDeviceBits(), &pCS);
+            EXPECT_NE(pCS, nullptr);
+            if (!pCS)
+                return RefCntAutoPtr<IDataBlob>{};
+
+            const auto PSOName = GetPSOName(i);
+
+            const ShaderResourceVariableDesc Variables[] = {
+                {SHADER_TYPE_COMPUTE, "g_tex2DUAV", i == ChangedIdx ? SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC : SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            };
+
+            ComputePipelineStateCreateInfo PSOCreateInfo;
+            PSOCreateInfo.PSODesc.Name                        = PSOName.c_str();
+            PSOCreateInfo.PSODesc.PipelineType                = PIPELINE_TYPE_COMPUTE;
+            PSOCreateInfo.PSODesc.ResourceLayout.Variables    = Variables;
+            PSOCreateInfo.PSODesc.ResourceLayout.NumVariables = _countof(Variables);
+            PSOCreateInfo.pCS                                 = pCS;
+
+            PipelineStateArchiveInfo ArchiveInfo;
+            ArchiveInfo.DeviceFlags = GetDeviceBits();
+            EXPECT_TRUE(pArchiver->AddComputePipelineState(PSOCreateInfo, ArchiveInfo));
+        }
+
+        RefCntAutoPtr<IDataBlob> pBlob;
+        pArchiver->SerializeToBlob(&pBlob);
+        EXPECT_NE(pBlob, nullptr);
+        return pBlob;
+    };
+
+    const auto IsEqual = [](IDataBlob* pLhs, IDataBlob* pRhs) //
+    {
+        return pLhs->GetSize() == pRhs->GetSize() && memcmp(pLhs->GetConstDataPtr(), pRhs->GetConstDataPtr(), pLhs->GetSize()) == 0;
+    };
+
+    constexpr Uint32 NoChanges  = ~0u;
+    constexpr Uint32 ChangedIdx = NumPipelines / 2;
+
+    auto pFullArchive = BuildArchive(nullptr, NoChanges);
+    ASSERT_NE(pFullArchive, nullptr);
+
+    // Pipelines and their default signatures are copied from the previous archive
+    auto pRebuiltArchive = BuildArchive(pFullArchive, NoChanges);
+    ASSERT_NE(pRebuiltArchive, nullptr);
+    EXPECT_TRUE(IsEqual(pFullArchive, pRebuiltArchive));
+
+    // The pipeline whose resource layout has changed must be patched again with a new default signature
+    auto pChangedArchive = BuildArchive(pFullArchive, ChangedIdx);
+    ASSERT_NE(pChangedArchive, nullptr);
+    auto pChangedFullArchive = BuildArchive(nullptr, ChangedIdx);
+    ASSERT_NE(pChangedFullArchive, nullptr);
+    EXPECT_TRUE(IsEqual(pChangedArchive, pChangedFullArchive));
+    EXPECT_FALSE(IsEqual(pChangedArchive, pFullArchive));
+
+    RefCntAutoPtr<IArchive>             pSource{MakeNewRCObj<ArchiveMemoryImpl>{}(pChangedArchive)};
+    RefCntAutoPtr<IDeviceObjectArchive> pArchive;
+    pDearchiver->CreateDeviceObjectArchive(pSource, &pArchive);
+    ASSERT_NE(pArchive, nullptr);
+
+    for (Uint32 i = 0; i < NumPipelines; ++i)
+    {
+        const auto PSOName = GetPSOName(i);
+
+        PipelineStateUnpackInfo UnpackInfo;
+        UnpackInfo.Name         = PSOName.c_str();
+        UnpackInfo.pArchive     = pArchive;
+        UnpackInfo.pDevice      = pDevice;
+        UnpackInfo.PipelineType = PIPELINE_TYPE_COMPUTE;
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        pDearchiver->UnpackPipelineState(UnpackInfo, &pPSO);
+        ASSERT_NE(pPSO, nullptr) << PSOName;
+
+        const auto ExpectedType = i == ChangedIdx ? SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC : SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+        EXPECT_EQ(pPSO->GetResourceSignatureCount(), 1u) << PSOName;
+        if (auto* pSign = pPSO->GetResourceSignature(0))
+        {
+            const auto& SignDesc = pSign->GetDesc();
+            for (Uint32 r = 0; r < SignDesc.NumResources; ++r)
+            {
+                if (strcmp(SignDesc.Resources[r].Name, "g_tex2DUAV") == 0)
+                    EXPECT_EQ(SignDesc.Resources[r].VarType, ExpectedType) << PSOName;
+            }
+        }
+    }
+}
+
+// Shader source factory that provides a single include file
+class IncludeSourceFactory final : public ObjectBase<IShaderSourceInputStreamFactory>
+{
+public:
+    IncludeSourceFactory(IReferenceCounters* pRefCounters, const char* FileName, const char* Source) :
+        ObjectBase<IShaderSourceInputStreamFactory>{pRefCounters},
+        m_FileName{FileName},
+        m_Source{Source}
+    {}
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_IShaderSourceInputStreamFactory, ObjectBase<IShaderSourceInputStreamFactory>);
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream(const Char* Name, IFileStream** ppStream) override final
+    {
+        CreateInputStream2(Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, ppStream);
+    }
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream2(const Char* Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags, IFileStream** ppStream) override final
+    {
+        *ppStream = nullptr;
+        if (m_FileName != Name)
+            return;
+
+        auto pData   = DataBlobImpl::Create(m_Source.size(), m_Source.data());
+        auto pStream = MemoryFileStream::Create(pData);
+        pStream->QueryInterface(IID_FileStream, reinterpret_cast<IObject**>(ppStream));
+    }
+
+private:
+    const std::string m_FileName;
+    const std::string m_Source;
+};
+
+TEST(ArchiveTest, IncrementalRebuildIncludes)
+{
+    auto* pEnv             = TestingEnvironment::GetInstance();
+    auto* pDevice          = pEnv->GetDevice();
+    auto* pArchiverFactory = pEnv->GetArchiverFactory();
+
+    if (!pArchiverFactory)
+        GTEST_SKIP() << "Archiver library is not loaded";
+
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+        GTEST_SKIP() << "Compute shaders are not supported by device";
+
+    TestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr char CSSource[] = R"(
+#include "IncrementalRebuildColor.fxh"
+
+RWTexture2D<float4> g_tex2DUAV;
+
+[numthreads(16, 16, 1)]
+void main(uint3 DTid : SV_DispatchThreadID)
+{
+    g_tex2DUAV[DTid.xy] = COLOR;
+}
+)";
+
+    RefCntAutoPtr<ISerializationDevice> pSerializationDevice;
+    pArchiverFactory->CreateSerializationDevice(SerializationDeviceCreateInfo{}, &pSerializationDevice);
+    ASSERT_NE(pSerializationDevice, nullptr);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    {
+        constexpr PipelineResourceDesc Resources[] = {{SHADER_TYPE_COMPUTE, "g_tex2DUAV", 1, SHADER_RESOURCE_TYPE_TEXTURE_UAV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC}};
+
+        PipelineResourceSignatureDesc PRSDesc;
+        PRSDesc.Name         = "ArchiveTest.IncrementalRebuildIncludes - PRS";
+        PRSDesc.Resources    = Resources;
+        PRSDesc.NumResources = _countof(Resources);
+
+        pSerializationDevice->CreatePipelineResourceSignature(PRSDesc, GetDeviceBits(), &pPRS);
+        ASSERT_NE(pPRS, nullptr);
+    }
+
+    // The main shader source is the same in all builds, only the included file changes
+    const auto BuildArchive = [&](IDataBlob* pPrevArchive, const char* IncludeSource) //
+    {
+        RefCntAutoPtr<IArchiver> pArchiver;
+        pArchiverFactory->CreateArchiver(pSerializationDevice, &pArchiver);
+        EXPECT_NE(pArchiver, nullptr);
+        if (!pArchiver)
+            return RefCntAutoPtr<IDataBlob>{};
+
+        if (pPrevArchive != nullptr)
+        {
+            RefCntAutoPtr<IArchive> pSource{MakeNewRCObj<ArchiveMemoryImpl>{}(pPrevArchive)};
+            EXPECT_TRUE(pArchiver->SetPreviousArchive(pSource));
+        }
+
+        RefCntAutoPtr<IShaderSourceInputStreamFactory> pSourceFactory{MakeNewRCObj<IncludeSourceFactory>()("IncrementalRebuildColor.fxh", IncludeSource)};
+
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+        ShaderCI.UseCombinedTextureSamplers = true;
+        ShaderCI.Desc.ShaderType            = SHADER_TYPE_COMPUTE;
+        ShaderCI.Desc.Name                  = "Incremental rebuild includes test CS";
+        ShaderCI.EntryPoint                 = "main";
+        ShaderCI.Source                     = CSSource;
+        ShaderCI.pShaderSourceStreamFactory = pSourceFactory;
+
+        RefCntAutoPtr<IShader> pCS;
+        pSerializationDevice->CreateShader(ShaderCI, GetDeviceBits(), &pCS);
+        EXPECT_NE(pCS, nullptr);
+        if (!pCS)
+            return RefCntAutoPtr<IDataBlob>{};
+
+        ComputePipelineStateCreateInfo PSOCreateInfo;
+        PSOCreateInfo.PSODesc.Name         = "ArchiveTest.IncrementalRebuildIncludes - PSO";
+        PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+        PSOCreateInfo.pCS                  = pCS;
+
+        IPipelineResourceSignature* Signatures[] = {pPRS};
+        PSOCreateInfo.ResourceSignaturesCount    = _countof(Signatures);
+        PSOCreateInfo.ppResourceSignatures       = Signatures;
+
+        PipelineStateArchiveInfo ArchiveInfo;
+        ArchiveInfo.DeviceFlags = GetDeviceBits();
+        EXPECT_TRUE(pArchiver->AddComputePipelineState(PSOCreateInfo, ArchiveInfo));
+
+        RefCntAutoPtr<IDataBlob> pBlob;
+        pArchiver->SerializeToBlob(&pBlob);
+        EXPECT_NE(pBlob, nullptr);
+        return pBlob;
+    };
+
+    const auto IsEqual = [](IDataBlob* pLhs, IDataBlob* pRhs) //
+    {
+        return pLhs->GetSize() == pRhs->GetSize() && memcmp(pLhs->GetConstDataPtr(), pRhs->GetConstDataPtr(), pLhs->GetSize()) == 0;
+    };
+
+    constexpr char RedColor[]   = "#define COLOR float4(1.0, 0.0, 0.0, 1.0)\n";
+    constexpr char GreenColor[] = "#define COLOR float4(0.0, 1.0, 0.0, 1.0)\n";
+
+    auto pRedArchive = BuildArchive(nullptr, RedColor);
+    ASSERT_NE(pRedArchive, nullptr);
+
+    auto pGreenArchive = BuildArchive(nullptr, GreenColor);
+    ASSERT_NE(pGreenArchive, nullptr);
+    EXPECT_FALSE(IsEqual(pRedArchive, pGreenArchive));
+
+    // The pipeline must not be reused when only the included file has changed
+    auto pRebuiltArchive = BuildArchive(pRedArchive, GreenColor);
+    ASSERT_NE(pRebuiltArchive, nullptr);
+    EXPECT_TRUE(IsEqual(pRebuiltArchive, pGreenArchive));
+}
+
 } // namespace
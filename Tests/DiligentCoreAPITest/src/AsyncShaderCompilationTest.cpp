@@ -0,0 +1,314 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+
+#include "TestingEnvironment.hpp"
+#include "DataBlobImpl.hpp"
+#include "MemoryFileStream.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+static const char g_ShaderSource[] = R"(
+void VSMain(out float4 pos : SV_POSITION)
+{
+    pos = float4(0.0, 0.0, 0.0, 0.0);
+}
+
+void PSMain(out float4 col : SV_TARGET)
+{
+    col = float4(0.0, 0.0, 0.0, 0.0);
+}
+)";
+
+static const char g_BrokenShaderSource[] = R"(
+void VSMain(out float4 pos : SV_POSITION)
+{
+    pos = float4(0.0, 0.0, 0.0, 0.0)
+}
+)";
+
+// Shader source factory that blocks the compilation of the shader until the gate is opened.
+// This keeps the shader in the compiling state for as long as the test needs.
+class GatedSourceFactory final : public ObjectBase<IShaderSourceInputStreamFactory>
+{
+public:
+    GatedSourceFactory(IReferenceCounters* pRefCounters, const char* FileName, const char* Source) :
+        ObjectBase<IShaderSourceInputStreamFactory>{pRefCounters},
+        m_FileName{FileName},
+        m_Source{Source}
+    {}
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_IShaderSourceInputStreamFactory, ObjectBase<IShaderSourceInputStreamFactory>);
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream(const Char* Name, IFileStream** ppStream) override final
+    {
+        CreateInputStream2(Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, ppStream);
+    }
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream2(const Char* Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags, IFileStream** ppStream) override final
+    {
+        *ppStream = nullptr;
+        if (m_FileName != Name)
+            return;
+
+        {
+            std::unique_lock<std::mutex> Lock{m_Mtx};
+            m_GateCV.wait(Lock, [this] { return m_IsOpen; });
+        }
+
+        auto pData   = DataBlobImpl::Create(m_Source.size(), m_Source.data());
+        auto pStream = MemoryFileStream::Create(pData);
+        pStream->QueryInterface(IID_FileStream, reinterpret_cast<IObject**>(ppStream));
+    }
+
+    void Open()
+    {
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
+            m_IsOpen = true;
+        }
+        m_GateCV.notify_all();
+    }
+
+private:
+    const std::string m_FileName;
+    const std::string m_Source;
+
+    std::mutex              m_Mtx;
+    std::condition_variable m_GateCV;
+    bool                    m_IsOpen = false;
+};
+
+RefCntAutoPtr<IShader> CreateAsyncShader(const char*                      Source,
+                                         SHADER_TYPE                      ShaderType,
+                                         const char*                      EntryPoint,
+                                         const char*                      Name,
+                                         IShaderSourceInputStreamFactory* pSourceFactory = nullptr,
+                                         const char*                      FilePath       = nullptr)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.Source                     = Source;
+    ShaderCI.FilePath                   = FilePath;
+    ShaderCI.pShaderSourceStreamFactory = pSourceFactory;
+    ShaderCI.EntryPoint      = EntryPoint;
+    ShaderCI.Desc.ShaderType = ShaderType;
+    ShaderCI.Desc.Name       = Name;
+    ShaderCI.SourceLanguage  = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler  = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.CompileFlags    = SHADER_COMPILE_FLAG_ASYNCHRONOUS;
+
+    RefCntAutoPtr<IShader> pShader;
+    pDevice->CreateShader(ShaderCI, &pShader);
+    return pShader;
+}
+
+RefCntAutoPtr<IPipelineState> CreateAsyncPipeline(IShader* pVS, IShader* pPS)
+{
+    auto* pEnv       = TestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+
+    PSOCreateInfo.PSODesc.Name = "Async compilation test";
+    PSOCreateInfo.Flags        = PSO_CREATE_FLAG_ASYNCHRONOUS;
+
+    auto& GraphicsPipeline             = PSOCreateInfo.GraphicsPipeline;
+    GraphicsPipeline.NumRenderTargets  = 1;
+    GraphicsPipeline.RTVFormats[0]     = pSwapChain->GetDesc().ColorBufferFormat;
+    GraphicsPipeline.PrimitiveTopology = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+    GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    PSOCreateInfo.pVS = pVS;
+    PSOCreateInfo.pPS = pPS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+    return pPSO;
+}
+
+TEST(AsyncShaderCompilationTest, GraphicsPipeline)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    auto* pCtx    = pEnv->GetDeviceContext();
+    if (!pDevice->GetDeviceInfo().Features.AsyncShaderCompilation)
+    {
+        GTEST_SKIP() << "Asynchronous shader compilation is not supported by this device";
+    }
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto pVS = CreateAsyncShader(g_ShaderSource, SHADER_TYPE_VERTEX, "VSMain", "Async compilation test VS");
+    ASSERT_NE(pVS, nullptr);
+    auto pPS = CreateAsyncShader(g_ShaderSource, SHADER_TYPE_PIXEL, "PSMain", "Async compilation test PS");
+    ASSERT_NE(pPS, nullptr);
+
+    // The pipeline can be created before the shaders are compiled
+    auto pPSO = CreateAsyncPipeline(pVS, pPS);
+    ASSERT_NE(pPSO, nullptr);
+
+    EXPECT_EQ(pPSO->GetStatus(/*WaitForCompletion = */ true), PIPELINE_STATE_STATUS_READY);
+    EXPECT_EQ(pVS->GetStatus(), SHADER_STATUS_READY);
+    EXPECT_EQ(pPS->GetStatus(), SHADER_STATUS_READY);
+
+    DeviceContextStats Stats;
+    pCtx->GetStats(Stats);
+    const auto PipelineStateChangeCount = Stats.PipelineStateChangeCount;
+
+    pCtx->SetPipelineState(pPSO);
+    pCtx->GetStats(Stats);
+    EXPECT_EQ(Stats.PipelineStateChangeCount, PipelineStateChangeCount + 1);
+}
+
+TEST(AsyncShaderCompilationTest, CompilingStatus)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    auto* pCtx    = pEnv->GetDeviceContext();
+    if (!pDevice->GetDeviceInfo().Features.AsyncShaderCompilation)
+    {
+        GTEST_SKIP() << "Asynchronous shader compilation is not supported by this device";
+    }
+    if (pDevice->GetDeviceInfo().Type == RENDER_DEVICE_TYPE_NULL)
+    {
+        GTEST_SKIP() << "Null device does not compile shaders";
+    }
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<GatedSourceFactory> pGate{MakeNewRCObj<GatedSourceFactory>()("AsyncCompilationGate.hlsl", g_ShaderSource)};
+
+    RefCntAutoPtr<IShader>        pVS;
+    RefCntAutoPtr<IShader>        pPS;
+    RefCntAutoPtr<IPipelineState> pPSO;
+
+    // Objects wait for their compilation tasks when they are released, so the gate
+    // must be opened before that, even if the test fails.
+    struct GateOpener
+    {
+        GatedSourceFactory* pGate;
+        ~GateOpener() { pGate->Open(); }
+    } AutoOpenGate{pGate};
+
+    pVS = CreateAsyncShader(nullptr, SHADER_TYPE_VERTEX, "VSMain", "Async compilation test gated VS", pGate, "AsyncCompilationGate.hlsl");
+    ASSERT_NE(pVS, nullptr);
+    pPS = CreateAsyncShader(g_ShaderSource, SHADER_TYPE_PIXEL, "PSMain", "Async compilation test PS");
+    ASSERT_NE(pPS, nullptr);
+
+    // The vertex shader can't finish compiling until the gate is opened
+    EXPECT_EQ(pVS->GetStatus(), SHADER_STATUS_COMPILING);
+
+    pPSO = CreateAsyncPipeline(pVS, pPS);
+    ASSERT_NE(pPSO, nullptr);
+    // The pipeline waits for the vertex shader
+    EXPECT_EQ(pPSO->GetStatus(), PIPELINE_STATE_STATUS_COMPILING);
+
+    pGate->Open();
+
+    // Binding the pipeline waits until it is ready
+    DeviceContextStats Stats;
+    pCtx->GetStats(Stats);
+    const auto PipelineStateChangeCount = Stats.PipelineStateChangeCount;
+
+    pCtx->SetPipelineState(pPSO);
+    EXPECT_EQ(pPSO->GetStatus(), PIPELINE_STATE_STATUS_READY);
+    EXPECT_EQ(pVS->GetStatus(), SHADER_STATUS_READY);
+
+    pCtx->GetStats(Stats);
+    EXPECT_EQ(Stats.PipelineStateChangeCount, PipelineStateChangeCount + 1);
+}
+
+TEST(AsyncShaderCompilationTest, ReleaseBeforeCompletion)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().Features.AsyncShaderCompilation)
+    {
+        GTEST_SKIP() << "Asynchronous shader compilation is not supported by this device";
+    }
+
+    // Objects must cancel or wait for their compilation tasks when released
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        auto pVS = CreateAsyncShader(g_ShaderSource, SHADER_TYPE_VERTEX, "VSMain", "Async compilation test VS");
+        ASSERT_NE(pVS, nullptr);
+        auto pPS = CreateAsyncShader(g_ShaderSource, SHADER_TYPE_PIXEL, "PSMain", "Async compilation test PS");
+        ASSERT_NE(pPS, nullptr);
+        auto pPSO = CreateAsyncPipeline(pVS, pPS);
+        ASSERT_NE(pPSO, nullptr);
+    }
+}
+
+TEST(AsyncShaderCompilationTest, BrokenShader)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    auto* pCtx    = pEnv->GetDeviceContext();
+    if (!pDevice->GetDeviceInfo().Features.AsyncShaderCompilation)
+    {
+        GTEST_SKIP() << "Asynchronous shader compilation is not supported by this device";
+    }
+    if (pDevice->GetDeviceInfo().Type == RENDER_DEVICE_TYPE_NULL)
+    {
+        GTEST_SKIP() << "Null device does not compile shaders";
+    }
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    // Compilation error, shader failure, pipeline failure and SetPipelineState error
+    pEnv->SetErrorAllowance(4, "\n\nNo worries, testing broken shader...\n\n");
+
+    auto pVS = CreateAsyncShader(g_BrokenShaderSource, SHADER_TYPE_VERTEX, "VSMain", "Async compilation test broken VS");
+    ASSERT_NE(pVS, nullptr);
+    auto pPS = CreateAsyncShader(g_ShaderSource, SHADER_TYPE_PIXEL, "PSMain", "Async compilation test PS");
+    ASSERT_NE(pPS, nullptr);
+
+    auto pPSO = CreateAsyncPipeline(pVS, pPS);
+    ASSERT_NE(pPSO, nullptr);
+
+    EXPECT_EQ(pPSO->GetStatus(/*WaitForCompletion = */ true), PIPELINE_STATE_STATUS_FAILED);
+    EXPECT_EQ(pVS->GetStatus(), SHADER_STATUS_FAILED);
+    EXPECT_EQ(pPS->GetStatus(/*WaitForCompletion = */ true), SHADER_STATUS_READY);
+
+    // Pipeline that failed to compile must be rejected by the context
+    pCtx->SetPipelineState(pPSO);
+}
+
+} // namespace
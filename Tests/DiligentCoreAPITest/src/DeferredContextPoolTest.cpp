@@ -0,0 +1,123 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "DeferredContextPool.hpp"
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(DeferredContextPoolTest, RecordAndSubmit)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+    if (pEnv->GetNumDeferredContexts() == 0)
+    {
+        GTEST_SKIP() << "Deferred contexts are not supported by this device";
+    }
+    if (pEnv->GetDevice()->GetDeviceInfo().IsMetalDevice())
+    {
+        GTEST_SKIP() << "Deferred context pool is not supported in Metal backend";
+    }
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    const auto NumContexts = static_cast<Uint32>(pEnv->GetNumDeferredContexts());
+
+    std::vector<IDeviceContext*> DeferredContexts(NumContexts);
+    for (Uint32 i = 0; i < NumContexts; ++i)
+        DeferredContexts[i] = pEnv->GetDeferredContext(i);
+
+    DeferredContextPoolCreateInfo PoolCI;
+    PoolCI.pImmediateContext   = pEnv->GetDeviceContext();
+    PoolCI.ppDeferredContexts  = DeferredContexts.data();
+    PoolCI.NumDeferredContexts = NumContexts;
+    DeferredContextPool Pool{PoolCI};
+    EXPECT_EQ(Pool.GetNumContexts(), NumContexts);
+
+    std::vector<Uint32> FrameCounts(NumContexts);
+    for (Uint32 i = 0; i < NumContexts; ++i)
+    {
+        DeviceContextStats Stats;
+        DeferredContexts[i]->GetStats(Stats);
+        FrameCounts[i] = Stats.FrameCount;
+    }
+
+    // Use more jobs than there are contexts so that contexts are recycled
+    const Uint32        NumJobs    = NumContexts * 4;
+    const Uint32        NumThreads = NumContexts + 1;
+    std::atomic<Uint32> NextJob{0};
+
+    std::vector<std::thread> Workers;
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        Workers.emplace_back(
+            [&]() //
+            {
+                for (auto Job = NextJob.fetch_add(1); Job < NumJobs; Job = NextJob.fetch_add(1))
+                {
+                    auto* pCtx = Pool.Begin();
+                    ASSERT_NE(pCtx, nullptr);
+                    EXPECT_TRUE(pCtx->GetDesc().IsDeferred);
+
+                    const float BlendFactors[] = {0, 0, 0, 0};
+                    pCtx->SetBlendFactors(BlendFactors);
+
+                    // Submit the command lists in the reverse order
+                    Pool.Finish(pCtx, NumJobs - Job);
+                }
+            });
+    }
+    for (auto& Worker : Workers)
+        Worker.join();
+
+    EXPECT_EQ(Pool.Submit(), NumJobs);
+
+    // FinishFrame must be called once for every context that recorded commands
+    Uint32 NumUsedContexts = 0;
+    for (Uint32 i = 0; i < NumContexts; ++i)
+    {
+        DeviceContextStats Stats;
+        DeferredContexts[i]->GetStats(Stats);
+        EXPECT_LE(Stats.FrameCount, FrameCounts[i] + 1);
+        if (Stats.FrameCount > FrameCounts[i])
+            ++NumUsedContexts;
+    }
+    EXPECT_GT(NumUsedContexts, 0u);
+
+    // Nothing to submit
+    EXPECT_EQ(Pool.Submit(), 0u);
+}
+
+} // namespace
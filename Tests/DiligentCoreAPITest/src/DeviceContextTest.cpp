@@ -50,4 +50,33 @@ TEST(DeviceContextTest, DebugGroups)
     pCtx->EndDebugGroup();
 }
 
+TEST(DeviceContextTest, Stats)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+    auto* pCtx = pEnv->GetDeviceContext();
+
+    pCtx->Flush();
+    pCtx->ResetStats();
+
+    DeviceContextStats Stats;
+    pCtx->GetStats(Stats);
+    EXPECT_EQ(Stats.DrawCount, 0u);
+    EXPECT_EQ(Stats.DispatchCount, 0u);
+    EXPECT_EQ(Stats.BarrierCount, 0u);
+    EXPECT_EQ(Stats.FlushCount, 0u);
+    EXPECT_EQ(Stats.FrameCount, 0u);
+    EXPECT_EQ(Stats.DynamicHeapBytes, 0u);
+    EXPECT_EQ(Stats.UploadHeapBytes, 0u);
+
+    pCtx->FinishFrame();
+    pCtx->FinishFrame();
+
+    pCtx->GetStats(Stats);
+    EXPECT_EQ(Stats.FrameCount, 2u);
+
+    pCtx->ResetStats();
+    pCtx->GetStats(Stats);
+    EXPECT_EQ(Stats.FrameCount, 0u);
+}
+
 } // namespace
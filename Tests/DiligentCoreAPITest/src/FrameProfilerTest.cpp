@@ -0,0 +1,120 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FrameProfiler.hpp"
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(FrameProfilerTest, NestedScopes)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    const bool TimestampsSupported = pDevice->GetDeviceInfo().Features.TimestampQueries != DEVICE_FEATURE_STATE_DISABLED;
+
+    FrameProfiler::CreateInfo CI;
+    CI.QueryBatchSize    = 2;
+    CI.MaxResolvedFrames = 4;
+    FrameProfiler Profiler{pDevice, CI};
+
+    constexpr Uint32 NumFrames = 6;
+    for (Uint32 frame = 0; frame < NumFrames; ++frame)
+    {
+        Profiler.BeginFrame(pContext);
+        {
+            FrameProfiler::Scope Outer{Profiler, pContext, "Outer"};
+            {
+                FrameProfiler::Scope Inner{Profiler, pContext, "Inner \"quoted\""};
+            }
+        }
+        Profiler.BeginScope(pContext, "Second");
+        Profiler.EndScope(pContext);
+        Profiler.EndFrame(pContext);
+
+        pContext->Flush();
+    }
+    pContext->WaitForIdle();
+
+    // Resolve all completed frames
+    Profiler.BeginFrame(pContext);
+    Profiler.EndFrame(pContext);
+
+    const auto& Frames = Profiler.GetResolvedFrames();
+    ASSERT_EQ(Frames.size(), CI.MaxResolvedFrames);
+    EXPECT_EQ(Frames.back().FrameNumber, NumFrames - 1);
+
+    for (const auto& Frame : Frames)
+    {
+        ASSERT_EQ(Frame.Scopes.size(), 4u);
+
+        const auto& FrameScope = Frame.Scopes[0];
+        const auto& Outer      = Frame.Scopes[1];
+        const auto& Inner      = Frame.Scopes[2];
+        const auto& Second     = Frame.Scopes[3];
+
+        EXPECT_EQ(FrameScope.Name, "Frame");
+        EXPECT_EQ(Outer.Name, "Outer");
+        EXPECT_EQ(Inner.Name, "Inner \"quoted\"");
+        EXPECT_EQ(Second.Name, "Second");
+
+        EXPECT_EQ(FrameScope.Depth, 0u);
+        EXPECT_EQ(Outer.Depth, 1u);
+        EXPECT_EQ(Inner.Depth, 2u);
+        EXPECT_EQ(Second.Depth, 1u);
+
+        EXPECT_LE(FrameScope.CPUStartTime, Outer.CPUStartTime);
+        EXPECT_LE(Outer.CPUStartTime, Inner.CPUStartTime);
+        EXPECT_LE(Inner.CPUEndTime, Outer.CPUEndTime);
+        EXPECT_LE(Outer.CPUEndTime, Second.CPUStartTime);
+        EXPECT_LE(Second.CPUEndTime, FrameScope.CPUEndTime);
+
+        for (const auto& Scope : Frame.Scopes)
+        {
+            EXPECT_EQ(Scope.GPUTimeValid, TimestampsSupported);
+            if (Scope.GPUTimeValid)
+            {
+                EXPECT_LE(Scope.GPUStartTime, Scope.GPUEndTime);
+                EXPECT_LE(FrameScope.GPUStartTime, Scope.GPUStartTime);
+                EXPECT_LE(Scope.GPUEndTime, FrameScope.GPUEndTime);
+            }
+        }
+    }
+
+    const auto Trace = Profiler.GetChromeTrace();
+    EXPECT_NE(Trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"name\":\"Outer\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"name\":\"Inner \\\"quoted\\\"\""), std::string::npos);
+}
+
+} // namespace
@@ -1927,4 +1927,157 @@ TEST_F(PipelineResourceSignatureTest, UnusedNullResources)
     pSwapChain->Present();
 }
 
+
+TEST_F(PipelineResourceSignatureTest, VariableHandles)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name = "Variable handles test";
+
+    // clang-format off
+    const PipelineResourceDesc Resources[] =
+    {
+        {SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, "g_StaticBuffer",   1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+        {SHADER_TYPE_VERTEX,                     "g_MutableBuffer",  1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        {SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, "g_MutableTexture", 2, SHADER_RESOURCE_TYPE_TEXTURE_SRV,     SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        {SHADER_TYPE_PIXEL,                      "g_DynamicBuffer",  1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+        {SHADER_TYPE_PIXEL,                      "g_DynamicTexture", 1, SHADER_RESOURCE_TYPE_TEXTURE_SRV,     SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC}
+    };
+    // clang-format on
+
+    PRSDesc.Resources    = Resources;
+    PRSDesc.NumResources = _countof(Resources);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    ASSERT_TRUE(pPRS);
+
+    EXPECT_NE(pPRS->GetStaticVariableByName(SHADER_TYPE_VERTEX, "g_StaticBuffer"), nullptr);
+    EXPECT_NE(pPRS->GetStaticVariableByName(SHADER_TYPE_PIXEL, "g_StaticBuffer"), nullptr);
+    EXPECT_EQ(pPRS->GetStaticVariableByName(SHADER_TYPE_PIXEL, "g_MutableTexture"), nullptr);
+
+    EXPECT_FALSE(pPRS->GetVariableHandle(SHADER_TYPE_VERTEX, "g_StaticBuffer").IsValid());
+    EXPECT_FALSE(pPRS->GetVariableHandle(SHADER_TYPE_VERTEX, "g_DynamicBuffer").IsValid());
+    EXPECT_FALSE(pPRS->GetVariableHandle(SHADER_TYPE_PIXEL, "g_UnknownVariable").IsValid());
+    EXPECT_FALSE(pPRS->GetVariableHandle(SHADER_TYPE_GEOMETRY, "g_MutableTexture").IsValid());
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB1, pSRB2;
+    pPRS->CreateShaderResourceBinding(&pSRB1);
+    pPRS->CreateShaderResourceBinding(&pSRB2);
+    ASSERT_TRUE(pSRB1);
+    ASSERT_TRUE(pSRB2);
+
+    EXPECT_EQ(pSRB1->GetVariableByName(SHADER_TYPE_VERTEX, "g_StaticBuffer"), nullptr);
+    EXPECT_EQ(pSRB1->GetVariableByHandle(ShaderVariableHandle{}), nullptr);
+
+    for (const auto& Res : Resources)
+    {
+        if (Res.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
+            continue;
+
+        for (auto Stages = Res.ShaderStages; Stages != SHADER_TYPE_UNKNOWN;)
+        {
+            const auto ShaderType = ExtractLSB(Stages);
+
+            const auto Handle = pPRS->GetVariableHandle(ShaderType, Res.Name);
+            ASSERT_TRUE(Handle.IsValid()) << Res.Name;
+
+            for (auto* pSRB : {pSRB1.RawPtr(), pSRB2.RawPtr()})
+            {
+                auto* pVar = pSRB->GetVariableByName(ShaderType, Res.Name);
+                ASSERT_NE(pVar, nullptr) << Res.Name;
+                EXPECT_EQ(pSRB->GetVariableByHandle(Handle), pVar) << Res.Name;
+            }
+        }
+    }
+}
+
+
+TEST_F(PipelineResourceSignatureTest, SetVariables)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name = "Set variables test";
+
+    // clang-format off
+    const PipelineResourceDesc Resources[] =
+    {
+        {SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, "g_MutableBuffer",  1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        {SHADER_TYPE_PIXEL,                      "g_MutableTexArr",  4, SHADER_RESOURCE_TYPE_TEXTURE_SRV,     SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        {SHADER_TYPE_PIXEL,                      "g_DynamicTexture", 1, SHADER_RESOURCE_TYPE_TEXTURE_SRV,     SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC}
+    };
+    // clang-format on
+
+    PRSDesc.Resources    = Resources;
+    PRSDesc.NumResources = _countof(Resources);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    ASSERT_TRUE(pPRS);
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    {
+        BufferDesc BuffDesc{"Set variables test buffer", 256, BIND_UNIFORM_BUFFER, USAGE_DEFAULT};
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    }
+    ASSERT_TRUE(pBuffer);
+
+    RefCntAutoPtr<ITexture> pTextures[3];
+    IDeviceObject*          pSRVs[_countof(pTextures)] = {};
+    for (Uint32 i = 0; i < _countof(pTextures); ++i)
+    {
+        pTextures[i] = pEnv->CreateTexture("Set variables test texture", TEX_FORMAT_RGBA8_UNORM, BIND_SHADER_RESOURCE, 64, 64);
+        ASSERT_TRUE(pTextures[i]);
+        pSRVs[i] = pTextures[i]->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    }
+
+    IDeviceObject* pBuffObj = pBuffer;
+
+    ShaderVariableBinding Bindings[4];
+    Bindings[0].Handle    = pPRS->GetVariableHandle(SHADER_TYPE_VERTEX, "g_MutableBuffer");
+    Bindings[0].ppObjects = &pBuffObj;
+    Bindings[1].Handle       = pPRS->GetVariableHandle(SHADER_TYPE_PIXEL, "g_MutableTexArr");
+    Bindings[1].ppObjects    = pSRVs;
+    Bindings[1].FirstElement = 1;
+    Bindings[1].NumElements  = 2;
+    Bindings[2].Handle       = pPRS->GetVariableHandle(SHADER_TYPE_PIXEL, "g_MutableTexArr");
+    Bindings[2].ppObjects    = &pSRVs[2];
+    Bindings[2].FirstElement = 3;
+    Bindings[3].Handle    = pPRS->GetVariableHandle(SHADER_TYPE_PIXEL, "g_DynamicTexture");
+    Bindings[3].ppObjects = &pSRVs[0];
+    for (const auto& Binding : Bindings)
+        ASSERT_TRUE(Binding.Handle.IsValid());
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPRS->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_TRUE(pSRB);
+
+    pSRB->SetVariables(Bindings, _countof(Bindings));
+
+    EXPECT_EQ(pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "g_MutableBuffer")->Get(), pBuffObj);
+    EXPECT_EQ(pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_MutableBuffer")->Get(), pBuffObj);
+
+    auto* pTexArr = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_MutableTexArr");
+    ASSERT_NE(pTexArr, nullptr);
+    EXPECT_EQ(pTexArr->Get(0), nullptr);
+    EXPECT_EQ(pTexArr->Get(1), pSRVs[0]);
+    EXPECT_EQ(pTexArr->Get(2), pSRVs[1]);
+    EXPECT_EQ(pTexArr->Get(3), pSRVs[2]);
+
+    EXPECT_EQ(pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_DynamicTexture")->Get(), pSRVs[0]);
+
+    // Dynamic variables can be rebound
+    Bindings[3].ppObjects = &pSRVs[1];
+    pSRB->SetVariables(&Bindings[3], 1);
+    EXPECT_EQ(pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_DynamicTexture")->Get(), pSRVs[1]);
+}
+
 } // namespace Diligent
@@ -0,0 +1,343 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <cstring>
+
+#include "SPIRVShaderResources.hpp"
+#include "GLSLangUtils.hpp"
+#include "DXCompiler.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const char* g_HLSLResources = R"(
+struct BufferData
+{
+    float4 Data;
+    uint   Index;
+};
+
+cbuffer cbConstants
+{
+    float4x4 g_WorldViewProj;
+    float4   g_Color;
+    float3   g_Vec3;
+}
+
+Texture2D                 g_Tex2D;
+Texture2DArray            g_Tex2DArr[2];
+Texture2DMS<float4>       g_Tex2DMS;
+TextureCube               g_TexCube;
+Texture3D                 g_Tex3D;
+SamplerState              g_Sampler;
+SamplerState              g_Samplers[3];
+Buffer<float4>            g_FormattedBuff;
+StructuredBuffer<BufferData>   g_StructBuff;
+RWStructuredBuffer<BufferData> g_RWStructBuff;
+RWByteAddressBuffer       g_RWByteAddrBuff;
+RWBuffer<float4>          g_RWFormattedBuff;
+RWTexture2D<float4>       g_RWTex2D;
+RWTexture1DArray<float4>  g_RWTex1DArr;
+)";
+
+const char* g_HLSL_VS = R"(
+struct VSInput
+{
+    float3 Pos   : ATTRIB0;
+    float4 Color : ATTRIB2;
+    float2 UV    : ATTRIB1;
+};
+
+void main(in VSInput VSIn, out float4 Pos : SV_Position, out float4 Color : COLOR)
+{
+    Pos   = mul(float4(VSIn.Pos, 1.0), g_WorldViewProj) + float4(VSIn.UV, 0.0, 0.0);
+    Color = VSIn.Color * g_Color + g_StructBuff[0].Data + g_Tex2D.SampleLevel(g_Sampler, VSIn.UV, 0.0);
+}
+)";
+
+const char* g_HLSL_PS = R"(
+float4 main(in float4 Pos : SV_Position, in float4 Color : COLOR) : SV_Target
+{
+    float4 f4 = Color * g_Color;
+    f4 += g_Tex2D.Sample(g_Sampler, Pos.xy);
+    f4 += g_Tex2DArr[1].Sample(g_Samplers[2], Pos.xyz);
+    f4 += g_Tex2DMS.Load(int2(Pos.xy), 0);
+    f4 += g_TexCube.Sample(g_Samplers[0], Pos.xyz);
+    f4 += g_Tex3D.Sample(g_Samplers[1], Pos.xyz);
+    f4 += g_FormattedBuff.Load(0);
+    f4 += g_StructBuff[1].Data;
+    f4 += float4(g_Vec3, 0.0);
+    return f4;
+}
+)";
+
+const char* g_HLSL_CS = R"(
+[numthreads(8, 4, 2)]
+void main(uint3 DTid : SV_DispatchThreadID)
+{
+    float4 f4 = g_Color + g_FormattedBuff.Load(DTid.x) + g_StructBuff[DTid.y].Data;
+    g_RWStructBuff[DTid.x].Data = f4;
+    g_RWByteAddrBuff.Store(DTid.x * 4, asuint(f4.x));
+    g_RWFormattedBuff[DTid.x] = f4;
+    g_RWTex2D[DTid.xy]        = f4;
+    g_RWTex1DArr[DTid.xy]     = f4 + g_Tex2D.SampleLevel(g_Sampler, float2(DTid.xy), 0.0);
+}
+)";
+
+const char* g_GLSL_CS = R"(
+#version 450
+layout(local_size_x = 16, local_size_y = 16, local_size_z = 1) in;
+
+layout(std140) uniform UniformBuff
+{
+    mat4  g_Matrix;
+    vec4  g_Vec4;
+    float g_Float[4];
+};
+
+layout(std430) readonly buffer ROStorageBuff
+{
+    vec4 g_Data[];
+};
+
+layout(std430) buffer RWStorageBuff
+{
+    uvec4 g_Header;
+    vec4  g_RWData[];
+} g_RWStorage;
+
+layout(rgba8) uniform image2D      g_Image;
+layout(r32f)  uniform image2DArray g_ImageArr[2];
+layout(rgba32f) uniform imageBuffer g_ImageBuff;
+
+uniform sampler2D       g_CombinedSampler;
+uniform samplerCube     g_CombinedSamplers[4];
+uniform samplerBuffer   g_TexelBuffer;
+uniform sampler2DMSArray g_CombinedSamplerMS;
+
+void main()
+{
+    ivec2 Coord = ivec2(gl_GlobalInvocationID.xy);
+    vec4  f4    = g_Matrix * g_Vec4 + g_Float[2] + g_Data[Coord.x];
+    f4 += textureLod(g_CombinedSampler, vec2(Coord), 0.0);
+    f4 += textureLod(g_CombinedSamplers[3], vec3(Coord, 0.0), 0.0);
+    f4 += texelFetch(g_TexelBuffer, Coord.x);
+    f4 += texelFetch(g_CombinedSamplerMS, ivec3(Coord, 0), 0);
+    f4 += imageLoad(g_ImageArr[1], ivec3(Coord, 0));
+    g_RWStorage.g_RWData[Coord.y] = f4 + vec4(g_RWStorage.g_Header);
+    imageStore(g_Image, Coord, f4);
+    imageStore(g_ImageBuff, Coord.x, f4);
+}
+)";
+
+const char* g_GLSL_PS = R"(
+#version 450
+layout(input_attachment_index = 0) uniform subpassInput g_SubpassInput;
+
+layout(location = 0) in  vec4 in_Color;
+layout(location = 0) out vec4 out_Color;
+
+void main()
+{
+    out_Color = in_Color * subpassLoad(g_SubpassInput);
+}
+)";
+
+struct TestShader
+{
+    std::string           Name;
+    SHADER_TYPE           ShaderType;
+    std::vector<uint32_t> SPIRV;
+};
+
+class SPIRVShaderResourcesTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        GLSLangUtils::InitializeGlslang();
+
+        auto AddHLSL = [](const char* Name, SHADER_TYPE ShaderType, const char* Source, std::vector<TestShader>& Shaders, IDXCompiler* pDXC) {
+            std::string FullSource{g_HLSLResources};
+            FullSource += Source;
+
+            ShaderCreateInfo ShaderCI;
+            ShaderCI.Source          = FullSource.c_str();
+            ShaderCI.SourceLanguage  = SHADER_SOURCE_LANGUAGE_HLSL;
+            ShaderCI.EntryPoint      = "main";
+            ShaderCI.Desc.ShaderType = ShaderType;
+            ShaderCI.Desc.Name       = Name;
+
+            auto SPIRV = GLSLangUtils::HLSLtoSPIRV(ShaderCI, GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr);
+            ASSERT_FALSE(SPIRV.empty()) << Name;
+            Shaders.push_back({std::string{Name} + " (glslang)", ShaderType, std::move(SPIRV)});
+
+            if (pDXC != nullptr)
+            {
+                std::vector<uint32_t> DXCSPIRV;
+                pDXC->Compile(ShaderCI, ShaderVersion{}, nullptr, nullptr, &DXCSPIRV, nullptr);
+                ASSERT_FALSE(DXCSPIRV.empty()) << Name;
+                Shaders.push_back({std::string{Name} + " (DXC)", ShaderType, std::move(DXCSPIRV)});
+            }
+        };
+
+        auto AddGLSL = [](const char* Name, SHADER_TYPE ShaderType, const char* Source, std::vector<TestShader>& Shaders) {
+            GLSLangUtils::GLSLtoSPIRVAttribs Attribs;
+            Attribs.ShaderType   = ShaderType;
+            Attribs.ShaderSource = Source;
+            Attribs.Version      = GLSLangUtils::SpirvVersion::Vk100;
+
+            auto SPIRV = GLSLangUtils::GLSLtoSPIRV(Attribs);
+            ASSERT_FALSE(SPIRV.empty()) << Name;
+            Shaders.push_back({Name, ShaderType, std::move(SPIRV)});
+        };
+
+        auto pDXC = CreateDXCompiler(DXCompilerTarget::Vulkan, 0, nullptr);
+        if (pDXC && !pDXC->IsLoaded())
+            pDXC.reset();
+
+        AddHLSL("HLSL VS", SHADER_TYPE_VERTEX, g_HLSL_VS, m_Shaders, pDXC.get());
+        AddHLSL("HLSL PS", SHADER_TYPE_PIXEL, g_HLSL_PS, m_Shaders, pDXC.get());
+        AddHLSL("HLSL CS", SHADER_TYPE_COMPUTE, g_HLSL_CS, m_Shaders, pDXC.get());
+        AddGLSL("GLSL CS", SHADER_TYPE_COMPUTE, g_GLSL_CS, m_Shaders);
+        AddGLSL("GLSL PS", SHADER_TYPE_PIXEL, g_GLSL_PS, m_Shaders);
+    }
+
+    static void TearDownTestSuite()
+    {
+        m_Shaders.clear();
+        GLSLangUtils::FinalizeGlslang();
+    }
+
+    static std::unique_ptr<const SPIRVShaderResources> Reflect(const TestShader& Shader, SPIRVShaderResources::ReflectionMode Mode, std::string& EntryPoint)
+    {
+        ShaderDesc Desc;
+        Desc.Name       = Shader.Name.c_str();
+        Desc.ShaderType = Shader.ShaderType;
+        return std::unique_ptr<const SPIRVShaderResources>{
+            new SPIRVShaderResources{
+                DefaultRawMemoryAllocator::GetAllocator(),
+                Shader.SPIRV,
+                Desc,
+                "_sampler",
+                Shader.ShaderType == SHADER_TYPE_VERTEX,
+                EntryPoint,
+                Mode //
+            } //
+        };
+    }
+
+    static std::vector<TestShader> m_Shaders;
+};
+
+std::vector<TestShader> SPIRVShaderResourcesTest::m_Shaders;
+
+// Compares the results of the native SPIRV parser with SPIRV-Cross reflection
+TEST_F(SPIRVShaderResourcesTest, NativeMatchesSPIRVCross)
+{
+    for (const auto& Shader : m_Shaders)
+    {
+        std::string NativeEntryPoint, CrossEntryPoint;
+
+        std::unique_ptr<const SPIRVShaderResources> pNative;
+        EXPECT_NO_THROW(pNative = Reflect(Shader, SPIRVShaderResources::ReflectionMode::Native, NativeEntryPoint)) << Shader.Name;
+        ASSERT_TRUE(pNative) << Shader.Name;
+        auto pCross = Reflect(Shader, SPIRVShaderResources::ReflectionMode::SPIRVCross, CrossEntryPoint);
+
+        EXPECT_EQ(NativeEntryPoint, CrossEntryPoint) << Shader.Name;
+        EXPECT_EQ(pNative->IsHLSLSource(), pCross->IsHLSLSource()) << Shader.Name;
+        EXPECT_EQ(pNative->GetComputeGroupSize(), pCross->GetComputeGroupSize()) << Shader.Name;
+        EXPECT_STREQ(pNative->GetCombinedSamplerSuffix(), pCross->GetCombinedSamplerSuffix()) << Shader.Name;
+
+        EXPECT_EQ(pNative->GetNumUBs(), pCross->GetNumUBs()) << Shader.Name;
+        EXPECT_EQ(pNative->GetNumSBs(), pCross->GetNumSBs()) << Shader.Name;
+        EXPECT_EQ(pNative->GetNumImgs(), pCross->GetNumImgs()) << Shader.Name;
+        EXPECT_EQ(pNative->GetNumSmpldImgs(), pCross->GetNumSmpldImgs()) << Shader.Name;
+        EXPECT_EQ(pNative->GetNumACs(), pCross->GetNumACs()) << Shader.Name;
+        EXPECT_EQ(pNative->GetNumSepSmplrs(), pCross->GetNumSepSmplrs()) << Shader.Name;
+        EXPECT_EQ(pNative->GetNumSepImgs(), pCross->GetNumSepImgs()) << Shader.Name;
+        EXPECT_EQ(pNative->GetNumInptAtts(), pCross->GetNumInptAtts()) << Shader.Name;
+        EXPECT_EQ(pNative->GetNumAccelStructs(), pCross->GetNumAccelStructs()) << Shader.Name;
+        ASSERT_EQ(pNative->GetTotalResources(), pCross->GetTotalResources()) << Shader.Name;
+        EXPECT_NE(pNative->GetTotalResources(), 0u) << Shader.Name;
+
+        for (Uint32 i = 0; i < pNative->GetTotalResources(); ++i)
+        {
+            const auto& NativeRes = pNative->GetResource(i);
+            const auto& CrossRes  = pCross->GetResource(i);
+
+            EXPECT_STREQ(NativeRes.Name, CrossRes.Name) << Shader.Name;
+            EXPECT_EQ(NativeRes.Type, CrossRes.Type) << Shader.Name << ": " << CrossRes.Name;
+            EXPECT_EQ(NativeRes.ArraySize, CrossRes.ArraySize) << Shader.Name << ": " << CrossRes.Name;
+            EXPECT_EQ(NativeRes.GetResourceDimension(), CrossRes.GetResourceDimension()) << Shader.Name << ": " << CrossRes.Name;
+            EXPECT_EQ(NativeRes.IsMultisample(), CrossRes.IsMultisample()) << Shader.Name << ": " << CrossRes.Name;
+            EXPECT_EQ(NativeRes.BindingDecorationOffset, CrossRes.BindingDecorationOffset) << Shader.Name << ": " << CrossRes.Name;
+            EXPECT_EQ(NativeRes.DescriptorSetDecorationOffset, CrossRes.DescriptorSetDecorationOffset) << Shader.Name << ": " << CrossRes.Name;
+            EXPECT_EQ(NativeRes.BufferStaticSize, CrossRes.BufferStaticSize) << Shader.Name << ": " << CrossRes.Name;
+            EXPECT_EQ(NativeRes.BufferStride, CrossRes.BufferStride) << Shader.Name << ": " << CrossRes.Name;
+        }
+
+        ASSERT_EQ(pNative->GetNumShaderStageInputs(), pCross->GetNumShaderStageInputs()) << Shader.Name;
+        for (Uint32 i = 0; i < pNative->GetNumShaderStageInputs(); ++i)
+        {
+            const auto& NativeInput = pNative->GetShaderStageInputAttribs(i);
+            const auto& CrossInput  = pCross->GetShaderStageInputAttribs(i);
+            EXPECT_STREQ(NativeInput.Semantic, CrossInput.Semantic) << Shader.Name;
+            EXPECT_EQ(NativeInput.LocationDecorationOffset, CrossInput.LocationDecorationOffset) << Shader.Name;
+        }
+    }
+}
+
+TEST_F(SPIRVShaderResourcesTest, InvalidBinary)
+{
+    ShaderDesc Desc;
+    Desc.Name       = "Invalid SPIRV";
+    Desc.ShaderType = SHADER_TYPE_PIXEL;
+
+    std::string EntryPoint;
+
+    const std::vector<uint32_t> Garbage = {0x07230203, 0x00010000, 0, 0xFFFFFFFFu, 0, 0x12345678};
+    SPIRVReflection             Reflection;
+    EXPECT_FALSE(Reflection.Parse(Garbage, SHADER_TYPE_PIXEL, EntryPoint));
+
+    // Truncated binary
+    for (const auto& Shader : m_Shaders)
+    {
+        auto Truncated = Shader.SPIRV;
+        Truncated.resize(Truncated.size() / 8);
+        Reflection.Parse(Truncated, Shader.ShaderType, EntryPoint);
+    }
+}
+
+} // namespace
@@ -0,0 +1,348 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#if VULKAN_SUPPORTED
+#    define VK_NO_PROTOTYPES
+#    include "vulkan/vulkan.h"
+#endif
+
+#include <array>
+#include <unordered_set>
+
+#include "TextureViewVk.h"
+#include "BufferViewVk.h"
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+#include "InlineShaders/DrawCommandTestGLSL.h"
+
+namespace Diligent
+{
+
+namespace Testing
+{
+
+void RenderDrawCommandReference(ISwapChain* pSwapChain, const float* pClearColor);
+
+} // namespace Testing
+
+} // namespace Diligent
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr Uint32 InvalidHeapIndex = ~0u;
+
+RefCntAutoPtr<ITexture> CreateHeapTexture(const char* Name, const Uint32 Color = 0)
+{
+    auto* pDevice = TestingEnvironment::GetInstance()->GetDevice();
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = Name;
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = 1;
+    TexDesc.Height    = 1;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.Usage     = USAGE_IMMUTABLE;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+
+    TextureSubResData SubresData{&Color, sizeof(Color)};
+    TextureData       InitData{&SubresData, 1};
+
+    RefCntAutoPtr<ITexture> pTexture;
+    pDevice->CreateTexture(TexDesc, &InitData, &pTexture);
+    return pTexture;
+}
+
+Uint32 GetHeapIndex(ITexture* pTexture)
+{
+    RefCntAutoPtr<ITextureViewVk> pViewVk{pTexture->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE), IID_TextureViewVk};
+    return pViewVk != nullptr ? pViewVk->GetBindlessHeapIndex() : InvalidHeapIndex;
+}
+
+// Returns true if the device has been created with the bindless heap (see EngineVkCreateInfo::BindlessHeapSize)
+bool IsBindlessHeapEnabled()
+{
+    auto* pDevice = TestingEnvironment::GetInstance()->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        return false;
+
+    auto pTexture = CreateHeapTexture("Bindless heap test - probe");
+    return pTexture != nullptr && GetHeapIndex(pTexture) != InvalidHeapIndex;
+}
+
+// Every view gets its own index in the binding of its type
+TEST(BindlessHeapVkTest, IndexAllocation)
+{
+    if (!IsBindlessHeapEnabled())
+        GTEST_SKIP() << "Bindless heap is only supported in Vulkan and requires update-after-bind descriptors";
+
+    auto* pDevice = TestingEnvironment::GetInstance()->GetDevice();
+
+    TestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr Uint32                                 NumTextures = 16;
+    std::array<RefCntAutoPtr<ITexture>, NumTextures> pTextures;
+    std::unordered_set<Uint32>                       TexIndices;
+    for (auto& pTex : pTextures)
+    {
+        pTex = CreateHeapTexture("Bindless heap test - texture");
+        ASSERT_NE(pTex, nullptr);
+        const auto Index = GetHeapIndex(pTex);
+        EXPECT_NE(Index, InvalidHeapIndex);
+        EXPECT_TRUE(TexIndices.insert(Index).second) << "Index " << Index << " is allocated twice";
+    }
+
+    constexpr Uint32                                NumBuffers = 8;
+    std::array<RefCntAutoPtr<IBuffer>, NumBuffers> pBuffers;
+    std::unordered_set<Uint32>                      BuffIndices;
+    for (auto& pBuff : pBuffers)
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name              = "Bindless heap test - structured buffer";
+        BuffDesc.Size              = 256;
+        BuffDesc.BindFlags         = BIND_SHADER_RESOURCE;
+        BuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+        BuffDesc.ElementByteStride = 16;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pBuff);
+        ASSERT_NE(pBuff, nullptr);
+
+        RefCntAutoPtr<IBufferViewVk> pViewVk{pBuff->GetDefaultView(BUFFER_VIEW_SHADER_RESOURCE), IID_BufferViewVk};
+        ASSERT_NE(pViewVk, nullptr);
+        const auto Index = pViewVk->GetBindlessHeapIndex();
+        EXPECT_NE(Index, InvalidHeapIndex);
+        EXPECT_TRUE(BuffIndices.insert(Index).second) << "Index " << Index << " is allocated twice";
+    }
+}
+
+// The index of a released view must not be reused until the GPU is done with the commands
+// that may access the descriptor.
+TEST(BindlessHeapVkTest, DeferredReuse)
+{
+    if (!IsBindlessHeapEnabled())
+        GTEST_SKIP() << "Bindless heap is only supported in Vulkan and requires update-after-bind descriptors";
+
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    // Return all indices released by the previous tests to the heap
+    pDevice->IdleGPU();
+
+    auto pTexA = CreateHeapTexture("Bindless heap test - texture A");
+    auto pTexB = CreateHeapTexture("Bindless heap test - texture B");
+    ASSERT_NE(pTexA, nullptr);
+    ASSERT_NE(pTexB, nullptr);
+
+    const auto IndexA = GetHeapIndex(pTexA);
+    const auto IndexB = GetHeapIndex(pTexB);
+    ASSERT_NE(IndexA, InvalidHeapIndex);
+    ASSERT_NE(IndexB, InvalidHeapIndex);
+    EXPECT_NE(IndexA, IndexB);
+
+    // The index is returned to the heap through the release queue
+    pTexA.Release();
+
+    auto pTexC = CreateHeapTexture("Bindless heap test - texture C");
+    ASSERT_NE(pTexC, nullptr);
+    const auto IndexC = GetHeapIndex(pTexC);
+    EXPECT_NE(IndexC, IndexA);
+    EXPECT_NE(IndexC, IndexB);
+
+    pContext->Flush();
+    pContext->FinishFrame();
+    pDevice->IdleGPU();
+
+    // Index A is the only one that has been released since the GPU was idled last time
+    auto pTexD = CreateHeapTexture("Bindless heap test - texture D");
+    ASSERT_NE(pTexD, nullptr);
+    EXPECT_EQ(GetHeapIndex(pTexD), IndexA);
+}
+
+// Reads the texture through the heap index passed in the constant buffer
+const std::string BindlessHeapTest_FS{
+    R"(
+#version 450 core
+#extension GL_EXT_nonuniform_qualifier : require
+
+uniform texture2D g_Textures[];
+uniform sampler   g_Sampler;
+
+uniform cbConstants
+{
+    uint TextureIndex;
+};
+
+layout(location = 0) in  vec3 in_Color;
+layout(location = 0) out vec4 out_Color;
+
+void main()
+{
+    out_Color = vec4(in_Color, 1.0) * texelFetch(sampler2D(g_Textures[TextureIndex], g_Sampler), ivec2(0, 0), 0);
+}
+)"};
+
+TEST(BindlessHeapVkTest, DrawWithHeapTexture)
+{
+    if (!IsBindlessHeapEnabled())
+        GTEST_SKIP() << "Bindless heap is only supported in Vulkan and requires update-after-bind descriptors";
+
+    auto* pEnv       = TestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr float ClearColor[] = {0.25f, 0.5f, 0.75f, 1.0f};
+    RenderDrawCommandReference(pSwapChain, ClearColor);
+
+    // The black texture is created first so that a wrong index is likely to hit it
+    auto pBlackTex = CreateHeapTexture("Bindless heap test - black", 0xFF000000u);
+    auto pWhiteTex = CreateHeapTexture("Bindless heap test - white", 0xFFFFFFFFu);
+    ASSERT_NE(pBlackTex, nullptr);
+    ASSERT_NE(pWhiteTex, nullptr);
+
+    // Heap textures are not transitioned by the shader resource binding
+    const StateTransitionDesc Barriers[] = {
+        {pBlackTex, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE},
+        {pWhiteTex, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE},
+    };
+    pContext->TransitionResourceStates(_countof(Barriers), Barriers);
+
+    const Uint32 Constants[4] = {GetHeapIndex(pWhiteTex)};
+    ASSERT_NE(Constants[0], InvalidHeapIndex);
+
+    RefCntAutoPtr<IBuffer> pConstants;
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Bindless heap test - constants";
+        BuffDesc.Size      = sizeof(Constants);
+        BuffDesc.Usage     = USAGE_IMMUTABLE;
+        BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+
+        BufferData InitData{Constants, sizeof(Constants)};
+        pDevice->CreateBuffer(BuffDesc, &InitData, &pConstants);
+        ASSERT_NE(pConstants, nullptr);
+    }
+
+    RefCntAutoPtr<IPipelineResourceSignature> pSignature;
+    {
+        constexpr PipelineResourceDesc Resources[] = //
+            {
+                {SHADER_TYPE_PIXEL, "cbConstants", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+                {SHADER_TYPE_PIXEL, "g_Textures", 1, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE, PIPELINE_RESOURCE_FLAG_RUNTIME_ARRAY | PIPELINE_RESOURCE_FLAG_BINDLESS_HEAP} //
+            };
+        const ImmutableSamplerDesc ImtblSamplers[] = //
+            {
+                {SHADER_TYPE_PIXEL, "g_Sampler", SamplerDesc{}} //
+            };
+
+        PipelineResourceSignatureDesc PRSDesc;
+        PRSDesc.Name                 = "Bindless heap test - signature";
+        PRSDesc.Resources            = Resources;
+        PRSDesc.NumResources         = _countof(Resources);
+        PRSDesc.ImmutableSamplers    = ImtblSamplers;
+        PRSDesc.NumImmutableSamplers = _countof(ImtblSamplers);
+
+        pDevice->CreatePipelineResourceSignature(PRSDesc, &pSignature);
+        ASSERT_NE(pSignature, nullptr);
+    }
+    pSignature->GetStaticVariableByName(SHADER_TYPE_PIXEL, "cbConstants")->Set(pConstants);
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+
+    auto& PSODesc          = PSOCreateInfo.PSODesc;
+    auto& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+    PSODesc.Name = "Bindless heap test";
+
+    IPipelineResourceSignature* ppSignatures[] = {pSignature};
+    PSOCreateInfo.ppResourceSignatures         = ppSignatures;
+    PSOCreateInfo.ResourceSignaturesCount      = _countof(ppSignatures);
+
+    GraphicsPipeline.NumRenderTargets             = 1;
+    GraphicsPipeline.RTVFormats[0]                = pSwapChain->GetDesc().ColorBufferFormat;
+    GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_GLSL_VERBATIM;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.CompileFlags   = SHADER_COMPILE_FLAG_ENABLE_UNBOUNDED_ARRAYS;
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_VERTEX;
+        ShaderCI.EntryPoint      = "main";
+        ShaderCI.Desc.Name       = "Bindless heap test - VS";
+        ShaderCI.Source          = GLSL::DrawTest_ProceduralTriangleVS.c_str();
+        pDevice->CreateShader(ShaderCI, &pVS);
+        ASSERT_NE(pVS, nullptr);
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+        ShaderCI.EntryPoint      = "main";
+        ShaderCI.Desc.Name       = "Bindless heap test - PS";
+        ShaderCI.Source          = BindlessHeapTest_FS.c_str();
+        pDevice->CreateShader(ShaderCI, &pPS);
+        ASSERT_NE(pPS, nullptr);
+    }
+
+    PSOCreateInfo.pVS = pVS;
+    PSOCreateInfo.pPS = pPS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pSignature->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->ClearRenderTarget(pRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    pContext->SetPipelineState(pPSO);
+    pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    DrawAttribs DrawAttrs{6, DRAW_FLAG_VERIFY_ALL};
+    pContext->Draw(DrawAttrs);
+
+    pSwapChain->Present();
+}
+
+} // namespace
@@ -0,0 +1,232 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#if VULKAN_SUPPORTED
+#    define VK_NO_PROTOTYPES
+#    include "vulkan/vulkan.h"
+#endif
+
+#include "RenderDeviceVk.h"
+#include "TestingEnvironment.hpp"
+#include "ThreadSignal.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Runs a sequence of tasks on a fixed set of worker threads.
+// The threads are kept alive between the tasks so that every thread keeps
+// allocating descriptor sets from the same per-thread cache of the allocator.
+class WorkerThreads
+{
+public:
+    static constexpr Uint32 NumThreads = 4;
+
+    WorkerThreads()
+    {
+        for (Uint32 i = 0; i < NumThreads; ++i)
+        {
+            m_Threads[i] = std::thread{
+                [this](Uint32 ThreadId) //
+                {
+                    while (m_StartSignals[ThreadId].Wait(true, 1) > 0)
+                    {
+                        m_Task(ThreadId);
+                        if (m_NumThreadsDone.fetch_add(1) + 1 == NumThreads)
+                            m_DoneSignal.Trigger();
+                    }
+                },
+                i};
+        }
+    }
+
+    ~WorkerThreads()
+    {
+        for (auto& Signal : m_StartSignals)
+            Signal.Trigger(false, -1);
+        for (auto& Thread : m_Threads)
+            Thread.join();
+    }
+
+    void Run(std::function<void(Uint32)> Task)
+    {
+        m_Task = std::move(Task);
+        m_NumThreadsDone.store(0);
+        for (auto& Signal : m_StartSignals)
+            Signal.Trigger();
+        m_DoneSignal.Wait(true, 1);
+    }
+
+private:
+    std::array<std::thread, NumThreads>            m_Threads;
+    std::array<ThreadingTools::Signal, NumThreads> m_StartSignals;
+    ThreadingTools::Signal                         m_DoneSignal;
+    std::atomic<Uint32>                            m_NumThreadsDone{0};
+    std::function<void(Uint32)>                    m_Task;
+};
+
+RefCntAutoPtr<IPipelineResourceSignature> CreateSignature(IRenderDevice* pDevice, const char* Name, Uint32 NumTextures)
+{
+    // Mutable variables are allocated in the SRB's descriptor set, so every SRB
+    // takes exactly one set from the allocator.
+    const PipelineResourceDesc Resources[] = //
+        {
+            {SHADER_TYPE_PIXEL, "cbConstants", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE, PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS},
+            {SHADER_TYPE_PIXEL, "g_Textures", NumTextures, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE} //
+        };
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name         = Name;
+    PRSDesc.Resources    = Resources;
+    PRSDesc.NumResources = _countof(Resources);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pSignature;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pSignature);
+    return pSignature;
+}
+
+TEST(DescriptorSetAllocatorVkTest, MultithreadedCreateRelease)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only supported in Vulkan";
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    ASSERT_NE(pDeviceVk, nullptr);
+
+    TestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    auto pSmallSignature = CreateSignature(pDevice, "Descriptor set allocator test - small signature", 1);
+    ASSERT_NE(pSmallSignature, nullptr);
+    auto pLargeSignature = CreateSignature(pDevice, "Descriptor set allocator test - large signature", 8);
+    ASSERT_NE(pLargeSignature, nullptr);
+
+    constexpr Uint32 NumThreads       = WorkerThreads::NumThreads;
+    constexpr Uint32 NumSRBsPerThread = 256;
+
+    // Make sure that the sets of the previous tests have been returned to the allocator
+    pEnv->ReleaseResources();
+
+    DescriptorSetAllocatorStatsVk BaseStats;
+    pDeviceVk->GetDescriptorSetAllocatorStats(BaseStats);
+
+    std::array<std::vector<RefCntAutoPtr<IShaderResourceBinding>>, NumThreads> SRBs;
+    std::array<Uint32, NumThreads>                                             NumNullSRBs{};
+
+    const auto CreateSmallSRBs = [&](Uint32 ThreadId) {
+        SRBs[ThreadId].resize(NumSRBsPerThread);
+        for (auto& pSRB : SRBs[ThreadId])
+        {
+            pSmallSignature->CreateShaderResourceBinding(&pSRB, false);
+            if (!pSRB)
+                ++NumNullSRBs[ThreadId];
+        }
+    };
+    const auto CheckNoNullSRBs = [&]() {
+        for (Uint32 i = 0; i < NumThreads; ++i)
+            EXPECT_EQ(NumNullSRBs[i], 0u) << "Thread " << i;
+    };
+
+    WorkerThreads Workers;
+
+    // Fill several pools in every thread cache
+    Workers.Run(CreateSmallSRBs);
+    CheckNoNullSRBs();
+
+    DescriptorSetAllocatorStatsVk Stats;
+    pDeviceVk->GetDescriptorSetAllocatorStats(Stats);
+    EXPECT_EQ(Stats.NumAllocatedSets, BaseStats.NumAllocatedSets + NumThreads * NumSRBsPerThread);
+    EXPECT_GT(Stats.NumPools, BaseStats.NumPools);
+
+    // Release every other SRB to leave holes in all pools. The sets are returned to
+    // their pools by the release queue, from the main thread.
+    Workers.Run([&](Uint32 ThreadId) {
+        auto& ThreadSRBs = SRBs[ThreadId];
+        for (size_t i = 0; i < ThreadSRBs.size(); i += 2)
+            ThreadSRBs[i].Release();
+    });
+    pEnv->ReleaseResources();
+
+    pDeviceVk->GetDescriptorSetAllocatorStats(Stats);
+    EXPECT_EQ(Stats.NumAllocatedSets, BaseStats.NumAllocatedSets + NumThreads * NumSRBsPerThread / 2);
+    EXPECT_EQ(Stats.NumFragmentedPools, 0u);
+
+    // Large sets may not fit into the holes left by the small ones. Depending on the driver, the
+    // allocator either finds that there is not enough space, or the driver fails the allocation and
+    // the pool is marked as fragmented. In both cases, the allocator must fall back to another pool.
+    Workers.Run([&](Uint32 ThreadId) {
+        auto& ThreadSRBs = SRBs[ThreadId];
+        for (auto& pSRB : ThreadSRBs)
+        {
+            if (!pSRB)
+                pLargeSignature->CreateShaderResourceBinding(&pSRB, false);
+            if (!pSRB)
+                ++NumNullSRBs[ThreadId];
+        }
+    });
+    CheckNoNullSRBs();
+
+    pDeviceVk->GetDescriptorSetAllocatorStats(Stats);
+    EXPECT_EQ(Stats.NumAllocatedSets, BaseStats.NumAllocatedSets + NumThreads * NumSRBsPerThread);
+
+    // Freeing a set must return it to the pool it was allocated from and make fragmented pools usable again
+    Workers.Run([&](Uint32 ThreadId) {
+        SRBs[ThreadId].clear();
+    });
+    pEnv->ReleaseResources();
+
+    DescriptorSetAllocatorStatsVk ReleasedStats;
+    pDeviceVk->GetDescriptorSetAllocatorStats(ReleasedStats);
+    EXPECT_EQ(ReleasedStats.NumAllocatedSets, BaseStats.NumAllocatedSets);
+    EXPECT_EQ(ReleasedStats.NumFragmentedPools, 0u);
+
+    // All pools are empty now, so the same threads must be able to allocate
+    // the same number of sets without creating new pools.
+    Workers.Run(CreateSmallSRBs);
+    CheckNoNullSRBs();
+
+    pDeviceVk->GetDescriptorSetAllocatorStats(Stats);
+    EXPECT_EQ(Stats.NumAllocatedSets, BaseStats.NumAllocatedSets + NumThreads * NumSRBsPerThread);
+    EXPECT_EQ(Stats.NumPools, ReleasedStats.NumPools);
+    EXPECT_EQ(Stats.NumFailedAllocations, ReleasedStats.NumFailedAllocations);
+
+    Workers.Run([&](Uint32 ThreadId) {
+        SRBs[ThreadId].clear();
+    });
+}
+
+} // namespace
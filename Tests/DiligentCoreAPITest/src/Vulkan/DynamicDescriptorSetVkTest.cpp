@@ -0,0 +1,328 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <array>
+#include <cstring>
+
+#include "TestingEnvironment.hpp"
+#include "MapHelper.hpp"
+
+#include "gtest/gtest.h"
+
+#include "InlineShaders/DrawCommandTestGLSL.h"
+
+namespace Diligent
+{
+
+namespace Testing
+{
+
+void RenderDrawCommandReference(ISwapChain* pSwapChain, const float* pClearColor);
+
+} // namespace Testing
+
+} // namespace Diligent
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// The two textures add up to white, so the draw matches the reference image
+// only if both descriptors and the constant buffer are written correctly.
+const std::string DynamicDescriptorSetTest_FS{
+    R"(
+#version 450 core
+
+uniform texture2D g_Textures[2];
+uniform sampler   g_Sampler;
+
+uniform cbConstants
+{
+    vec4 g_Scale;
+};
+
+layout(location = 0) in  vec3 in_Color;
+layout(location = 0) out vec4 out_Color;
+
+void main()
+{
+    vec4 TexSum = texelFetch(sampler2D(g_Textures[0], g_Sampler), ivec2(0, 0), 0) +
+                  texelFetch(sampler2D(g_Textures[1], g_Sampler), ivec2(0, 0), 0);
+    out_Color = vec4(in_Color, 1.0) * TexSum * g_Scale;
+}
+)"};
+
+struct DynamicSetTestParams
+{
+    // Push descriptors are only used for the signature with binding index 0
+    Uint8 BindingIndex = 0;
+
+    // The shader only uses the first two elements, the remaining ones are left null
+    Uint32 TexArraySize = 2;
+
+    // Buffers with dynamic offsets can't be pushed
+    bool DynamicOffsetBuffer = false;
+};
+
+RefCntAutoPtr<ITexture> CreateTexture(const char* Name, Uint32 Color)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = Name;
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = 1;
+    TexDesc.Height    = 1;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.Usage     = USAGE_IMMUTABLE;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+
+    TextureSubResData SubresData{&Color, sizeof(Color)};
+    TextureData       InitData{&SubresData, 1};
+
+    RefCntAutoPtr<ITexture> pTexture;
+    pDevice->CreateTexture(TexDesc, &InitData, &pTexture);
+    return pTexture;
+}
+
+void TestDynamicDescriptorSet(const DynamicSetTestParams& Params)
+{
+    auto* pEnv       = TestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr float ClearColor[] = {0.125f, 0.25f, 0.375f, 1.0f};
+    RenderDrawCommandReference(pSwapChain, ClearColor);
+
+    // RGBA8: red and blue + green and alpha
+    auto pTex0 = CreateTexture("Dynamic descriptor set test - texture 0", 0x00FF00FFu);
+    auto pTex1 = CreateTexture("Dynamic descriptor set test - texture 1", 0xFF00FF00u);
+    ASSERT_NE(pTex0, nullptr);
+    ASSERT_NE(pTex1, nullptr);
+
+    static constexpr float Scale[] = {1, 1, 1, 1};
+
+    RefCntAutoPtr<IBuffer> pConstants;
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Dynamic descriptor set test - constants";
+        BuffDesc.Size      = sizeof(Scale);
+        BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+
+        BufferData InitData{Scale, sizeof(Scale)};
+        if (Params.DynamicOffsetBuffer)
+        {
+            BuffDesc.Usage          = USAGE_DYNAMIC;
+            BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+        }
+        else
+        {
+            BuffDesc.Usage = USAGE_IMMUTABLE;
+        }
+        pDevice->CreateBuffer(BuffDesc, Params.DynamicOffsetBuffer ? nullptr : &InitData, &pConstants);
+        ASSERT_NE(pConstants, nullptr);
+    }
+
+    RefCntAutoPtr<IPipelineResourceSignature> pSignature;
+    {
+        const PipelineResourceDesc Resources[] = //
+            {
+                {SHADER_TYPE_PIXEL, "cbConstants", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC,
+                 Params.DynamicOffsetBuffer ? PIPELINE_RESOURCE_FLAG_NONE : PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS},
+                {SHADER_TYPE_PIXEL, "g_Textures", Params.TexArraySize, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC} //
+            };
+        const ImmutableSamplerDesc ImtblSamplers[] = //
+            {
+                {SHADER_TYPE_PIXEL, "g_Sampler", SamplerDesc{}} //
+            };
+
+        PipelineResourceSignatureDesc PRSDesc;
+        PRSDesc.Name                 = "Dynamic descriptor set test - signature";
+        PRSDesc.Resources            = Resources;
+        PRSDesc.NumResources         = _countof(Resources);
+        PRSDesc.ImmutableSamplers    = ImtblSamplers;
+        PRSDesc.NumImmutableSamplers = _countof(ImtblSamplers);
+        PRSDesc.BindingIndex         = Params.BindingIndex;
+
+        pDevice->CreatePipelineResourceSignature(PRSDesc, &pSignature);
+        ASSERT_NE(pSignature, nullptr);
+    }
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+
+    auto& PSODesc          = PSOCreateInfo.PSODesc;
+    auto& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+    PSODesc.Name = "Dynamic descriptor set test";
+
+    IPipelineResourceSignature* ppSignatures[] = {pSignature};
+    PSOCreateInfo.ppResourceSignatures         = ppSignatures;
+    PSOCreateInfo.ResourceSignaturesCount      = _countof(ppSignatures);
+
+    GraphicsPipeline.NumRenderTargets             = 1;
+    GraphicsPipeline.RTVFormats[0]                = pSwapChain->GetDesc().ColorBufferFormat;
+    GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_GLSL_VERBATIM;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_VERTEX;
+        ShaderCI.EntryPoint      = "main";
+        ShaderCI.Desc.Name       = "Dynamic descriptor set test - VS";
+        ShaderCI.Source          = GLSL::DrawTest_ProceduralTriangleVS.c_str();
+        pDevice->CreateShader(ShaderCI, &pVS);
+        ASSERT_NE(pVS, nullptr);
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+        ShaderCI.EntryPoint      = "main";
+        ShaderCI.Desc.Name       = "Dynamic descriptor set test - PS";
+        ShaderCI.Source          = DynamicDescriptorSetTest_FS.c_str();
+        pDevice->CreateShader(ShaderCI, &pPS);
+        ASSERT_NE(pPS, nullptr);
+    }
+
+    PSOCreateInfo.pVS = pVS;
+    PSOCreateInfo.pPS = pPS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pSignature->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+
+    auto* pTexVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Textures");
+    ASSERT_NE(pTexVar, nullptr);
+    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "cbConstants")->Set(pConstants);
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->ClearRenderTarget(pRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    pContext->SetPipelineState(pPSO);
+
+    // The dynamic set is written on every commit. The second draw swaps the textures,
+    // which produces the same image, but requires the set to be updated.
+    const std::array<IDeviceObject*, 2> TexOrders[] = {
+        {pTex0->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE), pTex1->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE)},
+        {pTex1->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE), pTex0->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE)},
+    };
+    for (const auto& Textures : TexOrders)
+    {
+        if (Params.DynamicOffsetBuffer)
+        {
+            // Every map allocates new memory, so the dynamic offset changes on every draw
+            MapHelper<float> MappedConstants{pContext, pConstants, MAP_WRITE, MAP_FLAG_DISCARD};
+            memcpy(MappedConstants, Scale, sizeof(Scale));
+        }
+
+        pTexVar->SetArray(Textures.data(), 0, static_cast<Uint32>(Textures.size()));
+        pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        DrawAttribs DrawAttrs{6, DRAW_FLAG_VERIFY_ALL};
+        pContext->Draw(DrawAttrs);
+    }
+
+    pSwapChain->Present();
+}
+
+// The dynamic set of the signature with binding index 0 is pushed to the command buffer
+// with vkCmdPushDescriptorSetKHR when VK_KHR_push_descriptor is supported.
+TEST(DynamicDescriptorSetVkTest, PushDescriptorSet)
+{
+    if (!TestingEnvironment::GetInstance()->GetDevice()->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only supported in Vulkan";
+
+    DynamicSetTestParams Params;
+    Params.BindingIndex = 0;
+    TestDynamicDescriptorSet(Params);
+}
+
+// Null array elements are skipped by the push descriptor writes
+TEST(DynamicDescriptorSetVkTest, PushDescriptorSetNullElements)
+{
+    if (!TestingEnvironment::GetInstance()->GetDevice()->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only supported in Vulkan";
+
+    DynamicSetTestParams Params;
+    Params.BindingIndex = 0;
+    Params.TexArraySize = 4;
+    TestDynamicDescriptorSet(Params);
+}
+
+// The allocated dynamic set is written with the descriptor update template
+TEST(DynamicDescriptorSetVkTest, UpdateTemplate)
+{
+    if (!TestingEnvironment::GetInstance()->GetDevice()->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only supported in Vulkan";
+
+    DynamicSetTestParams Params;
+    Params.BindingIndex = 1;
+    TestDynamicDescriptorSet(Params);
+}
+
+// The update template writes all array elements, so the set with null elements
+// falls back to the individual descriptor writes
+TEST(DynamicDescriptorSetVkTest, UpdateTemplateNullElements)
+{
+    if (!TestingEnvironment::GetInstance()->GetDevice()->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only supported in Vulkan";
+
+    DynamicSetTestParams Params;
+    Params.BindingIndex = 1;
+    Params.TexArraySize = 4;
+    TestDynamicDescriptorSet(Params);
+}
+
+// Push descriptor sets can't contain buffers with dynamic offsets, so the set of the
+// signature with binding index 0 is allocated and written with the update template.
+TEST(DynamicDescriptorSetVkTest, DynamicOffsetBuffers)
+{
+    if (!TestingEnvironment::GetInstance()->GetDevice()->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only supported in Vulkan";
+
+    DynamicSetTestParams Params;
+    Params.BindingIndex        = 0;
+    Params.DynamicOffsetBuffer = true;
+    TestDynamicDescriptorSet(Params);
+}
+
+} // namespace
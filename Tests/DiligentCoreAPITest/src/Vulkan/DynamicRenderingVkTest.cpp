@@ -0,0 +1,230 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "Vulkan/TestingEnvironmentVk.hpp"
+
+#include "gtest/gtest.h"
+
+#include "InlineShaders/DrawCommandTestHLSL.h"
+
+namespace Diligent
+{
+
+namespace Testing
+{
+
+void RenderDrawCommandReference(ISwapChain* pSwapChain, const float* pClearColor = nullptr);
+
+} // namespace Testing
+
+} // namespace Diligent
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+class DynamicRenderingVkTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        auto* pEnv    = TestingEnvironment::GetInstance();
+        auto* pDevice = pEnv->GetDevice();
+        if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+            return;
+
+        auto* pSwapChain = pEnv->GetSwapChain();
+
+        GraphicsPipelineStateCreateInfo PSOCreateInfo;
+
+        auto& PSODesc          = PSOCreateInfo.PSODesc;
+        auto& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+        PSODesc.Name = "Dynamic rendering test";
+
+        PSODesc.PipelineType                     = PIPELINE_TYPE_GRAPHICS;
+        GraphicsPipeline.NumRenderTargets        = 1;
+        GraphicsPipeline.RTVFormats[0]           = pSwapChain->GetDesc().ColorBufferFormat;
+        GraphicsPipeline.DSVFormat               = DepthFormat;
+        GraphicsPipeline.PrimitiveTopology       = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        GraphicsPipeline.RasterizerDesc.CullMode = CULL_MODE_NONE;
+
+        GraphicsPipeline.DepthStencilDesc.DepthEnable = True;
+        GraphicsPipeline.DepthStencilDesc.DepthFunc   = COMPARISON_FUNC_LESS;
+
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+        ShaderCI.UseCombinedTextureSamplers = true;
+
+        RefCntAutoPtr<IShader> pVS;
+        {
+            ShaderCI.Desc.ShaderType = SHADER_TYPE_VERTEX;
+            ShaderCI.EntryPoint      = "main";
+            ShaderCI.Desc.Name       = "Dynamic rendering test - VS";
+            ShaderCI.Source          = HLSL::DrawTest_ProceduralTriangleVS.c_str();
+            pDevice->CreateShader(ShaderCI, &pVS);
+            ASSERT_NE(pVS, nullptr);
+        }
+
+        RefCntAutoPtr<IShader> pPS;
+        {
+            ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+            ShaderCI.EntryPoint      = "main";
+            ShaderCI.Desc.Name       = "Dynamic rendering test - PS";
+            ShaderCI.Source          = HLSL::DrawTest_PS.c_str();
+            pDevice->CreateShader(ShaderCI, &pPS);
+            ASSERT_NE(pPS, nullptr);
+        }
+
+        PSOCreateInfo.pVS = pVS;
+        PSOCreateInfo.pPS = pPS;
+        pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &sm_pPSO);
+        ASSERT_NE(sm_pPSO, nullptr);
+
+        TextureDesc TexDesc;
+        TexDesc.Name      = "Dynamic rendering test - depth buffer";
+        TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+        TexDesc.Width     = pSwapChain->GetDesc().Width;
+        TexDesc.Height    = pSwapChain->GetDesc().Height;
+        TexDesc.Format    = DepthFormat;
+        TexDesc.BindFlags = BIND_DEPTH_STENCIL;
+        pDevice->CreateTexture(TexDesc, nullptr, &sm_pDepthBuffer);
+        ASSERT_NE(sm_pDepthBuffer, nullptr);
+    }
+
+    static void TearDownTestSuite()
+    {
+        sm_pPSO.Release();
+        sm_pDepthBuffer.Release();
+
+        auto* pEnv = TestingEnvironment::GetInstance();
+        pEnv->Reset();
+    }
+
+    void SetUp() override
+    {
+        auto* pEnv = TestingEnvironmentVk::GetInstance();
+        if (!pEnv->GetDevice()->GetDeviceInfo().IsVulkanDevice())
+            GTEST_SKIP() << "This test is only supported in Vulkan";
+
+        if (!pEnv->DynamicRendering.dynamicRendering)
+            GTEST_SKIP() << "VK_KHR_dynamic_rendering is not supported by this device";
+
+        ASSERT_NE(sm_pPSO, nullptr);
+        ASSERT_NE(sm_pDepthBuffer, nullptr);
+    }
+
+    // Renders the reference image with a native render pass, then binds the back buffer and the depth
+    // buffer with SetRenderTargets() that the engine implements with VK_KHR_dynamic_rendering.
+    static void SetRenderTargets(const float* ClearColor)
+    {
+        auto* pEnv       = TestingEnvironment::GetInstance();
+        auto* pContext   = pEnv->GetDeviceContext();
+        auto* pSwapChain = pEnv->GetSwapChain();
+
+        RenderDrawCommandReference(pSwapChain, ClearColor);
+
+        ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+        ITextureView* pDSV    = sm_pDepthBuffer->GetDefaultView(TEXTURE_VIEW_DEPTH_STENCIL);
+        pContext->SetRenderTargets(1, pRTVs, pDSV, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        pContext->ClearRenderTarget(pRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->ClearDepthStencil(pDSV, CLEAR_DEPTH_FLAG, 1.f, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        pContext->SetPipelineState(sm_pPSO);
+    }
+
+    static void Present()
+    {
+        auto* pEnv       = TestingEnvironment::GetInstance();
+        auto* pSwapChain = pEnv->GetSwapChain();
+        auto* pContext   = pEnv->GetDeviceContext();
+
+        pSwapChain->Present();
+
+        pContext->Flush();
+        pContext->InvalidateState();
+    }
+
+    static constexpr TEXTURE_FORMAT DepthFormat = TEX_FORMAT_D32_FLOAT;
+
+    static RefCntAutoPtr<IPipelineState> sm_pPSO;
+    static RefCntAutoPtr<ITexture>       sm_pDepthBuffer;
+};
+
+constexpr TEXTURE_FORMAT DynamicRenderingVkTest::DepthFormat;
+
+RefCntAutoPtr<IPipelineState> DynamicRenderingVkTest::sm_pPSO;
+RefCntAutoPtr<ITexture>       DynamicRenderingVkTest::sm_pDepthBuffer;
+
+TEST_F(DynamicRenderingVkTest, Draw)
+{
+    auto* pContext = TestingEnvironment::GetInstance()->GetDeviceContext();
+
+    const float ClearColor[] = {0.25f, 0.5f, 0.75f, 1.f};
+    SetRenderTargets(ClearColor);
+
+    pContext->Draw(DrawAttribs{6, DRAW_FLAG_VERIFY_ALL});
+
+    Present();
+}
+
+// The copy command ends the rendering scope in the middle of the frame. The scope that is begun
+// by the next draw call must load the attachments rather than clear or discard them.
+TEST_F(DynamicRenderingVkTest, ResumeAfterCopy)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Dynamic rendering test - buffer";
+    BuffDesc.Size      = 256;
+    BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    ASSERT_NE(pBuffer, nullptr);
+
+    const float ClearColor[] = {0.75f, 0.5f, 0.25f, 1.f};
+    SetRenderTargets(ClearColor);
+
+    DrawAttribs DrawAttrs{3, DRAW_FLAG_VERIFY_ALL};
+    pContext->Draw(DrawAttrs);
+
+    const float Data[4] = {};
+    pContext->UpdateBuffer(pBuffer, 0, sizeof(Data), Data, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    DrawAttrs.StartVertexLocation = 3;
+    pContext->Draw(DrawAttrs);
+
+    Present();
+}
+
+} // namespace
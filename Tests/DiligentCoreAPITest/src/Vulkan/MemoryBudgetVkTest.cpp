@@ -0,0 +1,302 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#if VULKAN_SUPPORTED
+#    define VK_NO_PROTOTYPES
+#    include "vulkan/vulkan.h"
+#endif
+
+#include <array>
+#include <vector>
+
+#include "RenderDeviceVk.h"
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+struct MemoryBudgetTotals
+{
+    VkDeviceSize AllocatedSize            = 0;
+    VkDeviceSize DedicatedAllocationSize  = 0;
+    Uint32       DedicatedAllocationCount = 0;
+};
+
+MemoryBudgetTotals GetTotals(const MemoryBudgetVk& Budget)
+{
+    MemoryBudgetTotals Totals;
+    for (Uint32 i = 0; i < Budget.HeapCount; ++i)
+    {
+        Totals.AllocatedSize += Budget.Heaps[i].AllocatedSize;
+        Totals.DedicatedAllocationSize += Budget.Heaps[i].DedicatedAllocationSize;
+        Totals.DedicatedAllocationCount += Budget.Heaps[i].DedicatedAllocationCount;
+    }
+    return Totals;
+}
+
+TEST(MemoryBudgetVkTest, GetMemoryBudget)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "Memory budget query is only supported in Vulkan";
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    ASSERT_NE(pDeviceVk, nullptr);
+
+    MemoryBudgetVk Budget;
+    pDeviceVk->GetMemoryBudget(Budget);
+
+    ASSERT_GT(Budget.HeapCount, 0u);
+    ASSERT_LE(Budget.HeapCount, Uint32{VK_MAX_MEMORY_HEAPS});
+
+    bool         HasDeviceLocalHeap = false;
+    VkDeviceSize TotalUsage         = 0;
+    for (Uint32 i = 0; i < Budget.HeapCount; ++i)
+    {
+        const auto& Heap = Budget.Heaps[i];
+        EXPECT_GT(Heap.Size, VkDeviceSize{0}) << "Heap " << i;
+        EXPECT_GT(Heap.Budget, VkDeviceSize{0}) << "Heap " << i;
+        EXPECT_LE(Heap.Budget, Heap.Size) << "Heap " << i;
+        EXPECT_LE(Heap.AllocatedSize, Heap.Size) << "Heap " << i;
+        EXPECT_LE(Heap.DedicatedAllocationSize, Heap.AllocatedSize) << "Heap " << i;
+        EXPECT_EQ(Heap.DedicatedAllocationCount == 0, Heap.DedicatedAllocationSize == 0) << "Heap " << i;
+        if (!Budget.IsDriverReported)
+        {
+            EXPECT_EQ(Heap.Budget, Heap.Size) << "Heap " << i;
+            EXPECT_EQ(Heap.Usage, Heap.AllocatedSize) << "Heap " << i;
+        }
+
+        if (Heap.Flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)
+            HasDeviceLocalHeap = true;
+        TotalUsage += Heap.Usage;
+    }
+    EXPECT_TRUE(HasDeviceLocalHeap);
+    // The test environment has already created the swap chain and other resources
+    EXPECT_GT(TotalUsage, VkDeviceSize{0});
+    EXPECT_GT(GetTotals(Budget).AllocatedSize, VkDeviceSize{0});
+}
+
+TEST(MemoryBudgetVkTest, LargeTextureDedicatedAllocation)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "Dedicated allocations are only supported in Vulkan";
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    ASSERT_NE(pDeviceVk, nullptr);
+
+    MemoryBudgetVk Budget;
+    pDeviceVk->GetMemoryBudget(Budget);
+    if (!Budget.DedicatedAllocationsEnabled)
+        GTEST_SKIP() << "VK_KHR_dedicated_allocation is not supported by this device";
+
+    TestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    const auto Before = GetTotals(Budget);
+
+    // 64 MB is well above the default dedicated allocation threshold (8 MB)
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Memory budget test large texture";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = 4096;
+    TexDesc.Height    = 4096;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+    TexDesc.Usage     = USAGE_DEFAULT;
+
+    constexpr VkDeviceSize TexDataSize = VkDeviceSize{4096} * 4096 * 4;
+
+    RefCntAutoPtr<ITexture> pTexture;
+    pDevice->CreateTexture(TexDesc, nullptr, &pTexture);
+    ASSERT_NE(pTexture, nullptr);
+
+    pDeviceVk->GetMemoryBudget(Budget);
+    const auto WithTexture = GetTotals(Budget);
+
+    // The texture must be placed in its own allocation rather than in a memory page
+    EXPECT_EQ(WithTexture.DedicatedAllocationCount, Before.DedicatedAllocationCount + 1);
+    EXPECT_GE(WithTexture.DedicatedAllocationSize, Before.DedicatedAllocationSize + TexDataSize);
+    EXPECT_EQ(WithTexture.AllocatedSize - Before.AllocatedSize, WithTexture.DedicatedAllocationSize - Before.DedicatedAllocationSize);
+
+    // The dedicated page must be destroyed as soon as the texture memory is released
+    pTexture.Release();
+    pEnv->ReleaseResources();
+
+    pDeviceVk->GetMemoryBudget(Budget);
+    const auto After = GetTotals(Budget);
+    EXPECT_EQ(After.DedicatedAllocationCount, Before.DedicatedAllocationCount);
+    EXPECT_EQ(After.DedicatedAllocationSize, Before.DedicatedAllocationSize);
+    EXPECT_LE(After.AllocatedSize, Before.AllocatedSize);
+}
+
+// Returns the memory of the released resources to their pages and destroys the empty pages.
+// The test environment does not keep a reserve of empty pages.
+void ReleaseMemory(IRenderDevice* pDevice)
+{
+    TestingEnvironment::GetInstance()->ReleaseResources();
+    // The GPU is idle now, so the resources held for the completion thread can be released too
+    pDevice->ReleaseStaleResources(true);
+}
+
+VkDeviceSize GetAllocatedSize(IRenderDeviceVk* pDeviceVk)
+{
+    MemoryBudgetVk Budget;
+    pDeviceVk->GetMemoryBudget(Budget);
+    return GetTotals(Budget).AllocatedSize;
+}
+
+// Buffers of one size that fill whole memory pages
+struct PageFillBuffers
+{
+    std::vector<RefCntAutoPtr<IBuffer>> Buffers;
+    // Index of the first buffer in every page created while filling
+    std::vector<size_t> PageStarts;
+    VkDeviceSize        PageSize = 0;
+};
+
+// Creates buffers of the given size until NumPages new pages have been allocated.
+// Pages are only created when no page of the size class has a large enough free block,
+// so all pages except the last one are full for this buffer size.
+void FillPages(IRenderDevice* pDevice, Uint64 BufferSize, size_t NumPages, PageFillBuffers& Fill)
+{
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Memory page test buffer";
+    BuffDesc.Size      = BufferSize;
+    BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+    BuffDesc.Usage     = USAGE_DEFAULT;
+
+    auto AllocatedSize = GetAllocatedSize(pDeviceVk);
+    while (Fill.PageStarts.size() < NumPages)
+    {
+        ASSERT_LT(Fill.Buffers.size(), size_t{4096}) << "Too many buffers created without allocating a new page";
+
+        RefCntAutoPtr<IBuffer> pBuffer;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+        ASSERT_NE(pBuffer, nullptr);
+        Fill.Buffers.emplace_back(std::move(pBuffer));
+
+        const auto NewAllocatedSize = GetAllocatedSize(pDeviceVk);
+        if (NewAllocatedSize == AllocatedSize)
+            continue;
+
+        ASSERT_GT(NewAllocatedSize, AllocatedSize);
+        const auto PageSize = NewAllocatedSize - AllocatedSize;
+        if (Fill.PageSize == 0)
+            Fill.PageSize = PageSize;
+        EXPECT_EQ(PageSize, Fill.PageSize);
+        Fill.PageStarts.push_back(Fill.Buffers.size() - 1);
+        AllocatedSize = NewAllocatedSize;
+    }
+}
+
+TEST(MemoryBudgetVkTest, PageReuseAndRelease)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only supported in Vulkan";
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    ASSERT_NE(pDeviceVk, nullptr);
+
+    TestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    ReleaseMemory(pDevice);
+
+    MemoryBudgetVk Budget;
+    pDeviceVk->GetMemoryBudget(Budget);
+    const auto Before = GetTotals(Budget);
+
+    // With the default 16 MB pages, 64 KB buffers belong to the small size class and
+    // 3 MB buffers to the large one. Both are below the dedicated allocation threshold.
+    constexpr Uint64 BufferSizes[] = {64 << 10, 3 << 20};
+
+    std::array<PageFillBuffers, _countof(BufferSizes)> Fills;
+    for (size_t i = 0; i < _countof(BufferSizes); ++i)
+    {
+        auto& Fill = Fills[i];
+        FillPages(pDevice, BufferSizes[i], 3, Fill);
+        if (HasFatalFailure())
+            return;
+
+        pDeviceVk->GetMemoryBudget(Budget);
+        if (GetTotals(Budget).DedicatedAllocationCount != Before.DedicatedAllocationCount)
+            GTEST_SKIP() << "The driver prefers dedicated allocations for buffers";
+
+        // The first two pages are full and hold more than one buffer
+        ASSERT_GE(Fill.PageStarts[1] - Fill.PageStarts[0], size_t{2});
+        ASSERT_EQ(Fill.PageStarts[2], Fill.Buffers.size() - 1);
+    }
+
+    for (size_t i = 0; i < _countof(BufferSizes); ++i)
+    {
+        auto&      Fill          = Fills[i];
+        const auto AllocatedSize = GetAllocatedSize(pDeviceVk);
+
+        // The last page only holds the buffer that created it and must be destroyed once the buffer is released
+        Fill.Buffers.back().Release();
+        ReleaseMemory(pDevice);
+        EXPECT_EQ(GetAllocatedSize(pDeviceVk), AllocatedSize - Fill.PageSize) << "Buffer size " << BufferSizes[i];
+
+        // Releasing a buffer from the first page leaves the page in place
+        Fill.Buffers[Fill.PageStarts[0]].Release();
+        ReleaseMemory(pDevice);
+        EXPECT_EQ(GetAllocatedSize(pDeviceVk), AllocatedSize - Fill.PageSize) << "Buffer size " << BufferSizes[i];
+
+        // All other pages are full, so the new buffer can only be placed in the freed block of the first page
+        BufferDesc BuffDesc = Fill.Buffers[Fill.PageStarts[0] + 1]->GetDesc();
+        pDevice->CreateBuffer(BuffDesc, nullptr, &Fill.Buffers[Fill.PageStarts[0]]);
+        ASSERT_NE(Fill.Buffers[Fill.PageStarts[0]], nullptr);
+        EXPECT_EQ(GetAllocatedSize(pDeviceVk), AllocatedSize - Fill.PageSize) << "Buffer size " << BufferSizes[i];
+
+        // The next buffer does not fit anywhere and requires a new page again
+        pDevice->CreateBuffer(BuffDesc, nullptr, &Fill.Buffers.back());
+        ASSERT_NE(Fill.Buffers.back(), nullptr);
+        EXPECT_EQ(GetAllocatedSize(pDeviceVk), AllocatedSize) << "Buffer size " << BufferSizes[i];
+    }
+
+    // Destroying all buffers must release every page that has been created by the test
+    for (auto& Fill : Fills)
+        Fill.Buffers.clear();
+    ReleaseMemory(pDevice);
+
+    pDeviceVk->GetMemoryBudget(Budget);
+    const auto After = GetTotals(Budget);
+    EXPECT_EQ(After.AllocatedSize, Before.AllocatedSize);
+    EXPECT_EQ(After.DedicatedAllocationCount, Before.DedicatedAllocationCount);
+}
+
+} // namespace
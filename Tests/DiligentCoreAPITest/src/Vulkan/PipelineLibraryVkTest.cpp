@@ -0,0 +1,189 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "RenderDeviceVk.h"
+#include "PipelineStateVk.h"
+#include "Vulkan/TestingEnvironmentVk.hpp"
+
+#include "gtest/gtest.h"
+
+#include "InlineShaders/DrawCommandTestHLSL.h"
+
+namespace Diligent
+{
+
+namespace Testing
+{
+
+void RenderDrawCommandReference(ISwapChain* pSwapChain, const float* pClearColor = nullptr);
+
+} // namespace Testing
+
+} // namespace Diligent
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+void DrawAndCompare(IPipelineState* pPSO, const float* ClearColor)
+{
+    auto* pEnv       = TestingEnvironment::GetInstance();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    RenderDrawCommandReference(pSwapChain, ClearColor);
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->ClearRenderTarget(pRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    pContext->SetPipelineState(pPSO);
+    pContext->Draw(DrawAttribs{6, DRAW_FLAG_VERIFY_ALL});
+
+    pSwapChain->Present();
+
+    pContext->Flush();
+    pContext->InvalidateState();
+}
+
+// Two pipelines that only differ in blend state must share the vertex input, pre-rasterization shader
+// and fragment shader libraries, and only need a separate fragment output library.
+TEST(PipelineLibraryVkTest, SharedLibraries)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only supported in Vulkan";
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    ASSERT_NE(pDeviceVk, nullptr);
+
+    PipelineLibraryStatsVk Stats;
+    pDeviceVk->GetPipelineLibraryStats(Stats);
+    if (!Stats.Enabled)
+        GTEST_SKIP() << "VK_EXT_graphics_pipeline_library is not supported by this device";
+
+    TestingEnvironment::ScopedReleaseResources AutoReleaseResources;
+
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.UseCombinedTextureSamplers = true;
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_VERTEX;
+        ShaderCI.EntryPoint      = "main";
+        ShaderCI.Desc.Name       = "Pipeline library test - VS";
+        ShaderCI.Source          = HLSL::DrawTest_ProceduralTriangleVS.c_str();
+        pDevice->CreateShader(ShaderCI, &pVS);
+        ASSERT_NE(pVS, nullptr);
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+        ShaderCI.EntryPoint      = "main";
+        ShaderCI.Desc.Name       = "Pipeline library test - PS";
+        ShaderCI.Source          = HLSL::DrawTest_PS.c_str();
+        pDevice->CreateShader(ShaderCI, &pPS);
+        ASSERT_NE(pPS, nullptr);
+    }
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+
+    auto& PSODesc          = PSOCreateInfo.PSODesc;
+    auto& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+    PSODesc.Name = "Pipeline library test - opaque";
+
+    PSODesc.PipelineType                          = PIPELINE_TYPE_GRAPHICS;
+    GraphicsPipeline.NumRenderTargets             = 1;
+    GraphicsPipeline.RTVFormats[0]                = pSwapChain->GetDesc().ColorBufferFormat;
+    GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    PSOCreateInfo.pVS = pVS;
+    PSOCreateInfo.pPS = pPS;
+
+    RefCntAutoPtr<IPipelineState> pOpaquePSO;
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pOpaquePSO);
+    ASSERT_NE(pOpaquePSO, nullptr);
+
+    PipelineLibraryStatsVk OpaqueStats;
+    pDeviceVk->GetPipelineLibraryStats(OpaqueStats);
+    EXPECT_EQ(OpaqueStats.NumCreated + OpaqueStats.NumReused, Stats.NumCreated + Stats.NumReused + 4);
+
+    // Blending with ONE/ZERO factors produces the same image as the opaque pipeline
+    PSODesc.Name = "Pipeline library test - blended";
+
+    auto& RT0 = GraphicsPipeline.BlendDesc.RenderTargets[0];
+
+    RT0.BlendEnable    = True;
+    RT0.SrcBlend       = BLEND_FACTOR_ONE;
+    RT0.DestBlend      = BLEND_FACTOR_ZERO;
+    RT0.SrcBlendAlpha  = BLEND_FACTOR_ONE;
+    RT0.DestBlendAlpha = BLEND_FACTOR_ZERO;
+
+    RefCntAutoPtr<IPipelineState> pBlendedPSO;
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pBlendedPSO);
+    ASSERT_NE(pBlendedPSO, nullptr);
+
+    PipelineLibraryStatsVk BlendedStats;
+    pDeviceVk->GetPipelineLibraryStats(BlendedStats);
+    EXPECT_EQ(BlendedStats.NumCreated, OpaqueStats.NumCreated + 1);
+    EXPECT_EQ(BlendedStats.NumReused, OpaqueStats.NumReused + 3);
+    EXPECT_EQ(BlendedStats.NumLibraries, OpaqueStats.NumLibraries + 1);
+
+    RefCntAutoPtr<IPipelineStateVk> pOpaquePSOVk{pOpaquePSO, IID_PipelineStateVk};
+    RefCntAutoPtr<IPipelineStateVk> pBlendedPSOVk{pBlendedPSO, IID_PipelineStateVk};
+    ASSERT_NE(pOpaquePSOVk, nullptr);
+    ASSERT_NE(pBlendedPSOVk, nullptr);
+    EXPECT_NE(pOpaquePSOVk->GetVkPipeline(), pBlendedPSOVk->GetVkPipeline());
+
+    const float ClearColor[] = {0.125f, 0.25f, 0.375f, 1.f};
+    DrawAndCompare(pOpaquePSO, ClearColor);
+    DrawAndCompare(pBlendedPSO, ClearColor);
+
+    // The libraries that are only used by the blended pipeline are released with it
+    pBlendedPSOVk.Release();
+    pBlendedPSO.Release();
+    pEnv->ReleaseResources();
+
+    pDeviceVk->GetPipelineLibraryStats(BlendedStats);
+    EXPECT_EQ(BlendedStats.NumLibraries, OpaqueStats.NumLibraries);
+
+    // The opaque pipeline still renders correctly after the shared libraries lost one of their users
+    DrawAndCompare(pOpaquePSO, ClearColor);
+}
+
+} // namespace
@@ -0,0 +1,254 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <chrono>
+#include <thread>
+
+#include "RenderDeviceVk.h"
+#include "FenceVk.h"
+#include "Vulkan/TestingEnvironmentVk.hpp"
+#include "MapHelper.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+bool IsCompletionThreadEnabled()
+{
+    auto* pEnv = TestingEnvironmentVk::GetInstance();
+    if (!pEnv->IsCompletionThreadRequested())
+        return false;
+
+    // The engine ignores the option if timeline semaphores are not supported
+    FenceDesc Desc;
+    Desc.Name = "Timeline semaphore support test";
+    Desc.Type = FENCE_TYPE_GENERAL;
+    RefCntAutoPtr<IFence> pFence;
+    pEnv->GetDevice()->CreateFence(Desc, &pFence);
+    RefCntAutoPtr<IFenceVk> pFenceVk{pFence, IID_FenceVk};
+    return pFenceVk && pFenceVk->GetVkSemaphore() != VK_NULL_HANDLE;
+}
+
+RefCntAutoPtr<IBuffer> CreateBuffer(IRenderDevice* pDevice, const char* Name, Uint64 Size, USAGE Usage, BIND_FLAGS BindFlags)
+{
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = Name;
+    BuffDesc.Size      = Size;
+    BuffDesc.Usage     = Usage;
+    BuffDesc.BindFlags = BindFlags;
+    if (Usage == USAGE_STAGING)
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_READ;
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    return pBuffer;
+}
+
+// Every submission is followed by a fence signal and replaces the last sync point of the queue.
+// When submissions are batched, the sync points must stay alive until the GPU completes them,
+// otherwise their fences are recycled while they are still in use (which is reported by the validation layers).
+TEST(SubmitBatchingVkTest, ManySmallSubmissions)
+{
+    auto* pDevice = TestingEnvironment::GetInstance()->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only supported in Vulkan";
+
+    auto* pEnv     = TestingEnvironmentVk::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 NumStagingBuffers = 8;
+    constexpr Uint32 NumSubmissions    = 64;
+    constexpr Uint32 NumValues         = 4;
+    constexpr Uint64 BufferSize        = sizeof(Uint32) * NumValues;
+
+    auto pBuffer = CreateBuffer(pDevice, "Submit batching test", BufferSize, USAGE_DEFAULT, BIND_UNIFORM_BUFFER);
+    ASSERT_NE(pBuffer, nullptr);
+
+    RefCntAutoPtr<IBuffer> pStagingBuffers[NumStagingBuffers];
+    for (auto& pStagingBuff : pStagingBuffers)
+    {
+        pStagingBuff = CreateBuffer(pDevice, "Submit batching test - staging", BufferSize, USAGE_STAGING, BIND_NONE);
+        ASSERT_NE(pStagingBuff, nullptr);
+    }
+
+    FenceDesc FenceCI;
+    FenceCI.Name = "Submit batching test";
+    FenceCI.Type = FENCE_TYPE_CPU_WAIT_ONLY;
+    RefCntAutoPtr<IFence> pFence;
+    pDevice->CreateFence(FenceCI, &pFence);
+    ASSERT_NE(pFence, nullptr);
+
+    auto VerifyStagingBuffer = [&](Uint32 Submission) {
+        MapHelper<Uint32> MappedData{pContext, pStagingBuffers[Submission % NumStagingBuffers], MAP_READ, MAP_FLAG_DO_NOT_WAIT};
+
+        const Uint32* pData = MappedData;
+        ASSERT_NE(pData, nullptr);
+        for (Uint32 i = 0; i < NumValues; ++i)
+            EXPECT_EQ(pData[i], Submission + i);
+    };
+
+    Uint64 PrevCompletedValue = 0;
+    for (Uint32 s = 0; s < NumSubmissions; ++s)
+    {
+        if (s >= NumStagingBuffers)
+        {
+            // Wait for the submission that used the same staging buffer. The submission may be
+            // in a pending batch, so the fence must send the batch to the GPU before waiting.
+            const Uint32 PrevSubmission = s - NumStagingBuffers;
+            pFence->Wait(PrevSubmission + 1);
+            EXPECT_GE(pFence->GetCompletedValue(), PrevSubmission + 1);
+            VerifyStagingBuffer(PrevSubmission);
+        }
+
+        const Uint32 Data[NumValues] = {s, s + 1, s + 2, s + 3};
+        pContext->UpdateBuffer(pBuffer, 0, BufferSize, Data, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->CopyBuffer(pBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                             pStagingBuffers[s % NumStagingBuffers], 0, BufferSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->EnqueueSignal(pFence, s + 1);
+        pContext->Flush();
+
+        const auto CompletedValue = pFence->GetCompletedValue();
+        EXPECT_GE(CompletedValue, PrevCompletedValue);
+        EXPECT_LE(CompletedValue, s + 1);
+        PrevCompletedValue = CompletedValue;
+    }
+
+    pFence->Wait(NumSubmissions);
+    EXPECT_EQ(pFence->GetCompletedValue(), NumSubmissions);
+    for (Uint32 s = NumSubmissions - NumStagingBuffers; s < NumSubmissions; ++s)
+        VerifyStagingBuffer(s);
+}
+
+TEST(SubmitBatchingVkTest, WaitForIdle)
+{
+    auto* pDevice = TestingEnvironment::GetInstance()->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only supported in Vulkan";
+
+    auto* pEnv     = TestingEnvironmentVk::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto pBuffer = CreateBuffer(pDevice, "Submit batching test", 256, USAGE_DEFAULT, BIND_UNIFORM_BUFFER);
+    ASSERT_NE(pBuffer, nullptr);
+
+    // Fewer submissions than the batch size, so that they remain in the pending batch
+    for (Uint32 s = 0; s < 3; ++s)
+    {
+        const Uint32 Data[4] = {s, s, s, s};
+        pContext->UpdateBuffer(pBuffer, 0, sizeof(Data), Data, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->Flush();
+    }
+
+    auto* pQueue = pContext->LockCommandQueue();
+    ASSERT_NE(pQueue, nullptr);
+    const auto LastSubmittedValue = pQueue->GetNextFenceValue() - 1;
+    pContext->UnlockCommandQueue();
+
+    pContext->WaitForIdle();
+
+    pQueue = pContext->LockCommandQueue();
+    EXPECT_GE(pQueue->GetCompletedFenceValue(), LastSubmittedValue);
+    pContext->UnlockCommandQueue();
+
+    // The queue must remain usable after idling
+    const Uint32 Data[4] = {};
+    pContext->UpdateBuffer(pBuffer, 0, sizeof(Data), Data, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->Flush();
+    pContext->WaitForIdle();
+}
+
+// The completion thread releases resources as soon as the GPU completes the command buffers
+// that use them, without any further calls to the engine.
+TEST(CompletionThreadVkTest, ReleasesStaleResources)
+{
+    auto* pDevice = TestingEnvironment::GetInstance()->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "This test is only supported in Vulkan";
+
+    auto* pEnv     = TestingEnvironmentVk::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    if (!IsCompletionThreadEnabled())
+        GTEST_SKIP() << "Completion thread is not enabled. Run the tests with --vk_completion_thread on a device that supports timeline semaphores.";
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    ASSERT_NE(pDeviceVk, nullptr);
+
+    auto GetTotalUsage = [&]() {
+        MemoryBudgetVk Budget;
+        pDeviceVk->GetMemoryBudget(Budget);
+        Uint64 Usage = 0;
+        for (Uint32 i = 0; i < Budget.HeapCount; ++i)
+            Usage += Budget.Heaps[i].Usage;
+        return Usage;
+    };
+
+    auto pSmallBuffer = CreateBuffer(pDevice, "Completion thread test - small", 256, USAGE_DEFAULT, BIND_UNIFORM_BUFFER);
+    ASSERT_NE(pSmallBuffer, nullptr);
+
+    pContext->WaitForIdle();
+    pDevice->ReleaseStaleResources();
+
+    // The buffer is large enough to get a dedicated allocation that is freed as soon as the buffer is released
+    constexpr Uint64 LargeBufferSize = Uint64{64} << 20;
+
+    auto pLargeBuffer = CreateBuffer(pDevice, "Completion thread test - large", LargeBufferSize, USAGE_DEFAULT, BIND_VERTEX_BUFFER);
+    ASSERT_NE(pLargeBuffer, nullptr);
+
+    const Uint32 Data[4] = {};
+    pContext->UpdateBuffer(pLargeBuffer, 0, sizeof(Data), Data, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->Flush();
+
+    const auto UsageWithBuffer = GetTotalUsage();
+
+    pLargeBuffer.Release();
+
+    // The released buffer is moved to the release queue by the next submission
+    pContext->UpdateBuffer(pSmallBuffer, 0, sizeof(Data), Data, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->Flush();
+
+    // Only query the memory budget, which does not release stale resources
+    const auto StartTime = std::chrono::steady_clock::now();
+    auto       Usage     = GetTotalUsage();
+    while (Usage + LargeBufferSize / 2 > UsageWithBuffer && std::chrono::steady_clock::now() - StartTime < std::chrono::seconds{5})
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        Usage = GetTotalUsage();
+    }
+    EXPECT_LE(Usage + LargeBufferSize / 2, UsageWithBuffer) << "The buffer was not released by the completion thread";
+}
+
+} // namespace
@@ -0,0 +1,222 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#if VULKAN_SUPPORTED
+#    define VK_NO_PROTOTYPES
+#    include "vulkan/vulkan.h"
+#endif
+
+#include <array>
+
+#include "RenderDeviceVk.h"
+#include "TextureVk.h"
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(TransientTexturesVkTest, FrameGraph)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "Transient textures are only supported in Vulkan";
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    ASSERT_NE(pDeviceVk, nullptr);
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto MakeDesc = [](const char* Name, Uint32 Width, Uint32 Height, TEXTURE_FORMAT Format, BIND_FLAGS BindFlags, Uint32 FirstPass, Uint32 LastPass) {
+        TransientTextureDescVk Desc;
+        Desc.Desc.Name      = Name;
+        Desc.Desc.Type      = RESOURCE_DIM_TEX_2D;
+        Desc.Desc.Width     = Width;
+        Desc.Desc.Height    = Height;
+        Desc.Desc.Format    = Format;
+        Desc.Desc.BindFlags = BindFlags;
+        Desc.FirstPass      = FirstPass;
+        Desc.LastPass       = LastPass;
+        return Desc;
+    };
+
+    constexpr auto RT_SRV = BIND_RENDER_TARGET | BIND_SHADER_RESOURCE;
+    constexpr auto DS_SRV = BIND_DEPTH_STENCIL | BIND_SHADER_RESOURCE;
+
+    // G-buffer -> lighting -> SSAO -> bloom chain -> tone mapping
+    const std::array<TransientTextureDescVk, 8> Descs = //
+        {
+            MakeDesc("GBuffer Albedo", 1024, 1024, TEX_FORMAT_RGBA8_UNORM, RT_SRV, 0, 1),
+            MakeDesc("GBuffer Normal", 1024, 1024, TEX_FORMAT_RGBA16_FLOAT, RT_SRV, 0, 2),
+            MakeDesc("GBuffer Depth", 1024, 1024, TEX_FORMAT_D32_FLOAT, DS_SRV, 0, 2),
+            MakeDesc("SSAO", 1024, 1024, TEX_FORMAT_R8_UNORM, RT_SRV, 2, 3),
+            MakeDesc("HDR Color", 1024, 1024, TEX_FORMAT_RGBA16_FLOAT, RT_SRV, 3, 6),
+            MakeDesc("Bloom 1/2", 512, 512, TEX_FORMAT_RGBA16_FLOAT, RT_SRV, 4, 5),
+            MakeDesc("Bloom 1/4", 256, 256, TEX_FORMAT_RGBA16_FLOAT, RT_SRV, 5, 6),
+            MakeDesc("Tone Mapped", 1024, 1024, TEX_FORMAT_RGBA8_UNORM, RT_SRV, 7, 7),
+        };
+
+    std::array<ITexture*, Descs.size()> pTextures{};
+    TransientMemoryStatsVk              Stats;
+    pDeviceVk->CreateTransientTextures(Descs.data(), static_cast<Uint32>(Descs.size()), pTextures.data(), &Stats);
+    for (auto* pTex : pTextures)
+        ASSERT_NE(pTex, nullptr);
+
+    EXPECT_GT(Stats.NumAllocations, 0u);
+    EXPECT_GT(Stats.AllocatedSize, 0u);
+    EXPECT_LT(Stats.AllocatedSize, Stats.RequiredSize);
+
+    // Render to every texture in pass order so that the aliasing barriers are recorded
+    for (Uint32 Pass = 0; Pass <= Descs.back().LastPass; ++Pass)
+    {
+        for (size_t i = 0; i < Descs.size(); ++i)
+        {
+            if (Descs[i].FirstPass != Pass)
+                continue;
+
+            const auto IsDepth = (Descs[i].Desc.BindFlags & BIND_DEPTH_STENCIL) != 0;
+            auto*      pView   = pTextures[i]->GetDefaultView(IsDepth ? TEXTURE_VIEW_DEPTH_STENCIL : TEXTURE_VIEW_RENDER_TARGET);
+            if (IsDepth)
+            {
+                pContext->SetRenderTargets(0, nullptr, pView, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+                pContext->ClearDepthStencil(pView, CLEAR_DEPTH_FLAG, 1.f, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            }
+            else
+            {
+                pContext->SetRenderTargets(1, &pView, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+                constexpr float ClearColor[] = {0, 0, 0, 0};
+                pContext->ClearRenderTarget(pView, ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            }
+        }
+    }
+    pContext->SetRenderTargets(0, nullptr, nullptr, RESOURCE_STATE_TRANSITION_MODE_NONE);
+    pContext->Flush();
+    pContext->WaitForIdle();
+
+    for (auto* pTex : pTextures)
+        pTex->Release();
+}
+
+// Aliased textures must take over their memory when they are bound in any state transition mode,
+// including textures whose state is not tracked, and in deferred contexts.
+TEST(TransientTexturesVkTest, AcquireOnBind)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+        GTEST_SKIP() << "Transient textures are only supported in Vulkan";
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    ASSERT_NE(pDeviceVk, nullptr);
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    // Two textures of the same size with non-overlapping lifetimes share the same memory
+    std::array<TransientTextureDescVk, 2> Descs;
+    for (Uint32 i = 0; i < Descs.size(); ++i)
+    {
+        auto& Desc          = Descs[i];
+        Desc.Desc.Name      = i == 0 ? "Transient texture A" : "Transient texture B";
+        Desc.Desc.Type      = RESOURCE_DIM_TEX_2D;
+        Desc.Desc.Width     = 256;
+        Desc.Desc.Height    = 256;
+        Desc.Desc.Format    = TEX_FORMAT_RGBA8_UNORM;
+        Desc.Desc.BindFlags = BIND_RENDER_TARGET | BIND_SHADER_RESOURCE;
+        Desc.FirstPass      = i;
+        Desc.LastPass       = i;
+    }
+
+    std::array<ITexture*, Descs.size()> pTextures{};
+    TransientMemoryStatsVk              Stats;
+    pDeviceVk->CreateTransientTextures(Descs.data(), static_cast<Uint32>(Descs.size()), pTextures.data(), &Stats);
+    for (auto* pTex : pTextures)
+        ASSERT_NE(pTex, nullptr);
+    ASSERT_EQ(Stats.AllocatedSize * 2, Stats.RequiredSize);
+
+    auto* pRTV_A = pTextures[0]->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+    auto* pRTV_B = pTextures[1]->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+
+    auto GetBarrierCount = [](IDeviceContext* pCtx) {
+        DeviceContextStats CtxStats;
+        pCtx->GetStats(CtxStats);
+        return CtxStats.BarrierCount;
+    };
+
+    pContext->SetRenderTargets(1, &pRTV_A, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    EXPECT_EQ(pTextures[0]->GetState(), RESOURCE_STATE_RENDER_TARGET);
+
+    // B is not tracked and is bound without transitions: the context must still acquire its memory
+    pTextures[1]->SetState(RESOURCE_STATE_UNKNOWN);
+    pContext->ResetStats();
+    pContext->SetRenderTargets(1, &pRTV_B, nullptr, RESOURCE_STATE_TRANSITION_MODE_NONE);
+    EXPECT_GT(GetBarrierCount(pContext), 0u);
+
+    // A is in the render target state, but its memory has been taken over by B
+    pContext->ResetStats();
+    pContext->SetRenderTargets(1, &pRTV_A, nullptr, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+    EXPECT_GT(GetBarrierCount(pContext), 0u);
+    EXPECT_EQ(pTextures[0]->GetState(), RESOURCE_STATE_RENDER_TARGET);
+
+    // A already owns the memory
+    pContext->ResetStats();
+    pContext->SetRenderTargets(1, &pRTV_A, nullptr, RESOURCE_STATE_TRANSITION_MODE_NONE);
+    EXPECT_EQ(GetBarrierCount(pContext), 0u);
+
+    pContext->SetRenderTargets(0, nullptr, nullptr, RESOURCE_STATE_TRANSITION_MODE_NONE);
+    pContext->Flush();
+
+    if (pEnv->GetNumDeferredContexts() > 0)
+    {
+        // Ownership is unknown at the beginning of a command list, so the memory is acquired again
+        auto* pDeferredCtx = pEnv->GetDeferredContext(0);
+        pDeferredCtx->Begin(0);
+        pDeferredCtx->ResetStats();
+        pDeferredCtx->SetRenderTargets(1, &pRTV_A, nullptr, RESOURCE_STATE_TRANSITION_MODE_NONE);
+        EXPECT_GT(GetBarrierCount(pDeferredCtx), 0u);
+        pDeferredCtx->SetRenderTargets(0, nullptr, nullptr, RESOURCE_STATE_TRANSITION_MODE_NONE);
+
+        RefCntAutoPtr<ICommandList> pCmdList;
+        pDeferredCtx->FinishCommandList(&pCmdList);
+        ASSERT_NE(pCmdList, nullptr);
+        ICommandList* ppCmdLists[] = {pCmdList};
+        pContext->ExecuteCommandLists(1, ppCmdLists);
+        pDeferredCtx->FinishFrame();
+    }
+
+    pContext->WaitForIdle();
+
+    for (auto* pTex : pTextures)
+        pTex->Release();
+}
+
+} // namespace
@@ -0,0 +1,129 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "BasicTypes.h"
+#include "Timer.hpp"
+
+namespace Diligent
+{
+
+namespace Testing
+{
+
+/// Collects benchmark results and writes them in a machine-readable form.
+class BenchmarkReport
+{
+public:
+    struct Param
+    {
+        std::string Name;
+        Uint32      Value = 0;
+    };
+
+    struct Result
+    {
+        std::string        Name;
+        std::vector<Param> Params;
+
+        // The number of measured operations (draws, commits, maps, etc.) in one iteration
+        Uint32 OpsPerIteration = 0;
+        Uint32 NumIterations   = 0;
+        Uint32 NumRepetitions  = 0;
+
+        // Time per operation, in nanoseconds, across all repetitions
+        double MinNsPerOp    = 0;
+        double MedianNsPerOp = 0;
+        double MeanNsPerOp   = 0;
+    };
+
+    static BenchmarkReport& Get();
+
+    /// Parses benchmark command line arguments:
+    ///   --benchmark_out=<file>         - path to the JSON file to write the results to
+    ///   --benchmark_repetitions=<N>    - the number of measured repetitions of every scenario
+    ///   --benchmark_tag=<string>       - an arbitrary string (e.g. commit hash) stored in the report
+    void ParseCommandLine(int argc, char** argv);
+
+    /// Runs the benchmark scenario.
+
+    /// \param [in] Name            - Scenario name.
+    /// \param [in] Params          - Scenario parameters that are stored in the report.
+    /// \param [in] OpsPerIteration - The number of measured operations in one iteration.
+    /// \param [in] NumIterations   - The number of iterations in one repetition.
+    /// \param [in] Iteration       - Function that runs one iteration.
+    ///
+    /// \remarks    One iteration is executed before the measurements to warm up the caches.
+    template <typename IterationFuncType>
+    void Run(const char*        Name,
+             std::vector<Param> Params,
+             Uint32             OpsPerIteration,
+             Uint32             NumIterations,
+             IterationFuncType  Iteration)
+    {
+        Iteration();
+
+        std::vector<double> RepetitionTimes(m_NumRepetitions);
+        for (auto& Time : RepetitionTimes)
+        {
+            Timer T;
+            for (Uint32 i = 0; i < NumIterations; ++i)
+                Iteration();
+            Time = T.GetElapsedTime();
+        }
+
+        AddResult(Name, std::move(Params), OpsPerIteration, NumIterations, RepetitionTimes);
+    }
+
+    /// Writes the results to the file specified by --benchmark_out, if any.
+    bool Write() const;
+
+    const std::vector<Result>& GetResults() const { return m_Results; }
+
+private:
+    void AddResult(const char*                Name,
+                   std::vector<Param>&&       Params,
+                   Uint32                     OpsPerIteration,
+                   Uint32                     NumIterations,
+                   const std::vector<double>& RepetitionTimes);
+
+    std::string WriteJSON() const;
+
+    std::string m_OutputPath;
+    std::string m_Tag;
+    Uint32      m_NumRepetitions = 5;
+
+    std::vector<Result> m_Results;
+};
+
+} // namespace Testing
+
+} // namespace Diligent
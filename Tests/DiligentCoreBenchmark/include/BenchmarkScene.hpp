@@ -0,0 +1,97 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "RenderDevice.h"
+#include "DeviceContext.h"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+namespace Testing
+{
+
+/// Objects shared by the draw-submission benchmarks.
+
+/// All pipelines use the same explicit resource signature with the following resources:
+///   - cbConstants: mutable constant buffer, vertex shader
+///   - g_Texture:   mutable texture with immutable sampler, pixel shader
+/// Pipelines differ by rasterizer and blend states only, so that switching between them
+/// is a full pipeline change on every backend. Shader resource bindings reference one
+/// of the few textures in round-robin order.
+class BenchmarkScene
+{
+public:
+    BenchmarkScene(IRenderDevice* pDevice, Uint32 NumPSOs, Uint32 NumSRBs);
+
+    /// Creates a new SRB that references the given constant buffer and texture view.
+    RefCntAutoPtr<IShaderResourceBinding> CreateSRB(IBuffer* pConstants, ITextureView* pTexSRV);
+
+    /// Transitions all resources to the states required for drawing
+    /// and updates their states. Must be called by the immediate context.
+    void TransitionResources(IDeviceContext* pCtx);
+
+    /// Binds the render target. This also resets the viewport to cover the entire target.
+    void BindRenderTarget(IDeviceContext* pCtx, RESOURCE_STATE_TRANSITION_MODE TransitionMode);
+
+    Uint32 GetNumPSOs() const { return static_cast<Uint32>(m_PSOs.size()); }
+    Uint32 GetNumSRBs() const { return static_cast<Uint32>(m_SRBs.size()); }
+
+    IPipelineState*             GetPSO(Uint32 Idx) { return m_PSOs[Idx]; }
+    IShaderResourceBinding*     GetSRB(Uint32 Idx) { return m_SRBs[Idx]; }
+    IShaderResourceBinding*     GetDynamicSRB() { return m_pDynamicSRB; }
+    IPipelineResourceSignature* GetSignature() { return m_pSignature; }
+    IBuffer*                    GetConstants() { return m_pConstants; }
+    IBuffer*                    GetDynamicConstants() { return m_pDynamicConstants; }
+    ITextureView*               GetTextureSRV(Uint32 Idx) { return m_Textures[Idx % m_Textures.size()]->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE); }
+
+    bool IsValid() const { return m_IsValid; }
+
+    static constexpr Uint32 ConstantBufferSize = 256;
+
+private:
+    RefCntAutoPtr<IPipelineResourceSignature> m_pSignature;
+
+    std::vector<RefCntAutoPtr<IPipelineState>>         m_PSOs;
+    std::vector<RefCntAutoPtr<IShaderResourceBinding>> m_SRBs;
+    RefCntAutoPtr<IShaderResourceBinding>              m_pDynamicSRB;
+
+    std::vector<RefCntAutoPtr<ITexture>> m_Textures;
+    RefCntAutoPtr<ITexture>              m_pRenderTarget;
+    RefCntAutoPtr<IBuffer>               m_pConstants;
+    RefCntAutoPtr<IBuffer>               m_pDynamicConstants;
+
+    bool m_IsValid = false;
+};
+
+} // namespace Testing
+
+} // namespace Diligent
@@ -0,0 +1,206 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <string>
+#include <vector>
+
+#include "../../../Graphics/GraphicsEngine/include/PSOSerializer.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "BenchmarkReport.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr Uint32 NumIterations = 8;
+constexpr Uint32 NumPSOs       = 10000;
+
+using TPRSNames        = DeviceObjectArchiveBase::TPRSNames;
+using ShaderIndexArray = DeviceObjectArchiveBase::ShaderIndexArray;
+
+// Typical pipeline description as it is stored in the device object archive
+class SerializedPSOs
+{
+public:
+    SerializedPSOs()
+    {
+        for (Uint32 i = 0; i < _countof(m_ResNames); ++i)
+        {
+            m_ResNames[i] = "g_Resource" + std::to_string(i);
+
+            m_Resources[i].Name         = m_ResNames[i].c_str();
+            m_Resources[i].ShaderStages = SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL;
+            m_Resources[i].ArraySize    = 1 + i % 2;
+            m_Resources[i].ResourceType = static_cast<SHADER_RESOURCE_TYPE>(1 + i % 4);
+            m_Resources[i].VarType      = static_cast<SHADER_RESOURCE_VARIABLE_TYPE>(i % 3);
+
+            m_Variables[i].Name         = m_ResNames[i].c_str();
+            m_Variables[i].ShaderStages = SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL;
+            m_Variables[i].Type         = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+        }
+
+        for (Uint32 i = 0; i < _countof(m_ImmutableSamplers); ++i)
+        {
+            m_ImmutableSamplers[i].SamplerOrTextureName = m_Resources[i].Name;
+            m_ImmutableSamplers[i].ShaderStages         = SHADER_TYPE_PIXEL;
+        }
+
+        for (Uint32 i = 0; i < _countof(m_LayoutElems); ++i)
+            m_LayoutElems[i] = LayoutElement{i, 0, 4, VT_FLOAT32};
+
+        PipelineResourceSignatureDesc PRSDesc;
+        PRSDesc.Resources            = m_Resources;
+        PRSDesc.NumResources         = _countof(m_Resources);
+        PRSDesc.ImmutableSamplers    = m_ImmutableSamplers;
+        PRSDesc.NumImmutableSamplers = _countof(m_ImmutableSamplers);
+
+        GraphicsPipelineStateCreateInfo PSOCreateInfo;
+        PSOCreateInfo.PSODesc.PipelineType                        = PIPELINE_TYPE_GRAPHICS;
+        PSOCreateInfo.PSODesc.ResourceLayout.Variables            = m_Variables;
+        PSOCreateInfo.PSODesc.ResourceLayout.NumVariables         = _countof(m_Variables);
+        PSOCreateInfo.GraphicsPipeline.InputLayout.LayoutElements = m_LayoutElems;
+        PSOCreateInfo.GraphicsPipeline.InputLayout.NumElements    = _countof(m_LayoutElems);
+        PSOCreateInfo.GraphicsPipeline.NumRenderTargets           = 1;
+        PSOCreateInfo.GraphicsPipeline.RTVFormats[0]              = TEX_FORMAT_RGBA8_UNORM;
+        PSOCreateInfo.GraphicsPipeline.DSVFormat                  = TEX_FORMAT_D32_FLOAT;
+
+        TPRSNames   PRSNames{"Benchmark PRS"};
+        const char* RenderPassName = nullptr;
+
+        ShaderIndexArray Shaders{m_ShaderIndices, _countof(m_ShaderIndices)};
+
+        auto& RawAllocator = DefaultRawMemoryAllocator::GetAllocator();
+
+        Serializer<SerializerMode::Measure> MSer;
+        SerializePSO(MSer, PRSDesc, PSOCreateInfo, PRSNames, RenderPassName, Shaders);
+
+        m_Data.reserve(NumPSOs);
+        for (Uint32 i = 0; i < NumPSOs; ++i)
+        {
+            m_Data.emplace_back(MSer.AllocateData(RawAllocator));
+            Serializer<SerializerMode::Write> WSer{m_Data.back()};
+            SerializePSO(WSer, PRSDesc, PSOCreateInfo, PRSNames, RenderPassName, Shaders);
+            VERIFY_EXPR(WSer.IsEnded());
+        }
+    }
+
+    const std::vector<SerializedData>& GetData() const { return m_Data; }
+
+private:
+    template <SerializerMode Mode>
+    static void SerializePSO(Serializer<Mode>&                      Ser,
+                             const PipelineResourceSignatureDesc&   PRSDesc,
+                             const GraphicsPipelineStateCreateInfo& PSOCreateInfo,
+                             const TPRSNames&                       PRSNames,
+                             const char*                            RenderPassName,
+                             const ShaderIndexArray&                Shaders);
+
+    std::string                m_ResNames[32];
+    PipelineResourceDesc       m_Resources[32];
+    ShaderResourceVariableDesc m_Variables[32];
+    ImmutableSamplerDesc       m_ImmutableSamplers[4];
+    LayoutElement              m_LayoutElems[6];
+    Uint32                     m_ShaderIndices[2] = {0, 1};
+
+    std::vector<SerializedData> m_Data;
+};
+
+template <SerializerMode Mode>
+void SerializedPSOs::SerializePSO(Serializer<Mode>&                      Ser,
+                                  const PipelineResourceSignatureDesc&   PRSDesc,
+                                  const GraphicsPipelineStateCreateInfo& PSOCreateInfo,
+                                  const TPRSNames&                       PRSNames,
+                                  const char*                            RenderPassName,
+                                  const ShaderIndexArray&                Shaders)
+{
+    PRSSerializer<Mode>::SerializeDesc(Ser, PRSDesc, nullptr);
+    PSOSerializer<Mode>::SerializeCreateInfo(Ser, PSOCreateInfo, PRSNames, nullptr, RenderPassName);
+    PSOSerializer<Mode>::SerializeShaders(Ser, Shaders, nullptr);
+}
+
+// Unpacks resource signature and pipeline descriptions the same way the dearchiver does
+TEST(ArchiveBenchmark, UnpackPSODesc)
+{
+    const SerializedPSOs PSOs;
+
+    auto& RawAllocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    BenchmarkReport::Get().Run("UnpackPSODesc", {{"psos", NumPSOs}}, NumPSOs, NumIterations,
+                               [&]() {
+                                   for (const auto& Data : PSOs.GetData())
+                                   {
+                                       DynamicLinearAllocator Allocator{RawAllocator, 2 << 10};
+                                       Serializer<SerializerMode::Read> Ser{Data};
+
+                                       PipelineResourceSignatureDesc   PRSDesc;
+                                       GraphicsPipelineStateCreateInfo PSOCreateInfo;
+                                       TPRSNames                       PRSNames{};
+                                       const char*                     RenderPassName = nullptr;
+                                       ShaderIndexArray                Shaders;
+                                       PRSSerializer<SerializerMode::Read>::SerializeDesc(Ser, PRSDesc, &Allocator);
+                                       PSOSerializer<SerializerMode::Read>::SerializeCreateInfo(Ser, PSOCreateInfo, PRSNames, &Allocator, RenderPassName);
+                                       PSOSerializer<SerializerMode::Read>::SerializeShaders(Ser, Shaders, &Allocator);
+                                       VERIFY_EXPR(Ser.IsEnded());
+                                   }
+                               });
+}
+
+// Serializes shader byte code the same way the archiver does
+TEST(ArchiveBenchmark, SerializeBytecode)
+{
+    constexpr Uint32 NumShaders   = 10000;
+    constexpr size_t BytecodeSize = 4 << 10;
+
+    const std::vector<Uint8> Bytecode(BytecodeSize, 0x5A);
+    const char*              EntryPoint = "main";
+
+    auto& RawAllocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    Serializer<SerializerMode::Measure> MSer;
+    MSer(EntryPoint);
+    const auto Size = MSer.GetSize() + BytecodeSize;
+
+    std::vector<SerializedData> Data(NumShaders);
+    for (auto& ShaderData : Data)
+        ShaderData = SerializedData{Size, RawAllocator};
+
+    BenchmarkReport::Get().Run("SerializeBytecode", {{"shaders", NumShaders}, {"size", static_cast<Uint32>(BytecodeSize)}}, NumShaders, NumIterations,
+                               [&]() {
+                                   for (auto& ShaderData : Data)
+                                   {
+                                       Serializer<SerializerMode::Write> Ser{ShaderData};
+                                       Ser(EntryPoint);
+                                       Ser.SerializeBytes(Bytecode.data(), Bytecode.size());
+                                       VERIFY_EXPR(Ser.IsEnded());
+                                   }
+                               });
+}
+
+} // namespace
@@ -0,0 +1,236 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BenchmarkReport.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+
+#include "APIInfo.h"
+#include "TestingEnvironment.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace Testing
+{
+
+namespace
+{
+
+const char* GetDeviceTypeString(RENDER_DEVICE_TYPE Type)
+{
+    static_assert(RENDER_DEVICE_TYPE_COUNT == 8, "Please update the switch below to handle the new device type");
+    switch (Type)
+    {
+        // clang-format off
+        case RENDER_DEVICE_TYPE_D3D11:  return "d3d11";
+        case RENDER_DEVICE_TYPE_D3D12:  return "d3d12";
+        case RENDER_DEVICE_TYPE_GL:     return "gl";
+        case RENDER_DEVICE_TYPE_GLES:   return "gles";
+        case RENDER_DEVICE_TYPE_VULKAN: return "vk";
+        case RENDER_DEVICE_TYPE_METAL:  return "mtl";
+        case RENDER_DEVICE_TYPE_NULL:   return "null";
+        // clang-format on
+        default:
+            return "undefined";
+    }
+}
+
+const char* GetBuildConfigString()
+{
+#if defined(DILIGENT_DEBUG)
+    return "debug";
+#elif defined(DILIGENT_DEVELOPMENT)
+    return "development";
+#else
+    return "release";
+#endif
+}
+
+std::string EscapeJSONString(const char* Str)
+{
+    std::string Escaped;
+    for (const char* c = Str; *c != '\0'; ++c)
+    {
+        switch (*c)
+        {
+            case '"': Escaped += "\\\""; break;
+            case '\\': Escaped += "\\\\"; break;
+            case '\n': Escaped += "\\n"; break;
+            case '\r': Escaped += "\\r"; break;
+            case '\t': Escaped += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(*c) >= 0x20)
+                    Escaped += *c;
+        }
+    }
+    return Escaped;
+}
+
+} // namespace
+
+BenchmarkReport& BenchmarkReport::Get()
+{
+    static BenchmarkReport TheReport;
+    return TheReport;
+}
+
+void BenchmarkReport::ParseCommandLine(int argc, char** argv)
+{
+    static constexpr char OutArgName[]         = "--benchmark_out=";
+    static constexpr char RepetitionsArgName[] = "--benchmark_repetitions=";
+    static constexpr char TagArgName[]         = "--benchmark_tag=";
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const auto* arg = argv[i];
+        if (strncmp(arg, OutArgName, _countof(OutArgName) - 1) == 0)
+        {
+            m_OutputPath = arg + _countof(OutArgName) - 1;
+        }
+        else if (strncmp(arg, RepetitionsArgName, _countof(RepetitionsArgName) - 1) == 0)
+        {
+            m_NumRepetitions = std::max(atoi(arg + _countof(RepetitionsArgName) - 1), 1);
+        }
+        else if (strncmp(arg, TagArgName, _countof(TagArgName) - 1) == 0)
+        {
+            m_Tag = arg + _countof(TagArgName) - 1;
+        }
+    }
+}
+
+void BenchmarkReport::AddResult(const char*                Name,
+                                std::vector<Param>&&       Params,
+                                Uint32                     OpsPerIteration,
+                                Uint32                     NumIterations,
+                                const std::vector<double>& RepetitionTimes)
+{
+    VERIFY_EXPR(!RepetitionTimes.empty() && OpsPerIteration > 0 && NumIterations > 0);
+
+    const double NumOps = static_cast<double>(OpsPerIteration) * static_cast<double>(NumIterations);
+
+    std::vector<double> NsPerOp(RepetitionTimes.size());
+    for (size_t i = 0; i < RepetitionTimes.size(); ++i)
+        NsPerOp[i] = RepetitionTimes[i] * 1e+9 / NumOps;
+    std::sort(NsPerOp.begin(), NsPerOp.end());
+
+    Result Res;
+    Res.Name            = Name;
+    Res.Params          = std::move(Params);
+    Res.OpsPerIteration = OpsPerIteration;
+    Res.NumIterations   = NumIterations;
+    Res.NumRepetitions  = static_cast<Uint32>(NsPerOp.size());
+    Res.MinNsPerOp      = NsPerOp.front();
+    Res.MedianNsPerOp   = NsPerOp.size() % 2 != 0 ?
+        NsPerOp[NsPerOp.size() / 2] :
+        (NsPerOp[NsPerOp.size() / 2 - 1] + NsPerOp[NsPerOp.size() / 2]) * 0.5;
+    Res.MeanNsPerOp = std::accumulate(NsPerOp.begin(), NsPerOp.end(), 0.0) / static_cast<double>(NsPerOp.size());
+
+    std::stringstream ss;
+    ss << Res.Name;
+    for (const auto& P : Res.Params)
+        ss << ' ' << P.Name << '=' << P.Value;
+    ss << ": " << std::fixed << std::setprecision(1) << Res.MedianNsPerOp << " ns/op (min " << Res.MinNsPerOp << "), "
+       << std::setprecision(3) << 1e+3 / Res.MedianNsPerOp << " M ops/s";
+    std::cout << "\033[0;36m[  BENCH   ]\033[0;0m " << ss.str() << std::endl;
+
+    m_Results.emplace_back(std::move(Res));
+}
+
+std::string BenchmarkReport::WriteJSON() const
+{
+    std::stringstream ss;
+    ss << std::setprecision(6) << std::fixed;
+
+    ss << "{\n"
+       << "  \"context\": {\n"
+       << "    \"api_version\": " << DILIGENT_API_VERSION << ",\n"
+       << "    \"build_config\": \"" << GetBuildConfigString() << "\",\n";
+    if (auto* pEnv = TestingEnvironment::GetInstance())
+    {
+        const auto& DeviceInfo  = pEnv->GetDevice()->GetDeviceInfo();
+        const auto& AdapterInfo = pEnv->GetDevice()->GetAdapterInfo();
+        ss << "    \"device_type\": \"" << GetDeviceTypeString(DeviceInfo.Type) << "\",\n"
+           << "    \"adapter\": \"" << EscapeJSONString(AdapterInfo.Description) << "\",\n";
+    }
+    ss << "    \"tag\": \"" << EscapeJSONString(m_Tag.c_str()) << "\"\n"
+       << "  },\n"
+       << "  \"benchmarks\": [";
+
+    for (size_t i = 0; i < m_Results.size(); ++i)
+    {
+        const auto& Res = m_Results[i];
+        ss << (i > 0 ? ",\n" : "\n")
+           << "    {\n"
+           << "      \"name\": \"" << EscapeJSONString(Res.Name.c_str()) << "\",\n"
+           << "      \"params\": {";
+        for (size_t p = 0; p < Res.Params.size(); ++p)
+            ss << (p > 0 ? ", " : "") << '"' << EscapeJSONString(Res.Params[p].Name.c_str()) << "\": " << Res.Params[p].Value;
+        ss << "},\n"
+           << "      \"ops_per_iteration\": " << Res.OpsPerIteration << ",\n"
+           << "      \"iterations\": " << Res.NumIterations << ",\n"
+           << "      \"repetitions\": " << Res.NumRepetitions << ",\n"
+           << "      \"ns_per_op_min\": " << Res.MinNsPerOp << ",\n"
+           << "      \"ns_per_op_median\": " << Res.MedianNsPerOp << ",\n"
+           << "      \"ns_per_op_mean\": " << Res.MeanNsPerOp << ",\n"
+           << "      \"ops_per_second\": " << 1e+9 / Res.MedianNsPerOp << "\n"
+           << "    }";
+    }
+    ss << "\n  ]\n"
+       << "}\n";
+
+    return ss.str();
+}
+
+bool BenchmarkReport::Write() const
+{
+    if (m_OutputPath.empty())
+        return true;
+
+    std::ofstream File{m_OutputPath, std::ios::out | std::ios::trunc};
+    if (!File)
+    {
+        LOG_ERROR_MESSAGE("Failed to open benchmark output file '", m_OutputPath, "'");
+        return false;
+    }
+
+    File << WriteJSON();
+    std::cout << "Benchmark results were written to '" << m_OutputPath << "'\n";
+
+    return File.good();
+}
+
+} // namespace Testing
+
+} // namespace Diligent
@@ -0,0 +1,278 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BenchmarkScene.hpp"
+
+#include <array>
+
+#include "TestingEnvironment.hpp"
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+namespace Testing
+{
+
+namespace
+{
+
+// clang-format off
+const char* VSSource = R"(
+cbuffer cbConstants
+{
+    float4 g_Offset;
+}
+
+struct PSInput
+{
+    float4 Pos : SV_POSITION;
+    float2 UV  : TEX_COORD;
+};
+
+void main(in uint VertId : SV_VertexID,
+          out PSInput PSIn)
+{
+    float2 UV[3];
+    UV[0] = float2(0.0, 0.0);
+    UV[1] = float2(1.0, 0.0);
+    UV[2] = float2(0.0, 1.0);
+
+    PSIn.UV  = UV[VertId % 3u];
+    PSIn.Pos = float4(PSIn.UV * 0.125 + g_Offset.xy, 0.0, 1.0);
+}
+)";
+
+const char* PSSource = R"(
+Texture2D    g_Texture;
+SamplerState g_Texture_sampler;
+
+struct PSInput
+{
+    float4 Pos : SV_POSITION;
+    float2 UV  : TEX_COORD;
+};
+
+float4 main(in PSInput PSIn) : SV_Target
+{
+    return g_Texture.Sample(g_Texture_sampler, PSIn.UV);
+}
+)";
+// clang-format on
+
+constexpr Uint32         NumTextures        = 4;
+constexpr Uint32         TextureDim         = 16;
+constexpr Uint32         RenderTargetDim    = 256;
+constexpr TEXTURE_FORMAT RenderTargetFormat = TEX_FORMAT_RGBA8_UNORM;
+
+} // namespace
+
+BenchmarkScene::BenchmarkScene(IRenderDevice* pDevice, Uint32 NumPSOs, Uint32 NumSRBs)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+
+    {
+        const PipelineResourceDesc Resources[] = //
+            {
+                {SHADER_TYPE_VERTEX, "cbConstants", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+                {SHADER_TYPE_PIXEL, "g_Texture", 1, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE} //
+            };
+        const ImmutableSamplerDesc ImmutableSamplers[] = //
+            {
+                {SHADER_TYPE_PIXEL, "g_Texture", SamplerDesc{}} //
+            };
+
+        PipelineResourceSignatureDesc PRSDesc;
+        PRSDesc.Name                       = "Benchmark signature";
+        PRSDesc.Resources                  = Resources;
+        PRSDesc.NumResources               = _countof(Resources);
+        PRSDesc.ImmutableSamplers          = ImmutableSamplers;
+        PRSDesc.NumImmutableSamplers       = _countof(ImmutableSamplers);
+        PRSDesc.UseCombinedTextureSamplers = true;
+
+        pDevice->CreatePipelineResourceSignature(PRSDesc, &m_pSignature);
+        if (!m_pSignature)
+            return;
+    }
+
+    RefCntAutoPtr<IShader> pVS, pPS;
+    {
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+        ShaderCI.UseCombinedTextureSamplers = true;
+
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_VERTEX;
+        ShaderCI.Desc.Name       = "Benchmark VS";
+        ShaderCI.Source          = VSSource;
+        pDevice->CreateShader(ShaderCI, &pVS);
+
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+        ShaderCI.Desc.Name       = "Benchmark PS";
+        ShaderCI.Source          = PSSource;
+        pDevice->CreateShader(ShaderCI, &pPS);
+
+        if (!pVS || !pPS)
+            return;
+    }
+
+    m_PSOs.resize(NumPSOs);
+    for (Uint32 i = 0; i < NumPSOs; ++i)
+    {
+        const std::string Name = "Benchmark PSO " + std::to_string(i);
+
+        GraphicsPipelineStateCreateInfo PSOCreateInfo;
+
+        IPipelineResourceSignature* ppSignatures[] = {m_pSignature};
+        PSOCreateInfo.ppResourceSignatures         = ppSignatures;
+        PSOCreateInfo.ResourceSignaturesCount      = _countof(ppSignatures);
+
+        auto& PSODesc          = PSOCreateInfo.PSODesc;
+        auto& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+        PSODesc.Name = Name.c_str();
+
+        GraphicsPipeline.NumRenderTargets             = 1;
+        GraphicsPipeline.RTVFormats[0]                = RenderTargetFormat;
+        GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+        // Make every pipeline unique so that the drivers can't merge them
+        static constexpr std::array<CULL_MODE, 3> CullModes = {CULL_MODE_NONE, CULL_MODE_BACK, CULL_MODE_FRONT};
+
+        const auto Variant = i / static_cast<Uint32>(CullModes.size());
+        auto&      RTBlend = GraphicsPipeline.BlendDesc.RenderTargets[0];
+
+        GraphicsPipeline.RasterizerDesc.CullMode  = CullModes[i % CullModes.size()];
+        GraphicsPipeline.RasterizerDesc.DepthBias = static_cast<Int32>(Variant / 4);
+        RTBlend.BlendEnable                       = (Variant & 0x01) != 0;
+        RTBlend.RenderTargetWriteMask             = (Variant & 0x02) != 0 ? COLOR_MASK_ALL & ~COLOR_MASK_ALPHA : COLOR_MASK_ALL;
+
+        PSOCreateInfo.pVS = pVS;
+        PSOCreateInfo.pPS = pPS;
+
+        pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &m_PSOs[i]);
+        if (!m_PSOs[i])
+            return;
+    }
+
+    m_Textures.resize(NumTextures);
+    for (Uint32 i = 0; i < NumTextures; ++i)
+    {
+        std::vector<Uint32> Data(TextureDim * TextureDim, 0xFF000000u | (0x3Fu << (i * 8)));
+
+        const std::string Name = "Benchmark texture " + std::to_string(i);
+
+        TextureDesc TexDesc;
+        TexDesc.Name      = Name.c_str();
+        TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+        TexDesc.Width     = TextureDim;
+        TexDesc.Height    = TextureDim;
+        TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+        TexDesc.Usage     = USAGE_IMMUTABLE;
+        TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+
+        TextureSubResData Mip0Data{Data.data(), TextureDim * sizeof(Uint32)};
+        TextureData       TexData{&Mip0Data, 1};
+        pDevice->CreateTexture(TexDesc, &TexData, &m_Textures[i]);
+        if (!m_Textures[i])
+            return;
+    }
+
+    m_pRenderTarget = pEnv->CreateTexture("Benchmark render target", RenderTargetFormat, BIND_RENDER_TARGET, RenderTargetDim, RenderTargetDim);
+    if (!m_pRenderTarget)
+        return;
+
+    {
+        const std::vector<Uint8> InitData(ConstantBufferSize);
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Benchmark constants";
+        BuffDesc.Size      = ConstantBufferSize;
+        BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+        BuffDesc.Usage     = USAGE_DEFAULT;
+
+        BufferData BuffData{InitData.data(), ConstantBufferSize};
+        pDevice->CreateBuffer(BuffDesc, &BuffData, &m_pConstants);
+        if (!m_pConstants)
+            return;
+
+        BuffDesc.Name           = "Benchmark dynamic constants";
+        BuffDesc.Usage          = USAGE_DYNAMIC;
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &m_pDynamicConstants);
+        if (!m_pDynamicConstants)
+            return;
+    }
+
+    m_SRBs.resize(NumSRBs);
+    for (Uint32 i = 0; i < NumSRBs; ++i)
+    {
+        m_SRBs[i] = CreateSRB(m_pConstants, GetTextureSRV(i));
+        if (!m_SRBs[i])
+            return;
+    }
+
+    m_pDynamicSRB = CreateSRB(m_pDynamicConstants, GetTextureSRV(0));
+    if (!m_pDynamicSRB)
+        return;
+
+    m_IsValid = true;
+}
+
+RefCntAutoPtr<IShaderResourceBinding> BenchmarkScene::CreateSRB(IBuffer* pConstants, ITextureView* pTexSRV)
+{
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    m_pSignature->CreateShaderResourceBinding(&pSRB);
+    if (pSRB)
+    {
+        pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "cbConstants")->Set(pConstants);
+        pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Texture")->Set(pTexSRV);
+    }
+    return pSRB;
+}
+
+void BenchmarkScene::TransitionResources(IDeviceContext* pCtx)
+{
+    std::vector<StateTransitionDesc> Barriers;
+    for (auto& pTex : m_Textures)
+        Barriers.emplace_back(pTex, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE);
+    Barriers.emplace_back(m_pRenderTarget, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_RENDER_TARGET, STATE_TRANSITION_FLAG_UPDATE_STATE);
+    Barriers.emplace_back(m_pConstants, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_CONSTANT_BUFFER, STATE_TRANSITION_FLAG_UPDATE_STATE);
+    Barriers.emplace_back(m_pDynamicConstants, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_CONSTANT_BUFFER, STATE_TRANSITION_FLAG_UPDATE_STATE);
+    pCtx->TransitionResourceStates(static_cast<Uint32>(Barriers.size()), Barriers.data());
+}
+
+void BenchmarkScene::BindRenderTarget(IDeviceContext* pCtx, RESOURCE_STATE_TRANSITION_MODE TransitionMode)
+{
+    ITextureView* pRTVs[] = {m_pRenderTarget->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET)};
+    pCtx->SetRenderTargets(_countof(pRTVs), pRTVs, nullptr, TransitionMode);
+}
+
+} // namespace Testing
+
+} // namespace Diligent
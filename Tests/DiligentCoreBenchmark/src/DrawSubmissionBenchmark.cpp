@@ -0,0 +1,367 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "TestingEnvironment.hpp"
+#include "BenchmarkReport.hpp"
+#include "BenchmarkScene.hpp"
+#include "ThreadSignal.hpp"
+#include "MapHelper.hpp"
+#include "DeferredContextPool.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr Uint32 DrawsPerFrame = 1024;
+constexpr Uint32 NumFrames     = 64;
+
+// Draws NumPSOs x NumSRBs x NumDraws triangles
+void RecordDraws(IDeviceContext* pCtx, BenchmarkScene& Scene, Uint32 NumPSOs, Uint32 NumSRBs, Uint32 NumDraws)
+{
+    const DrawAttribs DrawAttrs{3, DRAW_FLAG_NONE};
+    for (Uint32 pso = 0; pso < NumPSOs; ++pso)
+    {
+        pCtx->SetPipelineState(Scene.GetPSO(pso));
+        for (Uint32 srb = 0; srb < NumSRBs; ++srb)
+        {
+            pCtx->CommitShaderResources(Scene.GetSRB(srb), RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+            for (Uint32 draw = 0; draw < NumDraws; ++draw)
+                pCtx->Draw(DrawAttrs);
+        }
+    }
+}
+
+void EndFrame(IDeviceContext* pCtx)
+{
+    pCtx->Flush();
+    pCtx->FinishFrame();
+}
+
+// N PSOs x M SRBs x K draws per frame. Every configuration issues the same number
+// of draws, so the results show the cost of state changes relative to the draws.
+TEST(DrawSubmissionBenchmark, Draw)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+    auto* pCtx = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    struct Config
+    {
+        Uint32 NumPSOs;
+        Uint32 NumSRBs;
+        Uint32 NumDraws;
+    };
+    static constexpr std::array<Config, 4> Configs = //
+        {
+            Config{1, 1, 1024},
+            Config{4, 16, 16},
+            Config{8, 128, 1},
+            Config{16, 64, 1} //
+        };
+
+    for (const auto& Cfg : Configs)
+    {
+        VERIFY_EXPR(Cfg.NumPSOs * Cfg.NumSRBs * Cfg.NumDraws == DrawsPerFrame);
+
+        BenchmarkScene Scene{pEnv->GetDevice(), Cfg.NumPSOs, Cfg.NumSRBs};
+        ASSERT_TRUE(Scene.IsValid());
+        Scene.TransitionResources(pCtx);
+
+        BenchmarkReport::Get().Run("Draw", {{"psos", Cfg.NumPSOs}, {"srbs", Cfg.NumSRBs}, {"draws", Cfg.NumDraws}}, DrawsPerFrame, NumFrames,
+                                   [&]() {
+                                       Scene.BindRenderTarget(pCtx, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+                                       RecordDraws(pCtx, Scene, Cfg.NumPSOs, Cfg.NumSRBs, Cfg.NumDraws);
+                                       EndFrame(pCtx);
+                                   });
+    }
+}
+
+// Switches the pipeline before every draw
+TEST(DrawSubmissionBenchmark, SetPipelineState)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+    auto* pCtx = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 NumPSOs = 16;
+
+    BenchmarkScene Scene{pEnv->GetDevice(), NumPSOs, 1};
+    ASSERT_TRUE(Scene.IsValid());
+    Scene.TransitionResources(pCtx);
+
+    const DrawAttribs DrawAttrs{3, DRAW_FLAG_NONE};
+    BenchmarkReport::Get().Run("SetPipelineState", {{"psos", NumPSOs}}, DrawsPerFrame, NumFrames,
+                               [&]() {
+                                   Scene.BindRenderTarget(pCtx, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+                                   for (Uint32 i = 0; i < DrawsPerFrame; ++i)
+                                   {
+                                       pCtx->SetPipelineState(Scene.GetPSO(i % NumPSOs));
+                                       // Resources only need to be committed once as all pipelines share the signature
+                                       if (i == 0)
+                                           pCtx->CommitShaderResources(Scene.GetSRB(0), RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+                                       pCtx->Draw(DrawAttrs);
+                                   }
+                                   EndFrame(pCtx);
+                               });
+}
+
+// Updates the dynamic constant buffer with MAP_FLAG_DISCARD before every draw
+TEST(DrawSubmissionBenchmark, DynamicUniformDraw)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+    auto* pCtx = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    BenchmarkScene Scene{pEnv->GetDevice(), 1, 1};
+    ASSERT_TRUE(Scene.IsValid());
+    Scene.TransitionResources(pCtx);
+
+    auto* pDynamicCB = Scene.GetDynamicConstants();
+
+    const DrawAttribs DrawAttrs{3, DRAW_FLAG_NONE};
+    BenchmarkReport::Get().Run("DynamicUniformDraw", {{"size", BenchmarkScene::ConstantBufferSize}}, DrawsPerFrame, NumFrames,
+                               [&]() {
+                                   Scene.BindRenderTarget(pCtx, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+                                   pCtx->SetPipelineState(Scene.GetPSO(0));
+                                   for (Uint32 i = 0; i < DrawsPerFrame; ++i)
+                                   {
+                                       {
+                                           MapHelper<float> Constants{pCtx, pDynamicCB, MAP_WRITE, MAP_FLAG_DISCARD};
+                                           Constants[0] = static_cast<float>(i % 8) * 0.25f - 1.f;
+                                           Constants[1] = static_cast<float>(i / 8 % 8) * 0.25f - 1.f;
+                                       }
+                                       // Dynamic buffers do not need to be recommitted after the update
+                                       if (i == 0)
+                                           pCtx->CommitShaderResources(Scene.GetDynamicSRB(), RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+                                       pCtx->Draw(DrawAttrs);
+                                   }
+                                   EndFrame(pCtx);
+                               });
+}
+
+// Submits 10k draws that share one PSO and SRB either one by one or with a single
+// MultiDraw command. An operation is the whole batch, so the results show CPU time per 10k draws.
+TEST(DrawSubmissionBenchmark, MultiDraw)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+    auto* pCtx = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 NumDraws = 10000;
+
+    BenchmarkScene Scene{pEnv->GetDevice(), 1, 1};
+    ASSERT_TRUE(Scene.IsValid());
+    Scene.TransitionResources(pCtx);
+
+    std::vector<MultiDrawItem> DrawItems(NumDraws);
+    for (auto& Item : DrawItems)
+        Item.NumVertices = 3;
+
+    for (Uint32 Verify = 0; Verify < 2; ++Verify)
+    {
+        const DRAW_FLAGS Flags = Verify != 0 ? DRAW_FLAG_VERIFY_ALL : DRAW_FLAG_NONE;
+        for (Uint32 Multi = 0; Multi < 2; ++Multi)
+        {
+            BenchmarkReport::Get().Run("MultiDraw", {{"multi", Multi}, {"verify", Verify}, {"draws", NumDraws}}, 1, NumFrames / 4,
+                                       [&]() {
+                                           Scene.BindRenderTarget(pCtx, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+                                           pCtx->SetPipelineState(Scene.GetPSO(0));
+                                           pCtx->CommitShaderResources(Scene.GetSRB(0), RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+                                           if (Multi != 0)
+                                           {
+                                               pCtx->MultiDraw({NumDraws, DrawItems.data(), Flags});
+                                           }
+                                           else
+                                           {
+                                               const DrawAttribs DrawAttrs{3, Flags};
+                                               for (Uint32 i = 0; i < NumDraws; ++i)
+                                                   pCtx->Draw(DrawAttrs);
+                                           }
+                                           EndFrame(pCtx);
+                                       });
+        }
+    }
+}
+
+// Records draw commands in multiple deferred contexts in parallel and executes
+// them in the immediate context. Thread start-up time is included in the measurement.
+TEST(DrawSubmissionBenchmark, DeferredRecording)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+    if (pEnv->GetNumDeferredContexts() == 0)
+    {
+        GTEST_SKIP() << "Deferred contexts are not supported by this device";
+    }
+
+    auto* pImmediateCtx = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 NumPSOs  = 4;
+    constexpr Uint32 NumSRBs  = 16;
+    constexpr Uint32 NumDraws = DrawsPerFrame / (NumPSOs * NumSRBs);
+
+    BenchmarkScene Scene{pEnv->GetDevice(), NumPSOs, NumSRBs};
+    ASSERT_TRUE(Scene.IsValid());
+    Scene.TransitionResources(pImmediateCtx);
+
+    const Uint32 NumThreads = static_cast<Uint32>(std::min(pEnv->GetNumDeferredContexts(), size_t{4}));
+
+    std::vector<std::thread>                 WorkerThreads(NumThreads);
+    std::vector<RefCntAutoPtr<ICommandList>> CmdLists(NumThreads);
+    std::vector<ICommandList*>               CmdListPtrs(NumThreads);
+
+    BenchmarkReport::Get().Run(
+        "DeferredRecording", {{"threads", NumThreads}, {"psos", NumPSOs}, {"srbs", NumSRBs}, {"draws", NumDraws}}, DrawsPerFrame * NumThreads, NumFrames / 4,
+        [&]() {
+            std::atomic<Uint32>    NumCmdListsReady{0};
+            ThreadingTools::Signal FinishFrameSignal;
+            ThreadingTools::Signal ExecuteCommandListsSignal;
+            for (Uint32 i = 0; i < NumThreads; ++i)
+            {
+                WorkerThreads[i] = std::thread(
+                    [&](Uint32 thread_id) //
+                    {
+                        auto* pCtx = pEnv->GetDeferredContext(thread_id);
+
+                        pCtx->Begin(0);
+                        Scene.BindRenderTarget(pCtx, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+                        RecordDraws(pCtx, Scene, NumPSOs, NumSRBs, NumDraws);
+                        pCtx->FinishCommandList(&CmdLists[thread_id]);
+                        CmdListPtrs[thread_id] = CmdLists[thread_id];
+
+                        const auto NumReadyLists = NumCmdListsReady.fetch_add(1) + 1;
+                        if (NumReadyLists == NumThreads)
+                            ExecuteCommandListsSignal.Trigger();
+
+                        FinishFrameSignal.Wait(true, NumThreads);
+
+                        // In Metal backend FinishFrame must be called from the same
+                        // thread that issued rendering commands.
+                        pCtx->FinishFrame();
+                    },
+                    i);
+            }
+
+            ExecuteCommandListsSignal.Wait(true, 1);
+
+            pImmediateCtx->ExecuteCommandLists(NumThreads, CmdListPtrs.data());
+
+            FinishFrameSignal.Trigger(true);
+            for (auto& t : WorkerThreads)
+                t.join();
+
+            for (auto& pCmdList : CmdLists)
+                pCmdList.Release();
+
+            EndFrame(pImmediateCtx);
+        });
+}
+
+// Records a fixed amount of work split into jobs that worker threads take from
+// the deferred context pool. The results show how recording scales with the number of threads.
+TEST(DrawSubmissionBenchmark, DeferredContextPool)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+    if (pEnv->GetNumDeferredContexts() == 0)
+    {
+        GTEST_SKIP() << "Deferred contexts are not supported by this device";
+    }
+    if (pEnv->GetDevice()->GetDeviceInfo().IsMetalDevice())
+    {
+        GTEST_SKIP() << "Deferred context pool is not supported in Metal backend";
+    }
+
+    auto* pImmediateCtx = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 NumPSOs  = 4;
+    constexpr Uint32 NumSRBs  = 16;
+    constexpr Uint32 NumJobs  = 16;
+    constexpr Uint32 NumDraws = DrawsPerFrame / (NumPSOs * NumSRBs);
+
+    BenchmarkScene Scene{pEnv->GetDevice(), NumPSOs, NumSRBs};
+    ASSERT_TRUE(Scene.IsValid());
+    Scene.TransitionResources(pImmediateCtx);
+
+    const auto NumContexts = static_cast<Uint32>(pEnv->GetNumDeferredContexts());
+
+    std::vector<IDeviceContext*> DeferredContexts(NumContexts);
+    for (Uint32 i = 0; i < NumContexts; ++i)
+        DeferredContexts[i] = pEnv->GetDeferredContext(i);
+
+    DeferredContextPoolCreateInfo PoolCI;
+    PoolCI.pImmediateContext   = pImmediateCtx;
+    PoolCI.ppDeferredContexts  = DeferredContexts.data();
+    PoolCI.NumDeferredContexts = NumContexts;
+    DeferredContextPool Pool{PoolCI};
+
+    for (Uint32 NumThreads = 1; NumThreads <= NumContexts; NumThreads *= 2)
+    {
+        std::vector<std::thread> WorkerThreads(NumThreads);
+        BenchmarkReport::Get().Run(
+            "DeferredContextPool", {{"threads", NumThreads}, {"jobs", NumJobs}, {"draws", DrawsPerFrame}}, DrawsPerFrame * NumJobs, NumFrames / 4,
+            [&]() {
+                std::atomic<Uint32> NextJob{0};
+                for (auto& Thread : WorkerThreads)
+                {
+                    Thread = std::thread(
+                        [&]() //
+                        {
+                            for (auto Job = NextJob.fetch_add(1); Job < NumJobs; Job = NextJob.fetch_add(1))
+                            {
+                                auto* pCtx = Pool.Begin();
+                                Scene.BindRenderTarget(pCtx, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+                                RecordDraws(pCtx, Scene, NumPSOs, NumSRBs, NumDraws);
+                                Pool.Finish(pCtx, Job);
+                            }
+                        });
+                }
+                for (auto& Thread : WorkerThreads)
+                    Thread.join();
+
+                Pool.Submit();
+                EndFrame(pImmediateCtx);
+            });
+    }
+}
+
+} // namespace
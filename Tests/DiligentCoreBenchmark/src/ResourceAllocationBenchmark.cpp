@@ -0,0 +1,100 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <thread>
+#include <vector>
+
+#include "TestingEnvironment.hpp"
+#include "BenchmarkReport.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr Uint32 NumIterations = 16;
+
+// Creates and releases buffers of varying sizes on multiple threads. Every thread keeps
+// a window of live buffers, so that allocations and releases are interleaved the
+// same way they are when resources are streamed. Thread start-up time is included in the measurement.
+TEST(ResourceAllocationBenchmark, CreateBuffers)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    auto* pCtx    = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 NumBuffersPerThread = 1024;
+    constexpr Uint32 NumLiveBuffers      = 64;
+    // Mostly small buffers with an occasional large one
+    constexpr Uint32 BufferSizes[] = {256, 1 << 10, 4 << 10, 16 << 10, 256, 64 << 10, 1 << 10, 1 << 20};
+
+    for (Uint32 NumThreads = 1; NumThreads <= 4; NumThreads *= 2)
+    {
+        std::vector<std::thread> WorkerThreads(NumThreads);
+        BenchmarkReport::Get().Run(
+            "CreateBuffers", {{"threads", NumThreads}, {"buffers", NumBuffersPerThread}}, NumBuffersPerThread * NumThreads, NumIterations,
+            [&]() {
+                for (Uint32 i = 0; i < NumThreads; ++i)
+                {
+                    WorkerThreads[i] = std::thread(
+                        [&](Uint32 thread_id) //
+                        {
+                            std::vector<RefCntAutoPtr<IBuffer>> Buffers(NumLiveBuffers);
+                            for (Uint32 buff = 0; buff < NumBuffersPerThread; ++buff)
+                            {
+                                BufferDesc BuffDesc;
+                                BuffDesc.Name      = "Allocation benchmark buffer";
+                                BuffDesc.Size      = BufferSizes[(buff + thread_id) % _countof(BufferSizes)];
+                                BuffDesc.Usage     = USAGE_DEFAULT;
+                                BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+
+                                // Releases the buffer created NumLiveBuffers iterations ago
+                                auto& pBuffer = Buffers[(buff * 7) % NumLiveBuffers];
+                                pBuffer.Release();
+                                pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+                                VERIFY_EXPR(pBuffer);
+                            }
+                        },
+                        i);
+                }
+                for (auto& Thread : WorkerThreads)
+                    Thread.join();
+
+                // Released resources are recycled when the frame is finished
+                pCtx->Flush();
+                pCtx->FinishFrame();
+                pDevice->ReleaseStaleResources();
+            });
+    }
+}
+
+} // namespace
@@ -0,0 +1,321 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "TestingEnvironment.hpp"
+#include "BenchmarkReport.hpp"
+#include "BenchmarkScene.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr Uint32 NumFrames = 64;
+
+// Commits shader resource bindings without drawing
+TEST(ResourceBindingBenchmark, CommitShaderResources)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+    auto* pCtx = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 NumSRBs    = 64;
+    constexpr Uint32 NumCommits = 1024;
+
+    BenchmarkScene Scene{pEnv->GetDevice(), 1, NumSRBs};
+    ASSERT_TRUE(Scene.IsValid());
+    Scene.TransitionResources(pCtx);
+
+    for (auto TransitionMode : {RESOURCE_STATE_TRANSITION_MODE_VERIFY, RESOURCE_STATE_TRANSITION_MODE_TRANSITION})
+    {
+        BenchmarkReport::Get().Run("CommitShaderResources", {{"srbs", NumSRBs}, {"transition", TransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION ? 1u : 0u}}, NumCommits, NumFrames,
+                                   [&]() {
+                                       pCtx->SetPipelineState(Scene.GetPSO(0));
+                                       for (Uint32 i = 0; i < NumCommits; ++i)
+                                           pCtx->CommitShaderResources(Scene.GetSRB(i % NumSRBs), TransitionMode);
+                                       pCtx->Flush();
+                                       pCtx->FinishFrame();
+                                   });
+    }
+}
+
+// Commits shader resource bindings with dynamic variables. In Vulkan, this writes a new
+// descriptor set or pushes the descriptors to the command buffer on every commit.
+TEST(ResourceBindingBenchmark, CommitDynamicResources)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    auto* pCtx    = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 NumSRBs     = 64;
+    constexpr Uint32 NumCommits  = 1024;
+    constexpr Uint32 NumTextures = 4;
+
+    BenchmarkScene Scene{pDevice, 1, 1};
+    ASSERT_TRUE(Scene.IsValid());
+    Scene.TransitionResources(pCtx);
+
+    // Buffers with dynamic offsets prevent the use of push descriptors in Vulkan
+    for (auto CBFlags : {PIPELINE_RESOURCE_FLAG_NONE, PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS})
+    {
+        const PipelineResourceDesc Resources[] = //
+            {
+                {SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, "cbConstants", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC, CBFlags},
+                {SHADER_TYPE_PIXEL, "g_Textures", NumTextures, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC} //
+            };
+
+        PipelineResourceSignatureDesc PRSDesc;
+        PRSDesc.Name         = "Commit dynamic resources benchmark signature";
+        PRSDesc.Resources    = Resources;
+        PRSDesc.NumResources = _countof(Resources);
+
+        RefCntAutoPtr<IPipelineResourceSignature> pSignature;
+        pDevice->CreatePipelineResourceSignature(PRSDesc, &pSignature);
+        ASSERT_TRUE(pSignature);
+
+        std::vector<RefCntAutoPtr<IShaderResourceBinding>> SRBs(NumSRBs);
+        for (Uint32 i = 0; i < NumSRBs; ++i)
+        {
+            pSignature->CreateShaderResourceBinding(&SRBs[i]);
+            ASSERT_TRUE(SRBs[i]);
+
+            IDeviceObject* pSRVs[NumTextures] = {};
+            for (Uint32 t = 0; t < NumTextures; ++t)
+                pSRVs[t] = Scene.GetTextureSRV(i + t);
+            SRBs[i]->GetVariableByName(SHADER_TYPE_VERTEX, "cbConstants")->Set(Scene.GetConstants());
+            SRBs[i]->GetVariableByName(SHADER_TYPE_PIXEL, "g_Textures")->SetArray(pSRVs, 0, NumTextures);
+        }
+
+        const auto DynamicBuffers = CBFlags == PIPELINE_RESOURCE_FLAG_NONE ? 1u : 0u;
+        BenchmarkReport::Get().Run("CommitDynamicResources", {{"srbs", NumSRBs}, {"descriptors", 1 + NumTextures}, {"dynamic_buffers", DynamicBuffers}}, NumCommits, NumFrames,
+                                   [&]() {
+                                       for (Uint32 i = 0; i < NumCommits; ++i)
+                                           pCtx->CommitShaderResources(SRBs[i % NumSRBs], RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+                                       pCtx->Flush();
+                                       pCtx->FinishFrame();
+                                   });
+    }
+}
+
+// Maps the dynamic buffer with MAP_FLAG_DISCARD and fills it with data
+TEST(ResourceBindingBenchmark, MapBufferDiscard)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+    auto* pCtx = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 NumMaps = 1024;
+
+    BenchmarkScene Scene{pEnv->GetDevice(), 1, 1};
+    ASSERT_TRUE(Scene.IsValid());
+
+    auto* pDynamicCB = Scene.GetDynamicConstants();
+
+    const std::vector<Uint8> Data(BenchmarkScene::ConstantBufferSize, 0x7F);
+    BenchmarkReport::Get().Run("MapBufferDiscard", {{"size", BenchmarkScene::ConstantBufferSize}}, NumMaps, NumFrames,
+                               [&]() {
+                                   for (Uint32 i = 0; i < NumMaps; ++i)
+                                   {
+                                       void* pData = nullptr;
+                                       pCtx->MapBuffer(pDynamicCB, MAP_WRITE, MAP_FLAG_DISCARD, pData);
+                                       memcpy(pData, Data.data(), Data.size());
+                                       pCtx->UnmapBuffer(pDynamicCB, MAP_WRITE);
+                                   }
+                                   pCtx->Flush();
+                                   pCtx->FinishFrame();
+                               });
+}
+
+// Creates shader resource bindings and initializes all variables
+TEST(ResourceBindingBenchmark, CreateSRB)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 NumSRBs = 256;
+
+    BenchmarkScene Scene{pEnv->GetDevice(), 1, 1};
+    ASSERT_TRUE(Scene.IsValid());
+
+    std::vector<RefCntAutoPtr<IShaderResourceBinding>> SRBs(NumSRBs);
+    BenchmarkReport::Get().Run("CreateSRB", {}, NumSRBs, NumFrames,
+                               [&]() {
+                                   for (Uint32 i = 0; i < NumSRBs; ++i)
+                                       SRBs[i] = Scene.CreateSRB(Scene.GetConstants(), Scene.GetTextureSRV(i));
+                                   // Release SRBs within the measurement as this is a part of their lifetime cost
+                                   for (auto& pSRB : SRBs)
+                                       pSRB.Release();
+                                   pEnv->GetDevice()->ReleaseStaleResources();
+                               });
+}
+
+// Creates shader resource bindings on multiple threads, the same way resource loading threads do.
+// Every thread keeps a window of live SRBs, so that descriptor set allocations and releases are interleaved.
+TEST(ResourceBindingBenchmark, CreateSRBMultithreaded)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    auto* pCtx    = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 NumSRBsPerThread = 1024;
+    constexpr Uint32 NumLiveSRBs      = 64;
+    constexpr Uint32 NumIterations    = 16;
+
+    BenchmarkScene Scene{pDevice, 1, 1};
+    ASSERT_TRUE(Scene.IsValid());
+
+    for (Uint32 NumThreads = 1; NumThreads <= 8; NumThreads *= 2)
+    {
+        std::vector<std::thread> WorkerThreads(NumThreads);
+        BenchmarkReport::Get().Run(
+            "CreateSRBMultithreaded", {{"threads", NumThreads}, {"srbs", NumSRBsPerThread}}, NumSRBsPerThread * NumThreads, NumIterations,
+            [&]() {
+                for (Uint32 i = 0; i < NumThreads; ++i)
+                {
+                    WorkerThreads[i] = std::thread(
+                        [&](Uint32 thread_id) //
+                        {
+                            std::vector<RefCntAutoPtr<IShaderResourceBinding>> SRBs(NumLiveSRBs);
+                            for (Uint32 srb = 0; srb < NumSRBsPerThread; ++srb)
+                            {
+                                // Releases the SRB created NumLiveSRBs iterations ago
+                                auto& pSRB = SRBs[(srb * 7) % NumLiveSRBs];
+                                pSRB       = Scene.CreateSRB(Scene.GetConstants(), Scene.GetTextureSRV(srb + thread_id));
+                                VERIFY_EXPR(pSRB);
+                            }
+                        },
+                        i);
+                }
+                for (auto& Thread : WorkerThreads)
+                    Thread.join();
+
+                // Descriptor sets of released SRBs are recycled when the frame is finished
+                pCtx->Flush();
+                pCtx->FinishFrame();
+                pDevice->ReleaseStaleResources();
+            });
+    }
+}
+
+// Binds objects to the variables of many shader resource bindings one variable at a time
+// by name, and with a single IShaderResourceBinding::SetVariables() call per SRB.
+TEST(ResourceBindingBenchmark, SetVariables)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 NumSRBs     = 256;
+    constexpr Uint32 NumTextures = 4;
+
+    BenchmarkScene Scene{pDevice, 1, 1};
+    ASSERT_TRUE(Scene.IsValid());
+
+    static constexpr const char* TextureNames[NumTextures] = {"g_Texture0", "g_Texture1", "g_Texture2", "g_Texture3"};
+
+    IDeviceObject* pConstants = Scene.GetConstants();
+
+    std::vector<IDeviceObject*> SRVs(NumTextures * 2);
+    for (Uint32 i = 0; i < SRVs.size(); ++i)
+        SRVs[i] = Scene.GetTextureSRV(i);
+
+    for (auto VarType : {SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC})
+    {
+        std::vector<PipelineResourceDesc> Resources;
+        Resources.emplace_back(SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, "cbConstants", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, VarType);
+        for (const auto* TexName : TextureNames)
+            Resources.emplace_back(SHADER_TYPE_PIXEL, TexName, 1, SHADER_RESOURCE_TYPE_TEXTURE_SRV, VarType);
+
+        PipelineResourceSignatureDesc PRSDesc;
+        PRSDesc.Name         = "Set variables benchmark signature";
+        PRSDesc.Resources    = Resources.data();
+        PRSDesc.NumResources = static_cast<Uint32>(Resources.size());
+
+        RefCntAutoPtr<IPipelineResourceSignature> pSignature;
+        pDevice->CreatePipelineResourceSignature(PRSDesc, &pSignature);
+        ASSERT_TRUE(pSignature);
+
+        ShaderVariableBinding Bindings[1 + NumTextures];
+        Bindings[0].Handle    = pSignature->GetVariableHandle(SHADER_TYPE_VERTEX, "cbConstants");
+        Bindings[0].ppObjects = &pConstants;
+        for (Uint32 t = 0; t < NumTextures; ++t)
+            Bindings[1 + t].Handle = pSignature->GetVariableHandle(SHADER_TYPE_PIXEL, TextureNames[t]);
+
+        const auto IsDynamic = VarType == SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
+
+        std::vector<RefCntAutoPtr<IShaderResourceBinding>> SRBs(NumSRBs);
+        for (auto& pSRB : SRBs)
+            pSignature->CreateShaderResourceBinding(&pSRB);
+
+        for (bool Batched : {false, true})
+        {
+            BenchmarkReport::Get().Run("SetVariables", {{"dynamic", IsDynamic ? 1u : 0u}, {"batched", Batched ? 1u : 0u}, {"vars", 1 + NumTextures}}, NumSRBs, NumFrames,
+                                       [&]() {
+                                           for (Uint32 i = 0; i < NumSRBs; ++i)
+                                           {
+                                               // Objects can't be bound to mutable variables twice, so use new SRBs
+                                               if (!IsDynamic)
+                                               {
+                                                   SRBs[i].Release();
+                                                   pSignature->CreateShaderResourceBinding(&SRBs[i]);
+                                               }
+
+                                               auto* pSRB = SRBs[i].RawPtr();
+                                               if (Batched)
+                                               {
+                                                   for (Uint32 t = 0; t < NumTextures; ++t)
+                                                       Bindings[1 + t].ppObjects = &SRVs[(i + t) % SRVs.size()];
+                                                   pSRB->SetVariables(Bindings, _countof(Bindings));
+                                               }
+                                               else
+                                               {
+                                                   pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "cbConstants")->Set(pConstants);
+                                                   for (Uint32 t = 0; t < NumTextures; ++t)
+                                                       pSRB->GetVariableByName(SHADER_TYPE_PIXEL, TextureNames[t])->Set(SRVs[(i + t) % SRVs.size()]);
+                                               }
+                                           }
+                                       });
+        }
+    }
+}
+
+} // namespace
@@ -0,0 +1,199 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <string>
+#include <vector>
+
+#include "SPIRVShaderResources.hpp"
+#include "GLSLangUtils.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "BenchmarkReport.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr Uint32 NumIterations = 64;
+
+const char* g_HLSLResources = R"(
+struct BufferData
+{
+    float4 Data;
+    uint   Index;
+};
+
+cbuffer cbConstants
+{
+    float4x4 g_WorldViewProj;
+    float4   g_Color;
+}
+
+Texture2D                      g_Tex2D;
+Texture2DArray                 g_Tex2DArr[2];
+TextureCube                    g_TexCube;
+SamplerState                   g_Sampler;
+SamplerState                   g_Samplers[3];
+Buffer<float4>                 g_FormattedBuff;
+StructuredBuffer<BufferData>   g_StructBuff;
+RWStructuredBuffer<BufferData> g_RWStructBuff;
+RWTexture2D<float4>            g_RWTex2D;
+)";
+
+const char* g_HLSL_PS = R"(
+float4 main(in float4 Pos : SV_Position, in float4 Color : COLOR, in float2 UV : TEXCOORD) : SV_Target
+{
+    float4 f4 = Color * g_Color;
+    f4 += g_Tex2D.Sample(g_Sampler, UV);
+    f4 += g_Tex2DArr[1].Sample(g_Samplers[2], Pos.xyz);
+    f4 += g_TexCube.Sample(g_Samplers[0], Pos.xyz);
+    f4 += g_FormattedBuff.Load(0);
+    f4 += g_StructBuff[1].Data;
+    return mul(f4, g_WorldViewProj);
+}
+)";
+
+const char* g_HLSL_CS = R"(
+[numthreads(8, 8, 1)]
+void main(uint3 DTid : SV_DispatchThreadID)
+{
+    float4 f4 = g_Color + g_FormattedBuff.Load(DTid.x) + g_StructBuff[DTid.y].Data;
+    g_RWStructBuff[DTid.x].Data = f4;
+    g_RWTex2D[DTid.xy]          = f4 + g_Tex2D.SampleLevel(g_Sampler, float2(DTid.xy), 0.0);
+}
+)";
+
+const char* g_GLSL_CS = R"(
+#version 450
+layout(local_size_x = 16, local_size_y = 16, local_size_z = 1) in;
+
+layout(std140) uniform UniformBuff
+{
+    mat4 g_Matrix;
+    vec4 g_Vec4;
+};
+
+layout(std430) buffer RWStorageBuff
+{
+    vec4 g_RWData[];
+};
+
+layout(rgba8) uniform image2D g_Image;
+
+uniform sampler2D     g_CombinedSampler;
+uniform samplerCube   g_CombinedSamplers[4];
+uniform samplerBuffer g_TexelBuffer;
+
+void main()
+{
+    ivec2 Coord = ivec2(gl_GlobalInvocationID.xy);
+    vec4  f4    = g_Matrix * g_Vec4 + texelFetch(g_TexelBuffer, Coord.x);
+    f4 += textureLod(g_CombinedSampler, vec2(Coord), 0.0);
+    f4 += textureLod(g_CombinedSamplers[3], vec3(Coord, 0.0), 0.0);
+    g_RWData[Coord.y] = f4;
+    imageStore(g_Image, Coord, f4);
+}
+)";
+
+struct BenchmarkShader
+{
+    std::string           Name;
+    SHADER_TYPE           ShaderType;
+    std::vector<uint32_t> SPIRV;
+};
+
+std::vector<BenchmarkShader> CompileShaders()
+{
+    std::vector<BenchmarkShader> Shaders;
+
+    auto AddHLSL = [&](const char* Name, SHADER_TYPE ShaderType, const char* Source) {
+        std::string FullSource{g_HLSLResources};
+        FullSource += Source;
+
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.Source          = FullSource.c_str();
+        ShaderCI.SourceLanguage  = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.EntryPoint      = "main";
+        ShaderCI.Desc.ShaderType = ShaderType;
+        ShaderCI.Desc.Name       = Name;
+
+        auto SPIRV = GLSLangUtils::HLSLtoSPIRV(ShaderCI, GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr);
+        if (!SPIRV.empty())
+            Shaders.push_back({Name, ShaderType, std::move(SPIRV)});
+    };
+
+    auto AddGLSL = [&](const char* Name, SHADER_TYPE ShaderType, const char* Source) {
+        GLSLangUtils::GLSLtoSPIRVAttribs Attribs;
+        Attribs.ShaderType   = ShaderType;
+        Attribs.ShaderSource = Source;
+        Attribs.Version      = GLSLangUtils::SpirvVersion::Vk100;
+
+        auto SPIRV = GLSLangUtils::GLSLtoSPIRV(Attribs);
+        if (!SPIRV.empty())
+            Shaders.push_back({Name, ShaderType, std::move(SPIRV)});
+    };
+
+    GLSLangUtils::InitializeGlslang();
+    AddHLSL("HLSL PS", SHADER_TYPE_PIXEL, g_HLSL_PS);
+    AddHLSL("HLSL CS", SHADER_TYPE_COMPUTE, g_HLSL_CS);
+    AddGLSL("GLSL CS", SHADER_TYPE_COMPUTE, g_GLSL_CS);
+    GLSLangUtils::FinalizeGlslang();
+
+    return Shaders;
+}
+
+// Reflects SPIRV shader resources with the native parser and with SPIRV-Cross
+TEST(SPIRVReflectionBenchmark, ReflectShaderResources)
+{
+    const auto Shaders = CompileShaders();
+    ASSERT_EQ(Shaders.size(), 3u);
+
+    auto& RawAllocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    for (auto Mode : {SPIRVShaderResources::ReflectionMode::Native, SPIRVShaderResources::ReflectionMode::SPIRVCross})
+    {
+        const Uint32 IsNative = Mode == SPIRVShaderResources::ReflectionMode::Native ? 1u : 0u;
+        BenchmarkReport::Get().Run("ReflectShaderResources", {{"shaders", static_cast<Uint32>(Shaders.size())}, {"native", IsNative}}, static_cast<Uint32>(Shaders.size()), NumIterations,
+                                   [&]() {
+                                       for (const auto& Shader : Shaders)
+                                       {
+                                           ShaderDesc Desc;
+                                           Desc.Name       = Shader.Name.c_str();
+                                           Desc.ShaderType = Shader.ShaderType;
+
+                                           std::string          EntryPoint;
+                                           SPIRVShaderResources Resources{RawAllocator, Shader.SPIRV, Desc, "_sampler", Shader.ShaderType == SHADER_TYPE_VERTEX, EntryPoint, Mode};
+                                           VERIFY_EXPR(Resources.GetTotalResources() != 0);
+                                       }
+                                   });
+    }
+}
+
+} // namespace
@@ -26,8 +26,12 @@
 
 #include <cstring>
 
+#include <vector>
+
 #include "ArchiveMemoryImpl.hpp"
+#include "CompressedArchiveImpl.hpp"
 #include "DataBlobImpl.hpp"
+#include "MemoryFileStream.hpp"
 
 #include "gtest/gtest.h"
 
@@ -73,4 +77,57 @@ TEST(Common_Archive, MemoryImpl)
     EXPECT_FALSE(pArchive->Read(sizeof(RefData) + 1024, 1024, nullptr));
 }
 
+TEST(Common_Archive, CompressedImpl)
+{
+    constexpr Uint32 PrefixSize = 40;
+
+    std::vector<Uint8> RefData(PrefixSize + 3 * CompressedArchiveImpl::MaxPageSize + 1000);
+    for (size_t i = 0; i < RefData.size(); ++i)
+        RefData[i] = static_cast<Uint8>((i % 251) ^ (i / 4096));
+
+    // The second range ends at the page boundary + 1
+    const size_t Range0Size = 100000;
+    const size_t Range1Size = CompressedArchiveImpl::MaxPageSize + 1;
+
+    auto pBlob   = DataBlobImpl::Create();
+    auto pStream = MemoryFileStream::Create(pBlob);
+    ASSERT_TRUE(pStream->Write(RefData.data(), PrefixSize));
+
+    std::vector<CompressedArchiveImpl::DataRange> Ranges = {
+        {&RefData[PrefixSize], Range0Size},
+        {&RefData[PrefixSize + Range0Size], Range1Size},
+        {&RefData[PrefixSize + Range0Size + Range1Size], RefData.size() - PrefixSize - Range0Size - Range1Size},
+    };
+    ASSERT_TRUE(CompressedArchiveImpl::Write(pStream, PrefixSize, Ranges));
+    EXPECT_LT(pBlob->GetSize(), RefData.size() / 2);
+
+    auto pArchive = CompressedArchiveImpl::Create(ArchiveMemoryImpl::Create(pBlob), PrefixSize);
+    ASSERT_TRUE(pArchive);
+    ASSERT_EQ(pArchive->GetSize(), RefData.size());
+
+    {
+        std::vector<Uint8> TestData(RefData.size());
+        EXPECT_TRUE(pArchive->Read(0, TestData.size(), TestData.data()));
+        EXPECT_EQ(TestData, RefData);
+    }
+
+    // Reads that span the prefix, range and page boundaries
+    const size_t Offsets[] = {0, 10, PrefixSize - 1, PrefixSize, PrefixSize + Range0Size - 5, PrefixSize + 70000, RefData.size() - 100};
+    for (auto Offset : Offsets)
+    {
+        std::vector<Uint8> TestData(std::min(size_t{70000}, RefData.size() - Offset));
+        EXPECT_TRUE(pArchive->Read(Offset, TestData.size(), TestData.data()));
+        EXPECT_EQ(memcmp(&RefData[Offset], TestData.data(), TestData.size()), 0) << Offset;
+    }
+
+    {
+        Uint8 TestData[200] = {};
+        EXPECT_FALSE(pArchive->Read(RefData.size() - 100, sizeof(TestData), TestData));
+        EXPECT_EQ(memcmp(&RefData[RefData.size() - 100], TestData, 100), 0);
+    }
+
+    EXPECT_TRUE(pArchive->Read(RefData.size(), 0, nullptr));
+    EXPECT_FALSE(pArchive->Read(RefData.size(), 1, nullptr));
+}
+
 } // namespace
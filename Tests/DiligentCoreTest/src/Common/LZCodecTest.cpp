@@ -0,0 +1,137 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "LZCodec.hpp"
+
+#include <cstring>
+#include <vector>
+#include <string>
+
+#include "FastRand.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+void TestRoundTrip(const std::vector<Uint8>& SrcData)
+{
+    std::vector<Uint8> Compressed(LZCompressBound(SrcData.size()));
+
+    const auto CompressedSize = LZCompress(SrcData.data(), SrcData.size(), Compressed.data(), Compressed.size());
+    ASSERT_NE(CompressedSize, size_t{0});
+    ASSERT_LE(CompressedSize, Compressed.size());
+
+    std::vector<Uint8> Decompressed(SrcData.size());
+    EXPECT_TRUE(LZDecompress(Compressed.data(), CompressedSize, Decompressed.data(), Decompressed.size()));
+    EXPECT_EQ(Decompressed, SrcData);
+
+    // Wrong output size must be detected
+    std::vector<Uint8> Larger(SrcData.size() + 1);
+    EXPECT_FALSE(LZDecompress(Compressed.data(), CompressedSize, Larger.data(), Larger.size()));
+    if (!SrcData.empty())
+    {
+        std::vector<Uint8> Smaller(SrcData.size() - 1);
+        EXPECT_FALSE(LZDecompress(Compressed.data(), CompressedSize, Smaller.data(), Smaller.size()));
+    }
+}
+
+TEST(Common_LZCodec, RoundTrip)
+{
+    TestRoundTrip({});
+    TestRoundTrip({1});
+    TestRoundTrip({1, 2, 3});
+    TestRoundTrip({1, 2, 3, 4, 5});
+
+    {
+        // Long runs exercise overlapping matches and length extensions
+        std::vector<Uint8> Data(100000, 7);
+        TestRoundTrip(Data);
+    }
+
+    {
+        std::string Text;
+        for (int i = 0; i < 1000; ++i)
+            Text += "layout(set = 0, binding = " + std::to_string(i % 17) + ") uniform texture2D g_Texture" + std::to_string(i) + ";\n";
+
+        std::vector<Uint8> Data{Text.begin(), Text.end()};
+        TestRoundTrip(Data);
+
+        std::vector<Uint8> Compressed(LZCompressBound(Data.size()));
+        const auto         CompressedSize = LZCompress(Data.data(), Data.size(), Compressed.data(), Compressed.size());
+        EXPECT_LT(CompressedSize, Data.size() / 4);
+    }
+
+    {
+        FastRandInt        Rnd{0, 0, 255};
+        std::vector<Uint8> Data(70000);
+        for (auto& Byte : Data)
+            Byte = static_cast<Uint8>(Rnd());
+        TestRoundTrip(Data);
+
+        // Random data with repeated blocks
+        for (size_t i = 1000; i + 2000 < Data.size(); i += 3000)
+            memcpy(&Data[i], &Data[i - 1000], 500);
+        TestRoundTrip(Data);
+    }
+}
+
+TEST(Common_LZCodec, SmallDestination)
+{
+    std::vector<Uint8> Data(1000);
+    for (size_t i = 0; i < Data.size(); ++i)
+        Data[i] = static_cast<Uint8>(i * 7);
+
+    std::vector<Uint8> Compressed(16);
+    EXPECT_EQ(LZCompress(Data.data(), Data.size(), Compressed.data(), Compressed.size()), size_t{0});
+}
+
+TEST(Common_LZCodec, CorruptedData)
+{
+    std::vector<Uint8> Data(4096);
+    for (size_t i = 0; i < Data.size(); ++i)
+        Data[i] = static_cast<Uint8>((i / 16) ^ (i % 5));
+
+    std::vector<Uint8> Compressed(LZCompressBound(Data.size()));
+    Compressed.resize(LZCompress(Data.data(), Data.size(), Compressed.data(), Compressed.size()));
+    ASSERT_FALSE(Compressed.empty());
+
+    // Decompression of the corrupted data must fail or produce
+    // some output without accessing memory out of bounds.
+    std::vector<Uint8> Decompressed(Data.size());
+    for (size_t i = 0; i < Compressed.size(); ++i)
+    {
+        auto Corrupted = Compressed;
+        Corrupted[i] ^= 0xA5;
+        LZDecompress(Corrupted.data(), Corrupted.size(), Decompressed.data(), Decompressed.size());
+
+        EXPECT_FALSE(LZDecompress(Compressed.data(), i, Decompressed.data(), Decompressed.size()));
+    }
+}
+
+} // namespace
@@ -118,4 +118,67 @@ TEST(SerializerTest, SerializerTest)
     EXPECT_TRUE(RSer.IsEnded());
 }
 
+TEST(SerializerTest, SerializeSpans)
+{
+    const Uint32 RefArraySize           = 4;
+    const Uint32 RefArray[RefArraySize] = {0x1251, 0x620, 0x8816, 0x7A3};
+    const char   RefBytes[]             = "serialized byte code";
+
+    auto& RawAllocator{DefaultRawMemoryAllocator::GetAllocator()};
+
+    DynamicLinearAllocator TmpAllocator{RawAllocator};
+    const auto             WriteData = [&](auto& Ser) {
+        Ser.SerializeArrayRaw(&TmpAllocator, RefArray, RefArraySize);
+        Ser.SerializeArrayRaw(&TmpAllocator, RefArray, RefArraySize);
+        Ser.SerializeBytes(RefBytes, sizeof(RefBytes));
+    };
+
+    Serializer<SerializerMode::Measure> MSer;
+    WriteData(MSer);
+
+    auto Data = MSer.AllocateData(RawAllocator);
+
+    Serializer<SerializerMode::Write> WSer{Data};
+    WriteData(WSer);
+    EXPECT_TRUE(WSer.IsEnded());
+
+    Serializer<SerializerMode::Read> RSer{Data};
+
+    const auto* const pDataStart = Data.Ptr<const Uint8>();
+    const auto* const pDataEnd   = pDataStart + Data.Size();
+
+    {
+        // Const arrays point to the serialized data
+        Uint32        ArraySize = 0;
+        const Uint32* pArray    = nullptr;
+        RSer.SerializeArrayRaw(&TmpAllocator, pArray, ArraySize);
+        ASSERT_EQ(ArraySize, RefArraySize);
+        EXPECT_GE(reinterpret_cast<const Uint8*>(pArray), pDataStart);
+        EXPECT_LT(reinterpret_cast<const Uint8*>(pArray), pDataEnd);
+        for (Uint32 i = 0; i < RefArraySize; ++i)
+            EXPECT_EQ(RefArray[i], pArray[i]);
+    }
+
+    {
+        // Non-const arrays are always copied
+        Uint32  ArraySize = 0;
+        Uint32* pArray    = nullptr;
+        RSer.SerializeArrayRaw(&TmpAllocator, pArray, ArraySize);
+        ASSERT_EQ(ArraySize, RefArraySize);
+        EXPECT_TRUE(reinterpret_cast<const Uint8*>(pArray) < pDataStart || reinterpret_cast<const Uint8*>(pArray) >= pDataEnd);
+        for (Uint32 i = 0; i < RefArraySize; ++i)
+            EXPECT_EQ(RefArray[i], pArray[i]);
+    }
+
+    {
+        const void* pBytes = nullptr;
+        RSer.SerializeBytes(pBytes, sizeof(RefBytes));
+        EXPECT_GE(static_cast<const Uint8*>(pBytes), pDataStart);
+        EXPECT_LT(static_cast<const Uint8*>(pBytes), pDataEnd);
+        EXPECT_STREQ(static_cast<const char*>(pBytes), RefBytes);
+    }
+
+    EXPECT_TRUE(RSer.IsEnded());
+}
+
 } // namespace
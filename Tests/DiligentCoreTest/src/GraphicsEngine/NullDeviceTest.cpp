@@ -0,0 +1,331 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "EngineFactoryNull.h"
+#include "RefCntAutoPtr.hpp"
+#include "MapHelper.hpp"
+#include "DebugOutput.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+// Any error reported by the engine front-end fails the test
+void NullDeviceTestMessageCallback(DEBUG_MESSAGE_SEVERITY Severity,
+                                   const Char*            Message,
+                                   const Char*            Function,
+                                   const Char*            File,
+                                   int                    Line)
+{
+    if (Severity >= DEBUG_MESSAGE_SEVERITY_ERROR)
+        ADD_FAILURE() << (Message != nullptr ? Message : "") << " (" << (File != nullptr ? File : "") << ", " << Line << ")";
+}
+
+class NullDeviceTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        auto* pFactoryNull = GetEngineFactoryNull();
+        ASSERT_NE(pFactoryNull, nullptr);
+
+        PrevMessageCallback = DebugMessageCallback;
+
+        EngineNullCreateInfo EngineCI;
+        EngineCI.NumDeferredContexts  = 1;
+        EngineCI.DebugMessageCallback = NullDeviceTestMessageCallback;
+
+        IDeviceContext* ppContexts[2] = {};
+        pFactoryNull->CreateDeviceAndContextsNull(EngineCI, &pDevice, ppContexts);
+        pContext = RefCntAutoPtr<IDeviceContext>{ppContexts[0]};
+        pDeferredContext = RefCntAutoPtr<IDeviceContext>{ppContexts[1]};
+        if (ppContexts[0] != nullptr)
+            ppContexts[0]->Release();
+        if (ppContexts[1] != nullptr)
+            ppContexts[1]->Release();
+    }
+
+    static void TearDownTestSuite()
+    {
+        pDeferredContext.Release();
+        pContext.Release();
+        pDevice.Release();
+        SetDebugMessageCallback(PrevMessageCallback);
+    }
+
+    static RefCntAutoPtr<IRenderDevice>  pDevice;
+    static RefCntAutoPtr<IDeviceContext> pContext;
+    static RefCntAutoPtr<IDeviceContext> pDeferredContext;
+    static DebugMessageCallbackType      PrevMessageCallback;
+};
+
+RefCntAutoPtr<IRenderDevice>  NullDeviceTest::pDevice;
+RefCntAutoPtr<IDeviceContext> NullDeviceTest::pContext;
+RefCntAutoPtr<IDeviceContext> NullDeviceTest::pDeferredContext;
+DebugMessageCallbackType      NullDeviceTest::PrevMessageCallback = nullptr;
+
+TEST_F(NullDeviceTest, CreateDevice)
+{
+    ASSERT_NE(pDevice, nullptr);
+    ASSERT_NE(pContext, nullptr);
+    ASSERT_NE(pDeferredContext, nullptr);
+
+    const auto& DeviceInfo = pDevice->GetDeviceInfo();
+    EXPECT_EQ(DeviceInfo.Type, RENDER_DEVICE_TYPE_NULL);
+    EXPECT_FALSE(pContext->GetDesc().IsDeferred);
+    EXPECT_TRUE(pDeferredContext->GetDesc().IsDeferred);
+
+    SwapChainDesc SCDesc;
+    SCDesc.Width  = 256;
+    SCDesc.Height = 128;
+
+    RefCntAutoPtr<ISwapChain> pSwapChain;
+    GetEngineFactoryNull()->CreateSwapChainNull(pDevice, pContext, SCDesc, &pSwapChain);
+    ASSERT_NE(pSwapChain, nullptr);
+    ASSERT_NE(pSwapChain->GetCurrentBackBufferRTV(), nullptr);
+
+    const auto& BackBufferDesc = pSwapChain->GetCurrentBackBufferRTV()->GetTexture()->GetDesc();
+    EXPECT_EQ(BackBufferDesc.Width, SCDesc.Width);
+    EXPECT_EQ(BackBufferDesc.Height, SCDesc.Height);
+}
+
+TEST_F(NullDeviceTest, Draw)
+{
+    ASSERT_NE(pDevice, nullptr);
+
+    constexpr Uint32 RTWidth  = 64;
+    constexpr Uint32 RTHeight = 64;
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Null device test render target";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = RTWidth;
+    TexDesc.Height    = RTHeight;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.BindFlags = BIND_RENDER_TARGET | BIND_SHADER_RESOURCE;
+
+    RefCntAutoPtr<ITexture> pRenderTarget;
+    pDevice->CreateTexture(TexDesc, nullptr, &pRenderTarget);
+    ASSERT_NE(pRenderTarget, nullptr);
+
+    TexDesc.Name      = "Null device test texture";
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+
+    RefCntAutoPtr<ITexture> pTexture;
+    pDevice->CreateTexture(TexDesc, nullptr, &pTexture);
+    ASSERT_NE(pTexture, nullptr);
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name           = "Null device test constants";
+    BuffDesc.Size           = 64;
+    BuffDesc.Usage          = USAGE_DYNAMIC;
+    BuffDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+
+    RefCntAutoPtr<IBuffer> pConstants;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pConstants);
+    ASSERT_NE(pConstants, nullptr);
+
+    constexpr Uint32 Indices[] = {0, 1, 2, 2, 1, 3};
+
+    BuffDesc.Name           = "Null device test index buffer";
+    BuffDesc.Size           = sizeof(Indices);
+    BuffDesc.Usage          = USAGE_IMMUTABLE;
+    BuffDesc.BindFlags      = BIND_INDEX_BUFFER;
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_NONE;
+
+    BufferData IBData{Indices, sizeof(Indices)};
+
+    RefCntAutoPtr<IBuffer> pIndexBuffer;
+    pDevice->CreateBuffer(BuffDesc, &IBData, &pIndexBuffer);
+    ASSERT_NE(pIndexBuffer, nullptr);
+
+    // Null shaders are not reflected, so resources are defined by an explicit signature
+    RefCntAutoPtr<IPipelineResourceSignature> pSignature;
+    {
+        const PipelineResourceDesc Resources[] =
+            {
+                {SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, "cbConstants", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+                {SHADER_TYPE_PIXEL, "g_Texture", 1, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            };
+        const ImmutableSamplerDesc ImmutableSamplers[] =
+            {
+                {SHADER_TYPE_PIXEL, "g_Texture", SamplerDesc{}},
+            };
+
+        PipelineResourceSignatureDesc PRSDesc;
+        PRSDesc.Name                       = "Null device test signature";
+        PRSDesc.Resources                  = Resources;
+        PRSDesc.NumResources               = _countof(Resources);
+        PRSDesc.ImmutableSamplers          = ImmutableSamplers;
+        PRSDesc.NumImmutableSamplers       = _countof(ImmutableSamplers);
+        PRSDesc.UseCombinedTextureSamplers = true;
+
+        pDevice->CreatePipelineResourceSignature(PRSDesc, &pSignature);
+        ASSERT_NE(pSignature, nullptr);
+    }
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    {
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+
+        RefCntAutoPtr<IShader> pVS;
+        ShaderCI.Desc.Name       = "Null device test VS";
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_VERTEX;
+        ShaderCI.Source          = "void main(out float4 Pos : SV_Position) { Pos = float4(0.0, 0.0, 0.0, 1.0); }";
+        pDevice->CreateShader(ShaderCI, &pVS);
+        ASSERT_NE(pVS, nullptr);
+
+        RefCntAutoPtr<IShader> pPS;
+        ShaderCI.Desc.Name       = "Null device test PS";
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+        ShaderCI.Source          = "float4 main() : SV_Target { return float4(1.0, 1.0, 1.0, 1.0); }";
+        pDevice->CreateShader(ShaderCI, &pPS);
+        ASSERT_NE(pPS, nullptr);
+
+        GraphicsPipelineStateCreateInfo PSOCreateInfo;
+        PSOCreateInfo.PSODesc.Name = "Null device test PSO";
+
+        IPipelineResourceSignature* ppSignatures[] = {pSignature};
+        PSOCreateInfo.ppResourceSignatures         = ppSignatures;
+        PSOCreateInfo.ResourceSignaturesCount      = _countof(ppSignatures);
+
+        auto& GraphicsPipeline             = PSOCreateInfo.GraphicsPipeline;
+        GraphicsPipeline.NumRenderTargets  = 1;
+        GraphicsPipeline.RTVFormats[0]     = TexDesc.Format;
+        GraphicsPipeline.PrimitiveTopology = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+        PSOCreateInfo.pVS = pVS;
+        PSOCreateInfo.pPS = pPS;
+
+        pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+        ASSERT_NE(pPSO, nullptr);
+        EXPECT_EQ(pPSO->GetStatus(), PIPELINE_STATE_STATUS_READY);
+    }
+
+    pSignature->GetStaticVariableByName(SHADER_TYPE_VERTEX, "cbConstants")->Set(pConstants);
+    pSignature->GetStaticVariableByName(SHADER_TYPE_PIXEL, "cbConstants")->Set(pConstants);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pSignature->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+
+    auto* pTextureVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Texture");
+    ASSERT_NE(pTextureVar, nullptr);
+    pTextureVar->Set(pTexture->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+
+    auto DrawFrame = [&](IDeviceContext* pCtx) {
+        auto* pRTV = pRenderTarget->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+        pCtx->SetRenderTargets(1, &pRTV, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        constexpr float ClearColor[] = {0, 0, 0, 0};
+        pCtx->ClearRenderTarget(pRTV, ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        {
+            MapHelper<float> Constants{pCtx, pConstants, MAP_WRITE, MAP_FLAG_DISCARD};
+            ASSERT_NE(static_cast<float*>(Constants), nullptr);
+            Constants[0] = 1;
+        }
+
+        pCtx->SetPipelineState(pPSO);
+        pCtx->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        pCtx->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+
+        pCtx->SetIndexBuffer(pIndexBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pCtx->DrawIndexed(DrawIndexedAttribs{_countof(Indices), VT_UINT32, DRAW_FLAG_VERIFY_ALL});
+    };
+
+    pContext->ResetStats();
+    DrawFrame(pContext);
+    pContext->Flush();
+    pContext->FinishFrame();
+
+    DeviceContextStats Stats;
+    pContext->GetStats(Stats);
+    EXPECT_EQ(Stats.DrawCount, 2u);
+    EXPECT_EQ(Stats.PipelineStateChangeCount, 1u);
+    EXPECT_EQ(Stats.ShaderResourceCommitCount, 1u);
+    EXPECT_EQ(Stats.FrameCount, 1u);
+
+    // Record the same frame in a deferred context and execute it in the immediate context
+    pDeferredContext->Begin(0);
+    DrawFrame(pDeferredContext);
+    pDeferredContext->FinishFrame();
+
+    RefCntAutoPtr<ICommandList> pCmdList;
+    pDeferredContext->FinishCommandList(&pCmdList);
+    ASSERT_NE(pCmdList, nullptr);
+
+    ICommandList* ppCmdLists[] = {pCmdList};
+    pContext->ExecuteCommandLists(_countof(ppCmdLists), ppCmdLists);
+    pContext->Flush();
+    pContext->FinishFrame();
+}
+
+TEST_F(NullDeviceTest, ExecuteCopies)
+{
+    ASSERT_NE(pDevice, nullptr);
+
+    constexpr Uint32 Data[] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Null device test source buffer";
+    BuffDesc.Size      = sizeof(Data);
+    BuffDesc.Usage     = USAGE_DEFAULT;
+    BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+
+    RefCntAutoPtr<IBuffer> pSrcBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pSrcBuffer);
+    ASSERT_NE(pSrcBuffer, nullptr);
+
+    BuffDesc.Name           = "Null device test staging buffer";
+    BuffDesc.Usage          = USAGE_STAGING;
+    BuffDesc.BindFlags      = BIND_NONE;
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_READ;
+
+    RefCntAutoPtr<IBuffer> pStagingBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pStagingBuffer);
+    ASSERT_NE(pStagingBuffer, nullptr);
+
+    pContext->UpdateBuffer(pSrcBuffer, 0, sizeof(Data), Data, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->CopyBuffer(pSrcBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                         pStagingBuffer, 0, sizeof(Data), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->WaitForIdle();
+
+    MapHelper<Uint32> MappedData{pContext, pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT};
+
+    const Uint32* pData = MappedData;
+    ASSERT_NE(pData, nullptr);
+    for (size_t i = 0; i < _countof(Data); ++i)
+        EXPECT_EQ(pData[i], Data[i]);
+}
+
+} // namespace
@@ -0,0 +1,144 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "../../../../Graphics/GraphicsEngine/include/ResourceNameTable.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(GraphicsEngine_ResourceNameTable, Intern)
+{
+    auto& Table = ResourceNameTable::GetInstance();
+
+    const auto Id0 = Table.Intern("ResourceNameTableTest.Name0");
+    const auto Id1 = Table.Intern("ResourceNameTableTest.Name1");
+    EXPECT_NE(Id0, ResourceNameTable::InvalidNameId);
+    EXPECT_NE(Id1, ResourceNameTable::InvalidNameId);
+    EXPECT_NE(Id0, Id1);
+
+    // Interning a copy of the string must return the same ID
+    const std::string Name0Copy{"ResourceNameTableTest.Name0"};
+    EXPECT_EQ(Table.Intern(Name0Copy.c_str()), Id0);
+    EXPECT_EQ(Table.Find(Name0Copy.c_str()), Id0);
+    EXPECT_EQ(Table.Find("ResourceNameTableTest.Name1"), Id1);
+
+    EXPECT_STREQ(Table.GetName(Id0), "ResourceNameTableTest.Name0");
+    EXPECT_STREQ(Table.GetName(Id1), "ResourceNameTableTest.Name1");
+
+    EXPECT_EQ(Table.Find("ResourceNameTableTest.NotInterned"), ResourceNameTable::InvalidNameId);
+    EXPECT_EQ(Table.GetName(ResourceNameTable::InvalidNameId), nullptr);
+}
+
+TEST(GraphicsEngine_ResourceNameTable, MultithreadedIntern)
+{
+    auto& Table = ResourceNameTable::GetInstance();
+
+    constexpr size_t NumThreads = 8;
+    constexpr size_t NumNames   = 256;
+
+    std::vector<std::vector<Uint32>> Ids(NumThreads);
+    std::vector<std::thread>         Threads;
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back(
+            [&Table, &ThreadIds = Ids[t]]() {
+                for (size_t i = 0; i < NumNames; ++i)
+                {
+                    const auto Name = "ResourceNameTableTest.MT" + std::to_string(i);
+                    ThreadIds.push_back(Table.Intern(Name.c_str()));
+                }
+            });
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    // All threads must get the same IDs for the same names
+    for (size_t t = 1; t < NumThreads; ++t)
+        EXPECT_EQ(Ids[t], Ids[0]);
+
+    for (size_t i = 0; i < NumNames; ++i)
+    {
+        const auto Name = "ResourceNameTableTest.MT" + std::to_string(i);
+        EXPECT_STREQ(Table.GetName(Ids[0][i]), Name.c_str());
+    }
+}
+
+TEST(GraphicsEngine_ResourceNameTable, MultithreadedFind)
+{
+    auto& Table = ResourceNameTable::GetInstance();
+
+    const auto KnownId = Table.Intern("ResourceNameTableTest.Known");
+
+    constexpr size_t NumReaders = 4;
+    constexpr size_t NumNames   = 256;
+
+    // Readers look up the known name while the writer keeps adding new names
+    std::vector<size_t>      Mismatches(NumReaders);
+    std::vector<std::thread> Threads;
+    for (size_t t = 0; t < NumReaders; ++t)
+    {
+        Threads.emplace_back(
+            [&Table, KnownId, &NumMismatches = Mismatches[t]]() {
+                for (size_t i = 0; i < NumNames * 4; ++i)
+                {
+                    if (Table.Find("ResourceNameTableTest.Known") != KnownId)
+                        ++NumMismatches;
+                    if (std::strcmp(Table.GetName(KnownId), "ResourceNameTableTest.Known") != 0)
+                        ++NumMismatches;
+                }
+            });
+    }
+    Threads.emplace_back(
+        [&Table]() {
+            for (size_t i = 0; i < NumNames; ++i)
+            {
+                const auto Name = "ResourceNameTableTest.Find" + std::to_string(i);
+                Table.Intern(Name.c_str());
+            }
+        });
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    for (auto NumMismatches : Mismatches)
+        EXPECT_EQ(NumMismatches, size_t{0});
+
+    for (size_t i = 0; i < NumNames; ++i)
+    {
+        const auto Name = "ResourceNameTableTest.Find" + std::to_string(i);
+        EXPECT_NE(Table.Find(Name.c_str()), ResourceNameTable::InvalidNameId);
+    }
+}
+
+} // namespace
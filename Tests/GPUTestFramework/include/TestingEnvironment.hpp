@@ -61,6 +61,7 @@ public:
         Uint32             NumDeferredContexts       = 4;
         bool               ForceNonSeparablePrograms = false;
         bool               EnableDeviceSimulation    = false;
+        bool               EnableVkCompletionThread  = false;
     };
     TestingEnvironment(const CreateInfo& CI, const SwapChainDesc& SCDesc);
 
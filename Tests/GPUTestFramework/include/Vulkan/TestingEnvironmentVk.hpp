@@ -78,6 +78,13 @@ public:
         return m_vkPhysicalDevice;
     }
 
+    // Returns true if the device was created with EngineVkCreateInfo::EnableCompletionThread (--vk_completion_thread).
+    // The engine ignores the option if timeline semaphores are not supported.
+    bool IsCompletionThreadRequested() const
+    {
+        return m_CompletionThreadRequested;
+    }
+
     virtual bool HasDXCompiler() const override final
     {
         return m_pDxCompiler != nullptr && m_pDxCompiler->IsLoaded();
@@ -123,12 +130,15 @@ private:
     VkCommandPool    m_vkCmdPool        = VK_NULL_HANDLE;
     VkFence          m_vkFence          = VK_NULL_HANDLE;
 
+    const bool m_CompletionThreadRequested;
+
     std::unique_ptr<IDXCompiler> m_pDxCompiler;
 
     VkPhysicalDeviceMemoryProperties m_MemoryProperties = {};
 
 public:
     VkPhysicalDeviceDescriptorIndexingFeaturesEXT DescriptorIndexing = {};
+    VkPhysicalDeviceDynamicRenderingFeaturesKHR   DynamicRendering   = {}; // The engine uses dynamic rendering when the feature is supported
     VkPhysicalDeviceProperties                    DeviceProps        = {};
 };
 
@@ -55,6 +55,10 @@
 #    include "EngineFactoryMtl.h"
 #endif
 
+#if NULL_SUPPORTED
+#    include "EngineFactoryNull.h"
+#endif
+
 #if ARCHIVER_SUPPORTED
 #    include "ArchiverFactoryLoader.h"
 #endif
@@ -421,26 +425,35 @@ TestingEnvironment::TestingEnvironment(const CreateInfo& CI, const SwapChainDesc
                 pFactoryVk->EnableDeviceSimulation();
 
             EnumerateAdapters(pFactoryVk, Version{});
-            AddContext(COMMAND_QUEUE_TYPE_GRAPHICS, "Graphics", CI.AdapterId);
-            AddContext(COMMAND_QUEUE_TYPE_COMPUTE, "Compute", CI.AdapterId);
-            AddContext(COMMAND_QUEUE_TYPE_TRANSFER, "Transfer", CI.AdapterId);
-            AddContext(COMMAND_QUEUE_TYPE_GRAPHICS, "Graphics 2", CI.AdapterId);
+            const auto AdapterId = FindAdapter(Adapters, CI.AdapterType, CI.AdapterId);
+            AddContext(COMMAND_QUEUE_TYPE_GRAPHICS, "Graphics", AdapterId);
+            AddContext(COMMAND_QUEUE_TYPE_COMPUTE, "Compute", AdapterId);
+            AddContext(COMMAND_QUEUE_TYPE_TRANSFER, "Transfer", AdapterId);
+            AddContext(COMMAND_QUEUE_TYPE_GRAPHICS, "Graphics 2", AdapterId);
 
             EngineVkCreateInfo CreateInfo;
 
             // Always enable validation
             CreateInfo.SetValidationLevel(VALIDATION_LEVEL_1);
 
-            CreateInfo.AdapterId                 = CI.AdapterId;
+            CreateInfo.AdapterId                 = AdapterId;
             CreateInfo.NumImmediateContexts      = static_cast<Uint32>(ContextCI.size());
             CreateInfo.pImmediateContextInfo     = CreateInfo.NumImmediateContexts > 0 ? ContextCI.data() : nullptr;
             CreateInfo.DebugMessageCallback      = MessageCallback;
             CreateInfo.MainDescriptorPoolSize    = VulkanDescriptorPoolSize{64, 64, 256, 256, 64, 32, 32, 32, 32, 16, 16};
             CreateInfo.DynamicDescriptorPoolSize = VulkanDescriptorPoolSize{64, 64, 256, 256, 64, 32, 32, 32, 32, 16, 16};
             CreateInfo.UploadHeapPageSize        = 32 * 1024;
-            //CreateInfo.DeviceLocalMemoryReserveSize = 32 << 20;
-            //CreateInfo.HostVisibleMemoryReserveSize = 48 << 20;
-            CreateInfo.Features = DeviceFeatures{DEVICE_FEATURE_STATE_OPTIONAL};
+            // Destroy empty memory pages right away so that the tests can check that pages are released
+            CreateInfo.DeviceLocalMemoryReserveSize = 0;
+            CreateInfo.HostVisibleMemoryReserveSize = 0;
+            CreateInfo.Features                     = DeviceFeatures{DEVICE_FEATURE_STATE_OPTIONAL};
+            // The heap is only created if the device supports update-after-bind descriptors
+            CreateInfo.BindlessHeapSize = 1024;
+            if (CI.EnableVkCompletionThread)
+            {
+                CreateInfo.EnableCompletionThread = true;
+                CreateInfo.MaxSubmitBatchSize     = 4;
+            }
 
             NumDeferredCtx                 = CI.NumDeferredContexts;
             CreateInfo.NumDeferredContexts = NumDeferredCtx;
@@ -479,6 +492,42 @@ TestingEnvironment::TestingEnvironment(const CreateInfo& CI, const SwapChainDesc
         break;
 #endif
 
+#if NULL_SUPPORTED
+        case RENDER_DEVICE_TYPE_NULL:
+        {
+#    if EXPLICITLY_LOAD_ENGINE_NULL_DLL
+            // Load the dll and import GetEngineFactoryNull() function
+            auto GetEngineFactoryNull = LoadGraphicsEngineNull();
+            if (GetEngineFactoryNull == nullptr)
+            {
+                LOG_ERROR_AND_THROW("Failed to load the engine");
+            }
+#    endif
+
+            auto* pFactoryNull = GetEngineFactoryNull();
+            EnumerateAdapters(pFactoryNull, Version{});
+
+            EngineNullCreateInfo CreateInfo;
+
+            // Always enable validation
+            CreateInfo.SetValidationLevel(VALIDATION_LEVEL_1);
+
+            CreateInfo.DebugMessageCallback = MessageCallback;
+            CreateInfo.Features             = DeviceFeatures{DEVICE_FEATURE_STATE_OPTIONAL};
+
+            NumDeferredCtx                 = CI.NumDeferredContexts;
+            CreateInfo.NumDeferredContexts = NumDeferredCtx;
+            ppContexts.resize(std::max(size_t{1}, ContextCI.size()) + NumDeferredCtx);
+            pFactoryNull->CreateDeviceAndContextsNull(CreateInfo, &m_pDevice, ppContexts.data());
+            if (m_pDevice && ppContexts[0] != nullptr)
+            {
+                // There is no window, so the Null swap chain is used directly
+                pFactoryNull->CreateSwapChainNull(m_pDevice, ppContexts[0], SCDesc, &m_pSwapChain);
+            }
+        }
+        break;
+#endif
+
         default:
             LOG_ERROR_AND_THROW("Unknown device type");
             break;
@@ -738,6 +787,11 @@ void TestingEnvironment::SetDefaultCompiler(SHADER_COMPILER compiler)
             }
             break;
 
+        case RENDER_DEVICE_TYPE_NULL:
+            // Null backend does not compile shaders
+            m_ShaderCompiler = SHADER_COMPILER_DEFAULT;
+            break;
+
         default:
             LOG_WARNING_MESSAGE("Unexpected device type");
             m_ShaderCompiler = SHADER_COMPILER_DEFAULT;
@@ -805,6 +859,11 @@ TestingEnvironment* TestingEnvironment::Initialize(int argc, char** argv)
         {
             TestEnvCI.deviceType = RENDER_DEVICE_TYPE_VULKAN;
         }
+        else if (strcmp(arg, "--mode=vk_sw") == 0)
+        {
+            TestEnvCI.deviceType  = RENDER_DEVICE_TYPE_VULKAN;
+            TestEnvCI.AdapterType = ADAPTER_TYPE_SOFTWARE;
+        }
         else if (strcmp(arg, "--mode=gl") == 0)
         {
             TestEnvCI.deviceType = RENDER_DEVICE_TYPE_GL;
@@ -813,6 +872,10 @@ TestingEnvironment* TestingEnvironment::Initialize(int argc, char** argv)
         {
             TestEnvCI.deviceType = RENDER_DEVICE_TYPE_METAL;
         }
+        else if (strcmp(arg, "--mode=null") == 0)
+        {
+            TestEnvCI.deviceType = RENDER_DEVICE_TYPE_NULL;
+        }
         else if (AdapterArgName.compare(0, AdapterArgName.length(), arg, AdapterArgName.length()) == 0)
         {
             TestEnvCI.AdapterId = static_cast<Uint32>(atoi(arg + AdapterArgName.length()));
@@ -829,6 +892,10 @@ TestingEnvironment* TestingEnvironment::Initialize(int argc, char** argv)
         {
             TestEnvCI.EnableDeviceSimulation = true;
         }
+        else if (strcmp(arg, "--vk_completion_thread") == 0)
+        {
+            TestEnvCI.EnableVkCompletionThread = true;
+        }
     }
 
     if (TestEnvCI.deviceType == RENDER_DEVICE_TYPE_UNDEFINED)
@@ -886,7 +953,10 @@ TestingEnvironment* TestingEnvironment::Initialize(int argc, char** argv)
 
 #if VULKAN_SUPPORTED
             case RENDER_DEVICE_TYPE_VULKAN:
-                std::cout << "\n\n\n==================== Testing Diligent Core API in Vulkan mode ====================\n\n";
+                if (TestEnvCI.AdapterType == ADAPTER_TYPE_SOFTWARE)
+                    std::cout << "\n\n\n================== Testing Diligent Core API in Vulkan-SW mode ===================\n\n";
+                else
+                    std::cout << "\n\n\n==================== Testing Diligent Core API in Vulkan mode ====================\n\n";
                 pEnv = CreateTestingEnvironmentVk(TestEnvCI, SCDesc);
                 break;
 #endif
@@ -898,6 +968,13 @@ TestingEnvironment* TestingEnvironment::Initialize(int argc, char** argv)
                 break;
 #endif
 
+#if NULL_SUPPORTED
+            case RENDER_DEVICE_TYPE_NULL:
+                std::cout << "\n\n\n===================== Testing Diligent Core API in Null mode =====================\n\n";
+                pEnv = new TestingEnvironment{TestEnvCI, SCDesc};
+                break;
+#endif
+
             default:
                 LOG_ERROR_AND_THROW("Unsupported device type");
         }
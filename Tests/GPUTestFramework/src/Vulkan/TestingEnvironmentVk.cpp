@@ -47,7 +47,8 @@ void CreateTestingSwapChainVk(TestingEnvironmentVk* pEnv,
 
 TestingEnvironmentVk::TestingEnvironmentVk(const CreateInfo&    CI,
                                            const SwapChainDesc& SCDesc) :
-    TestingEnvironment{CI, SCDesc}
+    TestingEnvironment{CI, SCDesc},
+    m_CompletionThreadRequested{CI.EnableVkCompletionThread}
 {
 #if !DILIGENT_NO_GLSLANG
     GLSLangUtils::InitializeGlslang();
@@ -94,6 +95,19 @@ TestingEnvironmentVk::TestingEnvironmentVk(const CreateInfo&    CI,
                 HasDescriptorIndexing = true;
         }
 
+        std::vector<VkExtensionProperties> DeviceExtensions;
+
+        vkEnumerateDeviceExtensionProperties(m_vkPhysicalDevice, nullptr, &ExtensionCount, nullptr);
+        DeviceExtensions.resize(ExtensionCount);
+        vkEnumerateDeviceExtensionProperties(m_vkPhysicalDevice, nullptr, &ExtensionCount, DeviceExtensions.data());
+
+        bool HasDynamicRendering = false;
+        for (uint32_t i = 0; i < ExtensionCount; ++i)
+        {
+            if (!HasDynamicRendering && strcmp(DeviceExtensions[i].extensionName, VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME) == 0)
+                HasDynamicRendering = true;
+        }
+
         // Get extension features and properties.
         if (HasPhysicalDeviceProps2)
         {
@@ -110,6 +124,14 @@ TestingEnvironmentVk::TestingEnvironmentVk(const CreateInfo&    CI,
                 DescriptorIndexing.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
             }
 
+            if (HasDynamicRendering)
+            {
+                *NextFeat = &DynamicRendering;
+                NextFeat  = &DynamicRendering.pNext;
+
+                DynamicRendering.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR;
+            }
+
             vkGetPhysicalDeviceFeatures2KHR(m_vkPhysicalDevice, &Feats2);
         }
     }
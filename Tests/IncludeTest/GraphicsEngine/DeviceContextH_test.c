@@ -59,6 +59,8 @@ void TestDeviceContextCInterface(struct IDeviceContext* pCtx)
 
     IDeviceContext_Draw(pCtx, (struct DrawAttribs*)NULL);
     IDeviceContext_DrawIndexed(pCtx, (struct DrawIndexedAttribs*)NULL);
+    IDeviceContext_MultiDraw(pCtx, (struct MultiDrawAttribs*)NULL);
+    IDeviceContext_MultiDrawIndexed(pCtx, (struct MultiDrawIndexedAttribs*)NULL);
     IDeviceContext_DrawIndirect(pCtx, (struct DrawIndirectAttribs*)NULL);
     IDeviceContext_DrawIndexedIndirect(pCtx, (struct DrawIndexedIndirectAttribs*)NULL);
     IDeviceContext_DrawMesh(pCtx, (struct DrawMeshAttribs*)NULL);
@@ -121,4 +123,8 @@ void TestDeviceContextCInterface(struct IDeviceContext* pCtx)
     IDeviceContext_SetShadingRate(pCtx, SHADING_RATE_1X1, SHADING_RATE_COMBINER_PASSTHROUGH, SHADING_RATE_COMBINER_PASSTHROUGH);
 
     IDeviceContext_BindSparseResourceMemory(pCtx, (const BindSparseResourceMemoryAttribs*)NULL);
+
+    DeviceContextStats Stats;
+    IDeviceContext_GetStats(pCtx, &Stats);
+    IDeviceContext_ResetStats(pCtx);
 }
@@ -40,6 +40,9 @@ void TestPipelineResourceSignature(struct IPipelineResourceSignature* pSign)
     Uint32 Count = IPipelineResourceSignature_GetStaticVariableCount(pSign, SHADER_TYPE_UNKNOWN);
     (void)Count;
 
+    ShaderVariableHandle Handle = IPipelineResourceSignature_GetVariableHandle(pSign, SHADER_TYPE_UNKNOWN, "name");
+    (void)Handle;
+
     IPipelineResourceSignature_BindStaticResources(pSign, SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, (struct IResourceMapping*)NULL, BIND_SHADER_RESOURCES_UPDATE_STATIC);
 
     bool Comp = IPipelineResourceSignature_IsCompatibleWith(pSign, (const struct IPipelineResourceSignature*)NULL);
@@ -26,3 +26,12 @@
  */
 
 #include "DiligentCore/Graphics/GraphicsEngine/interface/Shader.h"
+
+void TestShader_CInterface(IShader* pShader)
+{
+    Uint32 ResCount = IShader_GetResourceCount(pShader);
+    (void)ResCount;
+
+    SHADER_STATUS Status = IShader_GetStatus(pShader, true);
+    (void)Status;
+}
@@ -26,3 +26,34 @@
  */
 
 #include "DiligentCore/Graphics/GraphicsEngine/interface/ShaderResourceBinding.h"
+
+void TestShaderResourceBinding(struct IShaderResourceBinding* pSRB)
+{
+    struct IPipelineResourceSignature* pSign = IShaderResourceBinding_GetPipelineResourceSignature(pSRB);
+    (void)pSign;
+
+    IShaderResourceBinding_BindResources(pSRB, SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, (struct IResourceMapping*)NULL, BIND_SHADER_RESOURCES_UPDATE_MUTABLE);
+
+    SHADER_RESOURCE_VARIABLE_TYPE_FLAGS StaleVarTypes = IShaderResourceBinding_CheckResources(pSRB, SHADER_TYPE_VERTEX, (struct IResourceMapping*)NULL, BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED);
+    (void)StaleVarTypes;
+
+    struct IShaderResourceVariable* pVar1 = IShaderResourceBinding_GetVariableByName(pSRB, SHADER_TYPE_VERTEX, "name");
+    (void)pVar1;
+
+    Uint32 Count = IShaderResourceBinding_GetVariableCount(pSRB, SHADER_TYPE_VERTEX);
+    (void)Count;
+
+    struct IShaderResourceVariable* pVar2 = IShaderResourceBinding_GetVariableByIndex(pSRB, SHADER_TYPE_VERTEX, 0);
+    (void)pVar2;
+
+    bool Initialized = IShaderResourceBinding_StaticResourcesInitialized(pSRB);
+    (void)Initialized;
+
+    ShaderVariableHandle Handle = {0};
+
+    struct IShaderResourceVariable* pVar3 = IShaderResourceBinding_GetVariableByHandle(pSRB, &Handle);
+    (void)pVar3;
+
+    ShaderVariableBinding Binding = {0};
+    IShaderResourceBinding_SetVariables(pSRB, &Binding, 1);
+}
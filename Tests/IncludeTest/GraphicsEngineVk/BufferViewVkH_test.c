@@ -31,5 +31,7 @@
 void TestBufferViewVk_CInterface(IBufferViewVk* pView)
 {
     VkBufferView vkView = IBufferViewVk_GetVkBufferView(pView);
+    Uint32       Index  = IBufferViewVk_GetBindlessHeapIndex(pView);
     (void)vkView;
+    (void)Index;
 }
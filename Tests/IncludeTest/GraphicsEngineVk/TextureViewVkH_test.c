@@ -31,5 +31,7 @@
 void TestTextureViewVk_CInterface(ITextureViewVk* pView)
 {
     VkImageView vkView = ITextureViewVk_GetVulkanImageView(pView);
+    Uint32      Index  = ITextureViewVk_GetBindlessHeapIndex(pView);
     (void)vkView;
+    (void)Index;
 }